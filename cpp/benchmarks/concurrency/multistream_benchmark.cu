@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fixture/multistream_fixture.hpp>
+#include <synchronization/synchronization.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <cudf/aggregation.hpp>
+#include <cudf/binaryop.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/types.hpp>
+
+#include <memory>
+#include <vector>
+
+class MultiStream : public cudf::benchmark {};
+
+// N copies of a small binaryop pipeline, one per stream; per-iteration time
+// should stay flat as streams are added if nothing synchronizes the device
+void BM_multistream_binaryop(benchmark::State& state) {
+  const cudf::size_type column_size{(cudf::size_type)state.range(0)};
+  const int num_streams{(int)state.range(1)};
+
+  auto data_it = cudf::test::make_counting_transform_iterator(
+      0, [](cudf::size_type row) { return static_cast<double>(row); });
+  std::vector<cudf::test::fixed_width_column_wrapper<double>> lhs;
+  std::vector<cudf::test::fixed_width_column_wrapper<double>> rhs;
+  for (int idx = 0; idx < num_streams; idx++) {
+    lhs.emplace_back(data_it, data_it + column_size);
+    rhs.emplace_back(data_it, data_it + column_size);
+  }
+
+  cudf::run_multistream(state, num_streams,
+                        [&](cudaStream_t stream, int idx) {
+    auto result = cudf::experimental::binary_operation(
+        lhs[idx], rhs[idx], cudf::experimental::binary_operator::ADD,
+        cudf::data_type{cudf::FLOAT64}, rmm::mr::get_default_resource(),
+        stream);
+  });
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          column_size * num_streams);
+}
+
+// adds a reduction per pipeline; the result scalar's device-to-host copy is
+// the classic place hidden default-stream syncs creep in
+void BM_multistream_binaryop_reduce(benchmark::State& state) {
+  const cudf::size_type column_size{(cudf::size_type)state.range(0)};
+  const int num_streams{(int)state.range(1)};
+
+  auto data_it = cudf::test::make_counting_transform_iterator(
+      0, [](cudf::size_type row) { return static_cast<double>(row); });
+  std::vector<cudf::test::fixed_width_column_wrapper<double>> lhs;
+  std::vector<cudf::test::fixed_width_column_wrapper<double>> rhs;
+  for (int idx = 0; idx < num_streams; idx++) {
+    lhs.emplace_back(data_it, data_it + column_size);
+    rhs.emplace_back(data_it, data_it + column_size);
+  }
+
+  cudf::run_multistream(state, num_streams,
+                        [&](cudaStream_t stream, int idx) {
+    auto sum = cudf::experimental::binary_operation(
+        lhs[idx], rhs[idx], cudf::experimental::binary_operator::ADD,
+        cudf::data_type{cudf::FLOAT64}, rmm::mr::get_default_resource(),
+        stream);
+    auto result = cudf::experimental::reduce(
+        sum->view(), cudf::experimental::make_sum_aggregation(),
+        cudf::data_type{cudf::FLOAT64}, rmm::mr::get_default_resource(),
+        stream);
+  });
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          column_size * num_streams);
+}
+
+#define MSBM_BENCHMARK_DEFINE(name, fn)                          \
+  BENCHMARK_DEFINE_F(MultiStream, name)(::benchmark::State& state) \
+  {                                                              \
+    fn(state);                                                   \
+  }                                                              \
+  BENCHMARK_REGISTER_F(MultiStream, name)                        \
+    ->UseManualTime()                                            \
+    ->Unit(benchmark::kMillisecond)                              \
+    ->Args({1 << 22, 1})                                         \
+    ->Args({1 << 22, 2})                                         \
+    ->Args({1 << 22, 4})                                         \
+    ->Args({1 << 22, 8});
+
+MSBM_BENCHMARK_DEFINE(BinaryOp, BM_multistream_binaryop)
+MSBM_BENCHMARK_DEFINE(BinaryOpReduce, BM_multistream_binaryop_reduce)
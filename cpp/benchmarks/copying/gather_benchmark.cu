@@ -85,8 +85,11 @@ void BM_gather(benchmark::State& state){
     cudf::gather(&source_table, gather_map.data().get(), &destination_table);
   }
   
-  state.SetBytesProcessed(
-      static_cast<int64_t>(state.iterations())*state.range(0)*n_cols*2*sizeof(TypeParam));
+  // each column is read once and written once, plus one read of the map
+  cudf::set_memory_traffic(
+      state,
+      state.range(0)*n_cols*sizeof(TypeParam) + state.range(0)*sizeof(cudf::size_type),
+      state.range(0)*n_cols*sizeof(TypeParam));
 }
 
 #define GBM_BENCHMARK_DEFINE(name, type, coalesce)                      \
@@ -17,6 +17,9 @@
 #include <rmm/rmm_api.h>
 #include <rmm/thrust_rmm_allocator.h>
 #include <benchmark/benchmark.h>
+#include <cuda_runtime_api.h>
+
+#include <cstddef>
 
 
 namespace cudf {
@@ -52,6 +55,61 @@ namespace cudf {
  * 
  * BENCHMARK_REGISTER_F(my_benchmark, my_test_name)->Range(128, 512);
  */
+/**
+ * @brief Returns the theoretical peak global memory bandwidth of the current
+ * device in bytes per second.
+ */
+inline double device_peak_memory_bandwidth() {
+  int device = 0;
+  cudaGetDevice(&device);
+  int clock_khz = 0;  // memory clock in KHz
+  int bus_width = 0;  // memory bus width in bits
+  cudaDeviceGetAttribute(&clock_khz, cudaDevAttrMemoryClockRate, device);
+  cudaDeviceGetAttribute(&bus_width, cudaDevAttrGlobalMemoryBusWidth, device);
+  // times two for double data rate
+  return 2.0 * clock_khz * 1000.0 * (bus_width / 8.0);
+}
+
+/**
+ * @brief Declares the device memory traffic of one benchmark iteration so
+ * results report achieved bandwidth against the device peak.
+ *
+ * Call once after the benchmark loop, with the bytes one iteration of the
+ * benchmarked operation reads and writes. In addition to the usual
+ * bytes-per-second column this adds counters for the achieved bandwidth in
+ * GB/s, the device peak in GB/s, and their ratio, making it obvious whether
+ * the operation is bandwidth-bound:
+ *
+ * ```
+ * for (auto _ : state) {
+ *   cuda_event_timer raii(state, true);
+ *   ... // benchmarked operation
+ * }
+ * set_memory_traffic(state, input_bytes, output_bytes);
+ * ```
+ *
+ * @param state The benchmark state the counters are reported on
+ * @param bytes_read Bytes read from device memory per iteration
+ * @param bytes_written Bytes written to device memory per iteration
+ */
+inline void set_memory_traffic(::benchmark::State& state,
+                               std::size_t bytes_read,
+                               std::size_t bytes_written) {
+  auto const total = bytes_read + bytes_written;
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * total);
+  state.counters["bytes_read"] = bytes_read;
+  state.counters["bytes_written"] = bytes_written;
+  auto const peak = device_peak_memory_bandwidth();
+  state.counters["peak_GB/s"] = peak / 1e9;
+  // rate counters divide by the measured time at report time
+  auto const iteration_bytes =
+      static_cast<double>(total) * state.iterations();
+  state.counters["achieved_GB/s"] =
+      ::benchmark::Counter(iteration_bytes / 1e9, ::benchmark::Counter::kIsRate);
+  state.counters["fraction_of_peak"] =
+      ::benchmark::Counter(iteration_bytes / peak, ::benchmark::Counter::kIsRate);
+}
+
 class benchmark : public ::benchmark::Fixture {
 public:
   virtual void SetUp(const ::benchmark::State& state) {
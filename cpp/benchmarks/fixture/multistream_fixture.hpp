@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "benchmark_fixture.hpp"
+
+#include <chrono>
+#include <vector>
+
+namespace cudf {
+
+/**
+ * @brief Owns a set of non-default CUDA streams for concurrency benchmarks.
+ */
+class stream_pool {
+ public:
+  explicit stream_pool(int num_streams) : streams(num_streams) {
+    for (auto& stream : streams) {
+      cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking);
+    }
+  }
+  ~stream_pool() {
+    for (auto stream : streams) {
+      cudaStreamDestroy(stream);
+    }
+  }
+  stream_pool(stream_pool const&) = delete;
+  stream_pool& operator=(stream_pool const&) = delete;
+
+  cudaStream_t operator[](int idx) const { return streams[idx]; }
+  int size() const { return streams.size(); }
+
+ private:
+  std::vector<cudaStream_t> streams;
+};
+
+/**
+ * @brief Runs `num_streams` copies of an operator pipeline concurrently, one
+ * per stream, and reports the aggregate wall time.
+ *
+ * Intended for catching concurrency regressions: register the benchmark with
+ * a stream-count argument (e.g. 1, 2, 4, 8) and compare rows — with truly
+ * asynchronous operators the per-iteration time stays flat as streams are
+ * added, while any hidden default-stream synchronization shows up as time
+ * growing linearly with the stream count.
+ *
+ * The pipeline callable is invoked as `pipeline(stream, index)` and must only
+ * enqueue work on the given stream. Wall time is measured on the host across
+ * launching all pipelines and synchronizing every stream, so the benchmark
+ * must be registered with `UseManualTime()`.
+ *
+ * @param state The benchmark state; per-iteration time is set manually
+ * @param num_streams Number of concurrent pipeline instances
+ * @param pipeline Callable enqueueing one pipeline instance on a stream
+ */
+template <typename Pipeline>
+void run_multistream(::benchmark::State& state, int num_streams,
+                     Pipeline&& pipeline) {
+  stream_pool streams(num_streams);
+  for (auto _ : state) {
+    auto const start = std::chrono::steady_clock::now();
+    for (int idx = 0; idx < num_streams; idx++) {
+      pipeline(streams[idx], idx);
+    }
+    for (int idx = 0; idx < num_streams; idx++) {
+      cudaStreamSynchronize(streams[idx]);
+    }
+    auto const end = std::chrono::steady_clock::now();
+    state.SetIterationTime(
+        std::chrono::duration<double>(end - start).count());
+  }
+  state.counters["streams"] = num_streams;
+}
+
+}  // namespace cudf
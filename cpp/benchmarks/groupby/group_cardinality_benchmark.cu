@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fixture/benchmark_fixture.hpp>
+#include <synchronization/synchronization.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/groupby.hpp>
+
+#include <random>
+#include <memory>
+
+class GroupbyCardinality : public cudf::benchmark {};
+class GroupbyAggregationMix : public cudf::benchmark {};
+
+namespace {
+
+template <typename T>
+T random_int(T min, T max)
+{
+  static unsigned seed = 13377331;
+  static std::mt19937 engine{seed};
+  std::uniform_int_distribution<T> uniform{min, max};
+
+  return uniform(engine);
+}
+
+}  // namespace
+
+// sweeps group cardinality at a fixed row count; state.range(0) is the row
+// count and state.range(1) the number of distinct keys
+void BM_cardinality_sum(benchmark::State& state){
+  using wrapper = cudf::test::fixed_width_column_wrapper<int64_t>;
+
+  const cudf::size_type column_size{(cudf::size_type)state.range(0)};
+  const int64_t cardinality{state.range(1)};
+
+  auto data_it = cudf::test::make_counting_transform_iterator(0,
+    [=](cudf::size_type row) { return random_int<int64_t>(0, cardinality - 1); });
+
+  wrapper keys(data_it, data_it + column_size);
+  wrapper vals(data_it, data_it + column_size);
+
+  cudf::experimental::groupby::groupby gb_obj(cudf::table_view({keys}));
+
+  std::vector<cudf::experimental::groupby::aggregation_request> requests;
+  requests.emplace_back(cudf::experimental::groupby::aggregation_request());
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(cudf::experimental::make_sum_aggregation());
+
+  for(auto _ : state){
+    cuda_event_timer timer(state, true);
+
+    auto result = gb_obj.aggregate(requests);
+  }
+}
+
+BENCHMARK_DEFINE_F(GroupbyCardinality, Sum)(::benchmark::State& state) {
+  BM_cardinality_sum(state);
+}
+
+// 100M rows, cardinality from 10 distinct keys up to all-unique
+BENCHMARK_REGISTER_F(GroupbyCardinality, Sum)
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond)
+  ->Args({100000000, 10})
+  ->Args({100000000, 1000})
+  ->Args({100000000, 100000})
+  ->Args({100000000, 10000000})
+  ->Args({100000000, 100000000});
+
+// a representative mixed aggregation request: hash-supported (sum, count,
+// min, max, mean) plus a sort-based quantile so both code paths are covered
+void BM_aggregation_mix(benchmark::State& state){
+  using wrapper = cudf::test::fixed_width_column_wrapper<int64_t>;
+
+  const cudf::size_type column_size{(cudf::size_type)state.range(0)};
+  const int64_t cardinality{state.range(1)};
+
+  auto data_it = cudf::test::make_counting_transform_iterator(0,
+    [=](cudf::size_type row) { return random_int<int64_t>(0, cardinality - 1); });
+
+  wrapper keys(data_it, data_it + column_size);
+  wrapper vals(data_it, data_it + column_size);
+
+  cudf::experimental::groupby::groupby gb_obj(cudf::table_view({keys}));
+
+  std::vector<cudf::experimental::groupby::aggregation_request> requests;
+  requests.emplace_back(cudf::experimental::groupby::aggregation_request());
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(cudf::experimental::make_sum_aggregation());
+  requests[0].aggregations.push_back(cudf::experimental::make_count_aggregation());
+  requests[0].aggregations.push_back(cudf::experimental::make_min_aggregation());
+  requests[0].aggregations.push_back(cudf::experimental::make_max_aggregation());
+  requests[0].aggregations.push_back(cudf::experimental::make_mean_aggregation());
+  requests[0].aggregations.push_back(cudf::experimental::make_median_aggregation());
+
+  for(auto _ : state){
+    cuda_event_timer timer(state, true);
+
+    auto result = gb_obj.aggregate(requests);
+  }
+}
+
+BENCHMARK_DEFINE_F(GroupbyAggregationMix, Mixed)(::benchmark::State& state) {
+  BM_aggregation_mix(state);
+}
+
+BENCHMARK_REGISTER_F(GroupbyAggregationMix, Mixed)
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond)
+  ->Args({10000000, 100})
+  ->Args({10000000, 100000})
+  ->Args({10000000, 10000000});
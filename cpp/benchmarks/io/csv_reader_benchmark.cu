@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cudf/io/functions.hpp>
+#include <cudf/table/table.hpp>
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/io/io_benchmark_common.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+namespace cudf_io = cudf::experimental::io;
+
+class CsvRead : public cudf::benchmark {};
+
+// benchmark matrix: (column count, string column percentage, null
+// percentage); CSV has no codec or row group axes
+void CSV_read(benchmark::State& state) {
+  cudf::size_type const num_cols = state.range(0);
+  int const string_pct = state.range(1);
+  int const null_pct = state.range(2);
+
+  constexpr cudf::size_type num_rows = 1 << 18;
+  srand(31337);
+  auto tbl = create_mixed_table(num_cols, num_rows, string_pct, null_pct);
+
+  cudf_io::table_metadata metadata;
+  for (cudf::size_type idx = 0; idx < num_cols; idx++) {
+    metadata.column_names.push_back("col" + std::to_string(idx));
+  }
+
+  // format once into a host buffer
+  std::vector<char> buffer;
+  cudf_io::write_csv_args args{cudf_io::sink_info(&buffer), tbl->view(),
+                               &metadata};
+  cudf_io::write_csv(args);
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf_io::read_csv_args read_args{
+        cudf_io::source_info(buffer.data(), buffer.size())};
+    cudf_io::read_csv(read_args);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          buffer.size());
+}
+
+#define CRBM_BENCHMARK_DEFINE(name, columns, string_pct, null_pct)  \
+  BENCHMARK_DEFINE_F(CsvRead, name)(::benchmark::State & state) {   \
+    CSV_read(state);                                                \
+  }                                                                 \
+  BENCHMARK_REGISTER_F(CsvRead, name)                               \
+      ->Args({columns, string_pct, null_pct})                       \
+      ->Unit(benchmark::kMillisecond)                               \
+      ->UseManualTime()                                             \
+      ->Iterations(4)
+
+// column count axis
+CRBM_BENCHMARK_DEFINE(8Cols, 8, 25, 10);
+CRBM_BENCHMARK_DEFINE(32Cols, 32, 25, 10);
+CRBM_BENCHMARK_DEFINE(256Cols, 256, 25, 10);
+
+// string ratio axis
+CRBM_BENCHMARK_DEFINE(AllNumeric, 32, 0, 10);
+CRBM_BENCHMARK_DEFINE(AllStrings, 32, 100, 10);
+
+// null density axis
+CRBM_BENCHMARK_DEFINE(NoNulls, 32, 25, 0);
+CRBM_BENCHMARK_DEFINE(HalfNulls, 32, 25, 50);
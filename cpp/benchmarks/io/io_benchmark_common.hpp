@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/table/table.hpp>
+
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Creates a table with a mix of numeric and string columns for reader
+ * benchmarks.
+ *
+ * The first `string_pct` percent of the columns are short random strings, the
+ * rest random int32; every column carries a validity mask with `null_pct`
+ * percent nulls. Callers should seed `srand` for reproducible content.
+ *
+ * @param num_columns Total number of columns
+ * @param num_rows Number of rows in every column
+ * @param string_pct Percentage of columns that are strings, [0,100]
+ * @param null_pct Percentage of rows that are null in every column, [0,100)
+ */
+inline std::unique_ptr<cudf::experimental::table> create_mixed_table(
+    cudf::size_type num_columns, cudf::size_type num_rows, int string_pct,
+    int null_pct) {
+  auto valids = cudf::test::make_counting_transform_iterator(
+      0, [null_pct](auto i) { return (i % 100) >= null_pct; });
+  cudf::size_type const num_string_cols = num_columns * string_pct / 100;
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.reserve(num_columns);
+  for (cudf::size_type idx = 0; idx < num_columns; idx++) {
+    if (idx < num_string_cols) {
+      std::vector<std::string> strings(num_rows);
+      std::generate(strings.begin(), strings.end(), []() {
+        std::string str(1 + rand() % 15, ' ');
+        std::generate(str.begin(), str.end(),
+                      []() { return 'a' + rand() % 26; });
+        return str;
+      });
+      columns.push_back(
+          cudf::test::strings_column_wrapper(strings.begin(), strings.end(),
+                                             valids)
+              .release());
+    } else {
+      auto rand_elements = cudf::test::make_counting_transform_iterator(
+          0, [](int i) { return rand(); });
+      columns.push_back(cudf::test::fixed_width_column_wrapper<int>(
+                            rand_elements, rand_elements + num_rows, valids)
+                            .release());
+    }
+  }
+  return std::make_unique<cudf::experimental::table>(std::move(columns));
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cudf/copying.hpp>
+#include <cudf/io/functions.hpp>
+#include <cudf/table/table.hpp>
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/io/io_benchmark_common.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+namespace cudf_io = cudf::experimental::io;
+
+class ParquetRead : public cudf::benchmark {};
+
+// benchmark matrix: (compression codec, column count, string column
+// percentage, null percentage, row group count)
+void PQ_read(benchmark::State& state) {
+  auto const compression = static_cast<cudf_io::compression_type>(state.range(0));
+  cudf::size_type const num_cols = state.range(1);
+  int const string_pct = state.range(2);
+  int const null_pct = state.range(3);
+  cudf::size_type const num_row_groups = state.range(4);
+
+  constexpr cudf::size_type num_rows = 1 << 19;
+  srand(31337);
+  auto tbl = create_mixed_table(num_cols, num_rows, string_pct, null_pct);
+
+  // encode once into a host buffer; each chunk becomes its own row group
+  std::vector<char> buffer;
+  cudf_io::write_parquet_chunked_args args{cudf_io::sink_info(&buffer), nullptr,
+                                           compression};
+  auto write_state = cudf_io::write_parquet_chunked_begin(args);
+  std::vector<cudf::size_type> splits;
+  for (cudf::size_type idx = 1; idx < num_row_groups; idx++) {
+    splits.push_back(idx * num_rows / num_row_groups);
+  }
+  for (auto const& chunk :
+       cudf::experimental::split(tbl->view(), splits)) {
+    cudf_io::write_parquet_chunked(chunk, write_state);
+  }
+  cudf_io::write_parquet_chunked_end(write_state);
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf_io::read_parquet_args read_args{
+        cudf_io::source_info(buffer.data(), buffer.size())};
+    cudf_io::read_parquet(read_args);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          buffer.size());
+}
+
+#define PRBM_BENCHMARK_DEFINE(name, codec, columns, string_pct, null_pct,      \
+                              row_groups)                                      \
+  BENCHMARK_DEFINE_F(ParquetRead, name)(::benchmark::State & state) {          \
+    PQ_read(state);                                                            \
+  }                                                                            \
+  BENCHMARK_REGISTER_F(ParquetRead, name)                                      \
+      ->Args({static_cast<int64_t>(cudf_io::compression_type::codec), columns, \
+              string_pct, null_pct, row_groups})                               \
+      ->Unit(benchmark::kMillisecond)                                          \
+      ->UseManualTime()                                                        \
+      ->Iterations(4)
+
+// codec axis
+PRBM_BENCHMARK_DEFINE(Uncompressed32Cols, NONE, 32, 25, 10, 8);
+PRBM_BENCHMARK_DEFINE(Snappy32Cols, SNAPPY, 32, 25, 10, 8);
+
+// column count axis
+PRBM_BENCHMARK_DEFINE(Snappy8Cols, SNAPPY, 8, 25, 10, 8);
+PRBM_BENCHMARK_DEFINE(Snappy256Cols, SNAPPY, 256, 25, 10, 8);
+
+// string ratio axis
+PRBM_BENCHMARK_DEFINE(SnappyAllNumeric, SNAPPY, 32, 0, 10, 8);
+PRBM_BENCHMARK_DEFINE(SnappyAllStrings, SNAPPY, 32, 100, 10, 8);
+
+// null density axis
+PRBM_BENCHMARK_DEFINE(SnappyNoNulls, SNAPPY, 32, 25, 0, 8);
+PRBM_BENCHMARK_DEFINE(SnappyHalfNulls, SNAPPY, 32, 25, 50, 8);
+
+// row group size axis
+PRBM_BENCHMARK_DEFINE(SnappyOneRowGroup, SNAPPY, 32, 25, 10, 1);
+PRBM_BENCHMARK_DEFINE(Snappy64RowGroups, SNAPPY, 32, 25, 10, 64);
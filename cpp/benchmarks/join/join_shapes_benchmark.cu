@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <fixture/benchmark_fixture.hpp>
+#include <synchronization/synchronization.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/join.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
+
+#include <memory>
+#include <numeric>
+#include <vector>
+
+// Benchmarks the inner join over the table shapes that show up in practice:
+// varying build/probe ratio, match selectivity, key skew, multi-column keys
+// and nullable keys. The single-shape join_benchmark.cu misses regressions
+// that only appear on skewed or selective inputs.
+
+namespace {
+
+// Stateless per-row mix (the MurmurHash3 finalizer) so the generators need no
+// curand state arrays
+__device__ inline uint32_t row_mix(uint32_t x) {
+  x ^= x >> 16;
+  x *= 0x85ebca6b;
+  x ^= x >> 13;
+  x *= 0xc2b2ae35;
+  x ^= x >> 16;
+  return x;
+}
+
+// Build keys are the unique values `[column_index, build_size + column_index)`
+std::unique_ptr<cudf::column> make_build_key_column(
+    cudf::size_type build_size, int column_index, bool nullable) {
+  auto column = cudf::make_numeric_column(
+      cudf::data_type{cudf::INT32}, build_size,
+      nullable ? cudf::mask_state::ALL_VALID : cudf::mask_state::UNALLOCATED);
+  auto view = column->mutable_view();
+  thrust::sequence(rmm::exec_policy(0)->on(0), view.data<int32_t>(),
+                   view.data<int32_t>() + build_size, column_index);
+  return column;
+}
+
+// Probe keys land in the build key range with probability
+// `selectivity_pct / 100` and in the disjoint range
+// `[build_size, 2 * build_size)` otherwise. Matching keys are drawn as
+// `build_size * u^skew`, so `skew == 1` probes the build keys uniformly while
+// larger values concentrate the probes on a shrinking set of hot keys.
+// Every key column of a row is offset from the same logical key, so the
+// number of key columns changes the comparison cost but not the output.
+std::unique_ptr<cudf::column> make_probe_key_column(
+    cudf::size_type probe_size, cudf::size_type build_size,
+    int selectivity_pct, double skew, int column_index, bool nullable) {
+  auto column = cudf::make_numeric_column(
+      cudf::data_type{cudf::INT32}, probe_size,
+      nullable ? cudf::mask_state::ALL_VALID : cudf::mask_state::UNALLOCATED);
+  auto view = column->mutable_view();
+  thrust::transform(
+      rmm::exec_policy(0)->on(0),
+      thrust::make_counting_iterator<cudf::size_type>(0),
+      thrust::make_counting_iterator<cudf::size_type>(probe_size),
+      view.data<int32_t>(),
+      [build_size, selectivity_pct, skew,
+       column_index] __device__(cudf::size_type row) {
+        const uint32_t r1 = row_mix(static_cast<uint32_t>(row) * 2654435761u + 1u);
+        const uint32_t r2 = row_mix(r1 + 0x9e3779b9u);
+        const double u = r2 * (1.0 / 4294967296.0);
+        int32_t key;
+        if (static_cast<int>(r1 % 100) < selectivity_pct) {
+          key = static_cast<int32_t>(pow(u, skew) * build_size);
+          if (key >= build_size) { key = build_size - 1; }
+        } else {
+          key = build_size + static_cast<int32_t>(u * build_size);
+        }
+        return key + column_index;
+      });
+  if (nullable) {
+    // Null out ~1% of the probe keys. The build side keeps a fully valid
+    // mask, so nulls never match and the output size stays comparable to the
+    // non-nullable runs while the null-aware hash and comparison paths are
+    // exercised.
+    cudf::set_null_mask(view.null_mask(), 0, probe_size / 100, false);
+  }
+  return column;
+}
+
+std::unique_ptr<cudf::column> make_payload_column(cudf::size_type num_rows) {
+  auto column = cudf::make_numeric_column(
+      cudf::data_type{cudf::INT32}, num_rows);
+  auto view = column->mutable_view();
+  thrust::sequence(rmm::exec_policy(0)->on(0), view.data<int32_t>(),
+                   view.data<int32_t>() + num_rows);
+  return column;
+}
+
+}  // namespace
+
+class JoinShapes : public cudf::benchmark {};
+
+static void BM_join_shapes(benchmark::State& state) {
+  const cudf::size_type build_size{static_cast<cudf::size_type>(state.range(0))};
+  const cudf::size_type probe_size{static_cast<cudf::size_type>(state.range(1))};
+  const int selectivity_pct{static_cast<int>(state.range(2))};
+  const double skew{state.range(3) / 10.0};
+  const int num_key_columns{static_cast<int>(state.range(4))};
+  const bool nullable_keys{state.range(5) != 0};
+
+  std::vector<std::unique_ptr<cudf::column>> build_columns;
+  std::vector<std::unique_ptr<cudf::column>> probe_columns;
+  for (int i = 0; i < num_key_columns; ++i) {
+    build_columns.push_back(make_build_key_column(build_size, i, nullable_keys));
+    probe_columns.push_back(make_probe_key_column(
+        probe_size, build_size, selectivity_pct, skew, i, nullable_keys));
+  }
+  build_columns.push_back(make_payload_column(build_size));
+  probe_columns.push_back(make_payload_column(probe_size));
+
+  CHECK_CUDA(0);
+
+  std::vector<cudf::column_view> build_views;
+  std::vector<cudf::column_view> probe_views;
+  for (auto const& column : build_columns) { build_views.push_back(column->view()); }
+  for (auto const& column : probe_columns) { probe_views.push_back(column->view()); }
+  cudf::table_view build_table{build_views};
+  cudf::table_view probe_table{probe_views};
+
+  std::vector<cudf::size_type> columns_to_join(num_key_columns);
+  std::iota(columns_to_join.begin(), columns_to_join.end(), 0);
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> columns_in_common;
+  for (int i = 0; i < num_key_columns; ++i) { columns_in_common.push_back({i, i}); }
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true, 0);
+
+    auto result = cudf::experimental::inner_join(
+        probe_table, build_table,
+        columns_to_join, columns_to_join,
+        columns_in_common);
+  }
+}
+
+BENCHMARK_DEFINE_F(JoinShapes, join_shapes)
+(::benchmark::State& st) {
+  BM_join_shapes(st);
+}
+
+// Args: {build_size, probe_size, selectivity_pct, skew * 10,
+//        num_key_columns, nullable_keys}
+static void JoinShapeRanges(benchmark::internal::Benchmark* b) {
+  // build/probe ratio
+  for (auto probe_ratio : {1, 4, 10}) {
+    b->Args({10'000'000, probe_ratio * 10'000'000, 30, 10, 1, 0});
+  }
+  // match selectivity
+  for (auto selectivity_pct : {1, 30, 90}) {
+    b->Args({10'000'000, 40'000'000, selectivity_pct, 10, 1, 0});
+  }
+  // key skew; 10 is uniform, larger concentrates probes on hot keys
+  for (auto skew_x10 : {20, 40}) {
+    b->Args({10'000'000, 40'000'000, 30, skew_x10, 1, 0});
+  }
+  // multi-column and nullable keys
+  b->Args({10'000'000, 40'000'000, 30, 10, 4, 0});
+  b->Args({10'000'000, 40'000'000, 30, 10, 1, 1});
+  b->Args({10'000'000, 40'000'000, 30, 10, 4, 1});
+}
+
+BENCHMARK_REGISTER_F(JoinShapes, join_shapes)
+    ->Apply(JoinShapeRanges)
+    ->Unit(benchmark::kMillisecond)
+    ->UseManualTime();
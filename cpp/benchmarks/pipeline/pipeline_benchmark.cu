@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/io/functions.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/tracking_memory_resource.hpp>
+
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+namespace cudf_io = cudf::experimental::io;
+
+class EtlPipeline : public cudf::benchmark {};
+
+namespace {
+
+// cardinality of the dimension table the decoded fact table is joined against
+constexpr cudf::size_type dim_rows = 1 << 20;
+// cardinality of the grouping key the joined table is aggregated on
+constexpr cudf::size_type num_groups = 512;
+
+}  // namespace
+
+/**
+ * The operator benchmarks measure each operator in isolation; the regressions
+ * this benchmark exists to catch come from their interaction — allocator
+ * behavior across operators with different allocation patterns and stream
+ * serialization between stages. One iteration runs the representative ETL
+ * shape end to end: decode a Snappy parquet fact table from a host buffer,
+ * inner-join it against a dimension table, group-aggregate the joined result
+ * and encode the aggregate back to parquet. Every stage allocates through a
+ * tracking_memory_resource, so results carry the pipeline's peak device
+ * memory alongside throughput.
+ *
+ * benchmark matrix: (total fact bytes, fact payload column count)
+ */
+void BM_etl_pipeline(benchmark::State& state) {
+  int64_t const total_desired_bytes = state.range(0);
+  cudf::size_type const num_payload_cols = state.range(1);
+
+  using wrapper = cudf::test::fixed_width_column_wrapper<int32_t>;
+  constexpr cudf::size_type el_size = 4;
+  cudf::size_type const num_cols = 2 + num_payload_cols;  // join key, group key, payloads
+  cudf::size_type const num_rows = total_desired_bytes / (num_cols * el_size);
+
+  // fact table: join key into the dimension table, grouping key, payloads
+  srand(31337);
+  std::vector<std::unique_ptr<cudf::column>> fact_cols;
+  auto join_keys = cudf::test::make_counting_transform_iterator(
+      0, [](cudf::size_type) { return rand() % dim_rows; });
+  fact_cols.push_back(wrapper(join_keys, join_keys + num_rows).release());
+  auto group_keys = cudf::test::make_counting_transform_iterator(
+      0, [](cudf::size_type) { return rand() % num_groups; });
+  fact_cols.push_back(wrapper(group_keys, group_keys + num_rows).release());
+  auto payload = cudf::test::make_counting_transform_iterator(
+      0, [](cudf::size_type) { return rand(); });
+  for (cudf::size_type idx = 0; idx < num_payload_cols; idx++) {
+    fact_cols.push_back(wrapper(payload, payload + num_rows).release());
+  }
+  cudf::experimental::table fact_table(std::move(fact_cols));
+
+  // encode the fact table once; reading this buffer is the pipeline's source
+  std::vector<char> parquet_buffer;
+  cudf_io::write_parquet_args encode_args{cudf_io::sink_info(&parquet_buffer),
+                                          fact_table.view(), nullptr,
+                                          cudf_io::compression_type::SNAPPY};
+  cudf_io::write_parquet(encode_args);
+
+  // dimension table: unique keys plus one attribute column
+  std::vector<std::unique_ptr<cudf::column>> dim_cols;
+  auto dim_keys = cudf::test::make_counting_transform_iterator(
+      0, [](cudf::size_type i) { return i; });
+  dim_cols.push_back(wrapper(dim_keys, dim_keys + dim_rows).release());
+  dim_cols.push_back(wrapper(payload, payload + dim_rows).release());
+  cudf::experimental::table dim_table(std::move(dim_cols));
+
+  cudf::tracking_memory_resource tracking(rmm::mr::get_default_resource());
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+
+    cudf_io::table_with_metadata fact;
+    {
+      cudf::tracking_memory_resource::operator_scope scope(tracking, "libcudf:read_parquet");
+      cudf_io::read_parquet_args read_args{
+          cudf_io::source_info(parquet_buffer.data(), parquet_buffer.size())};
+      fact = cudf_io::read_parquet(read_args, &tracking);
+    }
+
+    std::unique_ptr<cudf::experimental::table> joined;
+    {
+      cudf::tracking_memory_resource::operator_scope scope(tracking, "libcudf:inner_join");
+      joined = cudf::experimental::inner_join(fact.tbl->view(), dim_table.view(),
+                                              {0}, {0}, {{0, 0}}, &tracking);
+    }
+    fact.tbl.reset();
+
+    std::pair<std::unique_ptr<cudf::experimental::table>,
+              std::vector<cudf::experimental::groupby::aggregation_result>>
+        aggregated;
+    {
+      cudf::tracking_memory_resource::operator_scope scope(tracking, "libcudf:groupby");
+      cudf::experimental::groupby::groupby gb_obj(
+          cudf::table_view({joined->view().column(1)}));
+      std::vector<cudf::experimental::groupby::aggregation_request> requests(1);
+      requests[0].values = joined->view().column(2);
+      requests[0].aggregations.push_back(cudf::experimental::make_sum_aggregation());
+      aggregated = gb_obj.aggregate(requests, &tracking);
+    }
+    joined.reset();
+
+    {
+      cudf::tracking_memory_resource::operator_scope scope(tracking, "libcudf:write_parquet");
+      std::vector<char> out_buffer;
+      cudf::table_view result({aggregated.first->view().column(0),
+                               aggregated.second[0].results[0]->view()});
+      cudf_io::write_parquet_args write_args{cudf_io::sink_info(&out_buffer),
+                                             result, nullptr,
+                                             cudf_io::compression_type::SNAPPY};
+      cudf_io::write_parquet(write_args, &tracking);
+    }
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          total_desired_bytes);
+  // the release gate watches this alongside the time: interactions that leave
+  // more memory outstanding across stages move it even when throughput holds
+  state.counters["peak_device_MB"] =
+      static_cast<double>(tracking.peak_bytes()) / (1024 * 1024);
+}
+
+#define ETL_BENCHMARK_DEFINE(name, size, payload_columns)            \
+  BENCHMARK_DEFINE_F(EtlPipeline, name)(::benchmark::State & state) { \
+    BM_etl_pipeline(state);                                           \
+  }                                                                   \
+  BENCHMARK_REGISTER_F(EtlPipeline, name)                             \
+      ->Args({size, payload_columns})                                 \
+      ->Unit(benchmark::kMillisecond)                                 \
+      ->UseManualTime()                                               \
+      ->Iterations(4)
+
+// scale axis
+ETL_BENCHMARK_DEFINE(64Mb6Payload, (int64_t)64 * 1024 * 1024, 6);
+ETL_BENCHMARK_DEFINE(256Mb6Payload, (int64_t)256 * 1024 * 1024, 6);
+ETL_BENCHMARK_DEFINE(1Gb6Payload, (int64_t)1024 * 1024 * 1024, 6);
+
+// width axis
+ETL_BENCHMARK_DEFINE(1Gb30Payload, (int64_t)1024 * 1024 * 1024, 30);
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fixture/benchmark_fixture.hpp>
+#include <synchronization/synchronization.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/case.hpp>
+#include <cudf/strings/contains.hpp>
+#include <cudf/strings/split/split.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+class StringContains : public cudf::benchmark {};
+class StringSplit : public cudf::benchmark {};
+class StringCase : public cudf::benchmark {};
+
+namespace {
+
+// builds a strings column of `num_rows` random lowercase words of
+// approximately `avg_length` characters, space-separated every ~8 characters
+// so split has work to do
+cudf::test::strings_column_wrapper create_strings_column(
+    cudf::size_type num_rows, cudf::size_type avg_length)
+{
+  srand(31337);
+  std::vector<std::string> strings(num_rows);
+  std::generate(strings.begin(), strings.end(), [avg_length]() {
+    cudf::size_type const length = avg_length/2 + rand() % (avg_length + 1);
+    std::string str(length, ' ');
+    for (cudf::size_type idx = 0; idx < length; idx++) {
+      str[idx] = (idx % 8 == 7) ? ' ' : 'a' + rand() % 26;
+    }
+    return str;
+  });
+  return cudf::test::strings_column_wrapper(strings.begin(), strings.end());
+}
+
+}  // namespace
+
+// state.range(0) is the row count, state.range(1) the average string length
+
+void BM_contains(benchmark::State& state)
+{
+  auto const input = create_strings_column(state.range(0), state.range(1));
+  cudf::strings_column_view view(input);
+
+  for (auto _ : state) {
+    cuda_event_timer timer(state, true);
+
+    auto result = cudf::strings::contains_re(view, "\\d+cats");
+  }
+}
+
+void BM_split(benchmark::State& state)
+{
+  auto const input = create_strings_column(state.range(0), state.range(1));
+  cudf::strings_column_view view(input);
+  cudf::string_scalar delimiter(" ");
+
+  for (auto _ : state) {
+    cuda_event_timer timer(state, true);
+
+    auto result = cudf::strings::split(view, delimiter);
+  }
+}
+
+void BM_case(benchmark::State& state)
+{
+  auto const input = create_strings_column(state.range(0), state.range(1));
+  cudf::strings_column_view view(input);
+
+  for (auto _ : state) {
+    cuda_event_timer timer(state, true);
+
+    auto result = cudf::strings::to_upper(view);
+  }
+}
+
+#define STRINGS_BENCHMARK_DEFINE(fixture, name, fn)            \
+  BENCHMARK_DEFINE_F(fixture, name)(::benchmark::State& state) \
+  {                                                            \
+    fn(state);                                                 \
+  }                                                            \
+  BENCHMARK_REGISTER_F(fixture, name)                          \
+    ->UseManualTime()                                          \
+    ->Unit(benchmark::kMillisecond)                            \
+    ->Args({1 << 22, 8})                                       \
+    ->Args({1 << 22, 32})                                      \
+    ->Args({1 << 20, 128})                                     \
+    ->Args({1 << 18, 512});
+
+STRINGS_BENCHMARK_DEFINE(StringContains, ContainsRe, BM_contains)
+STRINGS_BENCHMARK_DEFINE(StringSplit, Split, BM_split)
+STRINGS_BENCHMARK_DEFINE(StringCase, ToUpper, BM_case)
@@ -66,7 +66,8 @@ class aggregation {
     NUNIQUE,   ///< count number of unique elements
     NTH_ELEMENT, ///< get the nth element
     PTX,       ///< PTX UDF based reduction
-    CUDA       ///< CUDA UDf based reduction
+    CUDA,      ///< CUDA UDf based reduction
+    APPROX_NUNIQUE ///< approximate count of unique elements
   };
 
   aggregation(aggregation::Kind a) : kind{a} {}
@@ -164,6 +165,20 @@ std::unique_ptr<aggregation> make_argmin_aggregation();
 std::unique_ptr<aggregation>
 make_nunique_aggregation(include_nulls _include_nulls = include_nulls::NO);
 
+/**
+ * @brief Factory to create an approximate `nunique` aggregation
+ *
+ * `approx_nunique` estimates the number of unique elements with a
+ * HyperLogLog sketch per group instead of counting exactly. The estimate is
+ * computed in a single pass without sorting the values and its relative
+ * standard error is about 2.3%.
+ *
+ * @param _include_nulls Indicates if a null value will be counted as one
+ * additional unique value.
+ */
+std::unique_ptr<aggregation>
+make_approx_nunique_aggregation(include_nulls _include_nulls = include_nulls::NO);
+
 /**
  * @brief Factory to create a `nth_element` aggregation
  *
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <memory>
+
+namespace cudf {
+namespace experimental {
+namespace ast {
+
+/**
+ * @brief Binary operators supported by expression trees.
+ *
+ * A subset of `cudf::experimental::binary_operator` covering the arithmetic
+ * operators the fused evaluator interprets.
+ */
+enum class ast_operator : int32_t {
+  ADD,        ///< lhs + rhs
+  SUB,        ///< lhs - rhs
+  MUL,        ///< lhs * rhs
+  DIV,        ///< lhs / rhs
+  MOD,        ///< fmod(lhs, rhs)
+  POW,        ///< pow(lhs, rhs)
+  MIN,        ///< min(lhs, rhs)
+  MAX         ///< max(lhs, rhs)
+};
+
+/**
+ * @brief Base class of expression tree nodes.
+ *
+ * Nodes are non-owning: an `operation` refers to its operands by reference, so
+ * every node must outlive the `compute_column()` call that evaluates the tree.
+ */
+struct expression {
+  virtual ~expression() = default;
+};
+
+/**
+ * @brief Leaf node referring to a column of the evaluated table by index.
+ */
+struct column_reference : public expression {
+  explicit column_reference(size_type column_index)
+      : column_index{column_index} {}
+
+  size_type column_index;
+};
+
+/**
+ * @brief Leaf node holding a numeric literal.
+ */
+struct literal : public expression {
+  explicit literal(double value) : value{value} {}
+
+  double value;
+};
+
+/**
+ * @brief Interior node applying a binary operator to two sub-expressions.
+ */
+struct operation : public expression {
+  operation(ast_operator op, expression const& lhs, expression const& rhs)
+      : op{op}, lhs{lhs}, rhs{rhs} {}
+
+  ast_operator op;
+  expression const& lhs;
+  expression const& rhs;
+};
+
+/**
+ * @brief Evaluates an expression tree over a table in a single fused pass.
+ *
+ * The tree is flattened into a postfix program and interpreted by one kernel,
+ * so a formula chaining N binary operations reads each referenced column once
+ * and writes only the final output, instead of materializing N intermediate
+ * columns through repeated `binary_operation()` calls.
+ *
+ * All referenced columns must be numeric. Evaluation is performed in double
+ * precision and the result is a FLOAT64 column. An output row is null if any
+ * column element it reads is null.
+ *
+ * @throws cudf::logic_error if a `column_reference` index is out of range
+ * @throws cudf::logic_error if a referenced column is not numeric
+ * @throws cudf::logic_error if the expression is deeper than the evaluator's
+ * stack limit
+ *
+ * @param table The table whose columns the expression may reference
+ * @param expr Root of the expression tree to evaluate
+ * @param mr Memory resource for allocating the output column
+ * @return FLOAT64 column holding the evaluated expression, one row per table
+ * row
+ */
+std::unique_ptr<column> compute_column(
+    table_view const& table,
+    expression const& expr,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+}  // namespace ast
+}  // namespace experimental
+}  // namespace cudf
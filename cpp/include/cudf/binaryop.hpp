@@ -72,6 +72,10 @@ enum class binary_operator : int32_t {
  * Regardless of the operator, the validity of the output value is the logical
  * AND of the validity of the two operands
  *
+ * If the column is dictionary encoded, the operator is evaluated once per
+ * dictionary key and the results are mapped through the indices, so the
+ * column is never decoded.
+ *
  * @param lhs         The left operand scalar
  * @param rhs         The right operand column
  * @param output_type The desired data type of the output column
@@ -85,7 +89,8 @@ std::unique_ptr<column> binary_operation(
     column_view const& rhs,
     binary_operator op,
     data_type output_type,
-    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream = 0);
 
 /**
  * @brief Performs a binary operation between a column and a scalar.
@@ -97,6 +102,10 @@ std::unique_ptr<column> binary_operation(
  * Regardless of the operator, the validity of the output value is the logical
  * AND of the validity of the two operands
  *
+ * If the column is dictionary encoded, the operator is evaluated once per
+ * dictionary key and the results are mapped through the indices, so the
+ * column is never decoded.
+ *
  * @param lhs         The left operand column
  * @param rhs         The right operand scalar
  * @param output_type The desired data type of the output column
@@ -110,7 +119,8 @@ std::unique_ptr<column> binary_operation(
     scalar const& rhs,
     binary_operator op,
     data_type output_type,
-    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream = 0);
 
 /**
  * @brief Performs a binary operation between two columns.
@@ -135,7 +145,8 @@ std::unique_ptr<column> binary_operation(
     column_view const& rhs,
     binary_operator op,
     data_type output_type,
-    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream = 0);
 
 /**
  * @brief Performs a binary operation between two columns using a
@@ -164,7 +175,42 @@ std::unique_ptr<column> binary_operation(
     column_view const& rhs,
     std::string const& ptx,
     data_type output_type,
-    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream = 0);
+
+/**
+ * @brief JIT compiles (or loads from the kernel cache) the kernels
+ * `binary_operation` would use for the given operator and types, without
+ * running them.
+ *
+ * The compiled kernels are left in the process-wide JIT cache, so the first
+ * real `binary_operation` call with this combination does not block on NVRTC
+ * compilation. Call during service startup for each operator/type combination
+ * on the latency-sensitive path.
+ *
+ * @param op          The operator to warm
+ * @param output_type The output data type of the warmed kernels
+ * @param lhs_type    The left operand data type of the warmed kernels
+ * @param rhs_type    The right operand data type of the warmed kernels
+ * @throw cudf::logic_error if any data type isn't fixed-width
+ */
+void precompile_binary_operation(binary_operator op,
+                                 data_type output_type,
+                                 data_type lhs_type,
+                                 data_type rhs_type);
+
+/**
+ * @brief Loads and deserializes the on-disk JIT kernel cache into the
+ * process-wide in-memory cache.
+ *
+ * By default the work runs on a background thread so service startup is not
+ * blocked; pass `async = false` to wait for the preload to finish. Cache
+ * entries that fail to read or deserialize are skipped and will be compiled
+ * on first use as before.
+ *
+ * @param async Whether to preload on a background thread
+ */
+void preload_jit_cache(bool async = true);
 
 }  // namespace experimental
 }  // namespace cudf
@@ -197,6 +197,24 @@ class column {
    *---------------------------------------------------------------------------**/
   bool has_nulls() const noexcept { return (null_count() > 0); }
 
+  /**---------------------------------------------------------------------------*
+   * @brief Returns the advisory ordering metadata for the column's elements.
+   *
+   * A default-constructed `order_metadata` indicates no known ordering.
+   * The metadata is propagated to views created from this column.
+   *---------------------------------------------------------------------------**/
+  order_metadata ordering() const noexcept { return _ordering; }
+
+  /**---------------------------------------------------------------------------*
+   * @brief Sets the advisory ordering metadata for the column's elements.
+   *
+   * The caller is responsible for the metadata actually describing the
+   * elements; downstream operations may rely on it without validation.
+   *
+   * @param ordering The ordering the elements are known to satisfy
+   *---------------------------------------------------------------------------**/
+  void set_ordering(order_metadata ordering) noexcept { _ordering = ordering; }
+
   /**---------------------------------------------------------------------------*
    * @brief Returns the number of child columns
    *---------------------------------------------------------------------------**/
@@ -307,6 +325,8 @@ class column {
                                     ///< May be empty if `null_count() == 0`
   mutable size_type _null_count{
       UNKNOWN_NULL_COUNT};  ///< The number of null elements
+  order_metadata _ordering{};  ///< Advisory ordering the elements are known
+                               ///< to satisfy, if any
   std::vector<std::unique_ptr<column>>
       _children{};  ///< Depending on element type, child
                     ///< columns may contain additional data
@@ -17,6 +17,7 @@
 
 #include <cudf/types.hpp>
 #include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <rmm/thrust_rmm_allocator.h>
 
@@ -384,4 +385,35 @@ std::unique_ptr<column> make_column_from_scalar(scalar const& s, size_type size,
     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
     cudaStream_t stream = 0 );
 
+/**
+ * @brief Construct a table of fixed-width columns carved from a single
+ * device allocation.
+ *
+ * Creating a wide table one column at a time performs one allocation per
+ * buffer, each with its own alignment padding and allocator bookkeeping.
+ * This factory computes the total size up front, allocates one slab, and
+ * lays the column data buffers (and null masks, if requested) out inside it
+ * at 64-byte alignment — the same contiguous layout `contiguous_split`
+ * produces.
+ *
+ * The returned views are backed by the `all_data` buffer of the result and
+ * must not outlive it. Masks for `ALL_VALID`/`ALL_NULL` are initialized;
+ * data buffers are uninitialized.
+ *
+ * @throws std::bad_alloc if device memory allocation fails
+ * @throws cudf::logic_error if any type is not fixed-width
+ *
+ * @param[in] types The element type of each column, in order
+ * @param[in] size The number of rows in every column
+ * @param[in] state Optional, controls allocation/initialization of the
+ * columns' null masks
+ * @param[in] stream Optional stream on which to issue all memory allocation
+ * and device kernels
+ * @param[in] mr Optional resource to use for the slab allocation
+ */
+experimental::contiguous_split_result make_contiguous_table(
+    std::vector<data_type> const& types, size_type size,
+    mask_state state = mask_state::UNALLOCATED, cudaStream_t stream = 0,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 }  // namespace cudf
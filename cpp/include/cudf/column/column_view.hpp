@@ -190,6 +190,26 @@ class column_view_base {
    *---------------------------------------------------------------------------**/
   size_type offset() const noexcept { return _offset; }
 
+  /**---------------------------------------------------------------------------*
+   * @brief Returns the advisory ordering metadata for the column's elements.
+   *
+   * A default-constructed `order_metadata` indicates no known ordering. The
+   * metadata is advisory only and carries no guarantee; it is recorded by
+   * operations that produce sorted output and may be consulted by operations
+   * that would otherwise re-validate their input's ordering.
+   *---------------------------------------------------------------------------**/
+  order_metadata ordering() const noexcept { return _ordering; }
+
+  /**---------------------------------------------------------------------------*
+   * @brief Sets the advisory ordering metadata for the column's elements.
+   *
+   * The caller is responsible for the metadata actually describing the
+   * elements; downstream operations may rely on it without validation.
+   *
+   * @param ordering The ordering the elements are known to satisfy
+   *---------------------------------------------------------------------------**/
+  void set_ordering(order_metadata ordering) noexcept { _ordering = ordering; }
+
  protected:
   data_type _type{EMPTY};   ///< Element type
   size_type _size{};  ///< Number of elements
@@ -200,6 +220,8 @@ class column_view_base {
   mutable size_type _null_count{};   ///< The number of null elements
   size_type _offset{};               ///< Index position of the first element.
                                      ///< Enables zero-copy slicing
+  order_metadata _ordering{};        ///< Advisory ordering the elements are
+                                     ///< known to satisfy, if any
 
   column_view_base() = default;
   ~column_view_base() = default;
@@ -21,6 +21,7 @@
 #include <cudf/column/column_view.hpp>
 #include <cudf/table/table.hpp>
 
+#include <cstdint>
 #include <memory>
 
 namespace cudf {
@@ -54,7 +55,69 @@ namespace experimental {
  */
 std::unique_ptr<table> gather(table_view const& source_table, column_view const& gather_map,
                               bool check_bounds = false,
-                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                              cudaStream_t stream = 0);
+
+/**
+ * @brief Gathers the specified rows of several tables through one gather map.
+ *
+ * Equivalent to calling `gather(source_tables[i], gather_map)` for each
+ * source table, but the gather map is type-dispatched and bounds-checked
+ * only once and all source columns are driven through a single gather
+ * pipeline, so applying one index map to many tables (e.g. the payload
+ * tables of a join) does not repay the per-call overhead per table.
+ *
+ * All source tables must have the same number of rows.
+ *
+ * @throws `cudf::logic_error` if `source_tables` is empty or its tables have
+ * mismatched row counts.
+ * @throws `cudf::logic_error` if `check_bounds == true` and an index exists in
+ * `gather_map` outside the range `[-n, n)`, where `n` is the number of rows in
+ * the source tables. If `check_bounds == false`, the behavior is undefined.
+ *
+ * @param[in] source_tables The input tables whose rows will be gathered
+ * @param[in] gather_map View into a non-nullable column of integral indices that maps the
+ * rows in the source columns to rows in the destination columns.
+ * @param[in] check_bounds Optionally perform bounds checking on the values
+ * of `gather_map` and throw an error if any of its values are out of bounds.
+ * @param[in] mr The resource to use for all allocations
+ * @return One gathered table per source table, in order
+ */
+std::vector<std::unique_ptr<table>> gather(std::vector<table_view> const& source_tables,
+                              column_view const& gather_map,
+                              bool check_bounds = false,
+                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                              cudaStream_t stream = 0);
+
+/**
+ * @brief Gathers rows addressed by an arithmetic sequence, without
+ * materializing the gather map.
+ *
+ * Row `i` of the result is row `init + i * step` of `source_table`, for
+ * `i` in `[0, count)`. Equivalent to building the map with
+ * `experimental::sequence` and gathering with it, except the indices are
+ * produced by an iterator inside the gather kernel, so identity maps,
+ * strided samplings, and reversals cost no device memory or bandwidth for
+ * the map itself.
+ *
+ * @throws `cudf::logic_error` if `check_bounds == true` and the sequence
+ * leaves the range `[0, n)`, where `n` is the number of rows in the source
+ * table. If `check_bounds == false`, the behavior is undefined.
+ *
+ * @param[in] source_table The input columns whose rows will be gathered
+ * @param[in] init Source row of the first output row
+ * @param[in] step Increment between consecutive source rows; may be negative
+ * @param[in] count Number of rows in the result
+ * @param[in] check_bounds Optionally check that the sequence stays within the
+ * source table and throw an error if it does not.
+ * @param[in] mr The resource to use for all allocations
+ * @return std::unique_ptr<table> Result of the gather
+ */
+std::unique_ptr<table> gather_sequence(table_view const& source_table,
+                              size_type init, size_type step, size_type count,
+                              bool check_bounds = false,
+                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                              cudaStream_t stream = 0);
 
 /**
  * @brief Scatters the rows of the source table into a copy of the target table
@@ -94,7 +157,8 @@ std::unique_ptr<table> gather(table_view const& source_table, column_view const&
 std::unique_ptr<table> scatter(
     table_view const& source, column_view const& scatter_map,
     table_view const& target, bool check_bounds = false,
-    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream = 0);
 
 /**
  * @brief Scatters a row of scalar values into a copy of the target table
@@ -130,7 +194,46 @@ std::unique_ptr<table> scatter(
 std::unique_ptr<table> scatter(
     std::vector<std::unique_ptr<scalar>> const& source, column_view const& indices,
     table_view const& target, bool check_bounds = false,
-    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream = 0);
+
+/**
+ * @brief Scatters the rows of the source table directly into the target table.
+ *
+ * Row `scatter_map[i]` of @p target is overwritten with row `i` of @p source;
+ * all other target rows are left untouched. Unlike `scatter`, the target is
+ * updated in place rather than deep-copied, and the values and null masks of
+ * all columns are written in a single fused kernel launch instead of
+ * scattering each column and rebuilding its mask separately, which makes this
+ * the preferred path for repeated incremental updates.
+ *
+ * Only fixed-width columns are supported. A target column must be nullable if
+ * the corresponding source column contains nulls. The null counts of the
+ * columns underlying @p target are not recomputed; they are already marked
+ * unknown by taking a mutable view.
+ *
+ * If the same index appears more than once in the scatter map, the result is
+ * undefined.
+ *
+ * @throws `cudf::logic_error` if the source and target have mismatched column
+ * counts or types, if any column is not fixed-width, or if a source column has
+ * nulls and the target column is not nullable.
+ * @throws `cudf::logic_error` if `check_bounds == true` and an index exists in
+ * `scatter_map` outside the range `[-n, n)`, where `n` is the number of rows in
+ * the target table. If `check_bounds == false`, the behavior is undefined.
+ *
+ * @param source The input columns containing values to be scattered into the
+ * target columns
+ * @param scatter_map A non-nullable column of integral indices that maps the
+ * rows in the source columns to rows in the target columns. A negative value
+ * `i` is interpreted as `i+n`.
+ * @param target The preallocated columns to update in place
+ * @param check_bounds Optionally perform bounds checking on the values of
+ * `scatter_map` and throw an error if any of its values are out of bounds.
+ */
+void scatter_in_place(
+    table_view const& source, column_view const& scatter_map,
+    mutable_table_view& target, bool check_bounds = false);
 
 /**
  * @brief Scatters the rows of a table to `n` tables according to a partition map
@@ -262,6 +365,40 @@ void copy_range_in_place(column_view const& source,
                          size_type source_begin, size_type source_end,
                          size_type target_begin);
 
+/**
+ * @brief Copies a range of elements in-place from every column of one table to
+ * the corresponding column of another.
+ *
+ * Equivalent to calling the column-wise `copy_range_in_place` on each pair of
+ * columns with the same range, but batches every column into a single
+ * descriptor-driven kernel launch so wide tables pay one launch instead of one
+ * per column. The explicit @p stream allows the copy to run off the default
+ * stream.
+ *
+ * If @p source and @p target refer to the same elements and the ranges overlap,
+ * the behavior is undefined.
+ *
+ * @throws `cudf::logic_error` if @p source and @p target have different numbers
+ * of columns, if any column pair has mismatched types, if any column is of a
+ * variable-width type, or if any source column has null values and its target
+ * column is not nullable.
+ * @throws `cudf::logic_error` for invalid range (see the column-wise overload).
+ *
+ * @param source The table to copy from
+ * @param target The preallocated table to copy into
+ * @param source_begin The starting index of the source range (inclusive)
+ * @param source_end The index of the last element in the source range
+ * (exclusive)
+ * @param target_begin The starting index of the target range (inclusive)
+ * @param stream CUDA stream on which to execute the copy
+ * @return void
+ */
+void copy_range_in_place(table_view const& source,
+                         mutable_table_view& target,
+                         size_type source_begin, size_type source_end,
+                         size_type target_begin,
+                         cudaStream_t stream = 0);
+
 /**
  * @brief Copies a range of elements out-of-place from one column to another.
  *
@@ -295,7 +432,8 @@ std::unique_ptr<column> copy_range(column_view const& source,
                                    size_type source_begin, size_type source_end,
                                    size_type target_begin,
                                    rmm::mr::device_memory_resource* mr =
-                                       rmm::mr::get_default_resource());
+                                       rmm::mr::get_default_resource(),
+                                   cudaStream_t stream = 0);
 
 /**
  * @brief Slices a `column_view` into a set of `column_view`s according to a set of indices.
@@ -481,6 +619,64 @@ std::vector<contiguous_split_result> contiguous_split(cudf::table_view const& in
                                                       std::vector<size_type> const& splits,
                                                       rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief A table serialized by `pack` into one device buffer plus relocatable metadata
+ *
+ * `metadata` is a host buffer describing the columns of the packed table as
+ * offsets into `gpu_data`; it contains no absolute pointers, so both pieces can
+ * be copied to host memory, written to a file, or shipped over IPC and later
+ * reassembled with `unpack` without any per-column copies. The `table_view`
+ * produced by `unpack` is valid only as long as the packed data it was
+ * reconstructed over.
+ */
+struct packed_columns {
+   std::vector<uint8_t>                metadata;
+   std::unique_ptr<rmm::device_buffer> gpu_data;
+};
+
+/**
+ * @brief Deep-copies a `table_view` into a single serialized block of memory.
+ *
+ * The table's columns (including children and null masks) are laid out in one
+ * contiguous `rmm::device_buffer` as in `contiguous_split`, and a relocatable
+ * metadata header describing them is built on the host. The pair can be
+ * transported as two opaque buffers and turned back into a `table_view` with
+ * `unpack`, avoiding the per-column copies of field-by-field serialization.
+ *
+ * @param input View of the table to pack
+ * @param[in] mr Optional, The resource to use for the packed device allocation
+ * @return The packed table
+ */
+packed_columns pack(cudf::table_view const& input,
+                    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Reconstructs a `table_view` over data packed by `pack`.
+ *
+ * No device memory is allocated or copied: the returned views point directly
+ * into `gpu_data`, which must be device-accessible memory holding the packed
+ * data block and must outlive the returned `table_view`.
+ *
+ * @throws `cudf::logic_error` if `metadata` is null.
+ *
+ * @param metadata Host pointer to the metadata produced by `pack`
+ * @param gpu_data Device pointer to the packed data block
+ * @return A `table_view` over the packed data
+ */
+table_view unpack(uint8_t const* metadata, uint8_t const* gpu_data);
+
+/**
+ * @brief Reconstructs a `table_view` over the contents of a `packed_columns`.
+ *
+ * @overload unpack
+ *
+ * The returned `table_view` must not outlive @p input.
+ *
+ * @param input The packed table to open
+ * @return A `table_view` over the packed data
+ */
+table_view unpack(packed_columns const& input);
+
 /**
  * @brief   Returns a new column, where each element is selected from either @p lhs or 
  *          @p rhs based on the value of the corresponding element in @p boolean_mask
@@ -501,7 +697,8 @@ std::vector<contiguous_split_result> contiguous_split(cudf::table_view const& in
  * @returns new column with the selected elements
  */
 std::unique_ptr<column> copy_if_else(column_view const& lhs, column_view const& rhs, column_view const& boolean_mask,
-                                    rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+                                    rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource(),
+                                    cudaStream_t stream = 0);
 
 /**
 * @brief Creates a new column by shifting all values by an offset.
@@ -539,6 +736,36 @@ std::unique_ptr<column> shift(column_view const& input,
                                 rmm::mr::get_default_resource(),
                               cudaStream_t stream = 0);
 
+/**
+* @brief Creates a new column of lagged differences, fusing shift and subtract.
+*
+* Elements will be determined by `output[idx] = input[idx] - input[idx - periods]`.
+* Elements whose lagged partner falls outside the column, and elements where
+* either operand is null, are null in the output. Equivalent to subtracting
+* `shift(input, periods)` from `input`, but in a single pass without
+* materializing the shifted column.
+*
+* Examples
+* -------------------------------------------------
+* input   = [0, 1, 3, 6, 10]
+* periods = 1
+* return  = [@, 1, 2, 3, 4]
+* -------------------------------------------------
+* input   = [0, 1, 3, 6, 10]
+* periods = -2
+* return  = [-3, -5, -7, @, @]
+*
+* @param input   Column to be differenced.
+* @param periods The lag at which to difference; may be negative.
+*
+* @throw cudf::logic_error if @p input dtype is not numeric.
+*/
+std::unique_ptr<column> diff(column_view const& input,
+                             size_type periods,
+                             rmm::mr::device_memory_resource *mr =
+                               rmm::mr::get_default_resource(),
+                             cudaStream_t stream = 0);
+
 /*
  * @brief   Returns a new column, where each element is selected from either @p lhs or 
  *          @p rhs based on the value of the corresponding element in @p boolean_mask
@@ -558,7 +785,8 @@ std::unique_ptr<column> shift(column_view const& input,
  * @returns new column with the selected elements
  */
 std::unique_ptr<column> copy_if_else(scalar const& lhs, column_view const& rhs, column_view const& boolean_mask,
-                                    rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+                                    rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource(),
+                                    cudaStream_t stream = 0);
 
 /**
  * @brief   Returns a new column, where each element is selected from either @p lhs or 
@@ -579,7 +807,8 @@ std::unique_ptr<column> copy_if_else(scalar const& lhs, column_view const& rhs,
  * @returns new column with the selected elements
  */
 std::unique_ptr<column> copy_if_else(column_view const& lhs, scalar const& rhs, column_view const& boolean_mask,
-                                    rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+                                    rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource(),
+                                    cudaStream_t stream = 0);
                                     
 /**
  * @brief   Returns a new column, where each element is selected from either @p lhs or 
@@ -598,7 +827,58 @@ std::unique_ptr<column> copy_if_else(column_view const& lhs, scalar const& rhs,
  * @returns new column with the selected elements
  */
 std::unique_ptr<column> copy_if_else( scalar const& lhs, scalar const& rhs, column_view const& boolean_mask,
-                                    rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+                                    rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource(),
+                                    cudaStream_t stream = 0);
+
+/**
+ * @brief   Returns a new table, where each element of each column is selected
+ *          from either the corresponding @p lhs or @p rhs column based on the
+ *          value of the corresponding element in @p boolean_mask
+ *
+ * Equivalent to calling `copy_if_else` on each column pair, but the boolean
+ * selector is read once per row and all fixed-width column pairs are
+ * processed by a single fused kernel.
+ *
+ * @throws cudf::logic_error if lhs and rhs do not have the same number of columns
+ * @throws cudf::logic_error if corresponding columns are not of the same type
+ * @throws cudf::logic_error if lhs and rhs are not of the same length
+ * @throws cudf::logic_error if boolean mask is not of type bool8
+ * @throws cudf::logic_error if boolean mask is not of the same length as lhs and rhs
+ * @param[in] lhs left-hand table_view
+ * @param[in] rhs right-hand table_view
+ * @param[in] boolean_mask column of `BOOL8` representing "left (true) / right (false)"
+ *            boolean for each row and null element represents false.
+ * @param[in] mr resource for allocating device memory
+ *
+ * @returns new table with the selected elements
+ */
+std::unique_ptr<table> copy_if_else( table_view const& lhs, table_view const& rhs, column_view const& boolean_mask,
+                                    rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource(),
+                                    cudaStream_t stream = 0);
+
+/**
+ * @brief   Returns a new table, where each element of each column is selected
+ *          from either the corresponding @p lhs column or @p rhs scalar based
+ *          on the value of the corresponding element in @p boolean_mask
+ *
+ * The scalar alternatives are broadcast directly by the fused kernel without
+ * materializing constant columns.
+ *
+ * @throws cudf::logic_error if rhs does not hold one scalar per lhs column
+ * @throws cudf::logic_error if a column and its scalar are not of the same type
+ * @throws cudf::logic_error if boolean mask is not of type bool8
+ * @throws cudf::logic_error if boolean mask is not of the same length as lhs
+ * @param[in] lhs left-hand table_view
+ * @param[in] rhs one right-hand scalar per column of `lhs`
+ * @param[in] boolean_mask column of `BOOL8` representing "left (true) / right (false)"
+ *            boolean for each row and null element represents false.
+ * @param[in] mr resource for allocating device memory
+ *
+ * @returns new table with the selected elements
+ */
+std::unique_ptr<table> copy_if_else( table_view const& lhs, std::vector<scalar const*> const& rhs, column_view const& boolean_mask,
+                                    rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource(),
+                                    cudaStream_t stream = 0);
 
 /**
  * @brief Scatters rows from the input table to rows of the output corresponding
@@ -19,10 +19,11 @@
 #include <cudf/types.hpp>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace cudf {
 namespace datetime {
-namespace detail {
 
 enum class datetime_component {
   INVALID = 0,
@@ -35,6 +36,10 @@ enum class datetime_component {
   SECOND,
 };
 
+namespace detail {
+
+using cudf::datetime::datetime_component;
+
 /**
  * @brief  Extracts the supplied datetime component from any date time type
  * and returns an int16_t cudf::column.
@@ -49,6 +54,36 @@ std::unique_ptr<column> extract_component(
     column_view const& column,
     cudaStream_t stream = 0,
     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Extracts all requested datetime components in a single pass,
+ * returning one int16_t cudf::column per component in request order.
+ *
+ * @param[in] cudf::column_view of the input datetime values
+ * @param[in] components The datetime components to extract
+ * @returns table of extracted int16_t components, one column per component
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ */
+std::unique_ptr<cudf::experimental::table> extract_datetime_components(
+    column_view const& column,
+    std::vector<datetime_component> const& components,
+    cudaStream_t stream = 0,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Converts UTC timestamps to the local time of the given timezone.
+ *
+ * @param[in] cudf::column_view of the input UTC timestamp values
+ * @param[in] timezone_name standard timezone name (for example, "US/Pacific")
+ * @returns cudf::column of the same timestamp type holding local times
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ * @throw cudf::logic_error if the timezone is not found or cannot be parsed
+ */
+std::unique_ptr<column> convert_timezone(
+    column_view const& column,
+    std::string const& timezone_name,
+    cudaStream_t stream = 0,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 }  // namespace detail
 
 /**
@@ -142,5 +177,50 @@ std::unique_ptr<cudf::column> extract_second(
     cudf::column_view const& column,
     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief  Extracts all requested datetime components in a single pass and
+ * returns one int16_t cudf::column per component, in request order.
+ *
+ * The civil-calendar conversion is computed once per timestamp and shared by
+ * every requested component, so extracting several components costs one pass
+ * instead of one `extract_*` call each.
+ *
+ * @param[in] cudf::column_view of the input datetime values
+ * @param[in] components The datetime components to extract
+ *
+ * @returns table of extracted int16_t components, one column per component
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ * @throw cudf::logic_error if `components` is empty or contains INVALID
+ */
+std::unique_ptr<cudf::experimental::table> extract_datetime_components(
+    cudf::column_view const& column,
+    std::vector<datetime_component> const& components,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Converts UTC timestamps to the local time of the given timezone
+ * and returns a cudf::column of the same timestamp type.
+ *
+ * The timezone's transition table, including daylight saving rules, is built
+ * once on the host from the system timezone database and looked up per row on
+ * the device, so the conversion is a single pass over the column. Timestamps
+ * past the last recorded transition follow the timezone's repeating 400-year
+ * daylight saving cycle. Sub-second parts are unaffected; for `TIMESTAMP_DAYS`
+ * columns sub-day offsets truncate toward zero.
+ *
+ * An empty `timezone_name` or `"UTC"` returns a copy of the input.
+ *
+ * @param[in] cudf::column_view of the input UTC timestamp values
+ * @param[in] timezone_name standard timezone name (for example, "US/Pacific")
+ *
+ * @returns cudf::column of the same timestamp type holding local times
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ * @throw cudf::logic_error if the timezone is not found or cannot be parsed
+ */
+std::unique_ptr<cudf::column> convert_timezone(
+    cudf::column_view const& column,
+    std::string const& timezone_name,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 }  // namespace datetime
 }  // namespace cudf
@@ -254,6 +254,12 @@ struct target_type_impl<Source, aggregation::NUNIQUE> {
   using type = cudf::size_type;
 };
 
+// Always use size_type accumulator for APPROX_NUNIQUE
+template <typename Source>
+struct target_type_impl<Source, aggregation::APPROX_NUNIQUE> {
+  using type = cudf::size_type;
+};
+
 // Always use Source for NTH_ELEMENT
 template <typename Source>
 struct target_type_impl<Source, aggregation::NTH_ELEMENT> {
@@ -352,6 +358,9 @@ CUDA_HOST_DEVICE_CALLABLE decltype(auto) aggregation_dispatcher(
     case aggregation::NTH_ELEMENT:
       return f.template operator()<aggregation::NTH_ELEMENT>(
           std::forward<Ts>(args)...);
+    case aggregation::APPROX_NUNIQUE:
+      return f.template operator()<aggregation::APPROX_NUNIQUE>(
+          std::forward<Ts>(args)...);
     default: {
 #ifndef __CUDA_ARCH__
       CUDF_FAIL("Unsupported aggregation.");
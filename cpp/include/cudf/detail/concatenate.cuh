@@ -77,6 +77,26 @@ void concatenate_masks(
  concatenate(std::vector<column_view> const& columns_to_concat,
              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
              cudaStream_t stream = 0);
- 
+
+}  // namespace detail
+
+namespace experimental {
+namespace detail {
+
+/**
+ * @copydoc cudf::experimental::concatenate(std::vector<table_view> const&,rmm::mr::device_memory_resource*)
+ *
+ * For batches of all-fixed-width tables with many columns, the copy
+ * descriptors of every column are batched into a single kernel launch
+ * instead of launching per column.
+ *
+ * @param stream Optional The stream on which to execute all allocations and copies
+ */
+std::unique_ptr<table>
+concatenate(std::vector<table_view> const& tables_to_concat,
+            rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+            cudaStream_t stream = 0);
+
 }  // namespace detail
+}  // namespace experimental
 }  // namespace cudf
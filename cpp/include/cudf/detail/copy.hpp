@@ -82,6 +82,20 @@ std::vector<contiguous_split_result> contiguous_split(cudf::table_view const& in
                                                       rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
                                                       cudaStream_t stream = 0);
 
+/**
+ * @copydoc cudf::experimental::pack
+ *
+ * @param stream Optional CUDA stream on which to execute kernels
+ **/
+packed_columns pack(cudf::table_view const& input,
+                    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                    cudaStream_t stream = 0);
+
+/**
+ * @copydoc cudf::experimental::unpack(uint8_t const*,uint8_t const*)
+ **/
+table_view unpack(uint8_t const* metadata, uint8_t const* gpu_data);
+
 /**
  * @brief Creates an uninitialized new column of the specified size and same type as the `input`.
  * Supports only fixed-width types.
@@ -188,6 +202,27 @@ std::unique_ptr<column> copy_if_else( scalar const& lhs, scalar const& rhs, colu
                                     rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource(),
                                     cudaStream_t stream = 0);
 
+/**
+ * @copydoc cudf::experimental::copy_if_else(table_view const&, table_view const&,
+ * column_view const&, rmm::mr::device_memory_resource*)
+ *
+ * @param[in] stream Optional CUDA stream on which to execute kernels
+ */
+std::unique_ptr<table> copy_if_else( table_view const& lhs, table_view const& rhs, column_view const& boolean_mask,
+                                    rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource(),
+                                    cudaStream_t stream = 0);
+
+/**
+ * @copydoc cudf::experimental::copy_if_else(table_view const&,
+ * std::vector<scalar const*> const&, column_view const&,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param[in] stream Optional CUDA stream on which to execute kernels
+ */
+std::unique_ptr<table> copy_if_else( table_view const& lhs, std::vector<scalar const*> const& rhs, column_view const& boolean_mask,
+                                    rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource(),
+                                    cudaStream_t stream = 0);
+
 }  // namespace detail
 }  // namespace experimental
 }  // namespace cudf
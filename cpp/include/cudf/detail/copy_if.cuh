@@ -274,7 +274,7 @@ struct scatter_gather_functor
        *input_device_view, block_offsets, input.size(), per_thread, filter);
 
     if (has_valid) {
-      output_column->set_null_count(null_count.value());
+      output_column->set_null_count(null_count.value(stream));
     }
     return output_column;
   }
@@ -140,7 +140,7 @@ std::unique_ptr<column> copy_if_else(data_type type, bool nullable,
       copy_if_else_kernel<block_size, Element, LeftIter, RightIter, FilterFn, true><<<grid.num_blocks, block_size, 0, stream>>>(
          lhs_begin, rhs, filter, *out_v, valid_count.data());
       
-      out->set_null_count(size - valid_count.value());      
+      out->set_null_count(size - valid_count.value(stream));      
    } else {
       // call the kernel
       copy_if_else_kernel<block_size, Element, LeftIter, RightIter, FilterFn, false><<<grid.num_blocks, block_size, 0, stream>>>(
@@ -177,7 +177,7 @@ void copy_range(SourceValueIterator source_value_begin,
       *mutable_column_device_view::create(target, stream),
       target_begin, target_end, null_count.data());
 
-    target.set_null_count(null_count.value());
+    target.set_null_count(null_count.value(stream));
   }
   else {
     auto kernel =
@@ -230,6 +230,15 @@ void copy_range_in_place(column_view const& source, mutable_column_view& target,
                          size_type target_begin,
                          cudaStream_t stream = 0);
 
+/**
+ * @copydoc cudf::experimental::copy_range_in_place(table_view const&,
+ * mutable_table_view&, size_type, size_type, size_type, cudaStream_t)
+ */
+void copy_range_in_place(table_view const& source, mutable_table_view& target,
+                         size_type source_begin, size_type source_end,
+                         size_type target_begin,
+                         cudaStream_t stream = 0);
+
 /**
  * @brief Internal API to copy a range of elements out-of-place from one column
  * to another.
@@ -33,6 +33,7 @@
 #include <rmm/thrust_rmm_allocator.h>
 
 #include <algorithm>
+#include <limits>
 
 #include <thrust/functional.h>
 #include <thrust/host_vector.h>
@@ -64,6 +65,21 @@ struct bounds_checker {
   }
 };
 
+/**
+ * @brief Returns the narrowest integer type able to index `num_rows` rows.
+ *
+ * Both gather and scatter re-read their map once per column, so narrowing a
+ * wide map up front saves bandwidth on every subsequent pass. The range
+ * `[-num_rows, num_rows)` must fit so that negative wrap-around indices
+ * survive the conversion. Only maps known to be in bounds may be narrowed:
+ * narrowing an out-of-range index can wrap it into the valid range and
+ * defeat later bounds checks.
+ */
+inline data_type narrowest_map_type(size_type num_rows) {
+  return (num_rows <= std::numeric_limits<int16_t>::max()) ? data_type{INT16}
+                                                           : data_type{INT32};
+}
+
 /**
  * @brief The operation to perform when a gather map index is out of bounds
  */
@@ -357,6 +373,24 @@ void gather_bitmask(table_view const& source, MapIterator gather_map,
   CUDF_EXPECTS(std::all_of(target.begin(), target.end(), [target_rows](auto const& col)
     { return target_rows == col->size(); }), "Column size mismatch");
 
+  // If no source column actually contains a null, every gathered bit would be
+  // valid: record the known null counts and drop any eagerly allocated target
+  // masks instead of launching the mask gather. PASSTHROUGH must still run,
+  // since it overwrites pre-existing target bits at the gathered rows.
+  if (op != gather_bitmask_op::PASSTHROUGH
+      and op != gather_bitmask_op::NULLIFY
+      and std::all_of(source.begin(), source.end(),
+                      [](auto const& col) { return not col.has_nulls(); })) {
+    for (auto& col : target) {
+      if (col->nullable()) {
+        col->set_null_mask(rmm::device_buffer{}, 0);
+      } else {
+        col->set_null_count(0);
+      }
+    }
+    return;
+  }
+
   // Create null mask if source is nullable but target is not
   for (size_t i = 0; i < target.size(); ++i) {
     if ((source.column(i).nullable() or op == gather_bitmask_op::NULLIFY)
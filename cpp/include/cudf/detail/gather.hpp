@@ -6,6 +6,7 @@
 #include <cudf/table/table.hpp>
 
 #include <memory>
+#include <vector>
 
 
 namespace cudf {
@@ -46,6 +47,32 @@ std::unique_ptr<table> gather(table_view const& source_table, column_view const&
 			      bool allow_negative_indices = false,
 			      rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
 			      cudaStream_t stream = 0);
+
+/**
+ * @copydoc cudf::experimental::gather(std::vector<table_view> const&,column_view const&,bool,rmm::mr::device_memory_resource*)
+ *
+ * @param[in] ignore_out_of_bounds Ignore values in `gather_map` that are
+ * out of bounds. Currently incompatible with `allow_negative_indices`,
+ * i.e., setting both to `true` is undefined.
+ * @param[in] allow_negative_indices Interpret each negative index `i` in the
+ * gathermap as the positive index `i+num_source_rows`.
+ * @param[in] stream The CUDA stream on which to execute kernels
+ */
+std::vector<std::unique_ptr<table>> gather(std::vector<table_view> const& source_tables,
+			      column_view const& gather_map,
+			      bool check_bounds = false, bool ignore_out_of_bounds = false,
+			      bool allow_negative_indices = false,
+			      rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+			      cudaStream_t stream = 0);
+
+/**
+ * @copydoc cudf::experimental::gather_sequence(table_view const&,size_type,size_type,size_type,bool,rmm::mr::device_memory_resource*,cudaStream_t)
+ */
+std::unique_ptr<table> gather_sequence(table_view const& source_table,
+			      size_type init, size_type step, size_type count,
+			      bool check_bounds = false,
+			      rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+			      cudaStream_t stream = 0);
 }  // namespace detail
 }  // namespace exp
 }  // namespace cudf
@@ -28,6 +28,13 @@ namespace detail {
  * the same bin are grouped consecutively in the output table. Returns a vector
  * of row offsets to the start of each partition in the output table.
  *
+ * Layout guarantee: each fixed-width output column is one dense device
+ * allocation holding its partitions back to back, so partition `p` of column
+ * `c` is exactly the bytes
+ * `[offsets[p] * width, offsets[p+1] * width)` of column `c`'s data buffer
+ * (the last partition ends at `num_rows`). Collective libraries may send a
+ * partition directly from these ranges; see `partition_spans`.
+ *
  * @throw std::out_of_range if index is `columns_to_hash` is invalid
  *
  * @param input The table to partition
@@ -61,5 +68,23 @@ std::unique_ptr<column> hash(table_view const& input,
                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
                              cudaStream_t stream = 0);
 
+/** --------------------------------------------------------------------------*
+ * @copydoc cudf::identity_hash
+ *
+ * @param stream Optional stream to use for allocations and copies
+ * -------------------------------------------------------------------------**/
+std::unique_ptr<column> identity_hash(table_view const& input,
+                                      rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                                      cudaStream_t stream = 0);
+
+/** --------------------------------------------------------------------------*
+ * @copydoc cudf::table_digest
+ *
+ * @param stream Optional stream to use for allocations and copies
+ * -------------------------------------------------------------------------**/
+digest128 table_digest(table_view const& input,
+                       size_type row_offset = 0,
+                       cudaStream_t stream = 0);
+
 }  // namespace detail
 }  // namespace cudf
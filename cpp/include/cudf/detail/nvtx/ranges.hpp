@@ -34,8 +34,25 @@ struct libcudf_domain {
  */
 using thread_range = ::nvtx3::domain_thread_range<libcudf_domain>;
 
+/**
+ * @brief Colors used to categorize ranges by libcudf subsystem.
+ *
+ * Mirrors the color scheme of the legacy `cudf::nvtx` ranges so both APIs
+ * produce consistent timelines.
+ */
+namespace range_color {
+static constexpr ::nvtx3::color io{0xffff00ff};       ///< purple
+static constexpr ::nvtx3::color join{0xff00ffff};     ///< cyan
+static constexpr ::nvtx3::color groupby{0xff00ff00};  ///< green
+static constexpr ::nvtx3::color strings{0xffffa500};  ///< orange
+}  // namespace range_color
+
 }  // namespace cudf
 
+// `DISABLE_NVTX` (set when building with `USE_NVTX=OFF`) compiles the range
+// macros out entirely so instrumented entry points carry zero overhead.
+#ifndef DISABLE_NVTX
+
 /**
  * @brief Convenience macro for generating an NVTX range in the `libcudf` domain
  * from the lifetime of a function.
@@ -53,3 +70,31 @@ using thread_range = ::nvtx3::domain_thread_range<libcudf_domain>;
  *
  */
 #define CUDF_FUNC_RANGE() NVTX3_FUNC_RANGE_IN(cudf::libcudf_domain)
+
+/**
+ * @brief Like `CUDF_FUNC_RANGE()`, additionally coloring the range to
+ * categorize it by subsystem.
+ *
+ * Example:
+ * ```
+ * void some_join_function(){
+ *    CUDF_FUNC_RANGE_COLOR(cudf::range_color::join);
+ *    ...
+ * }
+ * ```
+ *
+ * @param C The `nvtx3::color` for the range, e.g. one of `cudf::range_color`
+ */
+#define CUDF_FUNC_RANGE_COLOR(C)                                              \
+  static ::nvtx3::registered_message<cudf::libcudf_domain> const              \
+      nvtx3_func_name__{__func__};                                            \
+  static ::nvtx3::event_attributes const nvtx3_func_attr__{nvtx3_func_name__, \
+                                                           C};                \
+  cudf::thread_range const nvtx3_range__{nvtx3_func_attr__};
+
+#else
+
+#define CUDF_FUNC_RANGE()
+#define CUDF_FUNC_RANGE_COLOR(C)
+
+#endif  // DISABLE_NVTX
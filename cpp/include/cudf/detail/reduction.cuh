@@ -39,6 +39,8 @@ namespace detail {
  * @param[in] d_in      the begin iterator
  * @param[in] num_items the number of items
  * @param[in] op        the reduction operator
+ * @param[in] valid     validity of the result scalar; set at construction so
+ *                      no separate host-synchronizing `set_valid` is needed
  * @param[in] stream    cuda stream
  * @returns   Output scalar in device memory
  *
@@ -49,7 +51,7 @@ namespace detail {
 template <typename Op, typename InputIterator, typename OutputType=typename thrust::iterator_value<InputIterator>::type,
 typename std::enable_if_t<is_fixed_width<OutputType>()>* = nullptr>
 std::unique_ptr<scalar> reduce(InputIterator d_in, cudf::size_type num_items, op::simple_op<Op> sop,
-  rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+  bool valid, rmm::mr::device_memory_resource* mr, cudaStream_t stream)
 {
   auto binary_op = sop.get_binary_op();
   OutputType identity = sop.template get_identity<OutputType>();
@@ -65,7 +67,7 @@ std::unique_ptr<scalar> reduce(InputIterator d_in, cudf::size_type num_items, op
   cub::DeviceReduce::Reduce(d_temp_storage.data(), temp_storage_bytes, d_in, dev_result.data(), num_items, binary_op, identity, stream);
 
   using ScalarType = cudf::experimental::scalar_type_t<OutputType>;
-  auto s = new ScalarType(std::move(dev_result), true, stream, mr); //only for string_view, data is copied
+  auto s = new ScalarType(std::move(dev_result), valid, stream, mr); //only for string_view, data is copied
   return std::unique_ptr<scalar>(s);
 }
 
@@ -73,7 +75,7 @@ std::unique_ptr<scalar> reduce(InputIterator d_in, cudf::size_type num_items, op
 template <typename Op, typename InputIterator, typename OutputType=typename thrust::iterator_value<InputIterator>::type,
 typename std::enable_if_t<std::is_same<OutputType, string_view>::value>* = nullptr >
 std::unique_ptr<scalar> reduce(InputIterator d_in, cudf::size_type num_items, op::simple_op<Op> sop,
-  rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+  bool valid, rmm::mr::device_memory_resource* mr, cudaStream_t stream)
 {
   auto binary_op = sop.get_binary_op();
   OutputType identity = sop.template get_identity<OutputType>();
@@ -89,7 +91,7 @@ std::unique_ptr<scalar> reduce(InputIterator d_in, cudf::size_type num_items, op
   cub::DeviceReduce::Reduce(d_temp_storage.data(), temp_storage_bytes, d_in, dev_result.data(), num_items, binary_op, identity, stream);
 
   using ScalarType = cudf::experimental::scalar_type_t<OutputType>;
-  auto s = new ScalarType(dev_result, true, stream, mr); //only for string_view, data is copied
+  auto s = new ScalarType(dev_result, valid, stream, mr); //only for string_view, data is copied
   return std::unique_ptr<scalar>(s);
 }
 
@@ -97,7 +99,7 @@ std::unique_ptr<scalar> reduce(InputIterator d_in, cudf::size_type num_items, op
 template <typename Op, typename InputIterator, typename OutputType=typename thrust::iterator_value<InputIterator>::type,
 typename std::enable_if_t<std::is_same<OutputType, dictionary32>::value>* = nullptr >
 std::unique_ptr<scalar> reduce(InputIterator d_in, cudf::size_type num_items, op::simple_op<Op> sop,
-  rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+  bool valid, rmm::mr::device_memory_resource* mr, cudaStream_t stream)
 {
   CUDF_FAIL("dictionary type not supported");
 }
@@ -142,9 +144,11 @@ std::unique_ptr<scalar> reduce(InputIterator d_in, cudf::size_type num_items,
   // Run reduction
   cub::DeviceReduce::Reduce(d_temp_storage.data(), temp_storage_bytes, d_in, intermediate_result.data(), num_items, binary_op, identity, stream);
 
-  // compute the result value from intermediate value in device
+  // compute the result value from intermediate value in device; the validity
+  // is known on the host up front, so it is set at construction instead of
+  // with a separate synchronizing `set_valid`
   using ScalarType = cudf::experimental::scalar_type_t<OutputType>;
-  auto result = new ScalarType(OutputType{0}, true, stream, mr);
+  auto result = new ScalarType(OutputType{0}, valid_count > 0, stream, mr);
   thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
    intermediate_result.data(), 1,
    [dres=result->data(), cop, valid_count, ddof] __device__ (auto i)
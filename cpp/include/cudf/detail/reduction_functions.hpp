@@ -43,6 +43,31 @@ std::unique_ptr<scalar> all(
     column_view const& col, data_type const output_dtype,
     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
     cudaStream_t stream = 0);
+/**
+ * @brief Short-circuiting variants of `any()`/`all()` for `bool8` columns,
+ * plus a null-presence predicate.
+ *
+ * Unlike the reduce-based `any()`/`all()`, these kernels stop scanning the
+ * column as soon as the answer is known: the first hit sets a device-side flag
+ * that the remaining blocks observe and exit on. They run fully asynchronously
+ * on `stream`; reading the result through `scalar::value(stream)` is the
+ * synchronization point. Null elements are ignored, and the returned scalar is
+ * invalid when the column has no valid elements (matching `any()`/`all()`).
+ * `any_null()` is always valid and answers without a kernel launch when the
+ * column cannot contain nulls.
+ */
+std::unique_ptr<scalar> any_true(
+    column_view const& col,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream = 0);
+std::unique_ptr<scalar> all_true(
+    column_view const& col,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream = 0);
+std::unique_ptr<scalar> any_null(
+    column_view const& col,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream = 0);
 std::unique_ptr<scalar> product(
     column_view const& col, data_type const output_dtype,
     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
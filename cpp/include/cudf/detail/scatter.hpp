@@ -105,6 +105,16 @@ std::unique_ptr<table> scatter(
     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
     cudaStream_t stream = 0);
 
+/**
+ * @copydoc cudf::experimental::scatter_in_place
+ *
+ * @param stream The stream to use for CUDA operations
+ */
+void scatter_in_place(
+    table_view const& source, column_view const& scatter_map,
+    mutable_table_view& target, bool check_bounds = false,
+    cudaStream_t stream = 0);
+
 /**
  * @brief Scatters the rows of a table to `n` tables according to a partition map
  *
@@ -108,6 +108,50 @@ std::unique_ptr<column> upper_bound(table_view const& t,
                                     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
                                     cudaStream_t stream = 0);
 
+/**
+ * @copydoc cudf::experimental::batched_lower_bound
+ *
+ * @param stream Stream to use for any kernel launches.
+ */
+std::unique_ptr<column> batched_lower_bound(std::vector<column_view> const& haystacks,
+                                            std::vector<column_view> const& needles,
+                                            std::vector<order> const& column_order = {},
+                                            std::vector<null_order> const& null_precedence = {},
+                                            rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                                            cudaStream_t stream = 0);
+
+/**
+ * @copydoc cudf::experimental::batched_upper_bound
+ *
+ * @param stream Stream to use for any kernel launches.
+ */
+std::unique_ptr<column> batched_upper_bound(std::vector<column_view> const& haystacks,
+                                            std::vector<column_view> const& needles,
+                                            std::vector<order> const& column_order = {},
+                                            std::vector<null_order> const& null_precedence = {},
+                                            rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                                            cudaStream_t stream = 0);
+
+/**
+ * @copydoc cudf::experimental::digitize
+ *
+ * @param stream Stream to use for any kernel launches.
+ */
+std::unique_ptr<column> digitize(column_view const& input,
+                                 column_view const& bin_edges,
+                                 rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                                 cudaStream_t stream = 0);
+
+/**
+ * @copydoc cudf::experimental::batched_digitize
+ *
+ * @param stream Stream to use for any kernel launches.
+ */
+std::vector<std::unique_ptr<column>> batched_digitize(std::vector<column_view> const& inputs,
+                                                      std::vector<column_view> const& bin_edges,
+                                                      rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                                                      cudaStream_t stream = 0);
+
 /**
  * @brief Find if the `value` is present in the `col`
  *
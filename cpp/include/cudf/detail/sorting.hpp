@@ -71,6 +71,43 @@ std::unique_ptr<table> sort_by_key(
     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
     cudaStream_t stream = 0);
 
+/**
+ * @copydoc cudf::experimental::top_k
+ *
+ * @param[in] stream Optional CUDA stream on which to execute kernels
+ */
+std::unique_ptr<table> top_k(
+    table_view const& input, size_type k,
+    std::vector<order> const& column_order = {},
+    std::vector<null_order> const& null_precedence = {},
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream = 0);
+
+/**
+ * @copydoc cudf::experimental::segmented_sorted_order
+ *
+ * @param[in] stream Optional CUDA stream on which to execute kernels
+ */
+std::unique_ptr<column> segmented_sorted_order(
+    table_view const& keys, column_view const& segment_offsets,
+    std::vector<order> const& column_order = {},
+    std::vector<null_order> const& null_precedence = {},
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream = 0);
+
+/**
+ * @copydoc cudf::experimental::segmented_sort_by_key
+ *
+ * @param[in] stream Optional CUDA stream on which to execute kernels
+ */
+std::unique_ptr<table> segmented_sort_by_key(
+    table_view const& values, table_view const& keys,
+    column_view const& segment_offsets,
+    std::vector<order> const& column_order = {},
+    std::vector<null_order> const& null_precedence = {},
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream = 0);
+
 }  // namespace detail
 }  // namespace experimental
 }  // namespace cudf
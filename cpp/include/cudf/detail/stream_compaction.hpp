@@ -19,6 +19,7 @@
 #include <cudf/types.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/packed_bool.hpp>
 
 namespace cudf {
 namespace experimental {
@@ -67,6 +68,20 @@ std::unique_ptr<experimental::table>
                    rmm::mr::get_default_resource(),
                cudaStream_t stream = 0);
 
+/**
+ * @copydoc cudf::experimental::drop_nulls(table_view const&,
+ *                                         row_validity_summary const&,
+ *                                         rmm::mr::device_memory_resource*)
+ *
+ * @param[in] stream Optional CUDA stream on which to execute kernels
+ */
+std::unique_ptr<experimental::table>
+    drop_nulls(table_view const& input,
+               row_validity_summary const& summary,
+               rmm::mr::device_memory_resource *mr =
+                   rmm::mr::get_default_resource(),
+               cudaStream_t stream = 0);
+
 /**
  * @brief Filters `input` using `boolean_mask` of boolean values as a mask.
  *
@@ -96,6 +111,41 @@ std::unique_ptr<experimental::table>
                            rmm::mr::get_default_resource(),
                        cudaStream_t stream = 0);
 
+/**
+ * @copydoc cudf::experimental::apply_boolean_mask(table_view const&,packed_bool_column const&,rmm::mr::device_memory_resource*)
+ *
+ * @param[in] stream Optional CUDA stream on which to execute kernels
+ */
+std::unique_ptr<experimental::table>
+    apply_boolean_mask(table_view const& input,
+                       packed_bool_column const& boolean_mask,
+                       rmm::mr::device_memory_resource *mr =
+                           rmm::mr::get_default_resource(),
+                       cudaStream_t stream = 0);
+
+/**
+ * @copydoc cudf::experimental::mask_to_gather_map
+ *
+ * @param[in] stream Optional CUDA stream on which to execute kernels
+ */
+std::unique_ptr<column>
+    mask_to_gather_map(column_view const& boolean_mask,
+                       rmm::mr::device_memory_resource *mr =
+                           rmm::mr::get_default_resource(),
+                       cudaStream_t stream = 0);
+
+/**
+ * @copydoc cudf::experimental::apply_boolean_mask(std::vector<table_view> const&,column_view const&,rmm::mr::device_memory_resource*)
+ *
+ * @param[in] stream Optional CUDA stream on which to execute kernels
+ */
+std::vector<std::unique_ptr<experimental::table>>
+    apply_boolean_mask(std::vector<table_view> const& inputs,
+                       column_view const& boolean_mask,
+                       rmm::mr::device_memory_resource *mr =
+                           rmm::mr::get_default_resource(),
+                       cudaStream_t stream = 0);
+
 /**
  * @brief Create a new table without duplicate rows
  *
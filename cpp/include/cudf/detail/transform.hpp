@@ -49,6 +49,20 @@ std::unique_ptr<column> transform(
   rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource(),
   cudaStream_t stream = 0);
 
+/**
+ * @copydoc cudf::experimental::transform(std::vector<column_view> const&,
+ * std::string const&, data_type, bool, rmm::mr::device_memory_resource*)
+ *
+ * @param stream        CUDA stream on which to execute kernels
+ **/
+std::unique_ptr<column> transform(
+  std::vector<column_view> const& inputs,
+  std::string const& nary_udf,
+  data_type output_type,
+  bool is_ptx,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream = 0);
+
 /**
  * @copydoc cudf::experimental::nans_to_nulls
  *
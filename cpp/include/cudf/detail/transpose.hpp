@@ -34,5 +34,20 @@ std::unique_ptr<experimental::table> transpose(table_view const& input,
                                  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
                                  cudaStream_t stream = 0);
 
+/**
+ * @brief Transposes the input table directly into a single dense row-major
+ * column, the layout `experimental::interleave_columns` produces
+ *
+ * @throw cudf::logic_error if column types are non-homogenous
+ * @throw cudf::logic_error if column types are non-fixed-width
+ * @throw cudf::logic_error if any column contains nulls
+ *
+ * @param[in] input Input table of (ncols) number of columns each of size (nrows)
+ * @return Column of (nrows * ncols) elements with each input row contiguous
+ */
+std::unique_ptr<column> transpose_interleaved(table_view const& input,
+                                 rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                                 cudaStream_t stream = 0);
+
 }  // namespace detail
 }  // namespace cudf
@@ -58,6 +58,8 @@ std::unique_ptr<column> true_if(InputIterator begin, InputIterator end,
  *
  * @param input A `column_view` as input
  * @param op operation to perform
+ * @param mode Optional, accuracy/throughput trade-off for float32
+ * transcendentals
  * @param mr Optional, The resource to use for all allocations
  * @param stream Optional CUDA stream on which to execute kernels
  *
@@ -65,10 +67,31 @@ std::unique_ptr<column> true_if(InputIterator begin, InputIterator end,
  */
 std::unique_ptr<cudf::column> unary_operation(cudf::column_view const& input,
                                               cudf::experimental::unary_op op,
+                                              cudf::experimental::accuracy_mode mode =
+                                              cudf::experimental::accuracy_mode::PRECISE,
                                               rmm::mr::device_memory_resource* mr =
                                               rmm::mr::get_default_resource(),
                                               cudaStream_t stream = 0);
 
+/**
+ * @brief Casts the input to `out_type` and applies a short chain of unary
+ * operations in a single fused pass.
+ *
+ * @param input A `column_view` as input
+ * @param out_type Desired datatype of output column
+ * @param ops Operations to apply in order, at most 4
+ * @param mr Optional, The resource to use for all allocations
+ * @param stream Optional CUDA stream on which to execute kernels
+ *
+ * @returns std::unique_ptr<cudf::column> Result of the fused pipeline
+ */
+std::unique_ptr<cudf::column> unary_pipeline(cudf::column_view const& input,
+                                             data_type out_type,
+                                             std::vector<cudf::experimental::unary_op> const& ops,
+                                             rmm::mr::device_memory_resource* mr =
+                                             rmm::mr::get_default_resource(),
+                                             cudaStream_t stream = 0);
+
 
 /**
  * @brief  Casts data from dtype specified in input to dtype specified in output.
@@ -88,18 +88,34 @@ __global__ void valid_if_kernel(bitmask_type* output, InputIterator begin,
  * @return A pair containing a `device_buffer` with the new bitmask and it's
  * null count
  */
+/**
+ * @brief Populates a pre-allocated bitmask from a predicate over the elements
+ * in `[begin,end)` and returns the null count.
+ *
+ * Bit `i` of `output` will be set if `p(*(begin+i)) == true`. `output` must
+ * hold at least `distance(begin,end)` bits. Callers producing masks for many
+ * columns can carve `output` from one `create_null_masks` slab instead of
+ * allocating per column.
+ *
+ * @throws cudf::logic_error if `(begin > end)`
+ *
+ * @param output The pre-allocated bitmask to populate
+ * @param begin The beginning of the sequence
+ * @param end The end of the sequence
+ * @param p The predicate
+ * @param stream Stream on which to execute all GPU activity and device memory
+ * allocations.
+ * @return The null count of the populated bitmask
+ */
 template <typename InputIterator, typename Predicate>
-std::pair<rmm::device_buffer, size_type> valid_if(
-    InputIterator begin, InputIterator end, Predicate p,
+size_type valid_if(
+    bitmask_type* output, InputIterator begin, InputIterator end, Predicate p,
     cudaStream_t stream = 0,
     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) {
   CUDF_EXPECTS(begin <= end, "Invalid range.");
 
   size_type size = thrust::distance(begin, end);
 
-  auto null_mask =
-      create_null_mask(size, mask_state::UNINITIALIZED, stream, mr);
-
   size_type null_count{0};
   if (size > 0) {
     rmm::device_scalar<size_type> valid_count{0, stream, mr};
@@ -109,11 +125,28 @@ std::pair<rmm::device_buffer, size_type> valid_if(
 
     valid_if_kernel<block_size>
         <<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
-            static_cast<bitmask_type*>(null_mask.data()), begin, size, p,
-            valid_count.data());
+            output, begin, size, p, valid_count.data());
 
     null_count = size - valid_count.value(stream);
   }
+  return null_count;
+}
+
+template <typename InputIterator, typename Predicate>
+std::pair<rmm::device_buffer, size_type> valid_if(
+    InputIterator begin, InputIterator end, Predicate p,
+    cudaStream_t stream = 0,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) {
+  CUDF_EXPECTS(begin <= end, "Invalid range.");
+
+  size_type size = thrust::distance(begin, end);
+
+  auto null_mask =
+      create_null_mask(size, mask_state::UNINITIALIZED, stream, mr);
+
+  auto null_count = valid_if(static_cast<bitmask_type*>(null_mask.data()),
+                             begin, end, p, stream, mr);
+
   return std::make_pair(std::move(null_mask), null_count);
 }
 
@@ -53,6 +53,40 @@ std::unique_ptr<column> add_keys( dictionary_column_view const& dictionary_colum
                                   column_view const& new_keys,
                                   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Create a new dictionary column by appending the new keys elements
+ * after the existing keys of the dictionary_column.
+ *
+ * Unlike `add_keys`, the existing keys keep their positions so the indices
+ * are copied unchanged -- the cost is proportional to the number of keys,
+ * not the number of rows. New keys already present in the dictionary are
+ * ignored; the remainder are appended in their order of first occurrence.
+ * The resulting keys are therefore in insertion order and may not be
+ * sorted; use `add_keys` when sorted keys are required.
+ *
+ * ```
+ * d1 = { keys=["a", "c", "d"], indices=[2, 0, 1, 0, 1]}
+ * d2 = append_keys( d1, ["b", "c"] )
+ * d2 is now {keys=["a", "c", "d", "b"], indices=[2, 0, 1, 0, 1]}
+ * ```
+ *
+ * The output column will have the same number of rows as the input column.
+ * Null entries from the input column are copied to the output column.
+ * No new null entries are created by this operation.
+ *
+ * @throw cudf_logic_error if the new_keys type does not match the keys type in
+ *        the dictionary_column.
+ * @throw cudf_logic_error if the new_keys contain nulls.
+ *
+ * @param dictionary_column Existing dictionary column.
+ * @param new_keys New keys to append to the dictionary_column
+ * @param mr Resource for allocating memory for the output.
+ * @return New dictionary column.
+ */
+std::unique_ptr<column> append_keys( dictionary_column_view const& dictionary_column,
+                                     column_view const& new_keys,
+                                     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Create a new dictionary column by removing the specified keys
  * from the existing dictionary_column.
@@ -64,4 +64,48 @@ std::unique_ptr<experimental::table> from_dlpack(
 DLManagedTensor* to_dlpack(table_view const& input,
     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Expose a cudf table as a DLPack DLTensor without copying the data
+ *
+ * The returned tensor aliases the table's device memory: no device memory is
+ * allocated or copied, and the tensor is valid only as long as the viewed
+ * columns are alive and unchanged. The `deleter` frees only the host-side
+ * descriptor.
+ *
+ * All columns must have the same numeric data type and zero null count. A
+ * single column exports as a 1D tensor. Multiple columns export as a 2D
+ * column-major tensor and require the column buffers to be equally spaced in
+ * memory (e.g. a table imported via `from_dlpack` or reconstituted with
+ * `contiguous_split`); the spacing becomes the tensor's column stride.
+ *
+ * @throw cudf::logic_error if the data types are not equal or not numeric,
+ * if any column has a non-zero null count, or if multiple columns are not
+ * equally spaced in device memory
+ *
+ * @param input Table to expose as DLPack
+ *
+ * @return 1D or 2D DLPack tensor viewing the table data, or nullptr if the
+ * table has zero rows
+ */
+DLManagedTensor* to_dlpack_view(table_view const& input);
+
+/**
+ * @brief Expose a batch of cudf tables as DLPack DLTensors without copying
+ *
+ * Equivalent to calling `to_dlpack_view` on every input, but all descriptors
+ * are carved from one allocation, amortizing the host-side overhead for
+ * high-rate export loops. Each returned tensor's `deleter` must still be
+ * called; the shared allocation is freed once every tensor in the batch has
+ * been deleted. Tables with zero rows yield a nullptr entry.
+ *
+ * @throw cudf::logic_error under the same conditions as `to_dlpack_view`,
+ * applied to each input
+ *
+ * @param inputs Tables to expose as DLPack
+ *
+ * @return One DLPack tensor per input table, each viewing that table's data
+ */
+std::vector<DLManagedTensor*> to_dlpack_batched(
+    std::vector<table_view> const& inputs);
+
 }  // namespace cudf
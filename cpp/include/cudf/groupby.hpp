@@ -20,6 +20,7 @@
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -107,6 +108,46 @@ class groupby {
                    std::vector<order> const& column_order = {},
                    std::vector<null_order> const& null_precedence = {});
 
+  /**
+   * @brief Construct a groupby object that reuses a precomputed sort helper
+   *
+   * The helper memoizes the key sort order, group offsets and group labels.
+   * When the same keys are grouped repeatedly — e.g. one `groupby` object per
+   * aggregation pass over a fixed set of key columns — constructing each
+   * object from the helper of the previous one (see `shared_helper()`) makes
+   * the key sort run once instead of once per pass.
+   *
+   * A `groupby` constructed this way always uses the sort-based
+   * implementation, since that is where the memoized state applies.
+   *
+   * @note The caller must ensure that `helper` was constructed over a keys
+   * table equivalent to `keys` with the same `include_nulls_keys` setting, and
+   * that the data viewed by both outlives this object; neither is verified.
+   *
+   * @param keys Table whose rows act as the groupby keys
+   * @param helper Sort helper previously obtained from `shared_helper()` of a
+   * `groupby` constructed with an equivalent `keys`
+   * @param include_nulls_keys Indicates whether rows in `keys` that contain
+   * NULL values should be included. Must match the setting `helper` was
+   * constructed with
+   */
+  groupby(table_view const& keys,
+          std::shared_ptr<detail::sort::sort_groupby_helper> helper,
+          include_nulls include_nulls_keys = include_nulls::NO);
+
+  /**
+   * @brief Get a shareable handle to the memoized sort helper
+   *
+   * The helper is constructed on first use and caches the key sort order,
+   * group offsets and group labels. The returned handle can be passed to the
+   * constructor of another `groupby` over the same keys so that those
+   * computations are not repeated.
+   *
+   * @note The helper views the `keys` this object was constructed with; it
+   * must not outlive the data viewed by them.
+   */
+  std::shared_ptr<detail::sort::sort_groupby_helper> shared_helper();
+
   /**
    * @brief Performs grouped aggregations on the specified values.
    *
@@ -162,7 +203,8 @@ class groupby {
    */
   std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> aggregate(
       std::vector<aggregation_request> const& requests,
-      rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+      rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+      cudaStream_t stream = 0);
 
   /**
    * @brief The grouped data corresponding to a groupby operation on a set of values.
@@ -194,6 +236,34 @@ class groupby {
       rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()
   );
 
+  /**
+   * @brief Enables caching of aggregation results across `aggregate` calls.
+   *
+   * When enabled, results are additionally retained in a cache keyed by the
+   * identity of the values column (device address, size, offset, type and
+   * null mask) and the requested aggregation. Subsequent `aggregate` calls
+   * that request an already cached aggregation on the same values reuse the
+   * cached result — including as an input to dependent aggregations (e.g. a
+   * cached COUNT feeds a later VARIANCE request) — instead of recomputing it.
+   *
+   * Enabling caching pins the sort-based implementation so that the group
+   * ordering, and therefore the row correspondence of cached results, is
+   * stable across calls.
+   *
+   * @note The cache identifies a values column by where it points, not by
+   * its contents. The caller must call `clear_cached_results()` if the data
+   * viewed by a previously aggregated column is modified or reused for
+   * different contents.
+   */
+  void enable_result_caching();
+
+  /**
+   * @brief Drops all results retained by `enable_result_caching`.
+   *
+   * Caching remains enabled; subsequent `aggregate` calls repopulate the
+   * cache.
+   */
+  void clear_cached_results();
 
 private:
   table_view _keys;                    ///< Keys that determine grouping
@@ -205,8 +275,14 @@ private:
   std::vector<null_order> _null_precedence{};  ///< If keys are sorted,
                                                ///< indicates null order
                                                ///< of each column
-  std::unique_ptr<detail::sort::sort_groupby_helper> _helper; ///< Helper object
-                                       ///< used by sort based implementation
+  std::shared_ptr<detail::sort::sort_groupby_helper> _helper; ///< Helper object
+                                       ///< used by sort based implementation;
+                                       ///< shareable across groupby objects
+                                       ///< over the same keys
+  struct cached_results;               ///< Opt-in cross-call result cache
+  std::unique_ptr<cached_results> _cached_results;  ///< Results retained
+                                       ///< across aggregate calls; non-null
+                                       ///< only when caching is enabled
 
   /**
    * @brief Get the sort helper object
@@ -231,6 +307,101 @@ private:
                  cudaStream_t stream, rmm::mr::device_memory_resource* mr);
 
 };
+
+/**
+ * @brief Incrementally groups values by keys across successive batches and
+ * computes running aggregations on those groups.
+ *
+ * Unlike `groupby`, which aggregates a complete table in one shot, a
+ * `streaming_groupby` accepts one batch of keys and values per `update` call
+ * and folds it into running per-group partial results. Each `update` only
+ * pays for the incoming batch plus the number of groups seen so far, not for
+ * all rows ever observed, which is what makes repeated small-window
+ * aggregation affordable.
+ *
+ * Only aggregations whose partial results can be merged with another single
+ * pass are supported: SUM, MIN, MAX, COUNT_VALID and COUNT_ALL. COUNT
+ * results are returned as INT64 since running counts are merged by summing.
+ *
+ * Every `update` call must pass the same number of requests with the same
+ * aggregations in the same order; only the batch contents may change.
+ *
+ * Example:
+ * ```
+ * streaming_groupby sgb;
+ * for (auto const& batch : batches) {
+ *   sgb.update(batch.keys, batch.requests);
+ * }
+ * auto result = sgb.finalize();
+ * ```
+ */
+class streaming_groupby {
+ public:
+  streaming_groupby(streaming_groupby const&) = delete;
+  streaming_groupby(streaming_groupby&&) = delete;
+  streaming_groupby& operator=(streaming_groupby const&) = delete;
+  streaming_groupby& operator=(streaming_groupby&&) = delete;
+
+  /**
+   * @brief Construct a streaming groupby object
+   *
+   * @param include_nulls_keys Indicates whether rows in each batch's keys
+   * that contain NULL values should be included
+   */
+  explicit streaming_groupby(
+      include_nulls include_nulls_keys = include_nulls::NO);
+
+  ~streaming_groupby();
+
+  /**
+   * @brief Folds one batch of keys and values into the running aggregations.
+   *
+   * The batch is aggregated on its own first and the resulting per-group
+   * partials are then merged with the partials accumulated from previous
+   * batches, so the cost of a call grows with the batch size and the number
+   * of distinct groups rather than with the total number of rows observed.
+   *
+   * @throws cudf::logic_error if a requested aggregation is not supported
+   * for streaming, or if the request structure differs from previous calls,
+   * or if `requests[i].values.size() != keys.num_rows()`.
+   *
+   * @param keys Table whose rows act as the groupby keys for this batch
+   * @param requests The set of columns to aggregate and the aggregations to
+   * perform, structured identically on every call
+   * @param mr Memory resource used to allocate the updated partial results
+   */
+  void update(
+      table_view const& keys,
+      std::vector<aggregation_request> const& requests,
+      rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+  /**
+   * @brief Emits the accumulated groups and aggregation results and resets
+   * the object for reuse.
+   *
+   * The returned table and results have the same shape as those of
+   * `groupby::aggregate`, except that COUNT results are INT64. The order of
+   * the group rows is arbitrary.
+   *
+   * @throws cudf::logic_error if called before any `update`
+   *
+   * @return Pair containing the table with each group's unique key and a
+   * vector of aggregation_results for each request in the same order as
+   * specified in the `update` requests.
+   */
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>>
+  finalize();
+
+ private:
+  include_nulls _include_null_keys{include_nulls::NO};  ///< Include rows in
+                                                        ///< keys with NULLs
+  std::unique_ptr<table> _partial_keys;  ///< One row per group seen so far
+  std::vector<std::unique_ptr<column>> _partial_values;  ///< Running partial
+                                       ///< results, flattened across requests
+  std::vector<aggregation::Kind> _kinds;  ///< Kind of each partial column
+  std::vector<size_t> _request_sizes;  ///< Number of aggregations per request
+};
+
 }  // namespace groupby
 }  // namespace experimental
 }  // namespace cudf
@@ -27,6 +27,13 @@ namespace cudf {
  * value of the columns specified by `columns_to_hash`. Rows partitioned into
  * the same bin are grouped consecutively in the output table. Returns a vector
  * of row offsets to the start of each partition in the output table.
+ *
+ * Layout guarantee: each fixed-width output column is one dense device
+ * allocation holding its partitions back to back, so partition `p` of column
+ * `c` is exactly the bytes
+ * `[offsets[p] * width, offsets[p+1] * width)` of column `c`'s data buffer
+ * (the last partition ends at `num_rows`). Collective libraries may send a
+ * partition directly from these ranges; see `partition_spans`.
  * 
  * @throw std::out_of_range if index is `columns_to_hash` is invalid
  *
@@ -43,6 +50,37 @@ hash_partition(table_view const& input,
                int num_partitions,
                rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/** --------------------------------------------------------------------------*
+ * @brief Contiguous byte range of one partition of one column.
+ * -------------------------------------------------------------------------**/
+struct partition_span {
+  void const* data;  ///< Device pointer to the partition's first element
+  size_t size;       ///< Size of the partition in bytes
+};
+
+/** --------------------------------------------------------------------------*
+ * @brief Computes the device byte ranges of each partition of a partitioned
+ * table, for handing to collective communication libraries.
+ *
+ * Given the table and offsets produced by `hash_partition`, returns one span
+ * per column per partition describing the exact bytes of that partition in
+ * the column's data buffer. The spans alias the table's device memory — no
+ * copy is made — so they can be passed directly to e.g. ncclSend.
+ *
+ * Only null-free fixed-width columns are supported: null masks are
+ * bit-packed, so partition boundaries within them are not byte-addressable.
+ *
+ * @throw cudf::logic_error if a column is not fixed-width or contains nulls
+ *
+ * @param partitioned Table returned by `hash_partition`
+ * @param offsets Partition start offsets returned by `hash_partition`
+ *
+ * @returns For each partition, one span per column of `partitioned`
+ * -------------------------------------------------------------------------**/
+std::vector<std::vector<partition_span>>
+partition_spans(table_view const& partitioned,
+                std::vector<size_type> const& offsets);
+
 /** --------------------------------------------------------------------------*
  * @brief Computes the hash value of each row in the input set of columns.
  *
@@ -57,4 +95,76 @@ std::unique_ptr<column> hash(table_view const& input,
                              std::vector<uint32_t> const& initial_hash = {},
                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/** --------------------------------------------------------------------------*
+ * @brief Computes the hash value of each row using the identity hash.
+ *
+ * Each key is cast directly to its hash value with no mixing or finalizer
+ * rounds, so this is faster than `hash` but provides no avalanche behavior.
+ * Suitable when the keys are already well distributed (e.g. sequential or
+ * pre-hashed ids) or when the caller only needs a cheap row fingerprint.
+ *
+ * Only tables of 1-4 columns of a single integral type are supported.
+ *
+ * @throw cudf::logic_error if `input` is not 1-4 columns of one integral type
+ *
+ * @param input The table of columns to hash
+ * @param mr Optional resource to use for device memory allocation
+ *
+ * @returns A column where each row is the hash of a column from the input
+ * -------------------------------------------------------------------------**/
+std::unique_ptr<column> identity_hash(table_view const& input,
+                                      rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/** --------------------------------------------------------------------------*
+ * @brief 128-bit order-sensitive digest of a table, as computed by
+ * `table_digest`.
+ *
+ * Two tables with equal contents in the same row order produce equal
+ * digests; any change to a value, a null, or the row order changes the
+ * digest with overwhelming probability. Equality of digests is therefore
+ * probabilistic, not a proof of equality.
+ * -------------------------------------------------------------------------**/
+struct digest128 {
+  uint64_t low = 0;       ///< Low 64 bits of the digest
+  uint64_t high = 0;      ///< High 64 bits of the digest
+  size_type num_rows = 0; ///< Number of rows folded into the digest
+
+  bool operator==(digest128 const& other) const {
+    return low == other.low && high == other.high && num_rows == other.num_rows;
+  }
+  bool operator!=(digest128 const& other) const { return !(*this == other); }
+};
+
+/** --------------------------------------------------------------------------*
+ * @brief Combines the digests of two adjacent row ranges of a table.
+ *
+ * Equivalent to having digested the concatenation of the two ranges in one
+ * call, provided each range was digested with its global starting row as
+ * `row_offset`. The combine is associative and commutative, so chunk digests
+ * may be accumulated in any order.
+ * -------------------------------------------------------------------------**/
+inline digest128 combine_digests(digest128 const& lhs, digest128 const& rhs) {
+  return digest128{lhs.low + rhs.low, lhs.high + rhs.high,
+                   lhs.num_rows + rhs.num_rows};
+}
+
+/** --------------------------------------------------------------------------*
+ * @brief Computes an order-sensitive 128-bit digest of a table in one pass.
+ *
+ * Each row's hash is mixed with its global row index (`row_offset` plus its
+ * position in `input`) into two 64-bit lanes, and the lanes are summed over
+ * all rows. Baking the index into each row's contribution makes the digest
+ * sensitive to row order even though the cross-row combine is a commutative
+ * sum; the sum in turn lets chunked scans digest ranges independently and
+ * merge the results with `combine_digests`. Unlike `hash` followed by a
+ * reduction, no hash column is materialized.
+ *
+ * @param input The table of columns to digest
+ * @param row_offset Global index of the first row of `input`; pass the
+ * chunk's starting row when digesting a table in chunks, 0 otherwise
+ *
+ * @returns The 128-bit digest of `input`
+ * -------------------------------------------------------------------------**/
+digest128 table_digest(table_view const& input, size_type row_offset = 0);
+
 }  // namespace cudf
@@ -77,7 +77,8 @@ struct read_avro_args {
  */
 table_with_metadata read_avro(
     read_avro_args const& args,
-    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream = 0);
 
 /**---------------------------------------------------------------------------*
  * @brief Input arguments to the `read_json` interface
@@ -104,6 +105,11 @@ struct read_json_args {
 
   ///< Data types of the column; empty to infer dtypes
   std::vector<std::string> dtype;
+  /// Names of all columns in record order; when set the schema is locked and
+  /// the reader skips reading names from the first record of each batch.
+  /// Combined with `dtype`, no structure detection runs at all and records
+  /// decode straight to typed columns
+  std::vector<std::string> names;
   /// Specify the compression format of the source or infer from file extension
   compression_type compression = compression_type::AUTO;
 
@@ -123,9 +129,56 @@ struct read_json_args {
   explicit read_json_args(const source_info& src) : source(src) {}
 };
 
+/**
+ * @brief Settings to use for `read_json_multi()`
+ */
+struct read_json_multi_args {
+  /// Set of sources to read and fuse into a single table
+  std::vector<source_info> sources;
+
+  ///< Data types of the columns; empty to infer dtypes per source
+  std::vector<std::string> dtype;
+  /// Names of all columns in record order; locks the schema across sources
+  std::vector<std::string> names;
+  /// Specify the compression format of the sources or infer from file extension
+  compression_type compression = compression_type::AUTO;
+
+  ///< Read the files as a json object per line
+  bool lines = true;
+
+  /// Whether to parse dates as DD/MM versus MM/DD
+  bool dayfirst = false;
+
+  explicit read_json_multi_args() = default;
+
+  explicit read_json_multi_args(std::vector<source_info> srcs)
+      : sources(std::move(srcs)) {}
+};
+
+/**
+ * @brief Reads multiple newline-delimited JSON sources into a single fused table
+ *
+ * All sources must produce the same schema. Each source runs record detection
+ * and field decode with its own reader on its own stream, so many small
+ * buffers (e.g. batches pulled off a message queue) are parsed concurrently
+ * instead of paying per-call launch and sync overhead back to back; the
+ * per-source results are fused with a single concatenate pass. Passing
+ * explicit `dtype` avoids per-source type inference differences. Column
+ * metadata is taken from the first source.
+ *
+ * @param args Settings for controlling reading behavior
+ * @param mr Optional resource to use for device memory allocation
+ *
+ * @return The fused set of columns along with metadata
+ */
+table_with_metadata read_json_multi(
+    read_json_multi_args const& args,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 // Freeform API wraps the detail reader class API
 table_with_metadata read_json(read_json_args const& args,
-                                rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()); 
+                                rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                                cudaStream_t stream = 0); 
 
 /**
  * @brief Settings to use for `read_csv()`
@@ -212,6 +265,11 @@ struct read_csv_args {
   bool dayfirst = false;
   /// Cast timestamp columns to a specific type
   data_type timestamp_type{EMPTY};
+  /// Whether to flag rows with unparseable fields instead of only nulling
+  /// them; appends an INT64 "_error_offset" column holding the byte offset
+  /// of each flagged row within the parsed input (null for clean rows), so
+  /// bad rows can be quarantined without a second parse
+  bool error_row_offsets = false;
 
   explicit read_csv_args(source_info const& src) : source(src) {}
 };
@@ -236,8 +294,176 @@ struct read_csv_args {
  */
 table_with_metadata read_csv(
     read_csv_args const& args,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream = 0);
+
+/**
+ * @brief Reads a CSV dataset as a set of byte-range partitions
+ *
+ * The input is split into `num_partitions` contiguous byte ranges that are
+ * scanned for row offsets and decoded concurrently, each on its own stream.
+ * A row belongs to the partition its first byte falls into, so rows that
+ * straddle a partition boundary are returned exactly once. The first
+ * partition is read up front and its column names are reused by the
+ * remaining partitions; passing explicit `names` and `dtype` avoids any
+ * per-partition inference differences.
+ *
+ * Trailing partitions that would be empty (tiny inputs) are dropped, so the
+ * returned vector may hold fewer than `num_partitions` tables.
+ *
+ * @param args Settings for controlling reading behavior
+ * @param num_partitions Number of byte-range partitions to split the input into
+ * @param mr Optional resource to use for device memory allocation
+ *
+ * @return The per-partition tables along with their metadata
+ */
+std::vector<table_with_metadata> read_csv_partitioned(
+    read_csv_args const& args, size_type num_partitions,
     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Settings to use for `read_csv_chunked()`
+ */
+struct read_csv_chunked_args {
+  /// Settings for parsing; byte range fields are managed by the chunked reader
+  read_csv_args reader_args;
+
+  /// Number of input bytes covered per chunk
+  size_t chunk_bytes = 256 << 20;
+
+  explicit read_csv_chunked_args(read_csv_args const& args)
+      : reader_args(args) {}
+};
+
+/**
+ * @brief Forward declaration of anonymous chunked-reader state struct.
+ */
+namespace detail {
+namespace csv {
+  struct csv_chunked_read_state;
+};
+};
+
+/**
+ * @brief Begin the process of reading a CSV file in a chunked/stream form.
+ *
+ * The intent of the read_csv_chunked_ path is to allow ingesting an
+ * arbitrarily large CSV file under a bounded device-memory budget. Column
+ * names and types are inferred from the first chunk only and locked in;
+ * subsequent chunks are parsed with explicit dtypes in a single pass, so
+ * the whole-file type inference scan is avoided. Values in later chunks
+ * that do not fit the locked-in types parse as null; passing explicit
+ * `dtype` in the reader arguments avoids inference entirely.
+ *
+ * The following code snippet demonstrates how to read a CSV file as a
+ * series of bounded-size cudf::tables.
+ * @code
+ *  #include <cudf.h>
+ *  ...
+ *  cudf::experimental::io::read_csv_args read_args{cudf::source_info(filepath)};
+ *  cudf::experimental::io::read_csv_chunked_args args{read_args};
+ *  args.chunk_bytes = 512 * 1024 * 1024;
+ *  ...
+ *  auto state = cudf::read_csv_chunked_begin(args);
+ *  while (cudf::read_csv_chunked_has_next(state)) {
+ *    auto chunk = cudf::read_csv_chunked(state);
+ *    ...
+ *  }
+ *  cudf::read_csv_chunked_end(state);
+ * @endcode
+ *
+ * @param[in] args Settings for controlling reading behavior
+ * @param[in] mr Optional resource to use for device memory allocation
+ *
+ * @returns pointer to an anonymous state structure storing information about the chunked read. this
+ *          pointer must be passed to all subsequent read_csv_chunked() and read_csv_chunked_end()
+ *          calls.
+ */
+std::shared_ptr<detail::csv::csv_chunked_read_state> read_csv_chunked_begin(
+                                                read_csv_chunked_args const& args,
+                                                rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns whether any input bytes remain to be read.
+ *
+ * @param[in] state Opaque state information about the reader process. Must be the same pointer returned
+ *            from read_csv_chunked_begin()
+ */
+bool read_csv_chunked_has_next(std::shared_ptr<detail::csv::csv_chunked_read_state> state);
+
+/**
+ * @brief Read the next chunk of rows as a table.
+ *
+ * Chunks are split on row boundaries: a row belongs to the chunk its first
+ * byte falls into, so the final chunk may cover fewer input bytes.
+ *
+ * @param[in] state Opaque state information about the reader process. Must be the same pointer returned
+ *            from read_csv_chunked_begin()
+ *
+ * @return The next chunk of columns along with table metadata
+ */
+table_with_metadata read_csv_chunked(std::shared_ptr<detail::csv::csv_chunked_read_state> state);
+
+/**
+ * @brief Finish reading a chunked/stream CSV file.
+ *
+ * @param[in] state Opaque state information about the reader process. Must be the same pointer returned
+ *            from read_csv_chunked_begin()
+ */
+void read_csv_chunked_end(std::shared_ptr<detail::csv::csv_chunked_read_state>& state);
+
+/**
+ * @brief Settings to use for `write_csv()`
+ */
+struct write_csv_args {
+  /// Specify the sink to use for writer output
+  sink_info sink;
+  /// Set of columns to output
+  table_view table;
+  /// Optional associated metadata
+  const table_metadata *metadata;
+  /// String to use for null entries
+  std::string na_rep = "";
+  /// Indicates whether to write headers to csv
+  bool include_header = true;
+  /// Maximum number of rows to process and write per device pass
+  int rows_per_chunk = 1 << 16;
+  /// Character to use for separating lines
+  std::string line_terminator = "\n";
+  /// Character to use for separating column values
+  char inter_column_delimiter = ',';
+  /// String to use for values == 0 in boolean columns
+  std::string true_value = "true";
+  /// String to use for values != 0 in boolean columns
+  std::string false_value = "false";
+
+  explicit write_csv_args(sink_info const& snk, table_view const& table_,
+                          const table_metadata *metadata_ = nullptr)
+      : sink(snk), table(table_), metadata(metadata_) {}
+};
+
+/**
+ * @brief Writes a set of columns to CSV format
+ *
+ * All value formatting runs on the device using the cudf::strings conversion
+ * kernels; the assembled character stream is passed directly to the sink.
+ *
+ * The following code snippet demonstrates how to write columns to a file:
+ * @code
+ *  #include <cudf.h>
+ *  ...
+ *  std::string filepath = "dataset.csv";
+ *  cudf::experimental::io::write_csv_args args{cudf::experimental::io::sink_info(filepath), table->view()};
+ *  ...
+ *  cudf::experimental::io::write_csv(args);
+ * @endcode
+ *
+ * @param args Settings for controlling writing behavior
+ * @param mr Optional resource to use for device memory allocation
+ */
+void write_csv(write_csv_args const& args, rmm::mr::device_memory_resource* mr =
+                                               rmm::mr::get_default_resource());
+
 /**
  * @brief Settings to use for `read_orc()`
  */
@@ -295,7 +521,8 @@ struct read_orc_args {
  */
 table_with_metadata read_orc(
     read_orc_args const& args,
-    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream = 0);
 
 /**
  * @brief Settings to use for `write_orc()`
@@ -339,7 +566,8 @@ struct write_orc_args {
  * @param mr Optional resource to use for device memory allocation
  */
 void write_orc(write_orc_args const& args, rmm::mr::device_memory_resource* mr =
-                                               rmm::mr::get_default_resource());
+                                               rmm::mr::get_default_resource(),
+               cudaStream_t stream = 0);
 
 /**
  * @brief Settings to use for `write_orc_chunked()`
@@ -473,6 +701,48 @@ struct read_parquet_args {
  */
 table_with_metadata read_parquet(
     read_parquet_args const& args,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream = 0);
+
+/**
+ * @brief Settings to use for `read_parquet_multi()`
+ */
+struct read_parquet_multi_args {
+  /// Set of sources to read and fuse into a single table
+  std::vector<source_info> sources;
+
+  /// Names of column to read; empty is all
+  std::vector<std::string> columns;
+
+  /// Whether to store string data as categorical type
+  bool strings_to_categorical = false;
+  /// Whether to use PANDAS metadata to load columns
+  bool use_pandas_metadata = true;
+  /// Cast timestamp columns to a specific type
+  data_type timestamp_type{EMPTY};
+
+  explicit read_parquet_multi_args() = default;
+
+  explicit read_parquet_multi_args(std::vector<source_info> srcs)
+      : sources(std::move(srcs)) {}
+};
+
+/**
+ * @brief Reads multiple Parquet datasets into a single fused table
+ *
+ * All sources must share the same schema. Each source is read through its own
+ * reader instance on a separate CUDA stream, so page decompression and decode
+ * for different files overlap instead of serializing on per-file sync points,
+ * and the per-file results are fused with a single concatenate pass. Column
+ * metadata is taken from the first source.
+ *
+ * @param args Settings for controlling reading behavior
+ * @param mr Optional resource to use for device memory allocation
+ *
+ * @return The fused set of columns along with metadata
+ */
+table_with_metadata read_parquet_multi(
+    read_parquet_multi_args const& args,
     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
 /**
@@ -516,8 +786,19 @@ struct write_parquet_args {
  * @param mr Optional resource to use for device memory allocation
  */
 void write_parquet(write_parquet_args const& args, rmm::mr::device_memory_resource* mr =
-                                               rmm::mr::get_default_resource());
+                                               rmm::mr::get_default_resource(),
+                   cudaStream_t stream = 0);
+
 
+/**
+ * @brief Forward declarations of anonymous chunked-writer state structs.
+ */
+namespace detail {
+namespace parquet {
+  struct pq_chunked_state;
+  struct pq_writer_template;
+};
+};
 
 /**
  * @brief Settings to use for `write_parquet_chunked()`
@@ -531,6 +812,9 @@ struct write_parquet_chunked_args {
   statistics_freq stats_level;
   /// Optional associated metadata.
   const table_metadata_with_nullability *metadata;
+  /// Optional schema template shared by writes of identical-schema files.
+  /// See `make_parquet_writer_template()`.
+  std::shared_ptr<detail::parquet::pq_writer_template> schema_template;
 
   explicit write_parquet_chunked_args(sink_info const& sink_,
                               const table_metadata_with_nullability *metadata_ = nullptr,
@@ -540,13 +824,20 @@ struct write_parquet_chunked_args {
 };
 
 /**
- * @brief Forward declaration of anonymous chunked-writer state struct.
+ * @brief Creates a schema template for writing many identical-schema parquet files.
+ *
+ * Assign the returned template to the `schema_template` member of the
+ * `write_parquet_chunked_args` passed to every file's
+ * `write_parquet_chunked_begin()` call. The first write derives the file
+ * schema from its table and stores it in the template; subsequent writes
+ * copy the prebuilt schema and only verify their tables against it,
+ * avoiding per-file schema setup when writing many small files.
+ *
+ * A template must not be shared between writers running concurrently.
+ *
+ * @returns pointer to an anonymous schema template structure.
  */
-namespace detail {
-namespace parquet {
-  struct pq_chunked_state;
-};
-};
+std::shared_ptr<detail::parquet::pq_writer_template> make_parquet_writer_template();
 
 /**
  * @brief Begin the process of writing a parquet file in a chunked/stream form.
@@ -599,6 +890,158 @@ void write_parquet_chunked(table_view const& table, std::shared_ptr<detail::parq
  */                                            
 void write_parquet_chunked_end(std::shared_ptr<detail::parquet::pq_chunked_state>& state);
 
+/**
+ * @brief Lazily-decoded handle to a parquet dataset.
+ *
+ * Construction performs no decoding; each `read` call decodes only the
+ * requested columns. `read_filtered` additionally applies a row selection
+ * mask column by column as it decodes, so the full unfiltered table is
+ * never resident — peak memory is one undecimated column. This serves the
+ * read-then-filter pattern where most rows of most columns are dropped
+ * immediately after a plain `read_parquet`.
+ *
+ * @code
+ *  lazy_parquet_reader source{read_parquet_args{cudf::source_info(filepath)}};
+ *  auto keys = source.read({"key"});                     // decode one column
+ *  auto mask = ...;                                      // predicate on keys
+ *  auto rows = source.read_filtered(*mask, {"a", "b"});  // fused decode+filter
+ * @endcode
+ */
+class lazy_parquet_reader {
+ public:
+  /**
+   * @brief Constructs the handle; no data is read until a `read` call.
+   *
+   * @param args Settings for controlling reading behavior; any column
+   *             selection in `args` limits what later calls may request
+   * @param mr Optional resource to use for device memory allocation
+   */
+  explicit lazy_parquet_reader(read_parquet_args const& args,
+                               rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  ~lazy_parquet_reader();
+
+  /**
+   * @brief Decodes and returns only the requested columns.
+   *
+   * @param columns Names of columns to decode; empty means all columns
+   *
+   * @return The requested columns with metadata
+   */
+  table_with_metadata read(std::vector<std::string> const& columns = {});
+
+  /**
+   * @brief Decodes the requested columns one at a time, keeping only the
+   * rows selected by `row_mask`.
+   *
+   * @param row_mask Boolean column with one entry per row of the dataset;
+   *                 null or false entries drop the row
+   * @param columns Names of columns to decode; empty means all columns
+   *
+   * @return The requested columns filtered to the selected rows
+   */
+  table_with_metadata read_filtered(column_view const& row_mask,
+                                    std::vector<std::string> const& columns = {});
+
+ private:
+  struct impl;
+  std::unique_ptr<impl> _impl;
+};
+
+/**
+ * @brief Settings to use for `read_parquet_chunked()`
+ */
+struct read_parquet_chunked_args {
+  source_info source;
+
+  /// Names of column to read; empty is all
+  std::vector<std::string> columns;
+
+  /// Number of rows returned per chunk
+  size_type chunk_rows = 1 << 20;
+
+  /// Whether to store string data as categorical type
+  bool strings_to_categorical = false;
+  /// Whether to use PANDAS metadata to load columns
+  bool use_pandas_metadata = true;
+  /// Cast timestamp columns to a specific type
+  data_type timestamp_type{EMPTY};
+
+  explicit read_parquet_chunked_args(source_info const& src) : source(src) {}
+};
+
+/**
+ * @brief Forward declaration of anonymous chunked-reader state struct.
+ */
+namespace detail {
+namespace parquet {
+  struct pq_chunked_read_state;
+};
+};
+
+/**
+ * @brief Begin the process of reading a parquet file in a chunked/stream form.
+ *
+ * The intent of the read_parquet_chunked_ path is to allow reading an
+ * arbitrarily large parquet file under a bounded output-memory budget. The
+ * reader instance, along with its parsed file metadata and internal scratch,
+ * stays alive across chunks instead of being rebuilt per call.
+ *
+ * The following code snippet demonstrates how to read a parquet file as a
+ * series of bounded-size cudf::tables.
+ * @code
+ *  #include <cudf.h>
+ *  ...
+ *  std::string filepath = "dataset.parquet";
+ *  cudf::experimental::io::read_parquet_chunked_args args{cudf::source_info(filepath)};
+ *  args.chunk_rows = 10 * 1024 * 1024;
+ *  ...
+ *  auto state = cudf::read_parquet_chunked_begin(args);
+ *  while (cudf::read_parquet_chunked_has_next(state)) {
+ *    auto chunk = cudf::read_parquet_chunked(state);
+ *    ...
+ *  }
+ *  cudf::read_parquet_chunked_end(state);
+ * @endcode
+ *
+ * @param[in] args Settings for controlling reading behavior
+ * @param[in] mr Optional resource to use for device memory allocation
+ *
+ * @returns pointer to an anonymous state structure storing information about the chunked read. this
+ *          pointer must be passed to all subsequent read_parquet_chunked() and read_parquet_chunked_end()
+ *          calls.
+ */
+std::shared_ptr<detail::parquet::pq_chunked_read_state> read_parquet_chunked_begin(
+                                                read_parquet_chunked_args const& args,
+                                                rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns whether any rows remain to be read.
+ *
+ * @param[in] state Opaque state information about the reader process. Must be the same pointer returned
+ *            from read_parquet_chunked_begin()
+ */
+bool read_parquet_chunked_has_next(std::shared_ptr<detail::parquet::pq_chunked_read_state> state);
+
+/**
+ * @brief Read the next chunk of rows as a table.
+ *
+ * The final chunk may contain fewer rows than the configured budget.
+ *
+ * @param[in] state Opaque state information about the reader process. Must be the same pointer returned
+ *            from read_parquet_chunked_begin()
+ *
+ * @return The next chunk of columns along with table metadata
+ */
+table_with_metadata read_parquet_chunked(std::shared_ptr<detail::parquet::pq_chunked_read_state> state);
+
+/**
+ * @brief Finish reading a chunked/stream parquet file.
+ *
+ * @param[in] state Opaque state information about the reader process. Must be the same pointer returned
+ *            from read_parquet_chunked_begin()
+ */
+void read_parquet_chunked_end(std::shared_ptr<detail::parquet::pq_chunked_read_state>& state);
+
 }  // namespace io
 }  // namespace experimental
 }  // namespace cudf
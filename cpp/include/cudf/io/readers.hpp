@@ -47,6 +47,29 @@ namespace io {
 //! Inner interfaces and implementations
 namespace detail {
 
+/**
+ * @brief Min/max predicate evaluated against per-chunk column statistics.
+ *
+ * A filter expresses `column <comparison> value`. Data chunks (Parquet row
+ * groups, ORC stripes) whose column statistics prove that no row can satisfy
+ * the predicate are skipped entirely; chunks with missing or unsupported
+ * statistics are always read, so filtering is conservative and never drops
+ * matching rows. Note that rows within surviving chunks are not filtered.
+ */
+struct statistics_filter {
+  /// Comparison operator applied as `column <comparison> value`
+  enum class op : int8_t { EQ, LT, LE, GT, GE };
+
+  /// Name of the (leaf) column the predicate applies to
+  std::string column;
+  op comparison = op::EQ;
+  /// Comparison value for numeric, boolean and timestamp columns
+  double numeric_value = 0;
+  /// Comparison value for string columns; used when `is_string` is set
+  std::string string_value;
+  bool is_string = false;
+};
+
 //! Avro format
 namespace avro {
 
@@ -153,6 +176,9 @@ namespace json {
     compression_type compression = compression_type::AUTO;
     /// Per-column types; disables type inference on those columns
     std::vector<std::string> dtype;
+    /// Names of all columns in record order; locks the schema so column
+    /// names are not re-read from the first record of every batch
+    std::vector<std::string> names;
     bool dayfirst = false;
 
     reader_options() = default;
@@ -317,6 +343,9 @@ struct reader_options {
                                      "NaN",      "n/a",      "nan",  "null"};
   /// Cast timestamp columns to a specific type
   data_type timestamp_type{EMPTY};
+  /// Whether to append an INT64 "_error_offset" column holding the byte
+  /// offset of each row with unparseable fields (null for clean rows)
+  bool error_row_offsets = false;
 
   reader_options() = default;
   reader_options(reader_options const &) = default;
@@ -426,6 +455,8 @@ struct reader_options {
   data_type timestamp_type{EMPTY};
   bool decimals_as_float = true;
   int forced_decimals_scale = -1;
+  /// Predicates used to skip stripes via stripe statistics
+  std::vector<statistics_filter> stripe_filters;
 
   reader_options() = default;
   reader_options(reader_options const &) = default;
@@ -545,6 +576,8 @@ struct reader_options {
   bool strings_to_categorical = false;
   bool use_pandas_metadata = false;
   data_type timestamp_type{EMPTY};
+  /// Predicates used to skip row groups via column chunk statistics
+  std::vector<statistics_filter> row_group_filters;
 
   reader_options() = default;
   reader_options(reader_options const &) = default;
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/copying.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <cuda_runtime.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace cudf {
+namespace experimental {
+namespace io {
+
+/**
+ * @brief Owning pinned host allocation.
+ */
+struct pinned_buffer {
+  pinned_buffer() = default;
+  explicit pinned_buffer(size_t size) : size_(size) {
+    if (size_ != 0) {
+      CUDA_TRY(cudaMallocHost(&data_, size_));
+    }
+  }
+  pinned_buffer(pinned_buffer&& other) : data_(other.data_), size_(other.size_) {
+    other.data_ = nullptr;
+    other.size_ = 0;
+  }
+  pinned_buffer& operator=(pinned_buffer&& other) {
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    return *this;
+  }
+  pinned_buffer(pinned_buffer const&) = delete;
+  pinned_buffer& operator=(pinned_buffer const&) = delete;
+  ~pinned_buffer() {
+    if (data_ != nullptr) {
+      cudaFreeHost(data_);
+    }
+  }
+
+  uint8_t* data() const noexcept { return data_; }
+  size_t size() const noexcept { return size_; }
+
+ private:
+  uint8_t* data_ = nullptr;
+  size_t size_ = 0;
+};
+
+/**
+ * @brief A table spilled to compressed pinned host memory.
+ *
+ * Holds the Snappy-compressed payload of a table serialized with `pack`,
+ * plus the relocatable column metadata and per-chunk bookkeeping needed to
+ * reassemble it with `restore`. Contains no device memory; the blob can be
+ * held indefinitely, or its members written to a file and read back.
+ */
+struct spilled_table {
+  std::vector<uint8_t> metadata;      ///< packed column metadata from pack()
+  size_t uncompressed_size = 0;       ///< size of the packed device buffer
+  std::vector<size_t> chunk_sizes;    ///< stored size of each chunk
+  std::vector<uint8_t> chunk_is_raw;  ///< nonzero if a chunk is stored uncompressed
+  pinned_buffer host_data;            ///< concatenated chunk payloads
+
+  /// Bytes of host memory held by the blob's payload
+  size_t size_bytes() const noexcept { return host_data.size(); }
+};
+
+/**
+ * @brief Spills a table to compressed pinned host memory.
+ *
+ * The table is serialized into a single device buffer with `pack`,
+ * Snappy-compressed on the device in fixed-size chunks, and the compacted
+ * payload is copied to pinned host memory in one pass. Chunks that
+ * compression fails to shrink are stored raw. The device memory used during
+ * compression is released before returning; only host memory is retained.
+ *
+ * @param table The table to spill
+ * @param stream Optional stream to use for device work
+ *
+ * @return The compressed host blob
+ */
+spilled_table spill(table_view const& table, cudaStream_t stream = 0);
+
+/**
+ * @brief Restores a spilled table to device memory.
+ *
+ * The compressed payload is copied back to the device in a single
+ * host-to-device transfer and decompressed into one contiguous buffer laid
+ * out as by `contiguous_split`; the returned views are reconstructed over
+ * that buffer without further copies.
+ *
+ * @throws `cudf::logic_error` if the blob's payload is corrupt.
+ *
+ * @param blob The compressed host blob produced by `spill`
+ * @param mr Optional resource to use for the returned device memory
+ * @param stream Optional stream to use for device work
+ *
+ * @return The restored table and the buffer owning its device memory
+ */
+contiguous_split_result restore(
+    spilled_table const& blob,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream = 0);
+
+}  // namespace io
+}  // namespace experimental
+}  // namespace cudf
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/io/types.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <memory>
+#include <string>
+
+namespace cudf {
+namespace experimental {
+namespace io {
+
+/**
+ * @brief Process-wide cache of decoded tables held compressed in pinned host
+ * memory.
+ *
+ * Tables are serialized with `pack`, Snappy-compressed on the device and
+ * stored in pinned host memory so a cached table is restored by a fast
+ * host-to-device copy plus on-device decompression instead of re-decoding
+ * the source file. Entries are keyed by an arbitrary fingerprint string;
+ * `read_parquet` consults the cache automatically for whole-file reads of
+ * filesystem sources once the cache is enabled.
+ *
+ * The cache is disabled by default and evicts least-recently-used entries
+ * when a capacity is set. All methods are safe to call concurrently.
+ */
+class table_cache {
+ public:
+  /**
+   * @brief Returns the process-wide cache instance.
+   */
+  static table_cache& instance();
+
+  /**
+   * @brief Enables the cache.
+   *
+   * @param capacity_bytes Maximum bytes of host memory to retain;
+   *                       0 means unlimited.
+   */
+  void enable(size_t capacity_bytes = 0);
+
+  /**
+   * @brief Disables the cache and drops all entries.
+   */
+  void disable();
+
+  /**
+   * @brief Returns true if the cache is enabled.
+   */
+  bool enabled() const;
+
+  /**
+   * @brief Stores a compressed host copy of the given table under `key`.
+   *
+   * An existing entry with the same key is replaced. Least-recently-used
+   * entries are evicted if the capacity would be exceeded; a table larger
+   * than the whole capacity is not stored.
+   *
+   * @param key Fingerprint identifying the table's source
+   * @param table The table to store
+   * @param metadata The metadata returned alongside the table
+   * @param stream Optional stream to use for device work
+   */
+  void insert(std::string const& key, table_view const& table,
+              table_metadata const& metadata, cudaStream_t stream = 0);
+
+  /**
+   * @brief Restores the cached table stored under `key`.
+   *
+   * @param key Fingerprint identifying the table's source
+   * @param mr Optional resource to use for the returned table's device memory
+   * @param stream Optional stream to use for device work
+   *
+   * @return The restored table and its metadata; the table pointer is null
+   *         if no entry exists for `key`
+   */
+  table_with_metadata get(std::string const& key,
+                          rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                          cudaStream_t stream = 0);
+
+  /**
+   * @brief Returns true if an entry exists for `key`.
+   */
+  bool contains(std::string const& key) const;
+
+  /**
+   * @brief Removes the entry stored under `key`, if any.
+   */
+  void erase(std::string const& key);
+
+  /**
+   * @brief Removes all entries.
+   */
+  void clear();
+
+  /**
+   * @brief Returns the bytes of host memory currently held by the cache.
+   */
+  size_t size_bytes() const;
+
+ private:
+  table_cache();
+  ~table_cache();
+
+  struct impl;
+  std::unique_ptr<impl> _impl;
+};
+
+}  // namespace io
+}  // namespace experimental
+}  // namespace cudf
@@ -40,6 +40,89 @@ namespace io {
 //! Inner interfaces and implementations
 namespace detail {
 
+//! CSV format
+namespace csv {
+
+/**
+ * @brief Options for the CSV writer.
+ */
+struct writer_options {
+  /// String to use for null entries
+  std::string na_rep = "";
+  /// Indicates whether to write headers to csv
+  bool include_header = true;
+  /// Maximum number of rows to process and write per flush
+  int rows_per_chunk = 1 << 16;
+  /// Character to use for separating lines
+  std::string line_terminator = "\n";
+  /// Character to use for separating column values
+  char inter_column_delimiter = ',';
+  /// String to use for values == 0 in boolean columns
+  std::string true_value = "true";
+  /// String to use for values != 0 in boolean columns
+  std::string false_value = "false";
+
+  writer_options() = default;
+  writer_options(writer_options const&) = default;
+
+  /**
+   * @brief Constructor to populate writer options.
+   *
+   * @param na String to use for null entries
+   * @param header Indicates whether to write headers to csv
+   * @param rows_chunk Maximum number of rows to process per flush
+   * @param line_term Character to use for separating lines
+   * @param delim Character to use for separating column values
+   * @param true_v String to use for values == 0 in boolean columns
+   * @param false_v String to use for values != 0 in boolean columns
+   */
+  writer_options(std::string const& na, bool header, int rows_chunk,
+                 std::string line_term = std::string{"\n"}, char delim = ',',
+                 std::string true_v = std::string{"true"},
+                 std::string false_v = std::string{"false"})
+      : na_rep(na), include_header(header), rows_per_chunk(rows_chunk),
+        line_terminator(line_term), inter_column_delimiter(delim),
+        true_value(true_v), false_value(false_v) {}
+};
+
+/**
+ * @brief Class to write CSV dataset data into columns.
+ */
+class writer {
+ private:
+  class impl;
+  std::unique_ptr<impl> _impl;
+
+ public:
+  /**
+   * @brief Constructor for output to a file.
+   *
+   * @param sinkp The data sink to write the data to
+   * @param options Settings for controlling writing behavior
+   * @param mr Optional resource to use for device memory allocation
+   */
+  explicit writer(
+      std::unique_ptr<cudf::io::data_sink> sinkp, writer_options const& options,
+      rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~writer();
+
+  /**
+   * @brief Writes the entire dataset.
+   *
+   * @param table Set of columns to output
+   * @param metadata Table metadata and column names
+   * @param stream Optional stream to use for device memory alloc and kernels
+   */
+  void write_all(table_view const& table, const table_metadata *metadata = nullptr, cudaStream_t stream = 0);
+};
+
+}  // namespace csv
+
+
 //! ORC format
 namespace orc {
 
@@ -1,7 +1,14 @@
+#pragma once
+
 #include <arrow/api.h>
 #include <arrow/ipc/api.h>
 #include <arrow/gpu/cuda_api.h>
 
+#include <cudf/table/table_view.hpp>
+
+#include <memory>
+#include <vector>
+
 class CudaMessageReader : arrow::ipc::MessageReader {
     public:
 
@@ -16,3 +23,56 @@ class CudaMessageReader : arrow::ipc::MessageReader {
         arrow::io::BufferReader* host_schema_reader_ = nullptr;
         std::shared_ptr<arrow::cuda::CudaBufferReader> owned_stream_;
 };
+
+namespace cudf {
+namespace ipc {
+
+/**
+ * @brief Zero-copy `table_view` over an Arrow record batch whose buffers
+ * reside in device memory.
+ *
+ * Maps each column of the record batch directly onto a `column_view` —
+ * Arrow's validity bitmap and offsets layouts match libcudf's, so no device
+ * memory is copied or allocated. The batch is typically the product of
+ * reading an Arrow IPC message with `CudaMessageReader`:
+ *
+ * ```
+ * auto reader = arrow::ipc::RecordBatchStreamReader::Open(
+ *     CudaMessageReader::Open(&stream, &schema)).ValueOrDie();
+ * std::shared_ptr<arrow::RecordBatch> batch;
+ * reader->ReadNext(&batch);
+ * cudf::ipc::imported_table table(batch);
+ * auto result = cudf::experimental::inner_join(table.view(), ...);
+ * ```
+ *
+ * The imported table keeps the record batch alive; the view and any views
+ * derived from it are valid only within the imported table's lifetime.
+ *
+ * Supported types are the fixed-width numeric types, timestamps, and
+ * strings. Arrow booleans are bit-packed and cannot be viewed as `BOOL8`;
+ * importing them throws.
+ */
+class imported_table {
+ public:
+  /**
+   * @brief Validates the batch's buffer layout and builds the column views.
+   *
+   * @throws cudf::logic_error if a column's type has no zero-copy libcudf
+   * equivalent or a buffer is missing or too small for the declared length
+   *
+   * @param batch Record batch with all buffers in device memory
+   */
+  explicit imported_table(std::shared_ptr<arrow::RecordBatch> batch);
+
+  /**
+   * @brief Returns the table view over the record batch's device buffers.
+   */
+  table_view view() const { return table_view(_columns); }
+
+ private:
+  std::shared_ptr<arrow::RecordBatch> _batch;
+  std::vector<column_view> _columns;
+};
+
+}  // namespace ipc
+}  // namespace cudf
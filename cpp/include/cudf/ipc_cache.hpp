@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/table/table_view.hpp>
+
+#include <cuda_runtime_api.h>
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace ipc {
+
+/**
+ * @brief One entry of a table's compact IPC handle list.
+ *
+ * `offset` and `size` locate the buffer's bytes within the mapped allocation
+ * on the consumer side; `cudaIpcOpenMemHandle` always maps from the
+ * allocation base.
+ */
+struct exported_buffer {
+  cudaIpcMemHandle_t handle;
+  size_t offset;
+  size_t size;
+};
+
+/**
+ * @brief Producer-side cache of CUDA IPC memory handles.
+ *
+ * `cudaIpcGetMemHandle` costs a driver round trip per call, so re-exporting
+ * a long-lived table's buffers on every exchange turns into milliseconds of
+ * handle churn. The cache exports each device allocation once and serves the
+ * handle from a map keyed on the allocation base pointer thereafter.
+ *
+ * Handles remain valid until the allocation is freed; call `evict` before
+ * freeing a cached buffer (or `clear` when tearing down) so a recycled
+ * address cannot serve a stale handle.
+ *
+ * Thread-safe. Use the process-wide `instance()` so all senders share one
+ * export of each buffer.
+ */
+class export_cache {
+ public:
+  /**
+   * @brief Returns the process-wide cache.
+   */
+  static export_cache& instance();
+
+  /**
+   * @brief Returns the IPC handle for the allocation containing `ptr`,
+   * exporting it on first use.
+   *
+   * @throws cudf::cuda_error if `ptr` is not a device allocation of this
+   * process
+   *
+   * @param ptr Base pointer of a device memory allocation
+   */
+  cudaIpcMemHandle_t get_handle(void const* ptr);
+
+  /**
+   * @brief Returns the compact handle list for a table: one entry per data
+   * buffer and one per non-null null mask, in column order.
+   *
+   * Buffers are exported through the cache, so repeated sends of the same
+   * table are pure map lookups. Each entry records the view's byte offset
+   * into its buffer so the consumer can reconstruct column views over the
+   * mapped allocations.
+   *
+   * @throws cudf::logic_error if a column is not fixed-width
+   *
+   * @param input Table whose buffers to export
+   */
+  std::vector<exported_buffer> export_table(table_view const& input);
+
+  /**
+   * @brief Drops the cached handle for `ptr`. Call before freeing a buffer
+   * that may have been exported.
+   */
+  void evict(void const* ptr);
+
+  /**
+   * @brief Drops all cached handles.
+   */
+  void clear();
+
+ private:
+  std::mutex _mutex;
+  std::map<void const*, cudaIpcMemHandle_t> _handles;
+};
+
+/**
+ * @brief Consumer-side cache of opened CUDA IPC mappings with refcounts.
+ *
+ * `cudaIpcOpenMemHandle` fails when a handle is already mapped in the
+ * process, and closing a mapping still referenced by another consumer yields
+ * use-after-unmap. The cache maps each handle once, hands out the shared
+ * device pointer, and unmaps with `cudaIpcCloseMemHandle` only when every
+ * `open` has been balanced by a `close`.
+ *
+ * Thread-safe. Use the process-wide `instance()`; prefer `imported_buffer`
+ * over calling `open`/`close` directly.
+ */
+class import_cache {
+ public:
+  /**
+   * @brief Returns the process-wide cache.
+   */
+  static import_cache& instance();
+
+  /**
+   * @brief Maps `handle` (or reuses the existing mapping) and increments its
+   * refcount.
+   *
+   * @throws cudf::cuda_error if the handle cannot be opened
+   *
+   * @return Device pointer to the base of the mapped allocation
+   */
+  void* open(cudaIpcMemHandle_t const& handle);
+
+  /**
+   * @brief Decrements the mapping's refcount, unmapping the allocation when
+   * it reaches zero.
+   *
+   * @param ptr Pointer previously returned by `open`
+   */
+  void close(void* ptr);
+
+ private:
+  struct mapping {
+    void* ptr;
+    int refcount;
+  };
+
+  std::mutex _mutex;
+  std::map<std::string, mapping> _mappings;  // keyed on raw handle bytes
+  std::map<void*, std::string> _keys;        // reverse index for close()
+};
+
+/**
+ * @brief RAII mapping of one exported buffer on the consumer side.
+ *
+ * Opens the handle through the process-wide `import_cache` and releases its
+ * reference on destruction, so the allocation stays mapped exactly as long
+ * as any importer still views it.
+ */
+class imported_buffer {
+ public:
+  /**
+   * @brief Maps the buffer described by `exported`.
+   */
+  explicit imported_buffer(exported_buffer const& exported)
+      : _base{import_cache::instance().open(exported.handle)},
+        _offset{exported.offset},
+        _size{exported.size} {}
+
+  ~imported_buffer() { import_cache::instance().close(_base); }
+
+  imported_buffer(imported_buffer const&) = delete;
+  imported_buffer& operator=(imported_buffer const&) = delete;
+
+  /**
+   * @brief Returns the device pointer to the buffer's first byte.
+   */
+  void* data() const { return static_cast<char*>(_base) + _offset; }
+
+  /**
+   * @brief Returns the buffer's size in bytes.
+   */
+  size_t size() const { return _size; }
+
+ private:
+  void* _base;
+  size_t _offset;
+  size_t _size;
+};
+
+}  // namespace ipc
+}  // namespace cudf
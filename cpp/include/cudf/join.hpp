@@ -26,6 +26,31 @@ namespace cudf {
 namespace experimental {
 // joins
 
+/**
+ * @brief  Relational comparisons supported as residual conditions of a
+ * conditional join
+ */
+enum class inequality_comparison {
+  LESS_THAN,           ///< left <  right
+  LESS_THAN_EQUAL,     ///< left <= right
+  GREATER_THAN,        ///< left >  right
+  GREATER_THAN_EQUAL,  ///< left >= right
+  NOT_EQUAL            ///< left != right
+};
+
+/**
+ * @brief  A residual condition of a conditional join, evaluated as
+ * `left.column(left_column) <comparison> right.column(right_column)` for each
+ * candidate row pair
+ *
+ * A null on either side never satisfies the condition.
+ */
+struct join_condition {
+  cudf::size_type left_column;        ///< Index of the column in the left table
+  inequality_comparison comparison;   ///< The comparison to evaluate
+  cudf::size_type right_column;       ///< Index of the column in the right table
+};
+
 /**
  * @brief  Performs an inner join on the specified columns of two
  * tables (left, right)
@@ -87,6 +112,314 @@ std::unique_ptr<cudf::experimental::table> inner_join(
                          std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
                          rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief  Performs an inner join on the specified columns of two tables
+ * (left, right), materializing only a requested subset of the output columns
+ *
+ * Produces the same rows as `inner_join()` but gathers only the columns
+ * selected by `left_output` and `right_output`, so unreferenced payload
+ * columns are never materialized. An empty projection vector selects every
+ * column of that side. Columns keep the relative order they have in the
+ * unprojected join output; a common column pair appears iff its `left` index
+ * is selected, and the `right` half of a common pair is never emitted
+ * separately.
+ *
+ * @throws cudf::logic_error if an element of `left_output` or `right_output`
+ * is not a valid column index in the corresponding table, plus all errors
+ * thrown by `inner_join()`.
+ *
+ * @param[in] left The left table
+ * @param[in] right The right table
+ * @param[in] left_on The column indices from `left` to join on.
+ * Interpreted as in `inner_join()`.
+ * @param[in] right_on The column indices from `right` to join on.
+ * Interpreted as in `inner_join()`.
+ * @param[in] columns_in_common Pairs of common column indices, interpreted
+ * as in `inner_join()`.
+ * @param[in] left_output The indices of the `left` columns to materialize
+ * in the output; an empty vector selects every column.
+ * @param[in] right_output The indices of the `right` columns to materialize
+ * in the output; an empty vector selects every non-common column.
+ * @param mr Memory resource used to allocate the returned table and columns
+ *
+ * @returns Result of joining `left` and `right` tables on the columns
+ * specified by `left_on` and `right_on`, restricted to the projected columns.
+ */
+std::unique_ptr<cudf::experimental::table> inner_join(
+                         cudf::table_view const& left,
+                         cudf::table_view const& right,
+                         std::vector<cudf::size_type> const& left_on,
+                         std::vector<cudf::size_type> const& right_on,
+                         std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
+                         std::vector<cudf::size_type> const& left_output,
+                         std::vector<cudf::size_type> const& right_output,
+                         rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Performs an inner join on the specified columns of two tables
+ * (left, right) that are both sorted ascending on those columns
+ *
+ * Produces the same rows as `inner_join()` but uses a merge-based algorithm
+ * that exploits the sortedness of the inputs: matching row ranges are found
+ * with binary searches instead of building a hash table, so no build-side
+ * scratch memory is required and the output rows are ordered by left row
+ * index (and by right row index within it) deterministically.
+ *
+ * Both tables must be sorted ascending on the join columns with nulls
+ * ordered before all other values (as produced by `sort_by_key()`); the
+ * sortedness of the inputs is not verified, and unsorted inputs produce
+ * incorrect results.
+ *
+ * @throws cudf::logic_error if `columns_in_common` contains a pair of indices
+ * (L, R) if L does not exist in `left_on` or R does not exist in `right_on`.
+ * @throws cudf::logic_error if `columns_in_common` contains a pair of indices
+ * (L, R) such that the location of `L` within `left_on` is not equal to
+ * location of R within `right_on`
+ * @throws cudf::logic_error if number of elements in `left_on` or `right_on`
+ * mismatch.
+ * @throws cudf::logic_error if number of columns in either `left` or `right`
+ * table is 0 or exceeds MAX_JOIN_SIZE
+ * @throws std::out_of_range if element of `left_on` or `right_on` exceed the
+ * number of columns in the left or right table.
+ *
+ * @param[in] left The left table, sorted on the `left_on` columns
+ * @param[in] right The right table, sorted on the `right_on` columns
+ * @param[in] left_on The column indices from `left` to join on.
+ * The column from `left` indicated by `left_on[i]` will be compared against the column
+ * from `right` indicated by `right_on[i]`.
+ * @param[in] right_on The column indices from `right` to join on.
+ * The column from `right` indicated by `right_on[i]` will be compared against the column
+ * from `left` indicated by `left_on[i]`.
+ * @param[in] columns_in_common is a vector of pairs of column indices into
+ * `left` and `right`, respectively, that are "in common". Interpreted as in
+ * `inner_join()`.
+ * @param mr Memory resource used to allocate the returned table and columns
+ *
+ * @returns Result of joining `left` and `right` tables on the columns
+ * specified by `left_on` and `right_on`. The resulting table will be joined columns of
+ * `left(including common columns)+right(excluding common columns)`.
+ */
+std::unique_ptr<cudf::experimental::table> merge_inner_join(
+                         cudf::table_view const& left,
+                         cudf::table_view const& right,
+                         std::vector<cudf::size_type> const& left_on,
+                         std::vector<cudf::size_type> const& right_on,
+                         std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
+                         rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Performs a partitioned inner join on the specified columns of two
+ * tables (left, right) for inputs too large to join in device memory at once
+ *
+ * Produces the same rows as `inner_join()` but in an unspecified order. Both
+ * tables are co-partitioned on the join columns with `hash_partition()`, every
+ * partition is spilled to pinned host memory, and partition pairs are then
+ * restored and joined on the device one at a time. Peak device memory usage is
+ * therefore governed by the size of a single partition pair and its join
+ * output rather than by the full build table, at the cost of staging both
+ * inputs through host memory.
+ *
+ * `num_partitions` should be chosen so that one partition of each table plus
+ * the hash table and join output for that pair fit in device memory; the
+ * returned table is still a single device allocation and must fit on the GPU.
+ *
+ * @throws cudf::logic_error if `num_partitions` is not positive.
+ * @throws cudf::logic_error if `columns_in_common` contains a pair of indices
+ * (L, R) if L does not exist in `left_on` or R does not exist in `right_on`.
+ * @throws cudf::logic_error if `columns_in_common` contains a pair of indices
+ * (L, R) such that the location of `L` within `left_on` is not equal to
+ * location of R within `right_on`
+ * @throws cudf::logic_error if number of elements in `left_on` or `right_on`
+ * mismatch.
+ * @throws cudf::logic_error if number of columns in either `left` or `right`
+ * table is 0 or exceeds MAX_JOIN_SIZE
+ * @throws std::out_of_range if element of `left_on` or `right_on` exceed the
+ * number of columns in the left or right table.
+ *
+ * @param[in] left The left table
+ * @param[in] right The right table
+ * @param[in] left_on The column indices from `left` to join on.
+ * The column from `left` indicated by `left_on[i]` will be compared against the column
+ * from `right` indicated by `right_on[i]`.
+ * @param[in] right_on The column indices from `right` to join on.
+ * The column from `right` indicated by `right_on[i]` will be compared against the column
+ * from `left` indicated by `left_on[i]`.
+ * @param[in] columns_in_common is a vector of pairs of column indices into
+ * `left` and `right`, respectively, that are "in common". Interpreted as in
+ * `inner_join()`.
+ * @param[in] num_partitions The number of partitions to split each table into
+ * @param mr Memory resource used to allocate the returned table and columns
+ *
+ * @returns Result of joining `left` and `right` tables on the columns
+ * specified by `left_on` and `right_on`. The resulting table will be joined columns of
+ * `left(including common columns)+right(excluding common columns)`.
+ */
+std::unique_ptr<cudf::experimental::table> partitioned_inner_join(
+                         cudf::table_view const& left,
+                         cudf::table_view const& right,
+                         std::vector<cudf::size_type> const& left_on,
+                         std::vector<cudf::size_type> const& right_on,
+                         std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
+                         cudf::size_type num_partitions,
+                         rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Performs an inner join on the specified equality columns of two
+ * tables (left, right) with additional residual relational conditions
+ *
+ * Produces the rows of `inner_join()` on `left_on`/`right_on` that also
+ * satisfy every condition in `conditions`. The hash table is built on the
+ * equality columns only and the residual conditions are evaluated inside the
+ * probe kernels before a pair is emitted, so no cross product is ever
+ * materialized. A null on either side of a condition never satisfies it.
+ *
+ * @throws cudf::logic_error if a condition references a column index outside
+ * `left` or `right`, or if the two columns of a condition differ in type.
+ * @throws cudf::logic_error if `columns_in_common` contains a pair of indices
+ * (L, R) if L does not exist in `left_on` or R does not exist in `right_on`.
+ * @throws cudf::logic_error if `columns_in_common` contains a pair of indices
+ * (L, R) such that the location of `L` within `left_on` is not equal to
+ * location of R within `right_on`
+ * @throws cudf::logic_error if number of elements in `left_on` or `right_on`
+ * mismatch.
+ * @throws cudf::logic_error if number of columns in either `left` or `right`
+ * table is 0 or exceeds MAX_JOIN_SIZE
+ * @throws std::out_of_range if element of `left_on` or `right_on` exceed the
+ * number of columns in the left or right table.
+ *
+ * @param[in] left The left table
+ * @param[in] right The right table
+ * @param[in] left_on The column indices from `left` to join on.
+ * The column from `left` indicated by `left_on[i]` will be compared against the column
+ * from `right` indicated by `right_on[i]`.
+ * @param[in] right_on The column indices from `right` to join on.
+ * The column from `right` indicated by `right_on[i]` will be compared against the column
+ * from `left` indicated by `left_on[i]`.
+ * @param[in] conditions Residual conditions over columns of `left` and
+ * `right` that each output row pair must additionally satisfy.
+ * @param[in] columns_in_common is a vector of pairs of column indices into
+ * `left` and `right`, respectively, that are "in common". Interpreted as in
+ * `inner_join()`.
+ * @param mr Memory resource used to allocate the returned table and columns
+ *
+ * @returns Result of joining `left` and `right` tables on the columns
+ * specified by `left_on` and `right_on`, restricted to the row pairs that
+ * satisfy `conditions`. The resulting table will be joined columns of
+ * `left(including common columns)+right(excluding common columns)`.
+ */
+std::unique_ptr<cudf::experimental::table> conditional_inner_join(
+                         cudf::table_view const& left,
+                         cudf::table_view const& right,
+                         std::vector<cudf::size_type> const& left_on,
+                         std::vector<cudf::size_type> const& right_on,
+                         std::vector<join_condition> const& conditions,
+                         std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
+                         rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Performs a left join on the specified equality columns of two
+ * tables (left, right) with additional residual relational conditions
+ *
+ * Produces one row for every row of `left`: rows with at least one right row
+ * matching on `left_on`/`right_on` and satisfying every condition in
+ * `conditions` are paired with those rows, and all other left rows are
+ * paired with nulls, as in `left_join()`. The residual conditions are
+ * evaluated inside the probe kernels, so a left row whose equality matches
+ * all fail the conditions is still returned, padded with nulls.
+ *
+ * @copydetails cudf::experimental::conditional_inner_join
+ */
+std::unique_ptr<cudf::experimental::table> conditional_left_join(
+                         cudf::table_view const& left,
+                         cudf::table_view const& right,
+                         std::vector<cudf::size_type> const& left_on,
+                         std::vector<cudf::size_type> const& right_on,
+                         std::vector<join_condition> const& conditions,
+                         std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
+                         rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Performs an inner join between left table shards resident on
+ * multiple devices of a single node and one small build table, broadcasting
+ * the build table to every shard's device and joining locally
+ *
+ * The build table is packed into one contiguous buffer and copied to each
+ * shard's device — over peer-to-peer when peer access between the devices is
+ * available, staged through host memory otherwise — and each shard is then
+ * joined on its own device with `inner_join()` semantics. All shards must
+ * belong to the calling process; the devices on which shards reside are
+ * switched to internally and the current device is restored on return.
+ *
+ * The default memory resource is used for all allocations and must be usable
+ * on every participating device.
+ *
+ * @throws cudf::logic_error if `left_shards` is empty or its size differs
+ * from `shard_devices`, plus all errors thrown by `inner_join()` per shard.
+ *
+ * @param[in] left_shards The left table shards; shard `i` must be resident
+ * on `shard_devices[i]`
+ * @param[in] shard_devices The device ordinal each left shard is resident on
+ * @param[in] right The build table
+ * @param[in] right_device The device ordinal `right` is resident on
+ * @param[in] left_on The column indices from each left shard to join on.
+ * @param[in] right_on The column indices from `right` to join on.
+ * @param[in] columns_in_common is a vector of pairs of column indices into
+ * the left shards and `right`, respectively, that are "in common".
+ * Interpreted as in `inner_join()`.
+ *
+ * @returns One joined table per left shard, resident on that shard's device,
+ * with the column layout of `inner_join()`.
+ */
+std::vector<std::unique_ptr<cudf::experimental::table>> broadcast_inner_join(
+                         std::vector<cudf::table_view> const& left_shards,
+                         std::vector<int> const& shard_devices,
+                         cudf::table_view const& right,
+                         int right_device,
+                         std::vector<cudf::size_type> const& left_on,
+                         std::vector<cudf::size_type> const& right_on,
+                         std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common);
+
+/**
+ * @brief  Performs an inner join between left and right table shards
+ * resident on multiple devices of a single node by hash-shuffling both sides
+ * across the devices and joining each co-partition locally
+ *
+ * Every shard is hash partitioned on its join keys into one partition per
+ * device, partition `j` of every shard is copied to device `j` (peer-to-peer
+ * when available, staged through host memory otherwise), and the received
+ * pieces are concatenated and joined locally with `inner_join()` semantics.
+ * Both sides use the same hash function, so matching rows always meet on the
+ * same device. All shards must belong to the calling process; the current
+ * device is restored on return.
+ *
+ * The default memory resource is used for all allocations and must be usable
+ * on every participating device.
+ *
+ * @throws cudf::logic_error if the shard vectors are empty or differ in
+ * size from each other or `shard_devices`, plus all errors thrown by
+ * `inner_join()` per device.
+ *
+ * @param[in] left_shards The left table shards; shard `i` must be resident
+ * on `shard_devices[i]`
+ * @param[in] right_shards The right table shards, sharded the same way
+ * @param[in] shard_devices The device ordinal each shard pair is resident on
+ * @param[in] left_on The column indices from each left shard to join on.
+ * @param[in] right_on The column indices from each right shard to join on.
+ * @param[in] columns_in_common is a vector of pairs of column indices into
+ * the left and right shards, respectively, that are "in common". Interpreted
+ * as in `inner_join()`.
+ *
+ * @returns One joined table per device, resident on that device, with the
+ * column layout of `inner_join()`.
+ */
+std::vector<std::unique_ptr<cudf::experimental::table>> shuffle_inner_join(
+                         std::vector<cudf::table_view> const& left_shards,
+                         std::vector<cudf::table_view> const& right_shards,
+                         std::vector<int> const& shard_devices,
+                         std::vector<cudf::size_type> const& left_on,
+                         std::vector<cudf::size_type> const& right_on,
+                         std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common);
+
 /**
  * @brief  Performs a left join (also known as left outer join) on the
  * specified columns of two tables (left, right)
@@ -150,6 +483,45 @@ std::unique_ptr<cudf::experimental::table> left_join(
                          std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
                          rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief  Performs a left join on the specified columns of two tables
+ * (left, right), materializing only a requested subset of the output columns
+ *
+ * Produces the same rows as `left_join()` but gathers only the columns
+ * selected by `left_output` and `right_output`. Projections are interpreted
+ * as in the projecting `inner_join()` overload.
+ *
+ * @throws cudf::logic_error if an element of `left_output` or `right_output`
+ * is not a valid column index in the corresponding table, plus all errors
+ * thrown by `left_join()`.
+ *
+ * @param[in] left The left table
+ * @param[in] right The right table
+ * @param[in] left_on The column indices from `left` to join on.
+ * Interpreted as in `left_join()`.
+ * @param[in] right_on The column indices from `right` to join on.
+ * Interpreted as in `left_join()`.
+ * @param[in] columns_in_common Pairs of common column indices, interpreted
+ * as in `left_join()`.
+ * @param[in] left_output The indices of the `left` columns to materialize
+ * in the output; an empty vector selects every column.
+ * @param[in] right_output The indices of the `right` columns to materialize
+ * in the output; an empty vector selects every non-common column.
+ * @param mr Memory resource used to allocate the returned table and columns
+ *
+ * @returns Result of left joining `left` and `right` tables on the columns
+ * specified by `left_on` and `right_on`, restricted to the projected columns.
+ */
+std::unique_ptr<cudf::experimental::table> left_join(
+                         cudf::table_view const& left,
+                         cudf::table_view const& right,
+                         std::vector<cudf::size_type> const& left_on,
+                         std::vector<cudf::size_type> const& right_on,
+                         std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
+                         std::vector<cudf::size_type> const& left_output,
+                         std::vector<cudf::size_type> const& right_output,
+                         rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief  Performs a full join (also known as full outer join) on the
  * specified columns of two tables (left, right)
@@ -212,8 +584,48 @@ std::unique_ptr<cudf::experimental::table> full_join(
                          std::vector<cudf::size_type> const& right_on,
                          std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
                          rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
-/** 
- * @brief  Performs a left semi join on the specified columns of two 
+
+/**
+ * @brief  Performs a full join on the specified columns of two tables
+ * (left, right), materializing only a requested subset of the output columns
+ *
+ * Produces the same rows as `full_join()` but gathers only the columns
+ * selected by `left_output` and `right_output`. Projections are interpreted
+ * as in the projecting `inner_join()` overload.
+ *
+ * @throws cudf::logic_error if an element of `left_output` or `right_output`
+ * is not a valid column index in the corresponding table, plus all errors
+ * thrown by `full_join()`.
+ *
+ * @param[in] left The left table
+ * @param[in] right The right table
+ * @param[in] left_on The column indices from `left` to join on.
+ * Interpreted as in `full_join()`.
+ * @param[in] right_on The column indices from `right` to join on.
+ * Interpreted as in `full_join()`.
+ * @param[in] columns_in_common Pairs of common column indices, interpreted
+ * as in `full_join()`.
+ * @param[in] left_output The indices of the `left` columns to materialize
+ * in the output; an empty vector selects every column.
+ * @param[in] right_output The indices of the `right` columns to materialize
+ * in the output; an empty vector selects every non-common column.
+ * @param mr Memory resource used to allocate the returned table and columns
+ *
+ * @returns Result of full joining `left` and `right` tables on the columns
+ * specified by `left_on` and `right_on`, restricted to the projected columns.
+ */
+std::unique_ptr<cudf::experimental::table> full_join(
+                         cudf::table_view const& left,
+                         cudf::table_view const& right,
+                         std::vector<cudf::size_type> const& left_on,
+                         std::vector<cudf::size_type> const& right_on,
+                         std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
+                         std::vector<cudf::size_type> const& left_output,
+                         std::vector<cudf::size_type> const& right_output,
+                         rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Performs a left semi join on the specified columns of two
  * tables (left, right)
  *
  * A left semi join only returns data from the left table, and only 
@@ -311,6 +723,101 @@ std::unique_ptr<cudf::experimental::table> left_anti_join(cudf::table_view const
                                                           std::vector<cudf::size_type> const& right_on,
                                                           std::vector<cudf::size_type> const& return_columns,
                                                           rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Hash join handle that builds the hash table over a build table once
+ * and allows it to be probed repeatedly.
+ *
+ * `inner_join()` and `left_join()` rebuild the hash table over the right
+ * table on every call. When the same right table is joined against many
+ * probe tables (e.g. a stable dimension table joined by a stream of small
+ * batches), this object lets the build phase be paid once: the device hash
+ * table is constructed by the constructor and retained, and each `probe`
+ * call only runs the probe phase.
+ *
+ * The build table's device memory must remain valid for the lifetime of
+ * this object; only views of it are stored.
+ */
+class hash_join {
+ public:
+  hash_join() = delete;
+  ~hash_join();
+  hash_join(hash_join const&) = delete;
+  hash_join(hash_join&&);
+  hash_join& operator=(hash_join const&) = delete;
+  hash_join& operator=(hash_join&&);
+
+  /**
+   * @brief Constructs a hash table over the join columns of `build` for
+   * subsequent probe calls.
+   *
+   * @throws cudf::logic_error if number of columns in `build` table is 0 or
+   * exceeds MAX_JOIN_SIZE
+   *
+   * @param[in] build The table to build the hash table on; acts as the right
+   * table of the join
+   * @param[in] build_on The column indices from `build` to join on
+   */
+  hash_join(cudf::table_view const& build,
+            std::vector<cudf::size_type> const& build_on);
+
+  /**
+   * @brief Performs an inner join of `probe` against the prebuilt hash table.
+   *
+   * The result is identical to
+   * `inner_join(probe, build, probe_on, build_on, columns_in_common, mr)`
+   * where `build` and `build_on` are the arguments this object was
+   * constructed with.
+   *
+   * @param[in] probe The table to probe with; acts as the left table of the
+   * join
+   * @param[in] probe_on The column indices from `probe` to join on. The
+   * column `probe_on[i]` is compared against the build column `build_on[i]`.
+   * @param[in] columns_in_common is a vector of pairs of probe and build
+   * column indices, respectively, that are "in common". Interpreted as in
+   * `cudf::experimental::inner_join()`.
+   * @param mr Memory resource used to allocate the returned table and columns
+   *
+   * @returns Result of joining the probe and build tables on the columns
+   * specified by `probe_on` and `build_on`.
+   */
+  std::unique_ptr<cudf::experimental::table> inner_join(
+      cudf::table_view const& probe,
+      std::vector<cudf::size_type> const& probe_on,
+      std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
+      rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) const;
+
+  /**
+   * @brief Performs a left join of `probe` against the prebuilt hash table.
+   *
+   * The result is identical to
+   * `left_join(probe, build, probe_on, build_on, columns_in_common, mr)`
+   * where `build` and `build_on` are the arguments this object was
+   * constructed with.
+   *
+   * @param[in] probe The table to probe with; acts as the left table of the
+   * join
+   * @param[in] probe_on The column indices from `probe` to join on. The
+   * column `probe_on[i]` is compared against the build column `build_on[i]`.
+   * @param[in] columns_in_common is a vector of pairs of probe and build
+   * column indices, respectively, that are "in common". Interpreted as in
+   * `cudf::experimental::left_join()`.
+   * @param mr Memory resource used to allocate the returned table and columns
+   *
+   * @returns Result of joining the probe and build tables on the columns
+   * specified by `probe_on` and `build_on`.
+   */
+  std::unique_ptr<cudf::experimental::table> left_join(
+      cudf::table_view const& probe,
+      std::vector<cudf::size_type> const& probe_on,
+      std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
+      rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) const;
+
+ private:
+  struct impl;
+  std::unique_ptr<impl> _impl;
+};
+
 } //namespace experimental
 
 } //namespace cudf
@@ -79,6 +79,40 @@ rmm::device_buffer create_null_mask(
     size_type size, mask_state state, cudaStream_t stream = 0,
     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**---------------------------------------------------------------------------*
+ * @brief Null masks for several columns carved from a single allocation.
+ *
+ * The mask pointers alias `slab` and must not outlive it.
+ *---------------------------------------------------------------------------**/
+struct batched_null_masks {
+  rmm::device_buffer slab;           ///< One allocation backing every mask
+  std::vector<bitmask_type*> masks;  ///< Each column's mask within the slab
+};
+
+/**---------------------------------------------------------------------------*
+ * @brief Creates the null masks for every column of a table from one device
+ * allocation and, if requested, one fused memset.
+ *
+ * Equivalent to `mask_count` calls to `create_null_mask(size, state)`, but
+ * wide tables pay for a single allocation and a single memset instead of one
+ * of each per column. Each mask starts on the usual 64-byte padding boundary,
+ * so the pointers are valid `bitmask_type` mask arguments anywhere a
+ * column-owned mask would be.
+ *
+ * @param mask_count The number of masks to create
+ * @param size The number of elements to be represented by each mask
+ * @param state The desired state of the masks; `UNALLOCATED` yields an empty
+ * slab and no mask pointers
+ * @param stream Optional, stream on which all memory allocations/operations
+ * will be submitted
+ * @param mr Device memory resource to use for the slab allocation
+ * @return The owning slab and a pointer to each mask within it
+ *---------------------------------------------------------------------------**/
+batched_null_masks create_null_masks(
+    size_type mask_count, size_type size, mask_state state,
+    cudaStream_t stream = 0,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
  /**---------------------------------------------------------------------------*
  * @brief Sets a pre-allocated bitmask buffer to a given state in the range 
  *  `[begin_bit, end_bit)`
@@ -170,6 +204,83 @@ std::vector<size_type>
 segmented_count_unset_bits(bitmask_type const* bitmask,
                            std::vector<cudf::size_type> const& indices);
 
+/**---------------------------------------------------------------------------*
+ * @brief A popcount summary of a long-lived bitmask for repeated range count
+ * queries.
+ *
+ * Building the index makes one pass over the mask and records a running set
+ * bit total at every 1024-word (32768-bit) boundary. A subsequent range count
+ * reads two totals and scans only the partial blocks at the range edges, so
+ * querying many segments of the same mask — e.g. a window planner probing one
+ * null mask per frame — touches O(segments) words instead of rescanning the
+ * mask per query the way `count_set_bits`/`segmented_count_set_bits` do.
+ *
+ * The index does not own the mask and is a snapshot: it must be rebuilt if
+ * the mask's bits change, and must not outlive the mask allocation.
+ *---------------------------------------------------------------------------**/
+class popcount_index {
+ public:
+  /**
+   * @brief Builds the summary index over `[0, num_bits)` of `bitmask`.
+   *
+   * @throws cudf::logic_error if `bitmask` is null or `num_bits` is negative
+   *
+   * @param bitmask Device pointer to the bitmask to summarize
+   * @param num_bits The number of bits the mask represents
+   * @param stream Optional, stream on which to build the index
+   * @param mr Device memory resource to use for the index storage
+   */
+  popcount_index(bitmask_type const* bitmask, size_type num_bits,
+                 cudaStream_t stream = 0,
+                 rmm::mr::device_memory_resource* mr =
+                   rmm::mr::get_default_resource());
+
+  /**
+   * @brief Counts the set bits in the range `[start, stop)` using the index.
+   *
+   * @throws cudf::logic_error if the range is invalid or extends past the
+   * indexed bits
+   */
+  cudf::size_type count_set_bits(size_type start, size_type stop,
+                                 cudaStream_t stream = 0) const;
+
+  /**
+   * @brief Counts the unset bits in the range `[start, stop)` using the index.
+   */
+  cudf::size_type count_unset_bits(size_type start, size_type stop,
+                                   cudaStream_t stream = 0) const;
+
+  /**
+   * @brief Counts the set bits of every range
+   * `[indices[2*i], indices[(2*i)+1])` using the index; all ranges are
+   * resolved by one kernel launch.
+   *
+   * @throws cudf::logic_error if `indices.size() % 2 != 0`, or any range is
+   * invalid or extends past the indexed bits
+   */
+  std::vector<size_type> segmented_count_set_bits(
+      std::vector<cudf::size_type> const& indices,
+      cudaStream_t stream = 0) const;
+
+  /**
+   * @brief Counts the unset bits of every range
+   * `[indices[2*i], indices[(2*i)+1])` using the index.
+   */
+  std::vector<size_type> segmented_count_unset_bits(
+      std::vector<cudf::size_type> const& indices,
+      cudaStream_t stream = 0) const;
+
+  /**
+   * @brief Returns the number of bits the index summarizes.
+   */
+  size_type num_bits() const noexcept { return _num_bits; }
+
+ private:
+  bitmask_type const* _bitmask;  ///< The summarized mask; not owned
+  size_type _num_bits;
+  rmm::device_buffer _block_prefix;  ///< Running totals at block boundaries
+};
+
 /**---------------------------------------------------------------------------*
  * @brief Creates a `device_buffer` from a slice of bitmask defined by a range
  * of indices `[begin_bit, end_bit)`.
@@ -228,4 +339,21 @@ rmm::device_buffer bitmask_and(
     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
     cudaStream_t stream = 0);
 
+/**
+ * @brief Returns a bitwise OR of the bitmasks of columns of a table
+ *
+ * If any of the columns isn't nullable, it is considered all valid and the
+ * result is all valid; an empty bitmask is returned in that case.
+ * If no column in the table is nullable, an empty bitmask is returned.
+ *
+ * @param view The table of columns
+ * @param stream CUDA stream on which to execute kernels
+ * @param mr Memory resource for allocating output bitmask
+ * @return rmm::device_buffer Output bitmask
+ */
+rmm::device_buffer bitmask_or(
+    table_view const& view,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream = 0);
+
 }  // namespace cudf
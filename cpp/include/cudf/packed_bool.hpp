@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <memory>
+
+namespace cudf {
+namespace experimental {
+
+/**
+ * @brief Bit-packed representation of a boolean predicate column
+ *
+ * Stores one bit per row instead of one byte, so predicate columns move an
+ * eighth of the bytes of a `BOOL8` column through logical operations and
+ * filters. A null element of the source column is folded to `false`, matching
+ * the predicate semantics of `apply_boolean_mask` and `copy_if_else` where a
+ * null selector element means "do not select".
+ *
+ * The packed words use the same layout as the null mask bitmask utilities;
+ * bits past `size` in the last word are always zero.
+ */
+struct packed_bool_column {
+  std::unique_ptr<rmm::device_buffer> data;  ///< bit-packed values
+  size_type size = 0;                        ///< number of rows
+
+  /**
+   * @brief Returns the packed words as a bitmask pointer
+   */
+  bitmask_type const* mask() const {
+    return static_cast<bitmask_type const*>(data->data());
+  }
+};
+
+/**
+ * @brief Packs a `BOOL8` column into one bit per row
+ *
+ * Null elements are folded to `false`.
+ *
+ * @throws cudf::logic_error if `input` is not of type `BOOL8`
+ *
+ * @param input Boolean column to pack
+ * @param mr Resource for allocating the packed words
+ * @return Bit-packed copy of `input`
+ */
+packed_bool_column pack_bools(
+    column_view const& input,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Unpacks a bit-packed boolean column into a non-nullable `BOOL8`
+ * column
+ *
+ * @param input Bit-packed boolean column
+ * @param mr Resource for allocating the returned column
+ * @return `BOOL8` column with the unpacked values
+ */
+std::unique_ptr<column> unpack_bools(
+    packed_bool_column const& input,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Computes the element-wise logical AND of two bit-packed boolean
+ * columns
+ *
+ * Operates on whole 32-bit words, processing 32 rows per load.
+ *
+ * @throws cudf::logic_error if the inputs are not of the same size
+ *
+ * @param lhs First operand
+ * @param rhs Second operand
+ * @param mr Resource for allocating the result
+ * @return Bit-packed result of `lhs AND rhs`
+ */
+packed_bool_column packed_and(
+    packed_bool_column const& lhs, packed_bool_column const& rhs,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Computes the element-wise logical OR of two bit-packed boolean
+ * columns
+ *
+ * @throws cudf::logic_error if the inputs are not of the same size
+ *
+ * @param lhs First operand
+ * @param rhs Second operand
+ * @param mr Resource for allocating the result
+ * @return Bit-packed result of `lhs OR rhs`
+ */
+packed_bool_column packed_or(
+    packed_bool_column const& lhs, packed_bool_column const& rhs,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Computes the element-wise logical NOT of a bit-packed boolean column
+ *
+ * Bits past the column's size remain zero.
+ *
+ * @param input The operand
+ * @param mr Resource for allocating the result
+ * @return Bit-packed result of `NOT input`
+ */
+packed_bool_column packed_not(
+    packed_bool_column const& input,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+}  // namespace experimental
+}  // namespace cudf
@@ -81,5 +81,112 @@ quantiles(table_view const& input,
           rmm::mr::device_memory_resource* mr =
             rmm::mr::get_default_resource());
 
+/**
+ * @brief Computes interpolated quantile values of every column of a
+ * pre-sorted table in a single kernel launch.
+ *
+ * Each column of `input` must be independently sorted ascending;
+ * `null_precedence` indicates whether its nulls were sorted before or after
+ * the valid elements. Every (column, quantile) pair is computed by one
+ * thread of one launch, replacing a sequence of per-column `quantile` calls.
+ *
+ * @throws cudf::logic_error if any column of `input` is non-numeric
+ *
+ * @param[in] input           Table of pre-sorted numeric columns.
+ * @param[in] q               Desired quantiles in range [0, 1].
+ * @param[in] interp          Strategy used to interpolate between the two
+ *                            values on either side of each desired quantile.
+ * @param[in] null_precedence Where nulls were placed when each column was
+ *                            sorted.
+ * @param[in] mr              Optional resource to use for device memory
+ *                            allocation.
+ *
+ * @returns A table with one FLOAT64 column of `q.size()` rows per input
+ *          column; the rows of an all-null input column are all null.
+ */
+std::unique_ptr<table>
+column_quantiles(table_view const& input,
+                 std::vector<double> const& q,
+                 interpolation interp = interpolation::LINEAR,
+                 null_order null_precedence = null_order::AFTER,
+                 rmm::mr::device_memory_resource* mr =
+                   rmm::mr::get_default_resource());
+
+/**
+ * @brief A compact, mergeable sketch of a column's distribution for
+ * approximate quantile queries.
+ *
+ * A t-digest summarizes a numeric column as at most `max_centroids`
+ * weighted centroids, with centroid sizes chosen so that accuracy is
+ * highest near the extreme quantiles. Building a sketch makes a single
+ * pass over its input batch, sketches from different batches (or GPUs)
+ * merge without revisiting the original rows, and quantile queries read
+ * only the centroids — so percentiles over a large dataset never require
+ * sorting the full data.
+ *
+ * Null elements are ignored when building the sketch.
+ *
+ * @code
+ * tdigest sketch(batch0);
+ * sketch.merge(tdigest(batch1));
+ * auto result = sketch.quantiles({0.5, 0.99});
+ * @endcode
+ */
+class tdigest {
+ public:
+  /**
+   * @brief Build a sketch of a numeric column.
+   *
+   * @throws cudf::logic_error if `input` is not a numeric type
+   * @throws cudf::logic_error if `max_centroids` is not positive
+   *
+   * @param input Numeric column to summarize
+   * @param max_centroids Maximum number of centroids retained; larger
+   *        values trade memory for accuracy
+   */
+  explicit tdigest(column_view const& input, size_type max_centroids = 100);
+  ~tdigest();
+  tdigest(tdigest&&);
+  tdigest& operator=(tdigest&&);
+  tdigest(tdigest const&) = delete;
+  tdigest& operator=(tdigest const&) = delete;
+
+  /**
+   * @brief Returns the number of centroids in the sketch.
+   */
+  size_type size() const;
+
+  /**
+   * @brief Folds the centroids of `other` into this sketch.
+   *
+   * The merged sketch summarizes the union of the rows the two sketches
+   * were built from and is compressed back to at most this sketch's
+   * `max_centroids` centroids.
+   *
+   * @param other The sketch to merge into this one
+   */
+  void merge(tdigest const& other);
+
+  /**
+   * @brief Computes approximate quantile values from the sketch.
+   *
+   * @param q Desired quantiles in range [0, 1]
+   * @param mr Resource for allocating the result column
+   * @return FLOAT64 column of `q.size()` approximate quantile values;
+   *         all rows are null if the sketch summarizes no valid elements
+   */
+  std::unique_ptr<column> quantiles(
+      std::vector<double> const& q,
+      rmm::mr::device_memory_resource* mr =
+        rmm::mr::get_default_resource()) const;
+
+  // implementation detail holding the centroids on the device
+  struct impl;
+  impl* get_impl() const;
+
+ private:
+  std::unique_ptr<impl> _impl;
+};
+
 } // namespace experimental
 } // namespace cudf
@@ -20,6 +20,9 @@
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/aggregation.hpp>
 
+#include <utility>
+#include <vector>
+
 namespace cudf {
 namespace experimental {
 
@@ -39,6 +42,12 @@ enum class scan_type : bool {
  * If the column is empty, the member `is_valid()` of the output scalar
  * will contain `false`.
  *
+ * The returned scalar's value and validity live in device memory and are
+ * produced asynchronously on the stream, with no host round-trip. The scalar
+ * can therefore be used directly as a broadcast operand of e.g.
+ * `binary_operation` without serializing the pipeline; only reading the value
+ * or validity on the host (`value()`, `is_valid()`) synchronizes.
+ *
  * @throws `cudf::logic_error` if reduction is called for non-arithmetic output
  * type and operator other than `min` and `max`.
  * @throws `cudf::logic_error` if input column data type is not convertible to
@@ -57,10 +66,124 @@ enum class scan_type : bool {
  * will contain `false`.
  * ----------------------------------------------------------------------------**/
 std::unique_ptr<scalar> reduce(
-    const column_view& col, 
+    const column_view& col,
     std::unique_ptr<aggregation> const &agg,
     data_type output_dtype,
-    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream = 0);
+
+/** --------------------------------------------------------------------------*
+ * @brief  Computes the minimum and the maximum of a column in a single pass.
+ *
+ * Equivalent to a `min` and a `max` reduction but reads the data once, so
+ * range/bounds computations cost half the memory traffic of two `reduce`
+ * calls. Only arithmetic input types are supported; the results have the
+ * input type. The null values are skipped. Both output scalars are invalid
+ * if the column is empty or all-null.
+ *
+ * Like `reduce`, the result scalars are produced asynchronously on the
+ * stream with no host round-trip.
+ *
+ * @throws `cudf::logic_error` if the input column type is non-arithmetic.
+ *
+ * @param[in] col Input column view
+ * @params[in] mr The resource to use for all allocations
+ * @returns  A pair of scalars holding the minimum and the maximum
+ * ----------------------------------------------------------------------------**/
+std::pair<std::unique_ptr<scalar>, std::unique_ptr<scalar>> minmax(
+    column_view const& col,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream = 0);
+
+/** --------------------------------------------------------------------------*
+ * @brief  Computes the sum and the count of valid elements of a column in a
+ * single pass.
+ *
+ * Equivalent to a `sum` reduction plus a valid count but reads the data once,
+ * for mean-of-many-columns workloads that would otherwise reduce each column
+ * twice. The null values are skipped. The sum scalar has `output_dtype` and
+ * is invalid if the column is empty or all-null; the count scalar has `INT32`
+ * type and is always valid.
+ *
+ * Like `reduce`, the result scalars are produced asynchronously on the
+ * stream with no host round-trip.
+ *
+ * @throws `cudf::logic_error` if the input column type is non-arithmetic or
+ * not convertible to `output_dtype`.
+ *
+ * @param[in] col Input column view
+ * @param[in] output_dtype  The computation and output precision of the sum.
+ * @params[in] mr The resource to use for all allocations
+ * @returns  A pair of scalars holding the sum and the valid-element count
+ * ----------------------------------------------------------------------------**/
+std::pair<std::unique_ptr<scalar>, std::unique_ptr<scalar>> sum_count(
+    column_view const& col,
+    data_type output_dtype,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream = 0);
+
+/** --------------------------------------------------------------------------*
+ * @brief  Reduces every column of a table in one launch wave.
+ *
+ * Runs one reduction per input column with a column-per-block kernel, so
+ * reducing thousands of short feature columns costs a single launch instead
+ * of one `reduce` call (and its launch/sync overhead) per column.
+ *
+ * All columns must be numeric. Arithmetic is performed in double precision
+ * and the result is a `FLOAT64` column with one row per input column, in
+ * column order; row `i` is null if column `i` is empty or all-null. The null
+ * values are skipped.
+ *
+ * Supported aggregations are `sum`, `product`, `min`, `max`, `mean` and
+ * `sum_of_squares`, given per column.
+ *
+ * @throws `cudf::logic_error` if `aggs.size() != input.num_columns()`, if an
+ * aggregation is unsupported, or if any column is non-numeric.
+ *
+ * @param[in] input Table whose columns are each reduced
+ * @param[in] aggs The aggregation to apply to each column, in column order
+ * @params[in] mr The resource to use for all allocations
+ * @returns `FLOAT64` column with one reduction result per input column
+ * ----------------------------------------------------------------------------**/
+std::unique_ptr<column> batched_reduce(
+    table_view const& input,
+    std::vector<std::unique_ptr<aggregation>> const& aggs,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream = 0);
+
+/** --------------------------------------------------------------------------*
+ * @brief  Computes one reduction per offset-delimited segment of a column.
+ *
+ * Segment `i` covers the value rows `[offsets[i], offsets[i+1])`, as in a
+ * list column, so `offsets` must hold `number of segments + 1` INT32 rows in
+ * ascending order. The result has one row per segment and is computed in a
+ * single linear pass over the values, with the per-segment strategy chosen
+ * from the segment lengths.
+ *
+ * The null values are skipped for the operation. A result row is null if its
+ * segment is empty or contains only null values.
+ *
+ * Supported aggregations are `sum`, `product`, `min`, `max` and
+ * `sum_of_squares` over arithmetic types.
+ *
+ * @throws `cudf::logic_error` if `offsets` is empty, has nulls or is not
+ * INT32, if the aggregation is unsupported, or if the value type is not
+ * convertible to `output_dtype`.
+ *
+ * @param[in] values Input column view
+ * @param[in] offsets Segment boundaries, `number of segments + 1` rows
+ * @param[in] agg unique_ptr of the aggregation operator applied per segment
+ * @param[in] output_dtype  The computation and output precision.
+ * @params[in] mr The resource to use for all allocations
+ * @returns Column with one reduction result per segment
+ * ----------------------------------------------------------------------------**/
+std::unique_ptr<column> segmented_reduce(
+    column_view const& values,
+    column_view const& offsets,
+    std::unique_ptr<aggregation> const& agg,
+    data_type output_dtype,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream = 0);
 
 /** --------------------------------------------------------------------------*
  * @brief  Computes the scan of a column.
@@ -82,7 +205,34 @@ std::unique_ptr<scalar> reduce(
 std::unique_ptr<column>
 scan(const column_view &input, std::unique_ptr<aggregation> const &agg,
      scan_type inclusive, include_nulls include_nulls_flag = include_nulls::NO,
-     rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+     rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource(),
+     cudaStream_t stream = 0);
+
+/** --------------------------------------------------------------------------*
+ * @brief  Finds the first row whose inclusive running sum exceeds a
+ * threshold, in one pass over the input.
+ *
+ * Fuses the scan + compare + filter chain of the "take rows until the
+ * cumulative sum exceeds X" pattern: the comparison consumes each scan
+ * partial as it is produced, so no scan column or boolean mask is
+ * materialized and only the 4-byte cut index returns to the host. The
+ * leading `[0, result)` rows are exactly those to keep (e.g. via `slice`).
+ *
+ * The running sum is computed in double precision; null rows contribute
+ * nothing, matching the skip-nulls behavior of `scan`.
+ *
+ * @throws `cudf::logic_error` if the input column type is non-arithmetic.
+ *
+ * @param[in] input The input column view
+ * @param[in] threshold The cumulative-sum threshold
+ * @params[in] mr The resource to use for all allocations
+ * @returns The index of the first row whose inclusive running sum exceeds
+ * `threshold`, or `input.size()` if it never does
+ * ----------------------------------------------------------------------------**/
+size_type scan_threshold_cut(
+    column_view const& input, double threshold,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream = 0);
 
 }  // namespace experimental
 }  // namespace cudf
@@ -18,6 +18,7 @@
 
 #include <cudf/types.hpp>
 #include <memory>
+#include <vector>
 
 namespace cudf {
 namespace experimental {
@@ -166,6 +167,72 @@ std::unique_ptr<column> clamp(column_view const& input,
                               scalar const& hi,
                               rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Cleans a column in one fused pass: null fill, range clamp, and
+ * single value substitution.
+ *
+ * Equivalent to `replace_nulls(input, null_fill)` followed by
+ * `clamp(lo, hi)` followed by replacing `old_value` with `new_value`, but
+ * every element is read and written exactly once instead of once per step.
+ * The output has no null mask since nulls are filled.
+ *
+ * Steps whose scalars are null are skipped: a null `lo`/`hi` disables that
+ * clamp bound and a null `old_value` disables the substitution. `null_fill`
+ * may only be null if the input has no nulls.
+ *
+ * @throws cudf::logic_error if any scalar type does not match `input.type()`
+ * @throws cudf::logic_error if `null_fill` is null and `input` has nulls
+ * @throws cudf::logic_error if `old_value` is valid but `new_value` is null
+ * @throws cudf::logic_error if `input` is not of a fixed-width type
+ *
+ * @param[in] input Column to clean
+ * @param[in] null_fill Value substituted for nulls
+ * @param[in] lo Minimum value; smaller elements are raised to it. Ignored if null.
+ * @param[in] hi Maximum value; larger elements are lowered to it. Ignored if null.
+ * @param[in] old_value Value to substitute after filling and clamping. Ignored if null.
+ * @param[in] new_value Replacement for `old_value`
+ * @param[in] mr Optional resource to use for device memory
+ *           allocation of the returned result column.
+ *
+ * @return The cleaned column, without a null mask
+ */
+std::unique_ptr<column> cleanse(column_view const& input,
+                                scalar const& null_fill,
+                                scalar const& lo,
+                                scalar const& hi,
+                                scalar const& old_value,
+                                scalar const& new_value,
+                                rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Cleans every column of a table in one launch wave.
+ *
+ * Applies `cleanse` to column `i` with the `i`th scalar of each vector; all
+ * kernels are issued back to back on one stream, so cleaning a wide table
+ * costs one pass over the data with no synchronization between columns.
+ *
+ * @throws cudf::logic_error if any vector's size differs from the number of
+ * columns, or under the per-column conditions of `cleanse`
+ *
+ * @param[in] input Table to clean
+ * @param[in] null_fills Per-column value substituted for nulls
+ * @param[in] los Per-column minimum value. Ignored where null.
+ * @param[in] his Per-column maximum value. Ignored where null.
+ * @param[in] old_values Per-column value to substitute. Ignored where null.
+ * @param[in] new_values Per-column replacement for `old_values`
+ * @param[in] mr Optional resource to use for device memory
+ *           allocation of the returned result table.
+ *
+ * @return The cleaned table, without null masks
+ */
+std::unique_ptr<table> cleanse(table_view const& input,
+                               std::vector<std::unique_ptr<scalar>> const& null_fills,
+                               std::vector<std::unique_ptr<scalar>> const& los,
+                               std::vector<std::unique_ptr<scalar>> const& his,
+                               std::vector<std::unique_ptr<scalar>> const& old_values,
+                               std::vector<std::unique_ptr<scalar>> const& new_values,
+                               rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 } // namespace experimental
 
 /**
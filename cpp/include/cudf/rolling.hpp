@@ -57,6 +57,84 @@ std::unique_ptr<column> rolling_window(column_view const& input,
                                        rmm::mr::device_memory_resource* mr =
                                         rmm::mr::get_default_resource());
 
+/**
+ * @brief  Applies a fixed-size rolling window function to the values in a
+ * column, with windows clamped at group boundaries.
+ *
+ * Like the fixed-size `rolling_window`, but rows are partitioned by the rows
+ * of `group_keys`: the window of element `i` never extends past the first or
+ * last row of `i`'s group, so one call (and one kernel) replaces a
+ * slice-and-roll loop over the groups.
+ *
+ * @note `group_keys` must be pre-grouped: all rows with equivalent keys must
+ * be contiguous, as produced by `sort_by_key` on the keys or by
+ * `groupby::get_groups`. Rows with nulls in the keys form groups like any
+ * other rows. This is not verified.
+ *
+ * UDF (CUDA/PTX) aggregations are not supported.
+ *
+ * @throws cudf::logic_error if `group_keys.num_rows() != input.size()`
+ *
+ * @param[in] group_keys Table of rows defining the group of each input row
+ * @param[in] input The input column
+ * @param[in] preceding_window The static rolling window size in the backward direction.
+ * @param[in] following_window The static rolling window size in the forward direction.
+ * @param[in] min_periods Minimum number of observations in window required to have a value,
+ *                        otherwise element `i` is null.
+ * @param[in] agg The rolling window aggregation type (SUM, MAX, MIN, etc.)
+ *
+ * @returns   A nullable output column containing the rolling window results
+ **/
+std::unique_ptr<column> grouped_rolling_window(table_view const& group_keys,
+                                               column_view const& input,
+                                               size_type preceding_window,
+                                               size_type following_window,
+                                               size_type min_periods,
+                                               std::unique_ptr<aggregation> const& agg,
+                                               rmm::mr::device_memory_resource* mr =
+                                                rmm::mr::get_default_resource());
+
+/**
+ * @brief  Applies a range-based rolling window function to the values in a
+ * column, with window bounds determined by a timestamp order-by column.
+ *
+ * The window of element `i` contains every row `j` whose timestamp satisfies
+ * `orderby[i] - preceding_window <= orderby[j] <= orderby[i] + following_window`,
+ * so windows cover a time range rather than a fixed row count. The bounds are
+ * computed by binary search on `orderby` inside the rolling kernel, replacing
+ * the two `upper_bound` passes and the two materialized INT32 window columns
+ * otherwise needed per call.
+ *
+ * `preceding_window` and `following_window` are expressed in ticks of
+ * `orderby`'s resolution (e.g. seconds for `TIMESTAMP_SECONDS`).
+ *
+ * @note `orderby` must be sorted in ascending order and must not contain
+ * nulls. The sortedness is not verified.
+ *
+ * UDF (CUDA/PTX) aggregations are not supported.
+ *
+ * @throws cudf::logic_error if `orderby` is not a timestamp column, has nulls,
+ * or `orderby.size() != input.size()`
+ *
+ * @param[in] orderby Ascending-sorted timestamp column defining each row's position in time
+ * @param[in] input The input column
+ * @param[in] preceding_window The rolling window time range in the backward direction.
+ * @param[in] following_window The rolling window time range in the forward direction.
+ * @param[in] min_periods Minimum number of observations in window required to have a value,
+ *                        otherwise element `i` is null.
+ * @param[in] agg The rolling window aggregation type (SUM, MAX, MIN, etc.)
+ *
+ * @returns   A nullable output column containing the rolling window results
+ **/
+std::unique_ptr<column> time_range_rolling_window(column_view const& orderby,
+                                                  column_view const& input,
+                                                  size_type preceding_window,
+                                                  size_type following_window,
+                                                  size_type min_periods,
+                                                  std::unique_ptr<aggregation> const& agg,
+                                                  rmm::mr::device_memory_resource* mr =
+                                                   rmm::mr::get_default_resource());
+
 /**
  * @brief  Applies a variable-size rolling window function to the values in a column.
  *
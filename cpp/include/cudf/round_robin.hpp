@@ -18,6 +18,7 @@
 
 #include <vector>
 #include <cudf/cudf.h>
+#include <cudf/copying.hpp>
 #include <cudf/types.hpp>
 
 namespace cudf {
@@ -163,6 +164,38 @@ round_robin_partition(table_view const& input,
                       cudf::size_type num_partitions,
                       cudf::size_type start_partition = 0,
                       rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
-  
+
+/**
+ * @brief Round-robin partition directly into per-partition contiguous buffers.
+ *
+ * Produces the same partitions as `round_robin_partition()` followed by
+ * `contiguous_split()` on its output, but for tables of fixed-width columns
+ * the rows are dealt straight into each partition's contiguous buffer in a
+ * single kernel pass, skipping the intermediate full-table materialization.
+ * Each partition's buffer uses the same per-column layout and alignment as
+ * `contiguous_split()`, so the results can be shipped to other GPUs or
+ * processes the same way.
+ *
+ * Tables containing variable-width columns, and the degenerate case
+ * num_partitions >= num_rows, fall back to partitioning followed by
+ * `contiguous_split()`.
+ *
+ * @throws cudf::logic_error if num_partitions <= 0
+ * @throws cudf::logic_error if start_partition >= num_partitions.
+ *
+ * @param[in] input The input table to be round-robin partitioned
+ * @param[in] num_partitions Number of partitions for the table
+ * @param[in] start_partition Index of the 1st partition
+ * @param[in] mr Device memory allocator
+ *
+ * @return One `contiguous_split_result` per partition, each owning that
+ * partition's contiguous device buffer.
+ */
+std::vector<contiguous_split_result>
+round_robin_partition_contiguous(table_view const& input,
+                                 cudf::size_type num_partitions,
+                                 cudf::size_type start_partition = 0,
+                                 rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 }  // namespace experimental
 }  // namespace cudf
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+
+/**
+ * @brief Batches the device-side initialization of many fixed-width scalars
+ * into a single asynchronous upload.
+ *
+ * Constructing a `cudf::scalar` from a host value copies the value and its
+ * validity bool to device memory individually; because the source is pageable
+ * host memory the copy blocks the calling thread. Expression-heavy workloads
+ * that build hundreds of scalar operands therefore pay hundreds of small
+ * blocking copies.
+ *
+ * A `scalar_pool` instead stages the host values of a batch of scalars and
+ * uploads them with one async copy from pinned staging plus a scatter kernel
+ * on the pool's stream. Scalars returned by `add` are ordinary scalar objects
+ * whose device value becomes defined once `flush` has been called; they can
+ * then be passed to any libcudf API (e.g. `binary_operation`, `fill`,
+ * `replace_nulls`) on the pool's stream, or on any stream after the pool's
+ * stream has been synchronized.
+ *
+ * Example:
+ * ```
+ * scalar_pool pool(stream);
+ * auto lo = pool.add<int64_t>(10);
+ * auto hi = pool.add<int64_t>(100);
+ * pool.flush();  // one upload for all values added above
+ * ```
+ */
+class scalar_pool {
+ public:
+  /**
+   * @brief Constructs a pool whose uploads are ordered on `stream`
+   *
+   * @param stream The CUDA stream on which flushed values become defined
+   */
+  explicit scalar_pool(cudaStream_t stream = 0);
+
+  /**
+   * @brief Flushes any pending values and returns the staging memory
+   */
+  ~scalar_pool();
+
+  scalar_pool(scalar_pool const&) = delete;
+  scalar_pool& operator=(scalar_pool const&) = delete;
+
+  /**
+   * @brief Creates a scalar whose device value is set by the next `flush`
+   *
+   * The returned scalar's storage is allocated immediately but holds an
+   * undefined value and validity until `flush` is called.
+   *
+   * @tparam T The fixed-width device storage type of the scalar
+   * @param value The value of the scalar
+   * @param is_valid Whether the value held by the scalar is valid
+   */
+  template <typename T>
+  std::unique_ptr<experimental::scalar_type_t<T>> add(T value,
+                                                      bool is_valid = true) {
+    static_assert(is_fixed_width<T>(),
+                  "scalar_pool only supports fixed-width types");
+    auto result = std::make_unique<experimental::scalar_type_t<T>>();
+    slot entry{};
+    entry.data = result->data();
+    entry.validity = result->validity_data();
+    std::memcpy(entry.value, &value, sizeof(T));
+    entry.width = sizeof(T);
+    entry.is_valid = is_valid;
+    _staged.push_back(entry);
+    return result;
+  }
+
+  /**
+   * @brief Uploads all values staged since the last flush
+   *
+   * Issues one async copy of the staged values into device memory and a
+   * kernel that scatters each value and validity bool into its scalar's
+   * storage; does not synchronize the stream.
+   */
+  void flush();
+
+  /**
+   * @brief Returns the number of scalars staged but not yet flushed
+   */
+  size_t pending() const noexcept { return _staged.size(); }
+
+  /**
+   * @brief Device-side descriptor of one staged scalar
+   */
+  struct slot {
+    void* data;      ///< device address of the scalar's value
+    bool* validity;  ///< device address of the scalar's validity bool
+    char value[8];   ///< host value bytes, widest fixed-width type is 8 bytes
+    int32_t width;   ///< width of the value in bytes
+    bool is_valid;   ///< validity to assign to the scalar
+  };
+
+ private:
+  cudaStream_t _stream = 0;
+  std::vector<slot> _staged;
+  rmm::device_buffer _slots;       ///< device copy of the staged descriptors
+  void* _staging = nullptr;        ///< pooled pinned staging block
+  size_t _staging_size = 0;
+  cudaEvent_t _upload_done = nullptr;
+};
+
+}  // namespace cudf
@@ -105,6 +105,104 @@ std::unique_ptr<column> upper_bound(table_view const& t,
                                     std::vector<null_order> const& null_precedence,
                                     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Find insertion points for many independent (haystack, needles)
+ *  column pairs in a single fused launch
+ *
+ * Equivalent to calling `lower_bound` once per pair with single-column
+ *  tables, but all pairs are searched by one kernel, avoiding a launch
+ *  and synchronization per pair when bucketing many feature columns
+ *  against their own bin edges.
+ *
+ * The result concatenates the insertion points of every pair in order:
+ *  the insertion points for `needles[i]` occupy the rows starting at the
+ *  sum of the sizes of needles `0 .. i-1`.
+ *
+ * @throws cudf::logic_error if `haystacks.size() != needles.size()`
+ * @throws cudf::logic_error if any pair's column types mismatch
+ *
+ * @param haystacks       Sorted columns to search
+ * @param needles         Find insert locations for these values; the i-th
+ * column is searched in the i-th haystack
+ * @param column_order    Sort order of each haystack. Size must equal the
+ * number of pairs or empty (all ascending)
+ * @param null_precedence Null ordering of each haystack. Size must equal
+ * the number of pairs or empty (all `null_order::BEFORE`)
+ * @param mr              Device memory resource to use for device memory allocation
+ * @return std::unique_ptr<column> A non-nullable column of cudf::size_type elements
+ * containing the concatenated insertion points of all pairs.
+ */
+std::unique_ptr<column> batched_lower_bound(std::vector<column_view> const& haystacks,
+                                            std::vector<column_view> const& needles,
+                                            std::vector<order> const& column_order = {},
+                                            std::vector<null_order> const& null_precedence = {},
+                                            rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Find largest insertion points for many independent
+ *  (haystack, needles) column pairs in a single fused launch
+ *
+ * The batched equivalent of `upper_bound`; see `batched_lower_bound`
+ *  for the layout of the result and the meaning of the parameters.
+ */
+std::unique_ptr<column> batched_upper_bound(std::vector<column_view> const& haystacks,
+                                            std::vector<column_view> const& needles,
+                                            std::vector<order> const& column_order = {},
+                                            std::vector<null_order> const& null_precedence = {},
+                                            rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Assign each element of @p input the index of its bucket among
+ *  ascending @p bin_edges, as an INT16 column
+ *
+ * Label `b` means `bin_edges[b-1] <= x < bin_edges[b]`: values below the
+ *  first edge get 0, values at or above the last edge get
+ *  `bin_edges.size()`. Equivalent to `upper_bound` on the edges followed by
+ *  a cast to INT16, but fused into one kernel with no intermediate.
+ *
+ * Null elements of @p input produce null labels.
+ *
+ * @example:
+ *
+ *   input     = { 3, 15, 20, 31, 50 }
+ *   bin_edges = { 10, 20, 30 }
+ *   result    = { 0, 1, 2, 3, 3 }
+ *
+ * @throws cudf::logic_error if `input.type() != bin_edges.type()`
+ * @throws cudf::logic_error if `bin_edges` contains nulls or has more
+ * entries than INT16 can label
+ *
+ * @param input     Column of values to bucket
+ * @param bin_edges Sorted (ascending) bucket boundaries
+ * @param mr        Device memory resource to use for device memory allocation
+ * @return std::unique_ptr<column> An INT16 column of bucket labels with the
+ * null mask of `input`.
+ */
+std::unique_ptr<column> digitize(column_view const& input,
+                                 column_view const& bin_edges,
+                                 rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Digitize many independent (input, bin_edges) column pairs in a
+ *  single fused launch
+ *
+ * Equivalent to calling `digitize` once per pair, but the labels of every
+ *  pair are assigned by one kernel, avoiding a launch and two intermediates
+ *  per column when discretizing wide feature tables.
+ *
+ * @throws cudf::logic_error if `inputs.size() != bin_edges.size()`, or any
+ * pair would make `digitize` throw
+ *
+ * @param inputs    Columns of values to bucket
+ * @param bin_edges Sorted (ascending) bucket boundaries; the i-th column of
+ * edges buckets the i-th input
+ * @param mr        Device memory resource to use for device memory allocation
+ * @return One INT16 label column per input, in order.
+ */
+std::vector<std::unique_ptr<column>> batched_digitize(std::vector<column_view> const& inputs,
+                                                      std::vector<column_view> const& bin_edges,
+                                                      rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Find if the `value` is present in the `col`
  *
@@ -157,6 +255,63 @@ bool contains(column_view const& col, scalar const& value,
 std::unique_ptr<column> contains(column_view const& haystack, column_view const& needles,
                                  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Reusable membership test built once over a column of needle values.
+ *
+ * `contains(haystack, needles)` rebuilds its device hash set of needles on
+ * every call, which dominates the cost when many batches are tested against
+ * the same large needle set. `isin_lookup` builds the hash set once at
+ * construction; each `contains` call then runs only the probe kernel.
+ *
+ * The lookup snapshots the needle values at construction and does not track
+ * later changes to the needles column, whose memory may be freed once the
+ * lookup is built.
+ *
+ * @example:
+ *
+ *   isin_lookup blocklist{needles};
+ *   for (auto const& batch : batches) {
+ *     auto hits = blocklist.contains(batch);  // probe only
+ *   }
+ */
+class isin_lookup {
+ public:
+  /**
+   * @brief Builds the device hash set of `needles`.
+   *
+   * @throws cudf::logic_error if `needles` is a dictionary column
+   *
+   * @param needles The values to test membership against
+   */
+  explicit isin_lookup(column_view const& needles);
+
+  ~isin_lookup();
+  isin_lookup(isin_lookup&&) = default;
+  isin_lookup& operator=(isin_lookup&&) = default;
+  isin_lookup(isin_lookup const&) = delete;
+  isin_lookup& operator=(isin_lookup const&) = delete;
+
+  /**
+   * @brief Returns a bool8 column identifying for each element of `haystack`
+   * whether it is contained in the needles, with `contains(haystack,
+   * needles)` semantics.
+   *
+   * @throws cudf::logic_error if `haystack.type()` differs from the needles'
+   * type
+   *
+   * @param haystack A column of values to test
+   * @param mr       Device memory resource to use for device memory allocation
+   */
+  std::unique_ptr<column> contains(column_view const& haystack,
+                                   rmm::mr::device_memory_resource* mr =
+                                       rmm::mr::get_default_resource()) const;
+
+  struct impl;
+
+ private:
+  std::unique_ptr<impl> _impl;
+};
+
 } // namespace experimental
 } // namespace cudf
 
@@ -74,6 +74,32 @@ bool is_sorted(cudf::table_view const& table,
                std::vector<order> const& column_order,
                std::vector<null_order> const& null_precedence);
 
+/**
+ * @brief Checks many columns independently for sortedness in one launch.
+ *
+ * Equivalent to calling `is_sorted` once per single-column table, but all
+ * columns are validated by a single kernel and a column's comparisons stop
+ * as soon as one violation is found, so validating a wide, already-sorted
+ * ingest batch costs one pass instead of a launch per column.
+ *
+ * Columns whose advisory ordering metadata already advertises the requested
+ * order are reported sorted without being inspected.
+ *
+ * @param[in] columns           columns to check, each independently
+ * @param[in] column_order      The expected sort order for each column. Size
+ *                              must be equal to `columns.size()` or empty. If
+ *                              empty, all columns are expected ascending.
+ * @param[in] null_precedence   The expected order of nulls for each column.
+ *                              Size must be equal to `columns.size()` or
+ *                              empty. If empty, `null_order::BEFORE` is
+ *                              assumed for all columns.
+ *
+ * @returns one bool per column: true if that column is sorted as expected.
+ */
+std::vector<bool> is_sorted_batched(std::vector<column_view> const& columns,
+                                    std::vector<order> const& column_order = {},
+                                    std::vector<null_order> const& null_precedence = {});
+
 /**
  * @brief Performs a lexicographic sort of the rows of a table
  *
@@ -121,5 +147,168 @@ std::unique_ptr<table> sort_by_key(
     std::vector<null_order> const& null_precedence = {},
     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Computes the row indices that would sort each segment of `keys`
+ * independently.
+ *
+ * The rows of `keys` are partitioned into segments by `segment_offsets`:
+ * segment `i` covers rows `[segment_offsets[i], segment_offsets[i+1])`.
+ * The returned indices order the rows within each segment without moving
+ * rows across segment boundaries. All segments are sorted in a single
+ * kernel launch rather than one sort call per segment.
+ *
+ * @throws `cudf::logic_error` if `segment_offsets` is not INT32 or contains
+ * nulls.
+ *
+ * @param keys The table that determines the ordering within each segment
+ * @param segment_offsets Non-nullable INT32 column of monotonically
+ * increasing row offsets demarcating the segments. Must cover all rows.
+ * @param column_order The desired sort order for each column. Size must be
+ * equal to `keys.num_columns()` or empty. If empty, all columns will be
+ * sorted in ascending order.
+ * @param null_precedence The desired order of null compared to other elements
+ * for each column. Size must be equal to `keys.num_columns()` or empty.
+ * If empty, all columns will be sorted in `null_order::BEFORE`.
+ * @param mr The device memory resource used to allocate the returned column
+ * @return std::unique_ptr<column> A non-nullable column of `size_type` elements
+ * containing the permuted row indices of `keys` with each segment sorted
+ */
+/**
+ * @brief Returns the first `k` rows of `input` as if it were fully sorted.
+ *
+ * Equivalent to sorting `input` with the given `column_order` and
+ * `null_precedence` and keeping the first `k` rows, but uses partial
+ * selection so the data movement stays linear in the number of rows
+ * instead of paying for a full sort. To get the largest values pass
+ * `order::DESCENDING` just as with `sort()`.
+ *
+ * If `k` is larger than the number of rows, all rows are returned.
+ * The relative order of rows with equal keys is unspecified, matching
+ * `sort()`.
+ *
+ * @throws `cudf::logic_error` if `k` is negative.
+ *
+ * @param input The table to select from
+ * @param k Number of rows to return
+ * @param column_order The desired order for each column. Size must be
+ * equal to `input.num_columns()` or empty. If empty, all columns are sorted in
+ * ascending order.
+ * @param null_precedence The desired order of a null element compared to other
+ * elements for each column in `input`. Size must be equal to
+ * `input.num_columns()` or empty. If empty, all columns will be sorted with
+ * `null_order::BEFORE`.
+ * @param mr The device memory resource used to allocate the returned table
+ * @return New table containing the first `k` rows of `input` in sorted order
+ */
+std::unique_ptr<table> top_k(
+    table_view const& input, size_type k,
+    std::vector<order> const& column_order = {},
+    std::vector<null_order> const& null_precedence = {},
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+std::unique_ptr<column> segmented_sorted_order(
+    table_view const& keys, column_view const& segment_offsets,
+    std::vector<order> const& column_order = {},
+    std::vector<null_order> const& null_precedence = {},
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Performs a lexicographic sort of each segment of a table
+ * independently.
+ *
+ * Segments are defined by `segment_offsets` as in
+ * `segmented_sorted_order()`. Rows are only reordered within their segment.
+ *
+ * @throws `cudf::logic_error` if `segment_offsets` is not INT32 or contains
+ * nulls.
+ *
+ * @param input The table to sort
+ * @param segment_offsets Non-nullable INT32 column of monotonically
+ * increasing row offsets demarcating the segments. Must cover all rows.
+ * @param column_order The desired order for each column. Size must be
+ * equal to `input.num_columns()` or empty. If empty, all columns are sorted in
+ * ascending order.
+ * @param null_precedence The desired order of a null element compared to other
+ * elements for each column in `input`. Size must be equal to
+ * `input.num_columns()` or empty. If empty, all columns will be sorted with
+ * `null_order::BEFORE`.
+ * @param mr The device memory resource used to allocate the returned table
+ * @return New table with each segment of `input` sorted
+ */
+std::unique_ptr<table> segmented_sort(
+    table_view const& input, column_view const& segment_offsets,
+    std::vector<order> const& column_order = {},
+    std::vector<null_order> const& null_precedence = {},
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Performs a key-value sort of each segment independently.
+ *
+ * Creates a new table that reorders the rows of `values` within each
+ * segment according to the lexicographic ordering of the rows of `keys`
+ * in that segment. Segments are defined by `segment_offsets` as in
+ * `segmented_sorted_order()`.
+ *
+ * @throws `cudf::logic_error` if `values.num_rows() != keys.num_rows()`.
+ * @throws `cudf::logic_error` if `segment_offsets` is not INT32 or contains
+ * nulls.
+ *
+ * @param values The table to reorder
+ * @param keys The table that determines the ordering within each segment
+ * @param segment_offsets Non-nullable INT32 column of monotonically
+ * increasing row offsets demarcating the segments. Must cover all rows.
+ * @param column_order The desired order for each column in `keys`. Size must
+ * be equal to `keys.num_columns()` or empty. If empty, all columns are sorted
+ * in ascending order.
+ * @param null_precedence The desired order of a null element compared to other
+ * elements for each column in `keys`. Size must be equal to
+ * `keys.num_columns()` or empty. If empty, all columns will be sorted with
+ * `null_order::BEFORE`.
+ * @param mr The device memory resource used to allocate the returned table
+ * @return The reordering of `values` with each segment sorted by `keys`
+ */
+std::unique_ptr<table> segmented_sort_by_key(
+    table_view const& values, table_view const& keys,
+    column_view const& segment_offsets,
+    std::vector<order> const& column_order = {},
+    std::vector<null_order> const& null_precedence = {},
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Sorts a dataset partitioned across multiple GPUs of one node.
+ *
+ * `inputs[i]` must be resident on `device_ids[i]`. The driver runs a sample
+ * sort: each partition is sorted locally on its own device, splitters are
+ * chosen from samples of every partition, the partitions are split at the
+ * splitters and the pieces exchanged directly between devices (peer access
+ * is enabled where available, so NVLink-connected GPUs copy without
+ * staging through the host), and each device k-way merges the sorted
+ * pieces it received.
+ *
+ * The result holds one sorted table per device: `result[i]` resides on
+ * `device_ids[i]` and concatenating `result[0] .. result[n-1]` in order
+ * yields the full dataset in sorted order. Partition sizes depend on the
+ * splitters and generally differ from the input sizes.
+ *
+ * @throws cudf::logic_error if `inputs` and `device_ids` differ in size
+ * @throws cudf::logic_error if the inputs have mismatched column counts
+ * @throws cudf::logic_error if any column is not fixed-width or has nulls
+ *
+ * @param inputs One table per GPU, each resident on its own device
+ * @param device_ids The CUDA device of each input table
+ * @param column_order The desired order for each column. Size must be
+ * equal to the number of columns or empty. If empty, all columns are
+ * sorted in ascending order.
+ * @param null_precedence The desired order of a null element compared to
+ * other elements for each column. Size must be equal to the number of
+ * columns or empty.
+ * @return One globally ranged, locally sorted table per device
+ */
+std::vector<std::unique_ptr<table>> sort_multi_gpu(
+    std::vector<table_view> const& inputs,
+    std::vector<int> const& device_ids,
+    std::vector<order> const& column_order = {},
+    std::vector<null_order> const& null_precedence = {});
+
 }  // namespace experimental
 }  // namespace cudf
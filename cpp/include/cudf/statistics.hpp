@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/table/table_view.hpp>
+
+#include <string>
+#include <vector>
+
+namespace cudf {
+
+/**
+ * @brief Summary statistics of a single column.
+ *
+ * Which value members are populated depends on the column type: integer,
+ * boolean and timestamp columns fill the `int64_t` members, floating-point
+ * columns fill the `double` members and string columns fill the string
+ * members with `sum` holding the total character-data length in bytes.
+ */
+struct column_statistics {
+  size_type non_null_count = 0;  ///< Number of non-null values
+  size_type null_count = 0;      ///< Number of null values
+  bool has_minmax = false;       ///< True if the min/max members are valid
+  bool has_sum = false;          ///< True if the sum members are valid
+  int64_t min_value = 0;         ///< Minimum value of integer-class columns
+  int64_t max_value = 0;         ///< Maximum value of integer-class columns
+  int64_t sum = 0;               ///< Sum of integer-class columns or total string length
+  double min_value_fp = 0;       ///< Minimum value of floating-point columns
+  double max_value_fp = 0;       ///< Maximum value of floating-point columns
+  double sum_fp = 0;             ///< Sum of floating-point columns
+  std::string min_value_string;  ///< Minimum value of string columns
+  std::string max_value_string;  ///< Maximum value of string columns
+};
+
+/**
+ * @brief Computes min, max, sum and null counts of every column of a table
+ * in one fused device pass.
+ *
+ * This exposes the statistics machinery used by the ORC and Parquet writers,
+ * which computes all of these aggregates together while reading each column
+ * once, instead of running separate reductions per aggregate.
+ *
+ * Timestamp min/max values are returned in the column's own time units.
+ *
+ * @throw cudf::logic_error if a column type has no statistics support
+ *
+ * @param input The table of columns to summarize
+ *
+ * @returns One `column_statistics` entry per column of `input`
+ */
+std::vector<column_statistics> compute_column_statistics(table_view const& input);
+
+}  // namespace cudf
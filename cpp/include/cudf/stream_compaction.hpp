@@ -16,8 +16,11 @@
 
 #pragma once
 
+#include <cudf/packed_bool.hpp>
 #include <cudf/types.hpp>
 
+#include <rmm/device_buffer.hpp>
+
 namespace cudf {
 namespace experimental {
 
@@ -90,6 +93,77 @@ std::unique_ptr<experimental::table>
                rmm::mr::device_memory_resource *mr =
                    rmm::mr::get_default_resource());
 
+/**
+ * @brief Precomputed row-validity summary of a set of key columns.
+ *
+ * Holds the bitwise AND of the key columns' null masks, i.e. bit `i` is set
+ * iff every key is non-null in row `i`. Pipelines that filter repeatedly on
+ * the same column subset compute it once and reuse it across `drop_nulls`
+ * calls (and any other consumer of a row-validity bitmask) instead of
+ * re-reducing the same masks per call.
+ *
+ * The summary is a snapshot: it does not track later changes to the
+ * columns, and matches `drop_nulls` with `keep_threshold == keys.size()`.
+ */
+class row_validity_summary {
+ public:
+  /**
+   * @brief Computes the summary for the `keys` columns of `table`.
+   *
+   * @param table The table the keys are selected from
+   * @param keys Indices of the key columns to summarize
+   * @param mr Optional, the resource to use for the bitmask allocation
+   */
+  row_validity_summary(table_view const& table,
+                       std::vector<size_type> const& keys,
+                       rmm::mr::device_memory_resource* mr =
+                           rmm::mr::get_default_resource());
+
+  /**
+   * @brief Returns the combined bitmask, or `nullptr` if no key column is
+   * nullable (all rows valid).
+   */
+  bitmask_type const* bitmask() const {
+    return _mask.size() == 0 ? nullptr
+                             : static_cast<bitmask_type const*>(_mask.data());
+  }
+
+  /**
+   * @brief Returns true if every row has all keys valid.
+   */
+  bool all_valid() const { return _mask.size() == 0; }
+
+  /**
+   * @brief Returns the number of rows the summary covers.
+   */
+  size_type num_rows() const { return _num_rows; }
+
+ private:
+  rmm::device_buffer _mask;
+  size_type _num_rows;
+};
+
+/**
+ * @brief Filters a table using a precomputed row-validity summary.
+ *
+ * Equivalent to `drop_nulls(input, keys)` for the keys the summary was built
+ * from, but the per-row validity reduction is read from the summary's
+ * bitmask instead of being recomputed from the key columns.
+ *
+ * @throws cudf::logic_error if `summary.num_rows() != input.num_rows()`
+ *
+ * @param[in] input The input `table_view` to filter.
+ * @param[in] summary Row-validity summary built over `input`'s key columns
+ * @param[in] mr Optional, The resource to use for all allocations
+ * @return unique_ptr<table> Table containing the rows of `input` whose bit
+ * is set in the summary.
+ */
+std::unique_ptr<experimental::table>
+    drop_nulls(table_view const& input,
+               row_validity_summary const& summary,
+               rmm::mr::device_memory_resource *mr =
+                   rmm::mr::get_default_resource());
+
 /**
  * @brief Filters `input` using `boolean_mask` of boolean values as a mask.
  *
@@ -117,6 +191,81 @@ std::unique_ptr<experimental::table>
                        rmm::mr::device_memory_resource *mr =
                            rmm::mr::get_default_resource());
 
+/**
+ * @brief Filters `input` using a bit-packed boolean column as a mask.
+ *
+ * Behaves like the `column_view` overload, but the mask stores one bit per
+ * row, so scanning it moves an eighth of the bytes. Nulls of the source
+ * predicate were already folded to `false` when it was packed with
+ * `pack_bools`.
+ *
+ * @note if @p input.num_rows() is zero, there is no error, and an empty table
+ * is returned.
+ *
+ * @throws cudf::logic_error if The `input` size  and `boolean_mask` size mismatches.
+ *
+ * @param[in] input The input table_view to filter
+ * @param[in] boolean_mask A bit-packed boolean column used as a mask to
+ * filter the `input`.
+ * @param[in] mr Optional, The resource to use for all allocations
+ * @return unique_ptr<table> Table containing copy of all rows of @p input passing
+ * the filter defined by @p boolean_mask.
+ */
+std::unique_ptr<experimental::table>
+    apply_boolean_mask(table_view const& input,
+                       packed_bool_column const& boolean_mask,
+                       rmm::mr::device_memory_resource *mr =
+                           rmm::mr::get_default_resource());
+
+/**
+ * @brief Computes the gather map selecting the rows passing a boolean mask.
+ *
+ * Returns the indices `i` for which element `i` of @p boolean_mask is
+ * non-null and `true`, in ascending order. Gathering a table through the
+ * returned column with `cudf::experimental::gather` is equivalent to
+ * filtering it with `apply_boolean_mask`, so callers applying one mask to
+ * many tables can compute the map once and reuse it instead of re-scanning
+ * the mask per table.
+ *
+ * @throws cudf::logic_error if `boolean_mask` is not `BOOL8` type.
+ *
+ * @param[in] boolean_mask A nullable column_view of type BOOL8
+ * @param[in] mr Optional, The resource to use for all allocations
+ * @return unique_ptr<column> Non-nullable column of `size_type` indices of
+ * the rows passing the filter defined by @p boolean_mask.
+ */
+std::unique_ptr<column>
+    mask_to_gather_map(column_view const& boolean_mask,
+                       rmm::mr::device_memory_resource *mr =
+                           rmm::mr::get_default_resource());
+
+/**
+ * @brief Filters several tables through one `boolean_mask` in a single pass.
+ *
+ * Equivalent to calling `apply_boolean_mask(inputs[i], boolean_mask)` for
+ * each input, but the mask is scanned only once: its gather map is
+ * materialized up front and every table is gathered through it.
+ * This operation is stable: the input order is preserved.
+ *
+ * @note if a table's `num_rows()` is zero, there is no error, and an empty
+ * table is returned in its place.
+ *
+ * @throws cudf::logic_error if any `input` size and `boolean_mask` size mismatches.
+ * @throws cudf::logic_error if `boolean_mask` is not `BOOL8` type.
+ *
+ * @param[in] inputs The input table_views to filter
+ * @param[in] boolean_mask A nullable column_view of type BOOL8 used
+ * as a mask to filter each input.
+ * @param[in] mr Optional, The resource to use for all allocations
+ * @return vector of unique_ptr<table> Tables containing copies of all rows
+ * of the corresponding input passing the filter defined by @p boolean_mask.
+ */
+std::vector<std::unique_ptr<experimental::table>>
+    apply_boolean_mask(std::vector<table_view> const& inputs,
+                       column_view const& boolean_mask,
+                       rmm::mr::device_memory_resource *mr =
+                           rmm::mr::get_default_resource());
+
 /**
  * @brief Choices for drop_duplicates API for retainment of duplicate rows
  */
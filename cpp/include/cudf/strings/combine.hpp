@@ -64,6 +64,47 @@ std::unique_ptr<column> concatenate( table_view const& strings_columns,
                                      string_scalar const& narep = string_scalar("",false),
                                      rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Row-wise concatenates the given list of strings columns using a
+ * format string and returns a single strings column result.
+ *
+ * The format must contain a `{}` placeholder for each column in order.
+ * The text around the placeholders is copied literally into every output
+ * row, so different separators may appear between columns along with a
+ * prefix and suffix. Like `concatenate`, the output sizes are computed in
+ * one pass over all inputs and the result is written once.
+ *
+ * Any row with a null entry will result in the corresponding output
+ * row to be null entry unless a narep string is specified to be used
+ * in its place.
+ *
+ * The characters `{}` cannot be produced literally in the output.
+ *
+ * ```
+ * s1 = ['aa', 'bb']
+ * s2 = ['cc', 'dd']
+ * r = concatenate_format([s1,s2],'[{}-{}]')
+ * r is ['[aa-cc]', '[bb-dd]']
+ * ```
+ *
+ * @throw cudf::logic_error if input columns are not all strings columns.
+ * @throw cudf::logic_error if the number of `{}` placeholders does not
+ *        match the number of columns.
+ *
+ * @param strings_columns List of string columns to concatenate.
+ * @param format String with a `{}` placeholder for each column and
+ *        literal text to insert around them.
+ * @param narep String that should be used in place of any null strings
+ *        found in any column. Default of invalid-scalar means any null entry in any column will
+ *        produces a null result for that row.
+ * @param mr Resource for allocating device memory.
+ * @return New column with concatenated results.
+ */
+std::unique_ptr<column> concatenate_format( table_view const& strings_columns,
+                                            std::string const& format,
+                                            string_scalar const& narep = string_scalar("",false),
+                                            rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Concatenates all strings in the column into one new string delimited
  * by an optional separator string.
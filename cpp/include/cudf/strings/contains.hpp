@@ -18,11 +18,63 @@
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/column/column.hpp>
 
+#include <vector>
+
 namespace cudf
 {
 namespace strings
 {
 
+/**
+ * @brief A regex pattern compiled once and reusable across calls.
+ *
+ * Compiling a pattern and copying the resulting program to the device is
+ * repeated on every `contains_re`, `matches_re` and `count_re` call. When the
+ * same pattern is applied to many strings columns, compile it once into this
+ * handle and pass the handle instead.
+ *
+ * The strings capacity given at compile time sizes the state memory needed
+ * to evaluate patterns with a large number of instructions. A call using
+ * such a pattern throws if its strings column has more rows than the
+ * capacity; small and medium patterns keep their state on the stack and
+ * ignore the capacity.
+ */
+class compiled_regex
+{
+public:
+    /**
+     * @brief Compile a regex pattern for repeated use.
+     *
+     * @throws cudf::logic_error if the pattern is invalid
+     *
+     * @param pattern Regex pattern to compile.
+     * @param strings_capacity Maximum number of rows in any strings column
+     * this pattern will be evaluated against.
+     */
+    compiled_regex( std::string const& pattern, size_type strings_capacity );
+    ~compiled_regex();
+    compiled_regex( compiled_regex&& );
+    compiled_regex& operator=( compiled_regex&& );
+    compiled_regex( compiled_regex const& ) = delete;
+    compiled_regex& operator=( compiled_regex const& ) = delete;
+
+    /**
+     * @brief Returns the pattern this handle was compiled from.
+     */
+    std::string const& pattern() const;
+
+    /**
+     * @brief Returns the maximum number of rows this handle supports.
+     */
+    size_type strings_capacity() const;
+
+    struct impl; // internal device program; defined in contains.cu
+    impl* get_impl() const;
+
+private:
+    std::unique_ptr<impl> _impl;
+};
+
 /**
  * @brief Returns a boolean column identifying rows which
  * match the given regex pattern.
@@ -44,6 +96,51 @@ std::unique_ptr<column> contains_re( strings_column_view const& strings,
                                      std::string const& pattern,
                                      rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Returns a boolean column identifying rows which
+ * match the given pre-compiled regex pattern.
+ *
+ * Behaves like `contains_re` with a pattern string but skips compiling
+ * the pattern and copying the program to the device.
+ *
+ * @throws cudf::logic_error if a large pattern was compiled for fewer
+ * rows than `strings.size()`
+ *
+ * @param strings Strings instance for this operation.
+ * @param prog Compiled regex pattern to match to each string.
+ * @param mr Resource for allocating device memory.
+ * @return New column of boolean results for each string.
+ */
+std::unique_ptr<column> contains_re( strings_column_view const& strings,
+                                     compiled_regex const& prog,
+                                     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns boolean columns identifying rows which match each of the
+ * given regex patterns.
+ *
+ * ```
+ * s = ["abc","123","def456"]
+ * r = contains(s,{"\\d+","[a-z]+"})
+ * r is now {[false, true, true], [true, false, true]}
+ * ```
+ *
+ * All patterns are evaluated against a string in a single kernel pass, so
+ * each string's characters are loaded once no matter how many patterns are
+ * given. Prefer this over a loop of `contains_re` calls when classifying
+ * strings against many patterns.
+ *
+ * Any null string entries return corresponding null output column entries.
+ *
+ * @param strings Strings instance for this operation.
+ * @param patterns Regex patterns to match to each string.
+ * @param mr Resource for allocating device memory.
+ * @return New columns of boolean results, one for each pattern.
+ */
+std::vector<std::unique_ptr<column>> contains_re( strings_column_view const& strings,
+                                                  std::vector<std::string> const& patterns,
+                                                  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Returns a boolean column identifying rows which
  * matching the given regex pattern but only at the beginning the string.
@@ -65,6 +162,25 @@ std::unique_ptr<column> matches_re( strings_column_view const& strings,
                                     std::string const& pattern,
                                     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Returns a boolean column identifying rows which match the given
+ * pre-compiled regex pattern but only at the beginning the string.
+ *
+ * Behaves like `matches_re` with a pattern string but skips compiling
+ * the pattern and copying the program to the device.
+ *
+ * @throws cudf::logic_error if a large pattern was compiled for fewer
+ * rows than `strings.size()`
+ *
+ * @param strings Strings instance for this operation.
+ * @param prog Compiled regex pattern to match to each string.
+ * @param mr Resource for allocating device memory.
+ * @return New column of boolean results for each string.
+ */
+std::unique_ptr<column> matches_re( strings_column_view const& strings,
+                                    compiled_regex const& prog,
+                                    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Returns the number of times the given regex pattern
  * matches in each string.
@@ -86,5 +202,24 @@ std::unique_ptr<column> count_re( strings_column_view const& strings,
                                   std::string const& pattern,
                                   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Returns the number of times the given pre-compiled regex pattern
+ * matches in each string.
+ *
+ * Behaves like `count_re` with a pattern string but skips compiling
+ * the pattern and copying the program to the device.
+ *
+ * @throws cudf::logic_error if a large pattern was compiled for fewer
+ * rows than `strings.size()`
+ *
+ * @param strings Strings instance for this operation.
+ * @param prog Compiled regex pattern to match within each string.
+ * @param mr Resource for allocating device memory.
+ * @return New INT32 column with counts for each string.
+ */
+std::unique_ptr<column> count_re( strings_column_view const& strings,
+                                  compiled_regex const& prog,
+                                  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 } // namespace strings
 } // namespace cudf
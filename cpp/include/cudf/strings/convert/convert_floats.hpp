@@ -43,6 +43,31 @@ std::unique_ptr<column> to_floats( strings_column_view const& strings,
                                    data_type output_type,
                                    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Returns a new numeric column by parsing float values from each string
+ * in the provided strings column, producing null entries for strings that do
+ * not contain a valid float.
+ *
+ * The validity of each entry is determined in the same pass as the conversion
+ * so no separate validation step over the strings is required.
+ *
+ * A valid float consists of characters [0-9] plus an optional prefix '-' or '+',
+ * at most one decimal '.', and optional scientific notation (e.g. "-1.78e+5").
+ * The strings "NaN", "Inf" and "-Inf" are also valid.
+ * Any other entries, including empty strings, become null entries in the output
+ * column, as do null entries in the input.
+ *
+ * @throw cudf::logic_error if output_type is not float type.
+ *
+ * @param strings Strings instance for this operation.
+ * @param output_type Type of float numeric column to return.
+ * @param mr Resource for allocating device memory.
+ * @return New column with floats converted from strings.
+ */
+std::unique_ptr<column> to_floats_checked( strings_column_view const& strings,
+                                           data_type output_type,
+                                           rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Returns a new strings column converting the float values from the
  * provided column into strings.
@@ -55,6 +55,28 @@ std::unique_ptr<cudf::column> slice( strings_column_view const& strings,
                                      cudaStream_t stream=0,
                                      rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource() );
 
+/**
+ * @brief Returns a new strings column created from the contiguous subset of
+ * rows between start (inclusive) and end (exclusive).
+ *
+ * Unlike `slice`, no gather is performed: the relevant ranges of the chars
+ * and offsets children are copied directly (offsets are re-based to zero),
+ * so deep-copying a sliced view costs two contiguous copies plus one small
+ * transform instead of a per-row gather. `start`/`end` are relative to the
+ * view, so a sliced view's own offset is honored.
+ *
+ * @param strings Strings instance for this operation.
+ * @param start Index of first string to copy (inclusive).
+ * @param end Index of last string to copy (exclusive).
+ * @param stream CUDA stream to use kernels in this method.
+ * @param mr Resource for allocating device memory.
+ * @return New strings column of size (end-start).
+ */
+std::unique_ptr<cudf::column> copy_slice( strings_column_view const& strings,
+                                          size_type start, size_type end,
+                                          cudaStream_t stream=0,
+                                          rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource() );
+
 
 } // namespace detail
 } // namespace strings
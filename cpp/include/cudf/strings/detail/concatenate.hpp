@@ -48,6 +48,30 @@ std::unique_ptr<column> concatenate( std::vector<strings_column_view> const& str
                                      rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
                                      cudaStream_t stream = 0 );
 
+/**
+ * @brief Vertically concatenates the given strings columns into as few
+ * output columns as the character size limit allows.
+ *
+ * A single strings column holds at most `std::numeric_limits<size_type>::max()`
+ * bytes of characters because its offsets are int32. When the combined inputs
+ * exceed that, `concatenate` can only throw and callers had to pre-split
+ * their inputs by trial and error. This packs the input columns greedily into
+ * groups that fit under the limit and concatenates each group, so
+ * multi-gigabyte text data moves in one call.
+ *
+ * Unlike `concatenate`, the validity masks of the output columns are
+ * completely filled in.
+ *
+ * @param strings_columns List of string columns to concatenate.
+ * @param mr Resource for allocating device memory.
+ * @param stream CUDA stream to use for any kernels in this function.
+ * @return New columns with concatenated results.
+ */
+std::vector<std::unique_ptr<column>> concatenate_chunked(
+    std::vector<strings_column_view> const& strings_columns,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream = 0 );
+
 } // namespace detail
 } // namespace strings
 } // namespace cudf
@@ -24,6 +24,48 @@ namespace cudf
 namespace strings
 {
 
+/**
+ * @brief A trigram signature index over a static strings column for
+ * accelerating repeated find/contains calls.
+ *
+ * Building the index records one 64-bit signature per row with a bit set
+ * for every (byte) trigram occurring in that row. A search with a target
+ * of three or more bytes consults the signatures first: a row missing any
+ * of the target's trigram bits cannot contain the target and skips the
+ * exact character scan entirely. The fewer rows actually match, the more
+ * of the corpus each search avoids reading.
+ *
+ * The index is built once and holds 8 bytes of device memory per row.
+ * It must be passed back with the same strings column it was built from;
+ * only the row count is verified.
+ */
+class trigram_index
+{
+public:
+    /**
+     * @brief Builds the signature index from the given strings column.
+     *
+     * @param strings Strings instance the index will describe.
+     */
+    explicit trigram_index( strings_column_view const& strings );
+    ~trigram_index();
+    trigram_index( trigram_index&& );
+    trigram_index& operator=( trigram_index&& );
+    trigram_index( trigram_index const& ) = delete;
+    trigram_index& operator=( trigram_index const& ) = delete;
+
+    /**
+     * @brief Returns the number of rows the index was built from.
+     */
+    size_type size() const;
+
+    struct impl; // internal device signatures; defined in find.cu
+    impl* get_impl() const;
+
+private:
+    std::unique_ptr<impl> _impl;
+};
+
 /**
  * @brief Returns a column of character position values where the target
  * string is first found in each string of the provided column.
@@ -51,6 +93,31 @@ std::unique_ptr<column> find( strings_column_view const& strings,
                               size_type start=0, size_type stop=-1,
                               rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Returns a column of character position values where the target
+ * string is first found in each string, consulting a pre-built trigram
+ * index to skip rows that cannot contain the target.
+ *
+ * Behaves like `find` on the same strings column. Targets shorter than
+ * three bytes gain nothing from the index and use the plain search path.
+ *
+ * @throw cudf::logic_error if the index row count does not match the column.
+ *
+ * @param strings Strings instance the index was built from.
+ * @param index Trigram index built from `strings`.
+ * @param target UTF-8 encoded string to search for in each string.
+ * @param start First character position to include in the search.
+ * @param stop Last position (exclusive) to include in the search.
+ *             Default of -1 will search to the end of the string.
+ * @param mr Resource for allocating device memory.
+ * @return New integer column with character position values.
+ */
+std::unique_ptr<column> find( strings_column_view const& strings,
+                              trigram_index const& index,
+                              string_scalar const& target,
+                              size_type start=0, size_type stop=-1,
+                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Returns a column of character position values where the target
  * string is first found searching from the end of each string.
@@ -94,6 +161,27 @@ std::unique_ptr<column> contains( strings_column_view const& strings,
                                   string_scalar const& target,
                                   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Returns a column of boolean values for each string where true
+ * indicates the target string was found, consulting a pre-built trigram
+ * index to skip rows that cannot contain the target.
+ *
+ * Behaves like `contains` on the same strings column. Targets shorter than
+ * three bytes gain nothing from the index and use the plain search path.
+ *
+ * @throw cudf::logic_error if the index row count does not match the column.
+ *
+ * @param strings Strings instance the index was built from.
+ * @param index Trigram index built from `strings`.
+ * @param target UTF-8 encoded string to search for in each string.
+ * @param mr Resource for allocating device memory.
+ * @return New BOOL8 column.
+ */
+std::unique_ptr<column> contains( strings_column_view const& strings,
+                                  trigram_index const& index,
+                                  string_scalar const& target,
+                                  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Returns a column of boolean values for each string where true indicates
  * the target string was found at the beginning of that string in the provided column.
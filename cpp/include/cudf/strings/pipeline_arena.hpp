@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/utilities/arena_memory_resource.hpp>
+
+namespace cudf
+{
+namespace strings
+{
+
+/**
+ * @brief Arena memory resource for intermediate columns in multi-step
+ * strings pipelines.
+ *
+ * Every strings API accepts a device_memory_resource so a pipeline can
+ * opt in by passing this arena for its intermediate results:
+ *
+ * ```
+ * cudf::strings::pipeline_arena arena;
+ * auto s1 = cudf::strings::strip(input, strip_type::BOTH, string_scalar(""), &arena);
+ * auto s2 = cudf::strings::to_lower(strings_column_view(s1->view()), &arena);
+ * s1.reset(); // retires s1's memory back to the arena
+ * auto result = cudf::strings::replace(strings_column_view(s2->view()),
+ *                                      target, repl, -1, mr); // final output from mr
+ * ```
+ *
+ * This is the general operator-scoped `cudf::arena_memory_resource`; see its
+ * documentation for the allocation behavior.
+ */
+using pipeline_arena = cudf::arena_memory_resource;
+
+} // namespace strings
+} // namespace cudf
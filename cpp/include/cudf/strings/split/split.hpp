@@ -162,5 +162,56 @@ contiguous_split_record_result contiguous_rsplit_record(
     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()
 );
 
+/**
+ * @brief The result of a `split_list`: the split in list (offsets + values)
+ * layout.
+ *
+ * `values` holds every token of every row back to back in row order;
+ * `offsets` holds one INT32 entry per input row plus a terminating total, so
+ * the tokens of row `i` are the values rows
+ * `[offsets[i], offsets[i+1])`.
+ */
+struct split_list_result {
+  std::unique_ptr<column> offsets;
+  std::unique_ptr<column> values;
+};
+
+/**
+ * @brief Splits each element of the input column into a single column of
+ * tokens plus a row-offsets column.
+ *
+ * Unlike `split`, which produces one output column per token position and
+ * pads every shorter row with nulls, the list layout stores only the tokens
+ * that exist, so memory does not scale with the longest row. Downstream
+ * segmented operations can consume the offsets directly.
+ *
+ * Splitting a null string element produces an empty token range.
+ *
+ * @example:
+ *
+ *   strings          = { "a_b", "c", null, "d_e_f" }
+ *   split_list(strings, "_"):
+ *     offsets        = { 0, 2, 3, 3, 6 }
+ *     values         = { "a", "b", "c", "d", "e", "f" }
+ *
+ * @throws cudf:logic_error if `delimiter` is invalid.
+ *
+ * @param strings A column of string elements to be splitted.
+ * @param delimiter UTF-8 encoded string indentifying the split points in each
+ *        string.
+ *        Default of empty string indicates split on whitespace.
+ * @param maxsplit Maximum number of splits to perform.
+ *        Default of -1 indicates all possible splits on each string.
+ * @param mr Resource for allocating device memory.
+ * @return split_list_result The tokens of all rows as one strings column
+ *         plus the per-row token offsets.
+ */
+split_list_result split_list(
+    strings_column_view const& strings,
+    string_scalar const& delimiter = string_scalar(""),
+    size_type maxsplit=-1,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()
+);
+
 } // namespace strings
 } // namespace cudf
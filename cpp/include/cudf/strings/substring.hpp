@@ -97,5 +97,89 @@ std::unique_ptr<column> slice_strings( strings_column_view const& strings,
                                        column_view const& starts, column_view const& stops,
                                        rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief A lazy view of substrings within an existing strings column.
+ *
+ * Unlike slice_strings, no new offsets or chars data is created.
+ * Only the byte range of each substring within the parent column's chars
+ * data is recorded -- two size_type values per row. The view can then be
+ * passed directly to the operations that only read the substrings,
+ * eliminating the intermediate strings column when the substrings are
+ * immediately consumed by a comparison or a hash.
+ *
+ * The character positions to retrieve in each string are [start,stop)
+ * with the same out-of-range rules as slice_strings.
+ *
+ * The view references the parent column's device data so the parent
+ * strings column must remain valid for the lifetime of the view.
+ */
+class substrings_view
+{
+public:
+    /**
+     * @brief Records the byte range of each substring of the given column.
+     *
+     * @throw cudf::logic_error if start is negative.
+     *
+     * @param strings Strings column the view references.
+     * @param start First character position of each substring.
+     * @param stop Last character position (exclusive) of each substring.
+     *        Any value set to -1 indicates the end of each string.
+     */
+    substrings_view( strings_column_view const& strings,
+                     size_type start, size_type stop );
+    ~substrings_view();
+    substrings_view( substrings_view&& );
+    substrings_view& operator=( substrings_view&& );
+    substrings_view( substrings_view const& ) = delete;
+    substrings_view& operator=( substrings_view const& ) = delete;
+
+    /**
+     * @brief Returns the number of substrings in this view.
+     */
+    size_type size() const;
+
+    struct impl;
+    impl* get_impl() const;
+
+private:
+    std::unique_ptr<impl> _impl;
+};
+
+/**
+ * @brief Returns a column of boolean values for each substring where true
+ * indicates the target string was found within that substring.
+ *
+ * Any null entries of the parent strings column result in corresponding
+ * null entries in the output column.
+ *
+ * @throw cudf::logic_error if target is invalid.
+ *
+ * @param substrings Substrings to check against target.
+ * @param target UTF-8 encoded string to check within each substring.
+ * @param mr Resource for allocating device memory.
+ * @return New BOOL8 column.
+ */
+std::unique_ptr<column> contains( substrings_view const& substrings,
+                                  string_scalar const& target,
+                                  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns a column of hash values computed from each substring.
+ *
+ * The hash function used matches the default MurmurHash3_32 used when
+ * hashing rows of a strings column, so these values may serve as join
+ * or partition keys alongside hashes of materialized strings.
+ *
+ * Any null entries of the parent strings column produce a hash value
+ * of 0; the output column has no null mask.
+ *
+ * @param substrings Substrings to hash.
+ * @param mr Resource for allocating device memory.
+ * @return New INT32 column of hash values.
+ */
+std::unique_ptr<column> hash( substrings_view const& substrings,
+                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 } // namespace strings
 } // namespace cudf
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace experimental {
+
+/**---------------------------------------------------------------------------*
+ * @brief A logical table built from a sequence of owned table chunks.
+ *
+ * Repeatedly growing a `table` with `concatenate` copies every existing row
+ * on each append, which is quadratic over the life of an accumulation loop.
+ * A `chunked_table` instead keeps the appended tables as separate chunks:
+ * `append` is an O(1) ownership transfer and no rows are copied until the
+ * caller decides to `compact`.
+ *
+ * Chunk-aware consumers read the data without any copy via `chunk_views()`,
+ * which is the same `std::vector<table_view>` shape `concatenate` and the
+ * per-chunk processing loops already accept. Consumers that need a single
+ * contiguous `table_view` call `view()`, which compacts on demand.
+ *---------------------------------------------------------------------------**/
+class chunked_table {
+ public:
+  chunked_table() = default;
+  ~chunked_table() = default;
+  chunked_table(chunked_table&&) = default;
+  chunked_table& operator=(chunked_table&&) = default;
+  chunked_table(chunked_table const&) = delete;
+  chunked_table& operator=(chunked_table const&) = delete;
+
+  /**---------------------------------------------------------------------------*
+   * @brief Constructs a chunked table owning `chunk` as its only chunk.
+   *
+   * @throws cudf::logic_error if `chunk` is null
+   *
+   * @param chunk The table whose ownership is transferred into the new
+   * chunked table
+   *---------------------------------------------------------------------------**/
+  explicit chunked_table(std::unique_ptr<table>&& chunk);
+
+  /**---------------------------------------------------------------------------*
+   * @brief Appends `chunk` by transferring its ownership; no rows are copied.
+   *
+   * Chunks with zero rows are accepted but contribute nothing.
+   *
+   * @throws cudf::logic_error if `chunk` is null, or if its number of columns
+   * or column types do not match the chunks appended before it
+   *
+   * @param chunk The table whose ownership is transferred into this
+   * chunked table
+   *---------------------------------------------------------------------------**/
+  void append(std::unique_ptr<table>&& chunk);
+
+  /**---------------------------------------------------------------------------*
+   * @brief Returns the number of columns
+   *---------------------------------------------------------------------------**/
+  size_type num_columns() const noexcept {
+    return _chunks.empty() ? 0 : _chunks.front()->num_columns();
+  }
+
+  /**---------------------------------------------------------------------------*
+   * @brief Returns the total number of rows across all chunks
+   *---------------------------------------------------------------------------**/
+  size_type num_rows() const noexcept { return _num_rows; }
+
+  /**---------------------------------------------------------------------------*
+   * @brief Returns the number of chunks
+   *---------------------------------------------------------------------------**/
+  size_type num_chunks() const noexcept { return _chunks.size(); }
+
+  /**---------------------------------------------------------------------------*
+   * @brief Returns a const reference to the specified chunk
+   *
+   * @throws std::out_of_range if `i` is outside [0, num_chunks())
+   *
+   * @param i Index of the desired chunk
+   *---------------------------------------------------------------------------**/
+  table const& chunk(size_type i) const { return *(_chunks.at(i)); }
+
+  /**---------------------------------------------------------------------------*
+   * @brief Returns non-owning views of every chunk, in append order.
+   *
+   * This is the zero-copy way to consume a chunked table: the returned vector
+   * can be fed directly to `concatenate` or iterated for per-chunk
+   * processing.
+   *---------------------------------------------------------------------------**/
+  std::vector<table_view> chunk_views() const;
+
+  /**---------------------------------------------------------------------------*
+   * @brief Collapses all chunks into a single contiguous chunk.
+   *
+   * This is the only operation that copies rows; it costs one `concatenate`
+   * over the current chunks. A table with fewer than two chunks is already
+   * compact and is left untouched.
+   *
+   * @param stream Optional, stream on which all memory allocations and copies
+   * will be performed
+   * @param mr Optional, the memory resource used to allocate the compacted
+   * chunk
+   *---------------------------------------------------------------------------**/
+  void compact(cudaStream_t stream = 0,
+               rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+  /**---------------------------------------------------------------------------*
+   * @brief Returns an immutable, non-owning `table_view` of the contents,
+   * compacting first if more than one chunk is held.
+   *
+   * The view remains valid until the next `append`, `compact` or `release`.
+   *
+   * @param stream Optional, stream used if compaction is required
+   * @param mr Optional, the memory resource used if compaction is required
+   *---------------------------------------------------------------------------**/
+  table_view view(cudaStream_t stream = 0,
+                  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+  /**---------------------------------------------------------------------------*
+   * @brief Releases ownership of the contents as a single `table`,
+   * compacting first if more than one chunk is held.
+   *
+   * After `release()`, `num_chunks() == 0` and `num_rows() == 0`.
+   *
+   * @param stream Optional, stream used if compaction is required
+   * @param mr Optional, the memory resource used if compaction is required
+   *---------------------------------------------------------------------------**/
+  std::unique_ptr<table> release(
+      cudaStream_t stream = 0,
+      rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+ private:
+  std::vector<std::unique_ptr<table>> _chunks{};
+  size_type _num_rows{};
+};
+
+}  // namespace experimental
+}  // namespace cudf
@@ -19,6 +19,7 @@
 #include <cudf/types.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace cudf {
 namespace experimental {
@@ -48,6 +49,40 @@ std::unique_ptr<column> transform(
   bool is_ptx,
   rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Creates a new column by applying an N-ary function against every
+ * row of a set of input columns in a single fused kernel.
+ *
+ * Computes:
+ * `out[i] = F(in0[i], in1[i], ..., inN[i])`
+ *
+ * The UDF is JIT compiled against the input column types, so a multi-input
+ * computation costs one pass instead of a chain of unary transforms and
+ * binary operations with materialized intermediates. The UDF takes a pointer
+ * to the output element followed by one value parameter per input column, in
+ * order.
+ *
+ * An output row is null if the corresponding row of any input column is null.
+ *
+ * @throws cudf::logic_error if @p inputs is empty, if the columns differ in
+ * size, or if any column is non-numeric
+ *
+ * @param inputs        Immutable views of the input columns, in UDF parameter
+ *                      order
+ * @param nary_udf      The PTX/CUDA string of the N-ary function to apply
+ * @param output_type   The output type that is compatible with the output type in the UDF
+ * @param is_ptx        true: the UDF is treated as PTX code; false: the UDF is treated as CUDA code
+ * @param mr            The memory resource to use for for all device allocations
+ * @return cudf::column The column resulting from applying the N-ary function
+ *                      to every row of the inputs
+ **/
+std::unique_ptr<column> transform(
+  std::vector<column_view> const& inputs,
+  std::string const& nary_udf,
+  data_type output_type,
+  bool is_ptx,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
 
 /**
  * @brief Creates a null_mask from `input` by converting `NaN` to null and
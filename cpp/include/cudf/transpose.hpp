@@ -32,4 +32,22 @@ namespace cudf {
 std::unique_ptr<experimental::table> transpose(table_view const& input,
                                  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Transposes the input table directly into a single dense row-major
+ * column, the layout `experimental::interleave_columns` produces
+ *
+ * Equivalent to `experimental::interleave_columns(*transpose(input))` folded
+ * into one kernel: the intermediate transposed table is never materialized
+ * and the copy runs tiled through shared memory for full coalescing.
+ *
+ * @throw cudf::logic_error if column types are non-homogenous
+ * @throw cudf::logic_error if column types are non-fixed-width
+ * @throw cudf::logic_error if any column contains nulls
+ *
+ * @param[in] input Input table of (ncols) number of columns each of size (nrows)
+ * @return Column of (nrows * ncols) elements with each input row contiguous
+ */
+std::unique_ptr<column> transpose_interleaved(table_view const& input,
+                                 rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 }  // namespace cudf
@@ -122,6 +122,22 @@ enum class sorted : bool {
     YES
 };
 
+/**---------------------------------------------------------------------------*
+ * @brief Advisory description of an ordering a collection of values is
+ * already known to satisfy.
+ *
+ * The default-constructed state indicates no known ordering. The metadata is
+ * purely advisory: operations that produce sorted output (e.g. `sort`) may
+ * record it and operations that require sorted input may consult it to skip
+ * re-validation, but no operation is required to maintain it.
+ *---------------------------------------------------------------------------**/
+struct order_metadata {
+  sorted is_sorted{sorted::NO};  ///< Whether the values are known to be sorted
+  order ordering{order::ASCENDING};  ///< Direction of the known ordering
+  null_order null_ordering{null_order::BEFORE};  ///< Position of nulls in the
+                                                 ///< known ordering
+};
+
 /**---------------------------------------------------------------------------*
  * @brief Indicates how a collection of values has been ordered.
  *---------------------------------------------------------------------------**/
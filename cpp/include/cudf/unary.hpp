@@ -17,6 +17,7 @@
 #pragma once 
 
 #include <memory>
+#include <vector>
 #include <cudf/types.hpp>
 
 namespace cudf {
@@ -47,20 +48,64 @@ enum class unary_op : int32_t {
   NOT,          // < Logical Not (!)
 };
 
+/**
+ * @brief Controls the accuracy/throughput trade-off of unary math operations.
+ */
+enum class accuracy_mode : int32_t {
+  PRECISE,  // < IEEE math library functions (default)
+  FAST,     // < Hardware fast-math intrinsics for float32 transcendentals
+            //   (SIN, COS, TAN, EXP, LOG); reduced accuracy, see the CUDA
+            //   programming guide for the error bounds. Other operations and
+            //   types are computed precisely regardless.
+};
+
 /**
  * @brief Performs unary op on all values in column
  *
  * @param input A `column_view` as input
  * @param op operation to perform
+ * @param mode Optional, accuracy/throughput trade-off for float32
+ * transcendentals
  * @param mr Optional, The resource to use for all allocations
  *
  * @returns std::unique_ptr<cudf::column> Result of the operation
  */
 std::unique_ptr<cudf::column> unary_operation(cudf::column_view const& input,
                                               cudf::experimental::unary_op op,
+                                              cudf::experimental::accuracy_mode mode =
+                                              cudf::experimental::accuracy_mode::PRECISE,
                                               rmm::mr::device_memory_resource* mr =
                                               rmm::mr::get_default_resource());
 
+/**
+ * @brief Casts the input to `out_type` and applies a short chain of unary
+ * operations in a single fused pass.
+ *
+ * Computes `out[i] = opN(...op2(op1(static_cast<out_type>(in[i]))))`.
+ * All stages execute in one kernel, so a cast -> log -> floor chain costs one
+ * read and one write of the column instead of one per stage. Every stage is
+ * evaluated in `out_type`, so integer outputs truncate between stages like a
+ * chain of single-op calls would.
+ *
+ * The output null mask is copied from the input.
+ *
+ * @throws cudf::logic_error if more than 4 operations are given, if any
+ * operation is `BIT_INVERT` or `NOT`, or if the input or output type is
+ * non-numeric
+ *
+ * @param input A `column_view` as input
+ * @param out_type Desired datatype of output column
+ * @param ops Operations to apply in order, at most 4
+ * @param mr Optional, The resource to use for all allocations
+ *
+ * @returns std::unique_ptr<cudf::column> Result of the fused pipeline
+ */
+std::unique_ptr<cudf::column> unary_pipeline(cudf::column_view const& input,
+                                             data_type out_type,
+                                             std::vector<cudf::experimental::unary_op> const& ops,
+                                             rmm::mr::device_memory_resource* mr =
+                                             rmm::mr::get_default_resource());
+
 /**
  * @brief Creates a column of `BOOL8` elements where for every element in `input` `true`
  * indicates the value is null and `false` indicates the value is valid.
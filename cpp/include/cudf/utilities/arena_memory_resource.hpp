@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/mr/device/default_memory_resource.hpp>
+
+#include <mutex>
+#include <vector>
+
+namespace cudf
+{
+
+/**
+ * @brief Arena memory resource for operator-scoped temporaries.
+ *
+ * Intended for everything an operator allocates and frees within a single
+ * invocation — the scratch of a sort, a join's hash table, the intermediate
+ * columns of a `drop_duplicates` — now that these paths honor the caller's
+ * memory resource:
+ *
+ * ```
+ * cudf::arena_memory_resource arena;
+ * auto joined = cudf::experimental::inner_join(left, right, left_on, right_on,
+ *                                              columns_in_common, &arena);
+ * auto result = std::make_unique<cudf::experimental::table>(joined->view(), mr);
+ * arena.release(); // one bulk release instead of one free per temporary
+ * ```
+ *
+ * Allocations are carved sequentially out of large blocks obtained from the
+ * upstream resource. Deallocations only decrement the owning block's
+ * outstanding count; a block is rewound and reused once every allocation made
+ * from it has been freed. `release()` (or destruction) hands every block back
+ * to the upstream resource in one pass regardless of how many allocations
+ * were carved from them, so ending an operator costs O(blocks), not
+ * O(allocations), and short-lived scratch cannot fragment the device heap.
+ *
+ * Memory allocated from the arena remains valid until it is freed or
+ * `reset()`/`release()` is called. The arena is not a general-purpose
+ * resource: results that outlive the operator must be allocated from a
+ * longer-lived resource.
+ */
+class arena_memory_resource final : public rmm::mr::device_memory_resource
+{
+public:
+    static constexpr std::size_t default_block_size = 256 * 1024 * 1024; // 256MB
+
+    /**
+     * @brief Construct an arena that obtains its blocks from the given
+     * upstream resource.
+     *
+     * No device memory is allocated until the first allocation request.
+     *
+     * @param block_size Minimum size in bytes of each block requested from
+     *        the upstream resource. Requests larger than this get their
+     *        own dedicated block.
+     * @param upstream Resource used for allocating the arena's blocks.
+     */
+    explicit arena_memory_resource( std::size_t block_size = default_block_size,
+                                    rmm::mr::device_memory_resource* upstream = rmm::mr::get_default_resource() );
+    ~arena_memory_resource();
+    arena_memory_resource( arena_memory_resource const& ) = delete;
+    arena_memory_resource& operator=( arena_memory_resource const& ) = delete;
+    arena_memory_resource( arena_memory_resource&& ) = delete;
+    arena_memory_resource& operator=( arena_memory_resource&& ) = delete;
+
+    /**
+     * @brief Returns the total bytes currently held from the upstream resource.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Rewinds all blocks, retiring every outstanding allocation.
+     *
+     * Any memory still referencing the arena is invalidated. The blocks are
+     * kept for reuse; nothing is returned upstream.
+     */
+    void reset();
+
+    /**
+     * @brief Returns every block to the upstream resource, retiring all
+     * outstanding allocations in bulk.
+     *
+     * Any memory still referencing the arena is invalidated. Unlike
+     * `reset()`, the device memory is handed back to the upstream resource;
+     * the arena may be reused and will obtain fresh blocks on demand.
+     */
+    void release();
+
+    bool supports_streams() const noexcept override { return true; }
+
+private:
+    // one contiguous region obtained from the upstream resource
+    struct block
+    {
+        void* data;              // base device pointer
+        std::size_t size;        // total bytes in this block
+        std::size_t offset;      // next unused byte
+        std::size_t outstanding; // number of live allocations
+    };
+
+    void* do_allocate( std::size_t bytes, cudaStream_t stream ) override;
+    void do_deallocate( void* p, std::size_t bytes, cudaStream_t stream ) override;
+    std::pair<std::size_t,std::size_t> do_get_mem_info( cudaStream_t stream ) const override;
+
+    rmm::mr::device_memory_resource* _upstream;
+    std::size_t _block_size;
+    std::vector<block> _blocks;
+    mutable std::mutex _mutex;
+};
+
+} // namespace cudf
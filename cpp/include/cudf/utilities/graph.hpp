@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+namespace cudf {
+namespace experimental {
+
+/**
+ * @brief Records a sequence of stream-ordered libcudf operations into a CUDA
+ * graph and replays it with a single launch.
+ *
+ * Intended for pipelines that issue the same operator DAG repeatedly: capture
+ * the work once, then `launch()` per batch to amortize per-kernel launch and
+ * JIT cache lookup overhead. Typical use:
+ *
+ * ```
+ * pipeline_graph graph;
+ * graph.begin_capture(stream);
+ * // ... run the pipeline's detail APIs on `stream` ...
+ * graph.end_capture(stream);
+ * for (;;) { graph.launch(stream); }
+ * ```
+ *
+ * Buffer addresses are baked into the captured graph. When a batch uses new
+ * buffers, re-capture the pipeline; `end_capture()` updates the instantiated
+ * graph in place when the topology is unchanged (cheap) and only
+ * re-instantiates when the update is rejected.
+ *
+ * All work between begin and end must be legal under stream capture: issued
+ * on the capturing stream, no synchronization, and no memory allocation that
+ * synchronizes the device. Operations that allocate output columns should be
+ * captured with a pool memory resource, or run once beforehand to warm any
+ * lazily-initialized state (e.g. JIT compilation).
+ */
+class pipeline_graph {
+ public:
+  pipeline_graph() = default;
+  ~pipeline_graph();
+
+  pipeline_graph(pipeline_graph const&) = delete;
+  pipeline_graph& operator=(pipeline_graph const&) = delete;
+  pipeline_graph(pipeline_graph&& other) noexcept;
+  pipeline_graph& operator=(pipeline_graph&& other) noexcept;
+
+  /**
+   * @brief Puts @p stream into capture mode; subsequent work on it is
+   * recorded instead of executed.
+   *
+   * @throws cudf::cuda_error if the stream cannot begin capture
+   */
+  void begin_capture(cudaStream_t stream);
+
+  /**
+   * @brief Ends capture on @p stream and instantiates (or updates) the
+   * executable graph.
+   *
+   * @throws cudf::cuda_error if capture ended with an error or the graph
+   * cannot be instantiated
+   */
+  void end_capture(cudaStream_t stream);
+
+  /**
+   * @brief Replays the captured work on @p stream with a single launch.
+   *
+   * @throws cudf::logic_error if nothing has been captured
+   * @throws cudf::cuda_error if the launch fails
+   */
+  void launch(cudaStream_t stream);
+
+  /**
+   * @brief Indicates whether an executable graph has been captured.
+   */
+  bool captured() const noexcept { return _graph_exec != nullptr; }
+
+ private:
+  cudaGraph_t _graph = nullptr;
+  cudaGraphExec_t _graph_exec = nullptr;
+};
+
+}  // namespace experimental
+}  // namespace cudf
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cuda_runtime_api.h>
+
+#include <string>
+#include <vector>
+
+namespace cudf
+{
+
+/**
+ * @brief Lightweight always-on kernel timing for production use.
+ *
+ * When enabled, instrumented launch sites record their device time with CUDA
+ * events — the same mechanism as the benchmark `cuda_event_timer` — and
+ * accumulate it into per-name latency histograms that can be queried at
+ * runtime, without a profiler attached:
+ *
+ * ```
+ * cudf::profiler::enable();
+ * ... // run the workload
+ * for (auto const& stats : cudf::profiler::report())
+ *   std::cout << stats.name << " p99 " << stats.p99_ms << "ms\n";
+ * ```
+ *
+ * The JIT kernel launcher is instrumented out of the box, timing each launch
+ * under its kernel instantiation name; other call sites can time a region
+ * with `launch_timer`. When the profiler is disabled (the default) a timer
+ * costs one atomic load.
+ *
+ * Timing is collected asynchronously: the events are only waited on lazily,
+ * so instrumentation does not serialize the stream. Elapsed times are binned
+ * into power-of-two buckets from 1us up, which bounds the reported
+ * percentiles to within a factor of two of the true value.
+ */
+namespace profiler
+{
+
+/**
+ * @brief Accumulated timing statistics for one launch site name.
+ */
+struct kernel_stats
+{
+    std::string name;         ///< name passed to the launch_timer
+    std::size_t num_launches; ///< number of timed launches
+    double total_ms;          ///< sum of all launch times
+    double min_ms;            ///< fastest launch
+    double max_ms;            ///< slowest launch
+    double p50_ms;            ///< median launch time (bucket upper bound)
+    double p95_ms;            ///< 95th percentile launch time (bucket upper bound)
+    double p99_ms;            ///< 99th percentile launch time (bucket upper bound)
+};
+
+/**
+ * @brief Start recording at instrumented launch sites.
+ */
+void enable();
+
+/**
+ * @brief Stop recording. Already gathered statistics are kept.
+ */
+void disable();
+
+/**
+ * @brief Returns true if the profiler is currently recording.
+ */
+bool is_enabled();
+
+/**
+ * @brief Returns the statistics gathered so far, sorted by name.
+ *
+ * Waits for any still-pending timing events to complete.
+ */
+std::vector<kernel_stats> report();
+
+/**
+ * @brief Returns the given latency percentile in milliseconds for one launch
+ * site name, or 0 if nothing was recorded under that name.
+ *
+ * @param name Launch site name as recorded
+ * @param percentile Requested percentile in (0, 100], e.g. 99.0
+ */
+double percentile( std::string const& name, double percentile );
+
+/**
+ * @brief Discards all gathered statistics.
+ */
+void reset();
+
+/**
+ * @brief RAII timer recording the device time of the work enqueued on a
+ * stream during its lifetime.
+ *
+ * Records a start event on construction and a stop event on destruction.
+ * A no-op when the profiler is disabled.
+ */
+class launch_timer
+{
+public:
+    /**
+     * @param name Name the elapsed time is accumulated under
+     * @param stream The stream the timed work is enqueued on
+     */
+    launch_timer( std::string name, cudaStream_t stream );
+    ~launch_timer();
+    launch_timer( launch_timer const& ) = delete;
+    launch_timer& operator=( launch_timer const& ) = delete;
+
+private:
+    std::string _name;
+    cudaStream_t _stream;
+    cudaEvent_t _start{};
+    cudaEvent_t _stop{};
+    bool _active;
+};
+
+} // namespace profiler
+} // namespace cudf
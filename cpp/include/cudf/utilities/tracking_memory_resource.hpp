@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/mr/device/default_memory_resource.hpp>
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace cudf
+{
+
+/**
+ * @brief Memory resource adaptor that records per-operator allocation
+ * statistics.
+ *
+ * Wraps an upstream resource and forwards every allocation to it while
+ * keeping counters: the number of allocations, the total bytes requested,
+ * and the peak (high-water) bytes outstanding — overall and broken down by
+ * operator. Allocations are attributed to the innermost active operator
+ * scope, tagged with the same names used for the NVTX ranges
+ * (e.g. "libcudf:inner_join"), so a report line can be correlated with a
+ * profiler timeline:
+ *
+ * ```
+ * cudf::tracking_memory_resource tracking(mr);
+ * {
+ *   cudf::tracking_memory_resource::operator_scope scope(tracking, "libcudf:inner_join");
+ *   auto joined = cudf::experimental::inner_join(left, right, left_on, right_on,
+ *                                                columns_in_common, &tracking);
+ * }
+ * for (auto const& stats : tracking.report())
+ *   std::cout << stats.name << " peak " << stats.peak_bytes << "B\n";
+ * ```
+ *
+ * Scopes may nest; allocations always count against the innermost scope and
+ * the overall totals. Allocations made with no scope active are reported
+ * under an empty name. All methods are thread safe, but scopes are tracked
+ * per resource, not per thread — concurrent operators should each use their
+ * own tracking resource.
+ */
+class tracking_memory_resource final : public rmm::mr::device_memory_resource
+{
+public:
+    /**
+     * @brief Allocation statistics for one operator name.
+     */
+    struct operator_stats
+    {
+        std::string name;            ///< operator name, as passed to operator_scope
+        std::size_t num_allocations; ///< number of allocations attributed to this operator
+        std::size_t allocated_bytes; ///< sum of all bytes requested by this operator
+        std::size_t peak_bytes;      ///< largest bytes outstanding for this operator at any one time
+    };
+
+    /**
+     * @brief RAII tag attributing allocations to a named operator.
+     */
+    class operator_scope
+    {
+    public:
+        operator_scope( tracking_memory_resource& mr, std::string name )
+            : _mr(mr) { _mr.push_operator(std::move(name)); }
+        ~operator_scope() { _mr.pop_operator(); }
+        operator_scope( operator_scope const& ) = delete;
+        operator_scope& operator=( operator_scope const& ) = delete;
+    private:
+        tracking_memory_resource& _mr;
+    };
+
+    /**
+     * @brief Construct a tracking resource forwarding to the given upstream
+     * resource.
+     *
+     * @param upstream Resource that performs the actual allocations.
+     */
+    explicit tracking_memory_resource( rmm::mr::device_memory_resource* upstream = rmm::mr::get_default_resource() );
+    ~tracking_memory_resource() = default;
+    tracking_memory_resource( tracking_memory_resource const& ) = delete;
+    tracking_memory_resource& operator=( tracking_memory_resource const& ) = delete;
+
+    /**
+     * @brief Begin attributing allocations to the named operator.
+     *
+     * Prefer the `operator_scope` RAII helper; calls must pair with
+     * pop_operator().
+     */
+    void push_operator( std::string name );
+
+    /**
+     * @brief End the innermost operator scope.
+     */
+    void pop_operator();
+
+    /**
+     * @brief Returns the bytes currently outstanding across all operators.
+     */
+    std::size_t current_bytes() const;
+
+    /**
+     * @brief Returns the largest bytes outstanding at any one time since
+     * construction or the last reset().
+     */
+    std::size_t peak_bytes() const;
+
+    /**
+     * @brief Returns the per-operator statistics gathered so far, sorted by
+     * operator name.
+     */
+    std::vector<operator_stats> report() const;
+
+    /**
+     * @brief Clears all gathered statistics.
+     *
+     * Outstanding allocations remain tracked so their eventual deallocation
+     * balances, but they no longer contribute to any operator's counters.
+     */
+    void reset();
+
+    bool supports_streams() const noexcept override { return _upstream->supports_streams(); }
+
+private:
+    // running counters for one operator name
+    struct counters
+    {
+        std::size_t num_allocations = 0;
+        std::size_t allocated_bytes = 0;
+        std::size_t current_bytes = 0;
+        std::size_t peak_bytes = 0;
+    };
+
+    void* do_allocate( std::size_t bytes, cudaStream_t stream ) override;
+    void do_deallocate( void* p, std::size_t bytes, cudaStream_t stream ) override;
+    std::pair<std::size_t,std::size_t> do_get_mem_info( cudaStream_t stream ) const override;
+
+    rmm::mr::device_memory_resource* _upstream;
+    std::vector<std::string> _scopes;             // active operator names, innermost last
+    std::map<std::string, counters> _stats;       // per-operator counters
+    std::map<void*, std::pair<std::size_t, std::string>> _outstanding; // live allocations
+    counters _totals;                             // counters across all operators
+    mutable std::mutex _mutex;
+};
+
+} // namespace cudf
@@ -264,6 +264,14 @@ using scalar_device_type_t = typename type_to_scalar_type_impl<T>::ScalarDeviceT
  * lambda must be the same, else there will be a compiler error as you would be
  * trying to return different types from the same function.
  *
+ * Rarely used types can be pruned from the dispatch at build time by defining
+ * `CUDF_TYPE_DISPATCHER_DISABLE_<TYPE_ID>` (see the `DISPATCH_DISABLE_*`
+ * CMake options). A pruned id is never instantiated through the dispatcher —
+ * removing its kernels from the binary — and dispatching on it fails at
+ * runtime with "Unsupported type_id.". The arithmetic workhorse types
+ * (`INT32`, `INT64`, `FLOAT32`, `FLOAT64`) are used internally (offsets,
+ * gather maps, ...) and cannot be pruned.
+ *
  * @tparam id_to_type_impl Maps a `cudf::type_id` its dispatched C++ type
  * @tparam Functor The callable object's type
  * @tparam Ts Variadic parameter pack type
@@ -282,15 +290,21 @@ template <template <cudf::type_id> typename IdTypeMap = id_to_type_impl,
 CUDA_HOST_DEVICE_CALLABLE constexpr decltype(auto) type_dispatcher(
     cudf::data_type dtype, Functor f, Ts&&... args) {
   switch (dtype.id()) {
+#ifndef CUDF_TYPE_DISPATCHER_DISABLE_BOOL8
     case BOOL8:
       return f.template operator()<typename IdTypeMap<BOOL8>::type>(
           std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_TYPE_DISPATCHER_DISABLE_INT8
     case INT8:
       return f.template operator()<typename IdTypeMap<INT8>::type>(
           std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_TYPE_DISPATCHER_DISABLE_INT16
     case INT16:
       return f.template operator()<typename IdTypeMap<INT16>::type>(
           std::forward<Ts>(args)...);
+#endif
     case INT32:
       return f.template operator()<typename IdTypeMap<INT32>::type>(
           std::forward<Ts>(args)...);
@@ -303,27 +317,41 @@ CUDA_HOST_DEVICE_CALLABLE constexpr decltype(auto) type_dispatcher(
     case FLOAT64:
       return f.template operator()<typename IdTypeMap<FLOAT64>::type>(
           std::forward<Ts>(args)...);
+#ifndef CUDF_TYPE_DISPATCHER_DISABLE_STRING
     case STRING:
       return f.template operator()<typename IdTypeMap<STRING>::type>(
           std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_TYPE_DISPATCHER_DISABLE_TIMESTAMP_DAYS
     case TIMESTAMP_DAYS:
       return f.template operator()<typename IdTypeMap<TIMESTAMP_DAYS>::type>(
           std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_TYPE_DISPATCHER_DISABLE_TIMESTAMP_SECONDS
     case TIMESTAMP_SECONDS:
       return f.template operator()<typename IdTypeMap<TIMESTAMP_SECONDS>::type>(
           std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_TYPE_DISPATCHER_DISABLE_TIMESTAMP_MILLISECONDS
     case TIMESTAMP_MILLISECONDS:
       return f.template operator()<typename IdTypeMap<TIMESTAMP_MILLISECONDS>::type>(
           std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_TYPE_DISPATCHER_DISABLE_TIMESTAMP_MICROSECONDS
     case TIMESTAMP_MICROSECONDS:
       return f.template operator()<typename IdTypeMap<TIMESTAMP_MICROSECONDS>::type>(
           std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_TYPE_DISPATCHER_DISABLE_TIMESTAMP_NANOSECONDS
     case TIMESTAMP_NANOSECONDS:
       return f.template operator()<typename IdTypeMap<TIMESTAMP_NANOSECONDS>::type>(
           std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_TYPE_DISPATCHER_DISABLE_DICTIONARY32
     case DICTIONARY32:
       return f.template operator()<typename IdTypeMap<DICTIONARY32>::type>(
           std::forward<Ts>(args)...);
+#endif
     default: {
 #ifndef __CUDA_ARCH__
       CUDF_FAIL("Unsupported type_id.");
@@ -18,6 +18,7 @@
 #include <cudf/column/column.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <nvtext/tokenize.hpp>
 
 namespace nvtext
 {
@@ -82,5 +83,24 @@ std::unique_ptr<cudf::column> count_tokens( cudf::strings_column_view const& str
                                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
                                             cudaStream_t stream = 0 );
 
+/**
+ * @copydoc nvtext::tokenize_with_vocabulary(strings_column_view const&,tokenize_vocabulary const&,string_scalar const&,size_type,rmm::mr::device_memory_resource*)
+ *
+ * @param strings Strings column to tokenize.
+ * @param vocabulary Vocabulary to look up each token in.
+ * @param delimiter UTF-8 characters used to separate each string into tokens.
+ *                  The default of empty string will separate tokens using whitespace.
+ * @param default_id Value assigned to tokens not found in the vocabulary.
+ * @param mr Resource for allocating device memory.
+ * @param stream Stream to use for any CUDA calls.
+ * @return New INT32 column of token ids.
+ */
+std::unique_ptr<cudf::column> tokenize_with_vocabulary( cudf::strings_column_view const& strings,
+                                                        tokenize_vocabulary const& vocabulary,
+                                                        cudf::string_scalar const& delimiter = cudf::string_scalar{""},
+                                                        cudf::size_type default_id = -1,
+                                                        rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                                                        cudaStream_t stream = 0 );
+
 } // namespace detail
 } // namespace nvtext
@@ -51,6 +51,57 @@ std::unique_ptr<cudf::column> generate_ngrams( cudf::strings_column_view const&
                                                cudf::string_scalar const& separator = cudf::string_scalar{"_"},
                                                rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Returns a column of hash values for the ngrams generated from
+ * a strings column.
+ *
+ * This is equivalent to hashing the output of `generate_ngrams` but the
+ * ngram strings are never materialized; the hash of each ngram is built by
+ * combining the hashes of its member strings. The hash values therefore do
+ * not match hashing the concatenated ngram text but are stable for equal
+ * ngrams, which is what feature bucketing requires.
+ *
+ * All null row entries are ignored and empty strings are skipped, the same
+ * as `generate_ngrams`.
+ *
+ * @throw cudf::logic_error if there are not enough strings to generate any ngrams
+ *
+ * @param strings Strings column to produce ngram hashes from.
+ * @param ngrams The ngram number to generate.
+ *               Default is 2 = bigram.
+ * @param mr Resource for allocating device memory.
+ * @return New INT32 column of ngram hash values.
+ */
+std::unique_ptr<cudf::column> hash_ngrams( cudf::strings_column_view const& strings,
+                                           cudf::size_type ngrams = 2,
+                                           rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns a column of hash values for the character ngrams within
+ * each string.
+ *
+ * A character ngram is each sliding window of `ngrams` characters in a
+ * string. Each ngram is hashed in place from the input character data so
+ * no intermediate ngram strings are created.
+ * ```
+ * ["abcd"] with ngrams=3 produces hashes of ["abc", "bcd"]
+ * ```
+ *
+ * The hashes of all strings are returned in one column in row order.
+ * Null rows and strings shorter than `ngrams` characters produce no output.
+ *
+ * @throw cudf::logic_error if no string is long enough to generate an ngram
+ *
+ * @param strings Strings column to produce ngram hashes from.
+ * @param ngrams The ngram number to generate.
+ *               Default is 5.
+ * @param mr Resource for allocating device memory.
+ * @return New INT32 column of ngram hash values.
+ */
+std::unique_ptr<cudf::column> hash_character_ngrams( cudf::strings_column_view const& strings,
+                                                     cudf::size_type ngrams = 5,
+                                                     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 
 } // namespace nvtext
 
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+namespace nvtext
+{
+
+/**
+ * @brief Describes a text preprocessing pipeline executed in one device pass.
+ *
+ * The stages mirror calling `normalize_spaces`, a case fold, `tokenize` and
+ * `ngrams_tokenize` in sequence but without materializing the intermediate
+ * strings columns between them.
+ */
+struct text_pipeline
+{
+    /**
+     * @brief Characters used to separate tokens.
+     *
+     * An empty string indicates runs of whitespace (code-point <= ' ')
+     * which also provides the space normalization of `normalize_spaces`.
+     */
+    cudf::string_scalar delimiter{""};
+    /**
+     * @brief String inserted between the tokens of each ngram.
+     */
+    cudf::string_scalar separator{"_"};
+    /**
+     * @brief Number of tokens per output ngram; 1 produces plain tokens.
+     */
+    cudf::size_type ngrams = 1;
+    /**
+     * @brief Fold ASCII characters [A-Z] to lower-case while copying tokens.
+     */
+    bool lowercase = false;
+};
+
+/**
+ * @brief Runs the given text pipeline over a strings column in a single
+ * fused pass.
+
+ * Tokens are located, optionally case folded and grouped into ngrams while
+ * reading the input character data exactly once; no normalized or tokenized
+ * intermediate column is created.
+ * ```
+ * ["  The  big dog ", "a b"] with ngrams=2, lowercase=true produces
+ * ["the_big", "big_dog", "a_b"]
+ * ```
+ *
+ * All null row entries are ignored and the output contains all valid rows.
+ *
+ * @throw cudf::logic_error if the pipeline delimiter or separator is invalid
+ *        or ngrams is less than 1
+ *
+ * @param strings Strings column to process.
+ * @param pipeline Stages to apply; see `text_pipeline`.
+ * @param mr Resource for allocating device memory.
+ * @return New strings column of tokens or ngrams.
+ */
+std::unique_ptr<cudf::column> pipeline_tokenize( cudf::strings_column_view const& strings,
+                                                 text_pipeline const& pipeline,
+                                                 rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+} // namespace nvtext
@@ -145,4 +145,85 @@ std::unique_ptr<cudf::column> count_tokens( cudf::strings_column_view const& str
                                             cudf::strings_column_view const& delimiters,
                                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Vocabulary object to be used with nvtext::tokenize_with_vocabulary.
+ *
+ * The vocabulary strings are loaded once into a device hash map so
+ * repeated tokenize_with_vocabulary calls look up tokens directly
+ * instead of joining the tokens back against the vocabulary column.
+ *
+ * The id assigned to each vocabulary entry is its row position within
+ * the vocabulary column. The vocabulary column's device data is
+ * referenced by the map so the column must remain valid for the
+ * lifetime of this object.
+ */
+class tokenize_vocabulary
+{
+public:
+    /**
+     * @brief Builds a device hash map of the given vocabulary strings.
+     *
+     * @throw cudf::logic_error if vocabulary is empty or contains nulls.
+     *
+     * @param vocabulary Strings to map tokens against.
+     *        These are expected to be unique.
+     */
+    tokenize_vocabulary( cudf::strings_column_view const& vocabulary );
+    ~tokenize_vocabulary();
+    tokenize_vocabulary( tokenize_vocabulary&& );
+    tokenize_vocabulary& operator=( tokenize_vocabulary&& );
+    tokenize_vocabulary( tokenize_vocabulary const& ) = delete;
+    tokenize_vocabulary& operator=( tokenize_vocabulary const& ) = delete;
+
+    /**
+     * @brief Returns the number of vocabulary entries.
+     */
+    cudf::size_type size() const;
+
+    struct impl;
+    impl* get_impl() const;
+
+private:
+    std::unique_ptr<impl> _impl;
+};
+
+/**
+ * @brief Returns token ids by tokenizing the input strings column and
+ * looking up each token in the given vocabulary in the same pass.
+ *
+ * The `delimiter` may be zero or more characters. If the `delimiter` is empty,
+ * whitespace (character code-point <= ' ') is used for identifying tokens.
+ * Also, any consecutive delimiters found in a string are ignored.
+ *
+ * As each string is tokenized, the token ids are appended using input column
+ * row order to build the output column -- the same ordering produced by
+ * tokenize(). Tokens not found in the vocabulary are assigned default_id.
+ *
+ * Example:
+ * ```
+ * s = ["hello world", "hello there"]
+ * v = ["there", "world"]
+ * t = tokenize_with_vocabulary(s,tokenize_vocabulary(v))
+ * t is now [-1, 1, -1, 0]
+ * ```
+ *
+ * All null row entries are ignored and the output contains all valid rows.
+ *
+ * @throw cudf::logic_error if delimiter is invalid.
+ *
+ * @param strings Strings column to tokenize.
+ * @param vocabulary Vocabulary to look up each token in.
+ * @param delimiter UTF-8 characters used to separate each string into tokens.
+ *                  The default of empty string will separate tokens using whitespace.
+ * @param default_id Value assigned to tokens not found in the vocabulary.
+ *                   Default is -1.
+ * @param mr Resource for allocating device memory.
+ * @return New INT32 column of token ids.
+ */
+std::unique_ptr<cudf::column> tokenize_with_vocabulary( cudf::strings_column_view const& strings,
+                                                        tokenize_vocabulary const& vocabulary,
+                                                        cudf::string_scalar const& delimiter = cudf::string_scalar{""},
+                                                        cudf::size_type default_id = -1,
+                                                        rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 } // namespace nvtext
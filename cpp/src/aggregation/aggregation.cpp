@@ -92,6 +92,10 @@ std::unique_ptr<aggregation> make_argmin_aggregation() {
 std::unique_ptr<aggregation> make_nunique_aggregation(include_nulls _include_nulls) {
   return std::make_unique<detail::nunique_aggregation>(aggregation::NUNIQUE, _include_nulls);
 }
+/// Factory to create an APPROX_NUNIQUE aggregation
+std::unique_ptr<aggregation> make_approx_nunique_aggregation(include_nulls _include_nulls) {
+  return std::make_unique<detail::nunique_aggregation>(aggregation::APPROX_NUNIQUE, _include_nulls);
+}
 /// Factory to create a NTH_ELEMENT aggregation
 std::unique_ptr<aggregation> make_nth_element_aggregation(size_type n, include_nulls _include_nulls) {
   return std::make_unique<detail::nth_element_aggregation>(aggregation::NTH_ELEMENT, n, _include_nulls);
@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/ast.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace cudf {
+namespace experimental {
+namespace ast {
+
+namespace detail {
+
+namespace {
+
+//maximum operand stack depth the interpreter supports; flattening
+//rejects trees that would evaluate deeper than this
+constexpr size_type max_stack_depth = 32;
+
+//opcodes below 0 push operands; values >= 0 are ast_operator
+constexpr int32_t opcode_push_column = -1;
+constexpr int32_t opcode_push_literal = -2;
+
+/**
+ * @brief One step of the flattened postfix program.
+ */
+struct instruction {
+  int32_t opcode;     ///< push opcode or static_cast<int32_t>(ast_operator)
+  size_type column;   ///< column index when opcode == opcode_push_column
+  double value;       ///< literal value when opcode == opcode_push_literal
+};
+
+/**
+ * @brief Reads a numeric element as double, dispatching on the column's type.
+ */
+__device__ double element_as_double(column_device_view const& col,
+                                    size_type row)
+{
+  switch (col.type().id()) {
+    case INT8:    return static_cast<double>(col.element<int8_t>(row));
+    case INT16:   return static_cast<double>(col.element<int16_t>(row));
+    case INT32:   return static_cast<double>(col.element<int32_t>(row));
+    case INT64:   return static_cast<double>(col.element<int64_t>(row));
+    case FLOAT32: return static_cast<double>(col.element<float>(row));
+    case FLOAT64: return col.element<double>(row);
+    case BOOL8:   return col.element<bool8>(row) ? 1.0 : 0.0;
+    default:      return 0.0;  // unreachable; types validated on the host
+  }
+}
+
+__device__ double apply_operator(ast_operator op, double lhs, double rhs)
+{
+  switch (op) {
+    case ast_operator::ADD: return lhs + rhs;
+    case ast_operator::SUB: return lhs - rhs;
+    case ast_operator::MUL: return lhs * rhs;
+    case ast_operator::DIV: return lhs / rhs;
+    case ast_operator::MOD: return fmod(lhs, rhs);
+    case ast_operator::POW: return pow(lhs, rhs);
+    case ast_operator::MIN: return lhs < rhs ? lhs : rhs;
+    case ast_operator::MAX: return lhs > rhs ? lhs : rhs;
+    default:                return 0.0;  // unreachable
+  }
+}
+
+/**
+ * @brief Interprets the postfix program once per row.
+ *
+ * Each thread walks the instruction sequence with a small in-register operand
+ * stack, reading every referenced column element exactly once and writing only
+ * the final value, so a chain of N binary operations costs one read pass and
+ * one write instead of N of each.
+ */
+template <bool has_validity>
+__global__ void compute_column_kernel(table_device_view table,
+                                      instruction const* program,
+                                      size_type program_length,
+                                      mutable_column_device_view output)
+{
+  size_type row = threadIdx.x + blockIdx.x * blockDim.x;
+  while (row < table.num_rows()) {
+    double stack[max_stack_depth];
+    size_type top = 0;
+    bool valid = true;
+
+    for (size_type i = 0; i < program_length; ++i) {
+      auto const& inst = program[i];
+      if (inst.opcode == opcode_push_column) {
+        auto const& col = table.column(inst.column);
+        if (has_validity and not col.is_valid(row)) { valid = false; }
+        stack[top++] = element_as_double(col, row);
+      } else if (inst.opcode == opcode_push_literal) {
+        stack[top++] = inst.value;
+      } else {
+        auto const rhs = stack[--top];
+        auto const lhs = stack[--top];
+        stack[top++] = apply_operator(static_cast<ast_operator>(inst.opcode),
+                                      lhs, rhs);
+      }
+    }
+
+    output.element<double>(row) = stack[0];
+    if (has_validity) {
+      if (valid) {
+        output.set_valid(row);
+      } else {
+        output.set_null(row);
+      }
+    }
+
+    row += blockDim.x * gridDim.x;
+  }
+}
+
+/**
+ * @brief Flattens the expression tree into a postfix program, validating
+ * column references and the evaluation stack depth as it goes.
+ */
+void flatten_expression(expression const& expr, table_view const& table,
+                        std::vector<instruction>& program,
+                        size_type& depth, size_type& max_depth)
+{
+  if (auto col = dynamic_cast<column_reference const*>(&expr)) {
+    CUDF_EXPECTS(col->column_index >= 0 and
+                 col->column_index < table.num_columns(),
+                 "Column reference index out of range.");
+    CUDF_EXPECTS(cudf::is_numeric(table.column(col->column_index).type()),
+                 "Expressions may only reference numeric columns.");
+    program.push_back(
+        instruction{opcode_push_column, col->column_index, 0.0});
+    max_depth = std::max(max_depth, ++depth);
+  } else if (auto lit = dynamic_cast<literal const*>(&expr)) {
+    program.push_back(instruction{opcode_push_literal, 0, lit->value});
+    max_depth = std::max(max_depth, ++depth);
+  } else if (auto op = dynamic_cast<operation const*>(&expr)) {
+    flatten_expression(op->lhs, table, program, depth, max_depth);
+    flatten_expression(op->rhs, table, program, depth, max_depth);
+    program.push_back(
+        instruction{static_cast<int32_t>(op->op), 0, 0.0});
+    --depth;  // two operands popped, one result pushed
+  } else {
+    CUDF_FAIL("Unrecognized expression node type.");
+  }
+}
+
+}  // namespace
+
+std::unique_ptr<column> compute_column(table_view const& table,
+                                       expression const& expr,
+                                       rmm::mr::device_memory_resource* mr,
+                                       cudaStream_t stream)
+{
+  std::vector<instruction> program;
+  size_type depth = 0;
+  size_type max_depth = 0;
+  flatten_expression(expr, table, program, depth, max_depth);
+  CUDF_EXPECTS(max_depth <= max_stack_depth,
+               "Expression exceeds evaluator stack depth.");
+
+  auto const num_rows = table.num_rows();
+
+  //an output row is null iff some element it reads is null, so the output
+  //only needs a mask when a referenced column has nulls
+  bool has_validity = false;
+  for (auto const& inst : program) {
+    if (inst.opcode == opcode_push_column) {
+      has_validity = has_validity or table.column(inst.column).has_nulls();
+    }
+  }
+
+  auto output = make_numeric_column(
+      data_type{FLOAT64}, num_rows,
+      has_validity ? mask_state::UNINITIALIZED : mask_state::UNALLOCATED,
+      stream, mr);
+
+  if (num_rows == 0) { return output; }
+
+  auto const d_program = rmm::device_vector<instruction>{program};
+  auto const device_table = table_device_view::create(table, stream);
+  auto device_output =
+      mutable_column_device_view::create(output->mutable_view(), stream);
+
+  constexpr size_type block_size = 256;
+  cudf::experimental::detail::grid_1d config(num_rows, block_size);
+  auto const kernel = has_validity
+      ? compute_column_kernel<true>
+      : compute_column_kernel<false>;
+  kernel<<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
+      *device_table,
+      d_program.data().get(),
+      static_cast<size_type>(program.size()),
+      *device_output);
+
+  CHECK_CUDA(stream);
+
+  return output;
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> compute_column(table_view const& table,
+                                       expression const& expr,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::compute_column(table, expr, mr, 0);
+}
+
+}  // namespace ast
+}  // namespace experimental
+}  // namespace cudf
@@ -19,6 +19,8 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/binaryop.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/scalar/scalar.hpp>
@@ -80,6 +82,55 @@ rmm::device_buffer scalar_col_valid_mask_and(
     return rmm::device_buffer{};
   }
 }
+
+/**
+ * @brief Computes op between a dictionary column and a scalar by evaluating
+ * the operator once per dictionary key and gathering the per-key results
+ * through the int32 indices.
+ *
+ * For low-cardinality columns this avoids both the decode of the full
+ * column and the per-row operator evaluation.
+ */
+std::unique_ptr<column> dictionary_scalar_binary_operation(
+    column_view const& col,
+    scalar const& s,
+    binary_operator op,
+    data_type output_type,
+    bool reversed,
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream) {
+  if (col.size() == 0) {
+    return make_fixed_width_column(output_type, 0, mask_state::UNALLOCATED,
+                                   stream, mr);
+  }
+
+  dictionary_column_view dictionary{col};
+
+  // evaluate the operator once per key instead of once per row
+  auto key_results =
+      reversed ? experimental::detail::binary_operation(
+                     s, dictionary.keys(), op, output_type,
+                     rmm::mr::get_default_resource(), stream)
+               : experimental::detail::binary_operation(
+                     dictionary.keys(), s, op, output_type,
+                     rmm::mr::get_default_resource(), stream);
+
+  // map the per-key results through the indices, as `dictionary::decode`
+  // does for the keys themselves -- use ignore_out_of_bounds=true since
+  // the indices of null rows are unspecified
+  column_view gather_map{data_type{INT32}, dictionary.size(),
+                         dictionary.indices().head<int32_t>(), nullptr, 0,
+                         dictionary.offset()};
+  auto table_column =
+      experimental::detail::gather(table_view{{key_results->view()}},
+                                   gather_map, false, true, false, mr, stream)
+          ->release();
+  auto out = std::unique_ptr<column>(std::move(table_column.front()));
+
+  out->set_null_mask(scalar_col_valid_mask_and(col, s, stream, mr),
+                     s.is_valid() ? col.null_count() : col.size());
+  return out;
+}
 }  // namespace detail
 
 namespace jit {
@@ -232,6 +283,30 @@ void binary_operation(mutable_column_view& out,
               cudf::jit::get_data_ptr(lhs), cudf::jit::get_data_ptr(rhs));
 }
 
+void precompile_binary_operation(binary_operator op,
+                                 data_type output_type,
+                                 data_type lhs_type,
+                                 data_type rhs_type,
+                                 cudaStream_t stream) {
+  auto const output_name = cudf::jit::get_type_name(output_type);
+  auto const lhs_name = cudf::jit::get_type_name(lhs_type);
+  auto const rhs_name = cudf::jit::get_type_name(rhs_type);
+
+  // setting the kernel instantiation without launching compiles it (or loads
+  // it from the file cache) and leaves it in the in-memory cache; warm both
+  // the column-column and column-scalar forms since they share the program
+  cudf::jit::launcher(hash, code::kernel, header_names, compiler_flags,
+                      headers_code, stream)
+      .set_kernel_inst("kernel_v_v",
+                       {output_name, lhs_name, rhs_name,
+                        get_operator_name(op, OperatorType::Direct)});
+  cudf::jit::launcher(hash, code::kernel, header_names, compiler_flags,
+                      headers_code, stream)
+      .set_kernel_inst("kernel_v_s",
+                       {output_name, lhs_name, rhs_name,
+                        get_operator_name(op, OperatorType::Direct)});
+}
+
 }  // namespace jit
 }  // namespace binops
 
@@ -247,6 +322,13 @@ std::unique_ptr<column> binary_operation(scalar const& lhs,
   CUDF_EXPECTS(is_fixed_width(output_type),
                "Invalid/Unsupported output datatype");
 
+  // evaluate against the keys and gather through the indices rather than
+  // decoding the full column
+  if (rhs.type().id() == type_id::DICTIONARY32) {
+    return binops::detail::dictionary_scalar_binary_operation(
+        rhs, lhs, op, output_type, true, mr, stream);
+  }
+
   if ((lhs.type().id() == type_id::STRING) &&
       (rhs.type().id() == type_id::STRING)) {
     return binops::compiled::binary_operation(lhs, rhs, op, output_type, mr,
@@ -279,6 +361,13 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   CUDF_EXPECTS(is_fixed_width(output_type),
                "Invalid/Unsupported output datatype");
 
+  // evaluate against the keys and gather through the indices rather than
+  // decoding the full column
+  if (lhs.type().id() == type_id::DICTIONARY32) {
+    return binops::detail::dictionary_scalar_binary_operation(
+        lhs, rhs, op, output_type, false, mr, stream);
+  }
+
   if ((lhs.type().id() == type_id::STRING) &&
       (rhs.type().id() == type_id::STRING)) {
     return binops::compiled::binary_operation(lhs, rhs, op, output_type, mr,
@@ -319,6 +408,15 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
                                               stream);
   }
 
+  // common homogeneous combinations have build-time instantiated kernels,
+  // avoiding NVRTC entirely
+  if (binops::compiled::is_supported_fast_path(op, output_type, lhs.type(),
+                                               rhs.type())) {
+    return binops::compiled::fast_path_binary_operation(lhs, rhs, op,
+                                                        output_type, mr,
+                                                        stream);
+  }
+
   CUDF_EXPECTS(is_fixed_width(lhs.type()), "Invalid/Unsupported lhs datatype");
   CUDF_EXPECTS(is_fixed_width(rhs.type()), "Invalid/Unsupported rhs datatype");
 
@@ -377,36 +475,63 @@ std::unique_ptr<column> binary_operation(scalar const& lhs,
                                          column_view const& rhs,
                                          binary_operator op,
                                          data_type output_type,
-                                         rmm::mr::device_memory_resource* mr) {
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream) {
   CUDF_FUNC_RANGE();
-  return detail::binary_operation(lhs, rhs, op, output_type, mr);
+  return detail::binary_operation(lhs, rhs, op, output_type, mr, stream);
 }
 
 std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          scalar const& rhs,
                                          binary_operator op,
                                          data_type output_type,
-                                         rmm::mr::device_memory_resource* mr) {
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream) {
   CUDF_FUNC_RANGE();
-  return detail::binary_operation(lhs, rhs, op, output_type, mr);
+  return detail::binary_operation(lhs, rhs, op, output_type, mr, stream);
 }
 
 std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          column_view const& rhs,
                                          binary_operator op,
                                          data_type output_type,
-                                         rmm::mr::device_memory_resource* mr) {
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream) {
   CUDF_FUNC_RANGE();
-  return detail::binary_operation(lhs, rhs, op, output_type, mr);
+  return detail::binary_operation(lhs, rhs, op, output_type, mr, stream);
 }
 
 std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          column_view const& rhs,
                                          std::string const& ptx,
                                          data_type output_type,
-                                         rmm::mr::device_memory_resource* mr) {
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream) {
   CUDF_FUNC_RANGE();
-  return detail::binary_operation(lhs, rhs, ptx, output_type, mr);
+  return detail::binary_operation(lhs, rhs, ptx, output_type, mr, stream);
+}
+
+void precompile_binary_operation(binary_operator op,
+                                 data_type output_type,
+                                 data_type lhs_type,
+                                 data_type rhs_type) {
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(is_fixed_width(output_type),
+               "Invalid/Unsupported output datatype");
+  CUDF_EXPECTS(is_fixed_width(lhs_type), "Invalid/Unsupported lhs datatype");
+  CUDF_EXPECTS(is_fixed_width(rhs_type), "Invalid/Unsupported rhs datatype");
+
+  binops::jit::precompile_binary_operation(op, output_type, lhs_type, rhs_type,
+                                           0);
+}
+
+void preload_jit_cache(bool async) {
+  CUDF_FUNC_RANGE();
+  if (async) {
+    cudf::jit::cudfJitCache::Instance().preloadFileCacheAsync();
+  } else {
+    cudf::jit::cudfJitCache::Instance().preloadFileCache();
+  }
 }
 
 }  // namespace experimental
@@ -16,11 +16,14 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/table/table_view.hpp>
 
 #include <rmm/thrust_rmm_allocator.h>
 
+#include <cstdint>
+
 #include "binary_ops.hpp"
 
 namespace cudf {
@@ -53,6 +56,25 @@ struct apply_binop {
   CUDA_DEVICE_CALLABLE Out greater_equal(Lhs const& x, Rhs const& y) const { return static_cast<Out>(x >= y); }
 };
 
+/**
+ * @brief Arithmetic counterpart of `apply_binop`, kept separate so the string
+ * instantiations never have to compile arithmetic expressions.
+ */
+template <typename Lhs, typename Rhs, typename Out>
+struct apply_arith_binop {
+  binary_operator op;
+  apply_arith_binop(binary_operator op) : op(op) {}
+  CUDA_DEVICE_CALLABLE Out operator()(Lhs const& x, Rhs const& y) const {
+    switch (op) {
+      case binary_operator::ADD: return static_cast<Out>(x + y);
+      case binary_operator::SUB: return static_cast<Out>(x - y);
+      case binary_operator::MUL: return static_cast<Out>(x * y);
+      case binary_operator::DIV: return static_cast<Out>(x / y);
+      default: return Out{};
+    }
+  }
+};
+
 template <typename Lhs, typename Rhs, typename Out>
 struct apply_binop_scalar_lhs_rhs : apply_binop<Lhs, Rhs, Out> {
   cudf::experimental::scalar_device_type_t<Rhs> scalar;
@@ -73,7 +95,8 @@ struct apply_binop_scalar_rhs_lhs : apply_binop<Lhs, Rhs, Out> {
   }
 };
 
-template <typename Lhs, typename Rhs, typename Out>
+template <typename Lhs, typename Rhs, typename Out,
+          template <typename, typename, typename> class Functor = apply_binop>
 struct binary_op {
 
   std::unique_ptr<column> operator()(column_view const& lhs, scalar const& rhs, binary_operator op, data_type out_type, bool const reversed, rmm::mr::device_memory_resource* mr, cudaStream_t stream) {
@@ -119,23 +142,23 @@ struct binary_op {
       if (lhs.has_nulls() && rhs.has_nulls()) {
         auto lhs_itr = cudf::experimental::detail::make_null_replacement_iterator(*lhs_device_view, Lhs{});
         auto rhs_itr = cudf::experimental::detail::make_null_replacement_iterator(*rhs_device_view, Rhs{});
-        thrust::transform(rmm::exec_policy(stream)->on(stream), lhs_itr, lhs_itr + lhs.size(), rhs_itr, out_itr, apply_binop<Lhs, Rhs, Out>{op});
+        thrust::transform(rmm::exec_policy(stream)->on(stream), lhs_itr, lhs_itr + lhs.size(), rhs_itr, out_itr, Functor<Lhs, Rhs, Out>{op});
       } else if (lhs.has_nulls()) {
         auto lhs_itr = cudf::experimental::detail::make_null_replacement_iterator(*lhs_device_view, Lhs{});
         auto rhs_itr = thrust::make_transform_iterator(thrust::make_counting_iterator(size_type{0}),
                                                       [col=*rhs_device_view] __device__ (size_type i) { return col.element<Rhs>(i); });
-        thrust::transform(rmm::exec_policy(stream)->on(stream), lhs_itr, lhs_itr + lhs.size(), rhs_itr, out_itr, apply_binop<Lhs, Rhs, Out>{op});
+        thrust::transform(rmm::exec_policy(stream)->on(stream), lhs_itr, lhs_itr + lhs.size(), rhs_itr, out_itr, Functor<Lhs, Rhs, Out>{op});
       } else if (rhs.has_nulls()) {
         auto lhs_itr = thrust::make_transform_iterator(thrust::make_counting_iterator(size_type{0}),
                                                       [col=*lhs_device_view] __device__ (size_type i) { return col.element<Lhs>(i); });
         auto rhs_itr = cudf::experimental::detail::make_null_replacement_iterator(*rhs_device_view, Rhs{});
-        thrust::transform(rmm::exec_policy(stream)->on(stream), lhs_itr, lhs_itr + lhs.size(), rhs_itr, out_itr, apply_binop<Lhs, Rhs, Out>{op});
+        thrust::transform(rmm::exec_policy(stream)->on(stream), lhs_itr, lhs_itr + lhs.size(), rhs_itr, out_itr, Functor<Lhs, Rhs, Out>{op});
       } else {
         auto lhs_itr = thrust::make_transform_iterator(thrust::make_counting_iterator(size_type{0}),
                                                       [col=*lhs_device_view] __device__ (size_type i) { return col.element<Lhs>(i); });
         auto rhs_itr = thrust::make_transform_iterator(thrust::make_counting_iterator(size_type{0}),
                                                       [col=*rhs_device_view] __device__ (size_type i) { return col.element<Rhs>(i); });
-        thrust::transform(rmm::exec_policy(stream)->on(stream), lhs_itr, lhs_itr + lhs.size(), rhs_itr, out_itr, apply_binop<Lhs, Rhs, Out>{op});
+        thrust::transform(rmm::exec_policy(stream)->on(stream), lhs_itr, lhs_itr + lhs.size(), rhs_itr, out_itr, Functor<Lhs, Rhs, Out>{op});
       }
     }
 
@@ -145,8 +168,222 @@ struct binary_op {
   }
 };
 
+constexpr bool is_fast_path_arith(binary_operator op) {
+  return op == binary_operator::ADD or op == binary_operator::SUB or
+         op == binary_operator::MUL or op == binary_operator::DIV;
+}
+
+constexpr bool is_fast_path_compare(binary_operator op) {
+  return op == binary_operator::EQUAL or op == binary_operator::NOT_EQUAL or
+         op == binary_operator::LESS or op == binary_operator::GREATER or
+         op == binary_operator::LESS_EQUAL or
+         op == binary_operator::GREATER_EQUAL;
+}
+
+template <typename T>
+std::unique_ptr<column> fast_path_op(column_view const& lhs,
+                                     column_view const& rhs,
+                                     binary_operator op, data_type output_type,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream) {
+  if (is_fast_path_arith(op)) {
+    return binary_op<T, T, T, apply_arith_binop>{}(lhs, rhs, op, output_type,
+                                                   mr, stream);
+  }
+  return binary_op<T, T, cudf::experimental::bool8>{}(lhs, rhs, op,
+                                                      output_type, mr, stream);
+}
+
+/**
+ * @brief Packed SIMD functors for sub-word types: `operator()` combines a
+ * full 32-bit word (4 int8 or 2 int16 lanes) with a video intrinsic, while
+ * `scalar` handles the trailing elements that do not fill a word.
+ *
+ * The per-word arithmetic wraps modularly, matching the promote-then-truncate
+ * behavior of `apply_arith_binop` for sub-word types.
+ */
+struct packed_arith4 {
+  binary_operator op;
+  CUDA_DEVICE_CALLABLE uint32_t operator()(uint32_t x, uint32_t y) const {
+    return op == binary_operator::ADD ? __vadd4(x, y) : __vsub4(x, y);
+  }
+  CUDA_DEVICE_CALLABLE int8_t scalar(int8_t x, int8_t y) const {
+    return op == binary_operator::ADD ? static_cast<int8_t>(x + y)
+                                      : static_cast<int8_t>(x - y);
+  }
+};
+
+struct packed_arith2 {
+  binary_operator op;
+  CUDA_DEVICE_CALLABLE uint32_t operator()(uint32_t x, uint32_t y) const {
+    return op == binary_operator::ADD ? __vadd2(x, y) : __vsub2(x, y);
+  }
+  CUDA_DEVICE_CALLABLE int16_t scalar(int16_t x, int16_t y) const {
+    return op == binary_operator::ADD ? static_cast<int16_t>(x + y)
+                                      : static_cast<int16_t>(x - y);
+  }
+};
+
+struct packed_compare4 {
+  binary_operator op;
+  CUDA_DEVICE_CALLABLE uint32_t operator()(uint32_t x, uint32_t y) const {
+    uint32_t mask;
+    switch (op) {
+      case binary_operator::EQUAL: mask = __vcmpeq4(x, y); break;
+      case binary_operator::NOT_EQUAL: mask = __vcmpne4(x, y); break;
+      case binary_operator::LESS: mask = __vcmplts4(x, y); break;
+      case binary_operator::GREATER: mask = __vcmpgts4(x, y); break;
+      case binary_operator::LESS_EQUAL: mask = __vcmples4(x, y); break;
+      default: mask = __vcmpges4(x, y); break;
+    }
+    // the intrinsics produce 0xff per true lane; bool8 stores 0 or 1
+    return mask & 0x01010101u;
+  }
+  CUDA_DEVICE_CALLABLE cudf::experimental::bool8 scalar(int8_t x, int8_t y) const {
+    using Out = cudf::experimental::bool8;
+    switch (op) {
+      case binary_operator::EQUAL: return static_cast<Out>(x == y);
+      case binary_operator::NOT_EQUAL: return static_cast<Out>(x != y);
+      case binary_operator::LESS: return static_cast<Out>(x < y);
+      case binary_operator::GREATER: return static_cast<Out>(x > y);
+      case binary_operator::LESS_EQUAL: return static_cast<Out>(x <= y);
+      default: return static_cast<Out>(x >= y);
+    }
+  }
+};
+
+/**
+ * @brief Applies a packed sub-word op, one 32-bit word per thread.
+ *
+ * Values are computed for every row from the raw data, like the jit path;
+ * rows the output mask marks null simply hold don't-care values.
+ */
+template <typename T, typename OutT, typename PackedOp>
+__global__ void packed_binop_kernel(T const* lhs, T const* rhs, OutT* out,
+                                    size_type size, PackedOp op) {
+  static_assert(sizeof(T) == sizeof(OutT),
+                "packed path requires same-width input and output");
+  constexpr size_type lanes = static_cast<size_type>(sizeof(uint32_t) / sizeof(T));
+  size_type const num_words = size / lanes;
+  auto const lhs_words = reinterpret_cast<uint32_t const*>(lhs);
+  auto const rhs_words = reinterpret_cast<uint32_t const*>(rhs);
+  auto const out_words = reinterpret_cast<uint32_t*>(out);
+
+  size_type const start = threadIdx.x + blockIdx.x * blockDim.x;
+  size_type const stride = blockDim.x * gridDim.x;
+  for (size_type i = start; i < num_words; i += stride) {
+    out_words[i] = op(lhs_words[i], rhs_words[i]);
+  }
+  // up to lanes-1 trailing elements do not fill a word
+  for (size_type i = num_words * lanes + start; i < size; i += stride) {
+    out[i] = op.scalar(lhs[i], rhs[i]);
+  }
+}
+
+template <typename T, typename OutT, typename PackedOp>
+std::unique_ptr<column> packed_binary_op(column_view const& lhs,
+                                         column_view const& rhs,
+                                         data_type output_type, PackedOp op,
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream) {
+  auto new_mask = bitmask_and(table_view({lhs, rhs}), mr, stream);
+  auto out = make_fixed_width_column(output_type, lhs.size(), new_mask,
+                                     cudf::UNKNOWN_NULL_COUNT, stream, mr);
+
+  if (lhs.size() > 0) {
+    constexpr size_type block_size = 256;
+    constexpr size_type lanes = static_cast<size_type>(sizeof(uint32_t) / sizeof(T));
+    cudf::experimental::detail::grid_1d grid{(lhs.size() + lanes - 1) / lanes, block_size};
+    packed_binop_kernel<T, OutT>
+        <<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
+            lhs.data<T>(), rhs.data<T>(), out->mutable_view().data<OutT>(),
+            lhs.size(), op);
+  }
+
+  CHECK_CUDA(stream);
+
+  return out;
+}
+
+// sliced views can leave sub-word data off a 32-bit word boundary
+template <typename T>
+bool is_word_aligned(column_view const& col) {
+  return reinterpret_cast<std::uintptr_t>(col.data<T>()) % sizeof(uint32_t) == 0;
+}
+
+std::unique_ptr<column> subword_fast_path_op_int8(
+    column_view const& lhs, column_view const& rhs, binary_operator op,
+    data_type output_type, rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream) {
+  if (is_word_aligned<int8_t>(lhs) && is_word_aligned<int8_t>(rhs)) {
+    if (op == binary_operator::ADD || op == binary_operator::SUB) {
+      return packed_binary_op<int8_t, int8_t>(lhs, rhs, output_type,
+                                              packed_arith4{op}, mr, stream);
+    }
+    if (is_fast_path_compare(op)) {
+      return packed_binary_op<int8_t, cudf::experimental::bool8>(
+          lhs, rhs, output_type, packed_compare4{op}, mr, stream);
+    }
+  }
+  // MUL/DIV have no sub-word intrinsics; misaligned views also use the
+  // per-element compiled path
+  return fast_path_op<int8_t>(lhs, rhs, op, output_type, mr, stream);
+}
+
+std::unique_ptr<column> subword_fast_path_op_int16(
+    column_view const& lhs, column_view const& rhs, binary_operator op,
+    data_type output_type, rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream) {
+  if ((op == binary_operator::ADD || op == binary_operator::SUB) &&
+      is_word_aligned<int16_t>(lhs) && is_word_aligned<int16_t>(rhs)) {
+    return packed_binary_op<int16_t, int16_t>(lhs, rhs, output_type,
+                                              packed_arith2{op}, mr, stream);
+  }
+  // 16-bit compares write 8-bit bool lanes, which do not pack; they and
+  // MUL/DIV and misaligned views use the per-element compiled path
+  return fast_path_op<int16_t>(lhs, rhs, op, output_type, mr, stream);
+}
+
 }  // namespace
 
+bool is_supported_fast_path(binary_operator op, data_type output_type,
+                            data_type lhs_type, data_type rhs_type) {
+  if (lhs_type != rhs_type) { return false; }
+  switch (lhs_type.id()) {
+    case type_id::INT8:
+    case type_id::INT16:
+    case type_id::INT32:
+    case type_id::INT64:
+    case type_id::FLOAT32:
+    case type_id::FLOAT64: break;
+    default: return false;
+  }
+  if (is_fast_path_arith(op)) { return output_type == lhs_type; }
+  if (is_fast_path_compare(op)) { return is_boolean(output_type); }
+  return false;
+}
+
+std::unique_ptr<column> fast_path_binary_operation(
+    column_view const& lhs, column_view const& rhs, binary_operator op,
+    data_type output_type, rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream) {
+  switch (lhs.type().id()) {
+    case type_id::INT8:
+      return subword_fast_path_op_int8(lhs, rhs, op, output_type, mr, stream);
+    case type_id::INT16:
+      return subword_fast_path_op_int16(lhs, rhs, op, output_type, mr, stream);
+    case type_id::INT32:
+      return fast_path_op<int32_t>(lhs, rhs, op, output_type, mr, stream);
+    case type_id::INT64:
+      return fast_path_op<int64_t>(lhs, rhs, op, output_type, mr, stream);
+    case type_id::FLOAT32:
+      return fast_path_op<float>(lhs, rhs, op, output_type, mr, stream);
+    case type_id::FLOAT64:
+      return fast_path_op<double>(lhs, rhs, op, output_type, mr, stream);
+    default: CUDF_FAIL("Unsupported fast path type combination");
+  }
+}
+
 std::unique_ptr<column> binary_operation(scalar const& lhs, column_view const& rhs, binary_operator op, data_type output_type, rmm::mr::device_memory_resource* mr, cudaStream_t stream) {
   // hard-coded to only work with cudf::string_view so we don't explode compile times
   CUDF_EXPECTS(lhs.type().id() == cudf::STRING, "Invalid/Unsupported lhs datatype");
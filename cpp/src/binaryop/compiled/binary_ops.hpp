@@ -31,6 +31,46 @@ rmm::device_buffer scalar_col_valid_mask_and(column_view const& col, scalar cons
 
 namespace compiled {
 
+/**
+ * @brief Indicates whether `fast_path_binary_operation` covers the given
+ * operator and type combination.
+ *
+ * The fast path instantiates kernels at build time for the homogeneous
+ * combinations that dominate real workloads: +, -, * and / producing the
+ * operand type, and the six comparisons producing bool, over INT32, INT64,
+ * FLOAT32 and FLOAT64 operands.
+ *
+ * @param op          The binary operator
+ * @param output_type The desired data type of the output column
+ * @param lhs_type    The left operand data type
+ * @param rhs_type    The right operand data type
+ * @return true if `fast_path_binary_operation` handles this combination
+ */
+bool is_supported_fast_path(binary_operator op, data_type output_type,
+                            data_type lhs_type, data_type rhs_type);
+
+/**
+ * @brief Performs a binary operation between two columns using kernels
+ * instantiated at build time, with no JIT involvement.
+ *
+ * Callers must check `is_supported_fast_path` first.
+ *
+ * @param lhs         The left operand column
+ * @param rhs         The right operand column
+ * @param op          The binary operator
+ * @param output_type The desired data type of the output column
+ * @param mr          Memory resource for allocating output column
+ * @param stream      CUDA stream on which to execute kernels
+ * @return std::unique_ptr<column> Output column
+ */
+std::unique_ptr<column> fast_path_binary_operation(
+    column_view const& lhs,
+    column_view const& rhs,
+    binary_operator op,
+    data_type output_type,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream = 0);
+
 /**
  * @brief Performs a binary operation between a string scalar and a string
  * column.
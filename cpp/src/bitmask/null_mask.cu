@@ -29,7 +29,10 @@
 #include <thrust/copy.h>
 #include <thrust/device_ptr.h>
 #include <thrust/extrema.h>
+#include <thrust/functional.h>
 #include <thrust/binary_search.h>
+#include <thrust/scan.h>
+#include <thrust/tabulate.h>
 #include <cub/cub.cuh>
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_scalar.hpp>
@@ -96,6 +99,39 @@ rmm::device_buffer create_null_mask(size_type size, mask_state state,
   return mask;
 }
 
+// Create the null masks for a whole table in one slab
+batched_null_masks create_null_masks(size_type mask_count, size_type size,
+                                     mask_state state, cudaStream_t stream,
+                                     rmm::mr::device_memory_resource *mr) {
+  batched_null_masks result{};
+
+  if (state == mask_state::UNALLOCATED || mask_count <= 0) {
+    return result;
+  }
+
+  // bitmask_allocation_size_bytes pads to 64 bytes, so back-to-back masks
+  // all start on the usual padding boundary
+  std::size_t const bytes_per_mask = bitmask_allocation_size_bytes(size);
+  std::size_t const slab_size = bytes_per_mask * mask_count;
+
+  result.slab = rmm::device_buffer(slab_size, stream, mr);
+
+  if (state != mask_state::UNINITIALIZED) {
+    uint8_t fill_value = (state == mask_state::ALL_VALID) ? 0xff : 0x00;
+    CUDA_TRY(cudaMemsetAsync(result.slab.data(), fill_value, slab_size,
+                             stream));
+  }
+
+  auto base = static_cast<char *>(result.slab.data());
+  result.masks.reserve(mask_count);
+  for (size_type i = 0; i < mask_count; ++i) {
+    result.masks.push_back(
+        reinterpret_cast<bitmask_type *>(base + i * bytes_per_mask));
+  }
+
+  return result;
+}
+
 __global__ void set_null_mask_kernel(bitmask_type *__restrict__ destination,
                                      size_type begin_bit, size_type end_bit,
                                      bool valid,
@@ -212,7 +248,7 @@ __global__ void count_set_bits_kernel(bitmask_type const *bitmask,
  * @brief Convenience function to get offset word from a bitmask
  * 
  * @see copy_offset_bitmask
- * @see offset_bitmask_and
+ * @see offset_bitmask_binop
  */
 __device__ bitmask_type get_mask_offset_word(
   bitmask_type const *__restrict__ source,
@@ -324,42 +360,52 @@ __global__ void copy_offset_bitmask(bitmask_type *__restrict__ destination,
 }
 
 /**
- * @brief Computes the bitwise AND of an array of bitmasks
- * 
+ * @brief Folds an array of bitmasks into a single bitmask with a binary
+ * operator, all in one pass
+ *
+ * @param op Binary operator used to combine mask words, e.g.
+ *           `thrust::bit_and<bitmask_type>`
+ * @param identity The identity word of @p op, e.g. all bits set for AND
  * @param destination The bitmask to write result into
  * @param source Array of source mask pointers. All masks must be of same size
- * @param begin_bit Array of offsets into corresponding @p source masks. 
+ * @param begin_bit Array of offsets into corresponding @p source masks.
  *                  Must be same size as source array
  * @param num_sources Number of masks in @p source array
  * @param source_size Number of bits in each mask in @p source
  * @param number_of_mask_words The number of words of type bitmask_type to copy
  */
-__global__ void offset_bitmask_and(bitmask_type *__restrict__ destination,
-                                   bitmask_type const * const*__restrict__ source,
-                                   size_type const* __restrict__ begin_bit,
-                                   size_type num_sources, 
-                                   size_type source_size,
-                                   size_type number_of_mask_words) {
+template <typename Binop>
+__global__ void offset_bitmask_binop(Binop op,
+                                     bitmask_type identity,
+                                     bitmask_type *__restrict__ destination,
+                                     bitmask_type const * const*__restrict__ source,
+                                     size_type const* __restrict__ begin_bit,
+                                     size_type num_sources,
+                                     size_type source_size,
+                                     size_type number_of_mask_words) {
   for (size_type destination_word_index = threadIdx.x + blockIdx.x * blockDim.x;
        destination_word_index < number_of_mask_words;
        destination_word_index += blockDim.x * gridDim.x) {
 
-    bitmask_type destination_word = ~bitmask_type{0}; // All bits 1
+    bitmask_type destination_word = identity;
     for (size_type i = 0; i < num_sources; i++) {
-      destination_word &= get_mask_offset_word(
-        source[i], destination_word_index, begin_bit[i], begin_bit[i] + source_size);
+      destination_word = op(destination_word, get_mask_offset_word(
+        source[i], destination_word_index, begin_bit[i], begin_bit[i] + source_size));
     }
 
     destination[destination_word_index] = destination_word;
   }
 }
 
-// Bitwise AND of the masks
-rmm::device_buffer bitmask_and(std::vector<bitmask_type const*> const& masks, 
-                               std::vector<size_type> const& begin_bits,
-                               size_type mask_size,
-                               cudaStream_t stream,
-                               rmm::mr::device_memory_resource *mr) {
+// Fold the masks with a binary operator in a single kernel launch
+template <typename Binop>
+rmm::device_buffer bitmask_binop(Binop op,
+                                 bitmask_type identity,
+                                 std::vector<bitmask_type const*> const& masks,
+                                 std::vector<size_type> const& begin_bits,
+                                 size_type mask_size,
+                                 cudaStream_t stream,
+                                 rmm::mr::device_memory_resource *mr) {
   CUDF_EXPECTS(std::all_of(begin_bits.begin(), begin_bits.end(), 
                            [] (auto b) { return b >= 0; }),
                "Invalid range.");
@@ -379,17 +425,38 @@ rmm::device_buffer bitmask_and(std::vector<bitmask_type const*> const& masks,
   rmm::device_vector<size_type> d_begin_bits(begin_bits);
   
   cudf::experimental::detail::grid_1d config(number_of_mask_words, 256);
-  offset_bitmask_and<<<config.num_blocks, config.num_threads_per_block, 0,
+  offset_bitmask_binop<<<config.num_blocks, config.num_threads_per_block, 0,
                         stream>>>(
-      static_cast<bitmask_type *>(dest_mask.data()), 
+      op, identity,
+      static_cast<bitmask_type *>(dest_mask.data()),
       d_masks.data().get(), d_begin_bits.data().get(),
       d_masks.size(), mask_size, number_of_mask_words);
-  
+
   CHECK_CUDA(stream);
 
   return dest_mask;
 }
 
+// Bitwise AND of the masks
+rmm::device_buffer bitmask_and(std::vector<bitmask_type const*> const& masks,
+                               std::vector<size_type> const& begin_bits,
+                               size_type mask_size,
+                               cudaStream_t stream,
+                               rmm::mr::device_memory_resource *mr) {
+  return bitmask_binop(thrust::bit_and<bitmask_type>{}, ~bitmask_type{0},
+                       masks, begin_bits, mask_size, stream, mr);
+}
+
+// Bitwise OR of the masks
+rmm::device_buffer bitmask_or(std::vector<bitmask_type const*> const& masks,
+                              std::vector<size_type> const& begin_bits,
+                              size_type mask_size,
+                              cudaStream_t stream,
+                              rmm::mr::device_memory_resource *mr) {
+  return bitmask_binop(thrust::bit_or<bitmask_type>{}, bitmask_type{0},
+                       masks, begin_bits, mask_size, stream, mr);
+}
+
 // convert [first_bit_index,last_bit_index) to
 // [first_word_index,last_word_index)
 struct to_word_index : public thrust::unary_function<size_type, size_type> {
@@ -442,7 +509,7 @@ cudf::size_type count_set_bits(bitmask_type const *bitmask, size_type start,
       <<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
           bitmask, start, stop - 1, non_zero_count.data());
 
-  return non_zero_count.value();
+  return non_zero_count.value(stream);
 }
 
 cudf::size_type count_unset_bits(bitmask_type const *bitmask, size_type start,
@@ -579,6 +646,204 @@ segmented_count_unset_bits(bitmask_type const* bitmask,
 
 }  // namespace detail
 
+namespace {
+
+// Granularity of the popcount_index running totals
+constexpr size_type popcount_index_words_per_block{1024};
+
+/**---------------------------------------------------------------------------*
+ * @brief Counts the set bits of one range per thread using the block running
+ * totals of a `popcount_index`.
+ *
+ * Whole index blocks inside a range are resolved from two running totals;
+ * only the partial blocks at the range edges are scanned word by word, so a
+ * thread touches at most `2 * popcount_index_words_per_block` words however
+ * long its range is.
+ *---------------------------------------------------------------------------**/
+__global__ void indexed_segmented_count_kernel(
+    bitmask_type const *__restrict__ bitmask,
+    size_type const *__restrict__ block_prefix,
+    size_type const *__restrict__ first_indices,
+    size_type const *__restrict__ last_indices, size_type num_ranges,
+    size_type *__restrict__ counts) {
+  constexpr auto const word_size{detail::size_in_bits<bitmask_type>()};
+
+  auto const tid = threadIdx.x + blockIdx.x * blockDim.x;
+  if (tid >= num_ranges) {
+    return;
+  }
+
+  size_type const begin_bit = first_indices[tid];
+  size_type const end_bit = last_indices[tid];
+  if (begin_bit == end_bit) {
+    counts[tid] = 0;
+    return;
+  }
+
+  size_type const first_word = word_index(begin_bit);
+  size_type const last_word = word_index(end_bit - 1);
+
+  auto masked_popc = [&](size_type w) {
+    bitmask_type word = bitmask[w];
+    if (w == first_word) {
+      size_type const slack = intra_word_index(begin_bit);
+      if (slack > 0) {
+        word &= ~set_least_significant_bits(slack);
+      }
+    }
+    if (w == last_word) {
+      size_type const slack = word_size - intra_word_index(end_bit - 1) - 1;
+      if (slack > 0) {
+        word &= ~set_most_significant_bits(slack);
+      }
+    }
+    return static_cast<size_type>(__popc(word));
+  };
+
+  size_type const first_block = first_word / popcount_index_words_per_block;
+  size_type const last_block = last_word / popcount_index_words_per_block;
+
+  size_type count{0};
+
+  // words of the first partial block
+  size_type const head_end =
+      (last_block == first_block)
+          ? last_word
+          : (first_block + 1) * popcount_index_words_per_block - 1;
+  for (size_type w = first_word; w <= head_end; ++w) {
+    count += masked_popc(w);
+  }
+
+  if (last_block > first_block) {
+    // whole blocks between the edges come straight from the running totals
+    count += block_prefix[last_block] - block_prefix[first_block + 1];
+
+    // words of the last partial block
+    for (size_type w = last_block * popcount_index_words_per_block;
+         w <= last_word; ++w) {
+      count += masked_popc(w);
+    }
+  }
+
+  counts[tid] = count;
+}
+
+}  // namespace
+
+popcount_index::popcount_index(bitmask_type const *bitmask, size_type num_bits,
+                               cudaStream_t stream,
+                               rmm::mr::device_memory_resource *mr)
+    : _bitmask{bitmask}, _num_bits{num_bits} {
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(bitmask != nullptr, "Invalid bitmask.");
+  CUDF_EXPECTS(num_bits >= 0, "Invalid bit count.");
+
+  auto const num_words = num_bitmask_words(num_bits);
+  auto const num_blocks = cudf::util::div_rounding_up_safe(
+      num_words, popcount_index_words_per_block);
+
+  // prefix[b] holds the set bits in words [0, b * words_per_block)
+  _block_prefix =
+      rmm::device_buffer{(num_blocks + 1) * sizeof(size_type), stream, mr};
+  auto prefix = static_cast<size_type *>(_block_prefix.data());
+  CUDA_TRY(cudaMemsetAsync(prefix, 0, sizeof(size_type), stream));
+
+  if (num_blocks == 0) {
+    return;
+  }
+
+  rmm::device_vector<size_type> block_counts(num_blocks);
+  thrust::tabulate(
+      rmm::exec_policy(stream)->on(stream), block_counts.begin(),
+      block_counts.end(), [bitmask, num_words] __device__(size_type block) {
+        size_type const first = block * popcount_index_words_per_block;
+        size_type last = first + popcount_index_words_per_block;
+        last = (last < num_words) ? last : num_words;
+        size_type count{0};
+        for (size_type w = first; w < last; ++w) {
+          count += __popc(bitmask[w]);
+        }
+        return count;
+      });
+
+  thrust::inclusive_scan(rmm::exec_policy(stream)->on(stream),
+                         block_counts.begin(), block_counts.end(), prefix + 1);
+  CHECK_CUDA(stream);
+}
+
+std::vector<size_type> popcount_index::segmented_count_set_bits(
+    std::vector<cudf::size_type> const &indices, cudaStream_t stream) const {
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(indices.size() % 2 == 0,
+               "Array of indices needs to have an even number of elements.");
+  for (size_t i = 0; i < indices.size() / 2; i++) {
+    auto begin = indices[i * 2];
+    auto end = indices[i * 2 + 1];
+    CUDF_EXPECTS(begin >= 0, "Starting index cannot be negative.");
+    CUDF_EXPECTS(end >= begin,
+                 "End index cannot be smaller than the starting index.");
+    CUDF_EXPECTS(end <= _num_bits, "Index range exceeds the indexed bits.");
+  }
+
+  if (indices.size() == 0) {
+    return std::vector<size_type>{};
+  }
+
+  size_type num_ranges = indices.size() / 2;
+  thrust::host_vector<size_type> h_first_indices(num_ranges);
+  thrust::host_vector<size_type> h_last_indices(num_ranges);
+  thrust::stable_partition_copy(
+      thrust::seq, std::begin(indices), std::end(indices),
+      thrust::make_counting_iterator(0), h_first_indices.begin(),
+      h_last_indices.begin(), [](auto i) { return (i % 2) == 0; });
+
+  rmm::device_vector<size_type> d_first_indices = h_first_indices;
+  rmm::device_vector<size_type> d_last_indices = h_last_indices;
+  rmm::device_vector<size_type> d_counts(num_ranges);
+
+  constexpr size_type block_size{256};
+  cudf::experimental::detail::grid_1d grid(num_ranges, block_size);
+
+  indexed_segmented_count_kernel<<<grid.num_blocks,
+                                   grid.num_threads_per_block, 0, stream>>>(
+      _bitmask, static_cast<size_type const *>(_block_prefix.data()),
+      d_first_indices.data().get(), d_last_indices.data().get(), num_ranges,
+      d_counts.data().get());
+
+  CHECK_CUDA(stream);
+
+  std::vector<size_type> ret(num_ranges);
+  CUDA_TRY(cudaMemcpyAsync(ret.data(), d_counts.data().get(),
+                           num_ranges * sizeof(size_type),
+                           cudaMemcpyDeviceToHost, stream));
+
+  CUDA_TRY(cudaStreamSynchronize(stream));  // now ret is valid.
+
+  return ret;
+}
+
+std::vector<size_type> popcount_index::segmented_count_unset_bits(
+    std::vector<cudf::size_type> const &indices, cudaStream_t stream) const {
+  auto ret = segmented_count_set_bits(indices, stream);
+  for (size_t i = 0; i < ret.size(); i++) {
+    auto begin = indices[i * 2];
+    auto end = indices[i * 2 + 1];
+    ret[i] = (end - begin) - ret[i];
+  }
+  return ret;
+}
+
+cudf::size_type popcount_index::count_set_bits(size_type start, size_type stop,
+                                               cudaStream_t stream) const {
+  return segmented_count_set_bits({start, stop}, stream)[0];
+}
+
+cudf::size_type popcount_index::count_unset_bits(size_type start,
+                                                 size_type stop,
+                                                 cudaStream_t stream) const {
+  return (stop - start) - count_set_bits(start, stop, stream);
+}
+
 // Count non-zero bits in the specified range
 cudf::size_type count_set_bits(bitmask_type const *bitmask, size_type start,
                                size_type stop) {
@@ -670,8 +935,32 @@ rmm::device_buffer bitmask_and(table_view const& view,
   if (masks.size() > 0) {
     return bitmask_and(masks, offsets, view.num_rows(), stream, mr);
   }
-  
+
   return null_mask;
 }
 
+// Returns the bitwise OR of the null masks of all columns in the table view
+rmm::device_buffer bitmask_or(table_view const& view,
+                              rmm::mr::device_memory_resource *mr,
+                              cudaStream_t stream) {
+  CUDF_FUNC_RANGE();
+  rmm::device_buffer null_mask{};
+  if (view.num_rows() == 0 or view.num_columns() == 0) {
+    return null_mask;
+  }
+
+  std::vector<bitmask_type const*> masks;
+  std::vector<size_type> offsets;
+  for (auto &&col : view) {
+    if (not col.nullable()) {
+      // a non-nullable column is all valid, so the OR is all valid
+      return null_mask;
+    }
+    masks.push_back(col.null_mask());
+    offsets.push_back(col.offset());
+  }
+
+  return bitmask_or(masks, offsets, view.num_rows(), stream, mr);
+}
+
 }  // namespace cudf
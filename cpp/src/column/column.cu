@@ -22,6 +22,7 @@
 #include <cudf/utilities/type_dispatcher.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/strings/copying.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 
@@ -40,7 +41,8 @@ column::column(column const &other)
       _size{other._size},
       _data{other._data},
       _null_mask{other._null_mask},
-      _null_count{other._null_count} {
+      _null_count{other._null_count},
+      _ordering{other._ordering} {
   _children.reserve(other.num_children());
   for (auto const &c : other._children) {
     _children.emplace_back(std::make_unique<column>(*c));
@@ -54,7 +56,8 @@ column::column(column const &other, cudaStream_t stream,
       _size{other._size},
       _data{other._data, stream, mr},
       _null_mask{other._null_mask, stream, mr},
-      _null_count{other._null_count} {
+      _null_count{other._null_count},
+      _ordering{other._ordering} {
   _children.reserve(other.num_children());
   for (auto const &c : other._children) {
     _children.emplace_back(std::make_unique<column>(*c, stream, mr));
@@ -68,10 +71,12 @@ column::column(column &&other) noexcept
       _data{std::move(other._data)},
       _null_mask{std::move(other._null_mask)},
       _null_count{other._null_count},
+      _ordering{other._ordering},
       _children{std::move(other._children)} {
   other._size = 0;
   other._null_count = 0;
   other._type = data_type{EMPTY};
+  other._ordering = order_metadata{};
 }
 
 // Release contents
@@ -94,11 +99,13 @@ column_view column::view() const {
     child_views.emplace_back(*c);
   }
 
-  return column_view{
+  column_view result{
       type(),       size(),
       _data.data(), static_cast<bitmask_type const *>(_null_mask.data()),
       null_count(), 0,
       child_views};
+  result.set_ordering(_ordering);
+  return result;
 }
 
 // Create mutable view
@@ -116,8 +123,9 @@ mutable_column_view column::mutable_view() {
   // The elements of a column could be changed through a `mutable_column_view`,
   // therefore the existing `null_count` is no longer valid. Reset it to
   // `UNKNOWN_NULL_COUNT` forcing it to be recomputed on the next invocation of
-  // `null_count()`.
+  // `null_count()`. Any known ordering is invalidated for the same reason.
   set_null_count(cudf::UNKNOWN_NULL_COUNT);
+  _ordering = order_metadata{};
 
   return mutable_column_view{type(),
                              size(),
@@ -132,8 +140,14 @@ mutable_column_view column::mutable_view() {
 size_type column::null_count() const {
   CUDF_FUNC_RANGE();
   if (_null_count <= cudf::UNKNOWN_NULL_COUNT) {
-    _null_count = cudf::count_unset_bits(
-        static_cast<bitmask_type const *>(_null_mask.data()), 0, size());
+    // a column without a mask cannot contain nulls; don't launch a count
+    // kernel just to find that out
+    if (_null_mask.size() == 0) {
+      _null_count = 0;
+    } else {
+      _null_count = cudf::count_unset_bits(
+          static_cast<bitmask_type const *>(_null_mask.data()), 0, size());
+    }
   }
   return _null_count;
 }
@@ -186,8 +200,15 @@ struct create_column_from_view {
            std::enable_if_t<std::is_same<ColumnType, cudf::dictionary32>::value>* = nullptr>
  std::unique_ptr<column> operator()() {
    std::vector<std::unique_ptr<column>> children;
-   for (size_type i = 0; i < view.num_children(); ++i)
-     children.emplace_back(std::make_unique<column>(view.child(i), stream, mr));
+   if (view.num_children() > 0) {
+     cudf::dictionary_column_view dview(view);
+     // carve the indices at this view's offset so sliced views copy only
+     // their own rows; the keys are shared by all rows and copied whole
+     column_view indices{dview.indices().type(), view.size(),
+                         dview.indices().head(), nullptr, 0, view.offset()};
+     children.emplace_back(std::make_unique<column>(indices, stream, mr));
+     children.emplace_back(std::make_unique<column>(dview.keys(), stream, mr));
+   }
    return std::make_unique<column>(view.type(), view.size(), rmm::device_buffer{},
                                    cudf::copy_bitmask(view, stream, mr),
                                    view.null_count(), std::move(children));
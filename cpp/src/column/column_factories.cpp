@@ -21,6 +21,7 @@
 #include <cudf/detail/fill.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 
 #include <thrust/iterator/constant_iterator.h>
@@ -77,6 +78,60 @@ std::unique_ptr<column> make_timestamp_column(
       std::vector<std::unique_ptr<column>>{});
 }
 
+// Allocate storage for a whole table of fixed-width columns in one slab
+experimental::contiguous_split_result make_contiguous_table(
+    std::vector<data_type> const& types, size_type size, mask_state state,
+    cudaStream_t stream, rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(std::all_of(types.begin(), types.end(),
+                           [](data_type t) { return is_fixed_width(t); }),
+               "Invalid, non-fixed-width type.");
+
+  // matches the layout alignment of contiguous_split
+  constexpr std::size_t buffer_align = 64;
+
+  bool const has_masks = state != mask_state::UNALLOCATED;
+
+  std::vector<std::size_t> data_offsets(types.size());
+  std::vector<std::size_t> mask_offsets(types.size());
+  std::size_t total = 0;
+  for (std::size_t i = 0; i < types.size(); ++i) {
+    data_offsets[i] = total;
+    total += util::round_up_safe(size * cudf::size_of(types[i]), buffer_align);
+  }
+  std::size_t const masks_begin = total;
+  if (has_masks) {
+    for (std::size_t i = 0; i < types.size(); ++i) {
+      mask_offsets[i] = total;
+      total += bitmask_allocation_size_bytes(size, buffer_align);
+    }
+  }
+
+  auto slab = std::make_unique<rmm::device_buffer>(total, stream, mr);
+  auto base = static_cast<char*>(slab->data());
+
+  if (state == mask_state::ALL_VALID || state == mask_state::ALL_NULL) {
+    // the masks are laid out back to back, so one memset covers them all
+    CUDA_TRY(cudaMemsetAsync(base + masks_begin,
+                             state == mask_state::ALL_VALID ? 0xff : 0x00,
+                             total - masks_begin, stream));
+  }
+
+  auto const null_count = state_null_count(state, size);
+  std::vector<column_view> views;
+  views.reserve(types.size());
+  for (std::size_t i = 0; i < types.size(); ++i) {
+    views.emplace_back(
+        types[i], size, base + data_offsets[i],
+        has_masks ? reinterpret_cast<bitmask_type const*>(base + mask_offsets[i])
+                  : nullptr,
+        null_count);
+  }
+
+  return experimental::contiguous_split_result{table_view{views},
+                                               std::move(slab)};
+}
+
 // Allocate storage for a specified number of fixed width elements
 std::unique_ptr<column> make_fixed_width_column(
     data_type type, size_type size, mask_state state, cudaStream_t stream,
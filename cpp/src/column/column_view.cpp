@@ -61,7 +61,10 @@ column_view_base::column_view_base(data_type type, size_type size,
 // If null count is known, returns it. Else, compute and return it
 size_type column_view_base::null_count() const {
   if (_null_count <= cudf::UNKNOWN_NULL_COUNT) {
-    _null_count = cudf::count_unset_bits(null_mask(), offset(), offset()+size());
+    // a view without a mask cannot contain nulls; skip the count kernel
+    _null_count = (null_mask() == nullptr)
+        ? 0
+        : cudf::count_unset_bits(null_mask(), offset(), offset()+size());
   }
   return _null_count;
 }
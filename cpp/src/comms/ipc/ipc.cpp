@@ -1,4 +1,7 @@
 #include <cudf/ipc.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <limits>
 
 CudaMessageReader::CudaMessageReader(arrow::cuda::CudaBufferReader* stream,
                                      arrow::io::BufferReader* schema)
@@ -19,3 +22,98 @@ std::unique_ptr<arrow::ipc::MessageReader> CudaMessageReader::Open(arrow::cuda::
                                                                    arrow::io::BufferReader* schema) {
     return std::unique_ptr<arrow::ipc::MessageReader>(new CudaMessageReader(stream, schema));
 }
+
+namespace cudf {
+namespace ipc {
+namespace {
+
+data_type arrow_to_cudf_type(arrow::DataType const& type) {
+    switch (type.id()) {
+        case arrow::Type::INT8: return data_type{INT8};
+        case arrow::Type::INT16: return data_type{INT16};
+        case arrow::Type::INT32: return data_type{INT32};
+        case arrow::Type::INT64: return data_type{INT64};
+        case arrow::Type::FLOAT: return data_type{FLOAT32};
+        case arrow::Type::DOUBLE: return data_type{FLOAT64};
+        case arrow::Type::DATE32: return data_type{TIMESTAMP_DAYS};
+        case arrow::Type::TIMESTAMP:
+            switch (static_cast<arrow::TimestampType const&>(type).unit()) {
+                case arrow::TimeUnit::SECOND: return data_type{TIMESTAMP_SECONDS};
+                case arrow::TimeUnit::MILLI: return data_type{TIMESTAMP_MILLISECONDS};
+                case arrow::TimeUnit::MICRO: return data_type{TIMESTAMP_MICROSECONDS};
+                case arrow::TimeUnit::NANO: return data_type{TIMESTAMP_NANOSECONDS};
+            }
+            CUDF_FAIL("Unsupported Arrow timestamp unit");
+        case arrow::Type::STRING: return data_type{STRING};
+        // BOOL is bit-packed in Arrow and cannot alias BOOL8
+        default: CUDF_FAIL("Arrow type has no zero-copy libcudf equivalent");
+    }
+}
+
+bitmask_type const* validity_of(arrow::ArrayData const& data, size_type num_bits) {
+    if (data.buffers[0] == nullptr) return nullptr;
+    CUDF_EXPECTS(data.buffers[0]->size() >= (num_bits + 7) / 8,
+                 "Arrow validity buffer too small for declared length");
+    return reinterpret_cast<bitmask_type const*>(data.buffers[0]->data());
+}
+
+column_view import_column(arrow::Array const& array) {
+    auto const& data = *array.data();
+    auto const type = arrow_to_cudf_type(*array.type());
+    CUDF_EXPECTS(array.length() + array.offset() <=
+                     std::numeric_limits<size_type>::max(),
+                 "Arrow column too large for a column_view");
+    auto const length = static_cast<size_type>(array.length());
+    auto const offset = static_cast<size_type>(array.offset());
+    auto const null_count = (data.null_count == arrow::kUnknownNullCount)
+                                ? UNKNOWN_NULL_COUNT
+                                : static_cast<size_type>(data.null_count);
+    auto const null_mask = validity_of(data, offset + length);
+    CUDF_EXPECTS(null_count <= 0 || null_mask != nullptr,
+                 "Arrow column declares nulls but has no validity buffer");
+
+    if (type.id() == STRING) {
+        CUDF_EXPECTS(data.buffers.size() == 3 && data.buffers[1] != nullptr,
+                     "Arrow string column missing offsets buffer");
+        auto const num_offsets = offset + length + 1;
+        CUDF_EXPECTS(data.buffers[1]->size() >=
+                         num_offsets * static_cast<int64_t>(sizeof(int32_t)),
+                     "Arrow offsets buffer too small for declared length");
+        column_view offsets{data_type{INT32}, num_offsets,
+                            data.buffers[1]->data()};
+        auto const chars_size =
+            (data.buffers[2] == nullptr)
+                ? 0
+                : static_cast<size_type>(data.buffers[2]->size());
+        column_view chars{data_type{INT8}, chars_size,
+                          (data.buffers[2] == nullptr)
+                              ? nullptr
+                              : data.buffers[2]->data()};
+        return column_view{type,      length,     nullptr, null_mask,
+                           null_count, offset, {offsets, chars}};
+    }
+
+    CUDF_EXPECTS(data.buffers.size() >= 2 && data.buffers[1] != nullptr,
+                 "Arrow column missing data buffer");
+    auto const element_bytes =
+        static_cast<arrow::FixedWidthType const&>(*array.type()).bit_width() / 8;
+    CUDF_EXPECTS(data.buffers[1]->size() >=
+                     static_cast<int64_t>(offset + length) * element_bytes,
+                 "Arrow data buffer too small for declared length");
+    return column_view{type, length, data.buffers[1]->data(), null_mask,
+                       null_count, offset};
+}
+
+}  // namespace
+
+imported_table::imported_table(std::shared_ptr<arrow::RecordBatch> batch)
+    : _batch(std::move(batch)) {
+    CUDF_EXPECTS(_batch != nullptr, "Parameter batch must not be null");
+    _columns.reserve(_batch->num_columns());
+    for (int idx = 0; idx < _batch->num_columns(); idx++) {
+        _columns.push_back(import_column(*_batch->column(idx)));
+    }
+}
+
+}  // namespace ipc
+}  // namespace cudf
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/ipc_cache.hpp>
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+namespace cudf {
+namespace ipc {
+
+namespace {
+
+// cudaIpcMemHandle_t is an opaque byte blob; its raw bytes are the only
+// stable identity we can key a map on
+std::string handle_key(cudaIpcMemHandle_t const& handle) {
+  return std::string(reinterpret_cast<char const*>(&handle), sizeof(handle));
+}
+
+}  // namespace
+
+export_cache& export_cache::instance() {
+  static export_cache cache;
+  return cache;
+}
+
+cudaIpcMemHandle_t export_cache::get_handle(void const* ptr) {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  auto it = _handles.find(ptr);
+  if (it != _handles.end()) {
+    return it->second;
+  }
+
+  cudaIpcMemHandle_t handle;
+  CUDA_TRY(cudaIpcGetMemHandle(&handle, const_cast<void*>(ptr)));
+  _handles.emplace(ptr, handle);
+  return handle;
+}
+
+std::vector<exported_buffer> export_cache::export_table(
+    table_view const& input) {
+  std::vector<exported_buffer> buffers;
+  buffers.reserve(2 * input.num_columns());
+
+  for (auto const& col : input) {
+    CUDF_EXPECTS(is_fixed_width(col.type()),
+                 "Only fixed-width columns can be exported");
+
+    size_t const width = size_of(col.type());
+    buffers.push_back({get_handle(col.head()),
+                       col.offset() * width,
+                       col.size() * width});
+
+    if (col.null_mask() != nullptr) {
+      // the mask is exported whole; the consumer applies the view's bit
+      // offset when rebuilding the column
+      buffers.push_back(
+          {get_handle(col.null_mask()), 0,
+           bitmask_allocation_size_bytes(col.offset() + col.size())});
+    }
+  }
+
+  return buffers;
+}
+
+void export_cache::evict(void const* ptr) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _handles.erase(ptr);
+}
+
+void export_cache::clear() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _handles.clear();
+}
+
+import_cache& import_cache::instance() {
+  static import_cache cache;
+  return cache;
+}
+
+void* import_cache::open(cudaIpcMemHandle_t const& handle) {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  auto const key = handle_key(handle);
+  auto it = _mappings.find(key);
+  if (it != _mappings.end()) {
+    it->second.refcount++;
+    return it->second.ptr;
+  }
+
+  void* ptr = nullptr;
+  CUDA_TRY(cudaIpcOpenMemHandle(&ptr, handle, cudaIpcMemLazyEnablePeerAccess));
+  _mappings.emplace(key, mapping{ptr, 1});
+  _keys.emplace(ptr, key);
+  return ptr;
+}
+
+void import_cache::close(void* ptr) {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  auto key_it = _keys.find(ptr);
+  CUDF_EXPECTS(key_it != _keys.end(),
+               "Pointer was not opened through the import cache");
+
+  auto& entry = _mappings.at(key_it->second);
+  if (--entry.refcount == 0) {
+    CUDA_TRY(cudaIpcCloseMemHandle(entry.ptr));
+    _mappings.erase(key_it->second);
+    _keys.erase(key_it);
+  }
+}
+
+}  // namespace ipc
+}  // namespace cudf
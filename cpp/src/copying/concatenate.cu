@@ -22,6 +22,7 @@
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/strings/detail/concatenate.hpp>
+#include <cudf/utilities/traits.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 
 #include <thrust/binary_search.h>
@@ -178,6 +179,11 @@ struct for_each_concatenate {
     if (col->nullable()) {
       cudf::detail::concatenate_masks(views,
           (col->mutable_view()).null_mask(), stream);
+      // the inputs' null counts are already known; summing them saves the
+      // recount that the mutable view above would otherwise force
+      col->set_null_count(std::accumulate(views.cbegin(), views.cend(),
+          size_type{0},
+          [](auto sum, auto const& v) { return sum + v.null_count(); }));
     }
 
     return col;
@@ -221,6 +227,10 @@ struct for_each_concatenate {
     if (col->nullable()) {
       cudf::detail::concatenate_masks(views,
           (col->mutable_view()).null_mask(), stream);
+      // propagate the known input null counts rather than recounting later
+      col->set_null_count(std::accumulate(views.cbegin(), views.cend(),
+          size_type{0},
+          [](auto sum, auto const& v) { return sum + v.null_count(); }));
     }
 
     return col;
@@ -409,10 +419,223 @@ concatenate(std::vector<column_view> const& columns_to_concat,
 }
 
 namespace experimental {
+namespace detail {
+namespace {
+
+// below this many columns the per-column fused kernel is cheap enough; above
+// it, launch overhead dominates the copies and the batched kernel pays off
+constexpr size_type batched_concatenate_min_columns = 32;
+
+/**
+ * @brief Concatenates the data of every column of a batch of tables in a
+ * single launch.
+ *
+ * One y-block per output column, x-blocks grid-striding over the output rows.
+ * All columns of a table share the same row count, so a single `input_offsets`
+ * array locates the source partition for every column. Data is copied
+ * bytewise using each column's element size, which keeps one kernel valid for
+ * any mix of fixed-width types.
+ */
+__global__ void batched_concatenate_kernel(
+    column_device_view const* input_views,   // column-major: [column][table]
+    size_type const* input_offsets,
+    size_type num_input_views,
+    mutable_column_device_view* output_views,
+    size_type const* element_sizes) {
+  auto const column_index = blockIdx.y;
+  auto const output_size = input_offsets[num_input_views];
+  auto const element_size = element_sizes[column_index];
+  auto const* column_views = input_views + column_index * num_input_views;
+  auto* output_data = output_views[column_index].head<char>();
+
+  size_type output_index = threadIdx.x + blockIdx.x * blockDim.x;
+  while (output_index < output_size) {
+    auto const offset_it = -1 +
+        thrust::upper_bound(thrust::seq, input_offsets,
+                            input_offsets + num_input_views, output_index);
+    size_type const partition_index = offset_it - input_offsets;
+
+    auto const& input_view = column_views[partition_index];
+    char const* input_data = input_view.head<char>() +
+        (input_view.offset() + output_index - *offset_it) * element_size;
+    char* out = output_data + output_index * element_size;
+    for (size_type b = 0; b < element_size; b++) { out[b] = input_data[b]; }
+
+    output_index += blockDim.x * gridDim.x;
+  }
+}
+
+/**
+ * @brief Concatenates the null masks of every nullable output column of a
+ * batch of tables in a single launch, accumulating per-column valid counts.
+ *
+ * One y-block per nullable output column; the body matches
+ * `concatenate_masks_kernel` with the addition of the valid count reduction
+ * from `fused_concatenate_kernel`.
+ */
+template <size_type block_size>
+__global__ void batched_concatenate_masks_kernel(
+    column_device_view const* input_views,   // column-major: [column][table]
+    size_type const* input_offsets,
+    size_type num_input_views,
+    size_type const* nullable_columns,
+    bitmask_type** dest_masks,
+    size_type* valid_counts,
+    size_type number_of_mask_bits) {
+  auto const* column_views =
+      input_views + nullable_columns[blockIdx.y] * num_input_views;
+  bitmask_type* dest_mask = dest_masks[blockIdx.y];
+  size_type warp_valid_count = 0;
+
+  size_type mask_index = threadIdx.x + blockIdx.x * blockDim.x;
+  auto active_mask =
+      __ballot_sync(0xFFFF'FFFF, mask_index < number_of_mask_bits);
+  while (mask_index < number_of_mask_bits) {
+    size_type const source_view_index = thrust::upper_bound(thrust::seq,
+        input_offsets, input_offsets + num_input_views,
+        mask_index) - input_offsets - 1;
+    bool bit_is_set = 1;
+    if (source_view_index < num_input_views) {
+      size_type const column_element_index =
+          mask_index - input_offsets[source_view_index];
+      bit_is_set = column_views[source_view_index].is_valid(column_element_index);
+    }
+    bitmask_type const new_word = __ballot_sync(active_mask, bit_is_set);
+
+    if (threadIdx.x % experimental::detail::warp_size == 0) {
+      dest_mask[word_index(mask_index)] = new_word;
+    }
+    warp_valid_count += __popc(new_word);
+
+    mask_index += blockDim.x * gridDim.x;
+    active_mask =
+        __ballot_sync(active_mask, mask_index < number_of_mask_bits);
+  }
+
+  auto block_valid_count =
+      single_lane_block_sum_reduce<block_size, 0>(warp_valid_count);
+  if (threadIdx.x == 0) {
+    atomicAdd(valid_counts + blockIdx.y, block_valid_count);
+  }
+}
+
+// Concatenates a batch of all-fixed-width tables, one data kernel and (if
+// needed) one mask kernel for the whole table instead of a launch per column
+std::unique_ptr<table> batched_concatenate(
+    std::vector<table_view> const& tables_to_concat,
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream) {
+
+  auto const num_views = static_cast<size_type>(tables_to_concat.size());
+  auto const num_columns = tables_to_concat.front().num_columns();
+
+  // row offsets are shared by every column of the batch
+  auto offsets = thrust::host_vector<size_type>(num_views + 1);
+  offsets[0] = 0;
+  for (size_type i = 0; i < num_views; ++i) {
+    offsets[i + 1] = offsets[i] + tables_to_concat[i].num_rows();
+  }
+  auto const d_offsets = rmm::device_vector<size_type>{offsets};
+  auto const output_size = offsets.back();
+
+  // column-major array of device views: all of column 0's pieces, then
+  // column 1's, and so on
+  using CDViewPtr = decltype(column_device_view::create(
+      std::declval<column_view>(), std::declval<cudaStream_t>()));
+  auto device_view_owners = std::vector<CDViewPtr>{};
+  device_view_owners.reserve(num_columns * num_views);
+  auto device_views = thrust::host_vector<column_device_view>();
+  device_views.reserve(num_columns * num_views);
+  for (size_type i = 0; i < num_columns; ++i) {
+    for (auto const& t : tables_to_concat) {
+      auto owner = column_device_view::create(t.column(i), stream);
+      device_views.push_back(*owner);
+      device_view_owners.push_back(std::move(owner));
+    }
+  }
+  auto const d_views = rmm::device_vector<column_device_view>{device_views};
+
+  // allocate the outputs and collect their device views, element sizes, and
+  // (for nullable columns) destination masks
+  using mask_policy = cudf::experimental::mask_allocation_policy;
+  using MCDViewPtr = decltype(mutable_column_device_view::create(
+      std::declval<mutable_column_view>(), std::declval<cudaStream_t>()));
+  std::vector<std::unique_ptr<column>> output_columns;
+  auto output_view_owners = std::vector<MCDViewPtr>{};
+  auto output_views = thrust::host_vector<mutable_column_device_view>();
+  auto element_sizes = thrust::host_vector<size_type>();
+  auto nullable_columns = thrust::host_vector<size_type>();
+  auto dest_masks = thrust::host_vector<bitmask_type*>();
+  for (size_type i = 0; i < num_columns; ++i) {
+    bool const col_has_nulls = std::any_of(
+        tables_to_concat.begin(), tables_to_concat.end(),
+        [i](auto const& t) { return t.column(i).has_nulls(); });
+    auto col = detail::allocate_like(tables_to_concat.front().column(i),
+        output_size, col_has_nulls ? mask_policy::ALWAYS : mask_policy::NEVER,
+        mr, stream);
+    col->set_null_count(0); // prevent null count from being materialized
+    auto m_view = col->mutable_view();
+    if (col_has_nulls) {
+      nullable_columns.push_back(i);
+      dest_masks.push_back(m_view.null_mask());
+    }
+    auto owner = mutable_column_device_view::create(m_view, stream);
+    output_views.push_back(*owner);
+    output_view_owners.push_back(std::move(owner));
+    element_sizes.push_back(size_of(m_view.type()));
+    output_columns.push_back(std::move(col));
+  }
+  auto d_output_views =
+      rmm::device_vector<mutable_column_device_view>{output_views};
+  auto const d_element_sizes = rmm::device_vector<size_type>{element_sizes};
+
+  // one launch for all columns' data
+  constexpr size_type block_size{256};
+  cudf::experimental::detail::grid_1d config(output_size, block_size);
+  dim3 const grid{static_cast<unsigned int>(config.num_blocks),
+                  static_cast<unsigned int>(num_columns)};
+  batched_concatenate_kernel<<<grid, block_size, 0, stream>>>(
+      d_views.data().get(),
+      d_offsets.data().get(),
+      num_views,
+      d_output_views.data().get(),
+      d_element_sizes.data().get());
+
+  // and one for all nullable columns' masks
+  if (not nullable_columns.empty()) {
+    auto const d_nullable_columns =
+        rmm::device_vector<size_type>{nullable_columns};
+    auto d_dest_masks = rmm::device_vector<bitmask_type*>{dest_masks};
+    rmm::device_vector<size_type> d_valid_counts(nullable_columns.size(), 0);
+    dim3 const mask_grid{
+        static_cast<unsigned int>(config.num_blocks),
+        static_cast<unsigned int>(nullable_columns.size())};
+    batched_concatenate_masks_kernel<block_size>
+        <<<mask_grid, block_size, 0, stream>>>(
+            d_views.data().get(),
+            d_offsets.data().get(),
+            num_views,
+            d_nullable_columns.data().get(),
+            d_dest_masks.data().get(),
+            d_valid_counts.data().get(),
+            output_size);
+
+    auto const valid_counts = thrust::host_vector<size_type>(d_valid_counts);
+    for (size_t i = 0; i < nullable_columns.size(); ++i) {
+      output_columns[nullable_columns[i]]->set_null_count(
+          output_size - valid_counts[i]);
+    }
+  }
+
+  return std::make_unique<table>(std::move(output_columns));
+}
+
+}  // namespace
 
 std::unique_ptr<table>
 concatenate(std::vector<table_view> const& tables_to_concat,
-            rmm::mr::device_memory_resource *mr) {
+            rmm::mr::device_memory_resource *mr,
+            cudaStream_t stream) {
   if (tables_to_concat.size() == 0) { return std::make_unique<table>(); }
 
   table_view const first_table = tables_to_concat.front();
@@ -424,17 +647,35 @@ concatenate(std::vector<table_view> const& tables_to_concat,
                            }),
                "Mismatch in table columns to concatenate.");
 
+  // Tables that are wide enough to be launch-bound take the batched kernels
+  bool const all_fixed_width = std::all_of(
+      first_table.begin(), first_table.end(),
+      [](auto const& col) { return cudf::is_fixed_width(col.type()); });
+  if (all_fixed_width and tables_to_concat.size() > 1 and
+      first_table.num_columns() >= batched_concatenate_min_columns) {
+    return batched_concatenate(tables_to_concat, mr, stream);
+  }
+
   std::vector<std::unique_ptr<column>> concat_columns;
   for (size_type i = 0; i < first_table.num_columns(); ++i) {
     std::vector<column_view> cols;
     for (auto &t : tables_to_concat) {
       cols.emplace_back(t.column(i));
     }
-    concat_columns.emplace_back(cudf::concatenate(cols, mr));
+    concat_columns.emplace_back(cudf::detail::concatenate(cols, mr, stream));
   }
   return std::make_unique<table>(std::move(concat_columns));
 }
 
+}  // namespace detail
+
+std::unique_ptr<table>
+concatenate(std::vector<table_view> const& tables_to_concat,
+            rmm::mr::device_memory_resource *mr) {
+  CUDF_FUNC_RANGE();
+  return detail::concatenate(tables_to_concat, mr, 0);
+}
+
 }  // namespace experimental
 
 }  // namespace cudf
@@ -24,6 +24,8 @@
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 
+#include <cstdint>
+#include <cstring>
 #include <numeric>
 
 namespace cudf {
@@ -431,7 +433,69 @@ contiguous_split_result alloc_and_copy(cudf::table_view const& t, rmm::device_ve
       column_index++;
    });   
    
-   return contiguous_split_result{cudf::table_view{out_cols}, std::move(device_buf)};   
+   return contiguous_split_result{cudf::table_view{out_cols}, std::move(device_buf)};
+}
+
+/**
+ * @brief Fixed-size, pointer-free description of one column of a packed table.
+ *
+ * Buffer locations are stored as offsets relative to the start of the contiguous
+ * data block, so the metadata stays valid wherever the block (or the metadata
+ * itself) is copied - host memory, a file, or another process.
+ */
+struct serialized_column {
+   type_id     type;
+   size_type   size;
+   size_type   null_count;
+   int64_t     data_offset;       // -1 when the column has no data buffer
+   int64_t     null_mask_offset;  // -1 when the column has no null mask
+   size_type   num_children;
+};
+
+/**
+ * @brief Appends the metadata of `col` and, recursively, its children to `metadata`.
+ *
+ * Columns are laid out depth-first, matching the traversal in deserialize_column().
+ */
+void serialize_column(column_view const& col, uint8_t const* base, std::vector<uint8_t>& metadata)
+{
+   serialized_column meta{col.type().id(), col.size(), col.null_count(),
+      col.head<uint8_t>() != nullptr ?
+         static_cast<int64_t>(col.head<uint8_t>() - base) : -1,
+      col.null_mask() != nullptr ?
+         static_cast<int64_t>(reinterpret_cast<uint8_t const*>(col.null_mask()) - base) : -1,
+      col.num_children()};
+   auto const* meta_bytes = reinterpret_cast<uint8_t const*>(&meta);
+   metadata.insert(metadata.end(), meta_bytes, meta_bytes + sizeof(serialized_column));
+
+   for(size_type i = 0; i < col.num_children(); i++){
+      serialize_column(col.child(i), base, metadata);
+   }
+}
+
+/**
+ * @brief Reconstructs the column_view described by the metadata at `cur` over the
+ * data block starting at `base`, advancing `cur` past the column and its children.
+ */
+column_view deserialize_column(uint8_t const*& cur, uint8_t const* base)
+{
+   // memcpy instead of casting the metadata pointer; the caller's buffer carries
+   // no alignment guarantee
+   serialized_column meta;
+   std::memcpy(&meta, cur, sizeof(serialized_column));
+   cur += sizeof(serialized_column);
+
+   std::vector<column_view> children;
+   children.reserve(meta.num_children);
+   for(size_type i = 0; i < meta.num_children; i++){
+      children.push_back(deserialize_column(cur, base));
+   }
+
+   return column_view(data_type{meta.type}, meta.size,
+                      meta.data_offset >= 0 ? base + meta.data_offset : nullptr,
+                      meta.null_mask_offset >= 0 ?
+                         reinterpret_cast<bitmask_type const*>(base + meta.null_mask_offset) : nullptr,
+                      meta.null_count, 0, children);
 }
 
 }; // anonymous namespace
@@ -460,6 +524,44 @@ std::vector<contiguous_split_result> contiguous_split(cudf::table_view const& in
    return result;
 }
 
+packed_columns pack(cudf::table_view const& input,
+                    rmm::mr::device_memory_resource* mr,
+                    cudaStream_t stream)
+{
+   rmm::device_vector<column_split_info> device_split_info(input.num_columns());
+   contiguous_split_result contig = alloc_and_copy(input, device_split_info, mr, stream);
+
+   packed_columns result;
+   result.gpu_data = std::move(contig.all_data);
+   uint8_t const* base = static_cast<uint8_t const*>(result.gpu_data->data());
+
+   int64_t const num_columns = contig.table.num_columns();
+   auto const* count_bytes = reinterpret_cast<uint8_t const*>(&num_columns);
+   result.metadata.insert(result.metadata.end(), count_bytes, count_bytes + sizeof(int64_t));
+   for(auto const& col : contig.table){
+      serialize_column(col, base, result.metadata);
+   }
+
+   return result;
+}
+
+table_view unpack(uint8_t const* metadata, uint8_t const* gpu_data)
+{
+   CUDF_EXPECTS(metadata != nullptr, "Invalid metadata");
+
+   int64_t num_columns = 0;
+   std::memcpy(&num_columns, metadata, sizeof(int64_t));
+   uint8_t const* cur = metadata + sizeof(int64_t);
+
+   std::vector<column_view> columns;
+   columns.reserve(num_columns);
+   for(int64_t i = 0; i < num_columns; i++){
+      columns.push_back(deserialize_column(cur, gpu_data));
+   }
+
+   return table_view{columns};
+}
+
 }; // namespace detail
 
 std::vector<contiguous_split_result> contiguous_split(cudf::table_view const& input,
@@ -468,7 +570,27 @@ std::vector<contiguous_split_result> contiguous_split(cudf::table_view const& in
 {
   CUDF_FUNC_RANGE();
   return cudf::experimental::detail::contiguous_split(input, splits, mr,
-                                                      (cudaStream_t)0);   
+                                                      (cudaStream_t)0);
+}
+
+packed_columns pack(cudf::table_view const& input,
+                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return cudf::experimental::detail::pack(input, mr, (cudaStream_t)0);
+}
+
+table_view unpack(uint8_t const* metadata, uint8_t const* gpu_data)
+{
+  CUDF_FUNC_RANGE();
+  return cudf::experimental::detail::unpack(metadata, gpu_data);
+}
+
+table_view unpack(packed_columns const& input)
+{
+  CUDF_FUNC_RANGE();
+  return cudf::experimental::detail::unpack(
+      input.metadata.data(), static_cast<uint8_t const*>(input.gpu_data->data()));
 }
 
 }; // namespace experimental
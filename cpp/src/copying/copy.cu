@@ -20,6 +20,14 @@
 #include <cudf/strings/string_view.cuh>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/bit.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+#include <thrust/host_vector.h>
+
+#include <vector>
 
 namespace cudf {
 namespace experimental {
@@ -184,34 +192,304 @@ std::unique_ptr<column> copy_if_else( scalar const& lhs, scalar const& rhs, colu
    return copy_if_else(lhs, rhs, !lhs.is_valid(), !rhs.is_valid(), boolean_mask, mr, stream);
 }
 
+namespace {
+
+/**
+ * @brief Device-side descriptor of one column pair processed by the fused
+ *        table-level copy_if_else kernel
+ */
+struct fused_copy_desc {
+   char const* lhs_data;          ///< first lhs element; column offset applied
+   bitmask_type const* lhs_mask;  ///< lhs null mask; null when non-nullable
+   size_type lhs_offset;          ///< element offset into lhs_mask
+   char const* rhs_data;          ///< first rhs element, or the scalar's value
+   bitmask_type const* rhs_mask;  ///< rhs null mask; null when non-nullable
+   bool const* rhs_scalar_valid;  ///< validity bool when rhs is a scalar
+   size_type rhs_offset;          ///< element offset into rhs_mask
+   char* out_data;                ///< first output element
+   bitmask_type* out_mask;        ///< output null mask; null when not nullable
+   int32_t width;                 ///< element width in bytes
+   int32_t rhs_stride;            ///< 1 for a column, 0 to broadcast a scalar
+};
+
+__device__ inline void copy_element(char* dst, char const* src, int32_t width)
+{
+   switch (width) {
+      case 1: *dst = *src; break;
+      case 2: *reinterpret_cast<int16_t*>(dst) = *reinterpret_cast<int16_t const*>(src); break;
+      case 4: *reinterpret_cast<int32_t*>(dst) = *reinterpret_cast<int32_t const*>(src); break;
+      case 8: *reinterpret_cast<int64_t*>(dst) = *reinterpret_cast<int64_t const*>(src); break;
+      default:
+         for (int32_t b = 0; b < width; ++b) { dst[b] = src[b]; }
+   }
+}
+
+/**
+ * @brief Processes every fixed-width column pair of a table-level
+ *        copy_if_else in one pass, reading the selector once per row
+ *
+ * Follows the warp-per-validity-word structure of copy_if_else_kernel; each
+ * warp iteration evaluates the selector for its rows and then applies the
+ * result to all column pairs, so the selector and the row data are each read
+ * exactly once. Per-column valid counts are accumulated in shared memory and
+ * flushed with one atomic per block and column.
+ */
+template <size_type block_size>
+__launch_bounds__(block_size)
+__global__
+void fused_copy_if_else_kernel( fused_copy_desc const* __restrict__ descs,
+                                size_type num_descs,
+                                column_device_view selector,
+                                bool selector_has_nulls,
+                                size_type num_rows,
+                                size_type* __restrict__ valid_counts)
+{
+   extern __shared__ size_type block_valid_counts[];
+   for (size_type c = threadIdx.x; c < num_descs; c += block_size) {
+      block_valid_counts[c] = 0;
+   }
+   __syncthreads();
+
+   const size_type tid = threadIdx.x + blockIdx.x * block_size;
+   const int warp_id = tid / warp_size;
+   const size_type warps_per_grid = gridDim.x * block_size / warp_size;
+   const int lane_id = threadIdx.x % warp_size;
+   const size_type warp_end = cudf::word_index(num_rows - 1);
+
+   size_type warp_cur = warp_id;
+   size_type index = tid;
+   while (warp_cur <= warp_end) {
+      const bool in_range = (index < num_rows);
+      bool f = false;
+      if (in_range) {
+         f = (!selector_has_nulls || selector.is_valid_nocheck(index)) &&
+             selector.element<cudf::experimental::bool8>(index);
+      }
+
+      for (size_type c = 0; c < num_descs; ++c) {
+         auto const& d = descs[c];
+         bool valid = true;
+         if (in_range) {
+            const char* src =
+               f ? d.lhs_data + static_cast<size_t>(index) * d.width
+                 : d.rhs_data + static_cast<size_t>(index) * d.width * d.rhs_stride;
+            copy_element(d.out_data + static_cast<size_t>(index) * d.width, src, d.width);
+            if (d.out_mask != nullptr) {
+               if (f) {
+                  valid = (d.lhs_mask == nullptr) ||
+                          bit_is_set(d.lhs_mask, d.lhs_offset + index);
+               } else if (d.rhs_scalar_valid != nullptr) {
+                  valid = *d.rhs_scalar_valid;
+               } else {
+                  valid = (d.rhs_mask == nullptr) ||
+                          bit_is_set(d.rhs_mask, d.rhs_offset + index);
+               }
+            }
+         }
+         if (d.out_mask != nullptr) {
+            const int warp_mask = __ballot_sync(0xFFFF'FFFF, valid && in_range);
+            if (lane_id == 0) {
+               d.out_mask[warp_cur] = warp_mask;
+               atomicAdd(&block_valid_counts[c], __popc(warp_mask));
+            }
+         }
+      }
+
+      warp_cur += warps_per_grid;
+      index += block_size * gridDim.x;
+   }
+
+   __syncthreads();
+   for (size_type c = threadIdx.x; c < num_descs; c += block_size) {
+      atomicAdd(valid_counts + c, block_valid_counts[c]);
+   }
+}
+
+/**
+ * @brief Returns the device address of a fixed-width scalar's value
+ */
+struct scalar_data_ptr_fn {
+   template <typename T>
+   std::enable_if_t<is_fixed_width<T>(), void const*> operator()(scalar const& s) const {
+      using ScalarType = cudf::experimental::scalar_type_t<T>;
+      return static_cast<ScalarType const&>(s).data();
+   }
+   template <typename T>
+   std::enable_if_t<not is_fixed_width<T>(), void const*> operator()(scalar const& s) const {
+      CUDF_FAIL("Invalid type.");
+   }
+};
+
+// host-side description of one rhs source for the fused table path
+struct fused_rhs_source {
+   column_view column{data_type{EMPTY}, 0, nullptr};
+   scalar const* value = nullptr;
+   bool is_scalar = false;
+};
+
+std::unique_ptr<table> fused_copy_if_else( table_view const& lhs,
+                                           std::vector<fused_rhs_source> const& rhs,
+                                           column_view const& boolean_mask,
+                                           rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+{
+   CUDF_EXPECTS(boolean_mask.type() == data_type(BOOL8), "Boolean mask column must be of type BOOL8");
+   CUDF_EXPECTS(boolean_mask.size() == lhs.num_rows(), "Boolean mask column must be the same size as the tables");
+
+   const size_type num_rows = lhs.num_rows();
+   std::vector<std::unique_ptr<column>> out_columns;
+   out_columns.reserve(lhs.num_columns());
+
+   if (num_rows == 0) {
+      for (size_type i = 0; i < lhs.num_columns(); ++i) {
+         out_columns.push_back(cudf::make_empty_column(lhs.column(i).type()));
+      }
+      return std::make_unique<table>(std::move(out_columns));
+   }
+
+   thrust::host_vector<fused_copy_desc> h_descs;
+   std::vector<size_type> desc_columns;  // output column index of each descriptor
+
+   for (size_type i = 0; i < lhs.num_columns(); ++i) {
+      auto const lhs_col = lhs.column(i);
+      auto const type = lhs_col.type();
+      CUDF_EXPECTS(type == (rhs[i].is_scalar ? rhs[i].value->type() : rhs[i].column.type()),
+                   "Both inputs must be of the same type");
+
+      if (not is_fixed_width(type)) {
+         // non-fixed-width columns take the per-column path
+         out_columns.push_back(rhs[i].is_scalar
+            ? copy_if_else(lhs_col, *rhs[i].value, boolean_mask, mr, stream)
+            : copy_if_else(lhs_col, rhs[i].column, boolean_mask, mr, stream));
+         continue;
+      }
+
+      const bool rhs_nullable = rhs[i].is_scalar ? !rhs[i].value->is_valid(stream)
+                                                 : rhs[i].column.has_nulls();
+      const bool nullable = lhs_col.has_nulls() || rhs_nullable;
+      out_columns.push_back(make_fixed_width_column(type, num_rows,
+         nullable ? mask_state::UNINITIALIZED : mask_state::UNALLOCATED, stream, mr));
+      auto out_view = out_columns.back()->mutable_view();
+
+      fused_copy_desc desc{};
+      desc.width = static_cast<int32_t>(cudf::size_of(type));
+      desc.lhs_data = lhs_col.head<char>() + static_cast<size_t>(lhs_col.offset()) * desc.width;
+      desc.lhs_mask = lhs_col.nullable() ? lhs_col.null_mask() : nullptr;
+      desc.lhs_offset = lhs_col.offset();
+      if (rhs[i].is_scalar) {
+         // broadcast the scalar's device value; no constant column is made
+         desc.rhs_data = static_cast<char const*>(
+            cudf::experimental::type_dispatcher(type, scalar_data_ptr_fn{}, *rhs[i].value));
+         desc.rhs_scalar_valid = rhs[i].value->validity_data();
+         desc.rhs_stride = 0;
+      } else {
+         auto const& rhs_col = rhs[i].column;
+         desc.rhs_data = rhs_col.head<char>() + static_cast<size_t>(rhs_col.offset()) * desc.width;
+         desc.rhs_mask = rhs_col.nullable() ? rhs_col.null_mask() : nullptr;
+         desc.rhs_offset = rhs_col.offset();
+         desc.rhs_stride = 1;
+      }
+      desc.out_data = out_view.head<char>();
+      desc.out_mask = nullable ? out_view.null_mask() : nullptr;
+      h_descs.push_back(desc);
+      desc_columns.push_back(i);
+   }
+
+   if (not h_descs.empty()) {
+      rmm::device_vector<fused_copy_desc> d_descs = h_descs;
+      rmm::device_vector<size_type> d_valid_counts(h_descs.size(), 0);
+      auto selector = column_device_view::create(boolean_mask, stream);
+
+      constexpr size_type block_size = 256;
+      const size_type num_els = cudf::util::round_up_safe(num_rows, warp_size);
+      cudf::experimental::detail::grid_1d grid{num_els, block_size, 1};
+      fused_copy_if_else_kernel<block_size>
+         <<<grid.num_blocks, block_size, h_descs.size() * sizeof(size_type), stream>>>(
+            d_descs.data().get(), static_cast<size_type>(h_descs.size()),
+            *selector, boolean_mask.has_nulls(), num_rows,
+            d_valid_counts.data().get());
+
+      thrust::host_vector<size_type> h_valid_counts = d_valid_counts;
+      for (size_t k = 0; k < h_descs.size(); ++k) {
+         if (h_descs[k].out_mask != nullptr) {
+            out_columns[desc_columns[k]]->set_null_count(num_rows - h_valid_counts[k]);
+         }
+      }
+   }
+
+   return std::make_unique<table>(std::move(out_columns));
+}
+
+}; // namespace anonymous
+
+std::unique_ptr<table> copy_if_else( table_view const& lhs, table_view const& rhs, column_view const& boolean_mask,
+                                     rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+{
+   CUDF_EXPECTS(lhs.num_columns() == rhs.num_columns(), "Both tables must have the same number of columns");
+   CUDF_EXPECTS(lhs.num_rows() == rhs.num_rows(), "Both tables must be of the same size");
+
+   std::vector<fused_rhs_source> sources(lhs.num_columns());
+   for (size_type i = 0; i < lhs.num_columns(); ++i) {
+      sources[i].column = rhs.column(i);
+   }
+   return fused_copy_if_else(lhs, sources, boolean_mask, mr, stream);
+}
+
+std::unique_ptr<table> copy_if_else( table_view const& lhs, std::vector<scalar const*> const& rhs, column_view const& boolean_mask,
+                                     rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+{
+   CUDF_EXPECTS(static_cast<size_t>(lhs.num_columns()) == rhs.size(), "Must provide one scalar for each column");
+
+   std::vector<fused_rhs_source> sources(lhs.num_columns());
+   for (size_type i = 0; i < lhs.num_columns(); ++i) {
+      CUDF_EXPECTS(rhs[i] != nullptr, "Invalid scalar");
+      sources[i].value = rhs[i];
+      sources[i].is_scalar = true;
+   }
+   return fused_copy_if_else(lhs, sources, boolean_mask, mr, stream);
+}
+
 }; // namespace detail
 
 std::unique_ptr<column> copy_if_else( column_view const& lhs, column_view const& rhs, column_view const& boolean_mask,
-                                      rmm::mr::device_memory_resource* mr)
+                                      rmm::mr::device_memory_resource* mr, cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  return detail::copy_if_else(lhs, rhs, boolean_mask, mr, (cudaStream_t)0);   
+  return detail::copy_if_else(lhs, rhs, boolean_mask, mr, stream);
 }
 
 std::unique_ptr<column> copy_if_else( scalar const& lhs, column_view const& rhs, column_view const& boolean_mask,
-                                      rmm::mr::device_memory_resource* mr)
+                                      rmm::mr::device_memory_resource* mr, cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  return detail::copy_if_else(lhs, rhs, boolean_mask, mr, (cudaStream_t)0);   
+  return detail::copy_if_else(lhs, rhs, boolean_mask, mr, stream);
 }
 
 std::unique_ptr<column> copy_if_else( column_view const& lhs, scalar const& rhs, column_view const& boolean_mask,
-                                      rmm::mr::device_memory_resource* mr)
+                                      rmm::mr::device_memory_resource* mr, cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  return detail::copy_if_else(lhs, rhs, boolean_mask, mr, (cudaStream_t)0);   
+  return detail::copy_if_else(lhs, rhs, boolean_mask, mr, stream);
 }
 
 std::unique_ptr<column> copy_if_else( scalar const& lhs, scalar const& rhs, column_view const& boolean_mask,
-                                      rmm::mr::device_memory_resource* mr)
+                                      rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::copy_if_else(lhs, rhs, boolean_mask, mr, stream);
+}
+
+std::unique_ptr<table> copy_if_else( table_view const& lhs, table_view const& rhs, column_view const& boolean_mask,
+                                     rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::copy_if_else(lhs, rhs, boolean_mask, mr, stream);
+}
+
+std::unique_ptr<table> copy_if_else( table_view const& lhs, std::vector<scalar const*> const& rhs, column_view const& boolean_mask,
+                                     rmm::mr::device_memory_resource* mr, cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  return detail::copy_if_else(lhs, rhs, boolean_mask, mr, (cudaStream_t)0);
+  return detail::copy_if_else(lhs, rhs, boolean_mask, mr, stream);
 }
 
 } // namespace experimental
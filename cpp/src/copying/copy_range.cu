@@ -23,16 +23,23 @@
 #include <cudf/detail/copy_range.cuh>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/strings/detail/copy_range.cuh>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+#include <thrust/host_vector.h>
 #include <thrust/iterator/constant_iterator.h>
 
 #include <cuda_runtime.h>
 
 #include <memory>
+#include <vector>
 
 namespace {
 
@@ -150,6 +157,52 @@ struct out_of_place_copy_range_dispatch {
   }
 };
 
+/**
+ * @brief Copies the range of every source column into the preallocated target
+ * columns in a single launch.
+ *
+ * One y-block per column, x-blocks grid-striding over the range rows. All
+ * columns share the same range descriptor, so a 50-column window shift costs
+ * one launch instead of 50. Validity bits are updated in the same pass via
+ * the atomic bit setters.
+ */
+template <bool has_validity>
+__global__ void batched_copy_range_kernel(
+    cudf::column_device_view const* source_views,
+    cudf::mutable_column_device_view* target_views,
+    cudf::size_type const* element_sizes,
+    cudf::size_type source_begin,
+    cudf::size_type target_begin,
+    cudf::size_type num_range_rows)
+{
+  auto const column_index = blockIdx.y;
+  auto const& source = source_views[column_index];
+  auto const& target = target_views[column_index];
+  auto const element_size = element_sizes[column_index];
+  char const* source_data = source.head<char>();
+  char* target_data = target.head<char>();
+
+  cudf::size_type row = threadIdx.x + blockIdx.x * blockDim.x;
+  while (row < num_range_rows) {
+    auto const src_row = source_begin + row;
+    auto const dst_row = target_begin + row;
+
+    char const* src = source_data + (source.offset() + src_row) * element_size;
+    char* dst = target_data + dst_row * element_size;
+    for (cudf::size_type b = 0; b < element_size; b++) { dst[b] = src[b]; }
+
+    if (has_validity and target.nullable()) {
+      if (source.is_valid(src_row)) {
+        target.set_valid(dst_row);
+      } else {
+        target.set_null(dst_row);
+      }
+    }
+
+    row += blockDim.x * gridDim.x;
+  }
+}
+
 }
 
 namespace cudf {
@@ -181,6 +234,75 @@ void copy_range_in_place(column_view const& source, mutable_column_view& target,
   }
 }
 
+void copy_range_in_place(table_view const& source, mutable_table_view& target,
+                         size_type source_begin, size_type source_end,
+                         size_type target_begin,
+                         cudaStream_t stream) {
+  CUDF_EXPECTS(source.num_columns() == target.num_columns(),
+               "Number of columns mismatch.");
+  CUDF_EXPECTS((source_begin >= 0) &&
+               (source_end <= source.num_rows()) &&
+               (source_begin <= source_end) &&
+               (target_begin >= 0) &&
+               (target_begin <= target.num_rows() - (source_end - source_begin)),
+               "Range is out of bounds.");
+  bool has_validity = false;
+  for (size_type i = 0; i < source.num_columns(); ++i) {
+    CUDF_EXPECTS(cudf::is_fixed_width(target.column(i).type()),
+                 "In-place copy_range does not support variable-sized types.");
+    CUDF_EXPECTS(target.column(i).type() == source.column(i).type(),
+                 "Data type mismatch.");
+    CUDF_EXPECTS(target.column(i).nullable() ||
+                 (source.column(i).has_nulls() == false),
+                 "target should be nullable if source has null values.");
+    has_validity = has_validity or target.column(i).nullable();
+  }
+
+  auto const num_range_rows = source_end - source_begin;
+  if (num_range_rows == 0) { return; }  // no-op
+
+  // Batch the views of all columns so one launch covers the whole table
+  using CDViewPtr = decltype(column_device_view::create(
+      std::declval<column_view>(), std::declval<cudaStream_t>()));
+  using MCDViewPtr = decltype(mutable_column_device_view::create(
+      std::declval<mutable_column_view>(), std::declval<cudaStream_t>()));
+  auto source_view_owners = std::vector<CDViewPtr>{};
+  auto target_view_owners = std::vector<MCDViewPtr>{};
+  auto source_views = thrust::host_vector<column_device_view>();
+  auto target_views = thrust::host_vector<mutable_column_device_view>();
+  auto element_sizes = thrust::host_vector<size_type>();
+  for (size_type i = 0; i < source.num_columns(); ++i) {
+    auto source_owner = column_device_view::create(source.column(i), stream);
+    auto target_owner =
+        mutable_column_device_view::create(target.column(i), stream);
+    source_views.push_back(*source_owner);
+    target_views.push_back(*target_owner);
+    source_view_owners.push_back(std::move(source_owner));
+    target_view_owners.push_back(std::move(target_owner));
+    element_sizes.push_back(size_of(source.column(i).type()));
+  }
+  auto const d_source_views =
+      rmm::device_vector<column_device_view>{source_views};
+  auto d_target_views =
+      rmm::device_vector<mutable_column_device_view>{target_views};
+  auto const d_element_sizes = rmm::device_vector<size_type>{element_sizes};
+
+  constexpr size_type block_size = 256;
+  cudf::experimental::detail::grid_1d config(num_range_rows, block_size);
+  dim3 const grid{static_cast<unsigned int>(config.num_blocks),
+                  static_cast<unsigned int>(source.num_columns())};
+  auto const kernel = has_validity
+      ? batched_copy_range_kernel<true>
+      : batched_copy_range_kernel<false>;
+  kernel<<<grid, block_size, 0, stream>>>(
+      d_source_views.data().get(),
+      d_target_views.data().get(),
+      d_element_sizes.data().get(),
+      source_begin, target_begin, num_range_rows);
+
+  CHECK_CUDA(stream);
+}
+
 std::unique_ptr<column> copy_range(column_view const& source,
                                    column_view const& target,
                                    size_type source_begin, size_type source_end,
@@ -211,14 +333,24 @@ void copy_range_in_place(column_view const& source, mutable_column_view& target,
                                      target_begin, 0);
 }
 
+void copy_range_in_place(table_view const& source, mutable_table_view& target,
+                         size_type source_begin, size_type source_end,
+                         size_type target_begin,
+                         cudaStream_t stream) {
+  CUDF_FUNC_RANGE();
+  return detail::copy_range_in_place(source, target, source_begin, source_end,
+                                     target_begin, stream);
+}
+
 std::unique_ptr<column> copy_range(column_view const& source,
                                    column_view const& target,
                                    size_type source_begin, size_type source_end,
                                    size_type target_begin,
-                                   rmm::mr::device_memory_resource* mr) {
+                                   rmm::mr::device_memory_resource* mr,
+                                   cudaStream_t stream) {
   CUDF_FUNC_RANGE();
   return detail::copy_range(source, target, source_begin, source_end,
-                            target_begin, mr, 0);
+                            target_begin, mr, stream);
 }
 
 }  // namespace experimental
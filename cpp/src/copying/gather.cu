@@ -1,5 +1,6 @@
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/gather.hpp>
+#include <cudf/detail/unary.hpp>
 #include <cudf/types.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
@@ -11,8 +12,12 @@
 
 #include <rmm/thrust_rmm_allocator.h>
 #include <thrust/count.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 
+#include <iterator>
 #include <memory>
+#include <vector>
 
 
 namespace cudf {
@@ -91,10 +96,27 @@ std::unique_ptr<table> gather(table_view const& source_table, column_view const&
 
   CUDF_EXPECTS(gather_map.has_nulls() == false, "gather_map contains nulls");
 
+  // Planners frequently hand us INT64 maps; when every index fits a narrower
+  // type, one conversion pass is cheaper than re-reading the wide map for
+  // every column. Narrowing is safe only for maps known to be in bounds,
+  // since an out-of-range index could wrap into the valid range and defeat
+  // the bounds checks below.
+  std::unique_ptr<column> narrowed_map;
+  column_view map_view = gather_map;
+  if (not check_bounds and not ignore_out_of_bounds and
+      source_table.num_columns() > 1) {
+    auto const narrow_type = narrowest_map_type(source_table.num_rows());
+    if (cudf::size_of(gather_map.type()) > cudf::size_of(narrow_type)) {
+      narrowed_map = experimental::detail::cast(
+	  gather_map, narrow_type, rmm::mr::get_default_resource(), stream);
+      map_view = narrowed_map->view();
+    }
+  }
+
   std::unique_ptr<table> destination_table =
-    cudf::experimental::type_dispatcher(gather_map.type(), dispatch_map_type{},
-					source_table, gather_map,
-					gather_map.size(),
+    cudf::experimental::type_dispatcher(map_view.type(), dispatch_map_type{},
+					source_table, map_view,
+					map_view.size(),
 					check_bounds, ignore_out_of_bounds,
 					allow_negative_indices,
 					mr,
@@ -103,13 +125,109 @@ std::unique_ptr<table> gather(table_view const& source_table, column_view const&
   return destination_table;
 }
 
+std::vector<std::unique_ptr<table>> gather(std::vector<table_view> const& source_tables,
+			      column_view const& gather_map,
+			      bool check_bounds, bool ignore_out_of_bounds,
+			      bool allow_negative_indices,
+			      rmm::mr::device_memory_resource* mr,
+			      cudaStream_t stream) {
+
+  CUDF_EXPECTS(not source_tables.empty(), "No source tables");
+  for (auto const& source_table : source_tables) {
+    CUDF_EXPECTS(source_table.num_rows() == source_tables.front().num_rows(),
+		 "Mismatched number of rows");
+  }
+
+  // Flatten all source columns into one table so the gather map is
+  // dispatched, bounds-checked, and driven through the gather kernels in a
+  // single call instead of once per source table
+  std::vector<column_view> flattened_columns;
+  for (auto const& source_table : source_tables) {
+    for (auto const& source_column : source_table) {
+      flattened_columns.push_back(source_column);
+    }
+  }
+
+  std::unique_ptr<table> flattened_result =
+    gather(table_view{flattened_columns}, gather_map, check_bounds,
+	   ignore_out_of_bounds, allow_negative_indices, mr, stream);
+
+  // Hand the gathered columns back out in the source tables' shapes
+  std::vector<std::unique_ptr<column>> gathered_columns = flattened_result->release();
+  std::vector<std::unique_ptr<table>> destination_tables;
+  auto gathered = gathered_columns.begin();
+  for (auto const& source_table : source_tables) {
+    std::vector<std::unique_ptr<column>> table_columns(
+	std::make_move_iterator(gathered),
+	std::make_move_iterator(gathered + source_table.num_columns()));
+    gathered += source_table.num_columns();
+    destination_tables.push_back(std::make_unique<table>(std::move(table_columns)));
+  }
+
+  return destination_tables;
+}
+
+
+// Maps output row i to source row init + i * step
+struct sequence_map_functor : public thrust::unary_function<size_type, size_type>
+{
+  sequence_map_functor(size_type init, size_type step)
+  : init(init), step(step) {}
+
+  __device__
+  size_type operator()(size_type i) const
+  {
+    return init + i * step;
+  }
+
+  size_type init;
+  size_type step;
+};
+
+std::unique_ptr<table> gather_sequence(table_view const& source_table,
+			      size_type init, size_type step, size_type count,
+			      bool check_bounds,
+			      rmm::mr::device_memory_resource* mr,
+			      cudaStream_t stream) {
+
+  if (check_bounds && count > 0) {
+    // the sequence is monotonic, so checking its endpoints checks every index
+    auto const last = init + (count - 1) * step;
+    CUDF_EXPECTS(init >= 0 && init < source_table.num_rows() &&
+		 last >= 0 && last < source_table.num_rows(),
+		 "Index out of bounds.");
+  }
+
+  auto map_begin = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0),
+      sequence_map_functor{init, step});
+
+  return gather(source_table, map_begin, map_begin + count, false, mr, stream);
+}
 
 }  // namespace detail
 
 std::unique_ptr<table> gather(table_view const& source_table, column_view const& gather_map,
-			      bool check_bounds, rmm::mr::device_memory_resource* mr) {
+			      bool check_bounds, rmm::mr::device_memory_resource* mr,
+			      cudaStream_t stream) {
+  CUDF_FUNC_RANGE();
+  return detail::gather(source_table, gather_map, check_bounds, false, true, mr, stream);
+}
+
+std::vector<std::unique_ptr<table>> gather(std::vector<table_view> const& source_tables,
+			      column_view const& gather_map,
+			      bool check_bounds, rmm::mr::device_memory_resource* mr,
+			      cudaStream_t stream) {
+  CUDF_FUNC_RANGE();
+  return detail::gather(source_tables, gather_map, check_bounds, false, true, mr, stream);
+}
+
+std::unique_ptr<table> gather_sequence(table_view const& source_table,
+			      size_type init, size_type step, size_type count,
+			      bool check_bounds, rmm::mr::device_memory_resource* mr,
+			      cudaStream_t stream) {
   CUDF_FUNC_RANGE();
-  return detail::gather(source_table, gather_map, check_bounds, false, true, mr);
+  return detail::gather_sequence(source_table, init, step, count, check_bounds, mr, stream);
 }
 
 }  // namespace exp
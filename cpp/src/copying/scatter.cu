@@ -28,6 +28,7 @@
 #include <cudf/strings/detail/scatter.cuh>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/detail/fill.hpp>
+#include <cudf/detail/unary.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 
 #include <thrust/iterator/counting_iterator.h>
@@ -228,6 +229,123 @@ struct scatter_scalar_impl {
   }
 };
 
+/**
+ * @brief Scatters the values and validity of every source column into the
+ * preallocated target columns in a single launch.
+ *
+ * One y-block per column, x-blocks grid-striding over the scatter rows. All
+ * columns share the scatter map, so it is read once per row instead of once
+ * per row per column. Validity bits are updated in the same pass via the
+ * atomic bit setters rather than rebuilding each target mask afterwards.
+ */
+template <typename map_type, bool has_validity>
+__global__ void batched_scatter_kernel(
+    column_device_view const* source_views,
+    mutable_column_device_view* target_views,
+    size_type const* element_sizes,
+    map_type const* scatter_map,
+    size_type num_scatter_rows,
+    size_type num_target_rows)
+{
+  auto const column_index = blockIdx.y;
+  auto const& source = source_views[column_index];
+  auto const& target = target_views[column_index];
+  auto const element_size = element_sizes[column_index];
+  char const* source_data = source.head<char>();
+  char* target_data = target.head<char>();
+
+  size_type row = threadIdx.x + blockIdx.x * blockDim.x;
+  while (row < num_scatter_rows) {
+    auto output_row = static_cast<size_type>(scatter_map[row]);
+    if (output_row < 0) { output_row += num_target_rows; }
+
+    char const* src = source_data + (source.offset() + row) * element_size;
+    char* dst = target_data + output_row * element_size;
+    for (size_type b = 0; b < element_size; b++) { dst[b] = src[b]; }
+
+    if (has_validity and target.nullable()) {
+      if (source.is_valid(row)) {
+        target.set_valid(output_row);
+      } else {
+        target.set_null(output_row);
+      }
+    }
+
+    row += blockDim.x * gridDim.x;
+  }
+}
+
+struct dispatch_in_place_map_type {
+  template <typename map_type, std::enable_if_t<std::is_integral<map_type>::value
+      and not std::is_same<map_type, bool8>::value>* = nullptr>
+  void operator()(table_view const& source, column_view const& scatter_map,
+      mutable_table_view& target, bool check_bounds, cudaStream_t stream) const
+  {
+    if (check_bounds) {
+      auto const begin = -target.num_rows();
+      auto const end = target.num_rows();
+      auto bounds = bounds_checker<map_type>{begin, end};
+      CUDF_EXPECTS(scatter_map.size() == thrust::count_if(
+        rmm::exec_policy(stream)->on(stream),
+        scatter_map.begin<map_type>(), scatter_map.end<map_type>(), bounds),
+        "Scatter map index out of bounds");
+    }
+
+    // Batch the views of all columns so one launch covers the whole table
+    using CDViewPtr = decltype(column_device_view::create(
+        std::declval<column_view>(), std::declval<cudaStream_t>()));
+    using MCDViewPtr = decltype(mutable_column_device_view::create(
+        std::declval<mutable_column_view>(), std::declval<cudaStream_t>()));
+    auto source_view_owners = std::vector<CDViewPtr>{};
+    auto target_view_owners = std::vector<MCDViewPtr>{};
+    auto source_views = thrust::host_vector<column_device_view>();
+    auto target_views = thrust::host_vector<mutable_column_device_view>();
+    auto element_sizes = thrust::host_vector<size_type>();
+    bool has_validity = false;
+    for (size_type i = 0; i < source.num_columns(); ++i) {
+      auto source_owner = column_device_view::create(source.column(i), stream);
+      auto target_owner =
+          mutable_column_device_view::create(target.column(i), stream);
+      source_views.push_back(*source_owner);
+      target_views.push_back(*target_owner);
+      source_view_owners.push_back(std::move(source_owner));
+      target_view_owners.push_back(std::move(target_owner));
+      element_sizes.push_back(size_of(source.column(i).type()));
+      has_validity = has_validity or target.column(i).nullable();
+    }
+    auto const d_source_views =
+        rmm::device_vector<column_device_view>{source_views};
+    auto d_target_views =
+        rmm::device_vector<mutable_column_device_view>{target_views};
+    auto const d_element_sizes = rmm::device_vector<size_type>{element_sizes};
+
+    constexpr size_type block_size = 256;
+    cudf::experimental::detail::grid_1d config(scatter_map.size(), block_size);
+    dim3 const grid{static_cast<unsigned int>(config.num_blocks),
+                    static_cast<unsigned int>(source.num_columns())};
+    auto const kernel = has_validity
+        ? batched_scatter_kernel<map_type, true>
+        : batched_scatter_kernel<map_type, false>;
+    kernel<<<grid, block_size, 0, stream>>>(
+        d_source_views.data().get(),
+        d_target_views.data().get(),
+        d_element_sizes.data().get(),
+        scatter_map.begin<map_type>(),
+        scatter_map.size(),
+        target.num_rows());
+
+    CHECK_CUDA(stream);
+  }
+
+  template <typename map_type, std::enable_if_t<not std::is_integral<map_type>::value
+      or std::is_same<map_type, bool8>::value>* = nullptr>
+  void operator()(table_view const& source, column_view const& scatter_map,
+      mutable_table_view& target, bool check_bounds, cudaStream_t stream) const
+  {
+    CUDF_FAIL("Scatter map column must be an integral, non-boolean type");
+  }
+};
+
 struct scatter_to_tables_impl {
   template <typename T, std::enable_if_t<std::is_integral<T>::value
       and not std::is_same<T, bool8>::value>* = nullptr>
@@ -316,9 +434,48 @@ std::unique_ptr<table> scatter(
     return std::make_unique<table>(target, stream, mr);
   }
 
+  // When the map is known in-bounds and wider than the target row count
+  // requires, narrow it once so the per-column scatters read fewer map bytes
+  std::unique_ptr<column> narrowed_map;
+  column_view map_view = scatter_map;
+  if (not check_bounds and source.num_columns() > 1) {
+    auto const narrow_type = narrowest_map_type(target.num_rows());
+    if (size_of(scatter_map.type()) > size_of(narrow_type)) {
+      narrowed_map = detail::cast(scatter_map, narrow_type,
+        rmm::mr::get_default_resource(), stream);
+      map_view = narrowed_map->view();
+    }
+  }
+
   // First dispatch for scatter map index type
-  return type_dispatcher(scatter_map.type(), dispatch_map_type{}, source,
-    scatter_map, target, check_bounds, mr, stream);
+  return type_dispatcher(map_view.type(), dispatch_map_type{}, source,
+    map_view, target, check_bounds, mr, stream);
+}
+
+void scatter_in_place(
+    table_view const& source, column_view const& scatter_map,
+    mutable_table_view& target, bool check_bounds,
+    cudaStream_t stream)
+{
+  CUDF_EXPECTS(source.num_columns() == target.num_columns(),
+    "Number of columns in source and target not equal");
+  CUDF_EXPECTS(scatter_map.size() <= source.num_rows(),
+    "Size of scatter map must be equal to or less than source rows");
+  CUDF_EXPECTS(scatter_map.has_nulls() == false, "Scatter map contains nulls");
+  for (size_type i = 0; i < source.num_columns(); ++i) {
+    CUDF_EXPECTS(source.column(i).type().id() == target.column(i).type().id(),
+      "Column types do not match between source and target");
+    CUDF_EXPECTS(cudf::is_fixed_width(source.column(i).type()),
+      "In-place scatter only supports fixed-width columns");
+    CUDF_EXPECTS(not source.column(i).has_nulls() or target.column(i).nullable(),
+      "Target column must be nullable when scattering nulls into it");
+  }
+
+  if (scatter_map.size() == 0) { return; }
+
+  // Dispatch for scatter map index type
+  type_dispatcher(scatter_map.type(), dispatch_in_place_map_type{}, source,
+    scatter_map, target, check_bounds, stream);
 }
 
 std::unique_ptr<table> scatter(
@@ -462,17 +619,24 @@ std::unique_ptr<table> boolean_mask_scatter(
 std::unique_ptr<table> scatter(
     table_view const& source, column_view const& scatter_map,
     table_view const& target, bool check_bounds,
-    rmm::mr::device_memory_resource* mr) {
+    rmm::mr::device_memory_resource* mr, cudaStream_t stream) {
   CUDF_FUNC_RANGE();
-  return detail::scatter(source, scatter_map, target, check_bounds, mr);
+  return detail::scatter(source, scatter_map, target, check_bounds, mr, stream);
 }
 
 std::unique_ptr<table> scatter(
     std::vector<std::unique_ptr<scalar>> const& source, column_view const& indices,
     table_view const& target, bool check_bounds,
-    rmm::mr::device_memory_resource* mr) {
+    rmm::mr::device_memory_resource* mr, cudaStream_t stream) {
+  CUDF_FUNC_RANGE();
+  return detail::scatter(source, indices, target, check_bounds, mr, stream);
+}
+
+void scatter_in_place(
+    table_view const& source, column_view const& scatter_map,
+    mutable_table_view& target, bool check_bounds) {
   CUDF_FUNC_RANGE();
-  return detail::scatter(source, indices, target, check_bounds, mr);
+  detail::scatter_in_place(source, scatter_map, target, check_bounds);
 }
 
 std::vector<std::unique_ptr<table>> scatter_to_tables(
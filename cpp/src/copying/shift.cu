@@ -116,6 +116,72 @@ struct shift_functor {
     }
 };
 
+struct diff_functor {
+
+    template<typename T, typename... Args>
+    std::enable_if_t<not cudf::is_numeric<T>(), std::unique_ptr<column>>
+    operator()(Args&&... args)
+    {
+        CUDF_FAIL("diff does not support non-numeric types.");
+    }
+
+    template<typename T>
+    std::enable_if_t<cudf::is_numeric<T>(), std::unique_ptr<column>>
+    operator()(column_view const& input,
+               size_type periods,
+               rmm::mr::device_memory_resource *mr,
+               cudaStream_t stream)
+    {
+        auto device_input = column_device_view::create(input, stream);
+        auto output = allocate_like(input, mask_allocation_policy::NEVER, mr);
+        auto device_output = mutable_column_device_view::create(*output, stream);
+
+        auto size = input.size();
+        auto index_begin = thrust::make_counting_iterator<size_type>(0);
+        auto index_end = thrust::make_counting_iterator<size_type>(size);
+
+        // rows whose lagged partner falls off either end are null, so the
+        // output is nullable whenever there is an actual shift
+        if (input.nullable() || periods != 0) {
+
+            auto func_validity =
+                [size, periods, input=*device_input]
+                __device__ (size_type idx) {
+                    auto src_idx = idx - periods;
+                    return not out_of_bounds(size, src_idx)
+                        && input.is_valid(idx)
+                        && input.is_valid(src_idx);
+                };
+
+            auto mask_pair = detail::valid_if(index_begin, index_end, func_validity);
+
+            output->set_null_mask(std::move(std::get<0>(mask_pair)));
+            output->set_null_count(std::get<1>(mask_pair));
+        }
+
+        // single fused pass: each output element reads the row and its lagged
+        // partner once, instead of materializing a shifted copy and running a
+        // separate binary op over it
+        auto func_value =
+            [size, periods, input=*device_input]
+            __device__ (size_type idx) {
+                auto src_idx = idx - periods;
+                return out_of_bounds(size, src_idx)
+                    ? T{}
+                    : static_cast<T>(input.element<T>(idx) -
+                                     input.element<T>(src_idx));
+            };
+
+        thrust::transform(rmm::exec_policy(stream)->on(stream),
+                          index_begin,
+                          index_end,
+                          device_output->data<T>(),
+                          func_value);
+
+        return output;
+    }
+};
+
 } // anonymous namespace
 
 std::unique_ptr<column> shift(column_view const& input,
@@ -138,5 +204,20 @@ std::unique_ptr<column> shift(column_view const& input,
                            mr, stream);
 }
 
+std::unique_ptr<column> diff(column_view const& input,
+                             size_type periods,
+                             rmm::mr::device_memory_resource *mr,
+                             cudaStream_t stream)
+{
+    CUDF_FUNC_RANGE();
+
+    if (input.size() == 0) {
+        return empty_like(input);
+    }
+
+    return type_dispatcher(input.type(), diff_functor{},
+                           input, periods, mr, stream);
+}
+
 } // namespace experimental
 } // namespace cudf
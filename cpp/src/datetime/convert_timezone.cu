@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/types.hpp>
+#include <cudf/datetime.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+
+#include <datetime/timezone.cuh>
+#include <io/orc/timezone.h>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/transform.h>
+
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace datetime {
+namespace detail {
+
+struct launch_convert_timezone {
+  column_view input;
+  mutable_column_view output;
+  int64_t const* d_table;
+  uint32_t tz_len;
+
+  template <typename Element>
+  typename std::enable_if_t<!cudf::is_timestamp_t<Element>::value, void>
+  operator()(cudaStream_t stream) {
+    CUDF_FAIL("Cannot convert timezone of non-timestamp column.");
+  }
+
+  template <typename Timestamp>
+  typename std::enable_if_t<cudf::is_timestamp_t<Timestamp>::value, void>
+  operator()(cudaStream_t stream) {
+    thrust::transform(
+        rmm::exec_policy(stream)->on(stream), input.begin<Timestamp>(),
+        input.end<Timestamp>(), output.begin<Timestamp>(),
+        [table = d_table, len = tz_len] __device__(Timestamp ts) {
+          using namespace simt::std::chrono;
+          // offsets are whole seconds, so the sub-second part is unaffected
+          auto const utc_s = floor<seconds>(ts.time_since_epoch());
+          auto const offset = seconds{GetGmtOffset(table, len, utc_s.count())};
+          return ts + duration_cast<typename Timestamp::duration>(offset);
+        });
+  }
+};
+
+std::unique_ptr<column> convert_timezone(column_view const& column,
+                                         std::string const& timezone_name,
+                                         cudaStream_t stream,
+                                         rmm::mr::device_memory_resource* mr) {
+  std::vector<int64_t> host_table;
+  CUDF_EXPECTS(cudf::io::BuildTimezoneTransitionTable(host_table, timezone_name),
+               "Cannot load timezone transition table");
+
+  CUDF_EXPECTS(is_timestamp(column.type()),
+               "Cannot convert timezone of non-timestamp column.");
+
+  // UTC and an empty name produce an empty table; nothing to convert
+  if (host_table.empty()) {
+    return std::make_unique<cudf::column>(column, stream, mr);
+  }
+
+  auto size = column.size();
+  auto output = std::make_unique<cudf::column>(
+      column.type(), size,
+      rmm::device_buffer{size * cudf::size_of(column.type()), stream, mr},
+      copy_bitmask(column, stream, mr), column.null_count(),
+      std::vector<std::unique_ptr<cudf::column>>{});
+
+  rmm::device_vector<int64_t> d_table(host_table);
+  auto launch = launch_convert_timezone{
+      column, static_cast<mutable_column_view>(*output), d_table.data().get(),
+      static_cast<uint32_t>(host_table.size() >> 1)};
+
+  experimental::type_dispatcher(column.type(), launch, stream);
+
+  return output;
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> convert_timezone(column_view const& column,
+                                         std::string const& timezone_name,
+                                         rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::convert_timezone(column, timezone_name, 0, mr);
+}
+
+}  // namespace datetime
+}  // namespace cudf
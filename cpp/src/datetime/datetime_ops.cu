@@ -19,11 +19,19 @@
 #include <cudf/null_mask.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 
 #include <rmm/thrust_rmm_allocator.h>
 
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+
 namespace cudf {
 namespace datetime {
 namespace detail {
@@ -111,6 +119,110 @@ std::unique_ptr<column> extract_component(column_view const& column,
 
   return output;
 }
+
+struct launch_extract_components {
+  column_view input;
+  mutable_table_view outputs;
+  datetime_component const* d_components;
+
+  template <typename Element>
+  typename std::enable_if_t<!cudf::is_timestamp_t<Element>::value, void>
+  operator()(cudaStream_t stream) {
+    CUDF_FAIL("Cannot extract datetime component from non-timestamp column.");
+  }
+
+  template <typename Timestamp>
+  typename std::enable_if_t<cudf::is_timestamp_t<Timestamp>::value, void>
+  operator()(cudaStream_t stream) {
+    auto input_device_view = column_device_view::create(input, stream);
+    auto outputs_device_view = mutable_table_device_view::create(outputs, stream);
+    // the civil-calendar conversion is done once per row and shared by
+    // every requested component
+    thrust::for_each_n(
+        rmm::exec_policy(stream)->on(stream),
+        thrust::make_counting_iterator<size_type>(0), input.size(),
+        [in = *input_device_view, out = *outputs_device_view,
+         components = d_components] __device__(size_type row) {
+          using namespace simt::std::chrono;
+
+          auto const ts = in.element<Timestamp>(row);
+          auto days_since_epoch = floor<days>(ts);
+
+          auto time_since_midnight = ts - days_since_epoch;
+          if (time_since_midnight.count() < 0) {
+            time_since_midnight += days(1);
+          }
+
+          auto const ymd = year_month_day(days_since_epoch);
+          auto const hrs_ = duration_cast<hours>(time_since_midnight);
+          auto const mins_ = duration_cast<minutes>(time_since_midnight - hrs_);
+          auto const secs_ =
+              duration_cast<seconds>(time_since_midnight - hrs_ - mins_);
+
+          for (size_type c = 0; c < out.num_columns(); ++c) {
+            int16_t value = 0;
+            switch (components[c]) {
+              case datetime_component::YEAR:
+                value = static_cast<int>(ymd.year());
+                break;
+              case datetime_component::MONTH:
+                value = static_cast<unsigned>(ymd.month());
+                break;
+              case datetime_component::DAY:
+                value = static_cast<unsigned>(ymd.day());
+                break;
+              case datetime_component::WEEKDAY:
+                value = year_month_weekday(days_since_epoch)
+                            .weekday().iso_encoding();
+                break;
+              case datetime_component::HOUR:
+                value = hrs_.count();
+                break;
+              case datetime_component::MINUTE:
+                value = mins_.count();
+                break;
+              default:
+                value = secs_.count();
+                break;
+            }
+            out.column(c).element<int16_t>(row) = value;
+          }
+        });
+  }
+};
+
+std::unique_ptr<experimental::table> extract_datetime_components(
+    column_view const& column,
+    std::vector<datetime_component> const& components,
+    cudaStream_t stream,
+    rmm::mr::device_memory_resource* mr) {
+  CUDF_EXPECTS(!components.empty(), "No datetime components requested");
+  CUDF_EXPECTS(std::all_of(components.begin(), components.end(),
+                           [](datetime_component component) {
+                             return component != datetime_component::INVALID;
+                           }),
+               "Invalid datetime component requested");
+
+  auto size = column.size();
+  auto type = data_type{type_id::INT16};
+
+  std::vector<std::unique_ptr<cudf::column>> output_columns;
+  output_columns.reserve(components.size());
+  std::generate_n(std::back_inserter(output_columns), components.size(), [&] {
+    return std::make_unique<cudf::column>(
+        type, size, rmm::device_buffer{size * cudf::size_of(type), stream, mr},
+        copy_bitmask(column, stream, mr), column.null_count(),
+        std::vector<std::unique_ptr<cudf::column>>{});
+  });
+  auto output = std::make_unique<experimental::table>(std::move(output_columns));
+
+  rmm::device_vector<datetime_component> d_components(components);
+  auto launch = launch_extract_components{column, output->mutable_view(),
+                                          d_components.data().get()};
+  experimental::type_dispatcher(column.type(), launch, stream);
+
+  return output;
+}
 }  // namespace detail
 
 std::unique_ptr<column> extract_year(column_view const& column,
@@ -162,5 +274,13 @@ std::unique_ptr<column> extract_second(column_view const& column,
                                                                        0, mr);
 }
 
+std::unique_ptr<experimental::table> extract_datetime_components(
+    column_view const& column,
+    std::vector<datetime_component> const& components,
+    rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::extract_datetime_components(column, components, 0, mr);
+}
+
 }  // namespace datetime
 }  // namespace cudf
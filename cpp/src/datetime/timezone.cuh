@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace cudf {
+namespace datetime {
+namespace detail {
+
+/**
+ * @brief Returns the UTC offset, in seconds, of a timezone at a point in time
+ *
+ * Looks up a transition table built by `cudf::io::BuildTimezoneTransitionTable`
+ * (1st entry = gmtOffset, 2 int64_t per transition, last 800 transitions
+ * repeat forever with 400 year cycle). Times past the last explicit
+ * transition are resolved by folding into the repeating 400-year DST cycle.
+ *
+ * @param[in] table Timezone transition table in device memory
+ * @param[in] tz_len Number of (time, offset) pairs in the table (table size / 2)
+ * @param[in] ts UTC time in seconds since epoch
+ *
+ * @return UTC offset in seconds (positive east of Greenwich)
+ **/
+static __device__ __inline__ int64_t GetGmtOffset(const int64_t *table, uint32_t tz_len, int64_t ts)
+{
+    uint32_t num_entries = tz_len;
+    uint32_t dst_cycle = 0;
+    uint32_t first, last;
+
+    if (tz_len > 800) // 2 entries/year for 400 years
+    {
+        num_entries = tz_len - 800;
+        dst_cycle = 800;
+    }
+    if (ts <= table[1])
+    {
+        // Before the first transition
+        return table[0 * 2 + 2];
+    }
+    else if (ts <= table[(num_entries - 1) * 2 + 1])
+    {
+        first = 0;
+        last = num_entries - 1;
+    }
+    else if (!dst_cycle)
+    {
+        return table[(num_entries - 1) * 2 + 2];
+    }
+    else
+    {
+        // Apply 400-year cycle rule
+        const int64_t k400Years = (365 * 400 + (100 - 3)) * 24 * 60 * 60ll;
+        ts %= k400Years;
+        if (ts < 0)
+        {
+            ts += k400Years;
+        }
+        first = num_entries;
+        last = num_entries + dst_cycle - 1;
+        if (ts < table[num_entries * 2 + 1])
+        {
+            return table[last * 2 + 2];
+        }
+    }
+    // Binary search the table from first to last for ts
+    do
+    {
+        uint32_t mid = first + ((last - first + 1) >> 1);
+        int64_t tmid = table[mid * 2 + 1];
+        if (tmid <= ts)
+        {
+            first = mid;
+        }
+        else
+        {
+            if (mid == last)
+            {
+                break;
+            }
+            last = mid;
+        }
+    } while (first < last);
+    return table[first * 2 + 2];
+}
+
+}  // namespace detail
+}  // namespace datetime
+}  // namespace cudf
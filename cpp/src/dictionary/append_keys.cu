@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/dictionary/update_keys.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/detail/concatenate.cuh>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/sorting.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+namespace cudf
+{
+namespace dictionary
+{
+namespace detail
+{
+
+/**
+ * @brief Create a new dictionary column by appending the new keys elements
+ * after the existing keys without remapping any indices.
+ *
+ * The existing keys keep their positions, so the indices are copied
+ * unchanged; only the keys are touched, making this O(number of keys)
+ * regardless of the number of rows. New keys equal to an existing key
+ * (or to an earlier new key) are dropped; the remainder are appended in
+ * their order of first occurrence.
+ *
+ * ```
+ * Example:
+ * d1 = {[a, c, d], [2, 0, 1, 0, 1]}
+ * d2 = append_keys( d1, [b, c] )
+ * d2 is now {[a, c, d, b], [2, 0, 1, 0, 1]}
+ * ```
+ *
+ */
+std::unique_ptr<column> append_keys( dictionary_column_view const& dictionary_column,
+                                     column_view const& new_keys,
+                                     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                                     cudaStream_t stream = 0)
+{
+    CUDF_EXPECTS( !new_keys.has_nulls(), "Keys must not have nulls" );
+    auto old_keys = dictionary_column.keys(); // [a,c,d]
+    CUDF_EXPECTS( new_keys.type()==old_keys.type(), "Keys must be the same type");
+    auto const old_keys_size = old_keys.size();
+
+    // the indices are stable, so they are simply copied
+    column_view indices_view( data_type{INT32}, dictionary_column.size(),
+                              dictionary_column.indices().data<int32_t>(),
+                              nullptr, 0, dictionary_column.offset() );
+    auto indices_column = std::make_unique<column>( indices_view, stream, mr );
+
+    // concatenate the keys together
+    // [a,c,d] + [b,c] = [a,c,d,b,c]
+    auto combined_keys = cudf::detail::concatenate(std::vector<column_view>{old_keys, new_keys},
+                                                   rmm::mr::get_default_resource(), stream);
+    auto const combined_size = combined_keys->size();
+    auto combined_view = combined_keys->view();
+    // stable argsort groups duplicates together with the earliest occurrence
+    // first -- only the keys are sorted, never the rows
+    auto ordering = experimental::detail::stable_sorted_order( table_view{{combined_view}},
+                            std::vector<order>{}, std::vector<null_order>{},
+                            rmm::mr::get_default_resource(), stream );
+    auto d_ordering = ordering->view().data<int32_t>();
+
+    // drop any new key equal to the previous sorted entry; old keys are
+    // already unique and, being first in the concatenation, always win a tie
+    auto combined_device_view = table_device_view::create(table_view{{combined_view}}, stream);
+    experimental::row_equality_comparator<false> comparator(*combined_device_view, *combined_device_view, true);
+    rmm::device_vector<bool> keep(combined_size, true);
+    auto d_keep = keep.data().get();
+    thrust::for_each_n( rmm::exec_policy(stream)->on(stream),
+        thrust::make_counting_iterator<size_type>(1), combined_size-1,
+        [d_ordering, d_keep, comparator, old_keys_size] __device__ (size_type pos) {
+            if( d_ordering[pos] >= old_keys_size &&
+                comparator(d_ordering[pos], d_ordering[pos-1]) )
+                d_keep[d_ordering[pos]] = false;
+        });
+
+    // gather the kept keys in concatenation order: existing keys first,
+    // then the new keys in order of first occurrence
+    rmm::device_vector<int32_t> kept_indices(combined_size);
+    auto kept_end = thrust::copy_if( rmm::exec_policy(stream)->on(stream),
+        thrust::make_counting_iterator<int32_t>(0),
+        thrust::make_counting_iterator<int32_t>(combined_size),
+        kept_indices.begin(),
+        [d_keep] __device__ (int32_t idx) { return d_keep[idx]; });
+    auto const keys_size = static_cast<size_type>(thrust::distance(kept_indices.begin(), kept_end));
+    column_view gather_map( data_type{INT32}, keys_size, kept_indices.data().get() );
+    auto table_keys = cudf::experimental::detail::gather( table_view{{combined_view}},
+                                                          gather_map, false, false, false,
+                                                          mr, stream )->release();
+    std::unique_ptr<column> keys_column(std::move(table_keys.front()));
+
+    // create new dictionary column with keys_column and the unchanged indices
+    return make_dictionary_column( std::move(keys_column), std::move(indices_column),
+                                   copy_bitmask( dictionary_column.parent(), stream, mr), // nulls have
+                                   dictionary_column.null_count() );                      // not changed
+}
+
+} // namespace detail
+
+std::unique_ptr<column> append_keys( dictionary_column_view const& dictionary_column,
+                                     column_view const& keys,
+                                     rmm::mr::device_memory_resource* mr)
+{
+    return detail::append_keys(dictionary_column, keys, mr);
+}
+
+} // namespace dictionary
+} // namespace cudf
@@ -21,6 +21,8 @@
 #include <dlpack/dlpack.h>
 
 #include <algorithm>
+#include <atomic>
+#include <memory>
 
 namespace cudf {
 
@@ -104,6 +106,87 @@ struct dltensor_context {
   }
 };
 
+// Validates that `input` can alias a single DLPack tensor and fills in
+// `tensor` to view its device memory; `shape` and `strides` must point at
+// storage for two int64_t each, owned by the tensor's context
+void fill_view_tensor(table_view const& input, DLTensor& tensor,
+                      int64_t* shape, int64_t* strides)
+{
+  auto const num_rows = input.num_rows();
+  auto const num_cols = input.num_columns();
+
+  data_type const type = input.column(0).type();
+  tensor.dtype = data_type_to_DLDataType(type);
+
+  CUDF_EXPECTS(std::all_of(input.begin(), input.end(),
+    [type](auto const& col) { return col.type() == type; }),
+    "All columns required to have same data type");
+
+  CUDF_EXPECTS(std::none_of(input.begin(), input.end(),
+    [](auto const& col) { return col.has_nulls(); }),
+    "Input required to have null count zero");
+
+  size_t const byte_width = size_of(type);
+  auto const base = reinterpret_cast<uintptr_t>(get_column_data(input.column(0)));
+
+  tensor.data = reinterpret_cast<void*>(base);
+  tensor.byte_offset = 0;
+  CUDA_TRY(cudaGetDevice(&tensor.ctx.device_id));
+  tensor.ctx.device_type = kDLGPU;
+
+  tensor.ndim = (num_cols > 1) ? 2 : 1;
+  tensor.shape = shape;
+  tensor.shape[0] = num_rows;
+  if (tensor.ndim > 1) {
+    // a 2D tensor can only describe columns that are equally spaced; use the
+    // spacing of the first pair as the column stride and verify the rest
+    auto const next = reinterpret_cast<uintptr_t>(get_column_data(input.column(1)));
+    CUDF_EXPECTS(next > base, "Columns must be in ascending device memory order for zero-copy export");
+    size_t const stride_bytes = next - base;
+    CUDF_EXPECTS(stride_bytes % byte_width == 0 &&
+                 stride_bytes >= num_rows * byte_width,
+                 "Columns must be equally spaced in device memory for zero-copy export");
+    for (size_type i = 2; i < num_cols; ++i) {
+      CUDF_EXPECTS(reinterpret_cast<uintptr_t>(get_column_data(input.column(i))) ==
+                   base + i * stride_bytes,
+                   "Columns must be equally spaced in device memory for zero-copy export");
+    }
+    tensor.shape[1] = num_cols;
+    tensor.strides = strides;
+    tensor.strides[0] = 1;
+    tensor.strides[1] = stride_bytes / byte_width;
+  }
+}
+
+// Context owning the descriptor memory of a single zero-copy tensor; the
+// viewed device memory belongs to the caller's table
+struct dltensor_view_context {
+  int64_t shape[2];
+  int64_t strides[2];
+
+  static void deleter(DLManagedTensor* arg)
+  {
+    delete static_cast<dltensor_view_context*>(arg->manager_ctx);
+    delete arg;
+  }
+};
+
+// Shared context of a batched export: every descriptor is carved from the
+// vectors below and the context is freed once all tensors are deleted
+struct dltensor_batch_context {
+  std::vector<int64_t> dims;
+  std::vector<DLManagedTensor> tensors;
+  std::atomic<size_type> outstanding{0};
+
+  static void deleter(DLManagedTensor* arg)
+  {
+    auto context = static_cast<dltensor_batch_context*>(arg->manager_ctx);
+    if (--context->outstanding == 0) {
+      delete context;
+    }
+  }
+};
+
 }  // namespace
 
 namespace detail {
@@ -259,4 +342,54 @@ DLManagedTensor* to_dlpack(table_view const& input,
   return detail::to_dlpack(input, mr);
 }
 
+// The view exports do no device work, so there are no detail versions taking
+// a stream or memory resource
+
+DLManagedTensor* to_dlpack_view(table_view const& input)
+{
+  if (input.num_rows() == 0) {
+    return nullptr;
+  }
+
+  auto managed_tensor = std::make_unique<DLManagedTensor>();
+  auto context = std::make_unique<dltensor_view_context>();
+
+  fill_view_tensor(input, managed_tensor->dl_tensor,
+                   context->shape, context->strides);
+
+  managed_tensor->deleter = dltensor_view_context::deleter;
+  managed_tensor->manager_ctx = context.release();
+  return managed_tensor.release();
+}
+
+std::vector<DLManagedTensor*> to_dlpack_batched(
+    std::vector<table_view> const& inputs)
+{
+  auto context = std::make_unique<dltensor_batch_context>();
+  context->dims.resize(4 * inputs.size());
+  context->tensors.resize(inputs.size());
+
+  std::vector<DLManagedTensor*> result(inputs.size(), nullptr);
+  size_type live = 0;
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    if (inputs[i].num_rows() == 0) {
+      continue;
+    }
+    auto& tensor = context->tensors[i];
+    fill_view_tensor(inputs[i], tensor.dl_tensor,
+                     &context->dims[4 * i], &context->dims[4 * i + 2]);
+    tensor.deleter = dltensor_batch_context::deleter;
+    tensor.manager_ctx = context.get();
+    result[i] = &tensor;
+    ++live;
+  }
+
+  if (live > 0) {
+    // ownership passes to the tensors; freed by the last deleter call
+    context->outstanding = live;
+    context.release();
+  }
+  return result;
+}
+
 }  // namespace cudf
@@ -23,6 +23,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
 
 namespace cudf {
 namespace experimental {
@@ -141,12 +142,14 @@ std::unique_ptr<column> sequence(size_type size, scalar const& init,
 std::unique_ptr<column> sequence(size_type size, scalar const& init, scalar const& step,
                                  rmm::mr::device_memory_resource* mr)
 {
+   CUDF_FUNC_RANGE();
    return detail::sequence(size, init, step, mr, 0);
 }
 
 std::unique_ptr<column> sequence(size_type size, scalar const& init,
                                  rmm::mr::device_memory_resource* mr)
 {
+   CUDF_FUNC_RANGE();
    return detail::sequence(size, init, mr, 0);
 }
 
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/aggregation/result_cache.hpp>
+#include <cudf/groupby.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace cudf {
+namespace experimental {
+namespace groupby {
+
+/**
+ * @brief Indicates whether two views refer to the same column contents
+ *
+ * Columns are identified by where they point — device address, size, offset,
+ * type and null mask, recursively over children — not by comparing elements.
+ * It is the caller's contract that identically located data is unchanged
+ * between aggregate calls while result caching is enabled.
+ */
+inline bool same_column_identity(column_view const& lhs,
+                                 column_view const& rhs) {
+  if (lhs.head() != rhs.head() or
+      lhs.size() != rhs.size() or
+      lhs.offset() != rhs.offset() or
+      lhs.type() != rhs.type() or
+      lhs.null_mask() != rhs.null_mask() or
+      lhs.num_children() != rhs.num_children())
+    return false;
+
+  for (size_type i = 0; i < lhs.num_children(); ++i) {
+    if (not same_column_identity(lhs.child(i), rhs.child(i)))
+      return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Aggregation results retained across `groupby::aggregate` calls
+ *
+ * Holds one map of (aggregation -> owned result column) per distinct values
+ * column seen so far. The maps reuse the key hash and equality of
+ * `result_cache` so that parameterized aggregations (e.g. quantiles) only
+ * match when their parameters match.
+ */
+struct groupby::cached_results {
+  using result_map = std::unordered_map<std::shared_ptr<aggregation>,
+                                        std::unique_ptr<column>,
+                                        experimental::detail::aggregation_hash,
+                                        experimental::detail::aggregation_equality>;
+
+  /**
+   * @brief Returns the result map for @p values, creating it on first sight
+   */
+  result_map& results_for(column_view const& values) {
+    auto it = std::find_if(_columns.begin(), _columns.end(),
+                           [&values](column_view const& cached) {
+                             return same_column_identity(cached, values);
+                           });
+    if (it != _columns.end()) {
+      return _results[std::distance(_columns.begin(), it)];
+    }
+    _columns.push_back(values);
+    _results.emplace_back();
+    return _results.back();
+  }
+
+ private:
+  std::vector<column_view> _columns;  ///< Identity of each cached values column
+  std::vector<result_map> _results;   ///< Cached results, parallel to _columns
+};
+
+}  // namespace groupby
+}  // namespace experimental
+}  // namespace cudf
@@ -17,11 +17,14 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
+#include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/unary.hpp>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/detail/groupby.hpp>
 #include <cudf/detail/groupby/sort_helper.hpp>
+#include <groupby/common/cached_results.hpp>
 #include <cudf/groupby.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
@@ -49,6 +52,17 @@ groupby::groupby(table_view const& keys,
       _column_order{column_order},
       _null_precedence{null_precedence} {}
 
+// Constructor reusing a precomputed sort helper. The helper carries the
+// memoized sort state, so this object always takes the sort-based path.
+groupby::groupby(table_view const& keys,
+                 std::shared_ptr<detail::sort::sort_groupby_helper> helper,
+                 include_nulls include_null_keys)
+    : _keys{keys},
+      _include_null_keys{include_null_keys},
+      _helper{std::move(helper)} {
+  CUDF_EXPECTS(_helper != nullptr, "Sort helper cannot be null");
+}
+
 // Select hash vs. sort groupby implementation
 std::pair<std::unique_ptr<table>, std::vector<aggregation_result>>
 groupby::dispatch_aggregation(std::vector<aggregation_request> const& requests,
@@ -59,9 +73,12 @@ groupby::dispatch_aggregation(std::vector<aggregation_request> const& requests,
   // all the aggs that can be done by hash groupby are efficiently done by
   // sort groupby as well.
   // Only use hash groupby if the keys aren't sorted and all requests can be
-  // satisfied with a hash implementation
+  // satisfied with a hash implementation. Cross-call result caching also pins
+  // the sort implementation, since cached results are only row-aligned across
+  // calls when the group ordering is stable.
   if (_keys_are_sorted == sorted::NO and
       not _helper and
+      not _cached_results and
       detail::hash::can_use_hash_groupby(_keys, requests)) {
     return detail::hash::groupby(_keys, requests, _include_null_keys, stream,
                                  mr);
@@ -74,6 +91,20 @@ groupby::dispatch_aggregation(std::vector<aggregation_request> const& requests,
 // Needs to be in source file because sort_groupby_helper was forward declared
 groupby::~groupby() = default;
 
+// Enable retaining results across aggregate calls
+void groupby::enable_result_caching() {
+  if (not _cached_results) {
+    _cached_results = std::make_unique<cached_results>();
+  }
+}
+
+// Drop retained results; caching stays enabled
+void groupby::clear_cached_results() {
+  if (_cached_results) {
+    _cached_results = std::make_unique<cached_results>();
+  }
+}
+
 namespace {
 /// Make an empty table with appropriate types for requested aggs
 auto empty_results(std::vector<aggregation_request> const& requests) {
@@ -118,8 +149,8 @@ void verify_valid_requests(std::vector<aggregation_request> const& requests) {
 // Compute aggregation requests
 std::pair<std::unique_ptr<table>, std::vector<aggregation_result>>
 groupby::aggregate(std::vector<aggregation_request> const& requests,
-                   rmm::mr::device_memory_resource* mr) {
-  CUDF_FUNC_RANGE();
+                   rmm::mr::device_memory_resource* mr, cudaStream_t stream) {
+  CUDF_FUNC_RANGE_COLOR(cudf::range_color::groupby);
   CUDF_EXPECTS(std::all_of(requests.begin(), requests.end(),
                            [this](auto const& request) {
                              return request.values.size() == _keys.num_rows();
@@ -132,11 +163,11 @@ groupby::aggregate(std::vector<aggregation_request> const& requests,
     return std::make_pair(empty_like(_keys), empty_results(requests));
   }
 
-  return dispatch_aggregation(requests, 0, mr);
+  return dispatch_aggregation(requests, stream, mr);
 }
 
 groupby::groups groupby::get_groups(table_view values, rmm::mr::device_memory_resource*  mr) {
-  CUDF_FUNC_RANGE();
+  CUDF_FUNC_RANGE_COLOR(cudf::range_color::groupby);
   auto grouped_keys = helper().sorted_keys(mr, 0);
 
   auto group_offsets = helper().group_offsets(0);
@@ -160,11 +191,159 @@ groupby::groups groupby::get_groups(table_view values, rmm::mr::device_memory_re
 detail::sort::sort_groupby_helper& groupby::helper() {
   if (_helper)
     return *_helper;
-  _helper = std::make_unique<detail::sort::sort_groupby_helper>(
+  _helper = std::make_shared<detail::sort::sort_groupby_helper>(
     _keys, _include_null_keys, _keys_are_sorted);
   return *_helper;
 };
 
+// Get a shareable handle to the sort helper object
+std::shared_ptr<detail::sort::sort_groupby_helper> groupby::shared_helper() {
+  helper();  // ensure the helper exists
+  return _helper;
+}
+
+namespace {
+
+/// Indicates whether an aggregation's partial results can be merged with
+/// another single pass, making it usable for streaming groupby
+bool is_streaming_aggregation(aggregation::Kind k) {
+  return (k == aggregation::SUM) or (k == aggregation::MIN) or
+         (k == aggregation::MAX) or (k == aggregation::COUNT_VALID) or
+         (k == aggregation::COUNT_ALL);
+}
+
+/// Returns the aggregation that merges two partial results of kind `k`.
+/// Counts merge by summing; the other kinds merge with themselves.
+std::unique_ptr<aggregation> make_merge_aggregation(aggregation::Kind k) {
+  switch (k) {
+    case aggregation::SUM:
+    case aggregation::COUNT_VALID:
+    case aggregation::COUNT_ALL:
+      return make_sum_aggregation();
+    case aggregation::MIN:
+      return make_min_aggregation();
+    case aggregation::MAX:
+      return make_max_aggregation();
+    default: CUDF_FAIL("Aggregation is not supported for streaming groupby");
+  }
+}
+
+}  // namespace
+
+// Constructor
+streaming_groupby::streaming_groupby(include_nulls include_null_keys)
+    : _include_null_keys{include_null_keys} {}
+
+// Destructor
+streaming_groupby::~streaming_groupby() = default;
+
+// Fold one batch into the running partial results
+void streaming_groupby::update(table_view const& keys,
+                               std::vector<aggregation_request> const& requests,
+                               rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE_COLOR(cudf::range_color::groupby);
+
+  std::vector<aggregation::Kind> kinds;
+  std::vector<size_t> request_sizes;
+  for (auto const& request : requests) {
+    CUDF_EXPECTS(std::all_of(request.aggregations.begin(),
+                             request.aggregations.end(),
+                             [](auto const& agg) {
+                               return is_streaming_aggregation(agg->kind);
+                             }),
+                 "Aggregation is not supported for streaming groupby");
+    for (auto const& agg : request.aggregations) { kinds.push_back(agg->kind); }
+    request_sizes.push_back(request.aggregations.size());
+  }
+
+  if (_request_sizes.empty()) {
+    _kinds = kinds;
+    _request_sizes = request_sizes;
+  } else {
+    CUDF_EXPECTS(kinds == _kinds and request_sizes == _request_sizes,
+                 "Request structure differs from previous update calls.");
+  }
+
+  // Aggregate the batch on its own; value validation happens here
+  groupby batch_groupby(keys, _include_null_keys);
+  auto batch = batch_groupby.aggregate(requests, mr);
+
+  // Flatten the batch results. COUNT partials are widened to INT64 right
+  // away so the running column keeps the same type that merging by SUM
+  // produces, making the partial types stable across batches.
+  std::vector<std::unique_ptr<column>> batch_values;
+  size_t flat_index = 0;
+  for (size_t i = 0; i < requests.size(); ++i) {
+    for (auto& result : batch.second[i].results) {
+      if (_kinds[flat_index] == aggregation::COUNT_VALID or
+          _kinds[flat_index] == aggregation::COUNT_ALL) {
+        result = cast(result->view(), data_type{INT64}, mr);
+      }
+      batch_values.push_back(std::move(result));
+      ++flat_index;
+    }
+  }
+
+  // First batch: the batch partials become the running partials
+  if (not _partial_keys) {
+    _partial_keys = std::move(batch.first);
+    _partial_values = std::move(batch_values);
+    return;
+  }
+
+  // Merge the running partials with the batch partials by aggregating their
+  // concatenation. Groups present in both contribute two rows keyed alike;
+  // groups present in only one pass through unchanged.
+  auto combined_keys = cudf::experimental::concatenate(
+      {_partial_keys->view(), batch.first->view()}, mr);
+
+  std::vector<std::unique_ptr<column>> combined_values;
+  std::vector<aggregation_request> merge_requests;
+  for (size_t i = 0; i < _partial_values.size(); ++i) {
+    combined_values.push_back(cudf::concatenate(
+        {_partial_values[i]->view(), batch_values[i]->view()}, mr));
+    aggregation_request merge_request;
+    merge_request.values = combined_values.back()->view();
+    merge_request.aggregations.push_back(make_merge_aggregation(_kinds[i]));
+    merge_requests.push_back(std::move(merge_request));
+  }
+
+  groupby merge_groupby(combined_keys->view(), _include_null_keys);
+  auto merged = merge_groupby.aggregate(merge_requests, mr);
+
+  _partial_keys = std::move(merged.first);
+  _partial_values.clear();
+  for (auto& result : merged.second) {
+    _partial_values.push_back(std::move(result.results[0]));
+  }
+}
+
+// Emit the accumulated results and reset
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>>
+streaming_groupby::finalize() {
+  CUDF_FUNC_RANGE_COLOR(cudf::range_color::groupby);
+  CUDF_EXPECTS(_partial_keys != nullptr,
+               "finalize called before any update.");
+
+  // Reassemble per-request results from the flattened partial columns
+  std::vector<aggregation_result> results;
+  size_t flat_index = 0;
+  for (auto num_aggregations : _request_sizes) {
+    aggregation_result result;
+    for (size_t i = 0; i < num_aggregations; ++i) {
+      result.results.push_back(std::move(_partial_values[flat_index++]));
+    }
+    results.push_back(std::move(result));
+  }
+
+  auto unique_keys = std::move(_partial_keys);
+  _partial_values.clear();
+  _kinds.clear();
+  _request_sizes.clear();
+
+  return std::make_pair(std::move(unique_keys), std::move(results));
+}
+
 }  // namespace groupby
 }  // namespace experimental
 }  // namespace cudf
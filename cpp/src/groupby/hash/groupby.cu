@@ -16,6 +16,7 @@
 
 #include <groupby/common/utils.hpp>
 #include <groupby/hash/groupby_kernels.cuh>
+#include <groupby/hash/spill_groupby.hpp>
 
 #include <hash/concurrent_unordered_map.cuh>
 #include <cudf/detail/utilities/hash_functions.cuh>
@@ -38,9 +39,15 @@
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/detail/aggregation/aggregation.cuh>
 #include <cudf/detail/aggregation/result_cache.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/utilities/traits.hpp>
 
+#include <thrust/fill.h>
+#include <thrust/transform.h>
+
 #include <memory>
+#include <set>
 #include <utility>
 
 namespace cudf {
@@ -88,7 +95,7 @@ bool constexpr is_hash_aggregation(aggregation::Kind t) {
          (t == aggregation::ARGMIN) or (t == aggregation::ARGMAX);
 }
 
-// flatten aggs to filter in single pass aggs 
+// flatten aggs to filter in single pass aggs
 std::tuple<table_view, std::vector<aggregation::Kind>, std::vector<size_t> >
 flatten_single_pass_aggs(std::vector<aggregation_request> const& requests) {
   std::vector<column_view> columns;
@@ -99,15 +106,26 @@ flatten_single_pass_aggs(std::vector<aggregation_request> const& requests) {
     auto const& request = requests[i];
     auto const& agg_v = request.aggregations;
 
-    auto insert_agg = [&agg_kinds, &columns, &col_ids, &request, i]
+    // A request may resolve several aggregations to the same kind (e.g.
+    // string MIN and ARGMIN both map to ARGMIN). The fused kernel updates
+    // every flattened column on each probe, so duplicates are dropped here
+    // to avoid paying for the same aggregation more than once per row.
+    std::set<aggregation::Kind> seen_kinds;
+    auto insert_agg = [&agg_kinds, &columns, &col_ids, &seen_kinds, &request, i]
     (aggregation::Kind k) {
+      if (not seen_kinds.insert(k).second) { return; }
       agg_kinds.push_back(k);
       columns.push_back(request.values);
       col_ids.push_back(i);
     };
 
     for (auto &&agg : agg_v) {
-      if (is_hash_aggregation(agg->kind)) {
+      if (agg->kind == aggregation::VARIANCE or agg->kind == aggregation::STD) {
+        // Computed by a second elementwise pass over the map from the sparse
+        // SUM and COUNT_VALID results; ensure the single pass produces them
+        insert_agg(aggregation::SUM);
+        insert_agg(aggregation::COUNT_VALID);
+      } else if (is_hash_aggregation(agg->kind)) {
         if (is_fixed_width(request.values.type()) or 
             agg->kind == aggregation::COUNT_VALID or
             agg->kind == aggregation::COUNT_ALL) {
@@ -212,6 +230,7 @@ void sparse_to_dense_results(
 template <bool keys_have_nulls>
 auto create_hash_map(table_device_view const& d_keys,
                      include_nulls include_null_keys,
+                     rmm::mr::device_memory_resource* mr,
                      cudaStream_t stream = 0)
 {
   size_type constexpr unused_key{std::numeric_limits<size_type>::max()};
@@ -232,7 +251,7 @@ auto create_hash_map(table_device_view const& d_keys,
 
   return map_type::create(compute_hash_table_size(d_keys.num_rows()),
                             unused_key, unused_value, hasher, rows_equal,
-                            allocator_type(), stream);
+                            allocator_type(mr), stream);
 }
 
 /**
@@ -279,23 +298,55 @@ void compute_single_pass_aggs(table_view const& keys,
   auto d_values = table_device_view::create(flattened_values);
   rmm::device_vector<aggregation::Kind> d_aggs(aggs);
 
-  bool skip_key_rows_with_nulls = keys_have_nulls and 
+  bool skip_key_rows_with_nulls = keys_have_nulls and
                                   include_null_keys == include_nulls::NO;
 
+  // The aggregation kernel caches resolved keys in shared memory using the
+  // same hasher and comparator the map was built with
+  auto d_keys = table_device_view::create(keys, stream);
+  row_hasher<default_hash, keys_have_nulls> hasher{*d_keys};
+  row_equality_comparator<keys_have_nulls> rows_equal{
+      *d_keys, *d_keys, include_null_keys == include_nulls::YES};
+
+  constexpr int block_size{256};
+  constexpr int cache_size{512};
+  experimental::detail::grid_1d config(keys.num_rows(), block_size);
+
+  // dispatch a non-nullable instantiation when the (cached) null counts say
+  // no value column has nulls, so the per-element validity tests compile out
+  bool const values_have_nulls = cudf::has_nulls(flattened_values);
+
   if (skip_key_rows_with_nulls) {
     auto row_bitmask{bitmask_and(keys, rmm::mr::get_default_resource(), stream)};
-    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
-      thrust::make_counting_iterator(0), keys.num_rows(),
-      hash::compute_single_pass_aggs<true, Map>{
-        map, keys.num_rows(), *d_values, *d_sparse_table, d_aggs.data().get(),
-        static_cast<bitmask_type*>(row_bitmask.data())});
+    if (values_have_nulls) {
+      hash::compute_single_pass_aggs<true, true, Map, decltype(hasher),
+                                     decltype(rows_equal), block_size, cache_size>
+        <<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
+          map, keys.num_rows(), *d_values, *d_sparse_table, d_aggs.data().get(),
+          static_cast<bitmask_type*>(row_bitmask.data()), hasher, rows_equal);
+    } else {
+      hash::compute_single_pass_aggs<true, false, Map, decltype(hasher),
+                                     decltype(rows_equal), block_size, cache_size>
+        <<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
+          map, keys.num_rows(), *d_values, *d_sparse_table, d_aggs.data().get(),
+          static_cast<bitmask_type*>(row_bitmask.data()), hasher, rows_equal);
+    }
   } else {
-    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
-      thrust::make_counting_iterator(0), keys.num_rows(),
-      hash::compute_single_pass_aggs<false, Map>{
-        map, keys.num_rows(), *d_values, *d_sparse_table, d_aggs.data().get(),
-        nullptr});
+    if (values_have_nulls) {
+      hash::compute_single_pass_aggs<false, true, Map, decltype(hasher),
+                                     decltype(rows_equal), block_size, cache_size>
+        <<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
+          map, keys.num_rows(), *d_values, *d_sparse_table, d_aggs.data().get(),
+          nullptr, hasher, rows_equal);
+    } else {
+      hash::compute_single_pass_aggs<false, false, Map, decltype(hasher),
+                                     decltype(rows_equal), block_size, cache_size>
+        <<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
+          map, keys.num_rows(), *d_values, *d_sparse_table, d_aggs.data().get(),
+          nullptr, hasher, rows_equal);
+    }
   }
+  CHECK_CUDA(stream);
 
   // Add results back to sparse_results cache
   auto sparse_result_cols = sparse_table.release();
@@ -306,9 +357,129 @@ void compute_single_pass_aggs(table_view const& keys,
   }
 }
 
+/**
+ * @brief Launches the variance kernel for the dispatched source type
+ */
+template <typename Map>
+struct var_kernel_launcher {
+  template <typename Source>
+  std::enable_if_t<cudf::is_numeric<Source>(), void> operator()(
+      Map const& map, size_type num_values, column_device_view values,
+      bool source_has_nulls, column_device_view group_sum,
+      column_device_view group_count, mutable_column_device_view target,
+      bitmask_type const* row_bitmask, size_type ddof, cudaStream_t stream) {
+    constexpr int block_size{256};
+    experimental::detail::grid_1d config(num_values, block_size);
+    if (source_has_nulls) {
+      hash::compute_var_aggs<Source, true>
+        <<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
+          map, num_values, values, group_sum, group_count, target, row_bitmask,
+          ddof);
+    } else {
+      hash::compute_var_aggs<Source, false>
+        <<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
+          map, num_values, values, group_sum, group_count, target, row_bitmask,
+          ddof);
+    }
+  }
+
+  template <typename Source>
+  std::enable_if_t<not cudf::is_numeric<Source>(), void> operator()(
+      Map const&, size_type, column_device_view, bool, column_device_view,
+      column_device_view, mutable_column_device_view, bitmask_type const*,
+      size_type, cudaStream_t) {
+    CUDF_FAIL("Only numeric types are supported in variance");
+  }
+};
+
+/**
+ * @brief Computes all requested VARIANCE/STD aggregations and stores the
+ * results in `sparse_results`
+ *
+ * Runs after the single pass kernel: one more elementwise pass probes the
+ * populated `map` and accumulates each row's squared deviation from its
+ * group's mean, so no sorting of the values is needed. STD results are the
+ * square root of the accumulated variance.
+ *
+ * @see groupby_null_templated()
+ */
+template <bool keys_have_nulls, typename Map>
+void compute_var_pass(table_view const& keys,
+                      std::vector<aggregation_request> const& requests,
+                      experimental::detail::result_cache* sparse_results,
+                      Map const& map, include_nulls include_null_keys,
+                      cudaStream_t stream)
+{
+  bool const has_var_request = std::any_of(
+      requests.begin(), requests.end(), [](aggregation_request const& r) {
+        return std::any_of(r.aggregations.begin(), r.aggregations.end(),
+                           [](auto const& a) {
+                             return a->kind == aggregation::VARIANCE or
+                                    a->kind == aggregation::STD;
+                           });
+      });
+  if (not has_var_request) { return; }
+
+  bool const skip_key_rows_with_nulls = keys_have_nulls and
+                                        include_null_keys == include_nulls::NO;
+  rmm::device_buffer row_bitmask;
+  if (skip_key_rows_with_nulls) {
+    row_bitmask = bitmask_and(keys, rmm::mr::get_default_resource(), stream);
+  }
+
+  for (size_t i = 0; i < requests.size(); i++) {
+    auto const& values = requests[i].values;
+    for (auto const& agg : requests[i].aggregations) {
+      if (agg->kind != aggregation::VARIANCE and
+          agg->kind != aggregation::STD) { continue; }
+
+      auto var_agg =
+          static_cast<experimental::detail::std_var_aggregation const*>(
+              agg.get());
+      auto sum_agg = make_sum_aggregation();
+      auto count_agg = make_count_aggregation();
+      column_view sum_result = sparse_results->get_result(i, sum_agg);
+      column_view count_result = sparse_results->get_result(i, count_agg);
+
+      // Groups where no row contributes (count <= ddof) stay null
+      auto result = make_fixed_width_column(
+          experimental::detail::target_type(values.type(), agg->kind),
+          values.size(), mask_state::ALL_NULL, stream);
+      auto result_view = result->mutable_view();
+      thrust::fill(rmm::exec_policy(stream)->on(stream),
+                   result_view.begin<double>(), result_view.end<double>(),
+                   0.0);
+
+      auto d_values = column_device_view::create(values, stream);
+      auto d_sum = column_device_view::create(sum_result, stream);
+      auto d_count = column_device_view::create(count_result, stream);
+      auto d_result = mutable_column_device_view::create(result_view, stream);
+
+      experimental::type_dispatcher(
+          values.type(), var_kernel_launcher<Map>{}, map, values.size(),
+          *d_values, values.has_nulls(), *d_sum, *d_count, *d_result,
+          skip_key_rows_with_nulls
+              ? static_cast<bitmask_type const*>(row_bitmask.data()) : nullptr,
+          var_agg->_ddof, stream);
+
+      if (agg->kind == aggregation::STD) {
+        thrust::transform(rmm::exec_policy(stream)->on(stream),
+                          result_view.begin<double>(),
+                          result_view.end<double>(),
+                          result_view.begin<double>(),
+                          [] __device__(double var) { return sqrt(var); });
+      }
+      CHECK_CUDA(stream);
+
+      result->set_null_count(UNKNOWN_NULL_COUNT);
+      sparse_results->add_result(i, agg, std::move(result));
+    }
+  }
+}
+
 /**
  * @brief Computes and returns a device vector containing all populated keys in
- * `map`. 
+ * `map`.
  */
 template <typename Map>
 std::pair<rmm::device_vector<size_type>, size_type> extract_populated_keys(
@@ -370,7 +541,7 @@ std::unique_ptr<table> groupby_null_templated(
     rmm::mr::device_memory_resource* mr)
 {
   auto d_keys = table_device_view::create(keys);
-  auto map = create_hash_map<keys_have_nulls>(*d_keys, include_null_keys, stream);
+  auto map = create_hash_map<keys_have_nulls>(*d_keys, include_null_keys, mr, stream);
 
   // Cache of sparse results where the location of aggregate value in each
   // column is indexed by the hash map
@@ -380,8 +551,10 @@ std::unique_ptr<table> groupby_null_templated(
   compute_single_pass_aggs<keys_have_nulls>(
     keys, requests, &sparse_results, *map, include_null_keys, stream);
 
-  // Now continue with remaining multi-pass aggs
-  // <placeholder>
+  // Now continue with the multi-pass aggs: VARIANCE/STD probe the populated
+  // map once more using the single pass SUM and COUNT_VALID results
+  compute_var_pass<keys_have_nulls>(keys, requests, &sparse_results, *map,
+                                    include_null_keys, stream);
 
   // Extract the populated indices from the hash map and create a gather map.
   // Gathering using this map from sparse results will give dense results.
@@ -399,6 +572,83 @@ std::unique_ptr<table> groupby_null_templated(
   return unique_keys;
 }
 
+/**
+ * @brief Returns a view of `keys` with every dictionary column replaced by a
+ * view of its int32 indices.
+ *
+ * Dictionary keys are a sorted set of unique values, so within one column
+ * equal indices imply equal values and vice versa. Hashing and comparing the
+ * indices therefore groups rows exactly as the materialized values would,
+ * without decoding them.
+ *
+ * The substituted view carries the parent's offset, size and null mask so
+ * null key handling is unchanged.
+ */
+table_view dictionary_flattened_keys(table_view const& keys) {
+  std::vector<column_view> columns(keys.begin(), keys.end());
+  std::transform(columns.begin(), columns.end(), columns.begin(),
+                 [](column_view const& col) {
+                   return (col.type().id() == type_id::DICTIONARY32)
+                       ? dictionary_column_view(col).get_indices_annotated()
+                       : col;
+                 });
+  return table_view{columns};
+}
+
+/**
+ * @brief Re-wraps gathered index columns in `unique_keys` as dictionary
+ * columns sharing the corresponding input column's keys.
+ *
+ * Grouping ran on the flattened indices, so the gathered unique key columns
+ * for dictionary inputs are plain INT32 columns; this restores the dictionary
+ * type of the input in the output.
+ */
+std::unique_ptr<table> dictionary_rebuilt_keys(
+    table_view const& keys, std::unique_ptr<table>&& unique_keys,
+    cudaStream_t stream, rmm::mr::device_memory_resource* mr) {
+  auto columns = unique_keys->release();
+  for (size_type i = 0; i < keys.num_columns(); i++) {
+    if (keys.column(i).type().id() != type_id::DICTIONARY32) { continue; }
+
+    dictionary_column_view dict(keys.column(i));
+    auto indices = std::move(columns[i]);
+    auto const num_rows = indices->size();
+    auto const null_count = indices->null_count();
+
+    // The gathered indices carry the null mask; the factory expects it
+    // separately from a non-nullable indices column
+    auto contents = indices->release();
+    columns[i] = make_dictionary_column(
+        std::make_unique<column>(dict.keys(), stream, mr),
+        std::make_unique<column>(data_type{type_to_id<int32_t>()}, num_rows,
+                                 std::move(*(contents.data))),
+        std::move(*(contents.null_mask)), null_count);
+  }
+  return std::make_unique<table>(std::move(columns));
+}
+
+/**
+ * @brief Estimates the device memory the in-core hash groupby needs beyond
+ * its inputs: the hash table plus one sparse result column per flattened
+ * aggregation, each sized by the input row count.
+ */
+std::size_t estimated_working_set_bytes(
+    table_view const& keys, std::vector<aggregation_request> const& requests) {
+  std::size_t const num_rows = keys.num_rows();
+  std::size_t bytes =
+      compute_hash_table_size(keys.num_rows()) * 2 * sizeof(size_type);
+
+  table_view flattened_values;
+  std::vector<aggregation::Kind> aggs;
+  std::vector<size_t> col_ids;
+  std::tie(flattened_values, aggs, col_ids) = flatten_single_pass_aggs(requests);
+  for (size_t i = 0; i < aggs.size(); i++) {
+    bytes += num_rows * cudf::size_of(experimental::detail::target_type(
+        flattened_values.column(i).type(), aggs[i]));
+  }
+  return bytes;
+}
+
 }  // namespace
 
 /**
@@ -417,7 +667,15 @@ bool can_use_hash_groupby(table_view const& keys,
       requests.begin(), requests.end(), [](aggregation_request const& r) {
         return std::all_of(
             r.aggregations.begin(), r.aggregations.end(),
-            [](auto const& a) { return is_hash_aggregation(a->kind); });
+            [&r](auto const& a) {
+              // VARIANCE/STD are computed without sorting via a second pass
+              // over the hash map, but only for numeric values
+              if (a->kind == aggregation::VARIANCE or
+                  a->kind == aggregation::STD) {
+                return cudf::is_numeric(r.values.type());
+              }
+              return is_hash_aggregation(a->kind);
+            });
       });
 }
 
@@ -429,16 +687,51 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
 {
   experimental::detail::result_cache cache(requests.size());
 
+  // Group dictionary key columns by their indices instead of decoding them
+  bool const has_dictionary_keys =
+      std::any_of(keys.begin(), keys.end(), [](column_view const& col) {
+        return col.type().id() == type_id::DICTIONARY32;
+      });
+  auto grouping_keys = has_dictionary_keys
+      ? dictionary_flattened_keys(keys) : keys;
+
+  // When the hash table and sparse result columns cannot fit alongside the
+  // input, degrade to partitioned aggregation with host staging instead of
+  // failing allocation
+  std::size_t const working_set =
+      estimated_working_set_bytes(grouping_keys, requests);
+  std::size_t free_memory{}, total_memory{};
+  CUDA_TRY(cudaMemGetInfo(&free_memory, &total_memory));
+  if (working_set > free_memory / 2) {
+    size_type num_partitions{2};
+    while (num_partitions < 256 and
+           working_set / num_partitions > free_memory / 4) {
+      num_partitions *= 2;
+    }
+    auto result = spilled_groupby(grouping_keys, requests, include_null_keys,
+                                  num_partitions, stream, mr);
+    if (has_dictionary_keys) {
+      result.first = dictionary_rebuilt_keys(keys, std::move(result.first),
+                                             stream, mr);
+    }
+    return result;
+  }
+
   std::unique_ptr<table> unique_keys;
-  if (has_nulls(keys)) {
-    unique_keys = groupby_null_templated<true>(keys, requests, &cache, 
+  if (has_nulls(grouping_keys)) {
+    unique_keys = groupby_null_templated<true>(grouping_keys, requests, &cache,
                                                include_null_keys, stream, mr);
   } else {
-    unique_keys = groupby_null_templated<false>(keys, requests, &cache,
+    unique_keys = groupby_null_templated<false>(grouping_keys, requests, &cache,
                                                 include_null_keys, stream, mr);
   }
 
-  return std::make_pair(std::move(unique_keys), extract_results(requests, cache));  
+  if (has_dictionary_keys) {
+    unique_keys = dictionary_rebuilt_keys(keys, std::move(unique_keys),
+                                          stream, mr);
+  }
+
+  return std::make_pair(std::move(unique_keys), extract_results(requests, cache));
 }
 }  // namespace hash
 }  // namespace detail
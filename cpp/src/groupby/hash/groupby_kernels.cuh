@@ -21,6 +21,8 @@
 #include <cudf/detail/aggregation/aggregation.cuh>
 #include <cudf/utilities/bit.hpp>
 
+#include <limits>
+
 namespace cudf {
 namespace experimental {
 namespace groupby {
@@ -59,62 +61,142 @@ namespace hash {
  * rows. In this way, after all rows are aggregated, `output_values` will likely
  * be "sparse", meaning that not all rows contain the result of an aggregation.
  *
+ * To cut down traffic to the global hash map, each thread block keeps a small
+ * shared memory cache of recently resolved keys. Every cache entry packs a
+ * representative key row index together with its resolved output row into one
+ * 64-bit word, so a racy overwrite can never pair the key of one group with
+ * the output row of another. A row whose key matches the cached entry for its
+ * hash slot skips the global map probe entirely, which for low-cardinality
+ * keys removes almost all global map traffic; for high-cardinality keys the
+ * cache simply misses and the cost is one shared memory lookup per row.
+ *
  * @tparam skip_rows_with_nulls Indicates if rows in `input_keys` containing
  * null values should be skipped. It `true`, it is assumed `row_bitmask` is a
  * bitmask where bit `i` indicates the presence of a null value in row `i`.
+ * @tparam values_have_nulls Indicates if any column of `input_values`
+ * contains null values; when `false` the per-element validity tests in the
+ * aggregators compile out entirely.
  * @tparam Map The type of the hash map
+ * @tparam RowHasher The type of the row hasher over the keys table
+ * @tparam RowEquality The type of the row equality comparator over the keys
+ * table
+ * @tparam block_size The number of threads per block for this kernel
+ * @tparam cache_size The number of entries in the per-block key cache
+ *
+ * @param map Hash map object to insert key,value pairs into.
+ * @param num_keys The number of rows in input keys table
+ * @param input_values The table whose rows will be aggregated in the values
+ * of the hash map
+ * @param output_values Table that stores the results of aggregating rows of
+ * `input_values`.
+ * @param aggs The set of aggregation operations to perform accross the
+ * columns of the `input_values` rows
+ * @param row_bitmask Bitmask where bit `i` indicates the presence of a null
+ * value in row `i` of input keys. Only used if `skip_rows_with_nulls` is
+ * `true`
+ * @param row_hasher Hasher used to pick the cache slot of a key row; hashes
+ * the same way the global map does
+ * @param rows_equal Comparator that checks two key row indices for equality
  */
-template <bool skip_rows_with_nulls, typename Map>
-struct compute_single_pass_aggs {
-  Map map;
-  size_type num_keys;
-  table_device_view input_values;
-  mutable_table_device_view output_values; 
-  aggregation::Kind const* __restrict__ aggs;
-  bitmask_type const*  __restrict__ row_bitmask;
-
-  /**
-   * @brief Construct a new compute_single_pass_aggs functor object
-   * 
-   * @param map Hash map object to insert key,value pairs into.
-   * @param num_keys The number of rows in input keys table
-   * @param input_values The table whose rows will be aggregated in the values 
-   * of the hash map
-   * @param output_values Table that stores the results of aggregating rows of
-   * `input_values`.
-   * @param aggs The set of aggregation operations to perform accross the 
-   * columns of the `input_values` rows
-   * @param row_bitmask Bitmask where bit `i` indicates the presence of a null
-   * value in row `i` of input keys. Only used if `skip_rows_with_nulls` is `true`
-   */
-  compute_single_pass_aggs(
-    Map map,
-    size_type num_keys,
-    table_device_view input_values,
-    mutable_table_device_view output_values, 
-    aggregation::Kind const* aggs,
-    bitmask_type const* row_bitmask)
-  : map(map),
-    num_keys(num_keys),
-    input_values(input_values),
-    output_values(output_values),
-    aggs(aggs),
-    row_bitmask(row_bitmask)
-  {}
-
-  __device__ void operator()(size_type i) {
-    if (not skip_rows_with_nulls or
-        cudf::bit_is_set(row_bitmask, i))
-    {
-      auto result = map.insert(thrust::make_pair(i, i));
-
-      experimental::detail::aggregate_row<true, true>(
-        output_values, result.first->second, input_values, i, aggs);
+template <bool skip_rows_with_nulls, bool values_have_nulls, typename Map,
+          typename RowHasher, typename RowEquality, int block_size,
+          int cache_size>
+__global__ void compute_single_pass_aggs(
+    Map map, size_type num_keys, table_device_view input_values,
+    mutable_table_device_view output_values,
+    aggregation::Kind const* __restrict__ aggs,
+    bitmask_type const* __restrict__ row_bitmask,
+    RowHasher row_hasher, RowEquality rows_equal) {
+  // Packed (key row index << 32 | output row index) entries. Aligned 64-bit
+  // shared memory stores are performed as a single access, keeping the two
+  // halves of an entry consistent without locks.
+  constexpr unsigned long long unused_entry{
+      std::numeric_limits<unsigned long long>::max()};
+  __shared__ unsigned long long key_cache[cache_size];
+
+  for (int j = threadIdx.x; j < cache_size; j += block_size) {
+    key_cache[j] = unused_entry;
+  }
+  __syncthreads();
+
+  const size_type start_idx = threadIdx.x + blockIdx.x * blockDim.x;
+  const size_type stride = blockDim.x * gridDim.x;
+
+  for (size_type i = start_idx; i < num_keys; i += stride) {
+    if (not skip_rows_with_nulls or cudf::bit_is_set(row_bitmask, i)) {
+      const int slot = row_hasher(i) % cache_size;
+      const unsigned long long entry = key_cache[slot];
+      size_type output_index;
+
+      if (entry != unused_entry and
+          rows_equal(static_cast<size_type>(entry >> 32), i)) {
+        output_index = static_cast<size_type>(entry & 0xffffffffull);
+      } else {
+        auto result = map.insert(thrust::make_pair(i, i));
+        output_index = result.first->second;
+        key_cache[slot] = (static_cast<unsigned long long>(i) << 32) |
+                          static_cast<unsigned long long>(
+                              static_cast<uint32_t>(output_index));
+      }
+
+      // the sparse targets are only nullable when the values have nulls, so
+      // both sides of the validity handling can compile out together
+      experimental::detail::aggregate_row<values_have_nulls, values_have_nulls>(
+          output_values, output_index, input_values, i, aggs);
     }
   }
-};
+}
 
-// TODO (dm): variance kernel
+/**
+ * @brief Computes per-group variance contributions in one elementwise pass
+ * over the input, reusing the hash map built by the single pass kernel.
+ *
+ * For each non-null value, the row's group is found in `map` and the squared
+ * deviation from the group mean — derived from the sparse SUM and COUNT_VALID
+ * results of the single pass — is added to the group's slot in `target`,
+ * already divided by `count - ddof`. Groups with `count <= ddof` keep their
+ * null initialization. A group's slot becomes valid as soon as any of its
+ * rows contributes.
+ *
+ * @tparam Source The type of the source values
+ * @tparam source_has_nulls Indicates if `source` contains null values; when
+ * `false` the per-element validity test compiles out.
+ * @tparam Map The type of the hash map
+ */
+template <typename Source, bool source_has_nulls, typename Map>
+__global__ void compute_var_aggs(Map map, size_type num_values,
+                                 column_device_view source,
+                                 column_device_view group_sum,
+                                 column_device_view group_count,
+                                 mutable_column_device_view target,
+                                 bitmask_type const* __restrict__ row_bitmask,
+                                 size_type ddof) {
+  using SumType = experimental::detail::target_type_t<Source, aggregation::SUM>;
+
+  const size_type start_idx = threadIdx.x + blockIdx.x * blockDim.x;
+  const size_type stride = blockDim.x * gridDim.x;
+
+  for (size_type i = start_idx; i < num_values; i += stride) {
+    if (row_bitmask != nullptr and not cudf::bit_is_set(row_bitmask, i))
+      continue;
+    if (source_has_nulls and source.is_null(i)) continue;
+
+    auto const found = map.find(i);
+    if (found == map.end()) continue;
+    size_type const j = found->second;
+
+    double const count = group_count.element<size_type>(j);
+    if (count <= ddof) continue;
+
+    double const mean =
+        static_cast<double>(group_sum.element<SumType>(j)) / count;
+    double const x = static_cast<double>(source.element<Source>(i));
+
+    atomicAdd(&target.element<double>(j), (x - mean) * (x - mean) /
+                                          (count - ddof));
+    cudf::set_bit(target.null_mask(), j);
+  }
+}
 
 }  // namespace hash
 }  // namespace detail
@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <groupby/hash/spill_groupby.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/groupby.hpp>
+#include <cudf/detail/hashing.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace experimental {
+namespace groupby {
+namespace detail {
+namespace hash {
+namespace {
+
+/**
+ * @brief Owning pinned host allocation used to stage spilled partitions
+ */
+struct pinned_host_buffer {
+  explicit pinned_host_buffer(std::size_t size) : _size{size} {
+    CUDA_TRY(cudaMallocHost(&_data, size));
+  }
+
+  ~pinned_host_buffer() {
+    if (_data != nullptr) { cudaFreeHost(_data); }
+  }
+
+  pinned_host_buffer(pinned_host_buffer const&) = delete;
+  pinned_host_buffer& operator=(pinned_host_buffer const&) = delete;
+
+  pinned_host_buffer(pinned_host_buffer&& other)
+      : _data{other._data}, _size{other._size} {
+    other._data = nullptr;
+    other._size = 0;
+  }
+
+  void* data() const noexcept { return _data; }
+  std::size_t size() const noexcept { return _size; }
+
+ private:
+  void* _data{nullptr};
+  std::size_t _size{0};
+};
+
+/**
+ * @brief Buffer-relative description of a column in a contiguous partition
+ *
+ * A partition produced by `contiguous_split` lives in one device buffer.
+ * After the buffer makes a round trip through host memory it comes back at a
+ * different device address, so the views into it are recorded as offsets from
+ * the buffer base and rebuilt against the new base.
+ */
+struct spilled_column {
+  data_type type{EMPTY};
+  size_type size{};
+  std::size_t data_offset{};
+  bool has_data{false};
+  std::size_t null_mask_offset{};
+  bool has_null_mask{false};
+  size_type null_count{};
+  std::vector<spilled_column> children;
+};
+
+spilled_column record_column(column_view const& col, char const* base) {
+  spilled_column meta;
+  meta.type = col.type();
+  meta.size = col.size();
+  if (col.head<char>() != nullptr) {
+    meta.has_data = true;
+    meta.data_offset = col.head<char>() - base;
+  }
+  if (col.null_mask() != nullptr) {
+    meta.has_null_mask = true;
+    meta.null_mask_offset =
+        reinterpret_cast<char const*>(col.null_mask()) - base;
+    meta.null_count = col.null_count();
+  }
+  for (size_type i = 0; i < col.num_children(); ++i) {
+    meta.children.push_back(record_column(col.child(i), base));
+  }
+  return meta;
+}
+
+column_view rebuild_column(spilled_column const& meta, char const* base) {
+  std::vector<column_view> children;
+  for (auto const& child : meta.children) {
+    children.push_back(rebuild_column(child, base));
+  }
+  return column_view(
+      meta.type, meta.size,
+      meta.has_data ? static_cast<void const*>(base + meta.data_offset)
+                    : nullptr,
+      meta.has_null_mask
+          ? reinterpret_cast<bitmask_type const*>(base + meta.null_mask_offset)
+          : nullptr,
+      meta.has_null_mask ? meta.null_count : 0, 0, children);
+}
+
+struct typed_agg_clone {
+  aggregation const* agg;
+
+  template <aggregation::Kind k>
+  std::unique_ptr<aggregation> operator()() const {
+    using agg_type = experimental::detail::kind_to_type<k>;
+    return std::make_unique<agg_type>(*static_cast<agg_type const*>(agg));
+  }
+};
+
+std::unique_ptr<aggregation> clone_aggregation(aggregation const* agg) {
+  return experimental::detail::aggregation_dispatcher(agg->kind,
+                                                      typed_agg_clone{agg});
+}
+
+}  // namespace
+
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>>
+spilled_groupby(table_view const& keys,
+                std::vector<aggregation_request> const& requests,
+                include_nulls include_null_keys, size_type num_partitions,
+                cudaStream_t stream, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(num_partitions >= 2, "Spilled groupby needs >= 2 partitions");
+
+  // Combine keys and values into one table so partitioning moves them
+  // together, keeping every row's values aligned with its key
+  std::vector<column_view> combined(keys.begin(), keys.end());
+  std::vector<size_type> key_indices(keys.num_columns());
+  std::iota(key_indices.begin(), key_indices.end(), 0);
+  for (auto const& request : requests) { combined.push_back(request.values); }
+
+  // Partition rows by key hash; equal keys land in the same partition, so no
+  // group spans partitions
+  std::unique_ptr<table> partitioned;
+  std::vector<size_type> offsets;
+  std::tie(partitioned, offsets) = cudf::detail::hash_partition(
+      table_view{combined}, key_indices, num_partitions,
+      rmm::mr::get_default_resource(), stream);
+
+  // Deep-copy each partition into its own contiguous buffer and stage the
+  // buffers in pinned host memory, so that from here on only one partition's
+  // rows are resident on device at a time
+  std::vector<size_type> splits(offsets.begin() + 1, offsets.end());
+  auto parts = experimental::contiguous_split(partitioned->view(), splits);
+  partitioned.reset();
+
+  struct spilled_partition {
+    pinned_host_buffer buffer;
+    std::vector<spilled_column> columns;
+    size_type num_rows;
+  };
+
+  std::vector<spilled_partition> spilled;
+  for (auto& part : parts) {
+    char const* base = static_cast<char const*>(part.all_data->data());
+    spilled_partition sp{pinned_host_buffer(part.all_data->size()), {},
+                         part.table.num_rows()};
+    for (auto const& col : part.table) {
+      sp.columns.push_back(record_column(col, base));
+    }
+    CUDA_TRY(cudaMemcpyAsync(sp.buffer.data(), part.all_data->data(),
+                             part.all_data->size(), cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    part.all_data.reset();
+    spilled.push_back(std::move(sp));
+  }
+  parts.clear();
+
+  // Aggregate partition by partition. If a partition's working set is still
+  // too large, the groupby it calls will spill again with a finer split.
+  std::vector<std::pair<std::unique_ptr<table>, std::vector<aggregation_result>>>
+      part_results;
+  for (auto const& sp : spilled) {
+    if (sp.num_rows == 0) { continue; }
+
+    rmm::device_buffer d_part(sp.buffer.size(), stream);
+    CUDA_TRY(cudaMemcpyAsync(d_part.data(), sp.buffer.data(), sp.buffer.size(),
+                             cudaMemcpyHostToDevice, stream));
+
+    char const* base = static_cast<char const*>(d_part.data());
+    std::vector<column_view> columns;
+    for (auto const& meta : sp.columns) {
+      columns.push_back(rebuild_column(meta, base));
+    }
+
+    std::vector<column_view> part_keys(columns.begin(),
+                                       columns.begin() + keys.num_columns());
+
+    std::vector<aggregation_request> part_requests;
+    for (size_t r = 0; r < requests.size(); r++) {
+      aggregation_request part_request;
+      part_request.values = columns[keys.num_columns() + r];
+      for (auto const& agg : requests[r].aggregations) {
+        part_request.aggregations.push_back(clone_aggregation(agg.get()));
+      }
+      part_requests.push_back(std::move(part_request));
+    }
+
+    part_results.push_back(groupby(table_view{part_keys}, part_requests,
+                                   include_null_keys, stream, mr));
+  }
+
+  // Groups are disjoint across partitions, so the final result is the
+  // concatenation of the per-partition results
+  std::vector<table_view> unique_key_views;
+  for (auto const& part_result : part_results) {
+    unique_key_views.push_back(part_result.first->view());
+  }
+  auto unique_keys = experimental::concatenate(unique_key_views, mr);
+
+  std::vector<aggregation_result> results;
+  for (size_t r = 0; r < requests.size(); r++) {
+    aggregation_result result;
+    for (size_t j = 0; j < requests[r].aggregations.size(); j++) {
+      std::vector<column_view> part_columns;
+      for (auto const& part_result : part_results) {
+        part_columns.push_back(part_result.second[r].results[j]->view());
+      }
+      result.results.push_back(cudf::concatenate(part_columns, mr));
+    }
+    results.push_back(std::move(result));
+  }
+
+  return std::make_pair(std::move(unique_keys), std::move(results));
+}
+
+}  // namespace hash
+}  // namespace detail
+}  // namespace groupby
+}  // namespace experimental
+}  // namespace cudf
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/groupby.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace experimental {
+namespace groupby {
+namespace detail {
+namespace hash {
+
+/**
+ * @brief Computes a hash groupby one partition at a time, staging partitions
+ * in pinned host memory.
+ *
+ * The input rows are hash-partitioned on the keys so that equal keys land in
+ * the same partition, each partition is copied to a contiguous pinned host
+ * buffer, and partitions are then brought back and aggregated one at a time.
+ * Since no group spans partitions, the final result is the concatenation of
+ * the per-partition results.
+ *
+ * Used as a fallback when the working set of the in-core hash groupby (hash
+ * table plus sparse result columns) would not fit in available device memory,
+ * e.g. when group cardinality approaches the row count. Only the partitioning
+ * pass and one partition's aggregation are resident on device at a time.
+ *
+ * @param keys Table whose rows act as the groupby keys
+ * @param requests The set of columns to aggregate and the aggregations to
+ * perform; all must be hash aggregations
+ * @param include_null_keys Whether to include rows in `keys` with nulls
+ * @param num_partitions Number of hash partitions; must be at least 2
+ * @param stream CUDA stream on which to execute
+ * @param mr Memory resource used to allocate the returned results
+ */
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>>
+spilled_groupby(table_view const& keys,
+                std::vector<aggregation_request> const& requests,
+                include_nulls include_null_keys, size_type num_partitions,
+                cudaStream_t stream, rmm::mr::device_memory_resource* mr);
+
+}  // namespace hash
+}  // namespace detail
+}  // namespace groupby
+}  // namespace experimental
+}  // namespace cudf
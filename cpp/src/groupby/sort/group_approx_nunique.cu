@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/detail/utilities/device_atomics.cuh>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+#include <thrust/for_each.h>
+
+namespace cudf {
+namespace experimental {
+namespace groupby {
+namespace detail {
+
+namespace {
+
+// 2^11 registers per group give a relative standard error of about
+// 1.04/sqrt(2048) ~= 2.3%. A register stores a rank of at most
+// 32 - hll_precision + 1, which comfortably fits an int8_t.
+constexpr int hll_precision{11};
+constexpr size_type hll_num_registers{1 << hll_precision};
+
+/**
+ * @brief Updates the sketch registers of every group with the hash of each
+ * of its values
+ *
+ * The top `hll_precision` bits of a value's hash select the register; the
+ * rank is one plus the number of leading zeros of the remaining bits. Ranks
+ * merge with `atomicMax`, so value order and duplicates do not change the
+ * sketch.
+ */
+template <bool has_nulls>
+void update_sketches(column_view const& values,
+                     size_type const* group_labels,
+                     int8_t* registers,
+                     int8_t* group_has_null,
+                     include_nulls _include_nulls,
+                     cudaStream_t stream) {
+  auto values_view = column_device_view::create(values, stream);
+  auto values_table = table_device_view::create(table_view{{values}}, stream);
+  row_hasher<default_hash, has_nulls> hasher{*values_table};
+
+  thrust::for_each_n(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator<size_type>(0), values.size(),
+      [v = *values_view, hasher, group_labels, registers, group_has_null,
+       _include_nulls] __device__(size_type i) {
+        if (has_nulls and v.is_null_nocheck(i)) {
+          if (_include_nulls == include_nulls::YES) {
+            group_has_null[group_labels[i]] = 1;
+          }
+          return;
+        }
+        const hash_value_type hash_value = hasher(i);
+        const size_type register_index = hash_value >> (32 - hll_precision);
+        const uint32_t remaining = hash_value << hll_precision;
+        const int8_t rank = (remaining == 0)
+            ? static_cast<int8_t>(32 - hll_precision + 1)
+            : static_cast<int8_t>(__clz(remaining) + 1);
+        cudf::atomicMax(
+            &registers[group_labels[i] * hll_num_registers + register_index],
+            rank);
+      });
+}
+
+}  // namespace
+
+std::unique_ptr<column> group_approx_nunique(
+    column_view const& values,
+    rmm::device_vector<size_type> const& group_labels,
+    size_type const num_groups,
+    include_nulls _include_nulls,
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream)
+{
+  CUDF_EXPECTS(num_groups >= 0, "number of groups cannot be negative");
+  CUDF_EXPECTS(static_cast<size_t>(values.size()) == group_labels.size(),
+               "Size of values column should be same as that of group labels");
+
+  auto result = make_numeric_column(data_type(type_to_id<size_type>()),
+                                    num_groups,
+                                    mask_state::UNALLOCATED, stream, mr);
+
+  if (num_groups == 0) {
+    return result;
+  }
+
+  rmm::device_vector<int8_t> registers(
+      static_cast<size_t>(num_groups) * hll_num_registers, 0);
+  rmm::device_vector<int8_t> group_has_null(num_groups, 0);
+
+  if (values.has_nulls()) {
+    update_sketches<true>(values, group_labels.data().get(),
+                          registers.data().get(), group_has_null.data().get(),
+                          _include_nulls, stream);
+  } else {
+    update_sketches<false>(values, group_labels.data().get(),
+                           registers.data().get(), group_has_null.data().get(),
+                           _include_nulls, stream);
+  }
+
+  // One thread per group folds its registers into the estimate. The raw
+  // estimate is corrected with linear counting for small cardinalities, as
+  // in the original HyperLogLog paper.
+  int8_t const* d_registers = registers.data().get();
+  int8_t const* d_group_has_null = group_has_null.data().get();
+  size_type* d_result = result->mutable_view().data<size_type>();
+
+  thrust::for_each_n(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator<size_type>(0), num_groups,
+      [d_registers, d_group_has_null, d_result] __device__(size_type group) {
+        constexpr double m{static_cast<double>(hll_num_registers)};
+        const double alpha = 0.7213 / (1.0 + 1.079 / m);
+
+        double sum{0};
+        size_type zero_registers{0};
+        for (size_type j = 0; j < hll_num_registers; ++j) {
+          const int8_t rank = d_registers[group * hll_num_registers + j];
+          sum += exp2(static_cast<double>(-rank));
+          if (rank == 0) { ++zero_registers; }
+        }
+
+        double estimate = alpha * m * m / sum;
+        if (estimate <= 2.5 * m and zero_registers != 0) {
+          estimate = m * log(m / zero_registers);
+        }
+
+        d_result[group] = static_cast<size_type>(estimate + 0.5) +
+                          d_group_has_null[group];
+      });
+
+  return result;
+}
+
+}  // namespace detail
+}  // namespace groupby
+}  // namespace experimental
+}  // namespace cudf
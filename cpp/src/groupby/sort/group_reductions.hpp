@@ -209,6 +209,31 @@ std::unique_ptr<column> group_nunique(
     rmm::mr::device_memory_resource* mr,
     cudaStream_t stream = 0);
 
+/**
+ * @brief Internal API to estimate the number of unique values in each group
+ * of @p values using per-group HyperLogLog sketches
+ *
+ * Unlike `group_nunique`, the values do not need to be sorted within each
+ * group; a single pass updates the sketch registers and a second small pass
+ * over the groups computes the estimates. The relative standard error of the
+ * estimate is about 2.3%.
+ *
+ * @param values Grouped values to estimate the unique count of
+ * @param group_labels ID of group that the corresponding value belongs to
+ * @param num_groups Number of groups ( unique values in @p group_labels )
+ * @param _include_nulls If include_nulls::YES, a null value counts as one
+ *  additional unique value in groups that contain one; else nulls are skipped
+ * @param mr Memory resource to allocate output with
+ * @param stream Stream to perform computation in
+ */
+std::unique_ptr<column> group_approx_nunique(
+    column_view const& values,
+    rmm::device_vector<size_type> const& group_labels,
+    size_type const num_groups,
+    include_nulls _include_nulls,
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream = 0);
+
 /**
  * @brief Internal API to calculate nth values in each group of  @p values
  *
@@ -15,6 +15,7 @@
  */
 
 #include "group_reductions.hpp"
+#include <groupby/common/cached_results.hpp>
 #include <groupby/common/utils.hpp>
 
 #include <cudf/column/column.hpp>
@@ -314,7 +315,8 @@ void store_result_functor::operator()<aggregation::STD>(
   column_view var_result = cache.get_result(col_idx, var_agg);
 
   auto result = experimental::detail::unary_operation(
-    var_result, experimental::unary_op::SQRT, mr, stream);
+    var_result, experimental::unary_op::SQRT,
+    experimental::accuracy_mode::PRECISE, mr, stream);
   cache.add_result(col_idx, agg, std::move(result));
 };
 
@@ -373,6 +375,26 @@ void store_result_functor::operator()<aggregation::NUNIQUE>(
   cache.add_result(col_idx, agg, std::move(result));
 };
 
+template <>
+void store_result_functor::operator()<aggregation::APPROX_NUNIQUE>(
+  std::unique_ptr<aggregation> const& agg)
+{
+  if (cache.has_result(col_idx, agg))
+    return;
+
+  auto approx_nunique_agg =
+    static_cast<experimental::detail::nunique_aggregation const*>(agg.get());
+
+  // The sketch update is order independent, so grouped (unsorted within
+  // group) values suffice
+  auto result = detail::group_approx_nunique(get_grouped_values(),
+                            helper.group_labels(),
+                            helper.num_groups(),
+                            approx_nunique_agg->_include_nulls,
+                            mr, stream);
+  cache.add_result(col_idx, agg, std::move(result));
+};
+
 template <>
 void store_result_functor::operator()<aggregation::NTH_ELEMENT>(
   std::unique_ptr<aggregation> const& agg)
@@ -404,8 +426,28 @@ void store_result_functor::operator()<aggregation::NTH_ELEMENT>(
 }
 }  // namespace detail
 
+namespace {
+
+struct typed_agg_clone {
+  aggregation const* agg;
+
+  template <aggregation::Kind k>
+  std::unique_ptr<aggregation> operator()() const {
+    using agg_type = experimental::detail::kind_to_type<k>;
+    return std::make_unique<agg_type>(*static_cast<agg_type const*>(agg));
+  }
+};
+
+/// Makes an owning copy of an aggregation, preserving its derived type
+std::unique_ptr<aggregation> clone_aggregation(aggregation const* agg) {
+  return experimental::detail::aggregation_dispatcher(agg->kind,
+                                                      typed_agg_clone{agg});
+}
+
+}  // namespace
+
 // Sort-based groupby
-std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> 
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>>
 groupby::sort_aggregate(
     std::vector<aggregation_request> const& requests,
     cudaStream_t stream, rmm::mr::device_memory_resource* mr)
@@ -414,8 +456,24 @@ groupby::sort_aggregate(
   // depend on other aggs will not have to be recalculated. e.g. mean depends on
   // sum and count. std depends on mean and count
   experimental::detail::result_cache cache(requests.size());
-  
+
   for (size_t i = 0; i < requests.size(); i++) {
+    // When cross-call caching is enabled, seed this call's cache with every
+    // result retained for these values. Direct hits are then returned from
+    // the cache and dependent aggregations (e.g. the COUNT that VARIANCE
+    // needs) find their inputs precomputed.
+    cached_results::result_map* session_results = nullptr;
+    if (_cached_results) {
+      session_results = &_cached_results->results_for(requests[i].values);
+      for (auto const& entry : *session_results) {
+        auto agg = clone_aggregation(entry.first.get());
+        if (not cache.has_result(i, agg)) {
+          cache.add_result(i, agg,
+            std::make_unique<column>(entry.second->view(), stream, mr));
+        }
+      }
+    }
+
     auto store_functor = detail::store_result_functor(i, requests[i].values,
                                     helper(), cache, stream, mr);
     for (size_t j = 0; j < requests[i].aggregations.size(); j++) {
@@ -425,10 +483,23 @@ groupby::sort_aggregate(
         store_functor,
         requests[i].aggregations[j]);
     }
-  }  
-  
+
+    // Retain the requested results for later calls. The copies outlive this
+    // call, so they are allocated with the default resource.
+    if (session_results) {
+      for (auto const& agg : requests[i].aggregations) {
+        std::shared_ptr<aggregation> key{clone_aggregation(agg.get())};
+        if (session_results->find(key) == session_results->end() and
+            cache.has_result(i, agg)) {
+          (*session_results)[std::move(key)] =
+            std::make_unique<column>(cache.get_result(i, agg), stream);
+        }
+      }
+    }
+  }
+
   auto results = detail::extract_results(requests, cache);
-  
+
   return std::make_pair(helper().unique_keys(mr, stream),
                         std::move(results));
 }
@@ -53,8 +53,9 @@ struct default_allocator {
       rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource();
 
       default_allocator() = default;
+      constexpr explicit default_allocator(rmm::mr::device_memory_resource* _mr) noexcept : mr(_mr) {}
 
-      template <class U> constexpr default_allocator(const default_allocator<U>&) noexcept {}
+      template <class U> constexpr default_allocator(const default_allocator<U>& other) noexcept : mr(other.mr) {}
 
       T* allocate(std::size_t n, cudaStream_t stream = 0) const {
           return static_cast<T*>(mr->allocate( n*sizeof(T), stream ));
@@ -19,6 +19,7 @@
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/utilities/traits.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/detail/scatter.cuh>
@@ -26,6 +27,8 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 
 #include <thrust/tabulate.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/iterator/counting_iterator.h>
 
 namespace cudf {
 
@@ -587,6 +590,163 @@ hash_partition_table(table_view const& input,
   }
 }
 
+/**
+ * @brief Row hasher specialized at compile time for the common key shapes
+ * of 1-4 fixed-width integer columns sharing one type.
+ *
+ * The per-column type dispatch and transform_reduce loop of the generic
+ * `row_hasher` are replaced by a fully unrolled sequence of element hashes.
+ * Hash values are identical to the generic path for the same hash function.
+ */
+template <typename T, int32_t num_columns,
+          template <typename> class hash_function, bool has_nulls>
+class unrolled_row_hasher {
+ public:
+  unrolled_row_hasher(table_device_view t) : _table{t} {}
+
+  __device__ hash_value_type operator()(size_type row_index) const {
+    hash_function<hash_value_type> combiner;
+    hash_function<T> hasher;
+    hash_value_type hash{0};
+    #pragma unroll
+    for (int32_t c = 0; c < num_columns; ++c) {
+      auto const col = _table.column(c);
+      auto const element_hash =
+          (has_nulls && col.is_null(row_index))
+              ? std::numeric_limits<hash_value_type>::max()
+              : hasher(col.element<T>(row_index));
+      hash = combiner.hash_combine(hash, element_hash);
+    }
+    return hash;
+  }
+
+ private:
+  table_device_view _table;
+};
+
+template <template <typename> class hash_function, typename T, bool has_nulls>
+void tabulate_unrolled_typed(mutable_column_view output,
+                             table_device_view input,
+                             size_type num_columns,
+                             cudaStream_t stream) {
+  switch (num_columns) {
+    case 1:
+      thrust::tabulate(rmm::exec_policy(stream)->on(stream),
+          output.begin<int32_t>(), output.end<int32_t>(),
+          unrolled_row_hasher<T, 1, hash_function, has_nulls>{input});
+      break;
+    case 2:
+      thrust::tabulate(rmm::exec_policy(stream)->on(stream),
+          output.begin<int32_t>(), output.end<int32_t>(),
+          unrolled_row_hasher<T, 2, hash_function, has_nulls>{input});
+      break;
+    case 3:
+      thrust::tabulate(rmm::exec_policy(stream)->on(stream),
+          output.begin<int32_t>(), output.end<int32_t>(),
+          unrolled_row_hasher<T, 3, hash_function, has_nulls>{input});
+      break;
+    case 4:
+      thrust::tabulate(rmm::exec_policy(stream)->on(stream),
+          output.begin<int32_t>(), output.end<int32_t>(),
+          unrolled_row_hasher<T, 4, hash_function, has_nulls>{input});
+      break;
+  }
+}
+
+/**
+ * @brief Hashes `input` into `output` with the unrolled row hasher if the
+ * table is 1-4 columns of one integer type.
+ *
+ * @return true if the specialized path applied, false to fall back to the
+ * generic row hasher.
+ */
+template <template <typename> class hash_function, bool has_nulls>
+bool tabulate_unrolled(mutable_column_view output,
+                       table_view const& input,
+                       table_device_view device_input,
+                       cudaStream_t stream) {
+  auto const num_columns = input.num_columns();
+  if (num_columns < 1 || num_columns > 4) {
+    return false;
+  }
+  auto const id = input.column(0).type().id();
+  if (std::any_of(input.begin(), input.end(),
+        [id](auto const& col) { return col.type().id() != id; })) {
+    return false;
+  }
+
+  switch (id) {
+    case INT8:
+      tabulate_unrolled_typed<hash_function, int8_t, has_nulls>(
+          output, device_input, num_columns, stream);
+      return true;
+    case INT16:
+      tabulate_unrolled_typed<hash_function, int16_t, has_nulls>(
+          output, device_input, num_columns, stream);
+      return true;
+    case INT32:
+      tabulate_unrolled_typed<hash_function, int32_t, has_nulls>(
+          output, device_input, num_columns, stream);
+      return true;
+    case INT64:
+      tabulate_unrolled_typed<hash_function, int64_t, has_nulls>(
+          output, device_input, num_columns, stream);
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * @brief Two accumulating 64-bit digest lanes.
+ *
+ * A plain pair of lanes rather than cudf::digest128 so the reduction does not
+ * drag a host-side struct with member functions through thrust.
+ */
+struct digest_lanes {
+  uint64_t low;
+  uint64_t high;
+};
+
+struct digest_lanes_sum {
+  __host__ __device__ digest_lanes operator()(digest_lanes const& lhs,
+                                              digest_lanes const& rhs) const {
+    return digest_lanes{lhs.low + rhs.low, lhs.high + rhs.high};
+  }
+};
+
+/**
+ * @brief Finalizer from splitmix64; full 64-bit avalanche.
+ */
+__device__ inline uint64_t digest_mix64(uint64_t key) {
+  key += 0x9e3779b97f4a7c15ull;
+  key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ull;
+  key = (key ^ (key >> 27)) * 0x94d049bb133111ebull;
+  return key ^ (key >> 31);
+}
+
+/**
+ * @brief Mixes a row's hash with its global row index into two 64-bit lanes.
+ *
+ * The index is baked into each row's contribution, which keeps the digest
+ * order-sensitive even though the cross-row combine is a commutative sum.
+ */
+template <bool has_nulls>
+struct row_digest_fn {
+  table_device_view table;
+  size_type row_offset;
+
+  __device__ digest_lanes operator()(size_type row_index) const {
+    auto const row_hash =
+        experimental::row_hasher<MurmurHash3_32, has_nulls>{table}(row_index);
+    auto const key =
+        (static_cast<uint64_t>(row_offset + row_index) << 32) |
+        static_cast<uint32_t>(row_hash);
+    return digest_lanes{digest_mix64(key),
+                        digest_mix64(key ^ 0xc2b2ae3d27d4eb4full)};
+  }
+};
+
 }  // namespace
 
 namespace detail {
@@ -651,20 +811,84 @@ std::unique_ptr<column> hash(table_view const& input,
               *device_input, device_initial_hash.data().get()));
     }
   } else {
+    // Small all-integer key tables take the unrolled hasher which avoids
+    // per-element type dispatch inside the kernel loop
     if (nullable) {
-      thrust::tabulate(rmm::exec_policy(stream)->on(stream),
-          output_view.begin<int32_t>(), output_view.end<int32_t>(),
-          experimental::row_hasher<MurmurHash3_32, true>(*device_input));
+      if (!tabulate_unrolled<MurmurHash3_32, true>(
+              output_view, input, *device_input, stream)) {
+        thrust::tabulate(rmm::exec_policy(stream)->on(stream),
+            output_view.begin<int32_t>(), output_view.end<int32_t>(),
+            experimental::row_hasher<MurmurHash3_32, true>(*device_input));
+      }
     } else {
-      thrust::tabulate(rmm::exec_policy(stream)->on(stream),
-          output_view.begin<int32_t>(), output_view.end<int32_t>(),
-          experimental::row_hasher<MurmurHash3_32, false>(*device_input));
+      if (!tabulate_unrolled<MurmurHash3_32, false>(
+              output_view, input, *device_input, stream)) {
+        thrust::tabulate(rmm::exec_policy(stream)->on(stream),
+            output_view.begin<int32_t>(), output_view.end<int32_t>(),
+            experimental::row_hasher<MurmurHash3_32, false>(*device_input));
+      }
     }
   }
 
   return output;
 }
 
+std::unique_ptr<column> identity_hash(table_view const& input,
+                                      rmm::mr::device_memory_resource* mr,
+                                      cudaStream_t stream)
+{
+  // TODO this should be UINT32
+  auto output = make_numeric_column(data_type(INT32), input.num_rows());
+
+  // Return early if there's nothing to hash
+  if (input.num_columns() == 0 || input.num_rows() == 0) {
+    return output;
+  }
+
+  auto const device_input = table_device_view::create(input, stream);
+  auto output_view = output->mutable_view();
+
+  bool applied = false;
+  if (has_nulls(input)) {
+    applied = tabulate_unrolled<IdentityHash, true>(
+        output_view, input, *device_input, stream);
+  } else {
+    applied = tabulate_unrolled<IdentityHash, false>(
+        output_view, input, *device_input, stream);
+  }
+  CUDF_EXPECTS(applied,
+    "identity_hash requires 1-4 columns of a single integral type");
+
+  return output;
+}
+
+digest128 table_digest(table_view const& input,
+                       size_type row_offset,
+                       cudaStream_t stream)
+{
+  // An empty table digests to the identity of combine_digests
+  if (input.num_columns() == 0 || input.num_rows() == 0) {
+    return digest128{};
+  }
+
+  auto const device_input = table_device_view::create(input, stream);
+  auto const begin = thrust::make_counting_iterator<size_type>(0);
+  auto const end = begin + input.num_rows();
+
+  digest_lanes lanes{};
+  if (has_nulls(input)) {
+    lanes = thrust::transform_reduce(rmm::exec_policy(stream)->on(stream),
+        begin, end, row_digest_fn<true>{*device_input, row_offset},
+        digest_lanes{0, 0}, digest_lanes_sum{});
+  } else {
+    lanes = thrust::transform_reduce(rmm::exec_policy(stream)->on(stream),
+        begin, end, row_digest_fn<false>{*device_input, row_offset},
+        digest_lanes{0, 0}, digest_lanes_sum{});
+  }
+
+  return digest128{lanes.low, lanes.high, input.num_rows()};
+}
+
 }  // namespace detail
 
 std::pair<std::unique_ptr<experimental::table>, std::vector<size_type>>
@@ -677,6 +901,35 @@ hash_partition(table_view const& input,
   return detail::hash_partition(input, columns_to_hash, num_partitions, mr);
 }
 
+std::vector<std::vector<partition_span>>
+partition_spans(table_view const& partitioned,
+                std::vector<size_type> const& offsets)
+{
+  CUDF_EXPECTS(std::all_of(partitioned.begin(), partitioned.end(),
+    [](auto const& col) { return is_fixed_width(col.type()); }),
+    "Only fixed-width columns have byte-addressable partitions");
+  CUDF_EXPECTS(not has_nulls(partitioned),
+    "Null masks are bit-packed; partitions of nullable columns are not byte-addressable");
+
+  auto const num_partitions = static_cast<size_type>(offsets.size());
+  std::vector<std::vector<partition_span>> spans(num_partitions);
+
+  for (size_type p = 0; p < num_partitions; ++p) {
+    auto const start = offsets[p];
+    auto const end = (p + 1 < num_partitions) ? offsets[p + 1]
+                                              : partitioned.num_rows();
+    spans[p].reserve(partitioned.num_columns());
+    for (auto const& col : partitioned) {
+      auto const width = size_of(col.type());
+      spans[p].push_back(
+        {col.head<char>() + (col.offset() + start) * width,
+         static_cast<size_t>(end - start) * width});
+    }
+  }
+
+  return spans;
+}
+
 std::unique_ptr<column> hash(table_view const& input,
                              std::vector<uint32_t> const& initial_hash,
                              rmm::mr::device_memory_resource* mr)
@@ -685,4 +938,17 @@ std::unique_ptr<column> hash(table_view const& input,
   return detail::hash(input, initial_hash, mr);
 }
 
+std::unique_ptr<column> identity_hash(table_view const& input,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::identity_hash(input, mr);
+}
+
+digest128 table_digest(table_view const& input, size_type row_offset)
+{
+  CUDF_FUNC_RANGE();
+  return detail::table_digest(input, row_offset);
+}
+
 }  // namespace cudf
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+#include <cudf/detail/utilities/device_atomics.cuh>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <limits>
+
+namespace cudf {
+namespace detail {
+
+/*
+ * Device view of the unordered row set
+ */
+class unordered_row_set_device_view {
+public:
+  unordered_row_set_device_view(size_type capacity, size_type *slots)
+    : capacity{capacity}, slots{slots} {
+  }
+
+  /// Sentinel marking an empty slot; must not be a valid row index
+  static constexpr size_type unused_row = std::numeric_limits<size_type>::max();
+
+  /**
+   * @brief Records the existence of a row in the set
+   *
+   * Rows that compare equal to an already inserted row are not inserted
+   * again, so probe chains stay short when the input contains duplicates.
+   *
+   * @param row_index The index of the row to insert
+   * @param hasher Functor returning the hash value of a row index
+   * @param equals Functor comparing two row indices for equality
+   */
+  template <typename Hasher, typename Equality>
+  void __device__ insert(size_type row_index, Hasher hasher, Equality equals) {
+    size_type loc = hasher(row_index) % capacity;
+
+    while (true) {
+      const size_type existing = atomicCAS(&slots[loc], unused_row, row_index);
+      if (existing == unused_row || equals(existing, row_index)) {
+        return;
+      }
+      loc = (loc + 1) % capacity;
+    }
+  }
+
+  /**
+   * @brief Checks whether a row equal to the given probe row was inserted
+   *
+   * Probing stops at the first empty slot, so misses exit as soon as the
+   * probe chain ends.
+   *
+   * @param row_index The index of the probe row
+   * @param hasher Functor returning the hash value of a probe row index
+   * @param equals Functor comparing a probe row index with an inserted row
+   * index
+   */
+  template <typename Hasher, typename Equality>
+  bool __device__ contains(size_type row_index, Hasher hasher,
+                           Equality equals) const {
+    size_type loc = hasher(row_index) % capacity;
+
+    while (true) {
+      const size_type existing = slots[loc];
+      if (existing == unused_row) {
+        return false;
+      }
+      if (equals(row_index, existing)) {
+        return true;
+      }
+      loc = (loc + 1) % capacity;
+    }
+  }
+
+private:
+  size_type  capacity;
+  size_type *slots;
+};
+
+/*
+ * Fixed size existence-only set of row indices on a device.
+ *
+ * Stores only the inserted row indices in an open addressing table with
+ * linear probing; there is no payload, so each slot costs a single
+ * `size_type`. Hashing and equality are provided per call so the same set
+ * can be built with one table's row comparators and probed with another's.
+ */
+class unordered_row_set {
+public:
+  /**---------------------------------------------------------------------------*
+   * @brief Factory to construct a new unordered_row_set
+   *
+   * @param capacity The number of slots; must exceed the number of distinct
+   * rows that will be inserted
+   * @param stream CUDA stream to use for device operations
+   *---------------------------------------------------------------------------**/
+  static unordered_row_set create(size_type capacity, cudaStream_t stream) {
+    rmm::device_vector<size_type> slots(
+        capacity, unordered_row_set_device_view::unused_row);
+    return unordered_row_set(capacity, std::move(slots));
+  }
+
+  unordered_row_set_device_view to_device() {
+    return unordered_row_set_device_view(capacity, slots.data().get());
+  }
+
+private:
+  unordered_row_set(size_type capacity, rmm::device_vector<size_type> &&slots)
+    : capacity{capacity}, slots{std::move(slots)} {}
+
+  size_type capacity;
+  rmm::device_vector<size_type> slots;
+};
+
+}
+}
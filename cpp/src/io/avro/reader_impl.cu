@@ -161,29 +161,35 @@ rmm::device_buffer reader::impl::decompress_data(
       inflate_in[i].dstSize = initial_blk_len;
     }
   } else if (_metadata->codec == "snappy") {
-    // Extract the uncompressed length from the snappy stream
+    // The uncompressed length is stored at the start of each snappy stream;
+    // the block data is already on the device, so probe all blocks with a
+    // single kernel and bring the sizes back in one copy instead of issuing
+    // a small host read per block
+    const auto base_offset = _metadata->block_list[0].offset;
     for (size_t i = 0; i < _metadata->block_list.size(); i++) {
-      const auto buffer =
-          _source->get_buffer(_metadata->block_list[i].offset, 4);
-      const uint8_t *blk = buffer->data();
-      uint32_t blk_len = blk[0];
-      if (blk_len > 0x7f) {
-        blk_len = (blk_len & 0x7f) | (blk[1] << 7);
-        if (blk_len > 0x3fff) {
-          blk_len = (blk_len & 0x3fff) | (blk[2] << 14);
-          if (blk_len > 0x1fffff) {
-            blk_len = (blk_len & 0x1fffff) | (blk[3] << 21);
-          }
-        }
-      }
-      inflate_in[i].dstSize = blk_len;
-      uncompressed_data_size += blk_len;
+      inflate_in[i].srcDevice =
+          static_cast<const uint8_t *>(comp_block_data.data()) +
+          (_metadata->block_list[i].offset - base_offset);
+      inflate_in[i].srcSize = _metadata->block_list[i].size;
+      inflate_in[i].dstSize = 0;
+    }
+    CUDA_TRY(cudaMemcpyAsync(inflate_in.device_ptr(), inflate_in.host_ptr(),
+                             inflate_in.memory_size(), cudaMemcpyHostToDevice,
+                             stream));
+    CUDA_TRY(gpu_unsnap_get_uncompressed_sizes(inflate_in.device_ptr(),
+                                               inflate_in.size(), stream));
+    CUDA_TRY(cudaMemcpyAsync(inflate_in.host_ptr(), inflate_in.device_ptr(),
+                             inflate_in.memory_size(), cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    for (size_t i = 0; i < inflate_in.size(); i++) {
+      uncompressed_data_size += inflate_in[i].dstSize;
     }
   } else {
     CUDF_FAIL("Unsupported compression codec\n");
   }
 
-  rmm::device_buffer decomp_block_data(uncompressed_data_size, stream);
+  rmm::device_buffer decomp_block_data(uncompressed_data_size, stream, _mr);
 
   const auto base_offset = _metadata->block_list[0].offset;
   for (size_t i = 0, dst_pos = 0; i < _metadata->block_list.size(); i++) {
@@ -202,6 +208,9 @@ rmm::device_buffer reader::impl::decompress_data(
     dst_pos += _metadata->block_list[i].size;
   }
 
+  // Snappy scratch memory for size-binning the blocks
+  rmm::device_vector<uint8_t> unsnap_scratch;
+
   for (int loop_cnt = 0; loop_cnt < 2; loop_cnt++) {
     CUDA_TRY(cudaMemcpyAsync(inflate_in.device_ptr(), inflate_in.host_ptr(),
                              inflate_in.memory_size(), cudaMemcpyHostToDevice,
@@ -212,8 +221,14 @@ rmm::device_buffer reader::impl::decompress_data(
       CUDA_TRY(gpuinflate(inflate_in.device_ptr(), inflate_out.device_ptr(),
                           inflate_in.size(), 0, stream));
     } else if (_metadata->codec == "snappy") {
-      CUDA_TRY(gpu_unsnap(inflate_in.device_ptr(), inflate_out.device_ptr(),
-                          inflate_in.size(), stream));
+      // Batched path bins the blocks by size so many small blocks do not
+      // serialize behind one warp-cooperative kernel block each
+      unsnap_scratch.resize(
+          get_gpu_unsnap_batched_scratch_size(inflate_in.size()));
+      CUDA_TRY(gpu_unsnap_batched(inflate_in.device_ptr(),
+                                  inflate_out.device_ptr(),
+                                  unsnap_scratch.data().get(),
+                                  inflate_in.size(), stream));
     } else {
       CUDF_FAIL("Unsupported compression codec\n");
     }
@@ -332,7 +347,7 @@ void reader::impl::decode_data(
   }
   rmm::device_buffer block_list(
       _metadata->block_list.data(),
-      _metadata->block_list.size() * sizeof(block_desc_s), stream);
+      _metadata->block_list.size() * sizeof(block_desc_s), stream, _mr);
   CUDA_TRY(cudaMemcpyAsync(schema_desc.device_ptr(), schema_desc.host_ptr(),
                            schema_desc.memory_size(), cudaMemcpyHostToDevice,
                            stream));
@@ -399,7 +414,7 @@ table_with_metadata reader::impl::read(int skip_rows, int num_rows,
     if (_metadata->total_data_size > 0) {
       const auto buffer = _source->get_buffer(_metadata->block_list[0].offset,
                                               _metadata->total_data_size);
-      rmm::device_buffer block_data(buffer->data(), buffer->size(), stream);
+      rmm::device_buffer block_data(buffer->data(), buffer->size(), stream, _mr);
 
       if (_metadata->codec != "" && _metadata->codec != "null") {
         auto decomp_block_data = decompress_data(block_data, stream);
@@ -84,6 +84,69 @@ cudaError_t gpu_unsnap(gpu_inflate_input_s *inputs,
                        gpu_inflate_status_s *outputs, int count = 1,
                        cudaStream_t stream = (cudaStream_t)0);
 
+/**
+ * @brief Extracts the uncompressed size of Snappy-compressed chunks
+ *
+ * Reads the length varint at the start of each compressed chunk on the device
+ * and stores it in the descriptor's dstSize field, avoiding a host read per
+ * chunk when sizing output buffers.
+ *
+ * @param[in,out] inputs List of input argument structures
+ * @param[in] count Number of input structures, default 1
+ * @param[in] stream CUDA stream to use, default 0
+ **/
+cudaError_t gpu_unsnap_get_uncompressed_sizes(gpu_inflate_input_s *inputs,
+                                              int count = 1,
+                                              cudaStream_t stream = (cudaStream_t)0);
+
+/**
+ * @brief Computes the size of temporary memory for batched Snappy decompression
+ *
+ * @param[in] max_num_inputs The maximum number of compressed input chunks
+ *
+ * @return The size in bytes of required temporary memory
+ **/
+size_t get_gpu_unsnap_batched_scratch_size(int max_num_inputs = 0);
+
+/**
+ * @brief Interface for decompressing Snappy-compressed data, binned by size
+ *
+ * Like gpu_unsnap, but first bins the chunks by uncompressed size on the
+ * device: small chunks are decoded by a warp-per-chunk kernel (many chunks
+ * resident per SM) while large chunks take the regular block-per-chunk
+ * pipeline. Preferable to gpu_unsnap when the batch holds many small chunks,
+ * e.g. Parquet files with thousands of small pages.
+ *
+ * @param[in] inputs List of input argument structures
+ * @param[out] outputs List of output status structures
+ * @param[in] scratch Temporary memory for the size bins
+ * @param[in] count Number of input/output structures, default 1
+ * @param[in] stream CUDA stream to use, default 0
+ **/
+cudaError_t gpu_unsnap_batched(gpu_inflate_input_s *inputs,
+                               gpu_inflate_status_s *outputs, void *scratch,
+                               int count = 1,
+                               cudaStream_t stream = (cudaStream_t)0);
+
+/**
+ * @brief Interface for decompressing ZSTD-compressed data
+ *
+ * Multiple, independent chunks of compressed data can be decompressed by using
+ * separate gpu_inflate_input_s/gpu_inflate_status_s pairs for each chunk.
+ *
+ * Requires building against libzstd (CUDF_ZSTD); chunks are currently staged
+ * through the host for entropy decode. Returns cudaErrorNotSupported when
+ * built without ZSTD support.
+ *
+ * @param[in] inputs List of input argument structures
+ * @param[out] outputs List of output status structures
+ * @param[in] count Number of input/output structures, default 1
+ * @param[in] stream CUDA stream to use, default 0
+ **/
+cudaError_t gpu_unzstd(gpu_inflate_input_s *inputs,
+                       gpu_inflate_status_s *outputs, int count = 1,
+                       cudaStream_t stream = (cudaStream_t)0);
+
 /**
  * @brief Computes the size of temporary memory for Brotli decompression
  *
@@ -23,6 +23,10 @@ namespace io {
 // Not supporting streams longer than this (not what snappy is intended for)
 #define SNAPPY_MAX_STREAM_SIZE	0x7fffffff
 
+// Streams at or below this uncompressed size are decoded by the warp-per-stream
+// small-chunk kernel instead of the block-per-stream pipelined kernel
+#define SNAPPY_SMALL_CHUNK_SIZE 4096
+
 #define LOG2_BATCH_SIZE     5
 #define BATCH_SIZE          (1 << LOG2_BATCH_SIZE)
 #define LOG2_BATCH_COUNT    2
@@ -694,13 +698,25 @@ __device__ void snappy_process_symbols(unsnap_state_s *s, int t)
 
 // blockDim {128,1,1}
 extern "C" __global__ void __launch_bounds__(128)
-unsnap_kernel(gpu_inflate_input_s *inputs, gpu_inflate_status_s *outputs)
+unsnap_kernel(gpu_inflate_input_s *inputs, gpu_inflate_status_s *outputs, const uint32_t *stream_ids, const uint32_t *num_streams)
 {
     __shared__ __align__(16) unsnap_state_s state_g;
 
     int t = threadIdx.x;
     unsnap_state_s *s = &state_g;
-    int strm_id = blockIdx.x;
+    int strm_id;
+
+    if (stream_ids)
+    {
+        // Batched launch: grid is sized to the worst case, surplus blocks exit
+        if (blockIdx.x >= *num_streams)
+            return;
+        strm_id = stream_ids[blockIdx.x];
+    }
+    else
+    {
+        strm_id = blockIdx.x;
+    }
 
     if (t < sizeof(gpu_inflate_input_s) / sizeof(uint32_t))
     {
@@ -797,14 +813,296 @@ unsnap_kernel(gpu_inflate_input_s *inputs, gpu_inflate_status_s *outputs)
 }
 
 
+/**
+ * @brief Decodes a single small snappy stream with one warp
+ *
+ * All lanes parse the symbol stream redundantly (uniform broadcast loads), so
+ * no shared state or cross-warp synchronization is needed; only the literal
+ * and LZ77 copies are distributed across the warp. Far slower per stream than
+ * the 3-warp pipeline above, but with no shared memory and one warp per
+ * stream, many more small streams can be resident per SM.
+ *
+ * @param[in] input Input descriptor for this stream
+ * @param[out] output Output status for this stream
+ * @param[in] lane warp lane id
+ **/
+static __device__ void unsnap_warp_small(const gpu_inflate_input_s *input, gpu_inflate_status_s *output, int lane)
+{
+    const uint8_t *cur = reinterpret_cast<const uint8_t *>(input->srcDevice);
+    const uint8_t *end = cur + input->srcSize;
+    uint8_t *out = reinterpret_cast<uint8_t *>(input->dstDevice);
+    uint32_t uncompressed_size = 0;
+    uint32_t dst_pos = 0;
+    int32_t error = 0;
+
+    // Read uncompressed size (varint), limited to 32-bit
+    if (cur < end)
+    {
+        uint32_t c = *cur++;
+        uncompressed_size = c & 0x7f;
+        if (c > 0x7f)
+        {
+            uint32_t lo7b, shift = 7;
+            do
+            {
+                c = (cur < end) ? *cur++ : 0x80;
+                lo7b = c & 0x7f;
+                uncompressed_size |= lo7b << shift;
+                shift += 7;
+            } while (c > 0x7f && shift < 28 + 7);
+            if (c > 0x7f || uncompressed_size > input->dstSize)
+            {
+                error = -1;
+            }
+        }
+        else if (uncompressed_size > input->dstSize)
+        {
+            error = -1;
+        }
+    }
+    else
+    {
+        error = -1;
+    }
+    while (!error && dst_pos < uncompressed_size)
+    {
+        uint32_t blen, len, offset;
+        if (cur >= end)
+        {
+            error = -2;
+            break;
+        }
+        blen = *cur++;
+        if ((blen & 3) == 0)
+        {
+            // Literal
+            len = (blen >> 2) + 1;
+            if (len > 60)
+            {
+                uint32_t num_bytes = len - 60;
+                if (cur + num_bytes > end)
+                {
+                    error = -2;
+                    break;
+                }
+                len = 0;
+                for (uint32_t i = 0; i < num_bytes; i++)
+                {
+                    len |= static_cast<uint32_t>(cur[i]) << (i * 8);
+                }
+                len += 1;
+                cur += num_bytes;
+            }
+            if (cur + len > end || dst_pos + len > uncompressed_size)
+            {
+                error = -2;
+                break;
+            }
+            for (uint32_t i = lane; i < len; i += 32)
+            {
+                out[dst_pos + i] = cur[i];
+            }
+            __syncwarp();
+            cur += len;
+        }
+        else
+        {
+            // LZ77 copy
+            if (blen & 2)
+            {
+                // xxxxxx1x: copy with 2-byte or 4-byte offset
+                uint32_t num_bytes = (blen & 1) ? 4 : 2;
+                if (cur + num_bytes > end)
+                {
+                    error = -2;
+                    break;
+                }
+                len = (blen >> 2) + 1;
+                offset = 0;
+                for (uint32_t i = 0; i < num_bytes; i++)
+                {
+                    offset |= static_cast<uint32_t>(cur[i]) << (i * 8);
+                }
+                cur += num_bytes;
+            }
+            else
+            {
+                // xxxxxx01: copy with 3-bit length, 11-bit offset
+                if (cur >= end)
+                {
+                    error = -2;
+                    break;
+                }
+                len = ((blen >> 2) & 7) + 4;
+                offset = ((blen & 0xe0) << 3) | *cur++;
+            }
+            if (offset == 0 || offset > dst_pos || dst_pos + len > uncompressed_size)
+            {
+                error = (offset == 0 || offset > dst_pos) ? -3 : -2;
+                break;
+            }
+            if (offset >= 32)
+            {
+                // Non-overlapping within a 32-byte wave: copy one wave at a
+                // time so later waves see the bytes written by earlier ones
+                for (uint32_t i = 0; i < len; i += 32)
+                {
+                    uint32_t j = i + lane;
+                    if (j < len)
+                    {
+                        out[dst_pos + j] = out[dst_pos + j - offset];
+                    }
+                    __syncwarp();
+                }
+            }
+            else
+            {
+                // Short offset: the copy replicates the last offset bytes
+                // cyclically, and that window is fully written already
+                for (uint32_t j = lane; j < len; j += 32)
+                {
+                    out[dst_pos + j] = out[dst_pos - offset + (j % offset)];
+                }
+                __syncwarp();
+            }
+        }
+        dst_pos += len;
+    }
+    if (!lane)
+    {
+        output->bytes_written = dst_pos;
+        output->status = error;
+        output->reserved = 0;
+    }
+}
+
+
+// blockDim {128,1,1}
+extern "C" __global__ void __launch_bounds__(128)
+unsnap_small_kernel(gpu_inflate_input_s *inputs, gpu_inflate_status_s *outputs, const uint32_t *stream_ids, const uint32_t *num_streams)
+{
+    uint32_t k = blockIdx.x * (blockDim.x >> 5) + (threadIdx.x >> 5);
+
+    if (k < *num_streams)
+    {
+        uint32_t strm_id = stream_ids[k];
+        unsnap_warp_small(&inputs[strm_id], &outputs[strm_id], threadIdx.x & 0x1f);
+    }
+}
+
+
+// Partitions stream indices by uncompressed size into a small-chunk bin and a
+// large-chunk bin; bin order is not significant
+extern "C" __global__ void __launch_bounds__(128)
+unsnap_bin_streams_kernel(const gpu_inflate_input_s *inputs, int count, uint32_t *small_ids, uint32_t *num_small, uint32_t *large_ids, uint32_t *num_large)
+{
+    for (int i = blockIdx.x * blockDim.x + threadIdx.x; i < count; i += blockDim.x * gridDim.x)
+    {
+        if (inputs[i].dstSize <= SNAPPY_SMALL_CHUNK_SIZE)
+        {
+            small_ids[atomicAdd(num_small, 1)] = i;
+        }
+        else
+        {
+            large_ids[atomicAdd(num_large, 1)] = i;
+        }
+    }
+}
+
+
+// Reads the uncompressed-size varint at the start of each snappy stream and
+// stores it in the descriptor's dstSize field
+extern "C" __global__ void __launch_bounds__(128)
+unsnap_get_sizes_kernel(gpu_inflate_input_s *inputs, int count)
+{
+    for (int i = blockIdx.x * blockDim.x + threadIdx.x; i < count; i += blockDim.x * gridDim.x)
+    {
+        const uint8_t *cur = reinterpret_cast<const uint8_t *>(inputs[i].srcDevice);
+        const uint8_t *end = cur + inputs[i].srcSize;
+        uint32_t uncompressed_size = 0;
+        if (cur < end)
+        {
+            uint32_t c = *cur++;
+            uncompressed_size = c & 0x7f;
+            uint32_t shift = 7;
+            while (c > 0x7f && cur < end && shift < 32)
+            {
+                c = *cur++;
+                uncompressed_size |= (c & 0x7f) << shift;
+                shift += 7;
+            }
+        }
+        inputs[i].dstSize = uncompressed_size;
+    }
+}
+
+
+cudaError_t __host__ gpu_unsnap_get_uncompressed_sizes(gpu_inflate_input_s *inputs, int count, cudaStream_t stream)
+{
+    uint32_t count32 = (count > 0) ? count : 0;
+    dim3 dim_block(128, 1);
+    dim3 dim_grid((count32 + 127) >> 7, 1);
+
+    unsnap_get_sizes_kernel <<< dim_grid, dim_block, 0, stream >>>(inputs, count32);
+
+    return cudaSuccess;
+}
+
+
 cudaError_t __host__ gpu_unsnap(gpu_inflate_input_s *inputs, gpu_inflate_status_s *outputs, int count, cudaStream_t stream)
 {
     uint32_t count32 = (count > 0) ? count : 0;
     dim3 dim_block(128, 1);     // 4 warps per stream, 1 stream per block
     dim3 dim_grid(count32, 1);  // TODO: Check max grid dimensions vs max expected count
 
-    unsnap_kernel <<< dim_grid, dim_block, 0, stream >>>(inputs, outputs);
+    unsnap_kernel <<< dim_grid, dim_block, 0, stream >>>(inputs, outputs, nullptr, nullptr);
+
+    return cudaSuccess;
+}
+
 
+size_t __host__ get_gpu_unsnap_batched_scratch_size(int max_num_inputs)
+{
+    // Two bin counters plus one index slot per input
+    return (2 + 2 * static_cast<size_t>(max_num_inputs)) * sizeof(uint32_t);
+}
+
+
+cudaError_t __host__ gpu_unsnap_batched(gpu_inflate_input_s *inputs, gpu_inflate_status_s *outputs, void *scratch, int count, cudaStream_t stream)
+{
+    uint32_t count32 = (count > 0) ? count : 0;
+    uint32_t *num_small = reinterpret_cast<uint32_t *>(scratch);
+    uint32_t *num_large = num_small + 1;
+    uint32_t *small_ids = num_small + 2;
+    uint32_t *large_ids = small_ids + count32;
+    cudaError_t err;
+
+    if (!count32)
+    {
+        return cudaSuccess;
+    }
+    err = cudaMemsetAsync(num_small, 0, 2 * sizeof(uint32_t), stream);
+    if (err != cudaSuccess)
+    {
+        return err;
+    }
+    {
+        dim3 dim_block(128, 1);
+        dim3 dim_grid((count32 + 127) >> 7, 1);
+        unsnap_bin_streams_kernel <<< dim_grid, dim_block, 0, stream >>>(inputs, count32, small_ids, num_small, large_ids, num_large);
+    }
+    // Bin counts are only available on the device, so both kernels are
+    // launched with worst-case grids and surplus blocks exit early
+    {
+        dim3 dim_block(128, 1);             // 4 warps per block, 1 stream per warp
+        dim3 dim_grid((count32 + 3) >> 2, 1);
+        unsnap_small_kernel <<< dim_grid, dim_block, 0, stream >>>(inputs, outputs, small_ids, num_small);
+    }
+    {
+        dim3 dim_block(128, 1);             // 4 warps per stream, 1 stream per block
+        dim3 dim_grid(count32, 1);
+        unsnap_kernel <<< dim_grid, dim_block, 0, stream >>>(inputs, outputs, large_ids, num_large);
+    }
     return cudaSuccess;
 }
 
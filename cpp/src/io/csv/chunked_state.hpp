@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file chunked_state.hpp
+ * @brief definition for chunked state structure used by the CSV reader
+ */
+
+#pragma once
+
+#include <cudf/io/readers.hpp>
+#include <cudf/io/types.hpp>
+
+namespace cudf {
+namespace experimental {
+namespace io {
+namespace detail {
+namespace csv {
+   /**
+    * @brief Chunked reader state struct. Contains information that spans the
+    *        begin() / read() / end() call process.
+    *
+    * Column names and types are locked in after the first chunk: subsequent
+    * chunks are parsed with explicit dtypes, so only a single pass (row
+    * offsets + decode) runs over each chunk and device memory stays bounded
+    * by the chunk size instead of the file size.
+    */
+   struct csv_chunked_read_state {
+      /// Copy of the input source; a fresh reader maps each byte range
+      source_info                         source;
+      /// Reader options; names/dtypes are filled in after the first chunk
+      reader_options                      options;
+      /// Resource to use for device memory allocation
+      rmm::mr::device_memory_resource*    mr;
+      /// Cuda stream to be used
+      cudaStream_t                        stream;
+      /// Number of input bytes covered per chunk
+      size_t                              chunk_bytes;
+      /// Byte offset of the next chunk to be read
+      size_t                              next_offset = 0;
+      /// Total number of input bytes
+      size_t                              total_size = 0;
+      /// Whether column names/types have been locked in from the first chunk
+      bool                                types_locked = false;
+      /// Whether the previous chunk reached the end of the input
+      bool                                exhausted = false;
+   };
+
+}  // namespace csv
+}  // namespace detail
+}  // namespace io
+}  // namespace experimental
+}  // namespace cudf
@@ -492,14 +492,16 @@ struct decode_op {
  * @param[in] dtype The data type of the column
  * @param[out] data The output column data
  * @param[out] valid The bitmaps indicating whether column fields are valid
- * @param[out] num_valid The numbers of valid fields in columns
+ * @param[out] error_rows Optional bitmap marking rows with fields that failed
+ * to decode or that ended before all columns were seen; may be `nullptr`
  *---------------------------------------------------------------------------**/
 __global__ void convertCsvToGdf(const char *raw_csv, const ParseOptions opts,
                                 size_t num_records, size_t num_columns,
                                 const column_parse::flags *flags,
                                 const uint64_t *recStart,
                                 cudf::data_type *dtype, void **data,
-                                cudf::bitmask_type **valid) {
+                                cudf::bitmask_type **valid,
+                                cudf::bitmask_type *error_rows) {
   // thread IDs range per block, so also need the block id
   long rec_id =
       threadIdx.x +
@@ -555,6 +557,10 @@ __global__ void convertCsvToGdf(const char *raw_csv, const ParseOptions opts,
                                               start, tempPos, opts, flags[col])){
             // set the valid bitmap - all bits were set to 0 to start
             set_bit(valid[actual_col], rec_id);
+          } else if (error_rows != nullptr) {
+            // the field stays null; flag the row so the caller can quarantine
+            // it without re-parsing
+            set_bit(error_rows, rec_id);
           }
         }
       } else if (dtype[actual_col].id() == cudf::type_id::STRING) {
@@ -569,6 +575,12 @@ __global__ void convertCsvToGdf(const char *raw_csv, const ParseOptions opts,
     start = pos;
     col++;
   }
+
+  // a row that ran out of data before every column was seen is malformed;
+  // its missing fields are already null, flag it as an error row too
+  if (error_rows != nullptr && col < num_columns) {
+    set_bit(error_rows, rec_id);
+  }
 }
 
 cudaError_t __host__ DetectColumnTypes(
@@ -592,7 +604,8 @@ cudaError_t __host__ DecodeRowColumnData(
     const char *data, const uint64_t *row_starts, size_t num_rows,
     size_t num_columns, const ParseOptions &options,
     const column_parse::flags *flags, cudf::data_type *dtypes, void **columns,
-    cudf::bitmask_type **valids, cudaStream_t stream) {
+    cudf::bitmask_type **valids, cudf::bitmask_type *error_rows,
+    cudaStream_t stream) {
   // Calculate actual block count to use based on records count
   int blockSize = 0;    // suggested thread count to use
   int minGridSize = 0;  // minimum block count required
@@ -601,7 +614,7 @@ cudaError_t __host__ DecodeRowColumnData(
 
   convertCsvToGdf<<<gridSize, blockSize, 0, stream>>>(
       data, options, num_rows, num_columns, flags, row_starts, dtypes, columns,
-      valids);
+      valids, error_rows);
 
   return cudaSuccess;
 }
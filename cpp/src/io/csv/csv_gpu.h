@@ -57,7 +57,8 @@ cudaError_t DetectColumnTypes(const char *data, const uint64_t *row_starts,
  * @param[in] dtypes List of dtype corresponding to each column
  * @param[out] columns Device memory output of column data
  * @param[out] valids Device memory output of column valids bitmap data
- * @param[out] num_valid Number of valid fields in each column
+ * @param[out] error_rows Optional bitmap marking rows whose fields failed to
+ * decode or that ended short of the column count; pass `nullptr` to skip
  * @param[in] stream CUDA stream to use, default 0
  *
  * @return cudaSuccess if successful, a CUDA error code otherwise
@@ -68,6 +69,7 @@ cudaError_t DecodeRowColumnData(const char *data, const uint64_t *row_starts,
                                 const column_parse::flags *flags,
                                 cudf::data_type *dtypes, void **columns,
                                 cudf::bitmask_type **valids,
+                                cudf::bitmask_type *error_rows = nullptr,
                                 cudaStream_t stream = (cudaStream_t)0);
 
 }  // namespace gpu
@@ -32,9 +32,12 @@
 
 #include <utilities/legacy/cudf_utils.h>
 #include <cudf/legacy/unary.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <thrust/transform.h>
+
 #include <nvstrings/NVStrings.h>
 
 #include <io/comp/io_uncomp.h>
@@ -250,7 +253,8 @@ table_with_metadata reader::impl::read(size_t range_offset,
     CUDF_EXPECTS(data_size <= h_uncomp_size, "Row range exceeds data size");
 
     num_bits = (data_size + 63) / 64;
-    data_ = rmm::device_buffer(h_uncomp_data + row_range.first, data_size);
+    data_ = rmm::device_buffer(h_uncomp_data + row_range.first, data_size,
+                               stream, mr_);
   }
 
   // Check if the user gave us a list of column names
@@ -356,6 +360,32 @@ table_with_metadata reader::impl::read(size_t range_offset,
         make_column(column_types[i], num_records, out_buffers[i]));
   }
 
+  // Rows the decode kernel flagged get their byte offset within the parsed
+  // input materialized into an extra INT64 column; clean rows are null, so
+  // filtering on the non-null entries quarantines the bad rows without a
+  // second parse
+  if (args_.error_row_offsets) {
+    if (num_records != 0) {
+      rmm::device_buffer offsets_data(num_records * sizeof(int64_t), stream, mr_);
+      thrust::transform(rmm::exec_policy(stream)->on(stream),
+                        row_offsets.begin(), row_offsets.begin() + num_records,
+                        static_cast<int64_t *>(offsets_data.data()),
+                        [] __device__(uint64_t offset) {
+                          return static_cast<int64_t>(offset);
+                        });
+      rmm::device_buffer error_mask(
+          d_error_rows.data().get(),
+          cudf::bitmask_allocation_size_bytes(num_records), stream, mr_);
+      out_columns.emplace_back(std::make_unique<column>(
+          data_type{INT64}, num_records, std::move(offsets_data),
+          std::move(error_mask), UNKNOWN_NULL_COUNT));
+    } else {
+      out_columns.emplace_back(make_numeric_column(
+          data_type{INT64}, 0, mask_state::UNALLOCATED, stream, mr_));
+    }
+    metadata.column_names.emplace_back("_error_offset");
+  }
+
   // TODO: String columns need to be reworked to actually copy characters in
   // kernel to allow skipping quotation characters
   /*for (auto &column : columns) {
@@ -654,10 +684,18 @@ void reader::impl::decode_data(const std::vector<data_type> &column_types,
   rmm::device_vector<bitmask_type *> d_valid = h_valid;
   d_column_flags = h_column_flags;
 
+  if (args_.error_row_offsets) {
+    // zero-initialized; the decode kernel sets a bit per flagged row. Padded
+    // to the null mask allocation size so it can back the error column's mask
+    d_error_rows.resize(cudf::bitmask_allocation_size_bytes(num_records) /
+                        sizeof(bitmask_type));
+  }
+
   CUDA_TRY(cudf::io::csv::gpu::DecodeRowColumnData(
       static_cast<const char *>(data_.data()), row_offsets.data().get(),
       num_records, num_actual_cols, opts, d_column_flags.data().get(),
       d_dtypes.data().get(), d_data.data().get(), d_valid.data().get(),
+      args_.error_row_offsets ? d_error_rows.data().get() : nullptr,
       stream));
   CUDA_TRY(cudaStreamSynchronize(stream));
 
@@ -144,6 +144,8 @@ class reader::impl {
 
   rmm::device_buffer data_;
   rmm::device_vector<uint64_t> row_offsets;
+  rmm::device_vector<cudf::bitmask_type> d_error_rows;  // Rows with decode errors; only
+                                                        // populated with `error_row_offsets`
   size_t num_records = 0;   // Number of rows with actual data
   long num_bits = 0;        // Numer of 64-bit bitmaps (different than valid)
   int num_active_cols = 0;  // Number of columns to read
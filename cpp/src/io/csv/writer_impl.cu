@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file writer_impl.cu
+ * @brief cuDF-IO CSV writer class implementation
+ */
+
+#include "writer_impl.hpp"
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/combine.hpp>
+#include <cudf/strings/convert/convert_booleans.hpp>
+#include <cudf/strings/convert/convert_datetime.hpp>
+#include <cudf/strings/convert/convert_floats.hpp>
+#include <cudf/strings/convert/convert_integers.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace experimental {
+namespace io {
+namespace detail {
+namespace csv {
+
+namespace {
+
+/**
+ * @brief Converts a single column to a strings column for CSV output
+ *
+ * Reuses the cudf::strings conversion kernels so all formatting happens on
+ * the device. Nulls are preserved and later replaced with the configured
+ * na_rep when rows are assembled.
+ **/
+std::unique_ptr<column> column_to_strings(column_view const& column,
+                                          writer_options const& options,
+                                          rmm::mr::device_memory_resource* mr) {
+  switch (column.type().id()) {
+    case BOOL8:
+      return strings::from_booleans(column, string_scalar(options.true_value),
+                                    string_scalar(options.false_value), mr);
+    case INT8:
+    case INT16:
+    case INT32:
+    case INT64:
+      return strings::from_integers(column, mr);
+    case FLOAT32:
+    case FLOAT64:
+      return strings::from_floats(column, mr);
+    case TIMESTAMP_DAYS:
+    case TIMESTAMP_SECONDS:
+    case TIMESTAMP_MILLISECONDS:
+    case TIMESTAMP_MICROSECONDS:
+    case TIMESTAMP_NANOSECONDS:
+      return strings::from_timestamps(column, "%Y-%m-%dT%H:%M:%SZ", mr);
+    default:
+      CUDF_FAIL("Unsupported column type for CSV output");
+  }
+}
+
+}  // namespace
+
+writer::impl::impl(std::unique_ptr<data_sink> sink,
+                   writer_options const& options,
+                   rmm::mr::device_memory_resource* mr)
+    : out_sink_(std::move(sink)), options_(options), _mr(mr) {}
+
+void writer::impl::write_header(const table_metadata* metadata,
+                                size_type num_columns) {
+  std::string header;
+  for (size_type i = 0; i < num_columns; i++) {
+    if (i > 0) {
+      header += options_.inter_column_delimiter;
+    }
+    if (metadata != nullptr &&
+        static_cast<size_t>(i) < metadata->column_names.size()) {
+      header += metadata->column_names[i];
+    }
+  }
+  header += options_.line_terminator;
+  out_sink_->host_write(header.data(), header.size());
+}
+
+void writer::impl::write_chunk(table_view const& table, cudaStream_t stream) {
+  // Convert each column to strings on the device; string columns pass
+  // through unconverted
+  std::vector<std::unique_ptr<column>> converted;
+  std::vector<column_view> str_columns;
+  for (auto const& col : table) {
+    if (col.type().id() == STRING) {
+      str_columns.push_back(col);
+    } else {
+      converted.push_back(column_to_strings(col, options_, _mr));
+      str_columns.push_back(converted.back()->view());
+    }
+  }
+
+  // Fuse the per-row fragments into full lines, replacing nulls with na_rep,
+  // then join the lines into a single character stream for the sink
+  auto lines = strings::concatenate(
+      table_view{str_columns},
+      string_scalar(std::string{options_.inter_column_delimiter}),
+      string_scalar(options_.na_rep), _mr);
+  auto joined =
+      strings::join_strings(strings_column_view{lines->view()},
+                            string_scalar(options_.line_terminator),
+                            string_scalar(options_.na_rep), _mr);
+
+  strings_column_view joined_view{joined->view()};
+  auto total_bytes = static_cast<size_t>(joined_view.chars_size());
+  if (total_bytes != 0) {
+    if (out_sink_->supports_device_write()) {
+      out_sink_->device_write(joined_view.chars().head<void>(), total_bytes,
+                              stream);
+    } else {
+      std::vector<char> h_bfr(total_bytes);
+      CUDA_TRY(cudaMemcpyAsync(h_bfr.data(), joined_view.chars().head<void>(),
+                               total_bytes, cudaMemcpyDeviceToHost, stream));
+      CUDA_TRY(cudaStreamSynchronize(stream));
+      out_sink_->host_write(h_bfr.data(), total_bytes);
+    }
+  }
+  // join_strings() only inserts the terminator between lines
+  out_sink_->host_write(options_.line_terminator.data(),
+                        options_.line_terminator.size());
+}
+
+void writer::impl::write(table_view const& table,
+                         const table_metadata* metadata, cudaStream_t stream) {
+  if (options_.include_header) {
+    write_header(metadata, table.num_columns());
+  }
+  if (table.num_rows() != 0) {
+    auto const rows_per_chunk = std::max(options_.rows_per_chunk, 1);
+    for (size_type row = 0; row < table.num_rows(); row += rows_per_chunk) {
+      auto const end =
+          std::min<size_type>(row + rows_per_chunk, table.num_rows());
+      auto chunk = cudf::experimental::slice(table, {row, end});
+      write_chunk(chunk[0], stream);
+    }
+  }
+  out_sink_->flush();
+}
+
+// Forward to implementation
+writer::writer(std::unique_ptr<data_sink> sink, writer_options const& options,
+               rmm::mr::device_memory_resource* mr)
+    : _impl(std::make_unique<impl>(std::move(sink), options, mr)) {}
+
+// Destructor within this translation unit
+writer::~writer() = default;
+
+// Forward to implementation
+void writer::write_all(table_view const& table, const table_metadata* metadata,
+                       cudaStream_t stream) {
+  _impl->write(table, metadata, stream);
+}
+
+}  // namespace csv
+}  // namespace detail
+}  // namespace io
+}  // namespace experimental
+}  // namespace cudf
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file writer_impl.hpp
+ * @brief cuDF-IO CSV writer class implementation header
+ */
+
+#pragma once
+
+#include <cudf/io/data_sink.hpp>
+#include <cudf/io/writers.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <memory>
+#include <string>
+
+namespace cudf {
+namespace experimental {
+namespace io {
+namespace detail {
+namespace csv {
+
+using namespace cudf::io;
+
+/**
+ * @brief Implementation for CSV writer
+ *
+ * Each column is converted to a strings column on the device with the
+ * existing cudf::strings conversion kernels, the per-row string fragments are
+ * fused into full lines, and the resulting character buffer is streamed
+ * through the data sink; the host never touches individual values.
+ **/
+class writer::impl {
+ public:
+  /**
+   * @brief Constructor with writer options.
+   *
+   * @param sink Output sink to write the data to
+   * @param options Settings for controlling behavior
+   * @param mr Resource to use for device memory allocation
+   **/
+  impl(std::unique_ptr<data_sink> sink, writer_options const& options,
+       rmm::mr::device_memory_resource* mr);
+
+  /**
+   * @brief Write an entire dataset to CSV format.
+   *
+   * @param table The set of columns
+   * @param metadata The metadata associated with the table
+   * @param stream Stream to use for memory allocation and kernels
+   **/
+  void write(table_view const& table, const table_metadata* metadata,
+             cudaStream_t stream);
+
+ private:
+  /**
+   * @brief Write the header line built from the metadata column names.
+   *
+   * @param metadata The metadata associated with the table
+   **/
+  void write_header(const table_metadata* metadata, size_type num_columns);
+
+  /**
+   * @brief Convert a chunk of rows to device lines and stream them to the sink.
+   *
+   * @param table The chunk of rows to write
+   * @param stream Stream to use for memory allocation and kernels
+   **/
+  void write_chunk(table_view const& table, cudaStream_t stream);
+
+ private:
+  std::unique_ptr<data_sink> out_sink_;
+  writer_options const options_;
+  rmm::mr::device_memory_resource* _mr = nullptr;
+};
+
+}  // namespace csv
+}  // namespace detail
+}  // namespace io
+}  // namespace experimental
+}  // namespace cudf
@@ -14,15 +14,25 @@
  * limitations under the License.
  */
 
+#include <cudf/concatenate.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/io/functions.hpp>
 #include <cudf/io/readers.hpp>
+#include <cudf/io/table_cache.hpp>
 #include <cudf/io/writers.hpp>
+#include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include "csv/chunked_state.hpp"
 #include "orc/chunked_state.hpp"
 #include "parquet/chunked_state.hpp"
 
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <future>
+
 namespace cudf {
 namespace experimental {
 namespace io {
@@ -62,45 +72,10 @@ std::unique_ptr<writer> make_writer(sink_info const& sink,
   }
 }
 
-}  // namespace
-
-// Freeform API wraps the detail reader class API
-table_with_metadata read_avro(read_avro_args const& args,
-                              rmm::mr::device_memory_resource* mr) {
-  namespace avro = cudf::experimental::io::detail::avro;
-
-  avro::reader_options options{args.columns};
-  auto reader = make_reader<avro::reader>(args.source, options, mr);
-
-  if (args.skip_rows != -1 || args.num_rows != -1) {
-    return reader->read_rows(args.skip_rows, args.num_rows);
-  } else {
-    return reader->read_all();
-  }
-}
-
-// Freeform API wraps the detail reader class API
-table_with_metadata read_json(read_json_args const& args,
-                                rmm::mr::device_memory_resource* mr) {
-  namespace json = cudf::experimental::io::detail::json;
-
-  json::reader_options options{args.lines, args.compression, args.dtype, args.dayfirst};
-  auto reader = make_reader<json::reader>(args.source, options, mr);
-
-   if (args.byte_range_offset != 0 || args.byte_range_size != 0) {
-    return reader->read_byte_range(args.byte_range_offset,
-                                   args.byte_range_size);
-  } else {
-    return reader->read_all();
-  }
-}
-
-// Freeform API wraps the detail reader class API
-table_with_metadata read_csv(read_csv_args const& args,
-                                rmm::mr::device_memory_resource* mr) {
-  namespace csv = cudf::experimental::io::detail::csv;
-
-  csv::reader_options options{};
+// Translates the freeform csv argument struct to the detail reader options
+cudf::experimental::io::detail::csv::reader_options make_csv_reader_options(
+    read_csv_args const& args) {
+  cudf::experimental::io::detail::csv::reader_options options{};
   options.compression = args.compression;
   options.lineterminator = args.lineterminator;
   options.delimiter = args.delimiter;
@@ -135,44 +110,340 @@ table_with_metadata read_csv(read_csv_args const& args,
   options.quoting = args.quoting;
   options.doublequote = args.doublequote;
   options.timestamp_type = args.timestamp_type;
+  options.error_row_offsets = args.error_row_offsets;
+  return options;
+}
+
+// Returns the size in bytes of a file or host-buffer input source
+size_t get_source_size(source_info const& source) {
+  if (source.type == io_type::FILEPATH) {
+    struct stat st;
+    CUDF_EXPECTS(stat(source.filepath.c_str(), &st) == 0,
+                 "Cannot query input file size");
+    return static_cast<size_t>(st.st_size);
+  } else if (source.type == io_type::HOST_BUFFER) {
+    return source.buffer.second;
+  } else {
+    CUDF_FAIL("Unsupported source type for byte-based partitioning");
+  }
+}
+
+// Maps a column type back to a dtype string accepted by the csv reader
+std::string dtype_to_string(data_type type) {
+  switch (type.id()) {
+    case type_id::INT8: return "int8";
+    case type_id::INT16: return "int16";
+    case type_id::INT32: return "int32";
+    case type_id::INT64: return "int64";
+    case type_id::FLOAT32: return "float32";
+    case type_id::FLOAT64: return "float64";
+    case type_id::BOOL8: return "bool";
+    case type_id::STRING: return "str";
+    case type_id::TIMESTAMP_DAYS: return "date32";
+    case type_id::TIMESTAMP_SECONDS: return "timestamp[s]";
+    case type_id::TIMESTAMP_MILLISECONDS: return "timestamp[ms]";
+    case type_id::TIMESTAMP_MICROSECONDS: return "timestamp[us]";
+    case type_id::TIMESTAMP_NANOSECONDS: return "timestamp[ns]";
+    default: CUDF_FAIL("Unsupported column type for csv dtype");
+  }
+}
+
+}  // namespace
+
+// Freeform API wraps the detail reader class API
+table_with_metadata read_avro(read_avro_args const& args,
+                              rmm::mr::device_memory_resource* mr,
+                              cudaStream_t stream) {
+  CUDF_FUNC_RANGE_COLOR(cudf::range_color::io);
+  namespace avro = cudf::experimental::io::detail::avro;
+
+  avro::reader_options options{args.columns};
+  auto reader = make_reader<avro::reader>(args.source, options, mr);
+
+  if (args.skip_rows != -1 || args.num_rows != -1) {
+    return reader->read_rows(args.skip_rows, args.num_rows, stream);
+  } else {
+    return reader->read_all(stream);
+  }
+}
+
+// Freeform API wraps the detail reader class API
+table_with_metadata read_json(read_json_args const& args,
+                                rmm::mr::device_memory_resource* mr,
+                                cudaStream_t stream) {
+  CUDF_FUNC_RANGE_COLOR(cudf::range_color::io);
+  namespace json = cudf::experimental::io::detail::json;
+
+  json::reader_options options{args.lines, args.compression, args.dtype, args.dayfirst};
+  options.names = args.names;
+  auto reader = make_reader<json::reader>(args.source, options, mr);
+
+   if (args.byte_range_offset != 0 || args.byte_range_size != 0) {
+    return reader->read_byte_range(args.byte_range_offset,
+                                   args.byte_range_size, stream);
+  } else {
+    return reader->read_all(stream);
+  }
+}
+
+// Freeform API wraps the detail reader class API
+table_with_metadata read_json_multi(read_json_multi_args const& args,
+                                    rmm::mr::device_memory_resource* mr) {
+  namespace json = cudf::experimental::io::detail::json;
+
+  CUDF_EXPECTS(!args.sources.empty(), "Need at least one source to read");
+
+  json::reader_options options{args.lines, args.compression, args.dtype,
+                               args.dayfirst};
+  options.names = args.names;
+
+  // Single-source requests take the regular path; nothing to overlap
+  if (args.sources.size() == 1) {
+    return make_reader<json::reader>(args.sources[0], options, mr)->read_all();
+  }
+
+  // Each source gets its own reader and stream; record detection and field
+  // decode of the sources run concurrently and the per-source sync points
+  // no longer serialize back to back
+  std::vector<std::future<table_with_metadata>> parts;
+  parts.reserve(args.sources.size());
+  for (auto const& source : args.sources) {
+    parts.emplace_back(
+        std::async(std::launch::async, [&options, &source, mr]() {
+          cudaStream_t stream = nullptr;
+          CUDA_TRY(cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+          auto reader = make_reader<json::reader>(source, options, mr);
+          auto table = reader->read_all(stream);
+          CUDA_TRY(cudaStreamSynchronize(stream));
+          CUDA_TRY(cudaStreamDestroy(stream));
+          return table;
+        }));
+  }
+
+  std::vector<table_with_metadata> results;
+  results.reserve(parts.size());
+  for (auto& part : parts) {
+    results.emplace_back(part.get());
+  }
+
+  std::vector<table_view> views;
+  views.reserve(results.size());
+  for (auto const& result : results) {
+    views.emplace_back(result.tbl->view());
+  }
+
+  table_with_metadata fused;
+  fused.tbl = cudf::experimental::concatenate(views, mr);
+  fused.metadata = std::move(results.front().metadata);
+  return fused;
+}
+
+// Freeform API wraps the detail reader class API
+table_with_metadata read_csv(read_csv_args const& args,
+                                rmm::mr::device_memory_resource* mr,
+                                cudaStream_t stream) {
+  CUDF_FUNC_RANGE_COLOR(cudf::range_color::io);
+  namespace csv = cudf::experimental::io::detail::csv;
+
+  auto options = make_csv_reader_options(args);
   auto reader = make_reader<csv::reader>(args.source, options, mr);
 
   if (args.byte_range_offset != 0 || args.byte_range_size != 0) {
     return reader->read_byte_range(args.byte_range_offset,
-                                   args.byte_range_size);
+                                   args.byte_range_size, stream);
   } else if (args.skiprows != -1 || args.skipfooter != -1 || args.nrows != -1) {
-    return reader->read_rows(args.skiprows, args.skipfooter, args.nrows);
+    return reader->read_rows(args.skiprows, args.skipfooter, args.nrows,
+                             stream);
   } else {
-    return reader->read_all();
+    return reader->read_all(stream);
+  }
+}
+
+// Freeform API wraps the detail reader class API
+std::vector<table_with_metadata> read_csv_partitioned(
+    read_csv_args const& args, size_type num_partitions,
+    rmm::mr::device_memory_resource* mr) {
+  namespace csv = cudf::experimental::io::detail::csv;
+
+  CUDF_EXPECTS(num_partitions > 0, "Invalid number of partitions");
+
+  // Total number of bytes to split across the partitions
+  size_t total_size = get_source_size(args.source);
+  total_size -= std::min(total_size, args.byte_range_offset);
+  if (args.byte_range_size != 0) {
+    total_size = std::min(total_size, args.byte_range_size);
+  }
+
+  auto options = make_csv_reader_options(args);
+  const size_t part_size =
+      (total_size + num_partitions - 1) / num_partitions;
+  // Clamping can leave trailing partitions empty (tiny inputs); those are
+  // dropped rather than returned as empty tables
+  while (num_partitions > 1 &&
+         static_cast<size_t>(num_partitions - 1) * part_size >= total_size) {
+    num_partitions--;
   }
+  std::vector<table_with_metadata> tables(num_partitions);
+
+  // The first partition is read up front so the remaining partitions can
+  // reuse its column names instead of looking for a header mid-file
+  {
+    auto reader = make_reader<csv::reader>(args.source, options, mr);
+    tables[0] = reader->read_byte_range(args.byte_range_offset,
+                                        std::min(part_size, total_size));
+  }
+  if (num_partitions > 1) {
+    options.header = -1;
+    if (options.names.empty()) {
+      options.names = tables[0].metadata.column_names;
+    }
+    // A row belongs to the partition its first byte falls into, so rows
+    // straddling a boundary are produced exactly once. Each partition gets
+    // its own reader and stream; the row-offset scan and decode of the
+    // partitions run concurrently
+    std::vector<std::future<table_with_metadata>> parts;
+    for (size_type i = 1; i < num_partitions; i++) {
+      const size_t offset = args.byte_range_offset + i * part_size;
+      const size_t size = std::min(part_size, total_size - i * part_size);
+      parts.emplace_back(std::async(
+          std::launch::async, [&args, &options, mr, offset, size]() {
+            cudaStream_t stream = nullptr;
+            CUDA_TRY(cudaStreamCreateWithFlags(&stream,
+                                               cudaStreamNonBlocking));
+            auto reader = make_reader<csv::reader>(args.source, options, mr);
+            auto table = reader->read_byte_range(offset, size, stream);
+            CUDA_TRY(cudaStreamSynchronize(stream));
+            CUDA_TRY(cudaStreamDestroy(stream));
+            return table;
+          }));
+    }
+    for (size_type i = 1; i < num_partitions; i++) {
+      tables[i] = parts[i - 1].get();
+    }
+  }
+  return tables;
+}
+
+// Freeform API wraps the detail reader class API
+std::shared_ptr<detail::csv::csv_chunked_read_state> read_csv_chunked_begin(
+    read_csv_chunked_args const& args, rmm::mr::device_memory_resource* mr) {
+  namespace csv = cudf::experimental::io::detail::csv;
+
+  CUDF_EXPECTS(args.chunk_bytes > 0, "Invalid chunk byte budget");
+
+  auto state = std::make_shared<csv::csv_chunked_read_state>();
+  state->source = args.reader_args.source;
+  state->options = make_csv_reader_options(args.reader_args);
+  state->mr = mr;
+  state->stream = 0;
+  state->chunk_bytes = args.chunk_bytes;
+  state->next_offset = args.reader_args.byte_range_offset;
+
+  state->total_size = get_source_size(state->source);
+  if (args.reader_args.byte_range_size != 0) {
+    state->total_size =
+        std::min(state->total_size,
+                 state->next_offset + args.reader_args.byte_range_size);
+  }
+  state->exhausted = state->next_offset >= state->total_size;
+
+  return state;
+}
+
+// Freeform API wraps the detail reader class API
+bool read_csv_chunked_has_next(
+    std::shared_ptr<detail::csv::csv_chunked_read_state> state) {
+  CUDF_EXPECTS(state != nullptr, "Invalid chunked-read state");
+  return !state->exhausted;
+}
+
+// Freeform API wraps the detail reader class API
+table_with_metadata read_csv_chunked(
+    std::shared_ptr<detail::csv::csv_chunked_read_state> state) {
+  namespace csv = cudf::experimental::io::detail::csv;
+
+  CUDF_EXPECTS(state != nullptr, "Invalid chunked-read state");
+  CUDF_EXPECTS(!state->exhausted, "All input has already been read");
+
+  auto const size =
+      std::min(state->chunk_bytes, state->total_size - state->next_offset);
+  auto reader =
+      make_reader<csv::reader>(state->source, state->options, state->mr);
+  auto table = reader->read_byte_range(state->next_offset, size, state->stream);
+  state->next_offset += size;
+  state->exhausted = state->next_offset >= state->total_size;
+
+  if (!state->types_locked) {
+    // Lock in names and types from the first chunk so later chunks skip the
+    // header search and the type inference scan entirely
+    state->options.header = -1;
+    if (state->options.names.empty()) {
+      state->options.names = table.metadata.column_names;
+    }
+    if (state->options.dtype.empty() &&
+        state->options.use_cols_names.empty() &&
+        state->options.use_cols_indexes.empty()) {
+      for (auto const& col : table.tbl->view()) {
+        state->options.dtype.push_back(dtype_to_string(col.type()));
+      }
+    }
+    state->types_locked = true;
+  }
+  return table;
+}
+
+// Freeform API wraps the detail reader class API
+void read_csv_chunked_end(
+    std::shared_ptr<detail::csv::csv_chunked_read_state>& state) {
+  CUDF_EXPECTS(state != nullptr, "Invalid chunked-read state");
+  state.reset();
+}
+
+// Freeform API wraps the detail writer class API
+void write_csv(write_csv_args const& args,
+               rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE_COLOR(cudf::range_color::io);
+  namespace csv = cudf::experimental::io::detail::csv;
+
+  csv::writer_options options{args.na_rep,         args.include_header,
+                              args.rows_per_chunk, args.line_terminator,
+                              args.inter_column_delimiter,
+                              args.true_value,     args.false_value};
+  auto writer = make_writer<csv::writer>(args.sink, options, mr);
+
+  writer->write_all(args.table, args.metadata);
 }
 
 namespace orc = cudf::experimental::io::detail::orc;
 
 // Freeform API wraps the detail reader class API
 table_with_metadata read_orc(read_orc_args const& args,
-                                rmm::mr::device_memory_resource* mr) {
+                                rmm::mr::device_memory_resource* mr,
+                                cudaStream_t stream) {
+  CUDF_FUNC_RANGE_COLOR(cudf::range_color::io);
   orc::reader_options options{args.columns, args.use_index, args.use_np_dtypes,
                               args.timestamp_type, args.decimals_as_float,
                               args.forced_decimals_scale};
   auto reader = make_reader<orc::reader>(args.source, options, mr);
 
   if (args.stripe != -1) {
-    return reader->read_stripe(args.stripe, std::max(args.stripe_count, 1));
+    return reader->read_stripe(args.stripe, std::max(args.stripe_count, 1),
+                               stream);
   } else if (args.skip_rows != -1 || args.num_rows != -1) {
-    return reader->read_rows(args.skip_rows, args.num_rows);
+    return reader->read_rows(args.skip_rows, args.num_rows, stream);
   } else {
-    return reader->read_all();
+    return reader->read_all(stream);
   }
 }
 
 // Freeform API wraps the detail writer class API
 void write_orc(write_orc_args const& args,
-               rmm::mr::device_memory_resource* mr) {
+               rmm::mr::device_memory_resource* mr, cudaStream_t stream) {
+  CUDF_FUNC_RANGE_COLOR(cudf::range_color::io);
   orc::writer_options options{args.compression, args.enable_statistics};
   auto writer = make_writer<orc::writer>(args.sink, options, mr);
 
-  writer->write_all(args.table, args.metadata);
+  writer->write_all(args.table, args.metadata, stream);
 }
 
 /**
@@ -214,48 +485,292 @@ void write_orc_chunked_end(std::shared_ptr<orc::orc_chunked_state>& state){
 }
 
 
+namespace {
+
+/**
+ * @brief Builds a cache fingerprint for a whole-file parquet read, or an
+ * empty string if the read is not cacheable.
+ *
+ * The fingerprint covers the file identity (path, size, mtime) and the
+ * reader options that change the decoded table.
+ */
+std::string parquet_cache_key(read_parquet_args const& args) {
+  if (args.source.type != io_type::FILEPATH || !args.columns.empty() ||
+      args.row_group != -1 || args.skip_rows != -1 || args.num_rows != -1) {
+    return std::string{};
+  }
+  struct stat st;
+  if (stat(args.source.filepath.c_str(), &st) != 0) {
+    return std::string{};
+  }
+  return args.source.filepath + "?size=" + std::to_string(st.st_size) +
+         "&mtime=" + std::to_string(st.st_mtime) +
+         "&cat=" + std::to_string(args.strings_to_categorical) +
+         "&pandas=" + std::to_string(args.use_pandas_metadata) +
+         "&ts=" + std::to_string(static_cast<int>(args.timestamp_type.id()));
+}
+
+}  // namespace
+
 // Freeform API wraps the detail reader class API
 table_with_metadata read_parquet(read_parquet_args const& args,
-                                    rmm::mr::device_memory_resource* mr) {
+                                    rmm::mr::device_memory_resource* mr,
+                                    cudaStream_t stream) {
+  CUDF_FUNC_RANGE_COLOR(cudf::range_color::io);
   namespace parquet = cudf::experimental::io::detail::parquet;
 
+  // consult the host table cache before touching the filesystem
+  auto& cache = table_cache::instance();
+  std::string cache_key;
+  if (cache.enabled()) {
+    cache_key = parquet_cache_key(args);
+    if (!cache_key.empty()) {
+      auto cached = cache.get(cache_key, mr, stream);
+      if (cached.tbl != nullptr) {
+        return cached;
+      }
+    }
+  }
+
   parquet::reader_options options{args.columns, args.strings_to_categorical,
                                   args.use_pandas_metadata,
                                   args.timestamp_type};
   auto reader = make_reader<parquet::reader>(args.source, options, mr);
 
   if (args.row_group != -1) {
-    return reader->read_row_group(args.row_group, std::max(args.row_group_count, 1));
+    return reader->read_row_group(args.row_group, std::max(args.row_group_count, 1),
+                                  stream);
   } else if (args.skip_rows != -1 || args.num_rows != -1) {
-    return reader->read_rows(args.skip_rows, args.num_rows);
+    return reader->read_rows(args.skip_rows, args.num_rows, stream);
   } else {
-    return reader->read_all();
+    auto result = reader->read_all(stream);
+    if (!cache_key.empty() && result.tbl != nullptr) {
+      cache.insert(cache_key, result.tbl->view(), result.metadata, stream);
+    }
+    return result;
+  }
+}
+
+struct lazy_parquet_reader::impl {
+  read_parquet_args args;
+  rmm::mr::device_memory_resource* mr;
+
+  impl(read_parquet_args const& args_, rmm::mr::device_memory_resource* mr_)
+      : args(args_), mr(mr_) {}
+
+  // Decodes only the named columns (all configured columns if empty)
+  table_with_metadata read_columns(std::vector<std::string> const& columns,
+                                   cudaStream_t stream) {
+    namespace parquet = cudf::experimental::io::detail::parquet;
+    auto read_args = args;
+    if (!columns.empty()) {
+      read_args.columns = columns;
+    }
+    parquet::reader_options options{read_args.columns, read_args.strings_to_categorical,
+                                    read_args.use_pandas_metadata,
+                                    read_args.timestamp_type};
+    auto reader = make_reader<parquet::reader>(read_args.source, options, mr);
+    if (read_args.row_group != -1) {
+      return reader->read_row_group(read_args.row_group,
+                                    std::max(read_args.row_group_count, 1), stream);
+    } else if (read_args.skip_rows != -1 || read_args.num_rows != -1) {
+      return reader->read_rows(read_args.skip_rows, read_args.num_rows, stream);
+    } else {
+      return reader->read_all(stream);
+    }
   }
+};
+
+lazy_parquet_reader::lazy_parquet_reader(read_parquet_args const& args,
+                                         rmm::mr::device_memory_resource* mr)
+    : _impl{std::make_unique<impl>(args, mr)} {}
+
+lazy_parquet_reader::~lazy_parquet_reader() = default;
+
+table_with_metadata lazy_parquet_reader::read(std::vector<std::string> const& columns) {
+  CUDF_FUNC_RANGE_COLOR(cudf::range_color::io);
+  return _impl->read_columns(columns, 0);
+}
+
+table_with_metadata lazy_parquet_reader::read_filtered(column_view const& row_mask,
+                                                       std::vector<std::string> const& columns) {
+  CUDF_FUNC_RANGE_COLOR(cudf::range_color::io);
+
+  // determine the set of columns to decode; an empty request means every
+  // column, whose names are taken from a rows-only read of the metadata
+  auto column_names = columns;
+  if (column_names.empty()) {
+    auto args = _impl->args;
+    args.row_group = -1;
+    args.skip_rows = 0;
+    args.num_rows = 0;
+    impl peek{args, _impl->mr};
+    column_names = peek.read_columns({}, 0).metadata.column_names;
+  }
+
+  // decode and filter one column at a time so dropped rows of one column
+  // are released before the next column is decompressed
+  table_with_metadata result;
+  std::vector<std::unique_ptr<column>> filtered_columns;
+  filtered_columns.reserve(column_names.size());
+  for (auto const& name : column_names) {
+    auto one = _impl->read_columns({name}, 0);
+    CUDF_EXPECTS(one.tbl != nullptr && one.tbl->num_columns() == 1,
+                 "Failed to decode column for filtered read");
+    CUDF_EXPECTS(one.tbl->num_rows() == row_mask.size(),
+                 "Row mask size does not match number of rows read");
+    auto filtered = experimental::apply_boolean_mask(one.tbl->view(), row_mask, _impl->mr);
+    filtered_columns.push_back(std::move(filtered->release().front()));
+  }
+  result.tbl = std::make_unique<table>(std::move(filtered_columns));
+  result.metadata.column_names = std::move(column_names);
+  return result;
+}
+
+// Freeform API wraps the detail reader class API
+table_with_metadata read_parquet_multi(read_parquet_multi_args const& args,
+                                       rmm::mr::device_memory_resource* mr) {
+  namespace parquet = cudf::experimental::io::detail::parquet;
+
+  CUDF_EXPECTS(!args.sources.empty(), "Need at least one source to read");
+
+  parquet::reader_options options{args.columns, args.strings_to_categorical,
+                                  args.use_pandas_metadata,
+                                  args.timestamp_type};
+
+  // Single-source requests take the regular path; nothing to overlap
+  if (args.sources.size() == 1) {
+    return make_reader<parquet::reader>(args.sources[0], options, mr)
+        ->read_all();
+  }
+
+  // Read each source on its own stream so decompression and decode for
+  // different files overlap, then fuse the results with a single pass
+  std::vector<std::unique_ptr<parquet::reader>> readers;
+  readers.reserve(args.sources.size());
+  for (auto const& source : args.sources) {
+    readers.emplace_back(make_reader<parquet::reader>(source, options, mr));
+  }
+
+  std::vector<cudaStream_t> streams(readers.size());
+  for (auto& stream : streams) {
+    CUDA_TRY(cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+  }
+
+  std::vector<table_with_metadata> results;
+  results.reserve(readers.size());
+  for (size_t i = 0; i < readers.size(); ++i) {
+    results.emplace_back(readers[i]->read_all(streams[i]));
+  }
+
+  std::vector<table_view> views;
+  views.reserve(results.size());
+  for (auto const& result : results) {
+    views.emplace_back(result.tbl->view());
+  }
+  for (auto& stream : streams) {
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    CUDA_TRY(cudaStreamDestroy(stream));
+  }
+
+  table_with_metadata fused;
+  fused.tbl = cudf::experimental::concatenate(views, mr);
+  fused.metadata = std::move(results.front().metadata);
+  return fused;
+}
+
+/**
+ * @copydoc cudf::experimental::io::read_parquet_chunked_begin
+ *
+ **/
+std::shared_ptr<detail::parquet::pq_chunked_read_state> read_parquet_chunked_begin(
+    read_parquet_chunked_args const& args, rmm::mr::device_memory_resource* mr) {
+  namespace parquet = cudf::experimental::io::detail::parquet;
+
+  CUDF_EXPECTS(args.chunk_rows > 0, "Invalid chunk row count");
+
+  parquet::reader_options options{args.columns, args.strings_to_categorical,
+                                  args.use_pandas_metadata,
+                                  args.timestamp_type};
+
+  auto state = std::make_shared<parquet::pq_chunked_read_state>();
+  state->rp = make_reader<parquet::reader>(args.source, options, mr);
+  state->chunk_rows = args.chunk_rows;
+  state->stream = 0;
+  return state;
+}
+
+/**
+ * @copydoc cudf::experimental::io::read_parquet_chunked_has_next
+ *
+ **/
+bool read_parquet_chunked_has_next(
+    std::shared_ptr<detail::parquet::pq_chunked_read_state> state) {
+  return !state->exhausted;
+}
+
+/**
+ * @copydoc cudf::experimental::io::read_parquet_chunked
+ *
+ **/
+table_with_metadata read_parquet_chunked(
+    std::shared_ptr<detail::parquet::pq_chunked_read_state> state) {
+  CUDF_EXPECTS(!state->exhausted, "Reading past the end of the dataset");
+
+  auto result = state->rp->read_rows(state->next_row, state->chunk_rows,
+                                     state->stream);
+  const auto rows_read = (result.tbl->num_columns() != 0)
+                             ? result.tbl->num_rows()
+                             : 0;
+  state->next_row += rows_read;
+  if (rows_read < state->chunk_rows) {
+    state->exhausted = true;
+  }
+  return result;
+}
+
+/**
+ * @copydoc cudf::experimental::io::read_parquet_chunked_end
+ *
+ **/
+void read_parquet_chunked_end(
+    std::shared_ptr<detail::parquet::pq_chunked_read_state>& state) {
+  state.reset();
 }
 
 // Freeform API wraps the detail writer class API
 void write_parquet(write_parquet_args const& args,
-               rmm::mr::device_memory_resource* mr) {
+               rmm::mr::device_memory_resource* mr, cudaStream_t stream) {
+  CUDF_FUNC_RANGE_COLOR(cudf::range_color::io);
   namespace parquet = cudf::experimental::io::detail::parquet;
 
   parquet::writer_options options{args.compression, args.stats_level};
   auto writer = make_writer<parquet::writer>(args.sink, options, mr);
 
-  writer->write_all(args.table, args.metadata);
+  writer->write_all(args.table, args.metadata, stream);
 }
 
 using namespace cudf::experimental::io::detail::parquet;
 namespace parquet = cudf::experimental::io::detail::parquet;
 
+/**
+ * @copydoc cudf::experimental::io::make_parquet_writer_template
+ *
+ **/
+std::shared_ptr<pq_writer_template> make_parquet_writer_template(){
+  return std::make_shared<pq_writer_template>();
+}
+
 /**
  * @copydoc cudf::experimental::io::write_parquet_chunked_begin
- * 
+ *
  **/
-std::shared_ptr<pq_chunked_state> write_parquet_chunked_begin(write_parquet_chunked_args const& args, rmm::mr::device_memory_resource* mr){     
+std::shared_ptr<pq_chunked_state> write_parquet_chunked_begin(write_parquet_chunked_args const& args, rmm::mr::device_memory_resource* mr){
   parquet::writer_options options{args.compression, args.stats_level};
 
-  auto state = std::make_shared<pq_chunked_state>();  
-  state->wp = make_writer<parquet::writer>(args.sink, options, mr); 
+  auto state = std::make_shared<pq_chunked_state>();
+  state->wp = make_writer<parquet::writer>(args.sink, options, mr);
+  state->schema_template = args.schema_template;
 
   // have to make a copy of the metadata here since we can't really 
   // guarantee the lifetime of the incoming pointer
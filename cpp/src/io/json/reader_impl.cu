@@ -278,7 +278,8 @@ void reader::impl::upload_data_to_device() {
   CUDF_EXPECTS(bytes_to_upload <= uncomp_size_, "Error finding the record within the specified byte range.\n");
 
   // Upload the raw data that is within the rows of interest
-  data_ = rmm::device_buffer(uncomp_data_ + start_offset, bytes_to_upload);
+  data_ = rmm::device_buffer(uncomp_data_ + start_offset, bytes_to_upload,
+                             0, mr_);
 }
 
 /**
@@ -505,7 +506,15 @@ table_with_metadata reader::impl::read(size_t range_offset, size_t range_size, c
   upload_data_to_device();
   CUDF_EXPECTS(data_.size() != 0, "Error uploading input data to the GPU.\n");
 
-  set_column_names(stream);
+  // A user-provided schema locks the column set: names are taken verbatim in
+  // record order and the first record is never copied back to the host for
+  // key detection. Combined with explicit dtypes below, nothing about the
+  // structure is rediscovered per batch.
+  if (!args_.names.empty()) {
+    metadata.column_names = args_.names;
+  } else {
+    set_column_names(stream);
+  }
   CUDF_EXPECTS(!metadata.column_names.empty(), "Error determining column names.\n");
   
   set_data_types(stream);
@@ -28,6 +28,8 @@
 #include <cudf/utilities/error.hpp>
 #include <cudf/io/data_sink.hpp>
 
+#include <rmm/thrust_rmm_allocator.h>
+
 #include <memory>
 #include <string>
 #include <vector>
@@ -60,6 +62,13 @@ struct orc_chunked_state {
   /// special parameter only used by detail::write() to indicate that we are guaranteeing
   /// a single table write.  this enables some internal optimizations.
   bool                                single_write_mode = false;
+  /// scratch space for string dictionary construction, grown as needed and
+  /// retained across write_chunked() calls to avoid per-chunk reallocation
+  rmm::device_vector<uint32_t>        dict_data;
+  rmm::device_vector<uint32_t>        dict_index;
+  /// columns (by index) whose dictionary encoding did not pay off in an
+  /// earlier chunk; dictionary construction is skipped for them afterwards
+  std::vector<bool>                   dict_disabled;
 };
 
 
@@ -75,6 +75,33 @@ void ProtobufReader::skip_struct_field(int t)
                 while (m_cur < fld_end) s->m.push_back(get_u32()); break; \
                 } \
 
+#define ORC_FLD_BOOL(id, m)                     \
+            case (id)*8+PB_TYPE_VARINT: s->m = (get_u32() != 0); break; \
+
+// Optional-field variants recording presence, for fields where the default
+// value is also a legal value (e.g. statistics min/max)
+#define ORC_FLD_INT64_OPT(id, m)                \
+            case (id)*8+PB_TYPE_VARINT: s->m = get_i64(); s->has_##m = true; break; \
+
+#define ORC_FLD_DOUBLE_OPT(id, m)               \
+            case (id)*8+PB_TYPE_FIXED64: {      \
+                uint64_t v = 0;                 \
+                for (int b = 0; b < 64; b += 8) v |= (uint64_t)getb() << b; \
+                memcpy(&s->m, &v, sizeof(double)); s->has_##m = true; \
+                break; }                        \
+
+#define ORC_FLD_STRING_OPT(id, m)               \
+            case (id)*8+PB_TYPE_FIXEDLEN: {     \
+                uint32_t n = get_u32(); if (n > (size_t)(end - m_cur)) return false; \
+                s->m.assign((const char *)m_cur, n); s->has_##m = true; m_cur += n; \
+                break; }                        \
+
+#define ORC_FLD_STRUCT(id, m)                   \
+            case (id)*8+PB_TYPE_FIXEDLEN: {     \
+                uint32_t n = get_u32(); if (n > (size_t)(end - m_cur)) return false; \
+                if (!read(&s->m, n)) return false; \
+                break; }                        \
+
 #define ORC_FLD_STRING(id, m)                   \
             case (id)*8+PB_TYPE_FIXEDLEN: {     \
                 uint32_t n = get_u32(); if (n > (size_t)(end - m_cur)) return false; \
@@ -178,6 +205,31 @@ ORC_BEGIN_STRUCT(Metadata)
     ORC_FLD_REPEATED_STRUCT(1, stripeStats)
 ORC_END_STRUCT()
 
+ORC_BEGIN_STRUCT(IntegerStatistics)
+    ORC_FLD_INT64_OPT(1, minimum)
+    ORC_FLD_INT64_OPT(2, maximum)
+ORC_END_STRUCT()
+
+ORC_BEGIN_STRUCT(DoubleStatistics)
+    ORC_FLD_DOUBLE_OPT(1, minimum)
+    ORC_FLD_DOUBLE_OPT(2, maximum)
+ORC_END_STRUCT()
+
+ORC_BEGIN_STRUCT(StringStatistics)
+    ORC_FLD_STRING_OPT(1, minimum)
+    ORC_FLD_STRING_OPT(2, maximum)
+ORC_END_STRUCT()
+
+ORC_BEGIN_STRUCT(ColumnStatisticsData)
+    ORC_FLD_UINT64(1, numberOfValues)
+    ORC_FLD_STRUCT(2, intStats)
+    ORC_FLD_STRUCT(3, doubleStats)
+    ORC_FLD_STRUCT(4, stringStats)
+    ORC_FLD_STRUCT(7, dateStats)
+    ORC_FLD_STRUCT(9, timestampStats)
+    ORC_FLD_BOOL(10, hasNull)
+ORC_END_STRUCT()
+
 
 // return the column name
 std::string FileFooter::GetColumnName(uint32_t column_id)
@@ -115,6 +115,43 @@ struct Metadata
     std::vector<StripeStatistics> stripeStats;
 };
 
+struct IntegerStatistics
+{
+    int64_t minimum = 0;
+    int64_t maximum = 0;
+    bool has_minimum = false;
+    bool has_maximum = false;
+};
+
+struct DoubleStatistics
+{
+    double minimum = 0;
+    double maximum = 0;
+    bool has_minimum = false;
+    bool has_maximum = false;
+};
+
+struct StringStatistics
+{
+    std::string minimum;
+    std::string maximum;
+    bool has_minimum = false;
+    bool has_maximum = false;
+};
+
+// Decoded form of a ColumnStatistics blob; only the statistics kinds useful
+// for min/max predicate evaluation are parsed
+struct ColumnStatisticsData
+{
+    uint64_t numberOfValues = 0;
+    IntegerStatistics intStats;
+    DoubleStatistics doubleStats;
+    StringStatistics stringStats;
+    IntegerStatistics dateStats;                // min/max in days from epoch
+    IntegerStatistics timestampStats;           // min/max in milliseconds from epoch
+    bool hasNull = false;
+};
+
 
 // Minimal protobuf reader for orc metadata
 
@@ -150,6 +187,10 @@ public:
     DECL_ORC_STRUCT(ColumnEncoding);
     DECL_ORC_STRUCT(StripeStatistics);
     DECL_ORC_STRUCT(Metadata);
+    DECL_ORC_STRUCT(IntegerStatistics);
+    DECL_ORC_STRUCT(DoubleStatistics);
+    DECL_ORC_STRUCT(StringStatistics);
+    DECL_ORC_STRUCT(ColumnStatisticsData);
 #undef DECL_ORC_STRUCT
 protected:
     bool InitSchema(FileFooter *);
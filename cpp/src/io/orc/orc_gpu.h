@@ -263,7 +263,7 @@ cudaError_t DecodeNullsAndStringDictionaries(ColumnDesc *chunks, DictionaryEntry
  * @return cudaSuccess if successful, a CUDA error code otherwise
  **/
 cudaError_t DecodeOrcColumnData(ColumnDesc *chunks, DictionaryEntry *global_dictionary, uint32_t num_columns, uint32_t num_stripes, size_t max_rows = ~0,
-                                size_t first_row = 0, int64_t *tz_table = 0, size_t tz_len = 0,
+                                size_t first_row = 0, const int64_t *tz_table = 0, size_t tz_len = 0,
                                 const RowGroup *row_groups = 0, uint32_t num_rowgroups = 0, uint32_t rowidx_stride = 0, cudaStream_t stream = (cudaStream_t)0);
 
 
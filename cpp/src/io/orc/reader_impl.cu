@@ -33,6 +33,8 @@
 
 #include <algorithm>
 #include <array>
+#include <mutex>
+#include <unordered_map>
 
 namespace cudf {
 namespace experimental {
@@ -134,6 +136,74 @@ constexpr std::pair<gpu::StreamIndexType, uint32_t> get_index_type_and_pos(
   }
 }
 
+/**
+ * @brief Process-level cache of timezone transition tables
+ *
+ * Parsing /usr/share/zoneinfo and uploading the transition table to the
+ * device costs milliseconds, which dominates short repeated reads of the
+ * same dataset. Tables are keyed by timezone name and retained in device
+ * memory; they are small (tens of KB at most) so no eviction is performed.
+ */
+class timezone_table_cache {
+ public:
+  static timezone_table_cache &instance() {
+    static timezone_table_cache cache;
+    return cache;
+  }
+
+  /**
+   * @brief Returns the device-side transition table for a timezone, building
+   * and caching it on first use
+   *
+   * @return Shared transition table; nullptr if the timezone cannot be parsed
+   */
+  std::shared_ptr<const rmm::device_vector<int64_t>> get(
+      const std::string &timezone_name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = entries_.find(timezone_name);
+    if (it != entries_.end()) {
+      return it->second;
+    }
+    std::vector<int64_t> host_table;
+    if (!BuildTimezoneTransitionTable(host_table, timezone_name)) {
+      return nullptr;
+    }
+    auto entry = std::make_shared<const rmm::device_vector<int64_t>>(
+        host_table.cbegin(), host_table.cend());
+    entries_.emplace(timezone_name, entry);
+    return entry;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::unordered_map<std::string,
+                     std::shared_ptr<const rmm::device_vector<int64_t>>>
+      entries_;
+};
+
+/**
+ * @brief Function that conservatively checks whether any value in [min, max]
+ * can satisfy `value <comparison> filter_value`
+ */
+template <typename T>
+bool stats_may_match(statistics_filter::op comparison, const T &filter_value,
+                     const T &min, const T &max) {
+  switch (comparison) {
+    case statistics_filter::op::EQ:
+      return !(filter_value < min) && !(max < filter_value);
+    case statistics_filter::op::LT:
+      return min < filter_value;
+    case statistics_filter::op::LE:
+      return !(filter_value < min);
+    case statistics_filter::op::GT:
+      return filter_value < max;
+    case statistics_filter::op::GE:
+      return !(max < filter_value);
+  }
+  return true;
+}
+
 }  // namespace
 
 /**
@@ -151,7 +221,7 @@ class metadata {
 
     // Read uncompressed postscript section (max 255 bytes + 1 byte for length)
     auto buffer = source->get_buffer(len - max_ps_size, max_ps_size);
-    const size_t ps_length = buffer->data()[max_ps_size - 1];
+    ps_length = buffer->data()[max_ps_size - 1];
     const uint8_t *ps_data = &buffer->data()[max_ps_size - ps_length - 1];
     ProtobufReader pb;
     pb.init(ps_data, ps_length);
@@ -229,7 +299,10 @@ class metadata {
     if (not selection.empty()) {
       orc::ProtobufReader pb;
 
-      stripefooters.resize(selection.size());
+      // Stripefooters are small; fetch them all with one vectored read
+      // instead of a read per stripe
+      std::vector<datasource::byte_range> sf_ranges;
+      sf_ranges.reserve(selection.size());
       for (size_t i = 0; i < selection.size(); ++i) {
         const auto stripe = selection[i].first;
         const auto sf_comp_offset =
@@ -237,8 +310,15 @@ class metadata {
         const auto sf_comp_length = stripe->footerLength;
         CUDF_EXPECTS(sf_comp_offset + sf_comp_length < source->size(),
                      "Invalid stripe information");
+        sf_ranges.push_back({static_cast<size_t>(sf_comp_offset),
+                             static_cast<size_t>(sf_comp_length)});
+      }
+      const auto sf_buffers = source->get_buffers(sf_ranges);
 
-        const auto buffer = source->get_buffer(sf_comp_offset, sf_comp_length);
+      stripefooters.resize(selection.size());
+      for (size_t i = 0; i < selection.size(); ++i) {
+        const auto sf_comp_length = selection[i].first->footerLength;
+        const auto &buffer = sf_buffers[i];
         size_t sf_length = 0;
         auto sf_data = decompressor->Decompress(buffer->data(), sf_comp_length,
                                                 &sf_length);
@@ -252,6 +332,150 @@ class metadata {
     return selection;
   }
 
+  /**
+   * @brief Lazily reads and parses the optional metadata section holding the
+   * per-stripe column statistics
+   *
+   * @return Whether statistics are available for every stripe in the file
+   **/
+  bool read_statistics() {
+    if (not md_loaded) {
+      md_loaded = true;
+      if (ps.metadataLength != 0) {
+        const auto len = source->size();
+        const auto buffer = source->get_buffer(
+            len - ps_length - 1 - ps.footerLength - ps.metadataLength,
+            ps.metadataLength);
+        size_t md_length = 0;
+        auto md_data = decompressor->Decompress(buffer->data(),
+                                                ps.metadataLength, &md_length);
+        ProtobufReader pb;
+        pb.init(md_data, md_length);
+        if (not pb.read(&md, md_length)) {
+          md.stripeStats.clear();
+        }
+      }
+    }
+    return md.stripeStats.size() == ff.stripes.size();
+  }
+
+  /**
+   * @brief Removes stripes whose column statistics prove that no row can
+   * satisfy the given predicates
+   *
+   * Filtering is conservative: if the file carries no stripe statistics, or a
+   * stripe's statistics are missing, unparsable or of an unsupported kind, the
+   * stripe is kept. When any stripe is dropped, the row selection is rebased
+   * to cover exactly the surviving stripes.
+   *
+   * @param[in] selection List of stripe info as returned by select_stripes()
+   * @param[in] filters Min/max predicates from the reader options
+   * @param[in,out] row_start Starting row within the first selected stripe
+   * @param[in,out] row_count Total number of rows selected
+   *
+   * @return Filtered list of stripe info
+   **/
+  auto filter_stripes(const std::vector<OrcStripeInfo> &selection,
+                      const std::vector<statistics_filter> &filters,
+                      int &row_start, int &row_count) {
+    if (not read_statistics()) {
+      return selection;
+    }
+
+    std::vector<OrcStripeInfo> filtered;
+    size_t filtered_rows = 0;
+    for (const auto &stripe : selection) {
+      const auto stripe_index = stripe.first - ff.stripes.data();
+      const auto &col_stats = md.stripeStats[stripe_index].colStats;
+      bool may_match = true;
+      for (const auto &filter : filters) {
+        for (int col = 0; col < get_num_columns(); ++col) {
+          if (ff.GetColumnName(col) != filter.column) {
+            continue;
+          }
+          if (static_cast<size_t>(col) >= col_stats.size()) break;
+          ColumnStatisticsData stats;
+          ProtobufReader pb(col_stats[col].data(), col_stats[col].size());
+          if (!pb.read(&stats, col_stats[col].size())) break;
+
+          switch (ff.types[col].kind) {
+            case orc::BYTE:
+            case orc::SHORT:
+            case orc::INT:
+            case orc::LONG:
+              if (!filter.is_string && stats.intStats.has_minimum &&
+                  stats.intStats.has_maximum) {
+                may_match = stats_may_match(
+                    filter.comparison, filter.numeric_value,
+                    static_cast<double>(stats.intStats.minimum),
+                    static_cast<double>(stats.intStats.maximum));
+              }
+              break;
+            case orc::FLOAT:
+            case orc::DOUBLE:
+              if (!filter.is_string && stats.doubleStats.has_minimum &&
+                  stats.doubleStats.has_maximum) {
+                may_match = stats_may_match(filter.comparison,
+                                            filter.numeric_value,
+                                            stats.doubleStats.minimum,
+                                            stats.doubleStats.maximum);
+              }
+              break;
+            case orc::STRING:
+            case orc::VARCHAR:
+            case orc::CHAR:
+              if (filter.is_string && stats.stringStats.has_minimum &&
+                  stats.stringStats.has_maximum) {
+                may_match = stats_may_match(filter.comparison,
+                                            filter.string_value,
+                                            stats.stringStats.minimum,
+                                            stats.stringStats.maximum);
+              }
+              break;
+            case orc::DATE:
+              // Statistics hold days from epoch
+              if (!filter.is_string && stats.dateStats.has_minimum &&
+                  stats.dateStats.has_maximum) {
+                may_match = stats_may_match(
+                    filter.comparison, filter.numeric_value,
+                    static_cast<double>(stats.dateStats.minimum),
+                    static_cast<double>(stats.dateStats.maximum));
+              }
+              break;
+            case orc::TIMESTAMP:
+              // Statistics hold milliseconds from epoch
+              if (!filter.is_string && stats.timestampStats.has_minimum &&
+                  stats.timestampStats.has_maximum) {
+                may_match = stats_may_match(
+                    filter.comparison, filter.numeric_value,
+                    static_cast<double>(stats.timestampStats.minimum),
+                    static_cast<double>(stats.timestampStats.maximum));
+              }
+              break;
+            default:
+              // No usable statistics for this type; keep the stripe
+              break;
+          }
+          break;
+        }
+        if (!may_match) break;
+      }
+      if (may_match) {
+        filtered.push_back(stripe);
+        filtered_rows += stripe.first->numberOfRows;
+      }
+    }
+
+    // Only rebase the row selection if stripes were actually dropped; the
+    // skip offset within the first stripe no longer applies in that case
+    if (filtered.size() != selection.size()) {
+      row_start = 0;
+      row_count = static_cast<int>(filtered_rows);
+    }
+
+    return filtered;
+  }
+
   /**
    * @brief Filters and reduces down to a selection of columns
    *
@@ -310,6 +534,9 @@ class metadata {
 
  private:
   datasource *const source;
+  size_t ps_length = 0;
+  Metadata md;            // Optional per-stripe statistics; lazily loaded
+  bool md_loaded = false;
 };
 
 namespace {
@@ -445,10 +672,12 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
   }
   CUDF_EXPECTS(total_decomp_size > 0, "No decompressible data found");
 
-  rmm::device_buffer decomp_data(total_decomp_size, stream);
+  rmm::device_buffer decomp_data(total_decomp_size, stream, _mr);
   rmm::device_vector<gpu_inflate_input_s> inflate_in(num_compressed_blocks +
                                                      num_uncompressed_blocks);
   rmm::device_vector<gpu_inflate_status_s> inflate_out(num_compressed_blocks);
+  // Snappy scratch memory for size-binning the blocks
+  rmm::device_vector<uint8_t> unsnap_scratch;
 
   // Parse again to populate the decompression input/output buffers
   size_t decomp_offset = 0;
@@ -481,8 +710,14 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
                             num_compressed_blocks, 0, stream));
         break;
       case orc::SNAPPY:
-        CUDA_TRY(gpu_unsnap(inflate_in.data().get(), inflate_out.data().get(),
-                            num_compressed_blocks, stream));
+        // Batched path bins the blocks by size so many small blocks do not
+        // serialize behind one warp-cooperative kernel block each
+        unsnap_scratch.resize(
+            get_gpu_unsnap_batched_scratch_size(num_compressed_blocks));
+        CUDA_TRY(gpu_unsnap_batched(inflate_in.data().get(),
+                                    inflate_out.data().get(),
+                                    unsnap_scratch.data().get(),
+                                    num_compressed_blocks, stream));
         break;
       default:
         CUDF_EXPECTS(false, "Unexpected decompression dispatch");
@@ -537,7 +772,7 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
 void reader::impl::decode_stream_data(
     const hostdevice_vector<gpu::ColumnDesc> &chunks, size_t num_dicts,
     size_t skip_rows, size_t num_rows,
-    const std::vector<int64_t> &timezone_table,
+    const rmm::device_vector<int64_t> &tz_table,
     const rmm::device_vector<gpu::RowGroup> &row_groups,
     size_t row_index_stride, std::vector<column_buffer> &out_buffers,
     cudaStream_t stream) {
@@ -556,9 +791,6 @@ void reader::impl::decode_stream_data(
   // Allocate global dictionary for deserializing
   rmm::device_vector<gpu::DictionaryEntry> global_dict(num_dicts);
 
-  // Allocate timezone transition table timestamp conversion
-  rmm::device_vector<int64_t> tz_table = timezone_table;
-
   CUDA_TRY(cudaMemcpyAsync(chunks.device_ptr(), chunks.host_ptr(),
                            chunks.memory_size(), cudaMemcpyHostToDevice,
                            stream));
@@ -607,6 +839,9 @@ reader::impl::impl(std::unique_ptr<datasource> source,
   // Control decimals conversion (float64 or int64 with optional scale)
   _decimals_as_float = options.decimals_as_float;
   _decimals_as_int_scale = options.forced_decimals_scale;
+
+  // Predicates for skipping stripes via their column statistics
+  _stripe_filters = options.stripe_filters;
 }
 
 table_with_metadata reader::impl::read(int skip_rows, int num_rows, int stripe,
@@ -615,9 +850,15 @@ table_with_metadata reader::impl::read(int skip_rows, int num_rows, int stripe,
   table_metadata out_metadata;
 
   // Select only stripes required (aka row groups)
-  const auto selected_stripes =
+  auto selected_stripes =
       _metadata->select_stripes(stripe, max_stripe_count, skip_rows, num_rows);
 
+  // Drop stripes whose statistics cannot satisfy the filter predicates
+  if (!_stripe_filters.empty()) {
+    selected_stripes = _metadata->filter_stripes(
+        selected_stripes, _stripe_filters, skip_rows, num_rows);
+  }
+
   // Association between each ORC column and its gdf_column
   std::vector<int32_t> orc_col_map(_metadata->get_num_columns(), -1);
 
@@ -662,6 +903,11 @@ table_with_metadata reader::impl::read(int skip_rows, int num_rows, int stripe,
     // Tracker for eventually deallocating compressed and uncompressed data
     std::vector<rmm::device_buffer> stripe_data;
 
+    // Keeps the source buffers alive until all the uploads have completed, so
+    // reading the next stripe from the source overlaps the in-flight copies
+    // instead of synchronizing after every coalesced read
+    std::vector<std::shared_ptr<arrow::Buffer>> host_buffers;
+
     size_t stripe_start_row = 0;
     size_t num_dict_entries = 0;
     size_t num_rowgroups = 0;
@@ -676,10 +922,13 @@ table_with_metadata reader::impl::read(int skip_rows, int num_rows, int stripe,
                              &num_dict_entries, chunks, stream_info);
       CUDF_EXPECTS(total_data_size > 0, "Expected streams data within stripe");
 
-      stripe_data.emplace_back(total_data_size, stream);
+      stripe_data.emplace_back(total_data_size, stream, _mr);
       auto dst_base = static_cast<uint8_t *>(stripe_data.back().data());
 
-      // Coalesce consecutive streams into one read
+      // Coalesce consecutive streams, then fetch the stripe's reads with one
+      // vectored read so nearby non-consecutive streams also merge
+      std::vector<datasource::byte_range> read_ranges;
+      std::vector<uint8_t *> read_dsts;
       while (stream_count < stream_info.size()) {
         const auto d_dst = dst_base + stream_info[stream_count].dst_pos;
         const auto offset = stream_info[stream_count].offset;
@@ -691,10 +940,15 @@ table_with_metadata reader::impl::read(int skip_rows, int num_rows, int stripe,
           len += stream_info[stream_count].length;
           stream_count++;
         }
-        const auto buffer = _source->get_buffer(offset, len);
-        CUDA_TRY(cudaMemcpyAsync(d_dst, buffer->data(), len,
-                                 cudaMemcpyHostToDevice, stream));
-        CUDA_TRY(cudaStreamSynchronize(stream));
+        read_ranges.push_back({offset, len});
+        read_dsts.push_back(d_dst);
+      }
+      const auto buffers = _source->get_buffers(read_ranges);
+      for (size_t k = 0; k < buffers.size(); ++k) {
+        CUDA_TRY(cudaMemcpyAsync(read_dsts[k], buffers[k]->data(),
+                                 buffers[k]->size(), cudaMemcpyHostToDevice,
+                                 stream));
+        host_buffers.push_back(buffers[k]);
       }
 
       // Update chunks to reference streams pointers
@@ -734,6 +988,12 @@ table_with_metadata reader::impl::read(int skip_rows, int num_rows, int stripe,
       }
     }
 
+    // Wait for the queued uploads before releasing the source buffers
+    if (not host_buffers.empty()) {
+      CUDA_TRY(cudaStreamSynchronize(stream));
+      host_buffers.clear();
+    }
+
     // Process dataset chunk pages into output columns
     if (stripe_data.size() != 0) {
       // Setup row group descriptors if using indexes
@@ -758,11 +1018,14 @@ table_with_metadata reader::impl::read(int skip_rows, int num_rows, int stripe,
       }
 
       // Setup table for converting timestamp columns from local to UTC time
-      std::vector<int64_t> tz_table;
+      // The table is cached for the process, keyed by timezone name
+      std::shared_ptr<const rmm::device_vector<int64_t>> tz_table;
       if (_has_timestamp_column) {
-        CUDF_EXPECTS(BuildTimezoneTransitionTable(
-                         tz_table, selected_stripes[0].second->writerTimezone),
-                     "Cannot setup timezone LUT");
+        tz_table = timezone_table_cache::instance().get(
+            selected_stripes[0].second->writerTimezone);
+        CUDF_EXPECTS(tz_table != nullptr, "Cannot setup timezone LUT");
+      } else {
+        tz_table = std::make_shared<const rmm::device_vector<int64_t>>();
       }
 
       std::vector<column_buffer> out_buffers;
@@ -778,7 +1041,7 @@ table_with_metadata reader::impl::read(int skip_rows, int num_rows, int stripe,
       }
 
       decode_stream_data(
-          chunks, num_dict_entries, skip_rows, num_rows, tz_table, row_groups,
+          chunks, num_dict_entries, skip_rows, num_rows, *tz_table, row_groups,
           _metadata->get_row_index_stride(), out_buffers, stream);
 
       for (size_t i = 0; i < column_types.size(); ++i) {
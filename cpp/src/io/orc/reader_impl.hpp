@@ -110,7 +110,7 @@ class reader::impl {
    * @param num_dicts Number of dictionary entries required
    * @param skip_rows Number of rows to offset from start
    * @param num_rows Number of rows to output
-   * @param timezone_table Local time to UTC conversion table
+   * @param tz_table Local time to UTC conversion table, in device memory
    * @param row_groups List of row index descriptors
    * @param row_index_stride Distance between each row index
    * @param out_buffers Output columns' device buffers
@@ -118,7 +118,7 @@ class reader::impl {
    */
   void decode_stream_data(const hostdevice_vector<gpu::ColumnDesc> &chunks,
                           size_t num_dicts, size_t skip_rows, size_t num_rows,
-                          const std::vector<int64_t> &timezone_table,
+                          const rmm::device_vector<int64_t> &tz_table,
                           const rmm::device_vector<gpu::RowGroup> &row_groups,
                           size_t row_index_stride,
                           std::vector<column_buffer> &out_buffers,
@@ -130,6 +130,7 @@ class reader::impl {
   std::unique_ptr<metadata> _metadata;
 
   std::vector<int> _selected_columns;
+  std::vector<statistics_filter> _stripe_filters;
   bool _use_index = true;
   bool _use_np_dtypes = true;
   bool _has_timestamp_column = false;
@@ -304,10 +304,13 @@ void writer::impl::build_dictionaries(
     std::vector<uint32_t> const &stripe_list,
     hostdevice_vector<gpu::DictionaryChunk> const &dict, uint32_t *dict_index,
     hostdevice_vector<gpu::StripeDictionary> &stripe_dict,
-    cudaStream_t stream) {
+    std::vector<bool> &dict_disabled, cudaStream_t stream) {
   const auto num_rowgroups = dict.size() / str_col_ids.size();
 
   for (size_t i = 0; i < str_col_ids.size(); i++) {
+    const size_t col_id = str_col_ids[i];
+    const bool was_disabled =
+        col_id < dict_disabled.size() && dict_disabled[col_id];
     size_t direct_cost = 0, dict_cost = 0;
     auto &str_column = columns[str_col_ids[i]];
     str_column.attach_stripe_dict(stripe_dict.host_ptr(),
@@ -334,11 +337,16 @@ void writer::impl::build_dictionaries(
       g += num_chunks;
     }
 
-    // Early disable of dictionary if it doesn't look good at the chunk level
-    if (enable_dictionary_ && dict_cost >= direct_cost) {
+    // Early disable of dictionary if it doesn't look good at the chunk level,
+    // or if an earlier chunk already proved it not worthwhile for this column
+    if (was_disabled || (enable_dictionary_ && dict_cost >= direct_cost)) {
       for (size_t j = 0; j < stripe_list.size(); j++) {
         stripe_dict[j * str_col_ids.size() + i].dict_data = nullptr;
       }
+      if (col_id >= dict_disabled.size()) {
+        dict_disabled.resize(col_id + 1, false);
+      }
+      dict_disabled[col_id] = true;
     }
   }
 
@@ -967,8 +975,15 @@ void writer::impl::write_chunked(table_view const& table, orc_chunked_state& sta
     }
   }
 
-  rmm::device_vector<uint32_t> dict_index(str_col_ids.size() * num_rows);
-  rmm::device_vector<uint32_t> dict_data(str_col_ids.size() * num_rows);
+  // Dictionary scratch space is retained in the chunked state so that
+  // consecutive chunks reuse the allocation instead of repeating it
+  const size_t dict_scratch_count = str_col_ids.size() * num_rows;
+  if (state.dict_index.size() < dict_scratch_count) {
+    state.dict_index.resize(dict_scratch_count);
+    state.dict_data.resize(dict_scratch_count);
+  }
+  auto &dict_index = state.dict_index;
+  auto &dict_data = state.dict_data;
 
   // Build per-column dictionary indices
   const auto num_rowgroups = div_by_rowgroups<size_t>(num_rows);
@@ -1015,7 +1030,8 @@ void writer::impl::write_chunked(table_view const& table, orc_chunked_state& sta
   hostdevice_vector<gpu::StripeDictionary> stripe_dict(num_stripe_dict);
   if (str_col_ids.size() != 0) {
     build_dictionaries(orc_columns.data(), num_rows, str_col_ids, stripe_list,
-                       dict, dict_index.data().get(), stripe_dict, state.stream);
+                       dict, dict_index.data().get(), stripe_dict,
+                       state.dict_disabled, state.stream);
   }
 
   // Initialize streams
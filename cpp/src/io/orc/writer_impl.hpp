@@ -136,6 +136,8 @@ class writer::impl {
    * @param dict List of dictionary chunks
    * @param dict_index List of dictionary indices
    * @param stripe_dict List of stripe dictionaries
+   * @param dict_disabled Columns whose dictionary encoding did not pay off in
+   * an earlier chunk; updated with this chunk's decisions
    * @param stream Stream to use for memory allocation and kernels
    **/
   void build_dictionaries(orc_column_view* columns, size_t num_rows,
@@ -144,6 +146,7 @@ class writer::impl {
                           hostdevice_vector<gpu::DictionaryChunk> const& dict,
                           uint32_t* dict_index,
                           hostdevice_vector<gpu::StripeDictionary>& stripe_dict,
+                          std::vector<bool>& dict_disabled,
                           cudaStream_t stream);
 
   /**
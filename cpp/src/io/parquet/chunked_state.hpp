@@ -28,6 +28,26 @@ namespace experimental {
 namespace io {
 namespace detail {
 namespace parquet {
+   /**
+    * @brief Reusable schema information for writers producing files with
+    *        identical schemas.
+    *
+    * The schema portion of the file metadata depends only on the column
+    * types, names and nullability, so a sink writing many same-schema files
+    * can derive it once and hand the template to every subsequent writer
+    * instead of rebuilding it per file. The template is filled in by the
+    * first write that uses it; later writes copy the prebuilt elements and
+    * only verify the incoming table against them.
+    *
+    * A template must not be shared between writers running concurrently.
+    */
+   struct pq_writer_template {
+      /// Prebuilt schema elements; empty until the first write populates it
+      std::vector<cudf::io::parquet::SchemaElement>  schema;
+      /// Prebuilt column-order list size for the statistics setting
+      uint32_t                                       column_order_listsize = 0;
+   };
+
    /**
     * @brief Chunked writer state struct. Contains various pieces of information
     *        needed that span the begin() / write() / end() call process.
@@ -46,9 +66,32 @@ namespace parquet {
       /// only used in the write_chunked() case. copied from the (optionally) user supplied
       /// argument to write_parquet_chunked_begin()
       table_metadata_with_nullability     user_metadata_with_nullability;  
-      /// special parameter only used by detail::write() to indicate that we are guaranteeing 
+      /// special parameter only used by detail::write() to indicate that we are guaranteeing
       /// a single table write.  this enables some internal optimizations.
       bool                                single_write_mode = false;
+      /// optional schema template shared with other writers of identical-schema files
+      std::shared_ptr<pq_writer_template> schema_template;
+   };
+
+   /**
+    * @brief Chunked reader state struct. Contains information that spans the
+    *        begin() / read() / end() call process.
+    *
+    * Keeping the reader instance alive across chunks means file metadata is
+    * parsed once and internal scratch survives between read calls, rather
+    * than paying full reader re-initialization per chunk.
+    */
+   struct pq_chunked_read_state {
+      /// The reader to be used
+      std::unique_ptr<reader>             rp;
+      /// Cuda stream to be used
+      cudaStream_t                        stream;
+      /// Number of rows returned per chunk
+      size_type                           chunk_rows;
+      /// Next row to be read
+      size_type                           next_row = 0;
+      /// Whether the previous chunk reached the end of the dataset
+      bool                                exhausted = false;
    };
 
 }  // namespace parquet
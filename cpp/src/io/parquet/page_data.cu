@@ -1125,6 +1125,30 @@ gpuDecodePageData(PageInfo *pages, ColumnChunkDesc *chunks, size_t min_row, size
         }
     }
     __syncthreads();
+    if (s->page.flags & PAGEINFO_FLAGS_SKIPPED)
+    {
+        // Page pruned via its column index statistics: contribute all-null
+        // rows for its row range without decoding any values
+        size_t page_start = s->col.start_row + s->page.chunk_row;
+        size_t first = (page_start < min_row) ? min_row : page_start;
+        size_t last = page_start + s->page.num_rows;
+        if (last > min_row + num_rows)
+        {
+            last = min_row + num_rows;
+        }
+        if (s->col.valid_map_base && first < last)
+        {
+            for (size_t row = first - min_row + t; row < last - min_row; row += blockDim.x)
+            {
+                atomicAnd(&s->col.valid_map_base[row >> 5], ~(1u << (row & 0x1f)));
+            }
+        }
+        if (!t)
+        {
+            pages[page_idx].valid_count = 0;
+        }
+        return;
+    }
     if (!t)
     {
         s->num_rows = 0;
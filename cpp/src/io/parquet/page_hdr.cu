@@ -342,7 +342,7 @@ gpuBuildStringDictionaryIndex(ColumnChunkDesc *chunks, int32_t num_chunks)
     {
         return;
     }
-    if (!t && ck->num_dict_pages > 0 && ck->str_dict_index)
+    if (!t && ck->num_dict_pages > 0 && ck->str_dict_index && !ck->dict_index_prebuilt)
     {
         // Data type to describe a string
         nvstrdesc_s *dict_index = ck->str_dict_index;
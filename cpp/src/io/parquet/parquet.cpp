@@ -139,6 +139,29 @@ bool CompactProtocolReader::skip_struct_field(int t, int depth)
 #define PARQUET_FLD_STRUCT(id, m)                \
             case id: if (t != ST_FLD_STRUCT || !read(&s->m)) return false; break; \
 
+#define PARQUET_FLD_BINARY(id, m)                \
+            case id: if (t != ST_FLD_BINARY) return false; else { uint32_t n = get_u32(); if (n < (size_t)(m_end - m_cur)) { s->m.assign(m_cur, m_cur + n); m_cur += n; } else return false; } break;  \
+
+#define PARQUET_FLD_STRUCT_BLOB(id, m)           \
+            case id: if (t != ST_FLD_STRUCT) return false; \
+                { const uint8_t *blob_start = m_cur; if (!skip_struct_field(t)) return false; \
+                  s->m.assign(blob_start, m_cur); break; } \
+
+#define PARQUET_FLD_BOOL_LIST(id, m) \
+            case id: if (t != ST_FLD_LIST) return false; \
+                { int n; c = getb(); if ((c & 0xf) != ST_FLD_TRUE && (c & 0xf) != ST_FLD_FALSE) return false; n = c >> 4; if (n == 0xf) n = get_u32(); \
+                  s->m.resize(n); for (int32_t i=0; i<n; i++) s->m[i] = (getb() == ST_FLD_TRUE); break; } \
+
+#define PARQUET_FLD_INT64_LIST(id, m) \
+            case id: if (t != ST_FLD_LIST) return false; \
+                { int n; c = getb(); if ((c & 0xf) != ST_FLD_I64) return false; n = c >> 4; if (n == 0xf) n = get_u32(); \
+                  s->m.resize(n); for (int32_t i=0; i<n; i++) s->m[i] = get_i64(); break; } \
+
+#define PARQUET_FLD_BINARY_LIST(id, m) \
+            case id: if (t != ST_FLD_LIST) return false; \
+                { int n; c = getb(); if ((c & 0xf) != ST_FLD_BINARY) return false; n = c >> 4; if (n == 0xf) n = get_u32(); \
+                  s->m.resize(n); for (int32_t i=0; i<n; i++) { uint32_t l = get_u32(); if (l < (size_t)(m_end - m_cur)) { s->m[i].assign(m_cur, m_cur + l); m_cur += l; } else return false; } break; } \
+
 #define PARQUET_END_STRUCT()              \
             default: /*printf("unknown fld %d of type %d\n", fld, t);*/ skip_struct_field(t);      \
             }                                   \
@@ -194,6 +217,24 @@ PARQUET_BEGIN_STRUCT(ColumnMetaData)
     PARQUET_FLD_INT64(9, data_page_offset)
     PARQUET_FLD_INT64(10, index_page_offset)
     PARQUET_FLD_INT64(11, dictionary_page_offset)
+    PARQUET_FLD_STRUCT_BLOB(12, statistics_blob)
+PARQUET_END_STRUCT()
+
+PARQUET_BEGIN_STRUCT(ColumnIndex)
+    PARQUET_FLD_BOOL_LIST(1, null_pages)
+    PARQUET_FLD_BINARY_LIST(2, min_values)
+    PARQUET_FLD_BINARY_LIST(3, max_values)
+    PARQUET_FLD_INT32(4, boundary_order)
+    PARQUET_FLD_INT64_LIST(5, null_counts)
+PARQUET_END_STRUCT()
+
+PARQUET_BEGIN_STRUCT(Statistics)
+    PARQUET_FLD_BINARY(1, max)
+    PARQUET_FLD_BINARY(2, min)
+    PARQUET_FLD_INT64(3, null_count)
+    PARQUET_FLD_INT64(4, distinct_count)
+    PARQUET_FLD_BINARY(5, max_value)
+    PARQUET_FLD_BINARY(6, min_value)
 PARQUET_END_STRUCT()
 
 PARQUET_BEGIN_STRUCT(PageHeader)
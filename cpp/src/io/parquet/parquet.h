@@ -85,6 +85,38 @@ struct ColumnMetaData {
   std::vector<uint8_t> statistics_blob;   // Encoded chunk-level statistics as binary blob
 };
 
+/**
+ * @brief Thrift-derived struct describing per-chunk statistics
+ *
+ * The `min`/`max` fields are the deprecated signed-comparison values; writers
+ * conforming to newer versions of the format populate `min_value`/`max_value`
+ * ordered by the column's sort order instead. Values are the plain encoding of
+ * the column's physical type.
+ **/
+struct Statistics {
+  std::vector<uint8_t> max;        // deprecated max value in signed comparison order
+  std::vector<uint8_t> min;        // deprecated min value in signed comparison order
+  int64_t null_count = -1;         // count of null values in the column
+  int64_t distinct_count = -1;     // count of distinct values occurring
+  std::vector<uint8_t> max_value;  // max value for column determined by sort order
+  std::vector<uint8_t> min_value;  // min value for column determined by sort order
+};
+
+/**
+ * @brief Thrift-derived struct describing per-page statistics for a column
+ * chunk (the ColumnIndex part of the page index)
+ *
+ * Entries are ordered by data page within the chunk. Values use the plain
+ * encoding of the column's physical type, like the chunk-level statistics.
+ **/
+struct ColumnIndex {
+  std::vector<uint8_t> null_pages;              // nonzero if all values in the page are null
+  std::vector<std::vector<uint8_t>> min_values; // lower bound per page
+  std::vector<std::vector<uint8_t>> max_values; // upper bound per page
+  int32_t boundary_order = 0;                   // whether bounds are ordered (0=unordered)
+  std::vector<int64_t> null_counts;             // count of nulls per page
+};
+
 /**
  * @brief Thrift-derived struct describing a chunk of data for a particular
  * column
@@ -246,6 +278,8 @@ class CompactProtocolReader
   DECL_PARQUET_STRUCT(DataPageHeader);
   DECL_PARQUET_STRUCT(DictionaryPageHeader);
   DECL_PARQUET_STRUCT(KeyValue);
+  DECL_PARQUET_STRUCT(Statistics);
+  DECL_PARQUET_STRUCT(ColumnIndex);
 #undef DECL_PARQUET_STRUCT
 
  public:
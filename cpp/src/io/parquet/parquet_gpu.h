@@ -32,6 +32,7 @@ namespace gpu {
  **/
 enum {
   PAGEINFO_FLAGS_DICTIONARY = 0x01,  // Indicates a dictionary page
+  PAGEINFO_FLAGS_SKIPPED = 0x02,     // Page pruned via statistics; emits null rows instead of decoding
 };
 
 /**
@@ -92,7 +93,8 @@ struct ColumnChunkDesc {
         codec(codec_),
         converted_type(converted_type_),
         decimal_scale(decimal_scale_),
-        ts_clock_rate(ts_clock_rate_) {}
+        ts_clock_rate(ts_clock_rate_),
+        dict_index_prebuilt(0) {}
 
   uint8_t *compressed_data;     // pointer to compressed column chunk data
   size_t compressed_size;       // total compressed data size for this chunk
@@ -117,6 +119,7 @@ struct ColumnChunkDesc {
   int8_t converted_type;        // converted type enum
   int8_t decimal_scale;         // decimal scale pow(10, -decimal_scale)
   int32_t ts_clock_rate;        // output timestamp clock frequency (0=default, 1000=ms, 1000000000=ns)
+  int32_t dict_index_prebuilt;  // nonzero if str_dict_index comes prebuilt (e.g. from a cache)
 };
 
 
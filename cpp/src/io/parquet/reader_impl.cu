@@ -22,6 +22,7 @@
 #include "reader_impl.hpp"
 
 #include <io/comp/gpuinflate.h>
+#include <io/utilities/scratch_pool.hpp>
 
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
@@ -30,8 +31,15 @@
 #include <rmm/thrust_rmm_allocator.h>
 #include <rmm/device_buffer.hpp>
 
+#include <sys/stat.h>
+
 #include <algorithm>
 #include <array>
+#include <cstdlib>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
 namespace cudf {
 namespace experimental {
@@ -161,6 +169,148 @@ std::tuple<int32_t, int32_t, int8_t> conversion_info(type_id column_type_id,
   return std::make_tuple(type_width, clock_rate, converted_type);
 }
 
+/**
+ * @brief Function that decodes a plain-encoded statistics value into a double
+ * for conservative numeric comparison
+ *
+ * @return True if the physical type has a numeric interpretation
+ */
+bool decode_stats_value(parquet::Type physical,
+                        const std::vector<uint8_t> &blob, double *value) {
+  switch (physical) {
+    case parquet::BOOLEAN:
+      if (blob.size() < 1) return false;
+      *value = static_cast<double>(blob[0] != 0);
+      return true;
+    case parquet::INT32: {
+      if (blob.size() < sizeof(int32_t)) return false;
+      int32_t v;
+      memcpy(&v, blob.data(), sizeof(v));
+      *value = static_cast<double>(v);
+      return true;
+    }
+    case parquet::INT64: {
+      if (blob.size() < sizeof(int64_t)) return false;
+      int64_t v;
+      memcpy(&v, blob.data(), sizeof(v));
+      *value = static_cast<double>(v);
+      return true;
+    }
+    case parquet::FLOAT: {
+      if (blob.size() < sizeof(float)) return false;
+      float v;
+      memcpy(&v, blob.data(), sizeof(v));
+      *value = static_cast<double>(v);
+      return true;
+    }
+    case parquet::DOUBLE:
+      if (blob.size() < sizeof(double)) return false;
+      memcpy(value, blob.data(), sizeof(double));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * @brief Process-wide LRU cache of decoded string dictionary pages
+ *
+ * Hot dimension tables are often re-read many times a day; rebuilding the
+ * device dictionary index on every read is pure overhead. Entries own both
+ * the decoded dictionary page bytes and the string index built against them,
+ * keyed by source identity (path + mtime) and chunk offset, so a cached
+ * index stays valid after the read's transient page data is freed. Readers
+ * hold shared ownership of any entry they use for the duration of the read,
+ * making LRU eviction safe.
+ **/
+class string_dict_cache {
+ public:
+  struct entry {
+    rmm::device_buffer page_data;                // decoded dictionary page bytes
+    rmm::device_vector<gpu::nvstrdesc_s> index;  // index built against page_data
+  };
+
+  static string_dict_cache &instance() {
+    static string_dict_cache cache;
+    return cache;
+  }
+
+  /**
+   * @brief Returns the cached entry for the key, or nullptr on a miss
+   **/
+  std::shared_ptr<entry> find(const std::string &key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+      return nullptr;
+    }
+    lru_.splice(lru_.begin(), lru_, it->second.second);
+    return it->second.first;
+  }
+
+  /**
+   * @brief Allocates and inserts an entry, evicting LRU entries over budget
+   *
+   * The caller is responsible for populating the entry's device buffers.
+   **/
+  std::shared_ptr<entry> insert(const std::string &key, size_t page_size,
+                                size_t num_entries, cudaStream_t stream) {
+    auto e = std::make_shared<entry>();
+    e->page_data = rmm::device_buffer(page_size, stream);
+    e->index.resize(num_entries);
+
+    const auto bytes = page_size + num_entries * sizeof(gpu::nvstrdesc_s);
+    std::lock_guard<std::mutex> lock(mutex_);
+    while (!lru_.empty() && cached_bytes_ + bytes > max_cached_bytes) {
+      auto victim = entries_.find(lru_.back());
+      cached_bytes_ -= victim->second.first->page_data.size() +
+                       victim->second.first->index.size() *
+                           sizeof(gpu::nvstrdesc_s);
+      entries_.erase(victim);
+      lru_.pop_back();
+    }
+    lru_.push_front(key);
+    entries_[key] = std::make_pair(e, lru_.begin());
+    cached_bytes_ += bytes;
+    return e;
+  }
+
+ private:
+  string_dict_cache() = default;
+
+  static constexpr size_t max_cached_bytes = 256 * 1024 * 1024;
+
+  std::mutex mutex_;
+  std::list<std::string> lru_;
+  std::unordered_map<std::string,
+                     std::pair<std::shared_ptr<entry>,
+                               std::list<std::string>::iterator>>
+      entries_;
+  size_t cached_bytes_ = 0;
+};
+
+/**
+ * @brief Function that conservatively checks whether any value in [min, max]
+ * can satisfy `value <comparison> filter_value`
+ */
+template <typename T>
+bool stats_may_match(statistics_filter::op comparison, const T &filter_value,
+                     const T &min, const T &max) {
+  switch (comparison) {
+    case statistics_filter::op::EQ:
+      return !(filter_value < min) && !(max < filter_value);
+    case statistics_filter::op::LT:
+      return min < filter_value;
+    case statistics_filter::op::LE:
+      return !(filter_value < min);
+    case statistics_filter::op::GT:
+      return filter_value < max;
+    case statistics_filter::op::GE:
+      return !(max < filter_value);
+  }
+  return true;
+}
+
 }  // namespace
 
 /**
@@ -285,6 +435,77 @@ struct metadata : public FileMetaData {
     return selection;
   }
 
+  /**
+   * @brief Removes row groups whose column chunk statistics prove that no row
+   * can satisfy the given predicates
+   *
+   * Filtering is conservative: row groups with missing statistics or columns
+   * with unsupported physical types are always kept. The starting rows of the
+   * surviving groups are rebased to zero so the output is contiguous.
+   *
+   * @param selection List of row group indexes and their starting rows
+   * @param filters Min/max predicates from the reader options
+   * @param row_start Starting row of the selection; rebased to zero
+   * @param row_count Total number of rows selected; updated on return
+   *
+   * @return Filtered list of row group indexes and their starting rows
+   */
+  auto filter_row_groups(const std::vector<std::pair<int, int>> &selection,
+                         const std::vector<statistics_filter> &filters,
+                         int &row_start, int &row_count) {
+    std::vector<std::pair<int, int>> filtered;
+
+    row_start = 0;
+    row_count = 0;
+    for (const auto &rg : selection) {
+      const auto &row_group = row_groups[rg.first];
+      bool may_match = true;
+      for (const auto &filter : filters) {
+        for (const auto &chunk : row_group.columns) {
+          if (get_column_name(chunk.meta_data.path_in_schema) !=
+              filter.column) {
+            continue;
+          }
+          if (chunk.meta_data.statistics_blob.empty()) break;
+          Statistics stats;
+          CompactProtocolReader cp(chunk.meta_data.statistics_blob.data(),
+                                   chunk.meta_data.statistics_blob.size());
+          if (!cp.read(&stats)) break;
+          // Prefer sort-order values; fall back to the deprecated fields
+          const auto &min_blob = !stats.min_value.empty() ? stats.min_value : stats.min;
+          const auto &max_blob = !stats.max_value.empty() ? stats.max_value : stats.max;
+          if (min_blob.empty() || max_blob.empty()) break;
+
+          const auto physical =
+              schema[chunk.schema_idx].type;
+          if (filter.is_string) {
+            if (physical != parquet::BYTE_ARRAY) break;
+            const std::string min(min_blob.begin(), min_blob.end());
+            const std::string max(max_blob.begin(), max_blob.end());
+            may_match = stats_may_match(filter.comparison, filter.string_value,
+                                        min, max);
+          } else {
+            double min, max;
+            if (!decode_stats_value(physical, min_blob, &min) ||
+                !decode_stats_value(physical, max_blob, &max)) {
+              break;
+            }
+            may_match = stats_may_match(filter.comparison,
+                                        filter.numeric_value, min, max);
+          }
+          break;
+        }
+        if (!may_match) break;
+      }
+      if (may_match) {
+        filtered.emplace_back(rg.first, row_count);
+        row_count += row_group.num_rows;
+      }
+    }
+
+    return filtered;
+  }
+
   /**
    * @brief Filters and reduces down to a selection of columns
    *
@@ -376,6 +597,11 @@ rmm::device_buffer reader::impl::decompress_page_data(
       const auto page_stride = chunks[c].max_num_pages;
       if (chunks[c].codec == codec) {
         for (int k = 0; k < page_stride; k++) {
+          // Pages pruned via statistics are never decoded; skip the
+          // decompression work as well
+          if (pages[page_count + k].flags & gpu::PAGEINFO_FLAGS_SKIPPED) {
+            continue;
+          }
           f(page_count + k);
         }
       }
@@ -385,13 +611,15 @@ rmm::device_buffer reader::impl::decompress_page_data(
 
   // Brotli scratch memory for decompressing
   rmm::device_vector<uint8_t> debrotli_scratch;
+  // Snappy scratch memory for size-binning the pages
+  rmm::device_vector<uint8_t> unsnap_scratch;
 
   // Count the exact number of compressed pages
   size_t num_comp_pages = 0;
   size_t total_decomp_size = 0;
-  std::array<std::pair<parquet::Compression, size_t>, 3> codecs{
+  std::array<std::pair<parquet::Compression, size_t>, 4> codecs{
       std::make_pair(parquet::GZIP, 0), std::make_pair(parquet::SNAPPY, 0),
-      std::make_pair(parquet::BROTLI, 0)};
+      std::make_pair(parquet::BROTLI, 0), std::make_pair(parquet::ZSTD, 0)};
 
   for (auto &codec : codecs) {
     for_each_codec_page(codec.first, [&](size_t page) {
@@ -402,10 +630,16 @@ rmm::device_buffer reader::impl::decompress_page_data(
     if (codec.first == parquet::BROTLI && codec.second > 0) {
       debrotli_scratch.resize(get_gpu_debrotli_scratch_size(codec.second));
     }
+    if (codec.first == parquet::SNAPPY && codec.second > 0) {
+      unsnap_scratch.resize(get_gpu_unsnap_batched_scratch_size(codec.second));
+    }
   }
 
-  // Dispatch batches of pages to decompress for each codec
-  rmm::device_buffer decomp_pages(total_decomp_size, stream);
+  // Dispatch batches of pages to decompress for each codec; scratch is
+  // borrowed from the process-wide pool to keep cudaMalloc/free out of the
+  // read hot path for repeated reader invocations
+  auto decomp_pages =
+      device_scratch_pool::instance().acquire(total_decomp_size, stream);
   hostdevice_vector<gpu_inflate_input_s> inflate_in(0, num_comp_pages, stream);
   hostdevice_vector<gpu_inflate_status_s> inflate_out(0, num_comp_pages,
                                                       stream);
@@ -447,9 +681,10 @@ rmm::device_buffer reader::impl::decompress_page_data(
                               argc - start_pos, 1, stream))
           break;
         case parquet::SNAPPY:
-          CUDA_TRY(gpu_unsnap(inflate_in.device_ptr(start_pos),
-                              inflate_out.device_ptr(start_pos),
-                              argc - start_pos, stream));
+          CUDA_TRY(gpu_unsnap_batched(
+              inflate_in.device_ptr(start_pos),
+              inflate_out.device_ptr(start_pos), unsnap_scratch.data().get(),
+              argc - start_pos, stream));
           break;
         case parquet::BROTLI:
           CUDA_TRY(gpu_debrotli(
@@ -457,6 +692,11 @@ rmm::device_buffer reader::impl::decompress_page_data(
               inflate_out.device_ptr(start_pos), debrotli_scratch.data().get(),
               debrotli_scratch.size(), argc - start_pos, stream));
           break;
+        case parquet::ZSTD:
+          CUDA_TRY(gpu_unzstd(inflate_in.device_ptr(start_pos),
+                              inflate_out.device_ptr(start_pos),
+                              argc - start_pos, stream));
+          break;
         default:
           CUDF_EXPECTS(false, "Unexpected decompression dispatch");
           break;
@@ -504,17 +744,60 @@ void reader::impl::decode_page_data(
     str_dict_index.resize(total_str_dict_indexes);
   }
 
+  // Entries borrowed from the dictionary cache; shared ownership keeps them
+  // alive through decode even if evicted concurrently
+  std::vector<std::shared_ptr<string_dict_cache::entry>> borrowed_dicts;
+
   // Update chunks with pointers to column data
   for (size_t c = 0, page_count = 0, str_ofs = 0; c < chunks.size(); c++) {
     if (is_dict_chunk(chunks[c])) {
       chunks[c].str_dict_index = str_dict_index.data().get() + str_ofs;
       str_ofs += pages[page_count].num_values;
+
+      // Consult the opt-in dictionary page cache: on a hit the prebuilt index
+      // is used directly; on a miss the page bytes are copied into a new
+      // entry and the index is built straight into cache-owned memory
+      if (c < _chunk_dict_keys.size() && !_chunk_dict_keys[c].empty()) {
+        auto &cache = string_dict_cache::instance();
+        auto cached = cache.find(_chunk_dict_keys[c]);
+        if (cached != nullptr) {
+          chunks[c].str_dict_index = cached->index.data().get();
+          chunks[c].dict_index_prebuilt = 1;
+        } else {
+          const auto dict_size = pages[page_count].uncompressed_page_size;
+          cached = cache.insert(_chunk_dict_keys[c], dict_size,
+                                pages[page_count].num_values, stream);
+          CUDA_TRY(cudaMemcpyAsync(cached->page_data.data(),
+                                   pages[page_count].page_data, dict_size,
+                                   cudaMemcpyDeviceToDevice, stream));
+          // Rebase the dictionary page onto the cached copy so the index is
+          // built against memory that outlives this read
+          pages[page_count].page_data =
+              static_cast<uint8_t *>(cached->page_data.data());
+          CUDA_TRY(cudaMemcpyAsync(pages.device_ptr(page_count),
+                                   pages.host_ptr(page_count),
+                                   sizeof(gpu::PageInfo),
+                                   cudaMemcpyHostToDevice, stream));
+          chunks[c].str_dict_index = cached->index.data().get();
+        }
+        borrowed_dicts.emplace_back(std::move(cached));
+      }
     }
     chunks[c].column_data_base = out_buffers[chunk_map[c]].data();
     chunks[c].valid_map_base = out_buffers[chunk_map[c]].null_mask();
     page_count += chunks[c].max_num_pages;
   }
 
+  // Host-side page skip flags must reach the device copy; the bulk page
+  // upload only happens on the decompression path
+  for (size_t i = 0; i < pages.size(); i++) {
+    if (pages[i].flags & gpu::PAGEINFO_FLAGS_SKIPPED) {
+      CUDA_TRY(cudaMemcpyAsync(pages.device_ptr(i), pages.host_ptr(i),
+                               sizeof(gpu::PageInfo), cudaMemcpyHostToDevice,
+                               stream));
+    }
+  }
+
   CUDA_TRY(cudaMemcpyAsync(chunks.device_ptr(), chunks.host_ptr(),
                            chunks.memory_size(), cudaMemcpyHostToDevice,
                            stream));
@@ -562,6 +845,9 @@ reader::impl::impl(std::unique_ptr<datasource> source,
 
   // Strings may be returned as either string or categorical columns
   _strings_to_categorical = options.strings_to_categorical;
+
+  // Predicates for skipping row groups via their chunk statistics
+  _row_group_filters = options.row_group_filters;
 }
 
 table_with_metadata reader::impl::read(int skip_rows, int num_rows, int row_group,
@@ -570,9 +856,15 @@ table_with_metadata reader::impl::read(int skip_rows, int num_rows, int row_grou
   table_metadata out_metadata;
 
   // Select only row groups required
-  const auto selected_row_groups =
+  auto selected_row_groups =
       _metadata->select_row_groups(row_group, max_rowgroup_count, skip_rows, num_rows);
 
+  // Drop row groups whose statistics cannot satisfy the filter predicates
+  if (!_row_group_filters.empty()) {
+    selected_row_groups = _metadata->filter_row_groups(
+        selected_row_groups, _row_group_filters, skip_rows, num_rows);
+  }
+
   // Get a list of column data types
   std::vector<data_type> column_types;
   if (_metadata->row_groups.size() != 0) {
@@ -600,6 +892,20 @@ table_with_metadata reader::impl::read(int skip_rows, int num_rows, int row_grou
     // Tracker for eventually deallocating compressed and uncompressed data
     std::vector<rmm::device_buffer> page_data(num_chunks);
 
+    _chunk_dict_keys.clear();
+
+    // Page index location and matching filter per chunk, for page-level
+    // statistics skipping
+    std::vector<std::pair<int64_t, int32_t>> chunk_col_index;
+    std::vector<const statistics_filter *> chunk_page_filter;
+
+    // Host-side chunk reads are deferred and issued as one vectored read so
+    // that nearby chunks coalesce into larger reads; the source buffers must
+    // stay alive until the uploads have completed
+    std::vector<datasource::byte_range> chunk_ranges;
+    std::vector<size_t> chunk_range_map;
+    std::vector<std::shared_ptr<arrow::Buffer>> host_buffers;
+
     // Initialize column chunk information
     size_t total_decompressed_size = 0;
     auto remaining_rows = num_rows;
@@ -638,10 +944,19 @@ table_with_metadata reader::impl::read(int skip_rows, int num_rows, int row_grou
                                   ? std::min(col_meta.data_page_offset,
                                              col_meta.dictionary_page_offset)
                                   : col_meta.data_page_offset;
-          auto buffer =
-              _source->get_buffer(offset, col_meta.total_compressed_size);
-          page_data[chunks.size()] = rmm::device_buffer(buffer->data(), buffer->size(), stream);
+          page_data[chunks.size()] =
+              rmm::device_buffer(col_meta.total_compressed_size, stream, _mr);
           d_compdata = static_cast<uint8_t *>(page_data[chunks.size()].data());
+          if (_source->supports_device_read()) {
+            // Direct-to-GPU read; no host bounce buffer
+            _source->device_read(offset, col_meta.total_compressed_size,
+                                 d_compdata);
+          } else {
+            chunk_ranges.push_back(
+                {static_cast<size_t>(offset),
+                 static_cast<size_t>(col_meta.total_compressed_size)});
+            chunk_range_map.push_back(chunks.size());
+          }
         }
         chunks.insert(gpu::ColumnChunkDesc(
             col_meta.total_compressed_size, d_compdata, col_meta.num_values,
@@ -654,6 +969,33 @@ table_with_metadata reader::impl::read(int skip_rows, int num_rows, int row_grou
         // Map each column chunk to its column index
         chunk_map[chunks.size() - 1] = i;
 
+        // Pages can only be pruned on nullable columns, since skipped pages
+        // surface their rows as nulls
+        chunk_col_index.emplace_back(
+            row_group.columns[col.first].column_index_offset,
+            row_group.columns[col.first].column_index_length);
+        const statistics_filter *page_filter = nullptr;
+        if (col_schema.max_definition_level != 0) {
+          for (const auto &f : _row_group_filters) {
+            if (f.column == col.second) {
+              page_filter = &f;
+              break;
+            }
+          }
+        }
+        chunk_page_filter.push_back(page_filter);
+
+        // Identity of this chunk's dictionary page for the opt-in cache
+        _chunk_dict_keys.push_back(
+            (!_dict_cache_id.empty() && col_meta.total_compressed_size != 0)
+                ? _dict_cache_id + "@" +
+                      std::to_string(
+                          (col_meta.dictionary_page_offset != 0)
+                              ? std::min(col_meta.data_page_offset,
+                                         col_meta.dictionary_page_offset)
+                              : col_meta.data_page_offset)
+                : std::string());
+
         if (col_meta.codec != Compression::UNCOMPRESSED) {
           total_decompressed_size += col_meta.total_uncompressed_size;
         }
@@ -662,6 +1004,18 @@ table_with_metadata reader::impl::read(int skip_rows, int num_rows, int row_grou
     }
     assert(remaining_rows <= 0);
 
+    // Fetch all deferred chunk ranges; ranges within the gap threshold are
+    // merged into single larger reads of the source
+    if (!chunk_ranges.empty()) {
+      auto buffers = _source->get_buffers(chunk_ranges);
+      for (size_t k = 0; k < buffers.size(); ++k) {
+        CUDA_TRY(cudaMemcpyAsync(page_data[chunk_range_map[k]].data(),
+                                 buffers[k]->data(), buffers[k]->size(),
+                                 cudaMemcpyHostToDevice, stream));
+        host_buffers.push_back(std::move(buffers[k]));
+      }
+    }
+
     // Process dataset chunk pages into output columns
     const auto total_pages = count_page_headers(chunks, stream);
     if (total_pages > 0) {
@@ -669,6 +1023,72 @@ table_with_metadata reader::impl::read(int skip_rows, int num_rows, int row_grou
       rmm::device_buffer decomp_page_data;
 
       decode_page_headers(chunks, pages, stream);
+
+      // Honor page-level min/max statistics: mark data pages that cannot
+      // satisfy a predicate so they are neither decompressed nor decoded and
+      // surface their rows as nulls instead. Data pages appear in the page
+      // list in file order, matching the ColumnIndex entry order.
+      // The per-chunk index structures are small; fetch them all with one
+      // vectored read instead of a read per chunk
+      std::vector<datasource::byte_range> index_ranges;
+      for (size_t c = 0; c < chunks.size(); c++) {
+        if (chunk_page_filter[c] != nullptr && chunk_col_index[c].second > 0) {
+          index_ranges.push_back(
+              {static_cast<size_t>(chunk_col_index[c].first),
+               static_cast<size_t>(chunk_col_index[c].second)});
+        }
+      }
+      const auto index_buffers = _source->get_buffers(index_ranges);
+
+      for (size_t c = 0, page_count = 0, index_count = 0; c < chunks.size();
+           c++) {
+        if (chunk_page_filter[c] != nullptr && chunk_col_index[c].second > 0) {
+          const auto &buffer = index_buffers[index_count++];
+          ColumnIndex col_index;
+          CompactProtocolReader cp(buffer->data(), buffer->size());
+          if (cp.read(&col_index)) {
+            const auto &filter = *chunk_page_filter[c];
+            const auto physical =
+                static_cast<parquet::Type>(chunks[c].data_type & 0x7);
+            for (int k = 0; k < chunks[c].num_data_pages; k++) {
+              if (static_cast<size_t>(k) >= col_index.min_values.size() ||
+                  static_cast<size_t>(k) >= col_index.max_values.size()) {
+                break;
+              }
+              bool may_match = true;
+              if (static_cast<size_t>(k) < col_index.null_pages.size() &&
+                  col_index.null_pages[k]) {
+                // All-null page; nulls never satisfy a comparison
+                may_match = false;
+              } else if (filter.is_string) {
+                if (physical == parquet::BYTE_ARRAY) {
+                  const std::string min(col_index.min_values[k].begin(),
+                                        col_index.min_values[k].end());
+                  const std::string max(col_index.max_values[k].begin(),
+                                        col_index.max_values[k].end());
+                  may_match = stats_may_match(filter.comparison,
+                                              filter.string_value, min, max);
+                }
+              } else {
+                double min, max;
+                if (decode_stats_value(physical, col_index.min_values[k],
+                                       &min) &&
+                    decode_stats_value(physical, col_index.max_values[k],
+                                       &max)) {
+                  may_match = stats_may_match(filter.comparison,
+                                              filter.numeric_value, min, max);
+                }
+              }
+              if (!may_match) {
+                pages[page_count + chunks[c].num_dict_pages + k].flags |=
+                    gpu::PAGEINFO_FLAGS_SKIPPED;
+              }
+            }
+          }
+        }
+        page_count += chunks[c].max_num_pages;
+      }
+
       if (total_decompressed_size > 0) {
         decomp_page_data = decompress_page_data(chunks, pages, stream);
         // Free compressed data
@@ -695,6 +1115,12 @@ table_with_metadata reader::impl::read(int skip_rows, int num_rows, int row_grou
       decode_page_data(chunks, pages, skip_rows, num_rows, chunk_map,
                        out_buffers, stream);
 
+      // Decode is synchronized; return decompression scratch for reuse by
+      // subsequent reader invocations
+      if (decomp_page_data.size() != 0) {
+        device_scratch_pool::instance().release(std::move(decomp_page_data));
+      }
+
       for (size_t i = 0; i < column_types.size(); ++i) {
         out_columns.emplace_back(make_column(column_types[i], num_rows,
                                              out_buffers[i], stream, _mr));
@@ -724,6 +1150,14 @@ table_with_metadata reader::impl::read(int skip_rows, int num_rows, int row_grou
 reader::reader(std::string filepath, reader_options const &options,
                rmm::mr::device_memory_resource *mr)
     : _impl(std::make_unique<impl>(datasource::create(filepath), options, mr)) {
+  // Opt-in dictionary page cache; the identity includes the file mtime so
+  // entries are not reused after the file is rewritten
+  if (std::getenv("LIBCUDF_PARQUET_DICT_CACHE") != nullptr) {
+    struct stat st {};
+    if (stat(filepath.c_str(), &st) == 0) {
+      _impl->set_dict_cache_id(filepath + ":" + std::to_string(st.st_mtime));
+    }
+  }
 }
 
 // Forward to implementation
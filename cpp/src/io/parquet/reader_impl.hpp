@@ -70,6 +70,16 @@ class reader::impl {
    */
   std::string get_pandas_index() const { return _pandas_index; }
 
+  /**
+   * @brief Sets the source identity used to key the opt-in string dictionary
+   * page cache; empty disables caching for this reader.
+   *
+   * @param source_id Stable identity of the source (e.g. path + mtime)
+   */
+  void set_dict_cache_id(std::string source_id) {
+    _dict_cache_id = std::move(source_id);
+  }
+
   /**
    * @brief Read an entire set or a subset of data and returns a set of columns
    *
@@ -145,6 +155,9 @@ class reader::impl {
   std::unique_ptr<metadata> _metadata;
 
   std::vector<std::pair<int, std::string>> _selected_columns;
+  std::vector<statistics_filter> _row_group_filters;
+  std::string _dict_cache_id;
+  std::vector<std::string> _chunk_dict_keys;
   std::string _pandas_index;
   bool _strings_to_categorical = false;
   data_type _timestamp_type{type_id::EMPTY};
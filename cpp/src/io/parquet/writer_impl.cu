@@ -26,6 +26,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <future>
 #include <utility>
 
 #include <rmm/thrust_rmm_allocator.h>
@@ -426,46 +427,68 @@ void writer::impl::write_chunked(table_view const& table, pq_chunked_state& stat
     CUDF_EXPECTS(state.user_metadata_with_nullability.column_nullable.size() == static_cast<size_t>(num_columns), "When passing values in user_metadata_with_nullability, data for all columns must be specified");
   }
 
-  // first call. setup metadata. num_rows will get incremented as write_chunked is 
+  // first call. setup metadata. num_rows will get incremented as write_chunked is
   // called multiple times.
-  if(state.md.version == 0){  
+  if(state.md.version == 0){
     state.md.version = 1;
     state.md.num_rows = num_rows;
-    state.md.schema.resize(1 + num_columns);
-    state.md.schema[0].type = UNDEFINED_TYPE;
-    state.md.schema[0].repetition_type = NO_REPETITION_TYPE;
-    state.md.schema[0].name = "schema";
-    state.md.schema[0].num_children = num_columns;
-    state.md.column_order_listsize = (stats_granularity_ != statistics_freq::STATISTICS_NONE) ? num_columns : 0;
-    if(state.user_metadata != nullptr){
-      for (auto it = state.user_metadata->user_data.begin(); it != state.user_metadata->user_data.end(); it++) {
-        state.md.key_value_metadata.push_back({it->first, it->second});
-      }    
-    }
-    for (auto i = 0; i < num_columns; i++) {
-      auto& col = parquet_columns[i];
-      // Column metadata
-      state.md.schema[1 + i].type = col.physical_type();
-      state.md.schema[1 + i].converted_type = col.converted_type();
-      // because the repetition type is global (in the sense of, not per-rowgroup or per write_chunked() call) 
-      // we cannot know up front if the user is going to end up passing tables with nulls/no nulls in the 
-      // multiple write_chunked() case.  so we'll do some special handling.
-      //
-      // if the user is explictly saying "I am only calling this once", fall back to the original behavior and assume
-      // the columns in this one table tell us everything we need to know. 
-      if(state.single_write_mode){
-        state.md.schema[1 + i].repetition_type = (col.nullable() || col.data_count() < (size_t)num_rows) ? OPTIONAL : REQUIRED;
-      } 
-      // otherwise, if the user is explicitly telling us global information about all the tables that will ever get passed in
-      else if(state.user_metadata_with_nullability.column_nullable.size() > 0){        
-        state.md.schema[1 + i].repetition_type = state.user_metadata_with_nullability.column_nullable[i] ? OPTIONAL : REQUIRED;
-      } 
-      // otherwise assume the worst case.
-      else {
-        state.md.schema[1 + i].repetition_type = OPTIONAL;
+    if(state.schema_template != nullptr && !state.schema_template->schema.empty()){
+      // reuse the schema derived by an earlier identical-schema write and
+      // only verify this table against it
+      CUDF_EXPECTS(state.schema_template->schema[0].num_children == num_columns, "Mismatch in table structure between schema template and table passed to write_chunked");
+      for (auto i = 0; i < num_columns; i++) {
+        CUDF_EXPECTS(state.schema_template->schema[1 + i].type == parquet_columns[i].physical_type(), "Mismatch in column types between schema template and table passed to write_chunked");
+      }
+      state.md.schema = state.schema_template->schema;
+      state.md.column_order_listsize = state.schema_template->column_order_listsize;
+      if(state.user_metadata != nullptr){
+        for (auto it = state.user_metadata->user_data.begin(); it != state.user_metadata->user_data.end(); it++) {
+          state.md.key_value_metadata.push_back({it->first, it->second});
+        }
+      }
+    } else {
+      state.md.schema.resize(1 + num_columns);
+      state.md.schema[0].type = UNDEFINED_TYPE;
+      state.md.schema[0].repetition_type = NO_REPETITION_TYPE;
+      state.md.schema[0].name = "schema";
+      state.md.schema[0].num_children = num_columns;
+      state.md.column_order_listsize = (stats_granularity_ != statistics_freq::STATISTICS_NONE) ? num_columns : 0;
+      if(state.user_metadata != nullptr){
+        for (auto it = state.user_metadata->user_data.begin(); it != state.user_metadata->user_data.end(); it++) {
+          state.md.key_value_metadata.push_back({it->first, it->second});
+        }
+      }
+      for (auto i = 0; i < num_columns; i++) {
+        auto& col = parquet_columns[i];
+        // Column metadata
+        state.md.schema[1 + i].type = col.physical_type();
+        state.md.schema[1 + i].converted_type = col.converted_type();
+        // because the repetition type is global (in the sense of, not per-rowgroup or per write_chunked() call)
+        // we cannot know up front if the user is going to end up passing tables with nulls/no nulls in the
+        // multiple write_chunked() case.  so we'll do some special handling.
+        //
+        // if the user is explictly saying "I am only calling this once", fall back to the original behavior and assume
+        // the columns in this one table tell us everything we need to know.
+        if(state.single_write_mode){
+          state.md.schema[1 + i].repetition_type = (col.nullable() || col.data_count() < (size_t)num_rows) ? OPTIONAL : REQUIRED;
+        }
+        // otherwise, if the user is explicitly telling us global information about all the tables that will ever get passed in
+        else if(state.user_metadata_with_nullability.column_nullable.size() > 0){
+          state.md.schema[1 + i].repetition_type = state.user_metadata_with_nullability.column_nullable[i] ? OPTIONAL : REQUIRED;
+        }
+        // otherwise assume the worst case.
+        else {
+          state.md.schema[1 + i].repetition_type = OPTIONAL;
+        }
+        state.md.schema[1 + i].name = col.name();
+        state.md.schema[1 + i].num_children = 0; // Leaf node
+      }
+      // capture the derived schema so later identical-schema writes can skip
+      // rebuilding it
+      if(state.schema_template != nullptr){
+        state.schema_template->schema = state.md.schema;
+        state.schema_template->column_order_listsize = state.md.column_order_listsize;
       }
-      state.md.schema[1 + i].name = col.name();
-      state.md.schema[1 + i].num_children = 0; // Leaf node     
     }
   } else {
     // verify the user isn't passing mismatched tables
@@ -519,17 +542,33 @@ void writer::impl::write_chunked(table_view const& table, pq_chunked_state& stat
     init_page_fragments(fragments, col_desc, num_columns, num_fragments, num_rows, fragment_size, state.stream);
   }
 
-  size_t global_rowgroup_base = state.md.row_groups.size();      
-  
-  // Decide row group boundaries based on uncompressed data size
-  size_t rowgroup_size = 0;  
-  uint32_t num_rowgroups = 0;  
-  for (uint32_t f = 0, global_r = global_rowgroup_base, rowgroup_start = 0; f < num_fragments; f++) {
+  size_t global_rowgroup_base = state.md.row_groups.size();
+
+  // Decide row group boundaries based on uncompressed data size.
+  // The per-fragment sizes estimated by gpuInitPageFragments are summed first
+  // so the total can set an even byte target per row group; greedily filling
+  // against the maximum alone produces full-size groups followed by a runt
+  // final group, which schedules unevenly across downstream scans.
+  std::vector<size_t> fragment_sizes(num_fragments);
+  size_t total_data_size = 0;
+  for (uint32_t f = 0; f < num_fragments; f++) {
     size_t fragment_data_size = 0;
     for (auto i = 0; i < num_columns; i++) {
       fragment_data_size += fragments[i * num_fragments + f].fragment_data_size;
     }
-    if (f > rowgroup_start && (rowgroup_size + fragment_data_size > max_rowgroup_size_ ||
+    fragment_sizes[f] = fragment_data_size;
+    total_data_size += fragment_data_size;
+  }
+  size_t const num_rowgroups_target = std::max<size_t>(1, (total_data_size + max_rowgroup_size_ - 1) / max_rowgroup_size_);
+  size_t const rowgroup_size_target = std::max<size_t>(1, total_data_size / num_rowgroups_target);
+
+  size_t rowgroup_size = 0;
+  uint32_t num_rowgroups = 0;
+  for (uint32_t f = 0, global_r = global_rowgroup_base, rowgroup_start = 0; f < num_fragments; f++) {
+    size_t fragment_data_size = fragment_sizes[f];
+    // split at the fragment boundary closest to the byte target (or when
+    // the row-count cap is reached)
+    if (f > rowgroup_start && (rowgroup_size + (fragment_data_size / 2) >= rowgroup_size_target ||
                                (f + 1 - rowgroup_start) * fragment_size > max_rowgroup_rows_)) {
 
       // update schema
@@ -695,7 +734,9 @@ void writer::impl::write_chunked(table_view const& table, pq_chunked_state& stat
                        state.stream);
   }
 
-  auto host_bfr = [&]() {
+  // Double-buffered host staging so the D2H copy of the next chunk overlaps
+  // the sink write of the previous one, which runs on a writer task
+  auto alloc_host_bfr = [&]() {
     // if the writer supports device_write(), we don't need this scratch space
     if(out_sink_->supports_device_write()){
       return pinned_buffer<uint8_t>{nullptr, cudaFreeHost};
@@ -707,7 +748,11 @@ void writer::impl::write_chunked(table_view const& table, pq_chunked_state& stat
                                     }(max_chunk_bfr_size),
                                   cudaFreeHost};
     }
-  }();
+  };
+  pinned_buffer<uint8_t> host_bfr[2] = {alloc_host_bfr(), alloc_host_bfr()};
+  std::shared_future<void> buffer_busy[2];
+  std::shared_future<void> last_write;
+  size_t num_writes = 0;
 
   // Encode row groups in batches  
   for (uint32_t b = 0, r = 0, global_r = global_rowgroup_base; b < (uint32_t)batch_list.size(); b++) {
@@ -744,15 +789,31 @@ void writer::impl::write_chunked(table_view const& table, pq_chunked_state& stat
             CUDA_TRY(cudaStreamSynchronize(state.stream));
           }
         } else {
-          // copy the full data
-          CUDA_TRY(cudaMemcpyAsync(host_bfr.get(), dev_bfr, ck->ck_stat_size + ck->compressed_size,
+          // copy the full data into the staging buffer not currently being
+          // flushed; wait in case the sink is still writing from it
+          const auto buf = num_writes++ & 1;
+          if (buffer_busy[buf].valid()) {
+            buffer_busy[buf].wait();
+          }
+          CUDA_TRY(cudaMemcpyAsync(host_bfr[buf].get(), dev_bfr, ck->ck_stat_size + ck->compressed_size,
                                   cudaMemcpyDeviceToHost, state.stream));
           CUDA_TRY(cudaStreamSynchronize(state.stream));
-          out_sink_->host_write(host_bfr.get() + ck->ck_stat_size, ck->compressed_size);
-          if (ck->ck_stat_size != 0) {        
+          if (ck->ck_stat_size != 0) {
             state.md.row_groups[global_r].columns[i].meta_data.statistics_blob.resize(ck->ck_stat_size);
-            memcpy(state.md.row_groups[global_r].columns[i].meta_data.statistics_blob.data(), host_bfr.get(), ck->ck_stat_size);
+            memcpy(state.md.row_groups[global_r].columns[i].meta_data.statistics_blob.data(), host_bfr[buf].get(), ck->ck_stat_size);
           }
+          // flush on a writer task, chained on the previous write so chunks
+          // land in the sink in file order while the GPU encodes ahead
+          last_write = std::async(std::launch::async,
+                                  [this, data = host_bfr[buf].get() + ck->ck_stat_size,
+                                   size = static_cast<size_t>(ck->compressed_size),
+                                   prev = last_write]() {
+                                    if (prev.valid()) {
+                                      prev.wait();
+                                    }
+                                    out_sink_->host_write(data, size);
+                                  }).share();
+          buffer_busy[buf] = last_write;
         }
         state.md.row_groups[global_r].total_byte_size += ck->compressed_size;
         state.md.row_groups[global_r].columns[i].meta_data.data_page_offset = state.current_chunk_offset + ((ck->has_dictionary) ? ck->dictionary_size : 0);
@@ -763,6 +824,12 @@ void writer::impl::write_chunked(table_view const& table, pq_chunked_state& stat
       }
     }
   }
+
+  // Drain outstanding sink writes; the staging buffers go out of scope here
+  // and the footer must land after all chunk data
+  if (last_write.valid()) {
+    last_write.wait();
+  }
 }
 
 void writer::impl::write_chunked_end(pq_chunked_state &state){
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file table_statistics.cu
+ * @brief Public column statistics API built on the writer statistics kernels
+ */
+
+#include "column_stats.h"
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/statistics.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/host_vector.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+// Rows per gather chunk; one block reduces each chunk before the per-column merge
+constexpr uint32_t chunk_rows = 32768;
+
+/**
+ * @brief String descriptor expected by the statistics kernels.
+ *
+ * Must match the layout used in column_stats.cu.
+ */
+struct nvstrdesc_s {
+  const char *ptr;
+  size_t count;
+};
+
+/**
+ * @brief Converts string offsets/chars into the (ptr,length) descriptors
+ * read by the statistics kernels.
+ */
+__global__ void stringdata_to_nvstrdesc(nvstrdesc_s *dst, const size_type *offsets,
+                                        const char *strdata, const uint32_t *nulls,
+                                        size_type column_size) {
+  size_type row = blockIdx.x * blockDim.x + threadIdx.x;
+  if (row < column_size) {
+    uint32_t is_valid = (nulls) ? (nulls[row >> 5] >> (row & 0x1f)) & 1 : 1;
+    size_t count;
+    const char *ptr;
+    if (is_valid) {
+      size_type cur = offsets[row];
+      size_type next = offsets[row + 1];
+      ptr = strdata + cur;
+      count = (next > cur) ? next - cur : 0;
+    } else {
+      ptr = nullptr;
+      count = 0;
+    }
+    dst[row].ptr = ptr;
+    dst[row].count = count;
+  }
+}
+
+/**
+ * @brief Maps a column type to the statistics kernel type enum.
+ */
+io::statistics_dtype to_stats_dtype(type_id id) {
+  switch (id) {
+    case BOOL8: return io::dtype_bool8;
+    case INT8: return io::dtype_int8;
+    case INT16: return io::dtype_int16;
+    case INT32: return io::dtype_int32;
+    case INT64: return io::dtype_int64;
+    case FLOAT32: return io::dtype_float32;
+    case FLOAT64: return io::dtype_float64;
+    case TIMESTAMP_DAYS: return io::dtype_int32;
+    case TIMESTAMP_SECONDS:
+    case TIMESTAMP_MILLISECONDS:
+    case TIMESTAMP_MICROSECONDS:
+    case TIMESTAMP_NANOSECONDS: return io::dtype_timestamp64;
+    case STRING: return io::dtype_string;
+    default: CUDF_FAIL("Unsupported column type for statistics");
+  }
+}
+
+/**
+ * @brief Copies a device string referenced by chunk statistics to the host.
+ */
+std::string copy_string_value(io::string_stats const &value, cudaStream_t stream) {
+  std::string result(value.length, '\0');
+  if (value.length > 0) {
+    CUDA_TRY(cudaMemcpyAsync(&result[0], value.ptr, value.length, cudaMemcpyDeviceToHost, stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+  }
+  return result;
+}
+
+}  // namespace
+
+std::vector<column_statistics> compute_column_statistics(table_view const &input,
+                                                         cudaStream_t stream = 0) {
+  auto const num_columns = input.num_columns();
+  std::vector<column_statistics> results(num_columns);
+  if (num_columns == 0 || input.num_rows() == 0) {
+    return results;
+  }
+
+  // build the column descriptors, converting string columns into the
+  // (ptr,length) descriptors the kernels read
+  std::vector<io::stats_column_desc> h_descs(num_columns);
+  std::vector<rmm::device_buffer> string_indexes;
+  for (size_type i = 0; i < num_columns; ++i) {
+    auto const col = input.column(i);
+    auto &desc = h_descs[i];
+    desc.stats_dtype = to_stats_dtype(col.type().id());
+    desc.num_rows = col.size();
+    desc.valid_map_base = col.nullable() ? col.null_mask() : nullptr;
+    desc.ts_scale = 0;  // report timestamps in the column's own units
+    if (col.type().id() == STRING) {
+      strings_column_view view{col};
+      string_indexes.emplace_back(col.size() * sizeof(nvstrdesc_s), stream);
+      auto d_indexes = reinterpret_cast<nvstrdesc_s *>(string_indexes.back().data());
+      stringdata_to_nvstrdesc<<<((col.size() - 1) >> 8) + 1, 256, 0, stream>>>(
+          d_indexes, view.offsets().data<size_type>(), view.chars().data<char>(),
+          desc.valid_map_base, col.size());
+      desc.column_data_base = d_indexes;
+    } else {
+      desc.column_data_base = col.head<uint8_t>() + col.offset() * size_of(col.type());
+    }
+  }
+  rmm::device_vector<io::stats_column_desc> d_descs(h_descs);
+
+  // one gather group per chunk of rows, merged into one chunk per column
+  std::vector<io::statistics_group> h_groups;
+  std::vector<io::statistics_merge_group> h_merge_groups(num_columns);
+  for (size_type i = 0; i < num_columns; ++i) {
+    auto const num_rows = static_cast<uint32_t>(input.column(i).size());
+    auto const num_chunks = (num_rows + chunk_rows - 1) / chunk_rows;
+    h_merge_groups[i] = {d_descs.data().get() + i,
+                         static_cast<uint32_t>(h_groups.size()), num_chunks};
+    for (uint32_t start_row = 0; start_row < num_rows; start_row += chunk_rows) {
+      h_groups.push_back({d_descs.data().get() + i, start_row,
+                          std::min(chunk_rows, num_rows - start_row)});
+    }
+  }
+  rmm::device_vector<io::statistics_group> d_groups(h_groups);
+  rmm::device_vector<io::statistics_merge_group> d_merge_groups(h_merge_groups);
+  rmm::device_vector<io::statistics_chunk> d_chunks(h_groups.size());
+  rmm::device_vector<io::statistics_chunk> d_merged(num_columns);
+
+  CUDA_TRY(io::GatherColumnStatistics(d_chunks.data().get(), d_groups.data().get(),
+                                      static_cast<uint32_t>(h_groups.size()), stream));
+  CUDA_TRY(io::MergeColumnStatistics(d_merged.data().get(), d_chunks.data().get(),
+                                     d_merge_groups.data().get(),
+                                     static_cast<uint32_t>(num_columns), stream));
+  thrust::host_vector<io::statistics_chunk> h_merged = d_merged;
+
+  for (size_type i = 0; i < num_columns; ++i) {
+    auto const &chunk = h_merged[i];
+    auto &stats = results[i];
+    stats.non_null_count = chunk.non_nulls;
+    stats.null_count = chunk.null_count;
+    stats.has_minmax = chunk.has_minmax != 0;
+    stats.has_sum = chunk.has_sum != 0;
+    switch (h_descs[i].stats_dtype) {
+      case io::dtype_float32:
+      case io::dtype_float64:
+        if (stats.has_minmax) {
+          stats.min_value_fp = chunk.min_value.fp_val;
+          stats.max_value_fp = chunk.max_value.fp_val;
+        }
+        if (stats.has_sum) {
+          stats.sum_fp = chunk.sum.fp_val;
+        }
+        break;
+      case io::dtype_string:
+        if (stats.has_minmax) {
+          stats.min_value_string = copy_string_value(chunk.min_value.str_val, stream);
+          stats.max_value_string = copy_string_value(chunk.max_value.str_val, stream);
+        }
+        if (stats.has_sum) {
+          stats.sum = chunk.sum.i_val;
+        }
+        break;
+      default:
+        if (stats.has_minmax) {
+          stats.min_value = chunk.min_value.i_val;
+          stats.max_value = chunk.max_value.i_val;
+        }
+        if (stats.has_sum) {
+          stats.sum = chunk.sum.i_val;
+        }
+        break;
+    }
+  }
+  return results;
+}
+
+}  // namespace detail
+
+std::vector<column_statistics> compute_column_statistics(table_view const &input) {
+  CUDF_FUNC_RANGE();
+  return detail::compute_column_statistics(input);
+}
+
+}  // namespace cudf
@@ -25,6 +25,14 @@
 #include <cudf/cudf.h>
 #include <cudf/utilities/error.hpp>
 
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <vector>
+
 namespace cudf {
 namespace io {
 
@@ -135,8 +143,304 @@ class memory_mapped_source : public datasource {
   size_t map_offset_ = 0;
 };
 
+#ifdef CUDF_CUFILE
+#include <cufile.h>
+
+/**
+ * @brief Implementation class for direct-to-GPU file reads via cuFile
+ * (GPUDirect Storage).
+ *
+ * Host-side reads (headers, footers, metadata) are delegated to the memory
+ * mapped implementation; bulk column chunk reads land in device memory
+ * without a host bounce buffer.
+ **/
+class gds_source : public datasource {
+  struct cufile_wrapper {
+    int fd = -1;
+    CUfileHandle_t handle = nullptr;
+    explicit cufile_wrapper(const char *filepath) {
+      fd = open(filepath, O_RDONLY | O_DIRECT);
+      if (fd == -1) return;
+      CUfileDescr_t desc{};
+      desc.handle.fd = fd;
+      desc.type = CU_FILE_HANDLE_TYPE_OPAQUE_FD;
+      if (cuFileHandleRegister(&handle, &desc).err != CU_FILE_SUCCESS) {
+        handle = nullptr;
+      }
+    }
+    ~cufile_wrapper() {
+      if (handle != nullptr) {
+        cuFileHandleDeregister(handle);
+      }
+      if (fd != -1) {
+        close(fd);
+      }
+    }
+  };
+
+ public:
+  explicit gds_source(const char *filepath, size_t offset, size_t size)
+      : host_source_(std::make_unique<memory_mapped_source>(filepath, offset,
+                                                            size)),
+        file_(filepath) {
+    CUDF_EXPECTS(file_.handle != nullptr, "Cannot register file with cuFile");
+  }
+
+  const std::shared_ptr<arrow::Buffer> get_buffer(size_t offset,
+                                                  size_t size) override {
+    return host_source_->get_buffer(offset, size);
+  }
+
+  bool supports_device_read() const override { return true; }
+
+  size_t device_read(size_t offset, size_t size, uint8_t *dst) override {
+    auto const bytes_read =
+        cuFileRead(file_.handle, dst, size, static_cast<off_t>(offset), 0);
+    CUDF_EXPECTS(bytes_read >= 0, "cuFile read failed");
+    return static_cast<size_t>(bytes_read);
+  }
+
+  size_t size() const override { return host_source_->size(); }
+
+ private:
+  std::unique_ptr<memory_mapped_source> host_source_;
+  cufile_wrapper file_;
+};
+#endif  // CUDF_CUFILE
+
+/**
+ * @brief Implementation class that prefetches upcoming byte ranges from an
+ * underlying source on a background thread into a ring of pinned host buffers.
+ *
+ * Sequential readers (e.g. iterating over Parquet/ORC column chunks) can
+ * overlap decompression and decode kernels with file I/O: while a request is
+ * served from an already-staged buffer, the next range is read ahead. Pinned
+ * staging also allows the eventual H2D copies to run asynchronously.
+ **/
+class readahead_source : public datasource {
+  /**
+   * @brief A single pinned staging buffer; shared with returned Arrow buffers
+   * so the memory stays valid until all readers of a slot are done with it.
+   **/
+  struct pinned_slot {
+    uint8_t *data = nullptr;
+    size_t capacity = 0;
+    size_t offset = 0;  ///< Source offset of the staged bytes
+    size_t size = 0;    ///< Number of valid staged bytes
+    explicit pinned_slot(size_t cap) : capacity(cap) {
+      CUDA_TRY(cudaMallocHost(reinterpret_cast<void **>(&data), cap));
+    }
+    ~pinned_slot() {
+      if (data != nullptr) {
+        cudaFreeHost(data);
+      }
+    }
+    pinned_slot(const pinned_slot &) = delete;
+    pinned_slot &operator=(const pinned_slot &) = delete;
+  };
+
+  /**
+   * @brief Arrow buffer that keeps its backing pinned slot alive
+   **/
+  class pinned_buffer : public arrow::Buffer {
+   public:
+    pinned_buffer(std::shared_ptr<pinned_slot> slot, size_t pos, size_t len)
+        : arrow::Buffer(slot->data + pos, len), slot_(std::move(slot)) {}
+
+   private:
+    std::shared_ptr<pinned_slot> slot_;
+  };
+
+ public:
+  explicit readahead_source(std::unique_ptr<datasource> source,
+                            size_t buffer_size, size_t num_buffers)
+      : source_(std::move(source)), buffer_size_(buffer_size) {
+    CUDF_EXPECTS(buffer_size_ != 0, "Invalid read-ahead buffer size");
+    CUDF_EXPECTS(num_buffers != 0, "Invalid read-ahead buffer count");
+    worker_ = std::thread([this] { worker_loop(); });
+    // Lazily allocate pinned slots on first use up to this limit
+    max_slots_ = num_buffers;
+  }
+
+  virtual ~readahead_source() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      shutdown_ = true;
+    }
+    cv_.notify_all();
+    worker_.join();
+  }
+
+  const std::shared_ptr<arrow::Buffer> get_buffer(size_t offset,
+                                                  size_t size) override {
+    size = std::min(size, source_->size() - std::min(offset, source_->size()));
+    if (size == 0) {
+      return std::make_shared<arrow::Buffer>(nullptr, 0);
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    // Wait for any in-flight fill that could satisfy this request
+    cv_.wait(lock, [this] { return !filling_; });
+
+    auto slot = find_staged(offset, size);
+    if (slot == nullptr && size <= buffer_size_) {
+      // Miss: stage the range synchronously, then read ahead of it
+      slot = fill_slot(offset, std::min(buffer_size_, source_->size() - offset));
+    }
+    // Schedule the next sequential range while the caller consumes this one
+    const size_t next_offset = offset + size;
+    if (next_offset < source_->size() && find_staged(next_offset, 1) == nullptr) {
+      pending_offset_ = next_offset;
+      has_pending_ = true;
+      cv_.notify_all();
+    }
+
+    if (slot != nullptr) {
+      return std::make_shared<pinned_buffer>(slot, offset - slot->offset, size);
+    }
+    // Oversized request; fall through to the wrapped source
+    lock.unlock();
+    return source_->get_buffer(offset, size);
+  }
+
+  size_t size() const override { return source_->size(); }
+
+ private:
+  // Returns a slot containing [offset, offset + size), if staged
+  std::shared_ptr<pinned_slot> find_staged(size_t offset, size_t size) {
+    for (const auto &slot : slots_) {
+      if (slot->size != 0 && offset >= slot->offset &&
+          offset + size <= slot->offset + slot->size) {
+        return slot;
+      }
+    }
+    return nullptr;
+  }
+
+  // Takes a reusable slot out of the ring, or pins a fresh one; requires the
+  // caller to hold `mutex_`
+  std::shared_ptr<pinned_slot> acquire_slot() {
+    // Reuse the oldest slot no returned buffer still references, so the
+    // steady state recycles pinned memory instead of paying a
+    // device-synchronizing cudaMallocHost/cudaFreeHost pair per refill
+    for (auto it = slots_.begin(); it != slots_.end(); ++it) {
+      if (it->use_count() == 1) {
+        auto slot = std::move(*it);
+        slots_.erase(it);
+        slot->size = 0;  // contents are stale once out of the ring
+        return slot;
+      }
+    }
+    // Every slot is still held by an outstanding buffer (or none exist yet);
+    // held slots are freed when their last reader releases them
+    return std::make_shared<pinned_slot>(buffer_size_);
+  }
+
+  // Reads [offset, offset + size) from the source into `slot`; the slot must
+  // not be visible in the ring, so no lock is required
+  void stage_into(pinned_slot &slot, size_t offset, size_t size) {
+    auto const buffer = source_->get_buffer(offset, size);
+    memcpy(slot.data, buffer->data(), buffer->size());
+    slot.offset = offset;
+    slot.size = buffer->size();
+  }
+
+  // Stages [offset, offset + size) synchronously; requires the caller to
+  // hold `mutex_`
+  std::shared_ptr<pinned_slot> fill_slot(size_t offset, size_t size) {
+    auto slot = acquire_slot();
+    stage_into(*slot, offset, size);
+    slots_.push_back(slot);
+    while (slots_.size() > max_slots_) {
+      slots_.pop_front();
+    }
+    return slot;
+  }
+
+  void worker_loop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      cv_.wait(lock, [this] { return shutdown_ || has_pending_; });
+      if (shutdown_) {
+        return;
+      }
+      const auto offset = pending_offset_;
+      has_pending_ = false;
+      if (find_staged(offset, 1) == nullptr) {
+        auto slot = acquire_slot();
+        auto const size = std::min(buffer_size_, source_->size() - offset);
+        // Drop the lock for the read itself so requests that hit an
+        // already-staged slot are not serialized behind read-ahead I/O;
+        // `filling_` keeps get_buffer from missing the range in flight
+        filling_ = true;
+        lock.unlock();
+        stage_into(*slot, offset, size);
+        lock.lock();
+        slots_.push_back(std::move(slot));
+        while (slots_.size() > max_slots_) {
+          slots_.pop_front();
+        }
+        filling_ = false;
+      }
+      cv_.notify_all();
+    }
+  }
+
+ private:
+  std::unique_ptr<datasource> source_;
+  size_t buffer_size_ = 0;
+  size_t max_slots_ = 0;
+  std::deque<std::shared_ptr<pinned_slot>> slots_;
+  std::thread worker_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  size_t pending_offset_ = 0;
+  bool has_pending_ = false;
+  bool filling_ = false;
+  bool shutdown_ = false;
+};
+
+std::vector<std::shared_ptr<arrow::Buffer>> datasource::get_buffers(
+    const std::vector<byte_range> &ranges, size_t gap_threshold) {
+  // Visit the ranges in offset order, remembering their original positions
+  std::vector<size_t> order(ranges.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+    return ranges[lhs].offset < ranges[rhs].offset;
+  });
+
+  std::vector<std::shared_ptr<arrow::Buffer>> buffers(ranges.size());
+  for (size_t i = 0; i < order.size();) {
+    // Extend the read across any subsequent ranges within the gap threshold
+    const auto start = ranges[order[i]].offset;
+    auto end = start + ranges[order[i]].size;
+    auto run_end = i + 1;
+    while (run_end < order.size() &&
+           ranges[order[run_end]].offset <= end + gap_threshold) {
+      end = std::max(end, ranges[order[run_end]].offset +
+                              ranges[order[run_end]].size);
+      run_end++;
+    }
+    // One read for the whole run; slices share the merged buffer's memory
+    const auto merged = get_buffer(start, end - start);
+    for (; i < run_end; ++i) {
+      buffers[order[i]] = arrow::SliceBuffer(merged,
+                                             ranges[order[i]].offset - start,
+                                             ranges[order[i]].size);
+    }
+  }
+  return buffers;
+}
+
 std::unique_ptr<datasource> datasource::create(const std::string filepath,
                                                size_t offset, size_t size) {
+#ifdef CUDF_CUFILE
+  // Use the GPUDirect Storage path when explicitly enabled; falls back to
+  // memory mapped host reads for metadata-sized requests
+  if (std::getenv("LIBCUDF_CUFILE") != nullptr) {
+    return std::make_unique<gds_source>(filepath.c_str(), offset, size);
+  }
+#endif
   // Use our own memory mapping implementation for direct file reads
   return std::make_unique<memory_mapped_source>(filepath.c_str(), offset, size);
 }
@@ -155,5 +459,11 @@ std::unique_ptr<datasource> datasource::create(
   return std::make_unique<arrow_io_source>(file);
 }
 
+std::unique_ptr<datasource> datasource::create_readahead(
+    const std::string filepath, size_t buffer_size, size_t num_buffers) {
+  return std::make_unique<readahead_source>(datasource::create(filepath),
+                                            buffer_size, num_buffers);
+}
+
 }  // namespace io
 }  // namespace cudf
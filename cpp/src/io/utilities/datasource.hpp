@@ -21,9 +21,12 @@
 #include <arrow/io/interfaces.h>
 #include <arrow/io/memory.h>
 
+#include <cudf/utilities/error.hpp>
+
 #include <algorithm>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace cudf {
 namespace io {
@@ -58,6 +61,21 @@ class datasource {
   static std::unique_ptr<datasource> create(
       std::shared_ptr<arrow::io::RandomAccessFile> file);
 
+  /**
+   * @brief Create a read-ahead source wrapping a file path
+   *
+   * Reads are staged through a ring of pinned host buffers that are filled by
+   * a background thread, so that a reader's decompress/decode work can overlap
+   * with file I/O for sequential access patterns.
+   *
+   * @param[in] filepath Path to the file to use
+   * @param[in] buffer_size Size of each pinned staging buffer in bytes
+   * @param[in] num_buffers Number of pinned staging buffers in the ring
+   **/
+  static std::unique_ptr<datasource> create_readahead(
+      const std::string filepath, size_t buffer_size = 16 << 20,
+      size_t num_buffers = 4);
+
   /**
    * @brief Base class destructor
    **/
@@ -74,6 +92,59 @@ class datasource {
   virtual const std::shared_ptr<arrow::Buffer> get_buffer(size_t offset,
                                                           size_t size) = 0;
 
+  /**
+   * @brief A byte range within the source
+   **/
+  struct byte_range {
+    size_t offset;  ///< Bytes from the start
+    size_t size;    ///< Bytes to read
+  };
+
+  /**
+   * @brief Returns buffers for multiple subsets of data from the source
+   *
+   * Ranges separated by fewer than `gap_threshold` bytes are fetched with a
+   * single larger read and sliced apart, so that many small requests (e.g.
+   * the column chunks of a wide Parquet row group) do not each pay the
+   * per-call latency of a remote or network filesystem.
+   *
+   * @param[in] ranges Byte ranges to read; need not be sorted or disjoint
+   * @param[in] gap_threshold Maximum gap in bytes between two ranges for them
+   * to be merged into a single read
+   *
+   * @return std::vector<std::shared_ptr<arrow::Buffer>> One data buffer per
+   * requested range, in request order
+   **/
+  virtual std::vector<std::shared_ptr<arrow::Buffer>> get_buffers(
+      const std::vector<byte_range> &ranges, size_t gap_threshold = 64 << 10);
+
+  /**
+   * @brief Whether or not this source supports reading directly into device
+   * memory addresses
+   *
+   * Sources that can bypass the host bounce buffer (e.g. via GPUDirect
+   * Storage) return true here; readers then call device_read() instead of
+   * staging through get_buffer() plus a host-to-device copy.
+   *
+   * @return bool True if this source supports device_read() calls
+   **/
+  virtual bool supports_device_read() const { return false; }
+
+  /**
+   * @brief Reads a subset of data from the source directly into device memory
+   *
+   * @param[in] offset Bytes from the start
+   * @param[in] size Bytes to read
+   * @param[out] dst Device memory address to read into
+   *
+   * @return size_t The number of bytes read
+   **/
+  virtual size_t device_read(size_t offset, size_t size, uint8_t *dst) {
+    CUDF_FAIL(
+        "datasource classes that support device_read must override this "
+        "function.");
+  }
+
   /**
    * @brief Returns the size of the data in the source
    *
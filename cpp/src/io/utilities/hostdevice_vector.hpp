@@ -18,6 +18,8 @@
 
 #include <cudf/utilities/error.hpp>
 
+#include <utilities/pinned_host_pool.hpp>
+
 /**
  * @brief A helper class that wraps fixed-length device memory for the GPU, and
  * a mirror host pinned memory for the CPU.
@@ -39,14 +41,17 @@ class hostdevice_vector {
                              cudaStream_t stream = 0)
       : num_elements(initial_size), max_elements(max_size) {
     if (max_elements != 0) {
-      CUDA_TRY(cudaMallocHost(&h_data, sizeof(T) * max_elements));
+      // borrow pinned memory from the process-wide pool rather than paying a
+      // cudaMallocHost/cudaFreeHost pair per vector
+      h_data = static_cast<T *>(
+          cudf::detail::pinned_host_pool::instance().acquire(sizeof(T) * max_elements));
       RMM_ALLOC(&d_data, sizeof(T) * max_elements, stream);
     }
   }
 
   ~hostdevice_vector() {
     RMM_FREE(d_data, stream);
-    cudaFreeHost(h_data);
+    cudf::detail::pinned_host_pool::instance().release(h_data);
   }
 
   bool insert(const T &data) {
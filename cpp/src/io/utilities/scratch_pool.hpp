@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file scratch_pool.hpp
+ * @brief Process-wide size-classed pool for reusable device scratch buffers
+ */
+
+#pragma once
+
+#include <rmm/device_buffer.hpp>
+
+#include <map>
+#include <mutex>
+
+namespace cudf {
+namespace io {
+
+/**
+ * @brief Process-wide pool of device scratch buffers, size-classed to
+ * power-of-two capacities.
+ *
+ * Readers that are invoked at high frequency on small inputs pay a
+ * cudaMalloc/cudaFree pair per call for transient scratch (e.g. inflate
+ * output). Borrowing from this pool instead keeps those allocations out of
+ * the hot path: released buffers are cached up to a fixed byte budget and
+ * handed back to subsequent acquires of the same or smaller size class.
+ *
+ * Callers are responsible for stream ordering: a buffer must not be released
+ * until all work using it has been enqueued, and the enqueueing stream must
+ * be synchronized (or be the same stream) before the buffer is reused. The
+ * I/O readers satisfy this by synchronizing their stream before returning.
+ **/
+class device_scratch_pool {
+ public:
+  /**
+   * @brief Returns the process-wide pool instance
+   **/
+  static device_scratch_pool &instance() {
+    static device_scratch_pool pool;
+    return pool;
+  }
+
+  /**
+   * @brief Borrows a buffer of at least `size` bytes
+   *
+   * Reuses a cached allocation of the matching size class when available;
+   * otherwise allocates a fresh buffer rounded up to the class capacity.
+   *
+   * @param[in] size Minimum number of bytes required
+   * @param[in] stream Stream to use in case a new allocation is needed
+   *
+   * @return rmm::device_buffer The borrowed buffer
+   **/
+  rmm::device_buffer acquire(size_t size, cudaStream_t stream = 0) {
+    const auto class_size = size_class(size);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = free_buffers_.lower_bound(class_size);
+      if (it != free_buffers_.end()) {
+        auto buffer = std::move(it->second);
+        cached_bytes_ -= it->first;
+        free_buffers_.erase(it);
+        return buffer;
+      }
+    }
+    return rmm::device_buffer(class_size, stream);
+  }
+
+  /**
+   * @brief Returns a borrowed buffer to the pool for reuse
+   *
+   * Buffers beyond the pool's cached byte budget are freed instead of cached.
+   *
+   * @param[in] buffer The buffer being returned
+   **/
+  void release(rmm::device_buffer &&buffer) {
+    const auto size = buffer.size();
+    if (size == 0) return;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (cached_bytes_ + size <= max_cached_bytes) {
+      cached_bytes_ += size;
+      free_buffers_.emplace(size, std::move(buffer));
+    }
+    // else: dropped on the floor; the device_buffer destructor frees it
+  }
+
+  /**
+   * @brief Frees all cached buffers
+   **/
+  void clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_buffers_.clear();
+    cached_bytes_ = 0;
+  }
+
+ private:
+  device_scratch_pool() = default;
+
+  // Rounds up to the next power-of-two size class (min 64KB) so slightly
+  // varying request sizes still hit the same cached buffer
+  static size_t size_class(size_t size) {
+    size_t rounded = 64 * 1024;
+    while (rounded < size) {
+      rounded <<= 1;
+    }
+    return rounded;
+  }
+
+  static constexpr size_t max_cached_bytes = 256 * 1024 * 1024;
+
+  std::mutex mutex_;
+  std::multimap<size_t, rmm::device_buffer> free_buffers_;
+  size_t cached_bytes_ = 0;
+};
+
+}  // namespace io
+}  // namespace cudf
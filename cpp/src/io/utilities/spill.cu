@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file spill.cu
+ * @brief Spill and restore of tables through compressed pinned host memory
+ */
+
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/io/spill.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <io/comp/gpuinflate.h>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/host_vector.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace experimental {
+namespace io {
+
+namespace {
+
+// Bytes of packed table data compressed per Snappy chunk
+constexpr size_t spill_chunk_size = 256 * 1024;
+
+// Worst-case Snappy output size for a chunk of the given size
+constexpr size_t max_compressed_size(size_t size) {
+  return size + (size >> 3) + 64;
+}
+
+}  // namespace
+
+spilled_table spill(table_view const& table, cudaStream_t stream) {
+  CUDF_FUNC_RANGE();
+
+  // serialize the table into one device buffer and compress it in chunks
+  auto packed = experimental::detail::pack(table, rmm::mr::get_default_resource(), stream);
+  auto const uncompressed_size = packed.gpu_data->size();
+  auto const num_chunks = (uncompressed_size + spill_chunk_size - 1) / spill_chunk_size;
+  auto const d_packed = static_cast<uint8_t const*>(packed.gpu_data->data());
+
+  rmm::device_buffer comp_scratch(num_chunks * max_compressed_size(spill_chunk_size), stream);
+  auto const d_scratch = static_cast<uint8_t*>(comp_scratch.data());
+
+  thrust::host_vector<cudf::io::gpu_inflate_input_s> h_comp_in(num_chunks);
+  for (size_t c = 0; c < num_chunks; ++c) {
+    h_comp_in[c].srcDevice = d_packed + c * spill_chunk_size;
+    h_comp_in[c].srcSize = std::min(spill_chunk_size, uncompressed_size - c * spill_chunk_size);
+    h_comp_in[c].dstDevice = d_scratch + c * max_compressed_size(spill_chunk_size);
+    h_comp_in[c].dstSize = max_compressed_size(spill_chunk_size);
+  }
+  rmm::device_vector<cudf::io::gpu_inflate_input_s> d_comp_in = h_comp_in;
+  rmm::device_vector<cudf::io::gpu_inflate_status_s> d_comp_out(num_chunks);
+  if (num_chunks > 0) {
+    CUDA_TRY(cudf::io::gpu_snap(d_comp_in.data().get(), d_comp_out.data().get(),
+                                num_chunks, stream));
+  }
+  thrust::host_vector<cudf::io::gpu_inflate_status_s> h_comp_out = d_comp_out;
+
+  // keep a chunk raw whenever compression failed to shrink it
+  spilled_table blob;
+  blob.metadata = std::move(packed.metadata);
+  blob.uncompressed_size = uncompressed_size;
+  blob.chunk_sizes.resize(num_chunks);
+  blob.chunk_is_raw.resize(num_chunks);
+  size_t total_bytes = 0;
+  for (size_t c = 0; c < num_chunks; ++c) {
+    bool const is_raw =
+        (h_comp_out[c].status != 0) || (h_comp_out[c].bytes_written >= h_comp_in[c].srcSize);
+    blob.chunk_is_raw[c] = is_raw;
+    blob.chunk_sizes[c] = is_raw ? h_comp_in[c].srcSize : h_comp_out[c].bytes_written;
+    total_bytes += blob.chunk_sizes[c];
+  }
+  blob.host_data = pinned_buffer(total_bytes);
+  size_t offset = 0;
+  for (size_t c = 0; c < num_chunks; ++c) {
+    auto const src = blob.chunk_is_raw[c] ? h_comp_in[c].srcDevice : h_comp_in[c].dstDevice;
+    CUDA_TRY(cudaMemcpyAsync(blob.host_data.data() + offset, src,
+                             blob.chunk_sizes[c], cudaMemcpyDeviceToHost, stream));
+    offset += blob.chunk_sizes[c];
+  }
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  return blob;
+}
+
+contiguous_split_result restore(spilled_table const& blob,
+                                rmm::mr::device_memory_resource* mr,
+                                cudaStream_t stream) {
+  CUDF_FUNC_RANGE();
+
+  // one host-to-device copy of the compressed payload, then decompress in place
+  rmm::device_buffer comp_data(blob.host_data.size(), stream);
+  CUDA_TRY(cudaMemcpyAsync(comp_data.data(), blob.host_data.data(), blob.host_data.size(),
+                           cudaMemcpyHostToDevice, stream));
+  auto packed_data =
+      std::make_unique<rmm::device_buffer>(blob.uncompressed_size, stream, mr);
+  auto const d_comp = static_cast<uint8_t const*>(comp_data.data());
+  auto const d_packed = static_cast<uint8_t*>(packed_data->data());
+
+  auto const num_chunks = blob.chunk_sizes.size();
+  thrust::host_vector<cudf::io::gpu_inflate_input_s> h_comp_in;
+  h_comp_in.reserve(num_chunks);
+  size_t offset = 0;
+  for (size_t c = 0; c < num_chunks; ++c) {
+    auto const chunk_output_size =
+        std::min(spill_chunk_size, blob.uncompressed_size - c * spill_chunk_size);
+    if (blob.chunk_is_raw[c]) {
+      CUDA_TRY(cudaMemcpyAsync(d_packed + c * spill_chunk_size, d_comp + offset,
+                               blob.chunk_sizes[c], cudaMemcpyDeviceToDevice, stream));
+    } else {
+      h_comp_in.push_back({d_comp + offset, blob.chunk_sizes[c],
+                           d_packed + c * spill_chunk_size, chunk_output_size});
+    }
+    offset += blob.chunk_sizes[c];
+  }
+  if (!h_comp_in.empty()) {
+    rmm::device_vector<cudf::io::gpu_inflate_input_s> d_comp_in = h_comp_in;
+    rmm::device_vector<cudf::io::gpu_inflate_status_s> d_comp_out(h_comp_in.size());
+    CUDA_TRY(cudf::io::gpu_unsnap(d_comp_in.data().get(), d_comp_out.data().get(),
+                                  h_comp_in.size(), stream));
+    thrust::host_vector<cudf::io::gpu_inflate_status_s> h_comp_out = d_comp_out;
+    for (auto const& status : h_comp_out) {
+      CUDF_EXPECTS(status.status == 0, "Corrupt spilled table data");
+    }
+  }
+
+  auto const view = experimental::detail::unpack(blob.metadata.data(), d_packed);
+  return contiguous_split_result{view, std::move(packed_data)};
+}
+
+}  // namespace io
+}  // namespace experimental
+}  // namespace cudf
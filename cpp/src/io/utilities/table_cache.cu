@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file table_cache.cu
+ * @brief Compressed pinned-host cache of decoded tables
+ */
+
+#include <cudf/io/spill.hpp>
+#include <cudf/io/table_cache.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace cudf {
+namespace experimental {
+namespace io {
+
+struct table_cache::impl {
+  struct entry {
+    spilled_table data;            ///< compressed host blob from spill()
+    table_metadata user_metadata;  ///< metadata returned alongside the table
+    std::list<std::string>::iterator lru_pos;
+  };
+
+  mutable std::mutex mutex;
+  std::unordered_map<std::string, entry> entries;
+  std::list<std::string> lru;  // most recently used first
+  size_t capacity_bytes = 0;   // 0 means unlimited
+  size_t current_bytes = 0;
+  bool is_enabled = false;
+
+  // callers must hold the mutex
+  void remove_entry(std::unordered_map<std::string, entry>::iterator it) {
+    current_bytes -= it->second.data.size_bytes();
+    lru.erase(it->second.lru_pos);
+    entries.erase(it);
+  }
+};
+
+table_cache& table_cache::instance() {
+  static table_cache cache;
+  return cache;
+}
+
+table_cache::table_cache() : _impl{std::make_unique<impl>()} {}
+table_cache::~table_cache() = default;
+
+void table_cache::enable(size_t capacity_bytes) {
+  std::lock_guard<std::mutex> lock(_impl->mutex);
+  _impl->is_enabled = true;
+  _impl->capacity_bytes = capacity_bytes;
+}
+
+void table_cache::disable() {
+  std::lock_guard<std::mutex> lock(_impl->mutex);
+  _impl->is_enabled = false;
+  _impl->entries.clear();
+  _impl->lru.clear();
+  _impl->current_bytes = 0;
+}
+
+bool table_cache::enabled() const {
+  std::lock_guard<std::mutex> lock(_impl->mutex);
+  return _impl->is_enabled;
+}
+
+void table_cache::insert(std::string const& key, table_view const& table,
+                         table_metadata const& metadata, cudaStream_t stream) {
+  impl::entry new_entry;
+  new_entry.data = spill(table, stream);
+  new_entry.user_metadata = metadata;
+  auto const total_bytes = new_entry.data.size_bytes();
+
+  std::lock_guard<std::mutex> lock(_impl->mutex);
+  if (!_impl->is_enabled) {
+    return;
+  }
+  if (_impl->capacity_bytes != 0 && total_bytes > _impl->capacity_bytes) {
+    return;  // larger than the whole cache
+  }
+  auto it = _impl->entries.find(key);
+  if (it != _impl->entries.end()) {
+    _impl->remove_entry(it);
+  }
+  while (_impl->capacity_bytes != 0 &&
+         _impl->current_bytes + total_bytes > _impl->capacity_bytes) {
+    _impl->remove_entry(_impl->entries.find(_impl->lru.back()));
+  }
+  _impl->lru.push_front(key);
+  new_entry.lru_pos = _impl->lru.begin();
+  _impl->current_bytes += total_bytes;
+  _impl->entries.emplace(key, std::move(new_entry));
+}
+
+table_with_metadata table_cache::get(std::string const& key,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream) {
+  std::lock_guard<std::mutex> lock(_impl->mutex);
+  auto it = _impl->entries.find(key);
+  if (it == _impl->entries.end()) {
+    return table_with_metadata{};
+  }
+  auto& cached = it->second;
+  _impl->lru.splice(_impl->lru.begin(), _impl->lru, cached.lru_pos);
+
+  auto restored = restore(cached.data, mr, stream);
+  table_with_metadata result;
+  result.tbl = std::make_unique<experimental::table>(restored.table, stream, mr);
+  result.metadata = cached.user_metadata;
+  return result;
+}
+
+bool table_cache::contains(std::string const& key) const {
+  std::lock_guard<std::mutex> lock(_impl->mutex);
+  return _impl->entries.count(key) != 0;
+}
+
+void table_cache::erase(std::string const& key) {
+  std::lock_guard<std::mutex> lock(_impl->mutex);
+  auto it = _impl->entries.find(key);
+  if (it != _impl->entries.end()) {
+    _impl->remove_entry(it);
+  }
+}
+
+void table_cache::clear() {
+  std::lock_guard<std::mutex> lock(_impl->mutex);
+  _impl->entries.clear();
+  _impl->lru.clear();
+  _impl->current_bytes = 0;
+}
+
+size_t table_cache::size_bytes() const {
+  std::lock_guard<std::mutex> lock(_impl->mutex);
+  return _impl->current_bytes;
+}
+
+}  // namespace io
+}  // namespace experimental
+}  // namespace cudf
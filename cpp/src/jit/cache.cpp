@@ -62,7 +62,56 @@ boost::filesystem::path getCacheDir() {
 
 cudfJitCache::cudfJitCache() { }
 
-cudfJitCache::~cudfJitCache() { }
+cudfJitCache::~cudfJitCache() {
+    if (_preload_thread.joinable()) { _preload_thread.join(); }
+}
+
+void cudfJitCache::preloadFileCache()
+{
+#if defined(JITIFY_USE_CACHE)
+    boost::filesystem::path cache_dir = getCacheDir();
+    for (auto&& entry : boost::filesystem::directory_iterator(cache_dir)) {
+        if (not boost::filesystem::is_regular_file(entry.status())) continue;
+
+        std::string name = entry.path().filename().string();
+        cacheFile file{entry.path().string()};
+        std::string serialized = file.read();
+        if (not file.is_read_successful()) continue;
+
+        // Kernel instantiation cache entries embed a '.' between the program
+        // name and the kernel name (see getKernelInstantiation()); program
+        // entries do not
+        try {
+            if (name.find('.') != std::string::npos) {
+                std::lock_guard<std::mutex> lock(_kernel_cache_mutex);
+                if (kernel_inst_map.count(name) == 0) {
+                    kernel_inst_map[name] =
+                        std::make_shared<jitify::experimental::KernelInstantiation>(
+                            jitify::experimental::KernelInstantiation::deserialize(serialized));
+                }
+            } else {
+                std::lock_guard<std::mutex> lock(_program_cache_mutex);
+                if (program_map.count(name) == 0) {
+                    program_map[name] =
+                        std::make_shared<jitify::experimental::Program>(
+                            jitify::experimental::Program::deserialize(serialized));
+                }
+            }
+        } catch (...) {
+            // A stale or corrupt cache entry is not fatal; the kernel will be
+            // recompiled on first use as before
+        }
+    }
+#endif
+}
+
+void cudfJitCache::preloadFileCacheAsync()
+{
+    std::lock_guard<std::mutex> lock(_preload_mutex);
+    if (not _preload_thread.joinable()) {
+        _preload_thread = std::thread{[this](){ preloadFileCache(); }};
+    }
+}
 
 std::mutex cudfJitCache::_kernel_cache_mutex;
 std::mutex cudfJitCache::_program_cache_mutex;
@@ -23,6 +23,7 @@
 #include <string>
 #include <memory>
 #include <mutex>
+#include <thread>
 #include <boost/filesystem.hpp>
 
 namespace cudf {
@@ -95,12 +96,33 @@ public:
      * @return named_prog<jitify::experimental::Program> 
      *---------------------------------------------------------------------------**/
     named_prog<jitify::experimental::Program> getProgram(
-        std::string const& prog_file_name, 
+        std::string const& prog_file_name,
         std::string const& cuda_source = "",
         std::vector<std::string> const& given_headers = {},
         std::vector<std::string> const& given_options = {},
         jitify::experimental::file_callback_type file_callback = nullptr);
 
+    /**---------------------------------------------------------------------------*
+     * @brief Load and deserialize every entry of the file cache into the
+     * in-memory cache
+     *
+     * Subsequent `getProgram()`/`getKernelInstantiation()` calls hit the
+     * in-memory maps directly instead of paying a deserialization (or, for a
+     * cold file cache entry, an NVRTC compilation) on first use. Entries that
+     * fail to read or deserialize are skipped; they will be recompiled on
+     * first use as before.
+     *---------------------------------------------------------------------------**/
+    void preloadFileCache();
+
+    /**---------------------------------------------------------------------------*
+     * @brief Run `preloadFileCache()` on a background thread
+     *
+     * Intended to be called once at process startup; repeat calls while a
+     * preload is already running are no-ops. The thread is joined in the
+     * cache destructor.
+     *---------------------------------------------------------------------------**/
+    void preloadFileCacheAsync();
+
 private:
     template <typename Tv>
     using umap_str_shptr = std::unordered_map<std::string, std::shared_ptr<Tv>>;
@@ -119,6 +141,9 @@ private:
     static std::mutex _kernel_cache_mutex;
     static std::mutex _program_cache_mutex;
 
+    std::mutex _preload_mutex;
+    std::thread _preload_thread;
+
 private:
     /**---------------------------------------------------------------------------*
      * @brief Class to allow process wise exclusive access to cache files
@@ -22,6 +22,7 @@
 
 #include <jit/cache.h>
 #include <cudf/types.h>
+#include <cudf/utilities/profiler.hpp>
 #include <jitify.hpp>
 #include <unordered_map>
 #include <string>
@@ -98,9 +99,25 @@ class launcher {
    */
   template <typename ... Args>
   void launch(Args ... args){
+    profiler::launch_timer timer(std::get<0>(kernel_inst), stream);
     get_kernel().configure_1d_max_occupancy(0, 0, 0, stream).launch(args...);
   }
 
+  /**
+   * @brief Launch the kernel with a runtime-sized argument list
+   *
+   * Used when the number of kernel arguments is only known at runtime, e.g.
+   * kernels instantiated over a caller-chosen number of input columns. Each
+   * entry of @p arg_ptrs points to the corresponding kernel argument, as with
+   * `cuLaunchKernel`.
+   *
+   * @param arg_ptrs Pointers to each argument to pass to the kernel
+   */
+  void launch(std::vector<void*> const& arg_ptrs){
+    profiler::launch_timer timer(std::get<0>(kernel_inst), stream);
+    get_kernel().configure_1d_max_occupancy(0, 0, 0, stream).launch(arg_ptrs);
+  }
+
  private:
   cudf::jit::cudfJitCache& cache_instance;
   cudf::jit::named_prog<jitify::experimental::Program> program;
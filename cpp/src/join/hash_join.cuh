@@ -22,24 +22,40 @@
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/detail/utilities/cuda.cuh>
 
+#include <cudf/detail/gather.cuh>
+#include <cudf/join.hpp>
+
 #include <join/join_common_utils.hpp>
 #include <join/join_kernels.cuh>
 
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
+#include <thrust/transform.h>
+
+#include <cstdlib>
+#include <functional>
+
 namespace cudf {
 
 namespace experimental {
 
 namespace detail {
 
+// Minimum number of probe table rows for which the Bloom-filter pre-pass over
+// the probe table is attempted. Below this the filter cannot amortize its cost.
+constexpr size_type BLOOM_FILTER_MIN_PROBE_ROWS{1 << 16};
+
 /* --------------------------------------------------------------------------*/
 /**
  * @brief  Gives an estimate of the size of the join output produced when
  * joining two tables together.
  *
- * If the two tables are of relatively equal size, then the returned output
- * size will be the exact output size. However, if the probe table is
- * significantly larger than the build table, then we attempt to estimate the
- * output size by using only a subset of the rows in the probe table.
+ * For small probe tables the returned output size is the exact output size.
+ * Larger probe tables are sampled: only a subset of the probe rows is
+ * counted and the result is scaled up with a safety margin. An underestimate
+ * only costs a reallocation and re-probe in `probe_join_hash_table`, which
+ * is cheaper than unconditionally counting every probe row here just to
+ * probe them all a second time when materializing.
  *
  * @throws cudf::logic_error if JoinKind is not INNER_JOIN or LEFT_JOIN
  *
@@ -47,17 +63,21 @@ namespace detail {
  * @param probe_table The left hand table
  * @param hash_table A hash table built on the build table that maps the index
  * of every row to the hash value of that row.
+ * @param check_row_equality Functor that checks whether a probe row and a
+ * build row with equal hash values are a true match
  *
  * @returns An estimate of the size of the output of the join operation
  */
 /* ----------------------------------------------------------------------------*/
 template <join_kind JoinKind,
-          typename multimap_type>
+          typename multimap_type,
+          typename row_comparator>
 size_type
 estimate_join_output_size(
     table_device_view build_table,
     table_device_view probe_table,
     multimap_type const& hash_table,
+    row_comparator check_row_equality,
     cudaStream_t stream) {
 
   const size_type build_table_num_rows{build_table.num_rows()};
@@ -96,6 +116,13 @@ estimate_join_output_size(
     sample_probe_num_rows = build_table_num_rows;
   }
 
+  // Never count more than this many probe rows in a single estimation pass.
+  // Beyond this point the counting pass costs as much as the materialization
+  // probe itself, and a scaled sample estimate is accurate enough that the
+  // overflow retry in `probe_join_hash_table` is rarely taken
+  constexpr size_type MAX_SAMPLE_PROBE_ROWS{1 << 20};
+  sample_probe_num_rows = std::min(sample_probe_num_rows, MAX_SAMPLE_PROBE_ROWS);
+
   // Allocate storage for the counter used to get the size of the join output
   size_type h_size_estimate{0};
   rmm::device_scalar<size_type> size_estimate(0, stream);
@@ -106,7 +133,8 @@ estimate_join_output_size(
   int numBlocks {-1};
 
   CUDA_TRY(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
-    &numBlocks, compute_join_output_size<JoinKind, multimap_type, block_size>,
+    &numBlocks,
+    compute_join_output_size<JoinKind, multimap_type, block_size, row_comparator>,
     block_size, 0
   ));
 
@@ -126,29 +154,40 @@ estimate_join_output_size(
     size_estimate.set_value(0);
 
     row_hash hash_probe{probe_table};
-    row_equality equality{probe_table, build_table};
     // Probe the hash table without actually building the output to simply
     // find what the size of the output will be.
     compute_join_output_size<JoinKind,
                              multimap_type,
-                             block_size>
+                             block_size,
+                             row_comparator>
     <<<numBlocks * num_sms, block_size, 0, stream>>>(
         hash_table,
         build_table,
         probe_table,
         hash_probe,
-        equality,
+        check_row_equality,
         sample_probe_num_rows,
         size_estimate.data());
     CHECK_CUDA(stream);
 
-    // Only in case subset of probe table is chosen,
-    // increase the estimated output size by a factor of the ratio between the
-    // probe and build tables
+    // Only in case a subset of the probe table was counted, scale the
+    // estimate by the fraction of probe rows that were sampled and pad it so
+    // that small sampling errors do not force the materialization pass to
+    // reallocate and probe again
     if(sample_probe_num_rows < probe_table_num_rows) {
-      h_size_estimate = size_estimate.value() * probe_to_build_ratio;
+      const double sample_ratio =
+        static_cast<double>(probe_table_num_rows)/sample_probe_num_rows;
+      const double scaled_estimate =
+        size_estimate.value(stream) * sample_ratio * 1.25;
+      h_size_estimate = static_cast<size_type>(
+        std::min(static_cast<double>(MAX_JOIN_SIZE), scaled_estimate));
     } else {
-      h_size_estimate = size_estimate.value();
+      h_size_estimate = size_estimate.value(stream);
+    }
+
+    // Left joins emit at least one output row per probe row
+    if(JoinKind == join_kind::LEFT_JOIN) {
+      h_size_estimate = std::max(h_size_estimate, probe_table_num_rows);
     }
 
     // If the size estimate is non-zero, then we have a valid estimate and can break
@@ -160,13 +199,11 @@ estimate_join_output_size(
       break;
     }
 
-    // If the size estimate is zero, then double the number of sampled rows in the probe
-    // table. Reduce the ratio of the number of probe rows sampled to the number of rows
-    // in the build table by the same factor
+    // If the size estimate is zero, then double the number of sampled rows
+    // in the probe table
     if(0 == h_size_estimate) {
       constexpr size_type GROW_RATIO{2};
       sample_probe_num_rows *= GROW_RATIO;
-      probe_to_build_ratio = static_cast<size_type>(std::ceil(static_cast<float>(probe_to_build_ratio)/GROW_RATIO));
     }
 
   } while(true);
@@ -209,59 +246,63 @@ get_trivial_left_join_indices(table_view const& left, cudaStream_t stream) {
 
 /* --------------------------------------------------------------------------*/
 /**
- * @brief  Computes the join operation between two tables and returns the
- * output indices of left and right table as a combined table
+ * @brief  Returns the hash table occupancy percentage used when sizing join
+ * hash tables
  *
- * @param left  Table of left columns to join
- * @param right Table of right  columns to join
- * @param flip_join_indices Flag that indicates whether the left and right
- * tables have been flipped, meaning the output indices should also be flipped.
+ * Defaults to `DEFAULT_HASH_TABLE_OCCUPANCY`; can be overridden with the
+ * `LIBCUDF_HASH_JOIN_OCCUPANCY` environment variable (a percentage in
+ * (0, 100]). Lower occupancies trade memory for shorter probe chains, which
+ * matters for skewed key distributions.
+ *
+ * @returns The occupancy percentage to size join hash tables with
+ */
+/* ----------------------------------------------------------------------------*/
+inline uint32_t hash_join_occupancy() {
+  static const uint32_t occupancy = [] {
+    const char *env = std::getenv("LIBCUDF_HASH_JOIN_OCCUPANCY");
+    if (env != nullptr) {
+      const long value = std::strtol(env, nullptr, 10);
+      if (value > 0 && value <= 100) { return static_cast<uint32_t>(value); }
+    }
+    return static_cast<uint32_t>(DEFAULT_HASH_TABLE_OCCUPANCY);
+  }();
+  return occupancy;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Builds the hash table over the rows of the build table for use by
+ * the hash join probe kernels
+ *
+ * @param build_table Table of build columns to hash
+ * @param mr Memory resource used to allocate the hash table's storage
  * @param stream stream on which all memory allocations and copies
  * will be performed
- * @tparam join_kind The type of join to be performed
  *
- * @returns Join output indices vector pair
+ * @returns Multimap mapping row hash values to row indices of the build table
  */
 /* ----------------------------------------------------------------------------*/
-template <join_kind JoinKind>
-std::enable_if_t<(JoinKind != join_kind::FULL_JOIN),
-std::pair<rmm::device_vector<size_type>,
-rmm::device_vector<size_type>>>
-get_base_hash_join_indices(
-    table_view const& left,
-    table_view const& right,
-    bool flip_join_indices,
+inline
+std::unique_ptr<multimap_type, std::function<void(multimap_type*)>>
+build_join_hash_table(
+    table_device_view build_table,
+    rmm::mr::device_memory_resource* mr,
     cudaStream_t stream) {
 
-  // The `right` table is always used for building the hash map. We want to build the hash map
-  // on the smaller table. Thus, if `left` is smaller than `right`, swap `left/right`.
-  if ((JoinKind == join_kind::INNER_JOIN) && (right.num_rows() > left.num_rows())) {
-    return get_base_hash_join_indices<JoinKind>(right, left, true, stream);
-  }
-  //Trivial left join case - exit early
-  if ((JoinKind == join_kind::LEFT_JOIN) && (right.num_rows() == 0)) {
-    return get_trivial_left_join_indices(left, stream);
-  }
-
-  auto build_table = table_device_view::create(right, stream);
-  const size_type build_table_num_rows{build_table->num_rows()};
-
-  // Probe with the left table
-  auto probe_table = table_device_view::create(left, stream);
-
-  size_t const hash_table_size = compute_hash_table_size(build_table_num_rows);
+  const size_type build_table_num_rows{build_table.num_rows()};
+  size_t const hash_table_size =
+      compute_hash_table_size(build_table_num_rows, hash_join_occupancy());
 
   auto hash_table = multimap_type::create(
       hash_table_size, true,
       multimap_type::hasher(),
       multimap_type::key_equal(),
-      multimap_type::allocator_type(),
+      multimap_type::allocator_type(mr),
       stream
       );
 
-  // build the hash table
   if (build_table_num_rows > 0) {
-    row_hash hash_build{*build_table};
+    row_hash hash_build{build_table};
     rmm::device_scalar<int> failure(0, stream);
     constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
     experimental::detail::grid_1d config(build_table_num_rows, block_size);
@@ -271,12 +312,117 @@ get_base_hash_join_indices(
         build_table_num_rows,
         failure.data());
     // Check error code from the kernel
-    if (failure.value() == 1) { CUDF_FAIL("Hash Table insert failure."); }
+    if (failure.value(stream) == 1) { CUDF_FAIL("Hash Table insert failure."); }
+  }
+
+  return hash_table;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Computes the indices of the probe table rows whose hash value may
+ * also be present in the build table, using a Bloom filter built over the
+ * build table row hashes
+ *
+ * The filter is sized at roughly eight bits per build table row and tests two
+ * bits per row, both derived from the same hash value the multimap uses as its
+ * key, so a row that would find a matching hash bucket always passes. False
+ * positives only cost a redundant hash table probe later; no matches are lost.
+ *
+ * @param build_table Table of build columns the hash table was created from
+ * @param probe_table Table of probe columns to join
+ * @param stream stream on which all memory allocations and copies
+ * will be performed
+ *
+ * @returns Indices of the probe table rows that pass the filter, in ascending
+ * order
+ */
+/* ----------------------------------------------------------------------------*/
+inline
+rmm::device_vector<size_type>
+bloom_filter_probe_rows(
+    table_device_view build_table,
+    table_device_view probe_table,
+    cudaStream_t stream) {
+
+  const size_type build_table_num_rows{build_table.num_rows()};
+  const size_type probe_table_num_rows{probe_table.num_rows()};
+
+  // ~8 bits per build row, rounded up to a power of two for cheap masking
+  size_t num_bits{1024};
+  while (num_bits < static_cast<size_t>(build_table_num_rows) * 8) {
+    num_bits <<= 1;
   }
+  const uint32_t bit_mask = static_cast<uint32_t>(num_bits - 1);
+
+  rmm::device_vector<uint32_t> bloom_filter(num_bits / 32, 0);
+  uint32_t *d_words = bloom_filter.data().get();
+
+  row_hash hash_build{build_table};
+  thrust::for_each_n(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator<size_type>(0), build_table_num_rows,
+      [d_words, bit_mask, hash_build] __device__ (size_type row_index) {
+        const hash_value_type hash_value = hash_build(row_index);
+        const uint32_t bit1 = hash_value & bit_mask;
+        const uint32_t bit2 = ((hash_value >> 15) ^ (hash_value * 0x9e3779b9u)) & bit_mask;
+        atomicOr(&d_words[bit1 >> 5], 1u << (bit1 & 0x1f));
+        atomicOr(&d_words[bit2 >> 5], 1u << (bit2 & 0x1f));
+      });
+
+  rmm::device_vector<size_type> passing_rows(probe_table_num_rows);
+  row_hash hash_probe{probe_table};
+  auto passing_end = thrust::copy_if(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(probe_table_num_rows),
+      passing_rows.begin(),
+      [d_words, bit_mask, hash_probe] __device__ (size_type row_index) {
+        const hash_value_type hash_value = hash_probe(row_index);
+        const uint32_t bit1 = hash_value & bit_mask;
+        const uint32_t bit2 = ((hash_value >> 15) ^ (hash_value * 0x9e3779b9u)) & bit_mask;
+        return ((d_words[bit1 >> 5] >> (bit1 & 0x1f)) &
+                (d_words[bit2 >> 5] >> (bit2 & 0x1f)) & 1u) != 0;
+      });
+  passing_rows.resize(passing_end - passing_rows.begin());
+
+  return passing_rows;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Probes a prebuilt hash table with the rows of the probe table and
+ * returns the output indices of probe and build table as a combined table
+ *
+ * @param build_table Table of build columns the hash table was created from
+ * @param probe_table Table of probe columns to join
+ * @param hash_table Hash table built over the rows of `build_table`
+ * @param check_row_equality Functor that checks whether a probe row and a
+ * build row with equal hash values are a true match
+ * @param flip_join_indices Flag that indicates whether the probe and build
+ * tables have been flipped, meaning the output indices should also be flipped.
+ * @param stream stream on which all memory allocations and copies
+ * will be performed
+ * @tparam join_kind The type of join to be performed
+ *
+ * @returns Join output indices vector pair
+ */
+/* ----------------------------------------------------------------------------*/
+template <join_kind JoinKind,
+          typename row_comparator>
+std::pair<rmm::device_vector<size_type>,
+rmm::device_vector<size_type>>
+probe_join_hash_table(
+    table_device_view build_table,
+    table_device_view probe_table,
+    multimap_type const& hash_table,
+    row_comparator check_row_equality,
+    bool flip_join_indices,
+    cudaStream_t stream) {
 
   size_type estimated_size =
     estimate_join_output_size<JoinKind, multimap_type>(
-        *build_table, *probe_table, *hash_table, stream);
+        build_table, probe_table, hash_table, check_row_equality, stream);
 
   // If the estimated output size is zero, return immediately
   if (estimated_size == 0) {
@@ -298,23 +444,22 @@ get_base_hash_join_indices(
     right_indices.resize(estimated_size);
 
     constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
-    experimental::detail::grid_1d config(probe_table->num_rows(), block_size);
+    experimental::detail::grid_1d config(probe_table.num_rows(), block_size);
     write_index.set_value(0);
 
-    row_hash hash_probe{*probe_table};
-    row_equality equality{*probe_table, *build_table};
+    row_hash hash_probe{probe_table};
     probe_hash_table<JoinKind,
                      multimap_type,
                      hash_value_type,
                      block_size,
                      DEFAULT_JOIN_CACHE_SIZE>
     <<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
-        *hash_table,
-        *build_table,
-        *probe_table,
+        hash_table,
+        build_table,
+        probe_table,
         hash_probe,
-        equality,
-        probe_table->num_rows(),
+        check_row_equality,
+        probe_table.num_rows(),
         left_indices.data().get(),
         right_indices.data().get(),
         write_index.data(),
@@ -323,7 +468,7 @@ get_base_hash_join_indices(
 
     CHECK_CUDA(stream);
 
-    join_size = write_index.value();
+    join_size = write_index.value(stream);
     current_estimated_size = estimated_size;
     estimated_size *= 2;
   } while ((current_estimated_size < join_size)) ;
@@ -331,7 +476,223 @@ get_base_hash_join_indices(
   left_indices.resize(join_size);
   right_indices.resize(join_size);
   return std::make_pair(std::move(left_indices), std::move(right_indices));
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Computes the join operation between two tables and returns the
+ * output indices of left and right table as a combined table
+ *
+ * @param left  Table of left columns to join
+ * @param right Table of right  columns to join
+ * @param flip_join_indices Flag that indicates whether the left and right
+ * tables have been flipped, meaning the output indices should also be flipped.
+ * @param stream stream on which all memory allocations and copies
+ * will be performed
+ * @tparam join_kind The type of join to be performed
+ *
+ * @returns Join output indices vector pair
+ */
+/* ----------------------------------------------------------------------------*/
+template <join_kind JoinKind>
+std::enable_if_t<(JoinKind != join_kind::FULL_JOIN),
+std::pair<rmm::device_vector<size_type>,
+rmm::device_vector<size_type>>>
+get_base_hash_join_indices(
+    table_view const& left,
+    table_view const& right,
+    bool flip_join_indices,
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream) {
+
+  // The `right` table is always used for building the hash map. We want to build the hash map
+  // on the smaller table. Thus, if `left` is smaller than `right`, swap `left/right`.
+  if ((JoinKind == join_kind::INNER_JOIN) && (right.num_rows() > left.num_rows())) {
+    return get_base_hash_join_indices<JoinKind>(right, left, true, mr, stream);
+  }
+  //Trivial left join case - exit early
+  if ((JoinKind == join_kind::LEFT_JOIN) && (right.num_rows() == 0)) {
+    return get_trivial_left_join_indices(left, stream);
+  }
+
+  auto build_table = table_device_view::create(right, stream);
+
+  // Probe with the left table
+  auto probe_table = table_device_view::create(left, stream);
+
+  auto hash_table = build_join_hash_table(*build_table, mr, stream);
+
+  // For large inner join probes, run a Bloom-filter pre-pass over the probe
+  // table and only probe the hash table with the rows that pass. Highly
+  // selective joins probe with a fraction of the rows, which also shrinks the
+  // output size estimation pass. Left joins are excluded since filtered-out
+  // rows would still need to be emitted with a null match.
+  if ((JoinKind == join_kind::INNER_JOIN) && (right.num_rows() > 0) &&
+      (left.num_rows() >= BLOOM_FILTER_MIN_PROBE_ROWS)) {
+    auto passing_rows = bloom_filter_probe_rows(*build_table, *probe_table, stream);
+
+    // Only probe with the compacted rows when the filter removes most of
+    // them; otherwise gathering the probe columns costs more than it saves
+    if (passing_rows.size() * 2 < static_cast<size_t>(left.num_rows())) {
+      auto compacted = experimental::detail::gather(
+          left, passing_rows.begin(), passing_rows.end(), false,
+          mr, stream);
+      auto compacted_table = table_device_view::create(compacted->view(), stream);
+
+      row_equality compacted_equality{*compacted_table, *build_table};
+      auto joined_indices = probe_join_hash_table<JoinKind>(
+          *build_table, *compacted_table, *hash_table, compacted_equality,
+          flip_join_indices, stream);
+
+      // Map the compacted probe row indices back to the original rows
+      auto &probe_output = flip_join_indices ? joined_indices.second
+                                             : joined_indices.first;
+      size_type const *d_passing_rows = passing_rows.data().get();
+      thrust::transform(
+          rmm::exec_policy(stream)->on(stream),
+          probe_output.begin(), probe_output.end(), probe_output.begin(),
+          [d_passing_rows] __device__ (size_type row_index) {
+            return d_passing_rows[row_index];
+          });
+      return joined_indices;
+    }
+  }
+
+  row_equality equality{*probe_table, *build_table};
+  return probe_join_hash_table<JoinKind>(
+      *build_table, *probe_table, *hash_table, equality, flip_join_indices,
+      stream);
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Row comparison functor that checks the equality of the key columns
+ * and then evaluates a set of residual relational conditions over arbitrary
+ * columns of the two tables, so non-equi predicates can be applied inside the
+ * probe kernels instead of filtering a materialized cross product
+ *
+ * A null on either side of a condition never satisfies it, matching SQL
+ * semantics for relational predicates.
+ */
+/* ----------------------------------------------------------------------------*/
+class row_conditional_comparator {
+ public:
+  /**
+   * @param check_row_equality Equality comparator over the key columns
+   * @param probe_table Device view of all columns of the probe side table
+   * @param build_table Device view of all columns of the build side table
+   * @param conditions Device array of residual conditions to evaluate
+   * @param num_conditions The number of residual conditions
+   */
+  row_conditional_comparator(row_equality check_row_equality,
+                             table_device_view probe_table,
+                             table_device_view build_table,
+                             join_condition const* conditions,
+                             size_type num_conditions)
+      : _check_row_equality{check_row_equality},
+        _probe_table{probe_table},
+        _build_table{build_table},
+        _conditions{conditions},
+        _num_conditions{num_conditions} {}
+
+  __device__ bool operator()(size_type probe_row_index,
+                             size_type build_row_index) const {
+    if (not _check_row_equality(probe_row_index, build_row_index)) {
+      return false;
+    }
+    for (size_type i = 0; i < _num_conditions; ++i) {
+      auto const probe_col = _probe_table.column(_conditions[i].left_column);
+      auto const build_col = _build_table.column(_conditions[i].right_column);
+      if ((probe_col.nullable() and probe_col.is_null(probe_row_index)) or
+          (build_col.nullable() and build_col.is_null(build_row_index))) {
+        return false;
+      }
+      element_relational_comparator<true> comparator{
+          probe_col, build_col, null_order::BEFORE};
+      const weak_ordering state = cudf::experimental::type_dispatcher(
+          probe_col.type(), comparator, probe_row_index, build_row_index);
+      bool satisfied = false;
+      switch (_conditions[i].comparison) {
+        case inequality_comparison::LESS_THAN:
+          satisfied = (state == weak_ordering::LESS); break;
+        case inequality_comparison::LESS_THAN_EQUAL:
+          satisfied = (state != weak_ordering::GREATER); break;
+        case inequality_comparison::GREATER_THAN:
+          satisfied = (state == weak_ordering::GREATER); break;
+        case inequality_comparison::GREATER_THAN_EQUAL:
+          satisfied = (state != weak_ordering::LESS); break;
+        case inequality_comparison::NOT_EQUAL:
+          satisfied = (state != weak_ordering::EQUIVALENT); break;
+      }
+      if (not satisfied) { return false; }
+    }
+    return true;
+  }
+
+ private:
+  row_equality _check_row_equality;
+  table_device_view _probe_table;
+  table_device_view _build_table;
+  join_condition const* _conditions;
+  size_type _num_conditions;
+};
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Computes a join between two tables on equality key columns with
+ * additional residual relational conditions, and returns the output indices
+ * of left and right table as a combined table
+ *
+ * The hash table is built on the key columns only; the residual conditions
+ * are evaluated inside the probe kernels before a pair is emitted. The build
+ * side always stays on the right so the conditions can refer to left and
+ * right columns directly, hence no table swap optimization is applied.
+ *
+ * @param left  The left table
+ * @param right The right table
+ * @param left_keys Key columns of `left` to build the hash table on
+ * @param right_keys Key columns of `right` to probe with
+ * @param conditions Device vector of residual conditions over columns of
+ * `left` and `right`
+ * @param stream stream on which all memory allocations and copies
+ * will be performed
+ * @tparam join_kind The type of join to be performed
+ *
+ * @returns Join output indices vector pair
+ */
+/* ----------------------------------------------------------------------------*/
+template <join_kind JoinKind>
+std::enable_if_t<(JoinKind != join_kind::FULL_JOIN),
+std::pair<rmm::device_vector<size_type>,
+rmm::device_vector<size_type>>>
+get_conditional_hash_join_indices(
+    table_view const& left,
+    table_view const& right,
+    table_view const& left_keys,
+    table_view const& right_keys,
+    rmm::device_vector<join_condition> const& conditions,
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream) {
+
+  //Trivial left join case - exit early
+  if ((JoinKind == join_kind::LEFT_JOIN) && (right.num_rows() == 0)) {
+    return get_trivial_left_join_indices(left, stream);
+  }
+
+  auto build_table = table_device_view::create(right_keys, stream);
+  auto probe_table = table_device_view::create(left_keys, stream);
+  auto left_full_table = table_device_view::create(left, stream);
+  auto right_full_table = table_device_view::create(right, stream);
+
+  auto hash_table = build_join_hash_table(*build_table, mr, stream);
+
+  row_equality key_equality{*probe_table, *build_table};
+  row_conditional_comparator equality{
+      key_equality, *left_full_table, *right_full_table,
+      conditions.data().get(), static_cast<size_type>(conditions.size())};
 
+  return probe_join_hash_table<JoinKind>(
+      *build_table, *probe_table, *hash_table, equality, false, stream);
 }
 
 }//namespace detail
@@ -19,12 +19,15 @@
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/concatenate.hpp>
+#include <cudf/detail/copy.hpp>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/gather.cuh>
+#include <cudf/detail/hashing.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 
 #include <join/join_common_utils.hpp>
 #include <join/hash_join.cuh>
+#include <join/sort_merge_join.cuh>
 
 namespace cudf {
 
@@ -64,10 +67,21 @@ auto non_common_column_indices(
 }
 
 
+/**
+ * @brief Returns true if `i` is selected by `projection`; an empty
+ * projection selects every column.
+ */
+bool is_projected_column(std::vector<size_type> const& projection, size_type i) {
+  return projection.empty() ||
+         std::find(projection.begin(), projection.end(), i) != projection.end();
+}
+
 std::unique_ptr<experimental::table> get_empty_joined_table(
                          table_view const& left,
                          table_view const& right,
-                         std::vector<std::pair<size_type, size_type>> const& columns_in_common) {
+                         std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+                         std::vector<size_type> const& left_output = {},
+                         std::vector<size_type> const& right_output = {}) {
   std::vector<size_type> right_columns_in_common (columns_in_common.size());
   std::transform(
       columns_in_common.begin(),
@@ -76,10 +90,17 @@ std::unique_ptr<experimental::table> get_empty_joined_table(
       [](auto& col) { return col.second; } );
   std::unique_ptr<experimental::table> empty_left = experimental::empty_like(left);
   std::unique_ptr<experimental::table> empty_right = experimental::empty_like(right);
-  std::vector <size_type> right_non_common_indices =
-    non_common_column_indices(right.num_columns(), right_columns_in_common);
+  std::vector<size_type> left_indices;
+  for (size_type i = 0; i < left.num_columns(); ++i) {
+    if (is_projected_column(left_output, i)) { left_indices.push_back(i); }
+  }
+  std::vector<size_type> right_non_common_indices;
+  for (auto i : non_common_column_indices(right.num_columns(), right_columns_in_common)) {
+    if (is_projected_column(right_output, i)) { right_non_common_indices.push_back(i); }
+  }
+  table_view tmp_left_table = (*empty_left).select(left_indices);
   table_view tmp_right_table = (*empty_right).select(right_non_common_indices);
-  table_view tmp_table{{*empty_left, tmp_right_table}};
+  table_view tmp_table{{tmp_left_table, tmp_right_table}};
   return std::make_unique<experimental::table>(tmp_table);
 }
 
@@ -226,6 +247,7 @@ std::pair<rmm::device_vector<size_type>,
 get_base_join_indices(
     table_view const& left,
     table_view const& right,
+    rmm::mr::device_memory_resource* mr,
     cudaStream_t stream) {
   CUDF_EXPECTS (0 != left.num_columns(), "Selected left dataset is empty");
   CUDF_EXPECTS (0 != right.num_columns(), "Selected right dataset is empty");
@@ -237,7 +259,7 @@ get_base_join_indices(
       "Mismatch in joining column data types");
 
   constexpr join_kind BaseJoinKind = (JoinKind == join_kind::FULL_JOIN)? join_kind::LEFT_JOIN : JoinKind;
-  return get_base_hash_join_indices<BaseJoinKind>(left, right, false, stream);
+  return get_base_hash_join_indices<BaseJoinKind>(left, right, false, mr, stream);
 }
 
 /* --------------------------------------------------------------------------*/
@@ -300,11 +322,18 @@ combine_join_columns(
 * `left`. For a full join, the result will be gathered from both common
 * columns in `left` and `right` and concatenated to form a single column.
 *
+* @param left_output The indices of the `left` columns to materialize in the
+* output; an empty vector selects every column. A common column appears iff
+* its left index is selected.
+* @param right_output The indices of the `right` columns to materialize in
+* the output; an empty vector selects every non-common column.
+*
 * @Returns `table` containing the concatenation of rows from `left` and
 * `right` specified by `joined_indices`.
 * For any columns indicated by `columns_in_common`, only the corresponding
 * column in `left` will be included in the result. Final form would look like
-* `left(including common columns)+right(excluding common columns)`.
+* `left(including common columns)+right(excluding common columns)`, each side
+* restricted to its projection list.
 */
 /* ----------------------------------------------------------------------------*/
 template <join_kind JoinKind>
@@ -315,19 +344,50 @@ construct_join_output_df(
     VectorPair& joined_indices,
     std::vector<std::pair<size_type, size_type>> const& columns_in_common,
     rmm::mr::device_memory_resource* mr,
-    cudaStream_t stream) {
+    cudaStream_t stream,
+    std::vector<size_type> const& left_output = {},
+    std::vector<size_type> const& right_output = {}) {
+
+  // every common pair is excluded from the right side; only projected pairs
+  // are gathered
   std::vector<size_type> left_common_col;
   left_common_col.reserve(columns_in_common.size());
   std::vector<size_type> right_common_col;
   right_common_col.reserve(columns_in_common.size());
+  std::vector<size_type> right_common_excluded;
+  right_common_excluded.reserve(columns_in_common.size());
   for (const auto c : columns_in_common) {
+    right_common_excluded.push_back(c.second);
+    if (not is_projected_column(left_output, c.first)) { continue; }
     left_common_col.push_back(c.first);
     right_common_col.push_back(c.second);
   }
-  std::vector<size_type> left_noncommon_col =
-    non_common_column_indices(left.num_columns(), left_common_col);
-  std::vector<size_type> right_noncommon_col =
-    non_common_column_indices(right.num_columns(), right_common_col);
+  std::vector<size_type> left_noncommon_col;
+  for (auto i : non_common_column_indices(left.num_columns(), left_common_col)) {
+    if (is_projected_column(left_output, i)) { left_noncommon_col.push_back(i); }
+  }
+  std::vector<size_type> right_noncommon_col;
+  for (auto i : non_common_column_indices(right.num_columns(), right_common_excluded)) {
+    if (is_projected_column(right_output, i)) { right_noncommon_col.push_back(i); }
+  }
+
+  // output positions of the left columns: their rank among all projected
+  // left columns, keeping the original left column order
+  std::vector<size_type> left_out_cols(left_noncommon_col);
+  left_out_cols.insert(left_out_cols.end(),
+                       left_common_col.begin(), left_common_col.end());
+  std::sort(left_out_cols.begin(), left_out_cols.end());
+  auto out_position = [&left_out_cols](size_type i) {
+    return static_cast<size_type>(
+        std::lower_bound(left_out_cols.begin(), left_out_cols.end(), i) -
+        left_out_cols.begin());
+  };
+  std::vector<size_type> left_noncommon_out(left_noncommon_col.size());
+  std::transform(left_noncommon_col.begin(), left_noncommon_col.end(),
+                 left_noncommon_out.begin(), out_position);
+  std::vector<size_type> left_common_out(left_common_col.size());
+  std::transform(left_common_col.begin(), left_common_col.end(),
+                 left_common_out.begin(), out_position);
 
   bool const nullify_out_of_bounds{ JoinKind != join_kind::INNER_JOIN };
 
@@ -337,29 +397,29 @@ construct_join_output_df(
     auto complement_indices =
       get_left_join_indices_complement(joined_indices.second,
         left.num_rows(), right.num_rows(), stream);
-    if (not columns_in_common.empty()) {
+    if (not left_common_col.empty()) {
       auto common_from_right = experimental::detail::gather(
           right.select(right_common_col),
           complement_indices.second.begin(),
           complement_indices.second.end(),
-          nullify_out_of_bounds);
+          nullify_out_of_bounds, mr, stream);
       auto common_from_left = experimental::detail::gather(
           left.select(left_common_col),
           joined_indices.first.begin(),
           joined_indices.first.end(),
-          nullify_out_of_bounds);
+          nullify_out_of_bounds, mr, stream);
       common_table = experimental::concatenate(
-          {common_from_right->view(), common_from_left->view()});
+          {common_from_right->view(), common_from_left->view()}, mr);
     } 
     joined_indices =
       concatenate_vector_pairs(complement_indices, joined_indices);
   } else {
-      if (not columns_in_common.empty()) {
+      if (not left_common_col.empty()) {
       common_table = experimental::detail::gather(
           left.select(left_common_col),
           joined_indices.first.begin(),
           joined_indices.first.end(),
-          nullify_out_of_bounds);
+          nullify_out_of_bounds, mr, stream);
       }
   }
 
@@ -369,19 +429,19 @@ construct_join_output_df(
         left.select(left_noncommon_col),
         joined_indices.first.begin(),
         joined_indices.first.end(),
-        nullify_out_of_bounds);
+        nullify_out_of_bounds, mr, stream);
 
   std::unique_ptr<experimental::table> right_table =
     experimental::detail::gather(
         right.select(right_noncommon_col),
         joined_indices.second.begin(),
         joined_indices.second.end(),
-        nullify_out_of_bounds);
+        nullify_out_of_bounds, mr, stream);
 
   return std::make_unique<experimental::table>(
       combine_join_columns(
-      left_table->release(), left_noncommon_col,
-      common_table->release(), left_common_col,
+      left_table->release(), left_noncommon_out,
+      common_table->release(), left_common_out,
       right_table->release()));
 }
 
@@ -422,6 +482,10 @@ construct_join_output_df(
  * the device memory for the new table
  * @param stream Optional, stream on which all memory allocations and copies
  * will be performed
+ * @param left_output Optional, indices of the `left` columns to materialize
+ * in the output; an empty vector selects every column
+ * @param right_output Optional, indices of the `right` columns to materialize
+ * in the output; an empty vector selects every non-common column
  *
  * @tparam join_kind The type of join to be performed
  *
@@ -439,7 +503,9 @@ join_call_compute_df(
     std::vector<size_type> const& right_on,
     std::vector<std::pair<size_type, size_type>> const& columns_in_common,
     rmm::mr::device_memory_resource* mr,
-    cudaStream_t stream = 0) {
+    cudaStream_t stream = 0,
+    std::vector<size_type> const& left_output = {},
+    std::vector<size_type> const& right_output = {}) {
 
   CUDF_EXPECTS (0 != left.num_columns(), "Left table is empty");
   CUDF_EXPECTS (0 != right.num_columns(), "Right table is empty");
@@ -457,14 +523,668 @@ join_call_compute_df(
       ),
       "Invalid values passed to columns_in_common");
 
+  CUDF_EXPECTS (std::all_of(left_output.begin(), left_output.end(),
+      [&left](auto i){ return (i >= 0) && (i < left.num_columns()); }),
+      "Invalid column index in left_output");
+  CUDF_EXPECTS (std::all_of(right_output.begin(), right_output.end(),
+      [&right](auto i){ return (i >= 0) && (i < right.num_columns()); }),
+      "Invalid column index in right_output");
+
   if (is_trivial_join(left, right, left_on, right_on, JoinKind)) {
+    return get_empty_joined_table(left, right, columns_in_common, left_output, right_output);
+  }
+
+  auto joined_indices =
+    get_base_join_indices<JoinKind>(left.select(left_on), right.select(right_on), mr, stream);
+
+  return construct_join_output_df<JoinKind>(left, right, joined_indices, columns_in_common, mr,
+                                            stream, left_output, right_output);
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Performs a merge-based inner join on tables presorted on the join
+ * columns, with the same validation and output construction as the hash path
+ *
+ * @copydetails cudf::experimental::detail::join_call_compute_df
+ */
+/* ----------------------------------------------------------------------------*/
+std::unique_ptr<experimental::table>
+merge_join_call_compute_df(
+    table_view const& left,
+    table_view const& right,
+    std::vector<size_type> const& left_on,
+    std::vector<size_type> const& right_on,
+    std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream = 0) {
+
+  CUDF_EXPECTS (0 != left.num_columns(), "Left table is empty");
+  CUDF_EXPECTS (0 != right.num_columns(), "Right table is empty");
+  CUDF_EXPECTS (left.num_rows() < MAX_JOIN_SIZE, "Left column size is too big");
+  CUDF_EXPECTS (right.num_rows() < MAX_JOIN_SIZE, "Right column size is too big");
+
+  CUDF_EXPECTS (left_on.size() == right_on.size(), "Mismatch in number of columns to be joined on");
+
+  CUDF_EXPECTS (std::all_of(columns_in_common.begin(), columns_in_common.end(),
+      [&left_on, &right_on](auto p){
+      size_t lind = std::find(left_on.begin(), left_on.end(), p.first) - left_on.begin();
+      size_t rind = std::find(right_on.begin(), right_on.end(), p.second) - right_on.begin();
+      return (lind != left_on.size()) && (rind != right_on.size()) && (lind == rind);
+      }
+      ),
+      "Invalid values passed to columns_in_common");
+
+  if (is_trivial_join(left, right, left_on, right_on, join_kind::INNER_JOIN)) {
     return get_empty_joined_table(left, right, columns_in_common);
   }
 
+  auto const selected_left = left.select(left_on);
+  auto const selected_right = right.select(right_on);
+  CUDF_EXPECTS(std::equal(
+      std::cbegin(selected_left), std::cend(selected_left),
+      std::cbegin(selected_right), std::cend(selected_right),
+      [](const auto &l, const auto &r) {
+      return l.type() == r.type(); }),
+      "Mismatch in joining column data types");
+
   auto joined_indices =
-    get_base_join_indices<JoinKind>(left.select(left_on), right.select(right_on), stream);
+    get_sort_merge_inner_join_indices(selected_left, selected_right, stream);
+
+  return construct_join_output_df<join_kind::INNER_JOIN>(
+      left, right, joined_indices, columns_in_common, mr, stream);
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Performs a join on equality key columns with additional residual
+ * relational conditions evaluated inside the probe kernels, with the same
+ * validation and output construction as the plain hash path
+ *
+ * @copydetails cudf::experimental::detail::join_call_compute_df
+ * @param conditions Residual conditions over columns of `left` and `right`
+ * that each output row pair must additionally satisfy
+ */
+/* ----------------------------------------------------------------------------*/
+template <join_kind JoinKind>
+std::unique_ptr<experimental::table>
+conditional_join_call_compute_df(
+    table_view const& left,
+    table_view const& right,
+    std::vector<size_type> const& left_on,
+    std::vector<size_type> const& right_on,
+    std::vector<join_condition> const& conditions,
+    std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream = 0) {
+
+  if (conditions.empty()) {
+    return join_call_compute_df<JoinKind>(
+        left, right, left_on, right_on, columns_in_common, mr, stream);
+  }
+
+  CUDF_EXPECTS (0 != left.num_columns(), "Left table is empty");
+  CUDF_EXPECTS (0 != right.num_columns(), "Right table is empty");
+  CUDF_EXPECTS (left.num_rows() < MAX_JOIN_SIZE, "Left column size is too big");
+  CUDF_EXPECTS (right.num_rows() < MAX_JOIN_SIZE, "Right column size is too big");
+
+  CUDF_EXPECTS (left_on.size() == right_on.size(), "Mismatch in number of columns to be joined on");
+
+  CUDF_EXPECTS (std::all_of(columns_in_common.begin(), columns_in_common.end(),
+      [&left_on, &right_on](auto p){
+      size_t lind = std::find(left_on.begin(), left_on.end(), p.first) - left_on.begin();
+      size_t rind = std::find(right_on.begin(), right_on.end(), p.second) - right_on.begin();
+      return (lind != left_on.size()) && (rind != right_on.size()) && (lind == rind);
+      }
+      ),
+      "Invalid values passed to columns_in_common");
+
+  CUDF_EXPECTS (std::all_of(conditions.begin(), conditions.end(),
+      [&left, &right](auto const &c){
+      return (c.left_column >= 0) && (c.left_column < left.num_columns()) &&
+             (c.right_column >= 0) && (c.right_column < right.num_columns()) &&
+             (left.column(c.left_column).type() ==
+              right.column(c.right_column).type());
+      }
+      ),
+      "Invalid column index or type mismatch in join conditions");
+
+  if (is_trivial_join(left, right, left_on, right_on, JoinKind)) {
+    return get_empty_joined_table(left, right, columns_in_common);
+  }
+
+  auto const selected_left = left.select(left_on);
+  auto const selected_right = right.select(right_on);
+  CUDF_EXPECTS(std::equal(
+      std::cbegin(selected_left), std::cend(selected_left),
+      std::cbegin(selected_right), std::cend(selected_right),
+      [](const auto &l, const auto &r) {
+      return l.type() == r.type(); }),
+      "Mismatch in joining column data types");
+
+  const rmm::device_vector<join_condition> d_conditions(conditions);
+
+  auto joined_indices = get_conditional_hash_join_indices<JoinKind>(
+      left, right, selected_left, selected_right, d_conditions, mr, stream);
+
+  return construct_join_output_df<JoinKind>(
+      left, right, joined_indices, columns_in_common, mr, stream);
+}
+
+template <typename T>
+using pinned_buffer = std::unique_ptr<T, decltype(&cudaFreeHost)>;
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  A single hash partition of a table, spilled to pinned host memory
+ *
+ * Holds the contiguous buffer produced by `contiguous_split` for one
+ * partition, copied to pinned host memory. The saved column views still
+ * reference the device buffer they were created over, which is freed after
+ * the spill; `restore_partition` copies the buffer back to the device and
+ * rebases the views onto the new allocation.
+ */
+/* ----------------------------------------------------------------------------*/
+struct spilled_partition {
+  pinned_buffer<char> host_data{nullptr, cudaFreeHost};
+  size_t size{0};
+  char const* old_base{nullptr};
+  std::vector<column_view> saved_columns;
+  size_type num_rows{0};
+};
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Recreates a column view over a buffer that has been copied to a new
+ * base address, shifting the data and null mask pointers of the view and all
+ * of its children by the distance between the two allocations
+ *
+ * Null counts are left unknown since computing them on the original buffer
+ * may no longer be possible; they are recounted lazily over the new buffer.
+ *
+ * @param input The column view into the original buffer
+ * @param old_base Base address of the buffer `input` was created over
+ * @param new_base Base address of the buffer holding the same bytes
+ *
+ * @returns Column view with all pointers rebased onto `new_base`
+ */
+/* ----------------------------------------------------------------------------*/
+column_view rebase_column_view(column_view const& input,
+                               char const* old_base,
+                               char const* new_base) {
+  auto rebase_ptr = [old_base, new_base](void const* ptr) -> void const* {
+    if (ptr == nullptr) { return nullptr; }
+    return new_base + (static_cast<char const*>(ptr) - old_base);
+  };
+  std::vector<column_view> children;
+  for (size_type i = 0; i < input.num_children(); ++i) {
+    children.push_back(rebase_column_view(input.child(i), old_base, new_base));
+  }
+  return column_view(input.type(), input.size(),
+                     rebase_ptr(input.head()),
+                     static_cast<bitmask_type const*>(rebase_ptr(input.null_mask())),
+                     input.nullable() ? UNKNOWN_NULL_COUNT : 0,
+                     input.offset(), std::move(children));
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Hash partitions a table on the given key columns and spills every
+ * partition to pinned host memory, leaving no device copy behind
+ *
+ * Each partition is packed into a single contiguous device buffer with
+ * `contiguous_split` and staged out one at a time, so the peak device
+ * footprint beyond the partitioned table is a single partition.
+ *
+ * @param input The table to partition
+ * @param key_columns Indices of the columns to hash
+ * @param num_partitions The number of partitions to produce
+ * @param stream stream on which all memory allocations and copies
+ * will be performed
+ *
+ * @returns Spilled partitions, one per partition index
+ */
+/* ----------------------------------------------------------------------------*/
+std::vector<spilled_partition> spill_partitions(
+    table_view const& input,
+    std::vector<size_type> const& key_columns,
+    int num_partitions,
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream) {
+
+  auto partitioned = detail::hash_partition(
+      input, key_columns, num_partitions,
+      mr, stream);
 
-  return construct_join_output_df<JoinKind>(left, right, joined_indices, columns_in_common, mr, stream);
+  const std::vector<size_type> splits(
+      partitioned.second.begin() + 1, partitioned.second.end());
+  auto chunks = detail::contiguous_split(
+      partitioned.first->view(), splits,
+      mr, stream);
+  partitioned.first.reset();
+
+  std::vector<spilled_partition> spilled(chunks.size());
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    auto &chunk = chunks[i];
+    auto &part = spilled[i];
+    part.size = chunk.all_data->size();
+    part.old_base = static_cast<char const *>(chunk.all_data->data());
+    part.saved_columns.assign(chunk.table.begin(), chunk.table.end());
+    part.num_rows = chunk.table.num_rows();
+    if (part.size != 0) {
+      char *host_ptr = nullptr;
+      CUDA_TRY(cudaMallocHost(&host_ptr, part.size));
+      part.host_data = pinned_buffer<char>{host_ptr, cudaFreeHost};
+      CUDA_TRY(cudaMemcpyAsync(host_ptr, chunk.all_data->data(), part.size,
+                               cudaMemcpyDeviceToHost, stream));
+      CUDA_TRY(cudaStreamSynchronize(stream));
+    }
+    // Free the device copy before staging the next partition
+    chunk.all_data.reset();
+  }
+  return spilled;
+}
+
+/**
+ * @brief  A spilled partition brought back to device memory; `table` views
+ * into `data` and must not outlive it
+ */
+struct restored_partition {
+  rmm::device_buffer data;
+  table_view table;
+};
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Copies a spilled partition back to device memory and rebuilds its
+ * table view over the new allocation
+ *
+ * @param partition The spilled partition to restore
+ * @param stream stream on which all memory allocations and copies
+ * will be performed
+ *
+ * @returns The restored device buffer and a table view over it
+ */
+/* ----------------------------------------------------------------------------*/
+restored_partition restore_partition(spilled_partition const& partition,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream) {
+  rmm::device_buffer data(partition.size, stream, mr);
+  CUDA_TRY(cudaMemcpyAsync(data.data(), partition.host_data.get(),
+                           partition.size, cudaMemcpyHostToDevice, stream));
+
+  auto new_base = static_cast<char const *>(data.data());
+  std::vector<column_view> columns;
+  for (auto const &col : partition.saved_columns) {
+    columns.push_back(rebase_column_view(col, partition.old_base, new_base));
+  }
+  return restored_partition{std::move(data), table_view{columns}};
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  A table packed into a single contiguous device buffer, as produced
+ * by `contiguous_split`; the views reference the buffer and a copy of the
+ * buffer on another device can recreate them with `rebase_column_view`
+ */
+/* ----------------------------------------------------------------------------*/
+struct packed_table {
+  std::unique_ptr<rmm::device_buffer> data;
+  std::vector<column_view> columns;
+  size_type num_rows{0};
+};
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Packs a whole table into a single contiguous device buffer on the
+ * current device
+ *
+ * @param input The table to pack
+ * @param stream stream on which all memory allocations and copies
+ * will be performed
+ *
+ * @returns The packed table
+ */
+/* ----------------------------------------------------------------------------*/
+packed_table pack_table(table_view const& input, cudaStream_t stream) {
+  auto chunks = detail::contiguous_split(
+      input, std::vector<size_type>{}, rmm::mr::get_default_resource(), stream);
+  packed_table packed;
+  packed.data = std::move(chunks.front().all_data);
+  packed.columns.assign(chunks.front().table.begin(), chunks.front().table.end());
+  packed.num_rows = input.num_rows();
+  return packed;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Hash partitions a table on the given key columns and packs every
+ * partition into its own contiguous device buffer on the current device
+ *
+ * @param input The table to partition
+ * @param key_columns Indices of the columns to hash
+ * @param num_partitions The number of partitions to produce
+ * @param stream stream on which all memory allocations and copies
+ * will be performed
+ *
+ * @returns Packed partitions, one per partition index
+ */
+/* ----------------------------------------------------------------------------*/
+std::vector<packed_table> pack_partitions(
+    table_view const& input,
+    std::vector<size_type> const& key_columns,
+    int num_partitions,
+    cudaStream_t stream) {
+
+  auto partitioned = detail::hash_partition(
+      input, key_columns, num_partitions,
+      rmm::mr::get_default_resource(), stream);
+
+  const std::vector<size_type> splits(
+      partitioned.second.begin() + 1, partitioned.second.end());
+  auto chunks = detail::contiguous_split(
+      partitioned.first->view(), splits,
+      rmm::mr::get_default_resource(), stream);
+
+  std::vector<packed_table> packed(chunks.size());
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    packed[i].data = std::move(chunks[i].all_data);
+    packed[i].columns.assign(chunks[i].table.begin(), chunks[i].table.end());
+    packed[i].num_rows = chunks[i].table.num_rows();
+  }
+  return packed;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Copies a packed table to the current device and rebuilds its column
+ * views over the new allocation
+ *
+ * The copy uses `cudaMemcpyDefault`, which takes the peer-to-peer path when
+ * peer access between the two devices is enabled and is staged through host
+ * memory otherwise.
+ *
+ * @param source The packed table to copy; may live on any device
+ * @param stream stream of the current device to perform the copy on
+ *
+ * @returns The packed table resident on the current device
+ */
+/* ----------------------------------------------------------------------------*/
+packed_table copy_packed_to_current_device(packed_table const& source,
+                                           cudaStream_t stream) {
+  packed_table copied;
+  copied.data = std::make_unique<rmm::device_buffer>(source.data->size(), stream);
+  if (source.data->size() != 0) {
+    CUDA_TRY(cudaMemcpyAsync(copied.data->data(), source.data->data(),
+                             source.data->size(), cudaMemcpyDefault, stream));
+  }
+  auto old_base = static_cast<char const *>(source.data->data());
+  auto new_base = static_cast<char const *>(copied.data->data());
+  for (auto const &col : source.columns) {
+    copied.columns.push_back(rebase_column_view(col, old_base, new_base));
+  }
+  copied.num_rows = source.num_rows;
+  return copied;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Enables peer access from the current device to every other device
+ * in the list, where supported
+ *
+ * Failures are ignored: without peer access the packed table copies simply
+ * take the slower staged path.
+ *
+ * @param devices The device ordinals participating in the join
+ */
+/* ----------------------------------------------------------------------------*/
+void enable_peer_access(std::vector<int> const& devices) {
+  int current_device = 0;
+  CUDA_TRY(cudaGetDevice(&current_device));
+  for (int peer : devices) {
+    if (peer == current_device) { continue; }
+    int can_access = 0;
+    if (cudaSuccess == cudaDeviceCanAccessPeer(&can_access, current_device, peer)
+        && can_access) {
+      const cudaError_t status = cudaDeviceEnablePeerAccess(peer, 0);
+      if (status != cudaSuccess && status != cudaErrorPeerAccessAlreadyEnabled) {
+        cudaGetLastError();  // Clear the error; fall back to staged copies
+      } else {
+        cudaGetLastError();
+      }
+    }
+  }
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Restores the device that was current when the guard was created
+ */
+/* ----------------------------------------------------------------------------*/
+struct device_guard {
+  device_guard() { CUDA_TRY(cudaGetDevice(&device)); }
+  ~device_guard() { cudaSetDevice(device); }
+  int device = 0;
+};
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Performs a grace-style partitioned inner join for inputs whose
+ * build side does not fit in device memory, with the same validation and
+ * output construction as the hash path
+ *
+ * Both tables are co-partitioned on the key columns with `hash_partition`,
+ * every partition is spilled to pinned host memory, and partition pairs are
+ * then restored and joined one at a time. Rows can only match within their
+ * own partition since both sides use the same hash function.
+ *
+ * @copydetails cudf::experimental::detail::join_call_compute_df
+ * @param num_partitions The number of partitions to split each table into
+ */
+/* ----------------------------------------------------------------------------*/
+std::unique_ptr<experimental::table>
+partitioned_join_call_compute_df(
+    table_view const& left,
+    table_view const& right,
+    std::vector<size_type> const& left_on,
+    std::vector<size_type> const& right_on,
+    std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+    int num_partitions,
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream = 0) {
+
+  CUDF_EXPECTS (0 != left.num_columns(), "Left table is empty");
+  CUDF_EXPECTS (0 != right.num_columns(), "Right table is empty");
+  CUDF_EXPECTS (left.num_rows() < MAX_JOIN_SIZE, "Left column size is too big");
+  CUDF_EXPECTS (right.num_rows() < MAX_JOIN_SIZE, "Right column size is too big");
+  CUDF_EXPECTS (num_partitions > 0, "Invalid number of partitions");
+
+  CUDF_EXPECTS (left_on.size() == right_on.size(), "Mismatch in number of columns to be joined on");
+
+  CUDF_EXPECTS (std::all_of(columns_in_common.begin(), columns_in_common.end(),
+      [&left_on, &right_on](auto p){
+      size_t lind = std::find(left_on.begin(), left_on.end(), p.first) - left_on.begin();
+      size_t rind = std::find(right_on.begin(), right_on.end(), p.second) - right_on.begin();
+      return (lind != left_on.size()) && (rind != right_on.size()) && (lind == rind);
+      }
+      ),
+      "Invalid values passed to columns_in_common");
+
+  if (is_trivial_join(left, right, left_on, right_on, join_kind::INNER_JOIN)) {
+    return get_empty_joined_table(left, right, columns_in_common);
+  }
+
+  auto const selected_left = left.select(left_on);
+  auto const selected_right = right.select(right_on);
+  CUDF_EXPECTS(std::equal(
+      std::cbegin(selected_left), std::cend(selected_left),
+      std::cbegin(selected_right), std::cend(selected_right),
+      [](const auto &l, const auto &r) {
+      return l.type() == r.type(); }),
+      "Mismatch in joining column data types");
+
+  auto left_partitions = spill_partitions(left, left_on, num_partitions, mr, stream);
+  auto right_partitions = spill_partitions(right, right_on, num_partitions, mr, stream);
+
+  // Restore and join one partition pair at a time; empty pairs cannot
+  // contribute any rows to an inner join and are skipped
+  std::vector<std::unique_ptr<experimental::table>> joined_parts;
+  for (int i = 0; i < num_partitions; ++i) {
+    if (left_partitions[i].num_rows == 0 || right_partitions[i].num_rows == 0) {
+      continue;
+    }
+    auto left_part = restore_partition(left_partitions[i], mr, stream);
+    auto right_part = restore_partition(right_partitions[i], mr, stream);
+    joined_parts.push_back(join_call_compute_df<join_kind::INNER_JOIN>(
+        left_part.table, right_part.table,
+        left_on, right_on, columns_in_common, mr, stream));
+  }
+
+  if (joined_parts.empty()) {
+    return get_empty_joined_table(left, right, columns_in_common);
+  }
+  if (joined_parts.size() == 1) {
+    return std::move(joined_parts.front());
+  }
+  std::vector<table_view> joined_views(joined_parts.size());
+  std::transform(joined_parts.begin(), joined_parts.end(), joined_views.begin(),
+                 [](auto const &part) { return part->view(); });
+  return experimental::concatenate(joined_views, mr);
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Performs an inner join between table shards resident on multiple
+ * devices and a single small build table, by broadcasting the build table to
+ * every shard's device and joining locally
+ *
+ * @param left_shards The left table shards; shard `i` must be resident on
+ * `shard_devices[i]`
+ * @param shard_devices The device ordinal each left shard is resident on
+ * @param right The build table
+ * @param right_device The device ordinal `right` is resident on
+ * @param left_on Indices of left columns to join on
+ * @param right_on Indices of right columns to join on
+ * @param columns_in_common Common column pairs, interpreted as in `inner_join`
+ *
+ * @returns One joined table per shard, resident on that shard's device
+ */
+/* ----------------------------------------------------------------------------*/
+std::vector<std::unique_ptr<experimental::table>>
+broadcast_join_call(
+    std::vector<table_view> const& left_shards,
+    std::vector<int> const& shard_devices,
+    table_view const& right,
+    int right_device,
+    std::vector<size_type> const& left_on,
+    std::vector<size_type> const& right_on,
+    std::vector<std::pair<size_type, size_type>> const& columns_in_common) {
+
+  CUDF_EXPECTS (not left_shards.empty(), "No left shards");
+  CUDF_EXPECTS (left_shards.size() == shard_devices.size(),
+                "Mismatch in number of shards and devices");
+
+  device_guard restore;
+
+  // Pack the build table into one buffer on its own device so a single copy
+  // moves it to each shard's device
+  CUDA_TRY(cudaSetDevice(right_device));
+  enable_peer_access(shard_devices);
+  auto packed_right = pack_table(right, 0);
+  CUDA_TRY(cudaStreamSynchronize(0));
+
+  std::vector<std::unique_ptr<experimental::table>> results;
+  for (size_t i = 0; i < left_shards.size(); ++i) {
+    CUDA_TRY(cudaSetDevice(shard_devices[i]));
+    enable_peer_access({right_device});
+    auto local_right = copy_packed_to_current_device(packed_right, 0);
+    CUDA_TRY(cudaStreamSynchronize(0));
+    results.push_back(join_call_compute_df<join_kind::INNER_JOIN>(
+        left_shards[i], table_view{local_right.columns},
+        left_on, right_on, columns_in_common,
+        rmm::mr::get_default_resource(), 0));
+  }
+  return results;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Performs an inner join between table shards resident on multiple
+ * devices by hash-shuffling both sides across the devices and joining each
+ * co-partition locally
+ *
+ * Every shard is hash partitioned on its join keys into one partition per
+ * device, partitions are exchanged so device `j` receives partition `j` of
+ * every shard, and the received pieces are concatenated and joined locally.
+ * Both sides use the same hash function, so matching rows always meet on the
+ * same device.
+ *
+ * @param left_shards The left table shards; shard `i` must be resident on
+ * `shard_devices[i]`
+ * @param right_shards The right table shards, sharded the same way
+ * @param shard_devices The device ordinal each shard pair is resident on
+ * @param left_on Indices of left columns to join on
+ * @param right_on Indices of right columns to join on
+ * @param columns_in_common Common column pairs, interpreted as in `inner_join`
+ *
+ * @returns One joined table per shard, resident on that shard's device
+ */
+/* ----------------------------------------------------------------------------*/
+std::vector<std::unique_ptr<experimental::table>>
+shuffle_join_call(
+    std::vector<table_view> const& left_shards,
+    std::vector<table_view> const& right_shards,
+    std::vector<int> const& shard_devices,
+    std::vector<size_type> const& left_on,
+    std::vector<size_type> const& right_on,
+    std::vector<std::pair<size_type, size_type>> const& columns_in_common) {
+
+  CUDF_EXPECTS (not left_shards.empty(), "No left shards");
+  CUDF_EXPECTS (left_shards.size() == right_shards.size(),
+                "Mismatch in number of left and right shards");
+  CUDF_EXPECTS (left_shards.size() == shard_devices.size(),
+                "Mismatch in number of shards and devices");
+
+  device_guard restore;
+  const int num_shards = static_cast<int>(left_shards.size());
+
+  // Locally co-partition both sides on every device with the same hash
+  std::vector<std::vector<packed_table>> left_parts(num_shards);
+  std::vector<std::vector<packed_table>> right_parts(num_shards);
+  for (int i = 0; i < num_shards; ++i) {
+    CUDA_TRY(cudaSetDevice(shard_devices[i]));
+    enable_peer_access(shard_devices);
+    left_parts[i] = pack_partitions(left_shards[i], left_on, num_shards, 0);
+    right_parts[i] = pack_partitions(right_shards[i], right_on, num_shards, 0);
+    CUDA_TRY(cudaStreamSynchronize(0));
+  }
+
+  // Exchange: device j receives partition j of every shard and joins locally
+  std::vector<std::unique_ptr<experimental::table>> results;
+  for (int j = 0; j < num_shards; ++j) {
+    CUDA_TRY(cudaSetDevice(shard_devices[j]));
+
+    std::vector<packed_table> local_left;
+    std::vector<packed_table> local_right;
+    for (int i = 0; i < num_shards; ++i) {
+      local_left.push_back(copy_packed_to_current_device(left_parts[i][j], 0));
+      local_right.push_back(copy_packed_to_current_device(right_parts[i][j], 0));
+    }
+    CUDA_TRY(cudaStreamSynchronize(0));
+
+    std::vector<table_view> left_views;
+    std::vector<table_view> right_views;
+    for (auto const &part : local_left) { left_views.push_back(table_view{part.columns}); }
+    for (auto const &part : local_right) { right_views.push_back(table_view{part.columns}); }
+    auto left_local = experimental::concatenate(left_views);
+    auto right_local = experimental::concatenate(right_views);
+
+    results.push_back(join_call_compute_df<join_kind::INNER_JOIN>(
+        left_local->view(), right_local->view(),
+        left_on, right_on, columns_in_common,
+        rmm::mr::get_default_resource(), 0));
+  }
+  return results;
 }
 
 }
@@ -476,7 +1196,7 @@ std::unique_ptr<experimental::table> inner_join(
                              std::vector<size_type> const& right_on,
                              std::vector<std::pair<size_type, size_type>> const& columns_in_common,
                              rmm::mr::device_memory_resource* mr) {
-    CUDF_FUNC_RANGE();
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::join);
     return detail::join_call_compute_df<::cudf::experimental::detail::join_kind::INNER_JOIN>(
         left,
         right,
@@ -486,6 +1206,138 @@ std::unique_ptr<experimental::table> inner_join(
         mr);
 }
 
+std::unique_ptr<experimental::table> inner_join(
+                             table_view const& left,
+                             table_view const& right,
+                             std::vector<size_type> const& left_on,
+                             std::vector<size_type> const& right_on,
+                             std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+                             std::vector<size_type> const& left_output,
+                             std::vector<size_type> const& right_output,
+                             rmm::mr::device_memory_resource* mr) {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::join);
+    return detail::join_call_compute_df<::cudf::experimental::detail::join_kind::INNER_JOIN>(
+        left,
+        right,
+        left_on,
+        right_on,
+        columns_in_common,
+        mr,
+        0,
+        left_output,
+        right_output);
+}
+
+std::unique_ptr<experimental::table> merge_inner_join(
+                             table_view const& left,
+                             table_view const& right,
+                             std::vector<size_type> const& left_on,
+                             std::vector<size_type> const& right_on,
+                             std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+                             rmm::mr::device_memory_resource* mr) {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::join);
+    return detail::merge_join_call_compute_df(
+        left,
+        right,
+        left_on,
+        right_on,
+        columns_in_common,
+        mr);
+}
+
+std::unique_ptr<experimental::table> partitioned_inner_join(
+                             table_view const& left,
+                             table_view const& right,
+                             std::vector<size_type> const& left_on,
+                             std::vector<size_type> const& right_on,
+                             std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+                             size_type num_partitions,
+                             rmm::mr::device_memory_resource* mr) {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::join);
+    return detail::partitioned_join_call_compute_df(
+        left,
+        right,
+        left_on,
+        right_on,
+        columns_in_common,
+        num_partitions,
+        mr);
+}
+
+std::vector<std::unique_ptr<experimental::table>> broadcast_inner_join(
+                             std::vector<table_view> const& left_shards,
+                             std::vector<int> const& shard_devices,
+                             table_view const& right,
+                             int right_device,
+                             std::vector<size_type> const& left_on,
+                             std::vector<size_type> const& right_on,
+                             std::vector<std::pair<size_type, size_type>> const& columns_in_common) {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::join);
+    return detail::broadcast_join_call(
+        left_shards,
+        shard_devices,
+        right,
+        right_device,
+        left_on,
+        right_on,
+        columns_in_common);
+}
+
+std::vector<std::unique_ptr<experimental::table>> shuffle_inner_join(
+                             std::vector<table_view> const& left_shards,
+                             std::vector<table_view> const& right_shards,
+                             std::vector<int> const& shard_devices,
+                             std::vector<size_type> const& left_on,
+                             std::vector<size_type> const& right_on,
+                             std::vector<std::pair<size_type, size_type>> const& columns_in_common) {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::join);
+    return detail::shuffle_join_call(
+        left_shards,
+        right_shards,
+        shard_devices,
+        left_on,
+        right_on,
+        columns_in_common);
+}
+
+std::unique_ptr<experimental::table> conditional_inner_join(
+                             table_view const& left,
+                             table_view const& right,
+                             std::vector<size_type> const& left_on,
+                             std::vector<size_type> const& right_on,
+                             std::vector<join_condition> const& conditions,
+                             std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+                             rmm::mr::device_memory_resource* mr) {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::join);
+    return detail::conditional_join_call_compute_df<::cudf::experimental::detail::join_kind::INNER_JOIN>(
+        left,
+        right,
+        left_on,
+        right_on,
+        conditions,
+        columns_in_common,
+        mr);
+}
+
+std::unique_ptr<experimental::table> conditional_left_join(
+                             table_view const& left,
+                             table_view const& right,
+                             std::vector<size_type> const& left_on,
+                             std::vector<size_type> const& right_on,
+                             std::vector<join_condition> const& conditions,
+                             std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+                             rmm::mr::device_memory_resource* mr) {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::join);
+    return detail::conditional_join_call_compute_df<::cudf::experimental::detail::join_kind::LEFT_JOIN>(
+        left,
+        right,
+        left_on,
+        right_on,
+        conditions,
+        columns_in_common,
+        mr);
+}
+
 std::unique_ptr<experimental::table> left_join(
                              table_view const& left,
                              table_view const& right,
@@ -493,7 +1345,7 @@ std::unique_ptr<experimental::table> left_join(
                              std::vector<size_type> const& right_on,
                              std::vector<std::pair<size_type, size_type>> const& columns_in_common,
                              rmm::mr::device_memory_resource* mr) {
-    CUDF_FUNC_RANGE();
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::join);
     return detail::join_call_compute_df<::cudf::experimental::detail::join_kind::LEFT_JOIN>(
            left,
            right,
@@ -503,6 +1355,28 @@ std::unique_ptr<experimental::table> left_join(
            mr);
 }
 
+std::unique_ptr<experimental::table> left_join(
+                             table_view const& left,
+                             table_view const& right,
+                             std::vector<size_type> const& left_on,
+                             std::vector<size_type> const& right_on,
+                             std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+                             std::vector<size_type> const& left_output,
+                             std::vector<size_type> const& right_output,
+                             rmm::mr::device_memory_resource* mr) {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::join);
+    return detail::join_call_compute_df<::cudf::experimental::detail::join_kind::LEFT_JOIN>(
+           left,
+           right,
+           left_on,
+           right_on,
+           columns_in_common,
+           mr,
+           0,
+           left_output,
+           right_output);
+}
+
 std::unique_ptr<experimental::table> full_join(
                              table_view const& left,
                              table_view const& right,
@@ -510,7 +1384,7 @@ std::unique_ptr<experimental::table> full_join(
                              std::vector<size_type> const& right_on,
                              std::vector<std::pair<size_type, size_type>> const& columns_in_common,
                          rmm::mr::device_memory_resource* mr) {
-    CUDF_FUNC_RANGE();
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::join);
     return detail::join_call_compute_df<::cudf::experimental::detail::join_kind::FULL_JOIN>(
            left,
            right,
@@ -520,6 +1394,145 @@ std::unique_ptr<experimental::table> full_join(
            mr);
 }
 
+std::unique_ptr<experimental::table> full_join(
+                             table_view const& left,
+                             table_view const& right,
+                             std::vector<size_type> const& left_on,
+                             std::vector<size_type> const& right_on,
+                             std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+                             std::vector<size_type> const& left_output,
+                             std::vector<size_type> const& right_output,
+                             rmm::mr::device_memory_resource* mr) {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::join);
+    return detail::join_call_compute_df<::cudf::experimental::detail::join_kind::FULL_JOIN>(
+           left,
+           right,
+           left_on,
+           right_on,
+           columns_in_common,
+           mr,
+           0,
+           left_output,
+           right_output);
+}
+
+/**
+ * @brief Implementation of the reusable hash join handle. Owns the device
+ * hash table built over the build table's join columns so that repeated
+ * probe calls skip the build phase.
+ */
+struct hash_join::impl {
+  using table_device_view_owner =
+      decltype(table_device_view::create(std::declval<table_view>(),
+                                         std::declval<cudaStream_t>()));
+  using hash_table_owner =
+      std::unique_ptr<detail::multimap_type,
+                      std::function<void(detail::multimap_type*)>>;
+
+  table_view build;                 ///< The whole build table
+  std::vector<size_type> build_on;  ///< Joined column indices into `build`
+  table_view build_selected;        ///< `build` narrowed to the joined columns
+  table_device_view_owner build_device_view;
+  hash_table_owner hash_table;
+
+  impl(table_view const& build_table, std::vector<size_type> const& build_on_,
+       cudaStream_t stream)
+      : build(build_table),
+        build_on(build_on_),
+        build_selected(build_table.select(build_on_)),
+        build_device_view(table_device_view::create(build_selected, stream)),
+        hash_table(detail::build_join_hash_table(
+            *build_device_view, rmm::mr::get_default_resource(), stream)) {}
+
+  /**
+   * @brief Probes the retained hash table and constructs the joined table,
+   * mirroring `join_call_compute_df` with the build phase already done
+   */
+  template <detail::join_kind JoinKind>
+  std::unique_ptr<experimental::table> probe(
+      table_view const& probe,
+      std::vector<size_type> const& probe_on,
+      std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+      rmm::mr::device_memory_resource* mr,
+      cudaStream_t stream) const {
+
+    CUDF_EXPECTS (0 != probe.num_columns(), "Probe table is empty");
+    CUDF_EXPECTS (probe.num_rows() < detail::MAX_JOIN_SIZE, "Probe column size is too big");
+
+    CUDF_EXPECTS (probe_on.size() == build_on.size(), "Mismatch in number of columns to be joined on");
+
+    std::vector<size_type> const& left_on = probe_on;
+    std::vector<size_type> const& right_on = build_on;
+    CUDF_EXPECTS (std::all_of(columns_in_common.begin(), columns_in_common.end(),
+        [&left_on, &right_on](auto p){
+        size_t lind = std::find(left_on.begin(), left_on.end(), p.first) - left_on.begin();
+        size_t rind = std::find(right_on.begin(), right_on.end(), p.second) - right_on.begin();
+        return (lind != left_on.size()) && (rind != right_on.size()) && (lind == rind);
+        }
+        ),
+        "Invalid values passed to columns_in_common");
+
+    if (detail::is_trivial_join(probe, build, probe_on, build_on, JoinKind)) {
+      return detail::get_empty_joined_table(probe, build, columns_in_common);
+    }
+
+    auto const probe_selected = probe.select(probe_on);
+    CUDF_EXPECTS(std::equal(
+        std::cbegin(probe_selected), std::cend(probe_selected),
+        std::cbegin(build_selected), std::cend(build_selected),
+        [](const auto &l, const auto &r) {
+        return l.type() == r.type(); }),
+        "Mismatch in joining column data types");
+
+    detail::VectorPair joined_indices;
+    if ((JoinKind == detail::join_kind::LEFT_JOIN) && (build.num_rows() == 0)) {
+      joined_indices = detail::get_trivial_left_join_indices(probe_selected, stream);
+    } else {
+      auto probe_device_view = table_device_view::create(probe_selected, stream);
+      detail::row_equality equality{*probe_device_view, *build_device_view};
+      joined_indices = detail::probe_join_hash_table<JoinKind>(
+          *build_device_view, *probe_device_view, *hash_table, equality, false,
+          stream);
+    }
+
+    return detail::construct_join_output_df<JoinKind>(
+        probe, build, joined_indices, columns_in_common, mr, stream);
+  }
+};
+
+hash_join::hash_join(table_view const& build,
+                     std::vector<size_type> const& build_on) {
+  CUDF_FUNC_RANGE_COLOR(cudf::range_color::join);
+  CUDF_EXPECTS (0 != build.num_columns(), "Build table is empty");
+  CUDF_EXPECTS (build.num_rows() < detail::MAX_JOIN_SIZE, "Build column size is too big");
+  CUDF_EXPECTS (not build_on.empty(), "No columns to join on");
+  _impl = std::make_unique<impl>(build, build_on, 0);
+}
+
+hash_join::~hash_join() = default;
+hash_join::hash_join(hash_join&&) = default;
+hash_join& hash_join::operator=(hash_join&&) = default;
+
+std::unique_ptr<experimental::table> hash_join::inner_join(
+    table_view const& probe,
+    std::vector<size_type> const& probe_on,
+    std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+    rmm::mr::device_memory_resource* mr) const {
+  CUDF_FUNC_RANGE_COLOR(cudf::range_color::join);
+  return _impl->probe<detail::join_kind::INNER_JOIN>(
+      probe, probe_on, columns_in_common, mr, 0);
+}
+
+std::unique_ptr<experimental::table> hash_join::left_join(
+    table_view const& probe,
+    std::vector<size_type> const& probe_on,
+    std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+    rmm::mr::device_memory_resource* mr) const {
+  CUDF_FUNC_RANGE_COLOR(cudf::range_color::join);
+  return _impl->probe<detail::join_kind::LEFT_JOIN>(
+      probe, probe_on, columns_in_common, mr, 0);
+}
+
 } //namespace experimental
 
 } //namespace cudf
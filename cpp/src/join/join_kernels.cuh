@@ -106,17 +106,20 @@ __global__ void build_hash_table(multimap_type multi_map,
 * @param[out] output_size The resulting output size
   @tparam JoinKind The type of join to be performed
   @tparam multimap_type The datatype of the hash table
+  @tparam row_comparator The type of the row comparison functor used to check
+  that two rows with equal hash values are a true match
 *
 */
 /* ----------------------------------------------------------------------------*/
 template< join_kind JoinKind,
           typename multimap_type,
-          int block_size>
+          int block_size,
+          typename row_comparator>
 __global__ void compute_join_output_size( multimap_type multi_map,
                                           table_device_view build_table,
                                           table_device_view probe_table,
                                           row_hash hash_probe,
-                                          row_equality check_row_equality,
+                                          row_comparator check_row_equality,
                                           const cudf::size_type probe_table_num_rows,
                                           size_type* output_size)
 {
@@ -141,7 +144,7 @@ __global__ void compute_join_output_size( multimap_type multi_map,
     hash_value_type probe_row_hash_value{0};
     // Search the hash map for the hash value of the probe row
     probe_row_hash_value = hash_probe(probe_row_index);
-    found = multi_map.find(probe_row_hash_value, true, probe_row_hash_value);
+    found = multi_map.find_vectorized(probe_row_hash_value, true, probe_row_hash_value);
 
     // for left-joins we always need to add an output
     bool running = (JoinKind == join_kind::LEFT_JOIN) || (end != found);
@@ -260,6 +263,8 @@ void flush_output_cache(
  * @tparam multimap_type The type of the hash table
  * @tparam block_size The number of threads per block for this kernel
  * @tparam output_cache_size The side of the shared memory buffer to cache join output results
+ * @tparam row_comparator The type of the row comparison functor used to check
+ * that two rows with equal hash values are a true match
  *
  */
 /* ----------------------------------------------------------------------------*/
@@ -267,12 +272,13 @@ template< join_kind JoinKind,
           typename multimap_type,
           typename key_type,
           cudf::size_type block_size,
-          cudf::size_type output_cache_size>
+          cudf::size_type output_cache_size,
+          typename row_comparator>
 __global__ void probe_hash_table( multimap_type multi_map,
                                   table_device_view build_table,
                                   table_device_view probe_table,
                                   row_hash hash_probe,
-                                  row_equality check_row_equality,
+                                  row_comparator check_row_equality,
                                   const cudf::size_type probe_table_num_rows,
                                   size_type* join_output_l,
                                   size_type* join_output_r,
@@ -318,7 +324,7 @@ __global__ void probe_hash_table( multimap_type multi_map,
     hash_value_type probe_row_hash_value{0};
     // Search the hash map for the hash value of the probe row
     probe_row_hash_value = hash_probe(probe_row_index);
-    found = multi_map.find(probe_row_hash_value, true, probe_row_hash_value);
+    found = multi_map.find_vectorized(probe_row_hash_value, true, probe_row_hash_value);
 
     bool running = (JoinKind == join_kind::LEFT_JOIN) || (end != found);	// for left-joins we always need to add an output
     bool found_match = false;
@@ -5,7 +5,7 @@
 #include <cudf/utilities/error.hpp>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/gather.hpp>
-#include <hash/concurrent_unordered_map.cuh>
+#include <hash/unordered_row_set.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 
 #include <join/join_common_utils.hpp>
@@ -81,10 +81,9 @@ std::unique_ptr<cudf::experimental::table> left_semi_anti_join(cudf::table_view
     return std::make_unique<experimental::table>(left.select(return_columns), stream, mr);
   }
 
-  // Only care about existence, so we'll use an unordered map (other joins need a multimap)
-  using hash_table_type = concurrent_unordered_map<cudf::size_type, bool8, row_hash, row_equality>;
-
-  // Create hash table containing all keys found in right table
+  // Only care about existence, so a compact set of right row indices with no
+  // payload is enough; equal rows are deduplicated on insert, which keeps
+  // probe chains short when the right table has many duplicate keys
   auto right_rows_d = table_device_view::create(right.select(right_on), stream);
   size_t const hash_table_size = compute_hash_table_size(right.num_rows());
   row_hash hash_build{*right_rows_d};
@@ -95,23 +94,20 @@ std::unique_ptr<cudf::experimental::table> left_semi_anti_join(cudf::table_view
   row_hash hash_probe{*left_rows_d};
   row_equality equality_probe{*left_rows_d, *right_rows_d};
 
-  auto hash_table_ptr = hash_table_type::create(hash_table_size,
-                                                std::numeric_limits<bool8>::max(),
-                                                std::numeric_limits<cudf::size_type>::max(),
-                                                hash_build,
-                                                equality_build);
-  auto hash_table = *hash_table_ptr;
+  auto row_set = cudf::detail::unordered_row_set::create(hash_table_size, stream);
+  auto d_row_set = row_set.to_device();
 
   thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
                      thrust::make_counting_iterator<size_type>(0),
                      right.num_rows(),
-                     [hash_table] __device__ (size_type idx) mutable {
-                       hash_table.insert(thrust::make_pair(idx, true));
+                     [d_row_set, hash_build, equality_build] __device__ (size_type idx) mutable {
+                       d_row_set.insert(idx, hash_build, equality_build);
                      });
 
   //
-  // Now we have a hash table, we need to iterate over the rows of the left table
-  // and check to see if they are contained in the hash table
+  // Now we have a set of the right rows, we need to iterate over the rows of
+  // the left table and check to see if they are contained in the set; the
+  // existence probe directly produces the gather map for the output
   //
 
   // For semi join we want contains to be true, for anti join we want contains to be false
@@ -124,10 +120,9 @@ std::unique_ptr<cudf::experimental::table> left_semi_anti_join(cudf::table_view
                                         thrust::make_counting_iterator<size_type>(0),
                                         thrust::make_counting_iterator<size_type>(left.num_rows()),
                                         gather_map.begin(),
-                                        [hash_table, join_type_boolean, hash_probe, equality_probe]
+                                        [d_row_set, join_type_boolean, hash_probe, equality_probe]
                                         __device__ (size_type idx) {
-                                          auto pos = hash_table.find(idx, hash_probe, equality_probe);
-                                          return (pos != hash_table.end()) == join_type_boolean;
+                                          return d_row_set.contains(idx, hash_probe, equality_probe) == join_type_boolean;
                                         });
 
   return cudf::experimental::detail::gather(left.select(return_columns), gather_map.begin(), gather_map_end,
@@ -142,7 +137,7 @@ std::unique_ptr<cudf::experimental::table> left_semi_join(cudf::table_view const
                                                           std::vector<cudf::size_type> const& return_columns,
                                                           rmm::mr::device_memory_resource* mr) {
 
-  CUDF_FUNC_RANGE();
+  CUDF_FUNC_RANGE_COLOR(cudf::range_color::join);
   return detail::left_semi_anti_join<detail::join_kind::LEFT_SEMI_JOIN>(left, right, left_on, right_on, return_columns, mr, 0);
   
 
@@ -155,7 +150,7 @@ std::unique_ptr<cudf::experimental::table> left_anti_join(cudf::table_view const
                                                           std::vector<cudf::size_type> const& return_columns,
                                                           rmm::mr::device_memory_resource* mr) {
 
-  CUDF_FUNC_RANGE();
+  CUDF_FUNC_RANGE_COLOR(cudf::range_color::join);
   return detail::left_semi_anti_join<detail::join_kind::LEFT_ANTI_JOIN>(left, right, left_on, right_on, return_columns, mr, 0);
 }
 
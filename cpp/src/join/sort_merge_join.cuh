@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/table/table_view.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/row_operators.cuh>
+
+#include <join/join_common_utils.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/scan.h>
+#include <thrust/for_each.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+
+namespace experimental {
+
+namespace detail {
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Computes the inner join between two tables that are both sorted
+ * ascending on the join columns and returns the output indices of left and
+ * right table as a combined table
+ *
+ * Instead of building a hash table over the right table, every left row's
+ * range of matching right rows is located with a binary search, so no
+ * build-side scratch memory proportional to the table size is needed. The
+ * returned indices are ordered by left row index (and by right row index
+ * within a left row), so the output order is deterministic.
+ *
+ * Rows must be sorted ascending with nulls ordered before all other values;
+ * the sortedness of the inputs is not verified. Null keys compare equal to
+ * each other, matching the behavior of the hash join path.
+ *
+ * @param left  Table of left columns to join, sorted on those columns
+ * @param right Table of right columns to join, sorted on those columns
+ * @param stream stream on which all memory allocations and copies
+ * will be performed
+ *
+ * @returns Join output indices vector pair
+ */
+/* ----------------------------------------------------------------------------*/
+inline
+std::pair<rmm::device_vector<size_type>,
+rmm::device_vector<size_type>>
+get_sort_merge_inner_join_indices(
+    table_view const& left,
+    table_view const& right,
+    cudaStream_t stream) {
+
+  const size_type left_num_rows{left.num_rows()};
+  const size_type right_num_rows{right.num_rows()};
+
+  if (left_num_rows == 0 || right_num_rows == 0) {
+    return std::make_pair(rmm::device_vector<size_type>{}, rmm::device_vector<size_type>{});
+  }
+
+  auto left_table = table_device_view::create(left, stream);
+  auto right_table = table_device_view::create(right, stream);
+
+  // For each left row, locate the range of equivalent right rows; nulls are
+  // assumed to be ordered before all other values, as produced by sort_by_key
+  row_lexicographic_comparator<true> right_smaller{*right_table, *left_table};
+  row_lexicographic_comparator<true> left_smaller{*left_table, *right_table};
+
+  rmm::device_vector<size_type> match_begin(left_num_rows);
+  rmm::device_vector<size_type> match_count(left_num_rows);
+
+  thrust::lower_bound(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(right_num_rows),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(left_num_rows),
+      match_begin.begin(),
+      right_smaller);
+  thrust::upper_bound(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(right_num_rows),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(left_num_rows),
+      match_count.begin(),
+      left_smaller);
+  thrust::transform(
+      rmm::exec_policy(stream)->on(stream),
+      match_count.begin(), match_count.end(),
+      match_begin.begin(),
+      match_count.begin(),
+      thrust::minus<size_type>());
+
+  // Scan the per-row match counts into the output write offsets
+  rmm::device_vector<size_type> offsets(left_num_rows);
+  thrust::exclusive_scan(
+      rmm::exec_policy(stream)->on(stream),
+      match_count.begin(), match_count.end(),
+      offsets.begin());
+
+  const size_type join_size =
+      offsets[left_num_rows - 1] + match_count[left_num_rows - 1];
+  rmm::device_vector<size_type> left_indices(join_size);
+  rmm::device_vector<size_type> right_indices(join_size);
+
+  auto d_match_begin = match_begin.data().get();
+  auto d_match_count = match_count.data().get();
+  auto d_offsets = offsets.data().get();
+  auto d_left = left_indices.data().get();
+  auto d_right = right_indices.data().get();
+  thrust::for_each_n(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator<size_type>(0), left_num_rows,
+      [d_match_begin, d_match_count, d_offsets, d_left, d_right]
+      __device__ (size_type i) {
+        const size_type base = d_offsets[i];
+        for (size_type j = 0; j < d_match_count[i]; ++j) {
+          d_left[base + j] = i;
+          d_right[base + j] = d_match_begin[i] + j;
+        }
+      });
+
+  return std::make_pair(std::move(left_indices), std::move(right_indices));
+}
+
+}//namespace detail
+
+} //namespace experimental
+
+}//namespace cudf
@@ -15,20 +15,27 @@
  */
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
+#include <cudf/table/row_operators.cuh>
 #include <rmm/thrust_rmm_allocator.h>
+#include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/merge.cuh>
 #include <cudf/strings/detail/merge.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 
-#include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/logical.h>
 #include <thrust/tuple.h>
-#include <thrust/merge.h>
+#include <thrust/for_each.h>
 
+#include <algorithm>
+#include <numeric>
 #include <vector>
-#include <queue>
 
 
 namespace { // anonym.
@@ -141,6 +148,117 @@ void materialize_bitmask(column_view const& left_col,
   CHECK_CUDA(stream);
 }
 
+/**
+ * @brief Returns true if the two dictionary key columns hold identical rows.
+ *
+ * Dictionary columns merge by their integer codes, which is only meaningful
+ * when both sides index into the same key set.
+ */
+bool have_same_keys(column_view const& lhs_keys,
+                    column_view const& rhs_keys,
+                    cudaStream_t stream)
+{
+  if (lhs_keys.size() != rhs_keys.size()) { return false; }
+  auto lhs_device_view = table_device_view::create(table_view{{lhs_keys}}, stream);
+  auto rhs_device_view = table_device_view::create(table_view{{rhs_keys}}, stream);
+  experimental::row_equality_comparator<false> comp(*lhs_device_view, *rhs_device_view, true);
+  return thrust::all_of(rmm::exec_policy(stream)->on(stream),
+                        thrust::make_counting_iterator<size_type>(0),
+                        thrust::make_counting_iterator<size_type>(lhs_keys.size()),
+                        [comp] __device__ (size_type row) { return comp(row, row); });
+}
+
+constexpr size_type MERGE_BLOCK_SIZE{128};
+constexpr size_type MERGE_ITEMS_PER_THREAD{8};
+
+/**
+ * @brief Finds the merge-path partition point along diagonal `diag`.
+ *
+ * Returns the number of left-side rows ordered before the diagonal, i.e. the
+ * `i` in `[lo, hi]` such that the first `i` left rows and the first
+ * `diag - i` right rows together form the first `diag` rows of the merged
+ * output. Ties resolve toward the left input, keeping the merge stable.
+ *
+ * `lo` and `hi` allow narrowing the search to a known enclosing partition
+ * (e.g. the owning block's tile) instead of the full diagonal extent.
+ */
+template <typename Comparator>
+__device__ size_type merge_path_partition(size_type diag,
+                                          size_type lo,
+                                          size_type hi,
+                                          Comparator const& comp) {
+  while (lo < hi) {
+    size_type const mid = lo + (hi - lo) / 2;
+    index_type const left_elem{side::LEFT, mid};
+    index_type const right_elem{side::RIGHT, diag - mid - 1};
+    if (!comp(right_elem, left_elem)) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+/**
+ * @brief Merge-path generation of the merged row order.
+ *
+ * Rather than binary-searching both inputs once per output row, each block
+ * runs two diagonal searches to cut its tile out of the inputs, each thread
+ * runs one narrower search inside the tile, and the thread's items are then
+ * merged sequentially with a single comparison per output row. The
+ * comparators dereference the key tables directly, so the classic
+ * shared-memory staging of key values does not apply here; the win is the
+ * drop from log(n) comparator invocations per row to roughly one.
+ */
+template <typename Comparator>
+__global__ void merge_path_kernel(size_type left_size,
+                                  size_type right_size,
+                                  index_type* __restrict__ output,
+                                  Comparator comp) {
+  constexpr size_type items_per_tile = MERGE_BLOCK_SIZE * MERGE_ITEMS_PER_THREAD;
+  size_type const total_size = left_size + right_size;
+  size_type const tile_begin = static_cast<size_type>(blockIdx.x) * items_per_tile;
+  if (tile_begin >= total_size) { return; }
+  size_type const tile_end = min(tile_begin + items_per_tile, total_size);
+
+  // Partition the tile off both inputs: tile_left[0] left rows precede the
+  // tile, tile_left[1] precede its end
+  __shared__ size_type tile_left[2];
+  if (threadIdx.x < 2) {
+    size_type const diag = (threadIdx.x == 0) ? tile_begin : tile_end;
+    tile_left[threadIdx.x] = merge_path_partition(
+        diag, max(diag - right_size, 0), min(diag, left_size), comp);
+  }
+  __syncthreads();
+
+  size_type const thread_diag =
+      min(tile_begin + static_cast<size_type>(threadIdx.x) * MERGE_ITEMS_PER_THREAD,
+          tile_end);
+  size_type left_pos = merge_path_partition(
+      thread_diag,
+      max(thread_diag - right_size, tile_left[0]),
+      min(thread_diag, tile_left[1]),
+      comp);
+  size_type right_pos = thread_diag - left_pos;
+
+  size_type const thread_end = min(thread_diag + MERGE_ITEMS_PER_THREAD, tile_end);
+  for (size_type out = thread_diag; out < thread_end; ++out) {
+    bool take_left;
+    if (left_pos >= left_size) {
+      take_left = false;
+    } else if (right_pos >= right_size) {
+      take_left = true;
+    } else {
+      index_type const left_elem{side::LEFT, left_pos};
+      index_type const right_elem{side::RIGHT, right_pos};
+      take_left = !comp(right_elem, left_elem);
+    }
+    output[out] = take_left ? index_type{side::LEFT, left_pos++}
+                            : index_type{side::RIGHT, right_pos++};
+  }
+}
+
 /**
  * @brief Generates the row indices and source side (left or right) in accordance with the index columns.
  *
@@ -167,26 +285,17 @@ generate_merged_indices(table_view const& left_table,
     const size_type right_size = right_table.num_rows();
     const size_type total_size = left_size + right_size;
 
-    thrust::constant_iterator<side> left_side(side::LEFT);
-    thrust::constant_iterator<side> right_side(side::RIGHT);
-
-    auto left_indices = thrust::make_counting_iterator(static_cast<size_type>(0));
-    auto right_indices = thrust::make_counting_iterator(static_cast<size_type>(0));
-
-    auto left_begin_zip_iterator = thrust::make_zip_iterator(thrust::make_tuple(left_side, left_indices));
-    auto right_begin_zip_iterator = thrust::make_zip_iterator(thrust::make_tuple(right_side, right_indices));
-
-    auto left_end_zip_iterator = thrust::make_zip_iterator(thrust::make_tuple(left_side + left_size, left_indices + left_size));
-    auto right_end_zip_iterator = thrust::make_zip_iterator(thrust::make_tuple(right_side + right_size, right_indices + right_size));
-
     rmm::device_vector<index_type> merged_indices(total_size);
+    if (total_size == 0) { return merged_indices; }
+
+    constexpr size_type items_per_tile = MERGE_BLOCK_SIZE * MERGE_ITEMS_PER_THREAD;
+    size_type const num_tiles = (total_size + items_per_tile - 1) / items_per_tile;
 
     auto lhs_device_view = table_device_view::create(left_table, stream);
     auto rhs_device_view = table_device_view::create(right_table, stream);
 
     rmm::device_vector<order> d_column_order(column_order);
 
-    auto exec_pol = rmm::exec_policy(stream);
     if (nullable)
     {
       rmm::device_vector<null_order> d_null_precedence(null_precedence);
@@ -196,13 +305,8 @@ generate_merged_indices(table_view const& left_table,
                                                                         *rhs_device_view,
                                                                         d_column_order.data().get(),
                                                                         d_null_precedence.data().get());
-        thrust::merge(exec_pol->on(stream),
-                      left_begin_zip_iterator,
-                      left_end_zip_iterator,
-                      right_begin_zip_iterator,
-                      right_end_zip_iterator,
-                      merged_indices.begin(),
-                      ineq_op);
+        merge_path_kernel<<<num_tiles, MERGE_BLOCK_SIZE, 0, stream>>>(
+            left_size, right_size, merged_indices.data().get(), ineq_op);
     }
     else
     {
@@ -210,13 +314,8 @@ generate_merged_indices(table_view const& left_table,
         experimental::detail::row_lexicographic_tagged_comparator<false>(*lhs_device_view,
                                                                          *rhs_device_view,
                                                                          d_column_order.data().get());
-        thrust::merge(exec_pol->on(stream),
-                      left_begin_zip_iterator,
-                      left_end_zip_iterator,
-                      right_begin_zip_iterator,
-                      right_end_zip_iterator,
-                      merged_indices.begin(),
-                      ineq_op);
+        merge_path_kernel<<<num_tiles, MERGE_BLOCK_SIZE, 0, stream>>>(
+            left_size, right_size, merged_indices.data().get(), ineq_op);
     }
 
     CHECK_CUDA(stream);
@@ -352,7 +451,29 @@ template<>
 std::unique_ptr<column> column_merger::operator()<cudf::dictionary32>(column_view const& lcol,
                                                                           column_view const& rcol) const
 {
-  CUDF_FAIL("dictionary not supported yet");
+  dictionary_column_view l_dict(lcol);
+  dictionary_column_view r_dict(rcol);
+
+  //the int32 codes merge like any other fixed-width column; detail::merge
+  //has already verified both sides carry identical keys so the codes are
+  //directly comparable
+  //
+  auto merged_indices = this->template operator()<int32_t>(l_dict.get_indices_annotated(),
+                                                           r_dict.get_indices_annotated());
+
+  //split the merged null mask off the codes and attach it to the parent
+  //
+  auto const null_count = lcol.null_count() + rcol.null_count();
+  auto contents = merged_indices->release();
+  auto indices_column = std::make_unique<column>(data_type{INT32},
+                                                 lcol.size() + rcol.size(),
+                                                 std::move(*contents.data));
+
+  return make_dictionary_column(std::make_unique<column>(l_dict.keys(), stream_, mr_),
+                                std::move(indices_column),
+                                contents.null_mask ? std::move(*contents.null_mask)
+                                                   : rmm::device_buffer{},
+                                null_count);
 }
 
 using table_ptr_type = std::unique_ptr<cudf::experimental::table>;
@@ -367,9 +488,23 @@ table_ptr_type merge(cudf::table_view const& left_table,
                      rmm::mr::device_memory_resource* mr,
                      cudaStream_t stream = 0) {
     //collect index columns for lhs, rhs, resp.
+    //dictionary key columns compare by their int32 codes; detail::merge has
+    //already verified the inputs share the same sorted key sets
     //
-    cudf::table_view index_left_view{left_table.select(key_cols)};
-    cudf::table_view index_right_view{right_table.select(key_cols)};
+    std::vector<cudf::column_view> left_key_columns;
+    std::vector<cudf::column_view> right_key_columns;
+    for (auto const key : key_cols) {
+      auto lcol = left_table.column(key);
+      auto rcol = right_table.column(key);
+      if (lcol.type().id() == cudf::type_id::DICTIONARY32) {
+        lcol = cudf::dictionary_column_view(lcol).get_indices_annotated();
+        rcol = cudf::dictionary_column_view(rcol).get_indices_annotated();
+      }
+      left_key_columns.push_back(lcol);
+      right_key_columns.push_back(rcol);
+    }
+    cudf::table_view index_left_view{left_key_columns};
+    cudf::table_view index_right_view{right_key_columns};
     bool const nullable = cudf::has_nulls(index_left_view) || cudf::has_nulls(index_right_view);
 
     //extract merged row order according to indices:
@@ -397,27 +532,109 @@ table_ptr_type merge(cudf::table_view const& left_table,
     return std::make_unique<cudf::experimental::table>(std::move(merged_cols));
 }
 
-struct merge_queue_item {
-  table_view view;
-  table_ptr_type table;
-  // Priority is a separate member to ensure that moving from an object 
-  // does not change its priority (which would ruin the queue invariant)
-  cudf::size_type priority = 0;
- 
-  merge_queue_item(table_view const& view, table_ptr_type&& table):
-    view{view}, table{std::move(table)}, priority{-view.num_rows()} {}
- 
-  bool operator<(merge_queue_item const& other) const {
-      return priority < other.priority;
+// Computes, for each row of the concatenation of k sorted tables, its
+// position in the fully merged output and scatters the row's concatenated
+// index there, producing a gather map for the merged result.
+//
+// Each input table occupies the contiguous, already sorted range
+// [d_range_offsets[t], d_range_offsets[t+1]) of the concatenated key table.
+// A row's output position is its position within its own range plus, for
+// every other range, the count of rows ordered before it found by binary
+// search. Ties are broken by input order: rows from earlier tables come
+// first, matching the pairwise merge.
+template <bool has_nulls>
+struct kway_merge_position_fn {
+  row_lexicographic_comparator<has_nulls> comp;
+  size_type const* d_range_offsets;
+  size_type num_tables;
+  size_type* d_gather_map;
+
+  __device__ void operator()(size_type row_index) const {
+    size_type table_index = 0;
+    while (row_index >= d_range_offsets[table_index + 1]) {
+      ++table_index;
+    }
+    size_type position = row_index - d_range_offsets[table_index];
+    for (size_type other = 0; other < num_tables; ++other) {
+      if (other == table_index) { continue; }
+      size_type lower = d_range_offsets[other];
+      size_type upper = d_range_offsets[other + 1];
+      while (lower < upper) {
+        size_type const mid = lower + (upper - lower) / 2;
+        bool const ordered_before = (other < table_index)
+                                        ? !comp(row_index, mid)
+                                        : comp(mid, row_index);
+        if (ordered_before) {
+          lower = mid + 1;
+        } else {
+          upper = mid;
+        }
+      }
+      position += lower - d_range_offsets[other];
+    }
+    d_gather_map[position] = row_index;
   }
 };
 
-// Helper function to ensure that moving out of the priority_queue is "atomic"
-template <typename T>
-T top_and_pop(std::priority_queue<T>& q){
-  auto moved = std::move(const_cast<T&>(q.top()));
-  q.pop();
-  return moved;
+// Merges k sorted tables in a single pass: the inputs are concatenated once,
+// the merged gather map is computed with one kernel over the concatenated
+// keys, and the output is materialized with one gather. This avoids the
+// log2(k) rounds of pairwise merging (and their repeated passes over the
+// data) that the merge queue performs.
+table_ptr_type merge_kway(std::vector<table_view> const& tables_to_merge,
+                          std::vector<cudf::size_type> const& key_cols,
+                          std::vector<cudf::order> const& column_order,
+                          std::vector<cudf::null_order> const& null_precedence,
+                          rmm::mr::device_memory_resource* mr,
+                          cudaStream_t stream = 0) {
+    auto const num_tables = static_cast<size_type>(tables_to_merge.size());
+
+    std::vector<size_type> h_range_offsets(num_tables + 1, 0);
+    std::transform(tables_to_merge.begin(), tables_to_merge.end(),
+                   h_range_offsets.begin() + 1,
+                   [](auto const& tbl) { return tbl.num_rows(); });
+    std::partial_sum(h_range_offsets.begin(), h_range_offsets.end(),
+                     h_range_offsets.begin());
+    auto const total_rows = h_range_offsets.back();
+
+    auto concatenated = cudf::experimental::concatenate(tables_to_merge);
+    auto const concatenated_keys = concatenated->view().select(key_cols);
+
+    rmm::device_vector<size_type> d_range_offsets(h_range_offsets);
+    rmm::device_vector<size_type> d_gather_map(total_rows);
+    rmm::device_vector<order> d_column_order(column_order);
+
+    auto keys_device_view = table_device_view::create(concatenated_keys, stream);
+
+    auto exec_pol = rmm::exec_policy(stream);
+    if (cudf::has_nulls(concatenated_keys)) {
+      rmm::device_vector<null_order> d_null_precedence(null_precedence);
+      auto comp = row_lexicographic_comparator<true>(*keys_device_view,
+                                                     *keys_device_view,
+                                                     d_column_order.data().get(),
+                                                     d_null_precedence.data().get());
+      thrust::for_each_n(exec_pol->on(stream),
+                         thrust::make_counting_iterator<size_type>(0), total_rows,
+                         kway_merge_position_fn<true>{comp,
+                                                      d_range_offsets.data().get(),
+                                                      num_tables,
+                                                      d_gather_map.data().get()});
+    } else {
+      auto comp = row_lexicographic_comparator<false>(*keys_device_view,
+                                                      *keys_device_view,
+                                                      d_column_order.data().get());
+      thrust::for_each_n(exec_pol->on(stream),
+                         thrust::make_counting_iterator<size_type>(0), total_rows,
+                         kway_merge_position_fn<false>{comp,
+                                                       d_range_offsets.data().get(),
+                                                       num_tables,
+                                                       d_gather_map.data().get()});
+    }
+    CHECK_CUDA(stream);
+
+    column_view gather_map_view(data_type{experimental::type_to_id<size_type>()},
+                                total_rows, d_gather_map.data().get());
+    return gather(concatenated->view(), gather_map_view, false, false, false, mr, stream);
 }
 
 } // anonym. namespace
@@ -449,45 +666,70 @@ table_ptr_type merge(std::vector<table_view> const& tables_to_merge,
  
     CUDF_EXPECTS(key_cols.size() == column_order.size(),
                  "Mismatched size between key_cols and column_order");
- 
-    // A queue of (table view, table) pairs
-    std::priority_queue<merge_queue_item> merge_queue;
-    // The table pointer is null if we do not own the table (input tables)
-    std::for_each(tables_to_merge.begin(), 
-                  tables_to_merge.end(), 
-                  [&](auto const& table) { 
-                    if (table.num_rows() > 0)
-                      merge_queue.emplace(table, table_ptr_type()); 
-                  });
+
+    // dictionary columns merge by comparing their int32 codes, which is only
+    // valid when every input carries the same key set; key columns must
+    // additionally have sorted keys (as `set_keys` guarantees) so the codes
+    // order the same way the decoded values would
+    bool has_dictionaries = false;
+    for (size_type col = 0; col < n_cols; ++col) {
+      if (first_table.column(col).type().id() != type_id::DICTIONARY32) { continue; }
+      has_dictionaries = true;
+      auto const first_keys = dictionary_column_view(first_table.column(col)).keys();
+      if (std::find(key_cols.begin(), key_cols.end(), col) != key_cols.end()) {
+        CUDF_EXPECTS(cudf::experimental::is_sorted(table_view{{first_keys}},
+                                                   {order::ASCENDING}, {}),
+                     "dictionary keys must be sorted to merge by index codes");
+      }
+      CUDF_EXPECTS(std::all_of(std::next(tables_to_merge.cbegin()), tables_to_merge.cend(),
+                   [&](auto const& tbl) {
+                     return have_same_keys(first_keys,
+                                           dictionary_column_view(tbl.column(col)).keys(),
+                                           stream);
+                   }),
+                   "dictionary columns must have matching keys to merge");
+    }
+
+    std::vector<table_view> non_empty_tables;
+    std::copy_if(tables_to_merge.begin(), tables_to_merge.end(),
+                 std::back_inserter(non_empty_tables),
+                 [](auto const& table) { return table.num_rows() > 0; });
 
     // If there is only one non-empty table_view, return its copy
-    if (merge_queue.size() == 1) {
-      return std::make_unique<cudf::experimental::table>(merge_queue.top().view);
+    if (non_empty_tables.size() == 1) {
+      return std::make_unique<cudf::experimental::table>(non_empty_tables.front());
     }
     // No inputs have rows, return a table with same columns as the first one
-    if (merge_queue.empty()) {
+    if (non_empty_tables.empty()) {
       return empty_like(first_table);
     }
-    
-    // Pick the two smallest tables and merge them
-    // Until there is only one table left in the queue
-    while (merge_queue.size() > 1) {
-      // To delete the intermediate table at the end of the block
-      auto const left_table = top_and_pop(merge_queue);
-      // Deallocated at the end of the block
-      auto const right_table = top_and_pop(merge_queue);
-      auto merged_table = merge(left_table.view, 
-                                right_table.view, 
-                                key_cols, 
-                                column_order, 
-                                null_precedence, 
-                                mr, 
-                                stream);
-      auto const merged_table_view = merged_table->view();
-      merge_queue.emplace(merged_table_view, std::move(merged_table));
+    // Two tables merge directly in a single merge-path pass
+    if (non_empty_tables.size() == 2) {
+      return merge(non_empty_tables.front(),
+                   non_empty_tables.back(),
+                   key_cols,
+                   column_order,
+                   null_precedence,
+                   mr,
+                   stream);
     }
 
-    return std::move(top_and_pop(merge_queue).table);
+    // More than two tables merge in one k-way pass rather than in
+    // log2(k) rounds of pairwise merges; dictionary columns take the
+    // pairwise path since the k-way pass concatenates its inputs first
+    if (!has_dictionaries) {
+      return merge_kway(non_empty_tables, key_cols, column_order, null_precedence, mr, stream);
+    }
+
+    auto merged = merge(non_empty_tables[0], non_empty_tables[1], key_cols, column_order,
+                        null_precedence, rmm::mr::get_default_resource(), stream);
+    for (std::size_t i = 2; i < non_empty_tables.size(); ++i) {
+      auto* resource = (i + 1 == non_empty_tables.size()) ? mr
+                                                          : rmm::mr::get_default_resource();
+      merged = merge(merged->view(), non_empty_tables[i], key_cols, column_order,
+                     null_precedence, resource, stream);
+    }
+    return merged;
 }
  
 }  // namespace detail
@@ -498,7 +740,16 @@ std::unique_ptr<cudf::experimental::table> merge(std::vector<table_view> const&
                                                  std::vector<cudf::null_order> const& null_precedence,
                                                  rmm::mr::device_memory_resource* mr){
   CUDF_FUNC_RANGE();
-  return detail::merge(tables_to_merge, key_cols, column_order, null_precedence, mr);
+  auto result = detail::merge(tables_to_merge, key_cols, column_order, null_precedence, mr);
+  // the leading key column of the merged output is globally sorted; record
+  // that so downstream operations need not re-validate it
+  if (result->num_columns() > 0 && !key_cols.empty()) {
+    result->get_column(key_cols.front()).set_ordering(order_metadata{
+        sorted::YES,
+        column_order.front(),
+        null_precedence.empty() ? null_order::BEFORE : null_precedence.front()});
+  }
+  return result;
 }
  
 }  // namespace experimental
@@ -17,16 +17,21 @@
 
 #include <quantiles/quantiles_util.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/table/row_operators.cuh>
+#include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <rmm/thrust_rmm_allocator.h>
 
 
+#include <algorithm>
 #include <memory>
+#include <thrust/for_each.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/counting_iterator.h>
 
@@ -97,7 +102,113 @@ struct quantile_functor
     }
 };
 
+/**
+ * @brief Computes one quantile of one pre-sorted column on the device.
+ */
+struct typed_column_quantile
+{
+    template<typename T, std::enable_if_t<std::is_arithmetic<T>::value>* = nullptr>
+    __device__ ScalarResult operator()(column_device_view const& col,
+                                       size_type begin,
+                                       size_type valid_count,
+                                       double q,
+                                       interpolation interp)
+    {
+        auto selector = [&](size_type location) {
+            return col.element<T>(begin + location);
+        };
+        return select_quantile<ScalarResult>(selector, valid_count, q, interp);
+    }
+
+    template<typename T, std::enable_if_t<not std::is_arithmetic<T>::value>* = nullptr>
+    __device__ ScalarResult operator()(column_device_view const&,
+                                       size_type,
+                                       size_type,
+                                       double,
+                                       interpolation)
+    {
+        release_assert(false && "Only numeric types are supported in quantiles.");
+        return ScalarResult{};
+    }
+};
+
+/**
+ * @brief Computes element (column, quantile) of the batched result; one
+ * thread per output element so every column and quantile is covered by a
+ * single launch.
+ */
+struct batched_quantile_fn
+{
+    table_device_view input;
+    mutable_table_device_view output;
+    double const* q;
+    size_type num_q;
+    null_order null_precedence;
+    interpolation interp;
+
+    __device__ void operator()(size_type i)
+    {
+        auto const col_index = i / num_q;
+        auto const q_index = i % num_q;
+        auto const col = input.column(col_index);
+        auto const valid_count = col.size() - col.null_count();
+
+        // All-null columns were created all-null on the host; nothing to write
+        if (valid_count == 0) { return; }
+
+        auto const begin = null_precedence == null_order::BEFORE
+            ? col.null_count() : size_type{0};
+
+        output.column(col_index).element<ScalarResult>(q_index) =
+            type_dispatcher(col.type(), typed_column_quantile{},
+                            col, begin, valid_count, q[q_index], interp);
+    }
+};
+
 } // anonymous namespace
+
+std::unique_ptr<table>
+column_quantiles(table_view const& input,
+                 std::vector<double> const& q,
+                 interpolation interp,
+                 null_order null_precedence,
+                 rmm::mr::device_memory_resource* mr,
+                 cudaStream_t stream = 0)
+{
+    CUDF_EXPECTS(std::all_of(input.begin(), input.end(),
+        [](auto const& col) { return is_numeric(col.type()); }),
+        "Only numeric types are supported in quantiles.");
+
+    auto const num_q = static_cast<size_type>(q.size());
+
+    std::vector<std::unique_ptr<column>> columns;
+    columns.reserve(input.num_columns());
+    for (auto const& col : input) {
+        auto const all_null = col.size() == col.null_count();
+        columns.push_back(make_numeric_column(
+            data_type{FLOAT64}, num_q,
+            all_null ? mask_state::ALL_NULL : mask_state::UNALLOCATED,
+            stream, mr));
+    }
+    auto result = std::make_unique<table>(std::move(columns));
+
+    if (input.num_columns() == 0 || num_q == 0) { return result; }
+
+    rmm::device_vector<double> q_device{q};
+    auto device_input = table_device_view::create(input, stream);
+    auto result_view = result->mutable_view();
+    auto device_output = mutable_table_device_view::create(result_view, stream);
+
+    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+        thrust::make_counting_iterator<size_type>(0),
+        input.num_columns() * num_q,
+        batched_quantile_fn{*device_input, *device_output,
+                            q_device.data().get(), num_q,
+                            null_precedence, interp});
+
+    return result;
+}
+
 } // namespace detail
 
 std::unique_ptr<scalar>
@@ -111,5 +222,16 @@ quantile(column_view const& input,
                          interp, column_order);
 }
 
+std::unique_ptr<table>
+column_quantiles(table_view const& input,
+                 std::vector<double> const& q,
+                 interpolation interp,
+                 null_order null_precedence,
+                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::column_quantiles(input, q, interp, null_precedence, mr);
+}
+
 } // namespace experimental
 } // namespace cudf
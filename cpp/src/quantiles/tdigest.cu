@@ -0,0 +1,352 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/quantiles.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/copy.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace cudf {
+namespace experimental {
+
+// device-side state of a sketch: centroids sorted by mean
+struct tdigest::impl {
+  rmm::device_vector<double> means;    ///< Centroid means, ascending
+  rmm::device_vector<double> weights;  ///< Number of elements per centroid
+  double total_weight = 0;             ///< Number of summarized elements
+  double minimum = 0;                  ///< Smallest summarized value
+  double maximum = 0;                  ///< Largest summarized value
+  size_type max_centroids = 0;         ///< Compression bound
+};
+
+namespace {
+
+constexpr double tdigest_pi = 3.14159265358979323846;
+
+/**
+ * @brief Maps a quantile position to a centroid cluster index.
+ *
+ * Uses the t-digest scale function `k(q) = delta/2pi * asin(2q-1)` so
+ * clusters are smallest (most accurate) near q=0 and q=1.
+ */
+__device__ inline cudf::size_type scale_cluster_index(double q,
+                                                      cudf::size_type max_centroids) {
+  q = fmin(fmax(q, 0.0), 1.0);
+  auto const k = (asin(2.0 * q - 1.0) / tdigest_pi + 0.5) * max_centroids;
+  auto const cluster = static_cast<cudf::size_type>(k);
+  return cluster >= max_centroids ? max_centroids - 1 : cluster;
+}
+
+/**
+ * @brief Compresses sorted, weighted values into at most `max_centroids`
+ * centroids, replacing the contents of `state`.
+ *
+ * The values must be ascending; weights carry the element count each
+ * value represents (1 for raw input, larger when merging sketches).
+ */
+void cluster_centroids(rmm::device_vector<double> const& values,
+                       rmm::device_vector<double> const& value_weights,
+                       tdigest::impl* state, cudaStream_t stream) {
+  auto const count = static_cast<size_type>(values.size());
+  auto execpol = rmm::exec_policy(stream);
+
+  // quantile position of each value's weight midpoint
+  rmm::device_vector<double> cumulative(count);
+  thrust::inclusive_scan(execpol->on(stream), value_weights.begin(),
+                         value_weights.end(), cumulative.begin());
+  double const total = cumulative.back();
+
+  rmm::device_vector<size_type> cluster_ids(count);
+  auto d_cumulative = cumulative.data().get();
+  auto d_weights = value_weights.data().get();
+  auto const max_centroids = state->max_centroids;
+  thrust::transform(execpol->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(count),
+                    cluster_ids.begin(),
+                    [d_cumulative, d_weights, total, max_centroids] __device__(size_type idx) {
+                      auto const midpoint = d_cumulative[idx] - d_weights[idx] / 2.0;
+                      return scale_cluster_index(midpoint / total, max_centroids);
+                    });
+
+  // weighted mean and total weight per cluster
+  rmm::device_vector<double> weighted_values(count);
+  auto d_values = values.data().get();
+  thrust::transform(execpol->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(count),
+                    weighted_values.begin(),
+                    [d_values, d_weights] __device__(size_type idx) {
+                      return d_values[idx] * d_weights[idx];
+                    });
+
+  rmm::device_vector<size_type> cluster_keys(count);
+  rmm::device_vector<double> cluster_means(count);
+  rmm::device_vector<double> cluster_weights(count);
+  auto weights_end = thrust::reduce_by_key(
+      execpol->on(stream), cluster_ids.begin(), cluster_ids.end(),
+      value_weights.begin(), cluster_keys.begin(), cluster_weights.begin());
+  auto const num_clusters =
+      static_cast<size_type>(thrust::distance(cluster_weights.begin(), weights_end.second));
+  thrust::reduce_by_key(execpol->on(stream), cluster_ids.begin(), cluster_ids.end(),
+                        weighted_values.begin(), cluster_keys.begin(),
+                        cluster_means.begin());
+
+  auto d_cluster_means = cluster_means.data().get();
+  auto d_cluster_weights = cluster_weights.data().get();
+  thrust::transform(execpol->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_clusters),
+                    cluster_means.begin(),
+                    [d_cluster_means, d_cluster_weights] __device__(size_type idx) {
+                      return d_cluster_means[idx] / d_cluster_weights[idx];
+                    });
+
+  cluster_means.resize(num_clusters);
+  cluster_weights.resize(num_clusters);
+  state->means = std::move(cluster_means);
+  state->weights = std::move(cluster_weights);
+  state->total_weight = total;
+  state->minimum = values.front();
+  state->maximum = values.back();
+}
+
+/**
+ * @brief Extracts the valid elements of a numeric column as sorted doubles.
+ */
+struct sorted_doubles_fn {
+  template <typename T, std::enable_if_t<std::is_arithmetic<T>::value>* = nullptr>
+  rmm::device_vector<double> operator()(column_view const& input,
+                                        cudaStream_t stream) {
+    auto execpol = rmm::exec_policy(stream);
+    rmm::device_vector<double> values(input.size());
+    if (input.has_nulls()) {
+      auto column = column_device_view::create(input, stream);
+      auto d_column = *column;
+      auto values_end = thrust::copy_if(
+          execpol->on(stream), thrust::make_counting_iterator<size_type>(0),
+          thrust::make_counting_iterator<size_type>(input.size()), values.begin(),
+          [d_column] __device__(size_type idx) { return d_column.is_valid(idx); });
+      // the predicate above copies indices; convert the kept ones in place
+      auto const valid_count =
+          static_cast<size_type>(thrust::distance(values.begin(), values_end));
+      auto d_values = values.data().get();
+      thrust::transform(execpol->on(stream), values.begin(), values_end,
+                        values.begin(),
+                        [d_column] __device__(double stored_idx) {
+                          return static_cast<double>(d_column.element<T>(
+                              static_cast<size_type>(stored_idx)));
+                        });
+      values.resize(valid_count);
+    } else {
+      thrust::transform(execpol->on(stream), input.begin<T>(), input.end<T>(),
+                        values.begin(),
+                        [] __device__(T value) { return static_cast<double>(value); });
+    }
+    thrust::sort(execpol->on(stream), values.begin(), values.end());
+    return values;
+  }
+  template <typename T, std::enable_if_t<not std::is_arithmetic<T>::value>* = nullptr>
+  rmm::device_vector<double> operator()(column_view const&, cudaStream_t) {
+    CUDF_FAIL("tdigest only supports numeric columns");
+  }
+};
+
+/**
+ * @brief Builds sketch state from a column in one pass over the batch.
+ */
+std::unique_ptr<tdigest::impl> build_tdigest(column_view const& input,
+                                             size_type max_centroids,
+                                             cudaStream_t stream) {
+  CUDF_EXPECTS(max_centroids > 0, "max_centroids must be positive");
+  auto state = std::make_unique<tdigest::impl>();
+  state->max_centroids = max_centroids;
+  if (input.size() == input.null_count()) {
+    return state;  // empty sketch
+  }
+  auto values = experimental::type_dispatcher(input.type(), sorted_doubles_fn{},
+                                              input, stream);
+  rmm::device_vector<double> weights(values.size(), 1.0);
+  cluster_centroids(values, weights, state.get(), stream);
+  return state;
+}
+
+/**
+ * @brief Interpolates a quantile value from sorted centroids.
+ */
+struct quantile_query_fn {
+  double const* d_means;      ///< Centroid means, ascending
+  double const* d_midpoints;  ///< Cumulative weight midpoint per centroid
+  size_type num_centroids;
+  double total_weight;
+  double minimum;
+  double maximum;
+
+  __device__ double operator()(double q) const {
+    q = fmin(fmax(q, 0.0), 1.0);
+    auto const target = q * total_weight;
+    if (target <= d_midpoints[0]) {
+      auto const span = d_midpoints[0];
+      return span <= 0 ? d_means[0]
+                       : minimum + (target / span) * (d_means[0] - minimum);
+    }
+    if (target >= d_midpoints[num_centroids - 1]) {
+      auto const span = total_weight - d_midpoints[num_centroids - 1];
+      return span <= 0 ? d_means[num_centroids - 1]
+                       : d_means[num_centroids - 1] +
+                             ((target - d_midpoints[num_centroids - 1]) / span) *
+                                 (maximum - d_means[num_centroids - 1]);
+    }
+    // binary search for the bracketing centroids
+    size_type lower = 0;
+    size_type upper = num_centroids - 1;
+    while (lower + 1 < upper) {
+      auto const mid = lower + (upper - lower) / 2;
+      if (d_midpoints[mid] <= target) {
+        lower = mid;
+      } else {
+        upper = mid;
+      }
+    }
+    auto const span = d_midpoints[upper] - d_midpoints[lower];
+    return span <= 0 ? d_means[lower]
+                     : d_means[lower] + ((target - d_midpoints[lower]) / span) *
+                                            (d_means[upper] - d_means[lower]);
+  }
+};
+
+/**
+ * @brief Reads approximate quantile values from sketch state.
+ */
+std::unique_ptr<column> query_tdigest(tdigest::impl const* state,
+                                      std::vector<double> const& q,
+                                      rmm::mr::device_memory_resource* mr,
+                                      cudaStream_t stream) {
+  auto const num_queries = static_cast<size_type>(q.size());
+  if (state->total_weight <= 0) {
+    return make_numeric_column(data_type{FLOAT64}, num_queries,
+                               mask_state::ALL_NULL, stream, mr);
+  }
+  auto results = make_numeric_column(data_type{FLOAT64}, num_queries,
+                                     mask_state::UNALLOCATED, stream, mr);
+  if (num_queries == 0) {
+    return results;
+  }
+  auto execpol = rmm::exec_policy(stream);
+  auto const num_centroids = static_cast<size_type>(state->means.size());
+
+  // cumulative weight midpoint of each centroid
+  rmm::device_vector<double> midpoints(num_centroids);
+  thrust::inclusive_scan(execpol->on(stream), state->weights.begin(),
+                         state->weights.end(), midpoints.begin());
+  auto d_midpoints = midpoints.data().get();
+  auto d_weights = state->weights.data().get();
+  thrust::transform(execpol->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_centroids),
+                    midpoints.begin(),
+                    [d_midpoints, d_weights] __device__(size_type idx) {
+                      return d_midpoints[idx] - d_weights[idx] / 2.0;
+                    });
+
+  rmm::device_vector<double> d_q(q);
+  thrust::transform(execpol->on(stream), d_q.begin(), d_q.end(),
+                    results->mutable_view().begin<double>(),
+                    quantile_query_fn{state->means.data().get(), d_midpoints,
+                                      num_centroids, state->total_weight,
+                                      state->minimum, state->maximum});
+  return results;
+}
+
+/**
+ * @brief Merges the centroids of `other` into `state` and re-compresses.
+ */
+void merge_tdigest(tdigest::impl* state, tdigest::impl const* other,
+                   cudaStream_t stream) {
+  if (other->total_weight <= 0) {
+    return;
+  }
+  if (state->total_weight <= 0) {
+    state->means = other->means;
+    state->weights = other->weights;
+    state->total_weight = other->total_weight;
+    state->minimum = other->minimum;
+    state->maximum = other->maximum;
+    return;
+  }
+  auto execpol = rmm::exec_policy(stream);
+  auto const count =
+      static_cast<size_type>(state->means.size() + other->means.size());
+  rmm::device_vector<double> means(count);
+  rmm::device_vector<double> weights(count);
+  thrust::copy(execpol->on(stream), state->means.begin(), state->means.end(),
+               means.begin());
+  thrust::copy(execpol->on(stream), other->means.begin(), other->means.end(),
+               means.begin() + state->means.size());
+  thrust::copy(execpol->on(stream), state->weights.begin(), state->weights.end(),
+               weights.begin());
+  thrust::copy(execpol->on(stream), other->weights.begin(), other->weights.end(),
+               weights.begin() + state->weights.size());
+  thrust::sort_by_key(execpol->on(stream), means.begin(), means.end(),
+                      weights.begin());
+
+  auto const minimum = std::min(state->minimum, other->minimum);
+  auto const maximum = std::max(state->maximum, other->maximum);
+  cluster_centroids(means, weights, state, stream);
+  state->minimum = minimum;
+  state->maximum = maximum;
+}
+
+}  // namespace
+
+tdigest::tdigest(column_view const& input, size_type max_centroids)
+    : _impl(build_tdigest(input, max_centroids, static_cast<cudaStream_t>(0))) {}
+
+tdigest::~tdigest() = default;
+tdigest::tdigest(tdigest&&) = default;
+tdigest& tdigest::operator=(tdigest&&) = default;
+
+size_type tdigest::size() const {
+  return static_cast<size_type>(_impl->means.size());
+}
+
+void tdigest::merge(tdigest const& other) {
+  merge_tdigest(_impl.get(), other._impl.get(), static_cast<cudaStream_t>(0));
+}
+
+std::unique_ptr<column> tdigest::quantiles(
+    std::vector<double> const& q, rmm::mr::device_memory_resource* mr) const {
+  return query_tdigest(_impl.get(), q, mr, static_cast<cudaStream_t>(0));
+}
+
+tdigest::impl* tdigest::get_impl() const { return _impl.get(); }
+
+}  // namespace experimental
+}  // namespace cudf
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+// The translation unit for batched multi-column reductions
+
+#include <cudf/reduction.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <limits>
+#include <vector>
+
+namespace cudf {
+namespace experimental {
+namespace detail {
+
+namespace { // anonymous
+
+/**
+ * @brief Reads one element of any numeric column as a double.
+ *
+ * Batching heterogeneous columns into a single kernel requires a common
+ * accumulation type, so all arithmetic is performed in double precision.
+ */
+__device__ double element_as_double(column_device_view const& col, size_type row)
+{
+  switch (col.type().id()) {
+    case INT8:    return static_cast<double>(col.element<int8_t>(row));
+    case INT16:   return static_cast<double>(col.element<int16_t>(row));
+    case INT32:   return static_cast<double>(col.element<int32_t>(row));
+    case INT64:   return static_cast<double>(col.element<int64_t>(row));
+    case FLOAT32: return static_cast<double>(col.element<float>(row));
+    case FLOAT64: return col.element<double>(row);
+    case BOOL8:   return col.element<bool8>(row) ? 1.0 : 0.0;
+    default:      return 0.0;
+  }
+}
+
+__device__ double reduction_identity(aggregation::Kind kind)
+{
+  switch (kind) {
+    case aggregation::PRODUCT: return 1.0;
+    case aggregation::MIN:     return std::numeric_limits<double>::max();
+    case aggregation::MAX:     return std::numeric_limits<double>::lowest();
+    default:                   return 0.0; // SUM, MEAN, SUM_OF_SQUARES
+  }
+}
+
+__device__ double combine(aggregation::Kind kind, double lhs, double rhs)
+{
+  switch (kind) {
+    case aggregation::PRODUCT: return lhs * rhs;
+    case aggregation::MIN:     return lhs < rhs ? lhs : rhs;
+    case aggregation::MAX:     return lhs > rhs ? lhs : rhs;
+    default:                   return lhs + rhs; // SUM, MEAN, SUM_OF_SQUARES
+  }
+}
+
+/**
+ * @brief Reduces every column of `input` in one launch, one block per column.
+ *
+ * Each block grid-strides its column with per-thread accumulators, then tree
+ * reduces through shared memory. Thread 0 writes the column's result (and,
+ * for MEAN, divides by the valid count) and sets the row's validity.
+ */
+template <int block_size>
+__launch_bounds__(block_size)
+__global__
+void batched_reduction_kernel(table_device_view input,
+                              aggregation::Kind const* kinds,
+                              mutable_column_device_view output)
+{
+  __shared__ double block_values[block_size];
+  __shared__ size_type block_counts[block_size];
+
+  column_device_view const col = input.column(blockIdx.x);
+  aggregation::Kind const kind = kinds[blockIdx.x];
+
+  double acc = reduction_identity(kind);
+  size_type count = 0;
+
+  for (size_type i = threadIdx.x; i < col.size(); i += block_size) {
+    if (col.nullable() && !col.is_valid_nocheck(i)) { continue; }
+    double val = element_as_double(col, i);
+    if (kind == aggregation::SUM_OF_SQUARES) { val = val * val; }
+    acc = combine(kind, acc, val);
+    ++count;
+  }
+
+  block_values[threadIdx.x] = acc;
+  block_counts[threadIdx.x] = count;
+  __syncthreads();
+
+  for (int stride = block_size / 2; stride > 0; stride /= 2) {
+    if (threadIdx.x < stride) {
+      block_values[threadIdx.x] =
+        combine(kind, block_values[threadIdx.x], block_values[threadIdx.x + stride]);
+      block_counts[threadIdx.x] += block_counts[threadIdx.x + stride];
+    }
+    __syncthreads();
+  }
+
+  if (threadIdx.x == 0) {
+    double result = block_values[0];
+    size_type const valid_count = block_counts[0];
+    if (kind == aggregation::MEAN) { result /= valid_count; }
+    output.element<double>(blockIdx.x) = result;
+    if (valid_count > 0) {
+      output.set_valid(blockIdx.x);
+    } else {
+      output.set_null(blockIdx.x);
+    }
+  }
+}
+
+} // namespace anonymous
+
+std::unique_ptr<column> batched_reduce(
+    table_view const& input,
+    std::vector<std::unique_ptr<aggregation>> const& aggs,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream = 0)
+{
+  CUDF_EXPECTS(static_cast<size_type>(aggs.size()) == input.num_columns(),
+               "Number of aggregations must match number of columns");
+
+  std::vector<aggregation::Kind> kinds(aggs.size());
+  for (size_t i = 0; i < aggs.size(); ++i) {
+    auto const kind = aggs[i]->kind;
+    CUDF_EXPECTS(kind == aggregation::SUM || kind == aggregation::PRODUCT ||
+                 kind == aggregation::MIN || kind == aggregation::MAX ||
+                 kind == aggregation::MEAN || kind == aggregation::SUM_OF_SQUARES,
+                 "Unsupported batched reduction operator");
+    kinds[i] = kind;
+  }
+  for (auto const& col : input) {
+    CUDF_EXPECTS(is_numeric(col.type()), "Batched reductions support only numeric columns");
+  }
+
+  auto output = make_numeric_column(data_type{FLOAT64}, input.num_columns(),
+                                    mask_state::UNINITIALIZED, stream, mr);
+  if (input.num_columns() == 0) return output;
+
+  rmm::device_vector<aggregation::Kind> device_kinds{kinds};
+
+  auto input_device_view = table_device_view::create(input, stream);
+  auto output_device_view = mutable_column_device_view::create(output->mutable_view(), stream);
+
+  constexpr int block_size = 256;
+  batched_reduction_kernel<block_size>
+    <<<input.num_columns(), block_size, 0, stream>>>(
+      *input_device_view, device_kinds.data().get(), *output_device_view);
+
+  output->set_null_count(cudf::UNKNOWN_NULL_COUNT);
+
+  CHECK_CUDA(stream);
+
+  return output;
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> batched_reduce(
+    table_view const& input,
+    std::vector<std::unique_ptr<aggregation>> const& aggs,
+    rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::batched_reduce(input, aggs, mr, stream);
+}
+
+}  // namespace experimental
+}  // namespace cudf
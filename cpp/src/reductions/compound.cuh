@@ -68,11 +68,9 @@ std::unique_ptr<scalar> compound_reduction(column_view const& col,
         compound_op.template get_element_transformer<ResultType>());
     result = detail::reduce<Op, decltype(it), ResultType>(it, col.size(), compound_op, valid_count, ddof, mr, stream);
   }
-  // set scalar is valid
-  if (col.null_count() < col.size())
-    result->set_valid(true, stream);
-  else
-    result->set_valid(false, stream);
+  // the validity is derived from `valid_count` and set when the scalar is
+  // constructed, so the reduction runs entirely on `stream` with no host
+  // synchronization
   return result;
 };
 
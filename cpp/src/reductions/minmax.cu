@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+// The translation unit for the fused single-pass `minmax` reduction
+
+#include <cudf/reduction.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/scalar/scalar_device_view.cuh>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <cub/device/device_reduce.cuh>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+namespace cudf {
+namespace experimental {
+namespace detail {
+
+namespace { // anonymous
+
+/**
+ * @brief Accumulator carrying the running minimum and maximum through a
+ * single reduction pass.
+ *
+ * Default construction yields the identity (min side at the type's maximum,
+ * max side at its lowest), which is also what null elements contribute.
+ */
+template <typename T>
+struct minmax_pair {
+  T min_val;
+  T max_val;
+
+  __host__ __device__
+  minmax_pair()
+    : min_val(cudf::DeviceMin::identity<T>()),
+      max_val(cudf::DeviceMax::identity<T>()) {}
+
+  __host__ __device__
+  minmax_pair(T val) : min_val(val), max_val(val) {}
+};
+
+template <typename T>
+struct minmax_binary_op {
+  __device__
+  minmax_pair<T> operator()(minmax_pair<T> const& lhs, minmax_pair<T> const& rhs) const {
+    minmax_pair<T> result;
+    result.min_val = lhs.min_val < rhs.min_val ? lhs.min_val : rhs.min_val;
+    result.max_val = lhs.max_val > rhs.max_val ? lhs.max_val : rhs.max_val;
+    return result;
+  }
+};
+
+template <typename T>
+std::pair<std::unique_ptr<scalar>, std::unique_ptr<scalar>>
+minmax_impl(column_view const& col,
+            rmm::mr::device_memory_resource* mr,
+            cudaStream_t stream)
+{
+  // as with `reduce`, the validity is known on the host up front and set at
+  // construction, so the whole computation stays on the stream
+  bool const valid = (col.null_count() < col.size());
+
+  using ScalarType = cudf::experimental::scalar_type_t<T>;
+  auto min_result = std::unique_ptr<scalar>(new ScalarType(T{}, valid, stream, mr));
+  auto max_result = std::unique_ptr<scalar>(new ScalarType(T{}, valid, stream, mr));
+
+  if (col.size() == 0) return std::make_pair(std::move(min_result), std::move(max_result));
+
+  auto dcol = cudf::column_device_view::create(col, stream);
+
+  minmax_pair<T> identity{};
+  rmm::device_scalar<minmax_pair<T>> dev_result{identity, stream, mr};
+  minmax_binary_op<T> binary_op{};
+
+  auto launch_reduce = [&](auto input_it) {
+    rmm::device_buffer d_temp_storage;
+    size_t temp_storage_bytes = 0;
+    cub::DeviceReduce::Reduce(d_temp_storage.data(), temp_storage_bytes,
+      input_it, dev_result.data(), col.size(), binary_op, identity, stream);
+    d_temp_storage = rmm::device_buffer{temp_storage_bytes, stream, mr};
+    cub::DeviceReduce::Reduce(d_temp_storage.data(), temp_storage_bytes,
+      input_it, dev_result.data(), col.size(), binary_op, identity, stream);
+  };
+
+  if (col.has_nulls()) {
+    auto it = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0),
+      [d = *dcol] __device__ (size_type i) {
+        return d.is_valid_nocheck(i) ? minmax_pair<T>{d.element<T>(i)}
+                                     : minmax_pair<T>{};
+      });
+    launch_reduce(it);
+  } else {
+    auto it = thrust::make_transform_iterator(
+      dcol->begin<T>(),
+      [] __device__ (T val) { return minmax_pair<T>{val}; });
+    launch_reduce(it);
+  }
+
+  // scatter the two halves of the accumulator into the result scalars
+  auto* min_scalar = static_cast<ScalarType*>(min_result.get());
+  auto* max_scalar = static_cast<ScalarType*>(max_result.get());
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+    dev_result.data(), 1,
+    [d_min = min_scalar->data(), d_max = max_scalar->data()]
+    __device__ (minmax_pair<T> const& result) {
+      *d_min = result.min_val;
+      *d_max = result.max_val;
+    });
+
+  return std::make_pair(std::move(min_result), std::move(max_result));
+}
+
+struct minmax_dispatcher {
+  template <typename T,
+            typename std::enable_if_t<std::is_arithmetic<T>::value>* = nullptr>
+  std::pair<std::unique_ptr<scalar>, std::unique_ptr<scalar>>
+  operator()(column_view const& col,
+             rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+  {
+    return minmax_impl<T>(col, mr, stream);
+  }
+
+  template <typename T,
+            typename std::enable_if_t<!std::is_arithmetic<T>::value>* = nullptr>
+  std::pair<std::unique_ptr<scalar>, std::unique_ptr<scalar>>
+  operator()(column_view const& col,
+             rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+  {
+    CUDF_FAIL("minmax only supports arithmetic types");
+  }
+};
+
+} // namespace anonymous
+
+std::pair<std::unique_ptr<scalar>, std::unique_ptr<scalar>> minmax(
+    column_view const& col,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream = 0)
+{
+  return cudf::experimental::type_dispatcher(col.type(), minmax_dispatcher{},
+                                             col, mr, stream);
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<scalar>, std::unique_ptr<scalar>> minmax(
+    column_view const& col,
+    rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::minmax(col, mr, stream);
+}
+
+}  // namespace experimental
+}  // namespace cudf
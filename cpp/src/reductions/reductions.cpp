@@ -85,25 +85,27 @@ std::unique_ptr<scalar> reduce(
     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
     cudaStream_t stream = 0)
 {
-  std::unique_ptr<scalar> result = make_default_constructed_scalar(output_dtype);
-  result->set_valid(false, stream);
-
-  // check if input column is empty
-  if (col.size() <= col.null_count()) return result;
+  // check if input column is empty; a default constructed scalar is already
+  // invalid, so no synchronizing `set_valid` call is needed
+  if (col.size() <= col.null_count()) {
+    return make_default_constructed_scalar(output_dtype);
+  }
 
-  result = aggregation_dispatcher(
+  // the result scalar stays in device memory and its value and validity are
+  // produced on `stream` without any host round-trip, so it can be passed
+  // straight to e.g. `binary_operation` as a broadcast operand
+  return aggregation_dispatcher(
       agg->kind, reduce_dispatch_functor{col, output_dtype, mr, stream}, agg);
-  return result;
 }
 }  // namespace detail
 
  std::unique_ptr<scalar> reduce(
     column_view const& col, std::unique_ptr<aggregation> const &agg,
     data_type output_dtype,
-    rmm::mr::device_memory_resource* mr)
+    rmm::mr::device_memory_resource* mr, cudaStream_t stream)
 {
    CUDF_FUNC_RANGE();
-   return detail::reduce(col, agg, output_dtype, mr);
+   return detail::reduce(col, agg, output_dtype, mr, stream);
 }
 
 }  // namespace experimental
@@ -15,6 +15,15 @@
 #include <cudf/null_mask.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
 
+#include <rmm/device_scalar.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/transform_output_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/tuple.h>
+
 namespace cudf {
 namespace experimental {
 
@@ -249,14 +258,118 @@ std::unique_ptr<column> scan(const column_view& input,
         CUDF_FAIL("Unsupported aggregation operator for scan");
     }
 }
+namespace { // anonymous
+
+/**
+ * @brief Scan operator over (running sum, row index) pairs.
+ *
+ * Sums the first component and keeps the larger index; both components are
+ * associative, so the pair can flow through a parallel scan.
+ */
+struct cut_scan_op {
+  __device__
+  thrust::tuple<double, size_type> operator()(thrust::tuple<double, size_type> const& lhs,
+                                              thrust::tuple<double, size_type> const& rhs) const {
+    size_type const idx = thrust::get<1>(lhs) > thrust::get<1>(rhs)
+                            ? thrust::get<1>(lhs) : thrust::get<1>(rhs);
+    return thrust::make_tuple(thrust::get<0>(lhs) + thrust::get<0>(rhs), idx);
+  }
+};
+
+/**
+ * @brief Consumes each scanned (sum, index) pair as it is produced, recording
+ * the first row whose running sum crosses the threshold instead of
+ * materializing the scan.
+ */
+struct cut_recorder {
+  double threshold;
+  size_type* d_cut;
+
+  __device__
+  size_type operator()(thrust::tuple<double, size_type> const& partial) const {
+    if (thrust::get<0>(partial) > threshold) {
+      atomicMin(d_cut, thrust::get<1>(partial));
+    }
+    return 0; // discarded
+  }
+};
+
+struct cut_dispatcher {
+  template <typename T,
+            typename std::enable_if_t<std::is_arithmetic<T>::value>* = nullptr>
+  size_type operator()(column_view const& input, double threshold,
+                       rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+  {
+    auto d_input = column_device_view::create(input, stream);
+    rmm::device_scalar<size_type> d_cut{input.size(), stream, mr};
+
+    auto out = thrust::make_transform_output_iterator(
+        thrust::make_discard_iterator(), cut_recorder{threshold, d_cut.data()});
+
+    // null rows contribute nothing to the running sum, matching the
+    // skip-nulls behavior of `scan`
+    auto run_scan = [&](auto value_it) {
+      auto pair_it = thrust::make_zip_iterator(thrust::make_tuple(
+          value_it, thrust::make_counting_iterator<size_type>(0)));
+      thrust::inclusive_scan(rmm::exec_policy(stream)->on(stream),
+                             pair_it, pair_it + input.size(), out,
+                             cut_scan_op{});
+    };
+
+    if (input.has_nulls()) {
+      run_scan(thrust::make_transform_iterator(
+          thrust::make_counting_iterator<size_type>(0),
+          [d = *d_input] __device__ (size_type i) {
+            return d.is_valid_nocheck(i) ? static_cast<double>(d.element<T>(i)) : 0.0;
+          }));
+    } else {
+      run_scan(thrust::make_transform_iterator(
+          d_input->begin<T>(),
+          [] __device__ (T val) { return static_cast<double>(val); }));
+    }
+
+    CHECK_CUDA(stream);
+
+    // only the 4-byte cut index crosses back to the host
+    return d_cut.value(stream);
+  }
+
+  template <typename T,
+            typename std::enable_if_t<!std::is_arithmetic<T>::value>* = nullptr>
+  size_type operator()(column_view const& input, double threshold,
+                       rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+  {
+    CUDF_FAIL("Non-arithmetic types not supported for `cudf::scan_threshold_cut`");
+  }
+};
+
+} // namespace anonymous
+
+size_type scan_threshold_cut(column_view const& input, double threshold,
+                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                             cudaStream_t stream = 0)
+{
+  if (input.size() == 0) return 0;
+  return cudf::experimental::type_dispatcher(input.type(), cut_dispatcher{},
+                                             input, threshold, mr, stream);
+}
+
 } // namespace detail
 
 std::unique_ptr<column> scan(const column_view &input,
                              std::unique_ptr<aggregation> const &agg,
                              scan_type inclusive, include_nulls include_nulls_flag,
-                             rmm::mr::device_memory_resource *mr) {
+                             rmm::mr::device_memory_resource *mr,
+                             cudaStream_t stream) {
+  CUDF_FUNC_RANGE();
+  return detail::scan(input, agg, inclusive, include_nulls_flag, mr, stream);
+}
+
+size_type scan_threshold_cut(column_view const& input, double threshold,
+                             rmm::mr::device_memory_resource* mr,
+                             cudaStream_t stream) {
   CUDF_FUNC_RANGE();
-  return detail::scan(input, agg, inclusive, include_nulls_flag, mr);
+  return detail::scan_threshold_cut(input, threshold, mr, stream);
 }
 
 }  // namespace experimental
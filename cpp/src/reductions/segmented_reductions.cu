@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+// The translation unit for segmented reductions over offset-delimited ranges
+
+#include <cudf/reduction.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/reduction_operators.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <cub/device/device_segmented_reduce.cuh>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+namespace cudf {
+namespace experimental {
+namespace reduction {
+namespace segmented {
+
+/** --------------------------------------------------------------------------*
+ * @brief Segmented reduction for 'sum', 'product', 'min', 'max',
+ * 'sum of squares', computing one result per offset-delimited range of the
+ * values in a single linear pass.
+ *
+ * `cub::DeviceSegmentedReduce` picks the per-segment strategy (warp- or
+ * block-sized tiles) from the segment lengths, so short and long segments
+ * both run at bandwidth-bound cost.
+ *
+ * @param[in] values  input column view
+ * @param[in] offsets segment boundaries; segment `i` covers rows
+ *                    `[offsets[i], offsets[i+1])`
+ * @param[in] mr The resource to use for all allocations
+ * @param[in] stream cuda stream
+ * @returns   Output column with one row per segment
+ *
+ * @tparam ElementType  the input column cudf dtype
+ * @tparam ResultType   the output cudf dtype
+ * @tparam Op           the operator of cudf::experimental::reduction::op::
+ * ----------------------------------------------------------------------------**/
+template <typename ElementType, typename ResultType, typename Op>
+std::unique_ptr<column> segmented_reduction(column_view const& values,
+                                            column_view const& offsets,
+                                            data_type const output_dtype,
+                                            rmm::mr::device_memory_resource* mr,
+                                            cudaStream_t stream)
+{
+  size_type const num_segments = offsets.size() - 1;
+
+  auto result = make_fixed_width_column(output_dtype, num_segments,
+                                        mask_state::UNALLOCATED, stream, mr);
+  if (num_segments == 0) return result;
+
+  auto dcol = cudf::column_device_view::create(values, stream);
+  Op simple_op{};
+
+  auto const* d_begin_offsets = offsets.data<size_type>();
+  auto const* d_end_offsets = d_begin_offsets + 1;
+
+  auto result_view = result->mutable_view();
+  auto* d_result = result_view.data<ResultType>();
+
+  auto binary_op = simple_op.get_binary_op();
+  ResultType identity = simple_op.template get_identity<ResultType>();
+
+  auto launch_reduce = [&](auto input_it) {
+    rmm::device_buffer d_temp_storage;
+    size_t temp_storage_bytes = 0;
+    cub::DeviceSegmentedReduce::Reduce(d_temp_storage.data(), temp_storage_bytes,
+      input_it, d_result, num_segments, d_begin_offsets, d_end_offsets,
+      binary_op, identity, stream);
+    d_temp_storage = rmm::device_buffer{temp_storage_bytes, stream, mr};
+    cub::DeviceSegmentedReduce::Reduce(d_temp_storage.data(), temp_storage_bytes,
+      input_it, d_result, num_segments, d_begin_offsets, d_end_offsets,
+      binary_op, identity, stream);
+  };
+
+  if (values.has_nulls()) {
+    auto it = thrust::make_transform_iterator(
+      experimental::detail::make_null_replacement_iterator(*dcol, simple_op.template get_identity<ElementType>()),
+      simple_op.template get_element_transformer<ResultType>());
+    launch_reduce(it);
+
+    // a segment's result is valid only if it holds at least one valid row;
+    // count them with a second segmented pass over the validity bits
+    rmm::device_vector<size_type> valid_counts(num_segments);
+    auto d_values = *dcol;
+    auto valid_it = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0),
+      [d_values] __device__ (size_type i) -> size_type {
+        return d_values.is_valid_nocheck(i) ? 1 : 0;
+      });
+
+    rmm::device_buffer d_temp_storage;
+    size_t temp_storage_bytes = 0;
+    cub::DeviceSegmentedReduce::Sum(d_temp_storage.data(), temp_storage_bytes,
+      valid_it, valid_counts.data().get(), num_segments,
+      d_begin_offsets, d_end_offsets, stream);
+    d_temp_storage = rmm::device_buffer{temp_storage_bytes, stream, mr};
+    cub::DeviceSegmentedReduce::Sum(d_temp_storage.data(), temp_storage_bytes,
+      valid_it, valid_counts.data().get(), num_segments,
+      d_begin_offsets, d_end_offsets, stream);
+
+    auto const* d_valid_counts = valid_counts.data().get();
+    auto mask_and_count = experimental::detail::valid_if(
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(num_segments),
+      [d_valid_counts] __device__ (size_type i) { return d_valid_counts[i] > 0; },
+      stream, mr);
+    result->set_null_mask(std::move(mask_and_count.first), mask_and_count.second);
+  } else {
+    auto it = thrust::make_transform_iterator(
+        dcol->begin<ElementType>(),
+        simple_op.template get_element_transformer<ResultType>());
+    launch_reduce(it);
+
+    // without nulls only an empty segment produces a null result
+    auto mask_and_count = experimental::detail::valid_if(
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(num_segments),
+      [d_begin_offsets] __device__ (size_type i) {
+        return d_begin_offsets[i + 1] > d_begin_offsets[i];
+      },
+      stream, mr);
+    result->set_null_mask(std::move(mask_and_count.first), mask_and_count.second);
+  }
+
+  CHECK_CUDA(stream);
+
+  return result;
+};
+
+// @brief result type dispatcher for segmented reduction
+template <typename ElementType, typename Op>
+struct result_type_dispatcher {
+private:
+    template <typename ResultType>
+    static constexpr bool is_supported_v()
+    {
+      return std::is_convertible<ElementType, ResultType>::value &&
+             std::is_arithmetic<ResultType>::value;
+    }
+
+public:
+    template <typename ResultType, std::enable_if_t<is_supported_v<ResultType>()>* = nullptr>
+    std::unique_ptr<column> operator()(column_view const& values, column_view const& offsets,
+    data_type const output_dtype, rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+    {
+      return segmented_reduction<ElementType, ResultType, Op>(values, offsets, output_dtype, mr, stream);
+    }
+
+    template <typename ResultType, std::enable_if_t<not is_supported_v<ResultType>()>* = nullptr>
+    std::unique_ptr<column> operator()(column_view const& values, column_view const& offsets,
+    data_type const output_dtype, rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+    {
+        CUDF_FAIL("input data type is not convertible to output data type");
+    }
+};
+
+// @brief input column element dispatcher for segmented reduction
+template <typename Op>
+struct element_type_dispatcher {
+private:
+    template <typename ElementType>
+    static constexpr bool is_supported_v()
+    {
+      return std::is_arithmetic<ElementType>::value;
+    }
+
+public:
+    template <typename ElementType, std::enable_if_t<is_supported_v<ElementType>()>* = nullptr>
+    std::unique_ptr<column> operator()(column_view const& values, column_view const& offsets,
+    data_type const output_dtype, rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+    {
+        return cudf::experimental::type_dispatcher(output_dtype,
+            result_type_dispatcher<ElementType, Op>(), values, offsets, output_dtype, mr, stream);
+    }
+
+    template <typename ElementType, std::enable_if_t<not is_supported_v<ElementType>()>* = nullptr>
+    std::unique_ptr<column> operator()(column_view const& values, column_view const& offsets,
+    data_type const output_dtype, rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+    {
+        CUDF_FAIL("Segmented reductions are only supported for arithmetic types");
+    }
+};
+
+} // namespace segmented
+} // namespace reduction
+
+namespace detail {
+
+std::unique_ptr<column> segmented_reduce(
+    column_view const& values,
+    column_view const& offsets,
+    std::unique_ptr<aggregation> const& agg,
+    data_type output_dtype,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream = 0)
+{
+  CUDF_EXPECTS(offsets.size() > 0, "offsets column may not be empty");
+  CUDF_EXPECTS(offsets.type().id() == INT32, "offsets must have INT32 type");
+  CUDF_EXPECTS(not offsets.has_nulls(), "offsets may not contain nulls");
+
+  switch (agg->kind) {
+  case aggregation::SUM:
+    return cudf::experimental::type_dispatcher(values.type(),
+        reduction::segmented::element_type_dispatcher<reduction::op::sum>{},
+        values, offsets, output_dtype, mr, stream);
+  case aggregation::PRODUCT:
+    return cudf::experimental::type_dispatcher(values.type(),
+        reduction::segmented::element_type_dispatcher<reduction::op::product>{},
+        values, offsets, output_dtype, mr, stream);
+  case aggregation::MIN:
+    return cudf::experimental::type_dispatcher(values.type(),
+        reduction::segmented::element_type_dispatcher<reduction::op::min>{},
+        values, offsets, output_dtype, mr, stream);
+  case aggregation::MAX:
+    return cudf::experimental::type_dispatcher(values.type(),
+        reduction::segmented::element_type_dispatcher<reduction::op::max>{},
+        values, offsets, output_dtype, mr, stream);
+  case aggregation::SUM_OF_SQUARES:
+    return cudf::experimental::type_dispatcher(values.type(),
+        reduction::segmented::element_type_dispatcher<reduction::op::sum_of_squares>{},
+        values, offsets, output_dtype, mr, stream);
+  default:
+    CUDF_FAIL("Unsupported segmented reduction operator");
+  }
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> segmented_reduce(
+    column_view const& values,
+    column_view const& offsets,
+    std::unique_ptr<aggregation> const& agg,
+    data_type output_dtype,
+    rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::segmented_reduce(values, offsets, agg, output_dtype, mr, stream);
+}
+
+}  // namespace experimental
+}  // namespace cudf
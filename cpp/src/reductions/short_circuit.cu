@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+// The translation unit for the short-circuiting boolean predicates
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/reduction_functions.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/wrappers/bool.hpp>
+
+namespace cudf {
+namespace experimental {
+namespace reduction {
+namespace {  // anonymous
+
+constexpr size_type short_circuit_block_size = 256;
+
+/**
+ * @brief Scans the column until `pred` first holds and stores `hit_value`
+ * into the result byte.
+ *
+ * The result byte doubles as the short-circuit flag: it is initialized to the
+ * miss value before the launch, and every thread re-reads it once per
+ * grid-stride iteration, so once any thread scores a hit the remaining blocks
+ * exit without touching the column. For guard predicates that are decided in
+ * the first fraction of the data, most blocks never read a single element.
+ */
+template <typename Predicate>
+__global__ void short_circuit_kernel(size_type size,
+                                     Predicate pred,
+                                     uint8_t* result,
+                                     uint8_t hit_value) {
+  volatile uint8_t* const flag = result;
+  size_type i = threadIdx.x + blockIdx.x * blockDim.x;
+  size_type const stride = blockDim.x * gridDim.x;
+
+  while (i < size) {
+    if (*flag == hit_value) { return; }
+    if (pred(i)) {
+      *flag = hit_value;
+      __threadfence();
+      return;
+    }
+    i += stride;
+  }
+}
+
+struct any_true_fn {
+  column_device_view col;
+  __device__ bool operator()(size_type i) const {
+    return col.is_valid(i) and
+           static_cast<bool>(col.element<experimental::bool8>(i));
+  }
+};
+
+// the predicate is the *violation*: a valid false element disproves "all"
+struct not_all_true_fn {
+  column_device_view col;
+  __device__ bool operator()(size_type i) const {
+    return col.is_valid(i) and
+           not static_cast<bool>(col.element<experimental::bool8>(i));
+  }
+};
+
+struct any_null_fn {
+  column_device_view col;
+  __device__ bool operator()(size_type i) const { return col.is_null(i); }
+};
+
+/**
+ * @brief Runs `pred` over the column with the short-circuit kernel.
+ *
+ * The returned scalar's value is written on `stream` with no host
+ * synchronization; reading it through `scalar::value(stream)` provides the
+ * synchronization point.
+ */
+template <typename Predicate>
+std::unique_ptr<scalar> short_circuit_predicate(
+    size_type size, Predicate pred, bool hit, bool valid,
+    rmm::mr::device_memory_resource* mr, cudaStream_t stream) {
+  auto result = make_numeric_scalar(data_type(BOOL8), stream, mr);
+  auto bool_result =
+      static_cast<numeric_scalar<experimental::bool8>*>(result.get());
+
+  // the miss value is the answer when the predicate never holds
+  bool_result->set_value(experimental::bool8{not hit}, stream);
+  bool_result->set_valid(valid, stream);
+
+  if (size > 0) {
+    cudf::experimental::detail::grid_1d grid{size, short_circuit_block_size};
+    short_circuit_kernel<<<grid.num_blocks, grid.num_threads_per_block, 0,
+                           stream>>>(
+        size, pred,
+        reinterpret_cast<uint8_t*>(bool_result->data()),
+        static_cast<uint8_t>(experimental::bool8{hit}));
+  }
+  CHECK_CUDA(stream);
+  return result;
+}
+
+}  // namespace anonymous
+
+std::unique_ptr<scalar> any_true(column_view const& col,
+                                 rmm::mr::device_memory_resource* mr,
+                                 cudaStream_t stream) {
+  CUDF_EXPECTS(col.type() == data_type(BOOL8),
+               "any_true() operation can be applied to `bool8` columns only");
+  auto dcol = column_device_view::create(col, stream);
+  // mirror the reduce-based any(): the result is invalid when there are no
+  // valid elements to inspect
+  bool const valid = col.null_count() < col.size();
+  return short_circuit_predicate(col.size(), any_true_fn{*dcol}, true, valid,
+                                 mr, stream);
+}
+
+std::unique_ptr<scalar> all_true(column_view const& col,
+                                 rmm::mr::device_memory_resource* mr,
+                                 cudaStream_t stream) {
+  CUDF_EXPECTS(col.type() == data_type(BOOL8),
+               "all_true() operation can be applied to `bool8` columns only");
+  auto dcol = column_device_view::create(col, stream);
+  bool const valid = col.null_count() < col.size();
+  return short_circuit_predicate(col.size(), not_all_true_fn{*dcol}, false,
+                                 valid, mr, stream);
+}
+
+std::unique_ptr<scalar> any_null(column_view const& col,
+                                 rmm::mr::device_memory_resource* mr,
+                                 cudaStream_t stream) {
+  // a column without a mask cannot contain nulls; answer without a launch
+  if (not col.nullable() || col.null_count() == 0) {
+    auto result = make_numeric_scalar(data_type(BOOL8), stream, mr);
+    static_cast<numeric_scalar<experimental::bool8>*>(result.get())
+        ->set_value(experimental::bool8{false}, stream);
+    return result;
+  }
+  auto dcol = column_device_view::create(col, stream);
+  return short_circuit_predicate(col.size(), any_null_fn{*dcol}, true, true,
+                                 mr, stream);
+}
+
+}  // namespace reduction
+}  // namespace experimental
+}  // namespace cudf
@@ -52,19 +52,21 @@ std::unique_ptr<scalar> simple_reduction(column_view const& col,
   std::unique_ptr<scalar> result;
   Op simple_op{};
 
+  // the validity is known up front and set when the scalar is constructed,
+  // so the reduction runs entirely on `stream` with no host synchronization
+  bool const valid = (col.null_count() < col.size());
+
   if (col.has_nulls()) {
     auto it = thrust::make_transform_iterator(
       experimental::detail::make_null_replacement_iterator(*dcol, simple_op.template get_identity<ElementType>()),
       simple_op.template get_element_transformer<ResultType>());
-    result = detail::reduce(it, col.size(), Op{}, mr, stream);
+    result = detail::reduce(it, col.size(), Op{}, valid, mr, stream);
   } else {
     auto it = thrust::make_transform_iterator(
-        dcol->begin<ElementType>(), 
+        dcol->begin<ElementType>(),
         simple_op.template get_element_transformer<ResultType>());
-    result = detail::reduce(it, col.size(), Op{}, mr, stream);
+    result = detail::reduce(it, col.size(), Op{}, valid, mr, stream);
   }
-  // set scalar is valid
-  result->set_valid((col.null_count() < col.size()), stream);
   return result;
 };
 
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+// The translation unit for the fused single-pass `sum_count` reduction
+
+#include <cudf/reduction.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/scalar/scalar_device_view.cuh>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <cub/device/device_reduce.cuh>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+namespace cudf {
+namespace experimental {
+namespace detail {
+
+namespace { // anonymous
+
+/**
+ * @brief Accumulator carrying the running sum and valid-element count
+ * through a single reduction pass. Null elements contribute `{0, 0}`.
+ */
+template <typename ResultType>
+struct sum_count_pair {
+  ResultType sum;
+  size_type count;
+};
+
+template <typename ResultType>
+struct sum_count_binary_op {
+  __device__
+  sum_count_pair<ResultType> operator()(sum_count_pair<ResultType> const& lhs,
+                                        sum_count_pair<ResultType> const& rhs) const {
+    return sum_count_pair<ResultType>{lhs.sum + rhs.sum, lhs.count + rhs.count};
+  }
+};
+
+template <typename ElementType, typename ResultType>
+std::pair<std::unique_ptr<scalar>, std::unique_ptr<scalar>>
+sum_count_impl(column_view const& col,
+               data_type const output_dtype,
+               rmm::mr::device_memory_resource* mr,
+               cudaStream_t stream)
+{
+  // as with `reduce`, the validity is known on the host up front and set at
+  // construction, so the whole computation stays on the stream
+  bool const valid = (col.null_count() < col.size());
+
+  using SumScalarType = cudf::experimental::scalar_type_t<ResultType>;
+  using CountScalarType = cudf::experimental::scalar_type_t<size_type>;
+  auto sum_result = std::unique_ptr<scalar>(new SumScalarType(ResultType{0}, valid, stream, mr));
+  // the count of valid elements is always a valid result
+  auto count_result = std::unique_ptr<scalar>(new CountScalarType(0, true, stream, mr));
+
+  if (col.size() == 0) return std::make_pair(std::move(sum_result), std::move(count_result));
+
+  auto dcol = cudf::column_device_view::create(col, stream);
+
+  sum_count_pair<ResultType> identity{ResultType{0}, 0};
+  rmm::device_scalar<sum_count_pair<ResultType>> dev_result{identity, stream, mr};
+  sum_count_binary_op<ResultType> binary_op{};
+
+  auto launch_reduce = [&](auto input_it) {
+    rmm::device_buffer d_temp_storage;
+    size_t temp_storage_bytes = 0;
+    cub::DeviceReduce::Reduce(d_temp_storage.data(), temp_storage_bytes,
+      input_it, dev_result.data(), col.size(), binary_op, identity, stream);
+    d_temp_storage = rmm::device_buffer{temp_storage_bytes, stream, mr};
+    cub::DeviceReduce::Reduce(d_temp_storage.data(), temp_storage_bytes,
+      input_it, dev_result.data(), col.size(), binary_op, identity, stream);
+  };
+
+  if (col.has_nulls()) {
+    auto it = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0),
+      [d = *dcol] __device__ (size_type i) {
+        return d.is_valid_nocheck(i)
+          ? sum_count_pair<ResultType>{static_cast<ResultType>(d.element<ElementType>(i)), 1}
+          : sum_count_pair<ResultType>{ResultType{0}, 0};
+      });
+    launch_reduce(it);
+  } else {
+    auto it = thrust::make_transform_iterator(
+      dcol->begin<ElementType>(),
+      [] __device__ (ElementType val) {
+        return sum_count_pair<ResultType>{static_cast<ResultType>(val), 1};
+      });
+    launch_reduce(it);
+  }
+
+  // scatter the two halves of the accumulator into the result scalars
+  auto* sum_scalar = static_cast<SumScalarType*>(sum_result.get());
+  auto* count_scalar = static_cast<CountScalarType*>(count_result.get());
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+    dev_result.data(), 1,
+    [d_sum = sum_scalar->data(), d_count = count_scalar->data()]
+    __device__ (sum_count_pair<ResultType> const& result) {
+      *d_sum = result.sum;
+      *d_count = result.count;
+    });
+
+  return std::make_pair(std::move(sum_result), std::move(count_result));
+}
+
+// @brief result type dispatcher for the fused sum+count reduction
+template <typename ElementType>
+struct sum_count_result_dispatcher {
+private:
+    template <typename ResultType>
+    static constexpr bool is_supported_v()
+    {
+      return std::is_convertible<ElementType, ResultType>::value &&
+             std::is_arithmetic<ResultType>::value;
+    }
+
+public:
+    template <typename ResultType, std::enable_if_t<is_supported_v<ResultType>()>* = nullptr>
+    std::pair<std::unique_ptr<scalar>, std::unique_ptr<scalar>>
+    operator()(column_view const& col, data_type const output_dtype,
+               rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+    {
+      return sum_count_impl<ElementType, ResultType>(col, output_dtype, mr, stream);
+    }
+
+    template <typename ResultType, std::enable_if_t<not is_supported_v<ResultType>()>* = nullptr>
+    std::pair<std::unique_ptr<scalar>, std::unique_ptr<scalar>>
+    operator()(column_view const& col, data_type const output_dtype,
+               rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+    {
+        CUDF_FAIL("input data type is not convertible to output data type");
+    }
+};
+
+// @brief input column element dispatcher for the fused sum+count reduction
+struct sum_count_element_dispatcher {
+    template <typename ElementType,
+              typename std::enable_if_t<std::is_arithmetic<ElementType>::value>* = nullptr>
+    std::pair<std::unique_ptr<scalar>, std::unique_ptr<scalar>>
+    operator()(column_view const& col, data_type const output_dtype,
+               rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+    {
+        return cudf::experimental::type_dispatcher(output_dtype,
+            sum_count_result_dispatcher<ElementType>(), col, output_dtype, mr, stream);
+    }
+
+    template <typename ElementType,
+              typename std::enable_if_t<!std::is_arithmetic<ElementType>::value>* = nullptr>
+    std::pair<std::unique_ptr<scalar>, std::unique_ptr<scalar>>
+    operator()(column_view const& col, data_type const output_dtype,
+               rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+    {
+        CUDF_FAIL("sum_count only supports arithmetic types");
+    }
+};
+
+} // namespace anonymous
+
+std::pair<std::unique_ptr<scalar>, std::unique_ptr<scalar>> sum_count(
+    column_view const& col,
+    data_type output_dtype,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream = 0)
+{
+  return cudf::experimental::type_dispatcher(col.type(),
+                                             sum_count_element_dispatcher{},
+                                             col, output_dtype, mr, stream);
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<scalar>, std::unique_ptr<scalar>> sum_count(
+    column_view const& col,
+    data_type output_dtype,
+    rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::sum_count(col, output_dtype, mr, stream);
+}
+
+}  // namespace experimental
+}  // namespace cudf
@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/types.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/replace.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace experimental {
+namespace detail {
+namespace {
+
+template <typename T, typename ScalarIterator>
+std::enable_if_t<cudf::is_fixed_width<T>(), std::unique_ptr<cudf::column>>
+cleanser(column_view const& input,
+         ScalarIterator const& null_fill_itr,
+         ScalarIterator const& lo_itr,
+         ScalarIterator const& hi_itr,
+         ScalarIterator const& old_value_itr,
+         ScalarIterator const& new_value_itr,
+         rmm::mr::device_memory_resource* mr,
+         cudaStream_t stream) {
+    // nulls are filled, so the output never needs a mask
+    auto output = detail::allocate_like(input, input.size(), mask_allocation_policy::NEVER, mr, stream);
+
+    auto output_device_view = cudf::mutable_column_device_view::create(output->mutable_view(), stream);
+    auto input_device_view = cudf::column_device_view::create(input, stream);
+    auto scalar_zip_itr = thrust::make_zip_iterator(thrust::make_tuple(
+        null_fill_itr, lo_itr, hi_itr, old_value_itr, new_value_itr));
+
+    // null fill, range clamp, and value substitution in one read and write
+    auto trans = [] __device__ (auto element_validity_pair,
+                                auto scalar_tuple) {
+        auto null_fill_pair = thrust::get<0>(scalar_tuple);
+        auto lo_pair = thrust::get<1>(scalar_tuple);
+        auto hi_pair = thrust::get<2>(scalar_tuple);
+        auto old_value_pair = thrust::get<3>(scalar_tuple);
+        auto new_value_pair = thrust::get<4>(scalar_tuple);
+
+        auto value = element_validity_pair.second ? element_validity_pair.first
+                                                  : null_fill_pair.first;
+        if (lo_pair.second and value < lo_pair.first) {
+            value = lo_pair.first;
+        } else if (hi_pair.second and value > hi_pair.first) {
+            value = hi_pair.first;
+        }
+        if (old_value_pair.second and value == old_value_pair.first) {
+            value = new_value_pair.first;
+        }
+        return value;
+    };
+
+    if (input.has_nulls()) {
+        auto input_pair_iterator = make_pair_iterator<T, true>(*input_device_view);
+        thrust::transform(rmm::exec_policy(stream)->on(stream), input_pair_iterator,
+                input_pair_iterator+input.size(), scalar_zip_itr, output_device_view->begin<T>(), trans);
+    } else {
+        auto input_pair_iterator = make_pair_iterator<T, false>(*input_device_view);
+        thrust::transform(rmm::exec_policy(stream)->on(stream), input_pair_iterator,
+                input_pair_iterator+input.size(), scalar_zip_itr, output_device_view->begin<T>(), trans);
+    }
+
+    return output;
+}
+
+template <typename T, typename ScalarIterator>
+std::enable_if_t<not cudf::is_fixed_width<T>(), std::unique_ptr<cudf::column>>
+cleanser(column_view const& input,
+         ScalarIterator const& null_fill_itr,
+         ScalarIterator const& lo_itr,
+         ScalarIterator const& hi_itr,
+         ScalarIterator const& old_value_itr,
+         ScalarIterator const& new_value_itr,
+         rmm::mr::device_memory_resource* mr,
+         cudaStream_t stream) {
+
+    CUDF_FAIL("Only fixed-width types are supported by cleanse");
+}
+
+struct dispatch_cleanse {
+    template<typename T>
+    std::unique_ptr<column> operator ()(column_view const& input,
+                scalar const& null_fill,
+                scalar const& lo,
+                scalar const& hi,
+                scalar const& old_value,
+                scalar const& new_value,
+                rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                cudaStream_t stream = 0) {
+
+        auto null_fill_itr = make_pair_iterator<T>(null_fill);
+        auto lo_itr = make_pair_iterator<T>(lo);
+        auto hi_itr = make_pair_iterator<T>(hi);
+        auto old_value_itr = make_pair_iterator<T>(old_value);
+        auto new_value_itr = make_pair_iterator<T>(new_value);
+
+        return cleanser<T>(input, null_fill_itr, lo_itr, hi_itr,
+                           old_value_itr, new_value_itr, mr, stream);
+    }
+};
+
+}// namespace
+
+/**
+ * @copydoc cudf::experimental::cleanse(column_view const& input,
+                                        scalar const& null_fill,
+                                        scalar const& lo,
+                                        scalar const& hi,
+                                        scalar const& old_value,
+                                        scalar const& new_value,
+                                        rmm::mr::device_memory_resource* mr);
+ *
+ * @param[in] stream Optional stream on which to issue all memory allocations
+ */
+std::unique_ptr<column> cleanse(column_view const& input,
+                                scalar const& null_fill,
+                                scalar const& lo,
+                                scalar const& hi,
+                                scalar const& old_value,
+                                scalar const& new_value,
+                                rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                                cudaStream_t stream = 0) {
+    CUDF_EXPECTS(null_fill.type() == input.type(), "mismatching types of null fill scalar and input");
+    CUDF_EXPECTS(lo.type() == hi.type(), "mismatching types of limit scalars");
+    CUDF_EXPECTS(lo.type() == input.type(), "mismatching types of scalar and input");
+    CUDF_EXPECTS(old_value.type() == new_value.type(), "mismatching types of substitution scalars");
+    CUDF_EXPECTS(old_value.type() == input.type(), "mismatching types of scalar and input");
+    CUDF_EXPECTS(null_fill.is_valid(stream) or not input.has_nulls(),
+                 "null_fill can't be null if input has nulls");
+    if (old_value.is_valid(stream)) {
+        CUDF_EXPECTS(new_value.is_valid(stream), "new_value can't be null if old_value is not null");
+    }
+
+    if (input.is_empty()) {
+        return std::make_unique<column>(input, stream, mr);
+    }
+
+    return cudf::experimental::type_dispatcher(input.type(), dispatch_cleanse{},
+                                               input, null_fill, lo, hi,
+                                               old_value, new_value,
+                                               mr, stream);
+}
+
+/**
+ * @copydoc cudf::experimental::cleanse(table_view const& input,
+                                        std::vector<std::unique_ptr<scalar>> const& null_fills,
+                                        std::vector<std::unique_ptr<scalar>> const& los,
+                                        std::vector<std::unique_ptr<scalar>> const& his,
+                                        std::vector<std::unique_ptr<scalar>> const& old_values,
+                                        std::vector<std::unique_ptr<scalar>> const& new_values,
+                                        rmm::mr::device_memory_resource* mr);
+ *
+ * @param[in] stream Optional stream on which to issue all memory allocations
+ */
+std::unique_ptr<table> cleanse(table_view const& input,
+                               std::vector<std::unique_ptr<scalar>> const& null_fills,
+                               std::vector<std::unique_ptr<scalar>> const& los,
+                               std::vector<std::unique_ptr<scalar>> const& his,
+                               std::vector<std::unique_ptr<scalar>> const& old_values,
+                               std::vector<std::unique_ptr<scalar>> const& new_values,
+                               rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                               cudaStream_t stream = 0) {
+    auto const num_columns = static_cast<size_t>(input.num_columns());
+    CUDF_EXPECTS(null_fills.size() == num_columns and los.size() == num_columns and
+                 his.size() == num_columns and old_values.size() == num_columns and
+                 new_values.size() == num_columns,
+                 "mismatching number of columns and scalars");
+
+    // all launches go onto the same stream back to back, so the whole table
+    // is cleaned in one wave without intervening synchronization
+    std::vector<std::unique_ptr<column>> output(num_columns);
+    for (size_t i = 0; i < num_columns; i++) {
+        output[i] = cleanse(input.column(i), *null_fills[i], *los[i], *his[i],
+                            *old_values[i], *new_values[i], mr, stream);
+    }
+
+    return std::make_unique<table>(std::move(output));
+}
+
+}// namespace detail
+
+// fused null fill, clamp, and value substitution
+std::unique_ptr<column> cleanse(column_view const& input,
+                                scalar const& null_fill,
+                                scalar const& lo,
+                                scalar const& hi,
+                                scalar const& old_value,
+                                scalar const& new_value,
+                                rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::cleanse(input, null_fill, lo, hi, old_value, new_value, mr);
+}
+
+// fused cleanup of every column of a table
+std::unique_ptr<table> cleanse(table_view const& input,
+                               std::vector<std::unique_ptr<scalar>> const& null_fills,
+                               std::vector<std::unique_ptr<scalar>> const& los,
+                               std::vector<std::unique_ptr<scalar>> const& his,
+                               std::vector<std::unique_ptr<scalar>> const& old_values,
+                               std::vector<std::unique_ptr<scalar>> const& new_values,
+                               rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::cleanse(input, null_fills, los, his, old_values, new_values, mr);
+}
+
+}// namespace experimental
+}// namespace cudf
@@ -43,7 +43,10 @@ cudf::size_type get_window(cudf::size_type* window, cudf::size_type index) {
   return window[index];
 }
 
-template <typename InType, typename OutType, class agg_op, typename WindowType>
+// A negative static window size means the size is only known at runtime and
+// must be read from the window argument.
+template <typename InType, typename OutType, class agg_op, typename WindowType,
+          cudf::size_type static_preceding, cudf::size_type static_following>
 __global__
 void gpu_rolling_new(cudf::size_type nrows,
                  InType const* const __restrict__ in_col, 
@@ -67,8 +70,10 @@ void gpu_rolling_new(cudf::size_type nrows,
     // for CUDA 10.0 and below (fixed in CUDA 10.1)
     volatile cudf::size_type count = 0;
 
-    cudf::size_type preceding_window = get_window(preceding_window_begin, i);
-    cudf::size_type following_window = get_window(following_window_begin, i);
+    cudf::size_type preceding_window =
+      static_preceding >= 0 ? static_preceding : get_window(preceding_window_begin, i);
+    cudf::size_type following_window =
+      static_following >= 0 ? static_following : get_window(following_window_begin, i);
 
     // compute bounds
     cudf::size_type start = min(nrows, max(0, i - preceding_window + 1));
@@ -81,7 +86,17 @@ void gpu_rolling_new(cudf::size_type nrows,
     //       This might require separating the kernel into a special version
     //       for dynamic and static sizes.
     count = end_index - start_index;
-    OutType val = agg_op::template operate<OutType, InType>(in_col, start_index, count);
+    OutType val;
+    if (static_preceding >= 0 && static_following >= 0 &&
+        count == static_preceding + static_following) {
+      // full interior window: the element count is a compile-time constant so
+      // the aggregation loop can be unrolled; only the clamped edge rows fall
+      // through to the generic call below
+      val = agg_op::template operate<OutType, InType>(in_col, start_index,
+                                                      static_preceding + static_following);
+    } else {
+      val = agg_op::template operate<OutType, InType>(in_col, start_index, count);
+    }
 
     // check if we have enough input samples
     bool output_is_valid = (count >= min_periods);
@@ -24,7 +24,10 @@
 #include <cudf/utilities/nvtx_utils.hpp>
 #include <cudf/utilities/bit.hpp>
 #include <cudf/detail/copy.hpp>
+#include <cudf/detail/groupby/sort_helper.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/table/table_view.hpp>
 #include <cudf/copying.hpp>
 #include <rolling/rolling_detail.hpp>
 #include <cudf/rolling.hpp>
@@ -40,6 +43,12 @@
 
 #include <rmm/device_scalar.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
 #include <memory>
 
 namespace cudf {
@@ -53,10 +62,10 @@ namespace { // anonymous
  *        depending on `min_periods` and returns true if it was
  *        valid, else false.
  */
-template <typename InputType, typename OutputType, typename agg_op, aggregation::Kind op, bool has_nulls>
+template <typename InputType, typename OutputType, typename agg_op, aggregation::Kind op, typename PairIterator>
 std::enable_if_t<op == aggregation::COUNT_VALID || op == aggregation::COUNT_ALL, bool>
 __device__
-process_rolling_window(column_device_view input,
+process_rolling_window(PairIterator input_begin,
                         mutable_column_device_view output,
                         size_type start_index,
                         size_type end_index,
@@ -67,9 +76,9 @@ process_rolling_window(column_device_view input,
     // declare this as volatile to avoid some compiler optimizations that lead to incorrect results
     // for CUDA 10.0 and below (fixed in CUDA 10.1)
     volatile cudf::size_type count = 0;
-    
+
     for (size_type j = start_index; j < end_index; j++) {
-        if (op == aggregation::COUNT_ALL || !has_nulls || input.is_valid(j)) {
+        if (op == aggregation::COUNT_ALL || input_begin[j].second) {
             count++;
         }
     }
@@ -85,11 +94,11 @@ process_rolling_window(column_device_view input,
  *        will be used to gather MIN and MAX. And returns true if the
  *        operation was valid, else false.
  */
-template <typename InputType, typename OutputType, typename agg_op, aggregation::Kind op, bool has_nulls>
+template <typename InputType, typename OutputType, typename agg_op, aggregation::Kind op, typename PairIterator>
 std::enable_if_t<(op == aggregation::ARGMIN  or op == aggregation::ARGMAX) and
                  std::is_same<InputType, cudf::string_view>::value, bool>
 __device__
-process_rolling_window(column_device_view input,
+process_rolling_window(PairIterator input_begin,
                         mutable_column_device_view output,
                         size_type start_index,
                         size_type end_index,
@@ -104,8 +113,9 @@ process_rolling_window(column_device_view input,
     OutputType val_index = (op == aggregation::ARGMIN)? ARGMIN_SENTINEL : ARGMAX_SENTINEL;
 
     for (size_type j = start_index; j < end_index; j++) {
-        if (!has_nulls || input.is_valid(j)) {
-            InputType element = input.element<InputType>(j);
+        auto const pair = input_begin[j];
+        if (pair.second) {
+            InputType element = pair.first;
             val = agg_op{}(element, val);
             if (val == element) {
                 val_index = j;
@@ -128,11 +138,11 @@ process_rolling_window(column_device_view input,
  * @brief Operates on only fixed-width types and returns true if the
  *        operation was valid, else false.
  */
-template <typename InputType, typename OutputType, typename agg_op, aggregation::Kind op, bool has_nulls>
+template <typename InputType, typename OutputType, typename agg_op, aggregation::Kind op, typename PairIterator>
 std::enable_if_t<!std::is_same<InputType, cudf::string_view>::value and
                  !(op == aggregation::COUNT_VALID || op == aggregation::COUNT_ALL), bool>
 __device__
-process_rolling_window(column_device_view input,
+process_rolling_window(PairIterator input_begin,
                         mutable_column_device_view output,
                         size_type start_index,
                         size_type end_index,
@@ -146,8 +156,9 @@ process_rolling_window(column_device_view input,
     OutputType val = agg_op::template identity<OutputType>();
 
     for (size_type j = start_index; j < end_index; j++) {
-        if (!has_nulls || input.is_valid(j)) {
-            OutputType element = input.element<InputType>(j);
+        auto const pair = input_begin[j];
+        if (pair.second) {
+            OutputType element = pair.first;
             val = agg_op{}(element, val);
             count++;
         }
@@ -170,9 +181,12 @@ process_rolling_window(column_device_view input,
  * @tparam agg_op  A functor that defines the aggregation operation
  * @tparam op The aggregation operator (enum value)
  * @tparam block_size CUDA block size for the kernel
- * @tparam has_nulls true if the input column has nulls
+ * @tparam PairIterator iterator type over (value, validity) pairs (inferred);
+ *                a non-nullable input compiles with an iterator whose validity
+ *                is constant `true`, so the validity test folds away
  * @tparam WindowIterator iterator type (inferred)
- * @param input Input column device view
+ * @param input_begin Pair iterator over the input column's values and
+ *                validities
  * @param output Output column device view
  * @param preceding_window_begin[in] Rolling window size iterator, accumulates from
  *                in_col[i-preceding_window] to in_col[i] inclusive
@@ -183,11 +197,11 @@ process_rolling_window(column_device_view input,
  *                have a value, otherwise 0 is stored in the valid bit mask
  * @param identity identity value of `InputType`
  */
-template <typename InputType, typename OutputType, typename agg_op, aggregation::Kind op, 
-         int block_size, bool has_nulls, typename WindowIterator>
+template <typename InputType, typename OutputType, typename agg_op, aggregation::Kind op,
+         int block_size, typename PairIterator, typename WindowIterator>
 __launch_bounds__(block_size)
 __global__
-void gpu_rolling(column_device_view input,
+void gpu_rolling(PairIterator input_begin,
                  mutable_column_device_view output,
                  size_type * __restrict__ output_valid_count,
                  WindowIterator preceding_window_begin,
@@ -195,21 +209,22 @@ void gpu_rolling(column_device_view input,
                  size_type min_periods,
                  InputType identity)
 {
+  size_type const num_rows = output.size();
   size_type i = blockIdx.x * block_size + threadIdx.x;
   size_type stride = block_size * gridDim.x;
 
   size_type warp_valid_count{0};
 
-  auto active_threads = __ballot_sync(0xffffffff, i < input.size());
-  while(i < input.size())
+  auto active_threads = __ballot_sync(0xffffffff, i < num_rows);
+  while(i < num_rows)
   {
 
     size_type preceding_window = preceding_window_begin[i];
     size_type following_window = following_window_begin[i];
 
     // compute bounds
-    size_type start = min(input.size(), max(0, i - preceding_window + 1));
-    size_type end = min(input.size(), max(0, i + following_window + 1));
+    size_type start = min(num_rows, max(0, i - preceding_window + 1));
+    size_type end = min(num_rows, max(0, i + following_window + 1));
     size_type start_index = min(start, end);
     size_type end_index = max(start, end);
 
@@ -220,7 +235,7 @@ void gpu_rolling(column_device_view input,
 
     volatile bool output_is_valid = false;
     output_is_valid = process_rolling_window<InputType, OutputType, agg_op,
-                           op, has_nulls>(input, output, start_index, end_index, i, min_periods, identity); 
+                           op>(input_begin, output, start_index, end_index, i, min_periods, identity);
 
     // set the mask
     cudf::bitmask_type result_mask{__ballot_sync(active_threads, output_is_valid)};
@@ -231,9 +246,9 @@ void gpu_rolling(column_device_view input,
       warp_valid_count += __popc(result_mask);
     }
 
-    // process next element 
+    // process next element
     i += stride;
-    active_threads = __ballot_sync(active_threads, i < input.size());
+    active_threads = __ballot_sync(active_threads, i < num_rows);
   }
 
   // sum the valid counts across the whole block  
@@ -245,6 +260,117 @@ void gpu_rolling(column_device_view input,
   }
 }
 
+/**
+ * @brief Computes the rolling window function for small static windows,
+ *        staging the block's input range (plus halo) in shared memory.
+ *
+ * Each block processes a contiguous tile of `block_size` rows. The rows the
+ * tile's windows touch, `[tile_start - preceding_window + 1,
+ * tile_start + block_size + following_window)`, are loaded into shared memory
+ * once, so each input element is read from global memory once per tile
+ * instead of once per window it participates in.
+ *
+ * Only aggregations handled by the fixed-width `process_rolling_window`
+ * overload are supported; the aggregation loop is inlined here because it
+ * reads from the staged tile rather than the column device view.
+ *
+ * @tparam InputType  Datatype of `input`
+ * @tparam OutputType  Datatype of `output`
+ * @tparam agg_op  A functor that defines the aggregation operation
+ * @tparam op The aggregation operator (enum value)
+ * @tparam block_size CUDA block size for the kernel
+ * @tparam has_nulls true if the input column has nulls
+ * @param input Input column device view
+ * @param output Output column device view
+ * @param preceding_window[in] Static rolling window size, accumulates from
+ *                in_col[i-preceding_window] to in_col[i] inclusive
+ * @param following_window[in] Static rolling window size in the forward
+ *                direction, accumulates from in_col[i] to
+ *                in_col[i+following_window] inclusive
+ * @param min_periods[in]  Minimum number of observations in window required to
+ *                have a value, otherwise 0 is stored in the valid bit mask
+ */
+template <typename InputType, typename OutputType, typename agg_op, aggregation::Kind op,
+         int block_size, bool has_nulls>
+__launch_bounds__(block_size)
+__global__
+void gpu_rolling_tiled(column_device_view input,
+                       mutable_column_device_view output,
+                       size_type * __restrict__ output_valid_count,
+                       size_type preceding_window,
+                       size_type following_window,
+                       size_type min_periods)
+{
+  // double alignment covers every fixed-width type staged here
+  extern __shared__ double shared_storage[];
+  OutputType* const tile = reinterpret_cast<OutputType*>(shared_storage);
+
+  size_type const tile_extent = block_size + preceding_window - 1 + following_window;
+  bool* const tile_valid = reinterpret_cast<bool*>(tile + tile_extent);
+
+  // first input row any window of this tile can touch
+  size_type const tile_start = blockIdx.x * block_size - (preceding_window - 1);
+
+  // cooperatively stage the tile, including the halo on both sides; slots
+  // outside the column are never read back because the per-row bounds below
+  // are clamped to [0, input.size())
+  for (size_type s = threadIdx.x; s < tile_extent; s += block_size) {
+    size_type j = tile_start + s;
+    if (j >= 0 && j < input.size()) {
+      bool const valid = !has_nulls || input.is_valid(j);
+      if (valid) { tile[s] = static_cast<OutputType>(input.element<InputType>(j)); }
+      if (has_nulls) { tile_valid[s] = valid; }
+    }
+  }
+  __syncthreads();
+
+  size_type i = blockIdx.x * block_size + threadIdx.x;
+  size_type warp_valid_count{0};
+
+  auto active_threads = __ballot_sync(0xffffffff, i < input.size());
+  if (i < input.size())
+  {
+    size_type start_index = max(0, i - preceding_window + 1);
+    size_type end_index = min(input.size(), i + following_window + 1);
+
+    // declare this as volatile to avoid some compiler optimizations that lead to incorrect results
+    // for CUDA 10.0 and below (fixed in CUDA 10.1)
+    volatile cudf::size_type count = 0;
+    OutputType val = agg_op::template identity<OutputType>();
+
+    for (size_type j = start_index; j < end_index; j++) {
+        size_type s = j - tile_start;
+        if (!has_nulls || tile_valid[s]) {
+            val = agg_op{}(tile[s], val);
+            count++;
+        }
+    }
+
+    bool output_is_valid = (count >= min_periods);
+
+    // store the output value, one per thread
+    cudf::detail::store_output_functor<OutputType, op == aggregation::MEAN>{}(output.element<OutputType>(i),
+                val, count);
+
+    // set the mask
+    cudf::bitmask_type result_mask{__ballot_sync(active_threads, output_is_valid)};
+
+    // only one thread writes the mask
+    if (0 == threadIdx.x % cudf::experimental::detail::warp_size) {
+      output.set_mask_word(cudf::word_index(i), result_mask);
+      warp_valid_count += __popc(result_mask);
+    }
+  }
+
+  // sum the valid counts across the whole block
+  size_type block_valid_count =
+    cudf::experimental::detail::single_lane_block_sum_reduce<block_size, 0>(warp_valid_count);
+
+  if(threadIdx.x == 0) {
+    atomicAdd(output_valid_count, block_valid_count);
+  }
+}
+
 template <typename InputType>
 struct rolling_window_launcher
 {
@@ -268,13 +394,20 @@ struct rolling_window_launcher
 
       rmm::device_scalar<size_type> device_valid_count{0, stream};
 
+      // the pair iterator bakes the column's nullability into the kernel
+      // instantiation: the non-nullable iterator's validity is a constant
+      // `true`, so validity handling is hoisted out of the aggregation loops
       if (input.has_nulls()) {
-          gpu_rolling<T, target_type_t<InputType, op>, agg_op, op, block_size, true><<<grid.num_blocks, block_size, 0, stream>>>
-              (*input_device_view, *output_device_view, device_valid_count.data(),
+          auto input_pair_begin =
+            cudf::experimental::detail::make_pair_iterator<T, true>(*input_device_view);
+          gpu_rolling<T, target_type_t<InputType, op>, agg_op, op, block_size><<<grid.num_blocks, block_size, 0, stream>>>
+              (input_pair_begin, *output_device_view, device_valid_count.data(),
                preceding_window_begin, following_window_begin, min_periods, identity);
       } else {
-          gpu_rolling<T, target_type_t<InputType, op>, agg_op, op, block_size, false><<<grid.num_blocks, block_size, 0, stream>>>
-              (*input_device_view, *output_device_view, device_valid_count.data(),
+          auto input_pair_begin =
+            cudf::experimental::detail::make_pair_iterator<T, false>(*input_device_view);
+          gpu_rolling<T, target_type_t<InputType, op>, agg_op, op, block_size><<<grid.num_blocks, block_size, 0, stream>>>
+              (input_pair_begin, *output_device_view, device_valid_count.data(),
                preceding_window_begin, following_window_begin, min_periods, identity);
       }
 
@@ -432,6 +565,141 @@ struct rolling_window_launcher
 
 };
 
+template <typename InputType>
+struct tiled_rolling_launcher
+{
+
+  template <typename T, typename agg_op, aggregation::Kind op>
+  size_type kernel_launcher(column_view const& input,
+                       mutable_column_view& output,
+                       size_type preceding_window,
+                       size_type following_window,
+                       size_type min_periods,
+                       cudaStream_t stream) {
+      cudf::nvtx::range_push("CUDF_ROLLING_WINDOW", cudf::nvtx::color::ORANGE);
+
+      constexpr cudf::size_type block_size = 256;
+      cudf::experimental::detail::grid_1d grid(input.size(), block_size);
+
+      auto input_device_view = column_device_view::create(input, stream);
+      auto output_device_view = mutable_column_device_view::create(output, stream);
+
+      rmm::device_scalar<size_type> device_valid_count{0, stream};
+
+      using OutputType = target_type_t<InputType, op>;
+      size_type tile_extent = block_size + preceding_window - 1 + following_window;
+      size_t shared_bytes = tile_extent * sizeof(OutputType);
+
+      if (input.has_nulls()) {
+          shared_bytes += tile_extent * sizeof(bool);
+          gpu_rolling_tiled<T, OutputType, agg_op, op, block_size, true><<<grid.num_blocks, block_size, shared_bytes, stream>>>
+              (*input_device_view, *output_device_view, device_valid_count.data(),
+               preceding_window, following_window, min_periods);
+      } else {
+          gpu_rolling_tiled<T, OutputType, agg_op, op, block_size, false><<<grid.num_blocks, block_size, shared_bytes, stream>>>
+              (*input_device_view, *output_device_view, device_valid_count.data(),
+               preceding_window, following_window, min_periods);
+      }
+
+      size_type valid_count = device_valid_count.value(stream);
+
+      // check the stream for debugging
+      CHECK_CUDA(stream);
+
+      cudf::nvtx::range_pop();
+
+      return valid_count;
+  }
+
+  // This launch is only for fixed width columns with valid aggregation option
+  template <typename T, typename agg_op, aggregation::Kind op>
+  std::enable_if_t<(cudf::detail::is_supported<T, agg_op,
+                                  op, op == aggregation::MEAN>()) and
+                   !(cudf::detail::is_string_supported<T, agg_op, op>()), std::unique_ptr<column>>
+  launch(column_view const& input,
+         size_type preceding_window,
+         size_type following_window,
+         size_type min_periods,
+         std::unique_ptr<aggregation> const& agg,
+         rmm::mr::device_memory_resource *mr,
+         cudaStream_t stream) {
+
+      if (input.is_empty()) return empty_like(input);
+
+      auto output = make_fixed_width_column(target_type(input.type(), op), input.size(),
+              mask_state::UNINITIALIZED, stream, mr);
+
+      cudf::mutable_column_view output_view = output->mutable_view();
+      auto valid_count = kernel_launcher<T, agg_op, op>(input, output_view, preceding_window,
+              following_window, min_periods, stream);
+
+      output->set_null_count(output->size() - valid_count);
+
+      return output;
+  }
+
+  // Deals with invalid column and/or aggregation options; unreachable because
+  // the tiled path is only selected for numeric columns and value-reading
+  // aggregations
+  template <typename T, typename agg_op, aggregation::Kind op>
+  std::enable_if_t<!(cudf::detail::is_supported<T, agg_op,
+                                  op, op == aggregation::MEAN>()) or
+                   (cudf::detail::is_string_supported<T, agg_op, op>()), std::unique_ptr<column>>
+  launch(column_view const& input,
+         size_type preceding_window,
+         size_type following_window,
+         size_type min_periods,
+         std::unique_ptr<aggregation> const& agg,
+         rmm::mr::device_memory_resource *mr,
+         cudaStream_t stream) {
+
+      CUDF_FAIL("Aggregation operator and/or input type combination is invalid");
+  }
+
+
+  template<aggregation::Kind op>
+  std::enable_if_t<!(op == aggregation::MEAN), std::unique_ptr<column>>
+  operator()(column_view const& input,
+                                     size_type preceding_window,
+                                     size_type following_window,
+                                     size_type min_periods,
+                                     std::unique_ptr<aggregation> const& agg,
+                                     rmm::mr::device_memory_resource *mr,
+                                     cudaStream_t stream)
+  {
+      return launch <InputType, typename corresponding_operator<op>::type, op> (
+              input,
+              preceding_window,
+              following_window,
+              min_periods,
+              agg,
+              mr,
+              stream);
+  }
+
+  // This variant is just to handle mean
+  template<aggregation::Kind op>
+  std::enable_if_t<(op == aggregation::MEAN), std::unique_ptr<column>>
+  operator()(column_view const& input,
+                                     size_type preceding_window,
+                                     size_type following_window,
+                                     size_type min_periods,
+                                     std::unique_ptr<aggregation> const& agg,
+                                     rmm::mr::device_memory_resource *mr,
+                                     cudaStream_t stream) {
+
+      return launch <InputType, cudf::DeviceSum, op> (
+              input,
+              preceding_window,
+              following_window,
+              min_periods,
+              agg,
+              mr,
+              stream);
+  }
+
+};
+
 struct dispatch_rolling {
     template <typename T, typename WindowIterator>
     std::unique_ptr<column> operator()(column_view const& input,
@@ -449,8 +717,91 @@ struct dispatch_rolling {
     }
 };
 
+struct dispatch_tiled_rolling {
+    template <typename T>
+    std::unique_ptr<column> operator()(column_view const& input,
+                                     size_type preceding_window,
+                                     size_type following_window,
+                                     size_type min_periods,
+                                     std::unique_ptr<aggregation> const& agg,
+                                     rmm::mr::device_memory_resource *mr,
+                                     cudaStream_t stream) {
+
+        return aggregation_dispatcher(agg->kind, tiled_rolling_launcher<T>{},
+                                      input,
+                                      preceding_window, following_window,
+                                      min_periods, agg, mr, stream);
+    }
+};
+
 } // namespace anonymous
 
+// Largest input range, in rows, a block may stage for the tiled rolling
+// kernel. Chosen so the tile fits the default 48KB shared memory budget with
+// the widest fixed-width type plus its validity bytes.
+constexpr size_type max_tiled_window_extent = 4096;
+
+/**
+ * @brief Indicates whether the tiled shared-memory rolling kernel can be used
+ * for a static window.
+ *
+ * Only aggregations that read every window element benefit from staging the
+ * input in shared memory, and the staged tile (block plus halo) must fit the
+ * shared memory budget.
+ */
+bool is_tiled_rolling_supported(column_view const& input,
+                                size_type preceding_window,
+                                size_type following_window,
+                                std::unique_ptr<aggregation> const& agg)
+{
+  bool const supported_agg = agg->kind == aggregation::SUM ||
+                             agg->kind == aggregation::MIN ||
+                             agg->kind == aggregation::MAX ||
+                             agg->kind == aggregation::MEAN;
+
+  constexpr size_type block_size = 256; // must match the tiled kernel launch
+
+  return supported_agg && is_numeric(input.type()) &&
+         preceding_window >= 1 && following_window >= 0 &&
+         (block_size + preceding_window - 1 + following_window) <= max_tiled_window_extent;
+}
+
+/**
+ * @brief Applies a static rolling window function using the tiled
+ * shared-memory kernel.
+ *
+ * Callers must check `is_tiled_rolling_supported()` first.
+ */
+std::unique_ptr<column> rolling_window_tiled(column_view const& input,
+                                             size_type preceding_window,
+                                             size_type following_window,
+                                             size_type min_periods,
+                                             std::unique_ptr<aggregation> const& agg,
+                                             rmm::mr::device_memory_resource* mr,
+                                             cudaStream_t stream = 0)
+{
+  static_assert(warp_size == cudf::detail::size_in_bits<cudf::bitmask_type>(),
+                "bitmask_type size does not match CUDA warp size");
+
+  min_periods = std::max(min_periods, 0);
+
+  return cudf::experimental::type_dispatcher(input.type(),
+                                             dispatch_tiled_rolling{},
+                                             input,
+                                             preceding_window,
+                                             following_window,
+                                             min_periods, agg, mr, stream);
+}
+
+// Stringifies a statically known window size into a kernel template argument
+// so the JIT kernel specializes on it (the fixed trip count lets the compiler
+// unroll the aggregation loop). Runtime per-element windows compile with the
+// sentinel -1 and read their sizes from memory as before.
+std::string jit_window_size(size_type window) { return std::to_string(window); }
+
+template <typename WindowIterator>
+std::string jit_window_size(WindowIterator) { return std::string{"-1"}; }
+
 // Applies a user-defined rolling window function to the values in a column.
 template <bool static_window, typename WindowIterator>
 std::unique_ptr<column> rolling_window_udf(column_view const &input,
@@ -508,7 +859,14 @@ std::unique_ptr<column> rolling_window_udf(column_view const &input,
     "-w"
   };
 
-  // Launch the jitify kernel
+  // Warm the in-memory kernel cache from the file cache in the background so
+  // previously compiled rolling UDFs (including other window sizes of this
+  // one) skip NVRTC entirely
+  cudf::jit::cudfJitCache::Instance().preloadFileCacheAsync();
+
+  // Launch the jitify kernel. The window sizes participate in the kernel
+  // instantiation (and therefore in the cache key), so each static window
+  // spec gets its own specialized, unrollable kernel
   cudf::jit::launcher(hash, cuda_source,
                       { cudf_types_hpp, cudf_utilities_bit_hpp,
                         cudf::experimental::rolling::jit::code::operation_h },
@@ -517,7 +875,9 @@ std::unique_ptr<column> rolling_window_udf(column_view const &input,
                       { cudf::jit::get_type_name(input.type()), // list of template arguments
                         cudf::jit::get_type_name(output->type()),
                         udf_agg->_operator_name,
-                        static_window ? "cudf::size_type" : "cudf::size_type*"})
+                        static_window ? "cudf::size_type" : "cudf::size_type*",
+                        static_window ? jit_window_size(preceding_window) : "-1",
+                        static_window ? jit_window_size(following_window) : "-1"})
     .launch(input.size(), cudf::jit::get_data_ptr(input), input.null_mask(),
             cudf::jit::get_data_ptr(output_view), output_view.null_mask(),
             device_valid_count.data(), preceding_window, following_window, min_periods);
@@ -566,6 +926,64 @@ std::unique_ptr<column> rolling_window(column_view const& input,
 
 }
 
+/**
+ * @brief Dispatches a time-range rolling window on the order-by column's
+ * timestamp type.
+ *
+ * The per-row window bounds are found by binary search on the sorted
+ * timestamps from inside the rolling kernel, via the window iterators, so no
+ * intermediate window-size columns are materialized.
+ */
+struct dispatch_time_range_rolling {
+    template <typename OrderbyType, typename... Args>
+    std::enable_if_t<!cudf::is_timestamp<OrderbyType>(), std::unique_ptr<column>>
+    operator()(Args&&... args) {
+        CUDF_FAIL("Time-range rolling window requires a timestamp order-by column");
+    }
+
+    template <typename OrderbyType>
+    std::enable_if_t<cudf::is_timestamp<OrderbyType>(), std::unique_ptr<column>>
+    operator()(column_view const& orderby,
+               column_view const& input,
+               size_type preceding_window,
+               size_type following_window,
+               size_type min_periods,
+               std::unique_ptr<aggregation> const& agg,
+               rmm::mr::device_memory_resource *mr,
+               cudaStream_t stream) {
+
+        using Duration = typename OrderbyType::duration;
+
+        auto const* d_orderby = orderby.data<OrderbyType>();
+        size_type const num_rows = orderby.size();
+
+        // Element `i`'s window spans every row whose timestamp lies within
+        // [orderby[i] - preceding, orderby[i] + following]; the first and
+        // last such rows are found by binary search on the sorted timestamps
+        auto preceding_calculator =
+          [d_orderby, num_rows, preceding_window] __device__ (size_type i) {
+            auto const lowest = d_orderby[i] - Duration{preceding_window};
+            size_type const start = thrust::lower_bound(thrust::seq, d_orderby,
+                                      d_orderby + num_rows, lowest) - d_orderby;
+            return i - start + 1;
+          };
+        auto following_calculator =
+          [d_orderby, num_rows, following_window] __device__ (size_type i) {
+            auto const highest = d_orderby[i] + Duration{following_window};
+            size_type const end = thrust::upper_bound(thrust::seq, d_orderby,
+                                    d_orderby + num_rows, highest) - d_orderby;
+            return end - i - 1;
+          };
+
+        return cudf::experimental::detail::rolling_window(input,
+          thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                          preceding_calculator),
+          thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                          following_calculator),
+          min_periods, agg, mr, stream);
+    }
+};
+
 } // namespace detail
 
 // Applies a fixed-size rolling window function to the values in a column.
@@ -585,6 +1003,15 @@ std::unique_ptr<column> rolling_window(column_view const& input,
                                                                 preceding_window,
                                                                 following_window,
                                                                 min_periods, agg, mr, 0);
+  } else if (cudf::experimental::detail::is_tiled_rolling_supported(input, preceding_window,
+                                                                    following_window, agg)) {
+    // small static windows are served by a tiled kernel that stages each
+    // block's input range in shared memory instead of re-reading every
+    // window element from global memory
+    return cudf::experimental::detail::rolling_window_tiled(input,
+                                                            preceding_window,
+                                                            following_window,
+                                                            min_periods, agg, mr, 0);
   } else {
     auto preceding_window_begin = thrust::make_constant_iterator(preceding_window);
     auto following_window_begin = thrust::make_constant_iterator(following_window);
@@ -596,6 +1023,61 @@ std::unique_ptr<column> rolling_window(column_view const& input,
   }
 }
 
+// Applies a fixed-size rolling window function to the values in a column,
+// clamping each element's window at the boundaries of its group.
+std::unique_ptr<column> grouped_rolling_window(table_view const& group_keys,
+                                               column_view const& input,
+                                               size_type preceding_window,
+                                               size_type following_window,
+                                               size_type min_periods,
+                                               std::unique_ptr<aggregation> const& agg,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  if (input.size() == 0) return empty_like(input);
+  CUDF_EXPECTS((min_periods >= 0), "min_periods must be non-negative");
+  CUDF_EXPECTS(group_keys.num_rows() == input.size(),
+               "Size mismatch between group_keys and input");
+  CUDF_EXPECTS(agg->kind != aggregation::CUDA && agg->kind != aggregation::PTX,
+               "Grouped rolling window does not support UDF aggregations");
+
+  if (group_keys.num_columns() == 0) {
+    return rolling_window(input, preceding_window, following_window,
+                          min_periods, agg, mr);
+  }
+
+  // The keys are required to be pre-grouped, so the helper only computes the
+  // offsets and labels of the existing runs; no sort is performed
+  using sort_helper = cudf::experimental::groupby::detail::sort::sort_groupby_helper;
+  sort_helper helper{group_keys, include_nulls::YES, sorted::YES};
+  auto const& group_offsets = helper.group_offsets();
+  auto const& group_labels = helper.group_labels();
+
+  size_type const* d_group_offsets = group_offsets.data().get();
+  size_type const* d_group_labels = group_labels.data().get();
+
+  // Per-element window sizes clamped to the element's group: element `i` of
+  // group `g` may look back no further than the first row of `g` and ahead
+  // no further than its last row
+  auto preceding_calculator =
+    [d_group_offsets, d_group_labels, preceding_window] __device__ (size_type i) {
+      auto group_start = d_group_offsets[d_group_labels[i]];
+      return thrust::minimum<size_type>{}(preceding_window, i - group_start + 1);
+    };
+  auto following_calculator =
+    [d_group_offsets, d_group_labels, following_window] __device__ (size_type i) {
+      auto group_end = d_group_offsets[d_group_labels[i] + 1];
+      return thrust::minimum<size_type>{}(following_window, (group_end - 1) - i);
+    };
+
+  return cudf::experimental::detail::rolling_window(input,
+    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                    preceding_calculator),
+    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                    following_calculator),
+    min_periods, agg, mr, 0);
+}
+
 // Applies a variable-size rolling window function to the values in a column.
 std::unique_ptr<column> rolling_window(column_view const& input,
                                        column_view const& preceding_window,
@@ -626,5 +1108,31 @@ std::unique_ptr<column> rolling_window(column_view const& input,
   }
 }
 
-} // namespace experimental 
+// Applies a range-based rolling window function to the values in a column,
+// with window bounds computed from a timestamp order-by column.
+std::unique_ptr<column> time_range_rolling_window(column_view const& orderby,
+                                                  column_view const& input,
+                                                  size_type preceding_window,
+                                                  size_type following_window,
+                                                  size_type min_periods,
+                                                  std::unique_ptr<aggregation> const& agg,
+                                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  if (input.size() == 0) return empty_like(input);
+  CUDF_EXPECTS((min_periods >= 0), "min_periods must be non-negative");
+  CUDF_EXPECTS(orderby.size() == input.size(),
+               "Size mismatch between orderby and input");
+  CUDF_EXPECTS(not orderby.has_nulls(), "orderby column cannot contain nulls");
+  CUDF_EXPECTS(agg->kind != aggregation::CUDA && agg->kind != aggregation::PTX,
+               "Time-range rolling window does not support UDF aggregations");
+
+  return cudf::experimental::type_dispatcher(orderby.type(),
+                                             detail::dispatch_time_range_rolling{},
+                                             orderby, input,
+                                             preceding_window, following_window,
+                                             min_periods, agg, mr, 0);
+}
+
+} // namespace experimental
 } // namespace cudf
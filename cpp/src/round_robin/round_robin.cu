@@ -24,11 +24,16 @@
 #include <cudf/null_mask.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/copy.hpp>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/utilities/traits.hpp>
 
 #include <thrust/execution_policy.h>
+#include <thrust/binary_search.h>
 #include <thrust/for_each.h>
+#include <thrust/host_vector.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 #include <thrust/tuple.h>
@@ -160,6 +165,76 @@ degenerate_partitions(cudf::table_view const& input,
     return ret_pair;
   }
 }
+//must match the buffer alignment used by contiguous_split()
+//so consumers see identical per-partition layouts:
+//
+static constexpr size_t contiguous_align = 64;
+
+/**
+ * @brief Deals every row directly into its partition's contiguous buffer.
+ *
+ * One y-block per column, x-blocks grid-striding over the output rows. Each
+ * output row computes its round-robin source row with the same closed form the
+ * gather path uses, locates its destination partition by upper_bound on the
+ * partition offsets, and writes data (bytewise, driven by per-column element
+ * sizes) and validity straight into that partition's buffer. This replaces the
+ * gather-into-a-full-table pass that contiguous_split() would otherwise
+ * re-materialize.
+ */
+template <bool has_validity>
+__global__ void round_robin_contiguous_kernel(
+    cudf::column_device_view const* input_views,
+    cudf::mutable_column_device_view* output_views, //[partition][column]
+    cudf::size_type const* partition_offsets,       //num_partitions+1 entries
+    cudf::size_type const* element_sizes,
+    cudf::size_type num_columns,
+    cudf::size_type num_partitions,
+    cudf::size_type nrows,
+    cudf::size_type max_partition_size,
+    cudf::size_type num_partitions_max_size,
+    cudf::size_type total_max_partitions_size,
+    cudf::size_type delta)
+{
+  auto const col = blockIdx.y;
+  auto const& input = input_views[col];
+  auto const element_size = element_sizes[col];
+  char const* input_data = input.head<char>();
+
+  cudf::size_type out_row = threadIdx.x + blockIdx.x * blockDim.x;
+  while (out_row < nrows) {
+    //same permutation the gather path computes (see iter_begin below):
+    //
+    auto rotated_index = (out_row + nrows - delta) % nrows;
+    auto index_within_partition = (rotated_index <= total_max_partitions_size ? rotated_index % max_partition_size: (rotated_index - total_max_partitions_size) % (max_partition_size-1) );
+    auto partition_index = (rotated_index <= total_max_partitions_size ? rotated_index / max_partition_size: num_partitions_max_size + (rotated_index - total_max_partitions_size) / (max_partition_size-1) );
+    auto src_row = num_partitions * index_within_partition + partition_index;
+
+    //destination partition and row within it:
+    //
+    auto p = thrust::upper_bound(thrust::seq,
+                                 partition_offsets,
+                                 partition_offsets + num_partitions + 1,
+                                 out_row)
+             - partition_offsets - 1;
+    auto const& out = output_views[p * num_columns + col];
+    auto dst_row = out_row - partition_offsets[p];
+
+    char const* src = input_data + (input.offset() + src_row) * element_size;
+    char* dst = out.head<char>() + dst_row * element_size;
+    for (cudf::size_type b = 0; b < element_size; b++) { dst[b] = src[b]; }
+
+    if (has_validity and out.nullable()) {
+      if (input.is_valid(src_row)) {
+        out.set_valid(dst_row);
+      } else {
+        out.set_null(dst_row);
+      }
+    }
+
+    out_row += blockDim.x * gridDim.x;
+  }
+}
+
 } //anonym.
 
 namespace cudf {
@@ -261,7 +336,153 @@ round_robin_partition(table_view const& input,
 
   return ret_pair;
 }
-  
+
+std::vector<contiguous_split_result>
+round_robin_partition_contiguous(table_view const& input,
+                                 cudf::size_type num_partitions,
+                                 cudf::size_type start_partition = 0,
+                                 rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                                 cudaStream_t stream = 0)
+{
+  auto nrows = input.num_rows();
+  auto num_columns = input.num_columns();
+
+  CUDF_EXPECTS( num_partitions > 0, "Incorrect number of partitions. Must be greater than 0." );
+  CUDF_EXPECTS( start_partition < num_partitions, "Incorrect start_partition index. Must be less than number of partitions." );
+  CUDF_EXPECTS( start_partition >= 0, "Incorrect start_partition index. Must be positive." );
+
+  bool const all_fixed_width =
+    std::all_of(input.begin(), input.end(),
+                [] (auto const& col) { return cudf::is_fixed_width(col.type()); });
+
+  //the fused path only handles the common (non-degenerate, fixed-width) case;
+  //otherwise fall back to partitioning followed by contiguous_split():
+  //
+  if (num_partitions >= nrows || not all_fixed_width) {
+    auto partitioned =
+      detail::round_robin_partition(input, num_partitions, start_partition, mr, stream);
+    std::vector<cudf::size_type> splits(partitioned.second.begin() + 1,
+                                        partitioned.second.end());
+    return detail::contiguous_split(partitioned.first->view(), splits, mr, stream);
+  }
+
+  auto np_max_size = nrows % num_partitions;
+  auto num_partitions_max_size = (np_max_size > 0 ? np_max_size : num_partitions);
+  cudf::size_type max_partition_size = std::ceil( static_cast<double>(nrows) / static_cast<double>(num_partitions));
+  auto total_max_partitions_size = num_partitions_max_size * max_partition_size;
+  auto num_partitions_min_size = num_partitions - num_partitions_max_size;
+  auto delta = (start_partition > num_partitions_min_size?
+                num_partitions_min_size*(max_partition_size-1) + (start_partition - num_partitions_min_size)*max_partition_size :
+                start_partition*(max_partition_size-1));
+
+  //partition offsets, computed on host exactly as the gather path does:
+  //
+  auto rotated_iter_begin =
+    thrust::make_transform_iterator(thrust::make_counting_iterator<cudf::size_type>(0),
+                                    [num_partitions, start_partition, max_partition_size, num_partitions_max_size] (auto index){
+                                      return ((index + num_partitions - start_partition) % num_partitions < num_partitions_max_size? max_partition_size : max_partition_size-1);
+                                    });
+  std::vector<cudf::size_type> partition_offsets(num_partitions + 1);
+  thrust::exclusive_scan(thrust::host,
+                         rotated_iter_begin, rotated_iter_begin + num_partitions,
+                         partition_offsets.begin());
+  partition_offsets[num_partitions] = nrows;
+
+  bool const has_validity =
+    std::any_of(input.begin(), input.end(),
+                [] (auto const& col) { return col.has_nulls(); });
+
+  //allocate one contiguous buffer per partition, laid out like
+  //contiguous_split(): per column, data then (if the input column has nulls)
+  //validity, each rounded up to the alignment boundary:
+  //
+  std::vector<contiguous_split_result> result;
+  result.reserve(num_partitions);
+
+  using CDViewPtr = decltype(column_device_view::create(
+      std::declval<column_view>(), std::declval<cudaStream_t>()));
+  using MCDViewPtr = decltype(mutable_column_device_view::create(
+      std::declval<mutable_column_view>(), std::declval<cudaStream_t>()));
+  auto input_view_owners = std::vector<CDViewPtr>{};
+  auto output_view_owners = std::vector<MCDViewPtr>{};
+  auto input_views = thrust::host_vector<column_device_view>();
+  auto output_views = thrust::host_vector<mutable_column_device_view>();
+  auto element_sizes = thrust::host_vector<cudf::size_type>();
+
+  for (auto const& col : input) {
+    auto owner = column_device_view::create(col, stream);
+    input_views.push_back(*owner);
+    input_view_owners.push_back(std::move(owner));
+    element_sizes.push_back(cudf::size_of(col.type()));
+  }
+
+  for (cudf::size_type p = 0; p < num_partitions; ++p) {
+    auto const partition_size = partition_offsets[p + 1] - partition_offsets[p];
+
+    size_t buf_size = 0;
+    for (cudf::size_type i = 0; i < num_columns; ++i) {
+      buf_size += cudf::util::round_up_safe(
+          partition_size * static_cast<size_t>(element_sizes[i]), contiguous_align);
+      if (input.column(i).has_nulls()) {
+        buf_size += cudf::bitmask_allocation_size_bytes(partition_size, contiguous_align);
+      }
+    }
+
+    auto buffer = std::make_unique<rmm::device_buffer>(buf_size, stream, mr);
+    char* cursor = static_cast<char*>(buffer->data());
+
+    std::vector<column_view> out_cols;
+    out_cols.reserve(num_columns);
+    for (cudf::size_type i = 0; i < num_columns; ++i) {
+      auto const& col = input.column(i);
+      char* data = cursor;
+      cursor += cudf::util::round_up_safe(
+          partition_size * static_cast<size_t>(element_sizes[i]), contiguous_align);
+      bitmask_type* mask = nullptr;
+      if (col.has_nulls()) {
+        mask = reinterpret_cast<bitmask_type*>(cursor);
+        cursor += cudf::bitmask_allocation_size_bytes(partition_size, contiguous_align);
+      }
+
+      auto out_col = mutable_column_view{col.type(), partition_size, data,
+                                         mask, cudf::UNKNOWN_NULL_COUNT};
+      auto owner = mutable_column_device_view::create(out_col, stream);
+      output_views.push_back(*owner);
+      output_view_owners.push_back(std::move(owner));
+
+      out_cols.push_back(column_view{col.type(), partition_size, data,
+                                     mask, cudf::UNKNOWN_NULL_COUNT});
+    }
+
+    result.push_back(contiguous_split_result{table_view{out_cols}, std::move(buffer)});
+  }
+
+  auto const d_input_views = rmm::device_vector<column_device_view>{input_views};
+  auto d_output_views = rmm::device_vector<mutable_column_device_view>{output_views};
+  auto const d_element_sizes = rmm::device_vector<cudf::size_type>{element_sizes};
+  auto const d_partition_offsets = rmm::device_vector<cudf::size_type>{partition_offsets};
+
+  constexpr cudf::size_type block_size = 256;
+  cudf::experimental::detail::grid_1d config(nrows, block_size);
+  dim3 const grid{static_cast<unsigned int>(config.num_blocks),
+                  static_cast<unsigned int>(num_columns)};
+  auto const kernel = has_validity
+      ? round_robin_contiguous_kernel<true>
+      : round_robin_contiguous_kernel<false>;
+  kernel<<<grid, block_size, 0, stream>>>(
+      d_input_views.data().get(),
+      d_output_views.data().get(),
+      d_partition_offsets.data().get(),
+      d_element_sizes.data().get(),
+      num_columns, num_partitions, nrows,
+      max_partition_size, num_partitions_max_size,
+      total_max_partitions_size, delta);
+
+  CHECK_CUDA(stream);
+
+  return result;
+}
+
 }  // namespace detail
 
 std::pair<std::unique_ptr<cudf::experimental::table>, std::vector<cudf::size_type>>
@@ -273,6 +494,16 @@ round_robin_partition(table_view const& input,
   CUDF_FUNC_RANGE();
   return cudf::experimental::detail::round_robin_partition(input, num_partitions, start_partition, mr);
 }
-  
+
+std::vector<contiguous_split_result>
+round_robin_partition_contiguous(table_view const& input,
+                                 cudf::size_type num_partitions,
+                                 cudf::size_type start_partition,
+                                 rmm::mr::device_memory_resource* mr) {
+
+  CUDF_FUNC_RANGE();
+  return cudf::experimental::detail::round_robin_partition_contiguous(input, num_partitions, start_partition, mr);
+}
+
 }  // namespace experimental
 }  // namespace cudf
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/scalar/scalar_pool.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <utilities/pinned_host_pool.hpp>
+
+namespace cudf {
+namespace {
+
+/**
+ * @brief Writes each staged value and validity bool into its scalar's
+ * device storage, one thread per scalar
+ */
+__global__ void scatter_scalars_kernel(scalar_pool::slot const* slots,
+                                       size_t count) {
+  auto const idx = threadIdx.x + blockIdx.x * static_cast<size_t>(blockDim.x);
+  if (idx >= count) {
+    return;
+  }
+  auto const& entry = slots[idx];
+  auto dst = static_cast<char*>(entry.data);
+  for (int32_t i = 0; i < entry.width; ++i) {
+    dst[i] = entry.value[i];
+  }
+  *entry.validity = entry.is_valid;
+}
+
+}  // namespace
+
+scalar_pool::scalar_pool(cudaStream_t stream) : _stream(stream) {}
+
+scalar_pool::~scalar_pool() {
+  try {
+    flush();
+  } catch (...) {
+  }
+  if (_staging != nullptr) {
+    // all uploads from the staging block must drain before it is returned
+    cudaStreamSynchronize(_stream);
+    detail::pinned_host_pool::instance().release(_staging);
+  }
+  if (_upload_done != nullptr) {
+    cudaEventDestroy(_upload_done);
+  }
+}
+
+void scalar_pool::flush() {
+  if (_staged.empty()) {
+    return;
+  }
+  auto const bytes = _staged.size() * sizeof(slot);
+
+  if (_upload_done == nullptr) {
+    CUDA_TRY(cudaEventCreateWithFlags(&_upload_done, cudaEventDisableTiming));
+  } else {
+    // the staging block can't be refilled until its previous upload has drained
+    CUDA_TRY(cudaEventSynchronize(_upload_done));
+  }
+  if (_staging_size < bytes) {
+    detail::pinned_host_pool::instance().release(_staging);
+    _staging = detail::pinned_host_pool::instance().acquire(bytes);
+    _staging_size = bytes;
+  }
+  std::memcpy(_staging, _staged.data(), bytes);
+
+  if (_slots.size() < bytes) {
+    _slots.resize(bytes, _stream);
+  }
+  CUDA_TRY(cudaMemcpyAsync(_slots.data(), _staging, bytes,
+                           cudaMemcpyHostToDevice, _stream));
+  CUDA_TRY(cudaEventRecord(_upload_done, _stream));
+
+  constexpr size_t block_size = 256;
+  auto const num_blocks = (_staged.size() + block_size - 1) / block_size;
+  scatter_scalars_kernel<<<num_blocks, block_size, 0, _stream>>>(
+      static_cast<slot const*>(_slots.data()), _staged.size());
+  CUDA_TRY(cudaGetLastError());
+
+  _staged.clear();
+}
+
+}  // namespace cudf
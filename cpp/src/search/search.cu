@@ -15,6 +15,7 @@
  */
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/search.hpp>
 #include <cudf/legacy/copying.hpp>
 #include <cudf/table/row_operators.cuh>
@@ -31,8 +32,13 @@
 #include <strings/utilities.hpp>
 
 #include <thrust/binary_search.h>
+#include <thrust/for_each.h>
+#include <thrust/host_vector.h>
 #include <thrust/logical.h>
 
+#include <functional>
+#include <limits>
+
 namespace cudf {
 namespace experimental {
 
@@ -123,6 +129,179 @@ std::unique_ptr<column> search_ordered(table_view const& t,
   return result;
 }
 
+// Searches one needle of one (haystack, needles) pair per invocation so a
+// single launch covers every pair. Each needle locates its pair through the
+// prefix-summed needle counts, then binary searches its own haystack with
+// the pair's sort order and null precedence.
+template <bool has_nulls>
+struct batched_search_fn {
+  column_device_view const* d_haystacks;
+  column_device_view const* d_needles;
+  size_type const* d_offsets;           ///< prefix sums of needle counts
+  order const* d_column_order;          ///< may be null: all ascending
+  null_order const* d_null_precedence;  ///< may be null: all BEFORE
+  bool find_first;
+  size_type* d_results;
+
+  __device__ void operator()(size_type idx) const {
+    size_type pair = 0;
+    while (idx >= d_offsets[pair + 1]) {
+      ++pair;
+    }
+    auto const needle_index = idx - d_offsets[pair];
+    auto const& haystack = d_haystacks[pair];
+    bool const ascending =
+        (d_column_order == nullptr) or (d_column_order[pair] == order::ASCENDING);
+    null_order const null_precedence = (d_null_precedence == nullptr)
+                                           ? null_order::BEFORE
+                                           : d_null_precedence[pair];
+    auto comparator = element_relational_comparator<has_nulls>(
+        haystack, d_needles[pair], null_precedence);
+
+    size_type lower = 0;
+    size_type upper = haystack.size();
+    while (lower < upper) {
+      auto const mid = lower + (upper - lower) / 2;
+      auto const state = cudf::experimental::type_dispatcher(
+          haystack.type(), comparator, mid, needle_index);
+      bool const advance =
+          find_first
+              ? state == (ascending ? weak_ordering::LESS : weak_ordering::GREATER)
+              : state != (ascending ? weak_ordering::GREATER : weak_ordering::LESS);
+      if (advance) {
+        lower = mid + 1;
+      } else {
+        upper = mid;
+      }
+    }
+    d_results[idx] = lower;
+  }
+};
+
+std::unique_ptr<column> batched_search_ordered(std::vector<column_view> const& haystacks,
+                                               std::vector<column_view> const& needles,
+                                               bool find_first,
+                                               std::vector<order> const& column_order,
+                                               std::vector<null_order> const& null_precedence,
+                                               rmm::mr::device_memory_resource *mr,
+                                               cudaStream_t stream = 0)
+{
+  CUDF_EXPECTS(haystacks.size() == needles.size(),
+               "Mismatched number of haystack and needle columns.");
+  auto const num_pairs = static_cast<size_type>(haystacks.size());
+
+  if (not column_order.empty()) {
+    CUDF_EXPECTS(column_order.size() == haystacks.size(),
+                 "Mismatch between number of pairs and column order.");
+  }
+  if (not null_precedence.empty()) {
+    CUDF_EXPECTS(null_precedence.size() == haystacks.size(),
+                 "Mismatch between number of pairs and null precedence.");
+  }
+
+  std::vector<size_type> h_offsets(num_pairs + 1, 0);
+  for (size_type i = 0; i < num_pairs; ++i) {
+    CUDF_EXPECTS(haystacks[i].type() == needles[i].type(), "DTYPE mismatch");
+    h_offsets[i + 1] = h_offsets[i] + needles[i].size();
+  }
+  auto const total_needles = h_offsets.back();
+
+  std::unique_ptr<column> result = make_numeric_column(data_type{experimental::type_to_id<size_type>()},
+                                                       total_needles,
+                                                       mask_state::UNALLOCATED, stream, mr);
+  if (total_needles == 0) {
+    return result;
+  }
+  mutable_column_view result_view = result.get()->mutable_view();
+
+  // device copies of the per-pair views; the created views own device memory
+  // for any children and must stay alive until the kernel has run
+  std::vector<std::unique_ptr<column_device_view, std::function<void(column_device_view*)>>> device_views;
+  thrust::host_vector<column_device_view> h_haystacks;
+  thrust::host_vector<column_device_view> h_needles;
+  bool nullable = false;
+  for (size_type i = 0; i < num_pairs; ++i) {
+    device_views.emplace_back(column_device_view::create(haystacks[i], stream));
+    h_haystacks.push_back(*device_views.back());
+    device_views.emplace_back(column_device_view::create(needles[i], stream));
+    h_needles.push_back(*device_views.back());
+    nullable = nullable or haystacks[i].has_nulls() or needles[i].has_nulls();
+  }
+  rmm::device_vector<column_device_view> d_haystacks(h_haystacks);
+  rmm::device_vector<column_device_view> d_needles(h_needles);
+  rmm::device_vector<size_type> d_offsets(h_offsets);
+  rmm::device_vector<order> d_column_order(column_order.begin(), column_order.end());
+  rmm::device_vector<null_order> d_null_precedence(null_precedence.begin(), null_precedence.end());
+
+  if (nullable) {
+    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                       thrust::make_counting_iterator<size_type>(0), total_needles,
+                       batched_search_fn<true>{d_haystacks.data().get(),
+                                               d_needles.data().get(),
+                                               d_offsets.data().get(),
+                                               d_column_order.data().get(),
+                                               d_null_precedence.data().get(),
+                                               find_first,
+                                               result_view.data<size_type>()});
+  } else {
+    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                       thrust::make_counting_iterator<size_type>(0), total_needles,
+                       batched_search_fn<false>{d_haystacks.data().get(),
+                                                d_needles.data().get(),
+                                                d_offsets.data().get(),
+                                                d_column_order.data().get(),
+                                                d_null_precedence.data().get(),
+                                                find_first,
+                                                result_view.data<size_type>()});
+  }
+
+  return result;
+}
+
+// Assigns a bucket label to one element of one (column, edges) pair per
+// invocation, so a single launch digitizes every column. Labels follow
+// upper-bound semantics: label b means edges[b-1] <= x < edges[b] for
+// ascending edges, so values below the first edge get 0 and values at or
+// above the last edge get edges.size().
+template <bool has_nulls>
+struct batched_digitize_fn {
+  column_device_view const* d_inputs;
+  column_device_view const* d_edges;
+  size_type const* d_offsets;  ///< prefix sums of input sizes
+  int16_t* const* d_labels;    ///< per-pair output label buffers
+
+  __device__ void operator()(size_type idx) const {
+    size_type pair = 0;
+    while (idx >= d_offsets[pair + 1]) {
+      ++pair;
+    }
+    auto const row = idx - d_offsets[pair];
+    auto const& input = d_inputs[pair];
+    if (has_nulls and input.is_null(row)) {
+      // null rows are masked out of the output; the label is never read
+      d_labels[pair][row] = 0;
+      return;
+    }
+    auto const& edges = d_edges[pair];
+    auto comparator = element_relational_comparator<has_nulls>(
+        edges, input, null_order::BEFORE);
+
+    size_type lower = 0;
+    size_type upper = edges.size();
+    while (lower < upper) {
+      auto const mid = lower + (upper - lower) / 2;
+      auto const state = cudf::experimental::type_dispatcher(
+          edges.type(), comparator, mid, row);
+      if (state != weak_ordering::GREATER) {
+        lower = mid + 1;
+      } else {
+        upper = mid;
+      }
+    }
+    d_labels[pair][row] = static_cast<int16_t>(lower);
+  }
+};
+
 struct contains_scalar_dispatch {
   template <typename Element>
   bool operator()(column_view const& col, scalar const& value,
@@ -272,8 +451,217 @@ std::unique_ptr<column> upper_bound(table_view const& t,
   return search_ordered(t, values, false, column_order, null_precedence, mr, stream);
 }
 
+std::unique_ptr<column> batched_lower_bound(std::vector<column_view> const& haystacks,
+                                            std::vector<column_view> const& needles,
+                                            std::vector<order> const& column_order,
+                                            std::vector<null_order> const& null_precedence,
+                                            rmm::mr::device_memory_resource *mr,
+                                            cudaStream_t stream)
+{
+  return batched_search_ordered(haystacks, needles, true, column_order, null_precedence, mr, stream);
+}
+
+std::unique_ptr<column> batched_upper_bound(std::vector<column_view> const& haystacks,
+                                            std::vector<column_view> const& needles,
+                                            std::vector<order> const& column_order,
+                                            std::vector<null_order> const& null_precedence,
+                                            rmm::mr::device_memory_resource *mr,
+                                            cudaStream_t stream)
+{
+  return batched_search_ordered(haystacks, needles, false, column_order, null_precedence, mr, stream);
+}
+
+std::vector<std::unique_ptr<column>> batched_digitize(std::vector<column_view> const& inputs,
+                                                      std::vector<column_view> const& bin_edges,
+                                                      rmm::mr::device_memory_resource *mr,
+                                                      cudaStream_t stream)
+{
+  CUDF_EXPECTS(inputs.size() == bin_edges.size(),
+               "Mismatched number of input and bin edge columns.");
+  auto const num_pairs = static_cast<size_type>(inputs.size());
+
+  std::vector<size_type> h_offsets(num_pairs + 1, 0);
+  for (size_type i = 0; i < num_pairs; ++i) {
+    CUDF_EXPECTS(inputs[i].type() == bin_edges[i].type(), "DTYPE mismatch");
+    CUDF_EXPECTS(not bin_edges[i].has_nulls(), "bin edges must not contain nulls");
+    CUDF_EXPECTS(bin_edges[i].size() <= std::numeric_limits<int16_t>::max(),
+                 "Too many bin edges for int16 labels");
+    h_offsets[i + 1] = h_offsets[i] + inputs[i].size();
+  }
+  auto const total_elements = h_offsets.back();
+
+  // labels are written directly into the output columns, so the digitize of
+  // all pairs is one allocation pass plus one kernel
+  std::vector<std::unique_ptr<column>> results(num_pairs);
+  std::vector<int16_t*> h_labels(num_pairs);
+  for (size_type i = 0; i < num_pairs; ++i) {
+    results[i] = inputs[i].has_nulls()
+        ? make_numeric_column(data_type{type_to_id<int16_t>()}, inputs[i].size(),
+                              copy_bitmask(inputs[i], stream, mr),
+                              inputs[i].null_count(), stream, mr)
+        : make_numeric_column(data_type{type_to_id<int16_t>()}, inputs[i].size(),
+                              mask_state::UNALLOCATED, stream, mr);
+    h_labels[i] = results[i]->mutable_view().data<int16_t>();
+  }
+  if (total_elements == 0) {
+    return results;
+  }
+
+  // device copies of the per-pair views; the created views own device memory
+  // for any children and must stay alive until the kernel has run
+  std::vector<std::unique_ptr<column_device_view, std::function<void(column_device_view*)>>> device_views;
+  thrust::host_vector<column_device_view> h_inputs;
+  thrust::host_vector<column_device_view> h_edges;
+  bool nullable = false;
+  for (size_type i = 0; i < num_pairs; ++i) {
+    device_views.emplace_back(column_device_view::create(inputs[i], stream));
+    h_inputs.push_back(*device_views.back());
+    device_views.emplace_back(column_device_view::create(bin_edges[i], stream));
+    h_edges.push_back(*device_views.back());
+    nullable = nullable or inputs[i].has_nulls();
+  }
+  rmm::device_vector<column_device_view> d_inputs(h_inputs);
+  rmm::device_vector<column_device_view> d_edges(h_edges);
+  rmm::device_vector<size_type> d_offsets(h_offsets);
+  rmm::device_vector<int16_t*> d_labels(h_labels);
+
+  if (nullable) {
+    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                       thrust::make_counting_iterator<size_type>(0), total_elements,
+                       batched_digitize_fn<true>{d_inputs.data().get(),
+                                                 d_edges.data().get(),
+                                                 d_offsets.data().get(),
+                                                 d_labels.data().get()});
+  } else {
+    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                       thrust::make_counting_iterator<size_type>(0), total_elements,
+                       batched_digitize_fn<false>{d_inputs.data().get(),
+                                                  d_edges.data().get(),
+                                                  d_offsets.data().get(),
+                                                  d_labels.data().get()});
+  }
+
+  return results;
+}
+
+std::unique_ptr<column> digitize(column_view const& input,
+                                 column_view const& bin_edges,
+                                 rmm::mr::device_memory_resource *mr,
+                                 cudaStream_t stream)
+{
+  auto results = batched_digitize({input}, {bin_edges}, mr, stream);
+  return std::move(results.front());
+}
+
 } // namespace detail
 
+// Type-erased holder of the prebuilt needle hash set; the typed
+// implementation is selected once at construction instead of per probe.
+struct isin_lookup::impl {
+  data_type type;
+
+  explicit impl(data_type type) : type{type} {}
+  virtual ~impl() = default;
+
+  virtual std::unique_ptr<column> probe(column_view const& haystack,
+                                        rmm::mr::device_memory_resource *mr,
+                                        cudaStream_t stream) const = 0;
+};
+
+namespace {
+
+template <typename Element>
+struct typed_isin_lookup : public isin_lookup::impl {
+  cudf::detail::unordered_multiset<Element> hash_set;
+  cudf::detail::unordered_multiset_device_view<Element> device_hash_set;
+  bool has_needles;
+
+  typed_isin_lookup(column_view const& needles, cudaStream_t stream)
+      : isin_lookup::impl{needles.type()},
+        hash_set{cudf::detail::unordered_multiset<Element>::create(needles, stream)},
+        device_hash_set{hash_set.to_device()},
+        has_needles{needles.size() > 0} {}
+
+  // mirrors multi_contains_dispatch, but probes the set built at construction
+  std::unique_ptr<column> probe(column_view const& haystack,
+                                rmm::mr::device_memory_resource *mr,
+                                cudaStream_t stream) const override {
+
+    std::unique_ptr<column> result = make_numeric_column(data_type{experimental::type_to_id<bool8>()},
+                                                         haystack.size(),
+                                                         copy_bitmask(haystack, stream, mr),
+                                                         haystack.null_count(),
+                                                         stream, mr);
+
+    if (haystack.size() == 0) {
+      return result;
+    }
+
+    mutable_column_view result_view = result.get()->mutable_view();
+
+    if (not has_needles) {
+      bool8 f = false;
+      thrust::fill(rmm::exec_policy(stream)->on(stream), result_view.begin<bool8>(), result_view.end<bool8>(), f);
+      return result;
+    }
+
+    auto d_haystack_ptr = column_device_view::create(haystack, stream);
+    auto d_haystack = *d_haystack_ptr;
+    auto d_hash_set = device_hash_set;
+
+    if (haystack.has_nulls()) {
+      thrust::transform(rmm::exec_policy(stream)->on(stream),
+                        thrust::make_counting_iterator<size_type>(0),
+                        thrust::make_counting_iterator<size_type>(haystack.size()),
+                        result_view.begin<bool8>(),
+                        [d_hash_set, d_haystack] __device__ (size_t index) {
+                          return d_haystack.is_null_nocheck(index) || d_hash_set.contains(d_haystack.element<Element>(index));
+                        });
+    } else {
+      thrust::transform(rmm::exec_policy(stream)->on(stream),
+                        thrust::make_counting_iterator<size_type>(0),
+                        thrust::make_counting_iterator<size_type>(haystack.size()),
+                        result_view.begin<bool8>(),
+                        [d_hash_set, d_haystack] __device__ (size_t index) {
+                          return d_hash_set.contains(d_haystack.element<Element>(index));
+                        });
+    }
+
+    return result;
+  }
+};
+
+struct isin_build_dispatch {
+  template <typename Element>
+  std::unique_ptr<isin_lookup::impl> operator()(column_view const& needles,
+                                                cudaStream_t stream) {
+    return std::make_unique<typed_isin_lookup<Element>>(needles, stream);
+  }
+};
+
+template <>
+std::unique_ptr<isin_lookup::impl> isin_build_dispatch::operator()<dictionary32>(column_view const& needles,
+                                                                                 cudaStream_t stream) {
+  CUDF_FAIL("dictionary type not supported");
+}
+
+} // namespace
+
+isin_lookup::isin_lookup(column_view const& needles)
+    : _impl{cudf::experimental::type_dispatcher(needles.type(),
+                                                isin_build_dispatch{},
+                                                needles, cudaStream_t{0})} {}
+
+isin_lookup::~isin_lookup() = default;
+
+std::unique_ptr<column> isin_lookup::contains(column_view const& haystack,
+                                              rmm::mr::device_memory_resource *mr) const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(haystack.type() == _impl->type, "DTYPE mismatch");
+  return _impl->probe(haystack, mr, 0);
+}
+
 // external APIs
 
 std::unique_ptr<column> lower_bound(table_view const& t,
@@ -296,6 +684,42 @@ std::unique_ptr<column> upper_bound(table_view const& t,
   return detail::upper_bound(t, values, column_order, null_precedence, mr);
 }
 
+std::unique_ptr<column> batched_lower_bound(std::vector<column_view> const& haystacks,
+                                            std::vector<column_view> const& needles,
+                                            std::vector<order> const& column_order,
+                                            std::vector<null_order> const& null_precedence,
+                                            rmm::mr::device_memory_resource *mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::batched_lower_bound(haystacks, needles, column_order, null_precedence, mr);
+}
+
+std::unique_ptr<column> batched_upper_bound(std::vector<column_view> const& haystacks,
+                                            std::vector<column_view> const& needles,
+                                            std::vector<order> const& column_order,
+                                            std::vector<null_order> const& null_precedence,
+                                            rmm::mr::device_memory_resource *mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::batched_upper_bound(haystacks, needles, column_order, null_precedence, mr);
+}
+
+std::unique_ptr<column> digitize(column_view const& input,
+                                 column_view const& bin_edges,
+                                 rmm::mr::device_memory_resource *mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::digitize(input, bin_edges, mr);
+}
+
+std::vector<std::unique_ptr<column>> batched_digitize(std::vector<column_view> const& inputs,
+                                                      std::vector<column_view> const& bin_edges,
+                                                      rmm::mr::device_memory_resource *mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::batched_digitize(inputs, bin_edges, mr);
+}
+
 bool contains(column_view const& col, scalar const& value, rmm::mr::device_memory_resource *mr)
 {
   CUDF_FUNC_RANGE();
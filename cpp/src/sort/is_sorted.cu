@@ -15,13 +15,20 @@
  */
 
 #include <cudf/types.hpp>
+#include <cudf/column/column_device_view.cuh>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
 
 #include <rmm/thrust_rmm_allocator.h>
+#include <rmm/device_scalar.hpp>
+
+#include <thrust/host_vector.h>
+
+#include <functional>
 
 namespace cudf {
 
@@ -29,6 +36,82 @@ namespace experimental {
 
 namespace detail {
 
+namespace {
+
+constexpr size_type block_size = 256;
+
+// Each block votes on its chunk of adjacent-row comparisons. The first
+// violation found raises the shared flag and every block bails out at its
+// next chunk, so an unsorted prefix is detected without scanning the rest
+// of the table.
+template <bool has_nulls>
+__global__ void is_sorted_kernel(table_device_view input,
+                                 order const* column_order,
+                                 null_order const* null_precedence,
+                                 int* found_unsorted)
+{
+    auto comp = row_lexicographic_comparator<has_nulls>(
+        input, input, column_order, null_precedence);
+    auto const num_comparisons = input.num_rows() - 1;
+    size_type const stride = blockDim.x * gridDim.x;
+
+    for (size_type base = blockIdx.x * blockDim.x; base < num_comparisons;
+         base += stride) {
+        if (*reinterpret_cast<volatile int*>(found_unsorted)) {
+            return;
+        }
+        auto const i = base + static_cast<size_type>(threadIdx.x);
+        bool const violation = (i < num_comparisons) and comp(i + 1, i);
+        if (__syncthreads_or(violation)) {
+            if (threadIdx.x == 0) {
+                atomicExch(found_unsorted, 1);
+            }
+            return;
+        }
+    }
+}
+
+// Checks one adjacent-element comparison of one column per invocation so a
+// single launch validates every column independently. A column's remaining
+// comparisons are skipped once its flag is raised.
+template <bool has_nulls>
+__global__ void batched_is_sorted_kernel(column_device_view const* columns,
+                                         size_type const* offsets,  // prefix sums of comparison counts
+                                         order const* column_order,            // may be null: all ascending
+                                         null_order const* null_precedence,    // may be null: all BEFORE
+                                         size_type total_comparisons,
+                                         int* found_unsorted)  // one flag per column
+{
+    size_type const stride = blockDim.x * gridDim.x;
+
+    for (size_type idx = threadIdx.x + blockIdx.x * blockDim.x;
+         idx < total_comparisons; idx += stride) {
+        size_type pair = 0;
+        while (idx >= offsets[pair + 1]) {
+            ++pair;
+        }
+        if (*reinterpret_cast<volatile int*>(found_unsorted + pair)) {
+            continue;
+        }
+        auto const i = idx - offsets[pair];
+        auto const& column = columns[pair];
+        bool const ascending =
+            (column_order == nullptr) or (column_order[pair] == order::ASCENDING);
+        null_order const precedence = (null_precedence == nullptr)
+                                          ? null_order::BEFORE
+                                          : null_precedence[pair];
+        auto comparator =
+            element_relational_comparator<has_nulls>(column, column, precedence);
+        auto const state = cudf::experimental::type_dispatcher(
+            column.type(), comparator, i + 1, i);
+        if (state == (ascending ? weak_ordering::LESS : weak_ordering::GREATER)) {
+            atomicExch(found_unsorted + pair, 1);
+        }
+    }
+}
+
+}  // namespace
+
 template <bool has_nulls>
 auto is_sorted(
     cudf::table_view const& in,
@@ -39,17 +122,102 @@ auto is_sorted(
     auto in_d = table_device_view::create(in);
     rmm::device_vector<order> d_column_order(column_order);
     rmm::device_vector<null_order> const d_null_precedence = (has_nulls) ? rmm::device_vector<null_order>{null_precedence} : rmm::device_vector<null_order>{};
-    auto ineq_op = row_lexicographic_comparator<has_nulls>(
-        *in_d, *in_d,
-        d_column_order.data().get(),
-        d_null_precedence.data().get());
 
-    auto sorted = thrust::is_sorted(rmm::exec_policy(stream)->on(stream),
-                                    thrust::make_counting_iterator(0),
-                                    thrust::make_counting_iterator(in.num_rows()),
-                                    ineq_op);
+    rmm::device_scalar<int> found_unsorted(0, stream);
+    grid_1d grid(in.num_rows() - 1, block_size);
+    is_sorted_kernel<has_nulls>
+        <<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
+            *in_d, d_column_order.data().get(),
+            d_null_precedence.data().get(), found_unsorted.data());
+
+    return found_unsorted.value(stream) == 0;
+}
+
+std::vector<bool> is_sorted_batched(std::vector<column_view> const& columns,
+                                    std::vector<order> const& column_order,
+                                    std::vector<null_order> const& null_precedence,
+                                    cudaStream_t stream = 0)
+{
+    auto const num_columns = static_cast<size_type>(columns.size());
+
+    if (not column_order.empty()) {
+        CUDF_EXPECTS(column_order.size() == columns.size(),
+                     "Mismatch between number of columns and column order.");
+    }
+    if (not null_precedence.empty()) {
+        CUDF_EXPECTS(null_precedence.size() == columns.size(),
+                     "Mismatch between number of columns and null precedence.");
+    }
+
+    std::vector<bool> results(num_columns, true);
+
+    // Columns whose advisory metadata already advertises the requested
+    // ordering are sorted by contract and stay out of the launch.
+    std::vector<size_type> to_check;
+    for (size_type i = 0; i < num_columns; ++i) {
+        auto const metadata = columns[i].ordering();
+        auto const expected_order = column_order.empty() ? order::ASCENDING : column_order[i];
+        auto const expected_null_order = null_precedence.empty() ? null_order::BEFORE : null_precedence[i];
+        bool const advertised = metadata.is_sorted == sorted::YES &&
+            metadata.ordering == expected_order &&
+            (not columns[i].has_nulls() || metadata.null_ordering == expected_null_order);
+        if (not advertised && columns[i].size() > 1) {
+            to_check.push_back(i);
+        }
+    }
+    if (to_check.empty()) {
+        return results;
+    }
+    auto const num_checked = static_cast<size_type>(to_check.size());
+
+    std::vector<size_type> h_offsets(num_checked + 1, 0);
+    std::vector<order> h_column_order;
+    std::vector<null_order> h_null_precedence;
+    std::vector<std::unique_ptr<column_device_view, std::function<void(column_device_view*)>>> device_views;
+    thrust::host_vector<column_device_view> h_columns;
+    bool nullable = false;
+    for (size_type i = 0; i < num_checked; ++i) {
+        auto const& column = columns[to_check[i]];
+        h_offsets[i + 1] = h_offsets[i] + column.size() - 1;
+        if (not column_order.empty()) {
+            h_column_order.push_back(column_order[to_check[i]]);
+        }
+        if (not null_precedence.empty()) {
+            h_null_precedence.push_back(null_precedence[to_check[i]]);
+        }
+        device_views.emplace_back(column_device_view::create(column, stream));
+        h_columns.push_back(*device_views.back());
+        nullable = nullable or column.has_nulls();
+    }
+    auto const total_comparisons = h_offsets.back();
+
+    rmm::device_vector<column_device_view> d_columns(h_columns);
+    rmm::device_vector<size_type> d_offsets(h_offsets);
+    rmm::device_vector<order> d_column_order(h_column_order);
+    rmm::device_vector<null_order> d_null_precedence(h_null_precedence);
+    rmm::device_vector<int> d_found_unsorted(num_checked, 0);
 
-    return sorted;
+    grid_1d grid(total_comparisons, block_size);
+    if (nullable) {
+        batched_is_sorted_kernel<true>
+            <<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
+                d_columns.data().get(), d_offsets.data().get(),
+                d_column_order.data().get(), d_null_precedence.data().get(),
+                total_comparisons, d_found_unsorted.data().get());
+    } else {
+        batched_is_sorted_kernel<false>
+            <<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
+                d_columns.data().get(), d_offsets.data().get(),
+                d_column_order.data().get(), d_null_precedence.data().get(),
+                total_comparisons, d_found_unsorted.data().get());
+    }
+
+    thrust::host_vector<int> h_found_unsorted(d_found_unsorted);
+    for (size_type i = 0; i < num_checked; ++i) {
+        results[to_check[i]] = (h_found_unsorted[i] == 0);
+    }
+
+    return results;
 }
 
 } // namespace detail
@@ -71,6 +239,26 @@ bool is_sorted(cudf::table_view const& in,
         CUDF_EXPECTS(static_cast <unsigned int>(in.num_columns()) == null_precedence.size(), "Number of columns in the table doesn't match the vector null_precedence's size .\n");
     }
 
+    // If every column already advertises the requested ordering through its
+    // advisory metadata the table is lexicographically sorted and the device
+    // comparison can be skipped: column-wise sortedness of all columns
+    // implies row-wise lexicographic sortedness.
+    bool all_advertised = true;
+    for (size_type i = 0; i < in.num_columns(); ++i) {
+        auto const metadata = in.column(i).ordering();
+        auto const expected_order = column_order.empty() ? order::ASCENDING : column_order[i];
+        auto const expected_null_order = null_precedence.empty() ? null_order::BEFORE : null_precedence[i];
+        if (metadata.is_sorted != sorted::YES ||
+            metadata.ordering != expected_order ||
+            (in.column(i).has_nulls() && metadata.null_ordering != expected_null_order)) {
+            all_advertised = false;
+            break;
+        }
+    }
+    if (all_advertised) {
+        return true;
+    }
+
     if (has_nulls(in)) {
         return detail::is_sorted<true>(in, column_order, null_precedence);
     } else {
@@ -78,6 +266,14 @@ bool is_sorted(cudf::table_view const& in,
     }
 }
 
+std::vector<bool> is_sorted_batched(std::vector<column_view> const& columns,
+                                    std::vector<order> const& column_order,
+                                    std::vector<null_order> const& null_precedence)
+{
+    CUDF_FUNC_RANGE();
+    return detail::is_sorted_batched(columns, column_order, null_precedence);
+}
+
 } // experimental namespace
 
 } // cudf namespace
@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/merge.hpp>
+#include <cudf/search.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace cudf {
+namespace experimental {
+
+namespace detail {
+namespace {
+
+// number of splitter candidates sampled from each locally sorted partition
+constexpr size_type splitter_samples_per_gpu = 1024;
+
+// restores the caller's active device on scope exit
+struct device_guard {
+  int previous;
+  explicit device_guard(int device) {
+    CUDA_TRY(cudaGetDevice(&previous));
+    CUDA_TRY(cudaSetDevice(device));
+  }
+  ~device_guard() { cudaSetDevice(previous); }
+  device_guard(device_guard const&) = delete;
+  device_guard& operator=(device_guard const&) = delete;
+};
+
+// maps a sample index to an evenly strided row index
+struct sample_stride_fn {
+  size_type stride;
+  __host__ __device__ size_type operator()(size_type idx) const {
+    return idx * stride;
+  }
+};
+
+// a fixed-width table whose device memory is owned here, used for tables
+// copied onto a device other than the one their source lives on
+struct owned_device_table {
+  std::vector<rmm::device_buffer> buffers;
+  std::vector<column_view> columns;
+
+  table_view view() const { return table_view{columns}; }
+};
+
+// returns a view of rows [begin, end) of a fixed-width, zero-offset column
+column_view slice_rows(column_view const& input, size_type begin, size_type end) {
+  auto const* data =
+      static_cast<char const*>(input.head()) + begin * size_of(input.type());
+  return column_view(input.type(), end - begin, data);
+}
+
+// copies the rows [begin, end) of each column of `input` onto `device`;
+// under unified addressing cudaMemcpy moves data directly between peer
+// devices (over NVLink when peer access is enabled)
+owned_device_table copy_rows_to_device(table_view const& input, size_type begin,
+                                       size_type end, int device) {
+  owned_device_table result;
+  device_guard guard(device);
+  for (auto const& input_column : input) {
+    auto const bytes = static_cast<std::size_t>(end - begin) * size_of(input_column.type());
+    rmm::device_buffer buffer(bytes);
+    if (bytes > 0) {
+      auto const* source =
+          static_cast<char const*>(input_column.head()) + begin * size_of(input_column.type());
+      CUDA_TRY(cudaMemcpy(buffer.data(), source, bytes, cudaMemcpyDefault));
+    }
+    result.columns.push_back(
+        column_view(input_column.type(), end - begin, buffer.data()));
+    result.buffers.emplace_back(std::move(buffer));
+  }
+  return result;
+}
+
+// gathers an evenly strided sample of rows from a table on its own device
+std::unique_ptr<table> sample_rows(table_view const& input, size_type sample_size,
+                                   int device) {
+  device_guard guard(device);
+  auto const stride = input.num_rows() / sample_size;
+  auto indices = make_numeric_column(data_type{experimental::type_to_id<size_type>()},
+                                     sample_size);
+  thrust::transform(rmm::exec_policy(0)->on(0),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(sample_size),
+                    indices->mutable_view().begin<size_type>(),
+                    sample_stride_fn{stride});
+  return gather(input, indices->view());
+}
+
+}  // namespace
+
+std::vector<std::unique_ptr<table>> sort_multi_gpu(
+    std::vector<table_view> const& inputs, std::vector<int> const& device_ids,
+    std::vector<order> const& column_order,
+    std::vector<null_order> const& null_precedence) {
+  CUDF_EXPECTS(inputs.size() == device_ids.size(),
+               "Mismatched number of inputs and device ids");
+  CUDF_EXPECTS(not inputs.empty(), "No input tables");
+  auto const num_gpus = static_cast<size_type>(inputs.size());
+  auto const num_columns = inputs.front().num_columns();
+  for (auto const& input : inputs) {
+    CUDF_EXPECTS(input.num_columns() == num_columns, "Mismatched number of columns");
+    CUDF_EXPECTS(not has_nulls(input),
+                 "Multi-GPU sort does not support null elements");
+    for (auto const& input_column : input) {
+      CUDF_EXPECTS(cudf::is_fixed_width(input_column.type()),
+                   "Multi-GPU sort only supports fixed-width columns");
+    }
+  }
+
+  // merge() requires explicit per-key orderings; expand the empty defaults
+  std::vector<order> const effective_order =
+      column_order.empty() ? std::vector<order>(num_columns, order::ASCENDING)
+                           : column_order;
+
+  auto const total_rows = std::accumulate(
+      inputs.begin(), inputs.end(), size_type{0},
+      [](size_type sum, auto const& input) { return sum + input.num_rows(); });
+
+  if (num_gpus == 1 or total_rows == 0) {
+    std::vector<std::unique_ptr<table>> result;
+    for (size_type i = 0; i < num_gpus; ++i) {
+      device_guard guard(device_ids[i]);
+      result.push_back(sort(inputs[i], column_order, null_precedence));
+    }
+    return result;
+  }
+
+  // enable direct peer copies where the hardware allows; copies fall back
+  // to staging through the driver otherwise
+  for (auto source : device_ids) {
+    device_guard guard(source);
+    for (auto target : device_ids) {
+      if (target == source) { continue; }
+      auto const status = cudaDeviceEnablePeerAccess(target, 0);
+      if (status != cudaSuccess && status != cudaErrorPeerAccessAlreadyEnabled) {
+        CUDA_TRY(status);
+      }
+      cudaGetLastError();  // clear the already-enabled sticky error
+    }
+  }
+
+  // sort each partition locally on its own device
+  std::vector<std::unique_ptr<table>> local_sorted;
+  for (size_type i = 0; i < num_gpus; ++i) {
+    device_guard guard(device_ids[i]);
+    local_sorted.push_back(sort(inputs[i], column_order, null_precedence));
+    CUDA_TRY(cudaDeviceSynchronize());
+  }
+
+  // sample every partition and choose splitters on the first device
+  int const root_device = device_ids.front();
+  std::vector<owned_device_table> root_samples;
+  for (size_type i = 0; i < num_gpus; ++i) {
+    auto const num_rows = local_sorted[i]->num_rows();
+    if (num_rows == 0) { continue; }
+    auto const sample_size = std::min(splitter_samples_per_gpu, num_rows);
+    auto sample = sample_rows(local_sorted[i]->view(), sample_size, device_ids[i]);
+    {
+      device_guard guard(device_ids[i]);
+      CUDA_TRY(cudaDeviceSynchronize());
+    }
+    root_samples.push_back(
+        copy_rows_to_device(sample->view(), 0, sample_size, root_device));
+  }
+
+  owned_device_table splitters;
+  {
+    device_guard guard(root_device);
+    std::vector<table_view> sample_views;
+    for (auto const& sample : root_samples) {
+      sample_views.push_back(sample.view());
+    }
+    auto all_samples = concatenate(sample_views);
+    auto sorted_samples = sort(all_samples->view(), column_order, null_precedence);
+    auto const num_samples = sorted_samples->num_rows();
+
+    // one splitter between every pair of destination devices
+    std::vector<size_type> h_splitter_rows(num_gpus - 1);
+    for (size_type i = 0; i + 1 < num_gpus; ++i) {
+      h_splitter_rows[i] = std::min(num_samples - 1, (i + 1) * num_samples / num_gpus);
+    }
+    auto splitter_rows = make_numeric_column(
+        data_type{experimental::type_to_id<size_type>()}, num_gpus - 1);
+    CUDA_TRY(cudaMemcpy(splitter_rows->mutable_view().data<size_type>(),
+                        h_splitter_rows.data(),
+                        h_splitter_rows.size() * sizeof(size_type),
+                        cudaMemcpyDefault));
+    auto splitter_table = gather(sorted_samples->view(), splitter_rows->view());
+    CUDA_TRY(cudaDeviceSynchronize());
+    splitters = copy_rows_to_device(splitter_table->view(), 0,
+                                    splitter_table->num_rows(), root_device);
+  }
+
+  // split each sorted partition at the splitters
+  std::vector<std::vector<size_type>> boundaries(num_gpus);
+  for (size_type i = 0; i < num_gpus; ++i) {
+    auto local_splitters =
+        copy_rows_to_device(splitters.view(), 0, num_gpus - 1, device_ids[i]);
+    device_guard guard(device_ids[i]);
+    auto bounds = lower_bound(local_sorted[i]->view(), local_splitters.view(),
+                              column_order, null_precedence);
+    boundaries[i].resize(num_gpus + 1);
+    boundaries[i].front() = 0;
+    boundaries[i].back() = local_sorted[i]->num_rows();
+    CUDA_TRY(cudaMemcpy(boundaries[i].data() + 1, bounds->view().data<size_type>(),
+                        (num_gpus - 1) * sizeof(size_type), cudaMemcpyDefault));
+  }
+
+  // exchange ranges peer-to-peer and k-way merge on each destination
+  std::vector<size_type> key_cols(num_columns);
+  std::iota(key_cols.begin(), key_cols.end(), 0);
+  std::vector<std::unique_ptr<table>> result;
+  for (size_type target = 0; target < num_gpus; ++target) {
+    std::vector<owned_device_table> received;
+    for (size_type source = 0; source < num_gpus; ++source) {
+      received.push_back(copy_rows_to_device(local_sorted[source]->view(),
+                                             boundaries[source][target],
+                                             boundaries[source][target + 1],
+                                             device_ids[target]));
+    }
+    device_guard guard(device_ids[target]);
+    std::vector<table_view> received_views;
+    for (auto const& piece : received) {
+      received_views.push_back(piece.view());
+    }
+    result.push_back(
+        merge(received_views, key_cols, effective_order, null_precedence));
+    CUDA_TRY(cudaDeviceSynchronize());
+  }
+  return result;
+}
+
+}  // namespace detail
+
+std::vector<std::unique_ptr<table>> sort_multi_gpu(
+    std::vector<table_view> const& inputs, std::vector<int> const& device_ids,
+    std::vector<order> const& column_order,
+    std::vector<null_order> const& null_precedence) {
+  CUDF_FUNC_RANGE();
+  return detail::sort_multi_gpu(inputs, device_ids, column_order, null_precedence);
+}
+
+}  // namespace experimental
+}  // namespace cudf
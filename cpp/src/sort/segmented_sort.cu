@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sort_impl.cuh"
+
+#include <cudf/column/column.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+
+#include <thrust/binary_search.h>
+
+namespace cudf {
+namespace experimental {
+
+namespace detail {
+namespace {
+
+// Comparator that orders rows by their segment first and only applies the
+// lexicographic key comparison within a segment. Sorting all row indices
+// with this comparator sorts every segment in one launch since the
+// indices start out in segment-contiguous order.
+template <bool has_nulls>
+struct segmented_row_comparator {
+  size_type const* d_segments;
+  row_lexicographic_comparator<has_nulls> comparator;
+
+  __device__ bool operator()(size_type lhs, size_type rhs) const {
+    if (d_segments[lhs] != d_segments[rhs]) {
+      return d_segments[lhs] < d_segments[rhs];
+    }
+    return comparator(lhs, rhs);
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> segmented_sorted_order(
+    table_view const& keys, column_view const& segment_offsets,
+    std::vector<order> const& column_order,
+    std::vector<null_order> const& null_precedence,
+    rmm::mr::device_memory_resource* mr, cudaStream_t stream) {
+  CUDF_EXPECTS(segment_offsets.type().id() == INT32,
+               "segment_offsets must be INT32 type");
+  CUDF_EXPECTS(not segment_offsets.has_nulls(),
+               "segment_offsets must not contain nulls");
+
+  if (keys.num_rows() == 0 or keys.num_columns() == 0) {
+    return cudf::make_numeric_column(data_type(experimental::type_to_id<size_type>()), 0);
+  }
+
+  if (not column_order.empty()) {
+    CUDF_EXPECTS(
+        static_cast<std::size_t>(keys.num_columns()) == column_order.size(),
+        "Mismatch between number of columns and column order.");
+  }
+
+  if (not null_precedence.empty()) {
+    CUDF_EXPECTS(
+        static_cast<std::size_t>(keys.num_columns()) == null_precedence.size(),
+        "Mismatch between number of columns and null_precedence size.");
+  }
+
+  auto const num_rows = keys.num_rows();
+
+  std::unique_ptr<column> sorted_indices = cudf::make_numeric_column(
+      data_type(experimental::type_to_id<size_type>()), num_rows, mask_state::UNALLOCATED, stream, mr);
+
+  mutable_column_view mutable_indices_view = sorted_indices->mutable_view();
+
+  thrust::sequence(rmm::exec_policy(stream)->on(stream),
+                   mutable_indices_view.begin<size_type>(),
+                   mutable_indices_view.end<size_type>(), 0);
+
+  // assign each row the index of the segment that contains it
+  rmm::device_vector<size_type> segments(num_rows);
+  auto d_offsets = segment_offsets.data<size_type>();
+  thrust::upper_bound(rmm::exec_policy(stream)->on(stream),
+                      d_offsets, d_offsets + segment_offsets.size(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_rows),
+                      segments.begin());
+  auto d_segments = segments.data().get();
+
+  auto device_table = table_device_view::create(keys, stream);
+
+  rmm::device_vector<order> d_column_order(column_order);
+
+  if (has_nulls(keys)) {
+    rmm::device_vector<null_order> d_null_precedence(null_precedence);
+    auto comparator = segmented_row_comparator<true>{
+        d_segments,
+        row_lexicographic_comparator<true>(*device_table, *device_table,
+                                           d_column_order.data().get(),
+                                           d_null_precedence.data().get())};
+    thrust::sort(rmm::exec_policy(stream)->on(stream),
+                 mutable_indices_view.begin<size_type>(),
+                 mutable_indices_view.end<size_type>(), comparator);
+  } else {
+    auto comparator = segmented_row_comparator<false>{
+        d_segments,
+        row_lexicographic_comparator<false>(*device_table, *device_table,
+                                            d_column_order.data().get())};
+    thrust::sort(rmm::exec_policy(stream)->on(stream),
+                 mutable_indices_view.begin<size_type>(),
+                 mutable_indices_view.end<size_type>(), comparator);
+  }
+
+  return sorted_indices;
+}
+
+std::unique_ptr<table> segmented_sort_by_key(
+    table_view const& values, table_view const& keys,
+    column_view const& segment_offsets,
+    std::vector<order> const& column_order,
+    std::vector<null_order> const& null_precedence,
+    rmm::mr::device_memory_resource* mr, cudaStream_t stream) {
+  CUDF_EXPECTS(values.num_rows() == keys.num_rows(),
+               "Mismatch in number of rows for values and keys");
+
+  auto sorted_order = detail::segmented_sorted_order(
+      keys, segment_offsets, column_order, null_precedence, mr, stream);
+
+  return detail::gather(values, sorted_order->view(), false, false, false, mr, stream);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> segmented_sorted_order(
+    table_view const& keys, column_view const& segment_offsets,
+    std::vector<order> const& column_order,
+    std::vector<null_order> const& null_precedence,
+    rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::segmented_sorted_order(keys, segment_offsets, column_order,
+                                        null_precedence, mr);
+}
+
+std::unique_ptr<table> segmented_sort(
+    table_view const& input, column_view const& segment_offsets,
+    std::vector<order> const& column_order,
+    std::vector<null_order> const& null_precedence,
+    rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::segmented_sort_by_key(input, input, segment_offsets,
+                                       column_order, null_precedence, mr);
+}
+
+std::unique_ptr<table> segmented_sort_by_key(
+    table_view const& values, table_view const& keys,
+    column_view const& segment_offsets,
+    std::vector<order> const& column_order,
+    std::vector<null_order> const& null_precedence,
+    rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::segmented_sort_by_key(values, keys, segment_offsets,
+                                       column_order, null_precedence, mr);
+}
+
+}  // namespace experimental
+}  // namespace cudf
@@ -19,6 +19,7 @@
 #include <cudf/column/column.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/detail/sorting.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 
@@ -66,7 +67,18 @@ std::unique_ptr<table> sort(table_view input,
                              std::vector<null_order> const& null_precedence,
                              rmm::mr::device_memory_resource* mr) {
   CUDF_FUNC_RANGE();
-  return detail::sort_by_key(input, input, column_order, null_precedence, mr);
+  auto result =
+      detail::sort_by_key(input, input, column_order, null_precedence, mr);
+  // record the ordering the output is now known to satisfy so downstream
+  // operations (e.g. is_sorted, merge paths) need not re-validate it; only
+  // the leading key column is globally sorted in a lexicographic sort
+  if (result->num_columns() > 0) {
+    result->get_column(0).set_ordering(order_metadata{
+        sorted::YES,
+        column_order.empty() ? order::ASCENDING : column_order.front(),
+        null_precedence.empty() ? null_order::BEFORE : null_precedence.front()});
+  }
+  return result;
 }
 
 std::unique_ptr<table> sort_by_key(
@@ -19,16 +19,75 @@
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/sorting.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/detail/gather.hpp>
 
 #include <rmm/thrust_rmm_allocator.h>
+#include <thrust/copy.h>
+#include <thrust/functional.h>
 #include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include <vector>
 
 namespace cudf {
 namespace experimental {
 namespace detail {
 
+// Indicates if a column type can be used directly as thrust radix sort keys
+struct is_radix_sort_key_fn {
+  template <typename T>
+  bool operator()() const {
+    // thrust dispatches its radix sort only for primitive arithmetic key types
+    return std::is_arithmetic<T>::value;
+  }
+};
+
+// Sorts the indices using the single key column directly as sort keys.
+// For primitive types with the default or reversed comparator thrust
+// dispatches a radix sort which is considerably faster than the
+// comparator-based path and is inherently stable.
+template <bool stable = false>
+struct radix_sorted_order_fn {
+  template <typename T, std::enable_if_t<std::is_arithmetic<T>::value>* = nullptr>
+  void operator()(column_view const& keys,
+                  mutable_column_view& indices,
+                  bool ascending,
+                  cudaStream_t stream) {
+    // sort a copy of the keys so the input column is left untouched
+    rmm::device_vector<T> d_keys(keys.size());
+    thrust::copy(rmm::exec_policy(stream)->on(stream),
+                 keys.begin<T>(), keys.end<T>(), d_keys.begin());
+    if (ascending) {
+      if (stable) {
+        thrust::stable_sort_by_key(rmm::exec_policy(stream)->on(stream),
+                                   d_keys.begin(), d_keys.end(),
+                                   indices.begin<size_type>());
+      } else {
+        thrust::sort_by_key(rmm::exec_policy(stream)->on(stream),
+                            d_keys.begin(), d_keys.end(),
+                            indices.begin<size_type>());
+      }
+    } else {
+      if (stable) {
+        thrust::stable_sort_by_key(rmm::exec_policy(stream)->on(stream),
+                                   d_keys.begin(), d_keys.end(),
+                                   indices.begin<size_type>(), thrust::greater<T>());
+      } else {
+        thrust::sort_by_key(rmm::exec_policy(stream)->on(stream),
+                            d_keys.begin(), d_keys.end(),
+                            indices.begin<size_type>(), thrust::greater<T>());
+      }
+    }
+  }
+  template <typename T, std::enable_if_t<not std::is_arithmetic<T>::value>* = nullptr>
+  void operator()(column_view const&, mutable_column_view&, bool, cudaStream_t) {
+    CUDF_FAIL("Invalid type for radix sort fast path.");
+  }
+};
+
 // Create permuted row indices that would materialize sorted order
 template <bool stable = false>
 std::unique_ptr<column> sorted_order(table_view input,
@@ -52,17 +111,48 @@ std::unique_ptr<column> sorted_order(table_view input,
         "Mismatch between number of columns and null_precedence size.");
   }
 
+  // dictionary columns are ordered by their int32 index codes: when the keys
+  // are sorted (as `set_keys` guarantees) the codes order exactly as the
+  // decoded values would, so e.g. string-keyed sorts run at integer-key speed
+  std::vector<column_view> columns(input.begin(), input.end());
+  bool any_dictionaries = false;
+  for (auto& col : columns) {
+    if (col.type().id() == type_id::DICTIONARY32) {
+      dictionary_column_view dict_col(col);
+      CUDF_EXPECTS(cudf::experimental::is_sorted(table_view{{dict_col.keys()}},
+                                                 {order::ASCENDING}, {}),
+                   "dictionary keys must be sorted to sort by index codes");
+      col = dict_col.get_indices_annotated();
+      any_dictionaries = true;
+    }
+  }
+  if (any_dictionaries) { input = table_view{columns}; }
+
   std::unique_ptr<column> sorted_indices = cudf::make_numeric_column(
       data_type(experimental::type_to_id<size_type>()), input.num_rows(), mask_state::UNALLOCATED, stream, mr);
 
   mutable_column_view mutable_indices_view = sorted_indices->mutable_view();
 
-  auto device_table = table_device_view::create(input, stream);
-
   thrust::sequence(rmm::exec_policy(stream)->on(stream),
                    mutable_indices_view.begin<size_type>(),
                    mutable_indices_view.end<size_type>(), 0);
 
+  // fast path: a single column of a primitive type with no nulls can use
+  // the keys directly with thrust's radix sort instead of the
+  // row-comparator path
+  if (input.num_columns() == 1 and not has_nulls(input) and
+      experimental::type_dispatcher(input.column(0).type(), is_radix_sort_key_fn{})) {
+    bool const ascending =
+        column_order.empty() or (column_order.front() == order::ASCENDING);
+    experimental::type_dispatcher(input.column(0).type(),
+                                  radix_sorted_order_fn<stable>{},
+                                  input.column(0), mutable_indices_view,
+                                  ascending, stream);
+    return sorted_indices;
+  }
+
+  auto device_table = table_device_view::create(input, stream);
+
   rmm::device_vector<order> d_column_order(column_order);
 
   if (has_nulls(input)) {
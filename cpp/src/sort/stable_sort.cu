@@ -20,6 +20,7 @@
 #include <cudf/sorting.hpp>
 #include <cudf/detail/sorting.hpp>
 #include <cudf/table/table_view.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 
 namespace cudf {
 namespace experimental {
@@ -44,6 +45,7 @@ std::unique_ptr<column> stable_sorted_order(
   std::vector<null_order> const& null_precedence,
   rmm::mr::device_memory_resource* mr) 
 {
+  CUDF_FUNC_RANGE();
   return detail::stable_sorted_order(input, column_order, null_precedence, mr);
 }
 
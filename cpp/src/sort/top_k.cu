@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sort_impl.cuh"
+
+#include <cudf/column/column.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+
+#include <thrust/count.h>
+#include <thrust/copy.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace experimental {
+
+namespace detail {
+namespace {
+
+// number of evenly strided keys sampled to estimate the selection threshold
+constexpr size_type top_k_sample_size = 8192;
+
+// maps a sample index to an evenly strided row index
+struct stride_index_fn {
+  size_type stride;
+  __host__ __device__ size_type operator()(size_type idx) const {
+    return idx * stride;
+  }
+};
+
+// true if the value could belong to the top-k for the requested direction
+template <typename T>
+struct pass_threshold_fn {
+  T pivot;
+  bool ascending;
+  __host__ __device__ bool operator()(T value) const {
+    return ascending ? !(pivot < value) : !(value < pivot);
+  }
+};
+
+// Selects the row indices of the top k values of a single key column.
+//
+// A strided sample of the keys is sorted to estimate a threshold value
+// expected to pass roughly 2k rows. Rows passing the threshold are
+// gathered in one filtering pass and only those candidates are fully
+// sorted; the threshold is relaxed and the count retried in the unlikely
+// case the sample estimate passed fewer than k rows. Total data movement
+// is a couple of linear passes over the keys rather than a full sort.
+struct top_k_indices_fn {
+  template <typename T, std::enable_if_t<std::is_arithmetic<T>::value>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& keys, size_type k,
+                                     bool ascending,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream) {
+    auto const num_rows = keys.size();
+    auto execpol = rmm::exec_policy(stream);
+
+    // sort an evenly strided sample of the keys
+    auto const sample_size = std::min(top_k_sample_size, num_rows);
+    rmm::device_vector<T> sample(sample_size);
+    auto sample_map = thrust::make_transform_iterator(
+        thrust::make_counting_iterator<size_type>(0),
+        stride_index_fn{num_rows / sample_size});
+    thrust::copy(execpol->on(stream),
+                 thrust::make_permutation_iterator(keys.begin<T>(), sample_map),
+                 thrust::make_permutation_iterator(keys.begin<T>(), sample_map + sample_size),
+                 sample.begin());
+    thrust::sort(execpol->on(stream), sample.begin(), sample.end());
+
+    // estimate a threshold from the sample targeting about 2k passing rows;
+    // relax it until at least k rows pass
+    T pivot{};
+    size_type count = 0;
+    bool select_all = false;
+    double fraction = (2.0 * k) / num_rows;
+    while (true) {
+      if (fraction >= 1.0) {
+        select_all = true;
+        count = num_rows;
+        break;
+      }
+      auto const pos = static_cast<size_type>(fraction * (sample_size - 1));
+      pivot = ascending ? sample[pos] : sample[(sample_size - 1) - pos];
+      count = thrust::count_if(execpol->on(stream), keys.begin<T>(),
+                               keys.end<T>(), pass_threshold_fn<T>{pivot, ascending});
+      if (count >= k) break;
+      fraction *= 2.0;
+    }
+
+    // gather the candidate rows and their keys in one pass
+    rmm::device_vector<size_type> candidates(count);
+    rmm::device_vector<T> candidate_keys(count);
+    if (select_all) {
+      thrust::sequence(execpol->on(stream), candidates.begin(), candidates.end());
+      thrust::copy(execpol->on(stream), keys.begin<T>(), keys.end<T>(),
+                   candidate_keys.begin());
+    } else {
+      auto zip_in = thrust::make_zip_iterator(thrust::make_tuple(
+          thrust::make_counting_iterator<size_type>(0), keys.begin<T>()));
+      auto zip_out = thrust::make_zip_iterator(
+          thrust::make_tuple(candidates.begin(), candidate_keys.begin()));
+      thrust::copy_if(execpol->on(stream), zip_in, zip_in + num_rows,
+                      keys.begin<T>(), zip_out,
+                      pass_threshold_fn<T>{pivot, ascending});
+    }
+
+    // order just the candidates and keep the first k
+    if (ascending) {
+      thrust::sort_by_key(execpol->on(stream), candidate_keys.begin(),
+                          candidate_keys.end(), candidates.begin());
+    } else {
+      thrust::sort_by_key(execpol->on(stream), candidate_keys.begin(),
+                          candidate_keys.end(), candidates.begin(),
+                          thrust::greater<T>());
+    }
+
+    auto indices = cudf::make_numeric_column(
+        data_type(experimental::type_to_id<size_type>()), k, mask_state::UNALLOCATED, stream, mr);
+    thrust::copy(execpol->on(stream), candidates.begin(), candidates.begin() + k,
+                 indices->mutable_view().begin<size_type>());
+    return indices;
+  }
+  template <typename T, std::enable_if_t<not std::is_arithmetic<T>::value>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const&, size_type, bool,
+                                     rmm::mr::device_memory_resource*,
+                                     cudaStream_t) {
+    CUDF_FAIL("Invalid type for top-k selection path.");
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<table> top_k(table_view const& input, size_type k,
+                             std::vector<order> const& column_order,
+                             std::vector<null_order> const& null_precedence,
+                             rmm::mr::device_memory_resource* mr,
+                             cudaStream_t stream) {
+  CUDF_EXPECTS(k >= 0, "Parameter k must not be negative");
+  k = std::min(k, input.num_rows());
+  if (input.num_rows() == 0 or input.num_columns() == 0 or k == 0) {
+    auto empty_indices = cudf::make_numeric_column(
+        data_type(experimental::type_to_id<size_type>()), 0);
+    return detail::gather(input, empty_indices->view(), false, false, false, mr, stream);
+  }
+
+  bool const ascending =
+      column_order.empty() or (column_order.front() == order::ASCENDING);
+
+  // a single primitive-typed column with no nulls can use partial selection;
+  // anything else falls back to a full sorted_order
+  if (input.num_columns() == 1 and not has_nulls(input) and
+      experimental::type_dispatcher(input.column(0).type(), is_radix_sort_key_fn{})) {
+    auto indices = experimental::type_dispatcher(input.column(0).type(),
+                                                 top_k_indices_fn{},
+                                                 input.column(0), k, ascending,
+                                                 mr, stream);
+    return detail::gather(input, indices->view(), false, false, false, mr, stream);
+  }
+
+  auto sorted_indices =
+      detail::sorted_order(input, column_order, null_precedence, mr, stream);
+  column_view top_indices(data_type(experimental::type_to_id<size_type>()), k,
+                          sorted_indices->view().head());
+  return detail::gather(input, top_indices, false, false, false, mr, stream);
+}
+
+}  // namespace detail
+
+std::unique_ptr<table> top_k(table_view const& input, size_type k,
+                             std::vector<order> const& column_order,
+                             std::vector<null_order> const& null_precedence,
+                             rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::top_k(input, k, column_order, null_precedence, mr);
+}
+
+}  // namespace experimental
+}  // namespace cudf
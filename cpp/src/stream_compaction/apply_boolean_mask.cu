@@ -20,11 +20,20 @@
 #include <cudf/utilities/type_dispatcher.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/detail/copy_if.cuh>
+#include <cudf/detail/gather.hpp>
+#include <cudf/packed_bool.hpp>
 #include <cudf/stream_compaction.hpp>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/detail/stream_compaction.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/iterator/counting_iterator.h>
 
 #include <algorithm>
 
@@ -57,11 +66,57 @@ protected:
   cudf::column_device_view boolean_mask;
 };
 
+// Returns true if bit i of a bit-packed predicate is set
+// Nulls of the source column were already folded to false when packing
+struct packed_bool_filter
+{
+  packed_bool_filter(cudf::bitmask_type const* words) :
+    words{words}
+    {}
+
+  __device__ inline
+  bool operator()(cudf::size_type i)
+  {
+    return cudf::bit_is_set(words, i);
+  }
+
+protected:
+
+  cudf::bitmask_type const* words;
+};
+
 }  // namespace
 
 namespace cudf {
 namespace experimental {
 namespace detail {
+namespace {
+
+// Materializes the indices of the rows passing the mask, counting the
+// survivors first so the returned column is exactly sized
+template <bool has_nulls>
+std::unique_ptr<column> make_gather_map(column_view const& boolean_mask,
+                                        rmm::mr::device_memory_resource *mr,
+                                        cudaStream_t stream) {
+  auto device_boolean_mask = cudf::column_device_view::create(boolean_mask, stream);
+  boolean_mask_filter<has_nulls> filter{*device_boolean_mask};
+
+  auto const num_passing = static_cast<size_type>(thrust::count_if(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(boolean_mask.size()), filter));
+
+  auto gather_map = make_numeric_column(data_type{type_to_id<size_type>()},
+                                        num_passing, mask_state::UNALLOCATED,
+                                        stream, mr);
+  thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator<size_type>(boolean_mask.size()),
+                  gather_map->mutable_view().begin<size_type>(), filter);
+  return gather_map;
+}
+
+}  // namespace
 
 /*
  * Filters a table_view using a column_view of boolean values as a mask.
@@ -96,6 +151,87 @@ std::unique_ptr<experimental::table>
   }
 }
 
+/*
+ * Filters a table_view using a bit-packed boolean column as a mask.
+ *
+ * The mask reads one bit per row instead of one byte, and nulls were
+ * already folded to false when the predicate was packed, so no validity
+ * check is needed here.
+ */
+std::unique_ptr<experimental::table>
+    apply_boolean_mask(table_view const& input,
+                       packed_bool_column const& boolean_mask,
+                       rmm::mr::device_memory_resource *mr,
+                       cudaStream_t stream) {
+
+  if (boolean_mask.size == 0) {
+      return experimental::empty_like(input);
+  }
+
+  // zero-size inputs are OK, but otherwise input size must match mask size
+  CUDF_EXPECTS(input.num_rows() == 0 || input.num_rows() == boolean_mask.size,
+               "Column size mismatch");
+
+  return detail::copy_if(input, packed_bool_filter{boolean_mask.mask()},
+                         mr, stream);
+}
+
+/*
+ * Computes the gather map selecting the rows passing a boolean mask.
+ */
+std::unique_ptr<column>
+    mask_to_gather_map(column_view const& boolean_mask,
+                       rmm::mr::device_memory_resource *mr,
+                       cudaStream_t stream) {
+
+  CUDF_EXPECTS(boolean_mask.type().id() == BOOL8, "Mask must be Boolean type");
+
+  if(boolean_mask.has_nulls()){
+      return make_gather_map<true>(boolean_mask, mr, stream);
+  } else {
+      return make_gather_map<false>(boolean_mask, mr, stream);
+  }
+}
+
+/*
+ * Filters several table_views through one boolean mask, computing the
+ * mask's gather map once and gathering every table through it.
+ */
+std::vector<std::unique_ptr<experimental::table>>
+    apply_boolean_mask(std::vector<table_view> const& inputs,
+                       column_view const& boolean_mask,
+                       rmm::mr::device_memory_resource *mr,
+                       cudaStream_t stream) {
+
+  if (boolean_mask.size() == 0) {
+      std::vector<std::unique_ptr<experimental::table>> result;
+      for (auto const& input : inputs) {
+          result.push_back(experimental::empty_like(input));
+      }
+      return result;
+  }
+
+  CUDF_EXPECTS(boolean_mask.type().id() == BOOL8, "Mask must be Boolean type");
+  // zero-size inputs are OK, but otherwise input size must match mask size
+  for (auto const& input : inputs) {
+      CUDF_EXPECTS(input.num_rows() == 0 || input.num_rows() == boolean_mask.size(),
+                   "Column size mismatch");
+  }
+
+  auto gather_map = mask_to_gather_map(boolean_mask, mr, stream);
+
+  std::vector<std::unique_ptr<experimental::table>> result;
+  for (auto const& input : inputs) {
+      if (input.num_rows() == 0) {
+          result.push_back(experimental::empty_like(input));
+      } else {
+          result.push_back(detail::gather(input, gather_map->view(),
+                                          false, false, false, mr, stream));
+      }
+  }
+  return result;
+}
+
 } // namespace detail
 
 /*
@@ -108,6 +244,38 @@ std::unique_ptr<experimental::table>
   CUDF_FUNC_RANGE();
   return detail::apply_boolean_mask(input, boolean_mask, mr);
 }
+
+/*
+ * Filters a table_view using a bit-packed boolean column as a mask.
+ */
+std::unique_ptr<experimental::table>
+    apply_boolean_mask(table_view const& input,
+                       packed_bool_column const& boolean_mask,
+                       rmm::mr::device_memory_resource *mr) {
+  CUDF_FUNC_RANGE();
+  return detail::apply_boolean_mask(input, boolean_mask, mr);
+}
+
+/*
+ * Computes the gather map selecting the rows passing a boolean mask.
+ */
+std::unique_ptr<column>
+    mask_to_gather_map(column_view const& boolean_mask,
+                       rmm::mr::device_memory_resource *mr) {
+  CUDF_FUNC_RANGE();
+  return detail::mask_to_gather_map(boolean_mask, mr);
+}
+
+/*
+ * Filters several table_views through one boolean mask.
+ */
+std::vector<std::unique_ptr<experimental::table>>
+    apply_boolean_mask(std::vector<table_view> const& inputs,
+                       column_view const& boolean_mask,
+                       rmm::mr::device_memory_resource *mr) {
+  CUDF_FUNC_RANGE();
+  return detail::apply_boolean_mask(inputs, boolean_mask, mr);
+}
 } // namespace experimental
 }  // namespace cudf
 
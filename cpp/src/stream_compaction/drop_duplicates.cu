@@ -29,11 +29,19 @@
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <hash/concurrent_unordered_map.cuh>
+#include <hash/helper_functions.cuh>
+
 #include <thrust/logical.h>
 #include <thrust/functional.h>
 #include <thrust/execution_policy.h>
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
+#include <thrust/sequence.h>
 #include <algorithm>
 #include <cmath>
+#include <limits>
 
 namespace cudf {
 namespace experimental {
@@ -85,6 +93,85 @@ template<typename Exec,
    }
 }
 
+namespace {
+
+/**
+ * @brief Returns true when every key column's advisory ordering metadata
+ * matches the ascending, nulls-first ordering that `sorted_order` produces
+ * with default parameters, meaning the rows are already in sorted order.
+ */
+bool keys_are_presorted(cudf::table_view const& keys)
+{
+  return std::all_of(keys.begin(), keys.end(), [](column_view const& col) {
+    auto const metadata = col.ordering();
+    if (metadata.is_sorted != sorted::YES or metadata.ordering != order::ASCENDING) {
+      return false;
+    }
+    return not col.has_nulls() or metadata.null_ordering == null_order::BEFORE;
+  });
+}
+
+/**
+ * @brief Create a column_view of the indices of distinct rows using a hash
+ * table instead of a sort.
+ *
+ * Keeps the first occurrence (smallest row index) of every group of
+ * duplicate rows; the kept indices are produced in input row order.
+ *
+ * @tparam has_nulls Indicates the potential for null values in `keys`
+ */
+template <bool has_nulls>
+column_view get_unique_hash_indices(cudf::table_view const& keys,
+                                    cudf::mutable_column_view& unique_indices,
+                                    bool const& nulls_are_equal,
+                                    cudaStream_t stream)
+{
+  auto const num_rows = keys.num_rows();
+  auto device_input_table = cudf::table_device_view::create(keys, stream);
+  auto const hasher = row_hasher<MurmurHash3_32, has_nulls>(*device_input_table);
+  auto const equal = row_equality_comparator<has_nulls>(*device_input_table,
+                                                        *device_input_table,
+                                                        nulls_are_equal);
+
+  using map_type = concurrent_unordered_map<cudf::size_type, cudf::size_type,
+                                            row_hasher<MurmurHash3_32, has_nulls>,
+                                            row_equality_comparator<has_nulls>>;
+  auto map = map_type::create(compute_hash_table_size(num_rows),
+                              std::numeric_limits<cudf::size_type>::max(),
+                              std::numeric_limits<cudf::size_type>::max(),
+                              hasher, equal,
+                              typename map_type::allocator_type(), stream);
+  auto d_map = *map;
+  auto execpol = rmm::exec_policy(stream);
+
+  // claim one arbitrary representative row per distinct key ...
+  thrust::for_each_n(execpol->on(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0), num_rows,
+                     [d_map] __device__(cudf::size_type idx) mutable {
+                       d_map.insert(thrust::make_pair(idx, idx));
+                     });
+  // ... then lower each representative to its group's first occurrence
+  thrust::for_each_n(execpol->on(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0), num_rows,
+                     [d_map] __device__(cudf::size_type idx) mutable {
+                       auto found = d_map.find(idx);
+                       atomicMin(&found->second, idx);
+                     });
+
+  auto result_end = thrust::copy_if(execpol->on(stream),
+                                    thrust::make_counting_iterator<cudf::size_type>(0),
+                                    thrust::make_counting_iterator<cudf::size_type>(num_rows),
+                                    unique_indices.begin<cudf::size_type>(),
+                                    [d_map] __device__(cudf::size_type idx) {
+                                      return d_map.find(idx)->second == idx;
+                                    });
+
+  return cudf::experimental::detail::slice(column_view(unique_indices), 0,
+          thrust::distance(unique_indices.begin<cudf::size_type>(), result_end));
+}
+
+}  // namespace
+
 /**
  * @brief Create a column_view of index values which represent the row values
  * without duplicates as per @p `keep`
@@ -111,15 +198,27 @@ column_view get_unique_ordered_indices(cudf::table_view const& keys,
                                        bool const& nulls_are_equal = true,
                                        cudaStream_t stream=0)
 {
-  // sort only indices
-  auto sorted_indices = sorted_order(keys,
-                                     std::vector<order>{},
-                                     std::vector<null_order>{},
-                                     rmm::mr::get_default_resource(),
-                                     stream);
-
+  std::unique_ptr<column> sorted_indices;
+  if (keys_are_presorted(keys)) {
+    // ordering metadata says the rows are already sorted; skip the sort and
+    // dedup adjacent rows in input order
+    sorted_indices = cudf::make_numeric_column(data_type{INT32},
+                                               keys.num_rows(),
+                                               mask_state::UNALLOCATED, stream);
+    auto indices_view = sorted_indices->mutable_view();
+    thrust::sequence(rmm::exec_policy(stream)->on(stream),
+                     indices_view.begin<cudf::size_type>(),
+                     indices_view.end<cudf::size_type>(), 0);
+  } else {
+    // sort only indices
+    sorted_indices = sorted_order(keys,
+                                  std::vector<order>{},
+                                  std::vector<null_order>{},
+                                  rmm::mr::get_default_resource(),
+                                  stream);
+  }
 
-  // extract unique indices 
+  // extract unique indices
   auto device_input_table = cudf::table_device_view::create(keys, stream);
 
   if(cudf::has_nulls(keys)) {
@@ -216,11 +315,22 @@ std::unique_ptr<experimental::table>
   auto mutable_unique_indices_view = unique_indices->mutable_view();
   // This is just slice of `unique_indices` but with different size as per the
   // keys_view has been processed in `get_unique_ordered_indices`
-  auto unique_indices_view = 
-      detail::get_unique_ordered_indices(keys_view,
-                                         mutable_unique_indices_view,
-                                         keep, nulls_are_equal,
-                                         stream);
+  // KEEP_FIRST on unsorted keys needs no ordering at all: a hash table
+  // picks the first occurrence of each duplicate group without sorting
+  auto unique_indices_view =
+      (keep == duplicate_keep_option::KEEP_FIRST and
+       not keys_are_presorted(keys_view))
+          ? (cudf::has_nulls(keys_view)
+                 ? get_unique_hash_indices<true>(keys_view,
+                                                 mutable_unique_indices_view,
+                                                 nulls_are_equal, stream)
+                 : get_unique_hash_indices<false>(keys_view,
+                                                  mutable_unique_indices_view,
+                                                  nulls_are_equal, stream))
+          : detail::get_unique_ordered_indices(keys_view,
+                                               mutable_unique_indices_view,
+                                               keep, nulls_are_equal,
+                                               stream);
  
   // run gather operation to establish new order
   return detail::gather(input, unique_indices_view, false, false, false, mr, stream);
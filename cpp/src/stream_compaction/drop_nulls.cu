@@ -17,10 +17,12 @@
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/table/table_device_view.cuh>
+#include <cudf/null_mask.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/detail/stream_compaction.hpp>
 #include <cudf/detail/copy_if.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/utilities/bit.hpp>
 
 namespace {
 
@@ -56,6 +58,22 @@ protected:
   cudf::table_device_view keys_device_view;
 };
 
+// Returns true if bit i is set in the precomputed row-validity bitmask
+struct summary_filter
+{
+  __device__ inline
+  bool operator()(cudf::size_type i)
+  {
+    return cudf::bit_is_set(bitmask, i);
+  }
+
+  summary_filter(cudf::bitmask_type const* bitmask) : bitmask(bitmask) {}
+
+protected:
+
+  cudf::bitmask_type const* bitmask;
+};
+
 }  // namespace
 
 namespace cudf {
@@ -84,8 +102,33 @@ std::unique_ptr<experimental::table>
   return cudf::experimental::detail::copy_if(input, valid_table_filter{*keys_device_view, keep_threshold}, mr, stream);
 }
 
+/*
+ * Filters a table using a precomputed row-validity summary.
+ */
+std::unique_ptr<experimental::table>
+  drop_nulls(table_view const& input,
+             row_validity_summary const& summary,
+             rmm::mr::device_memory_resource *mr,
+             cudaStream_t stream) {
+
+  CUDF_EXPECTS(summary.num_rows() == input.num_rows(),
+               "summary and input row counts must match");
+
+  if (input.num_rows() == 0 || summary.all_valid()) {
+      return std::make_unique<table>(input, stream, mr);
+  }
+
+  return cudf::experimental::detail::copy_if(input, summary_filter{summary.bitmask()}, mr, stream);
+}
+
 } //namespace detail
 
+row_validity_summary::row_validity_summary(table_view const& table,
+                                           std::vector<size_type> const& keys,
+                                           rmm::mr::device_memory_resource* mr)
+  : _mask{cudf::bitmask_and(table.select(keys), mr)},
+    _num_rows{table.num_rows()} {}
+
 /*
  * Filters a table to remove null elements.
  */
@@ -108,6 +151,17 @@ std::unique_ptr<experimental::table>
     CUDF_FUNC_RANGE();
     return cudf::experimental::detail::drop_nulls(input, keys, keys.size(), mr);
 }
+/*
+ * Filters a table using a precomputed row-validity summary.
+ */
+std::unique_ptr<experimental::table>
+  drop_nulls(table_view const& input,
+             row_validity_summary const& summary,
+             rmm::mr::device_memory_resource *mr)
+{
+    CUDF_FUNC_RANGE();
+    return cudf::experimental::detail::drop_nulls(input, summary, mr);
+}
 
 } //namespace experimental
 } //namespace cudf
@@ -21,6 +21,7 @@
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/case.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <strings/char_types/is_flags.h>
 #include <strings/utilities.hpp>
 #include <strings/utilities.cuh>
@@ -335,12 +336,14 @@ std::unique_ptr<column> modify_strings( strings_column_view const& strings,
 std::unique_ptr<column> capitalize( strings_column_view const& strings,
                                     rmm::mr::device_memory_resource* mr)
 {
+  CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
   return detail::modify_strings<detail::probe_capitalize, detail::execute_capitalize>(strings, mr);
 }
 
 std::unique_ptr<column> title( strings_column_view const& strings,
                                rmm::mr::device_memory_resource* mr)
 {
+  CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
   return detail::modify_strings<detail::probe_title, detail::execute_title>(strings, mr);
 }
   
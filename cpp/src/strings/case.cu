@@ -21,6 +21,7 @@
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/case.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include "char_types/is_flags.h"
 #include "./utilities.hpp"
 #include "./utilities.cuh"
@@ -71,6 +72,24 @@ struct upper_lower_fn
         char* d_buffer = nullptr;
         if( Pass==ExecuteOp )
             d_buffer = d_chars + d_offsets[idx];
+        auto const d_str_chars = d_str.data();
+        auto const str_bytes = d_str.size_bytes();
+        // ASCII-only strings convert byte for byte with no UTF-8 decoding
+        // and never change size
+        if( detail::is_all_ascii(d_str_chars, str_bytes) )
+        {
+            if( Pass==ExecuteOp )
+            {
+                for( int32_t i=0; i < str_bytes; ++i )
+                {
+                    auto code_point = static_cast<uint32_t>(static_cast<uint8_t>(d_str_chars[i]));
+                    d_buffer[i] = (d_flags[code_point] & case_flag)
+                                  ? static_cast<char>(d_case_table[code_point])
+                                  : d_str_chars[i];
+                }
+            }
+            return str_bytes;
+        }
         for( auto itr = d_str.begin(); itr != d_str.end(); ++itr )
         {
             uint32_t code_point = detail::utf8_to_codepoint(*itr);
@@ -182,18 +201,21 @@ std::unique_ptr<column> swapcase( strings_column_view const& strings,
 std::unique_ptr<column> to_lower( strings_column_view const& strings,
                                   rmm::mr::device_memory_resource* mr )
 {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
     return detail::to_lower( strings, mr );
 }
 
 std::unique_ptr<column> to_upper( strings_column_view const& strings,
                                   rmm::mr::device_memory_resource* mr )
 {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
     return detail::to_upper( strings, mr);
 }
 
 std::unique_ptr<column> swapcase( strings_column_view const& strings,
                                   rmm::mr::device_memory_resource* mr )
 {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
     return detail::swapcase( strings, mr);
 }
 
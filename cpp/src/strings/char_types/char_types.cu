@@ -21,6 +21,7 @@
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/char_types/char_types.hpp>
 #include <cudf/wrappers/bool.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include "../utilities.hpp"
 #include "../utilities.cuh"
 
@@ -58,6 +59,16 @@ std::unique_ptr<column> all_characters_of_type( strings_column_view const& strin
                 return false;
             auto d_str = d_column.element<string_view>(idx);
             bool check = !d_str.empty(); // positive result requires at least one character
+            auto const d_chars = d_str.data();
+            auto const num_bytes = d_str.size_bytes();
+            // ASCII bytes are their own code-points: one lookup per byte
+            // with no UTF-8 decoding
+            if( detail::is_all_ascii(d_chars, num_bytes) )
+            {
+                for( size_type i=0; check && (i < num_bytes); ++i )
+                    check = (types & d_flags[static_cast<uint8_t>(d_chars[i])]) > 0;
+                return check;
+            }
             for( auto itr = d_str.begin(); check && (itr != d_str.end()); ++itr )
             {
                 auto code_point = detail::utf8_to_codepoint(*itr);
@@ -80,6 +91,7 @@ std::unique_ptr<column> all_characters_of_type( strings_column_view const& strin
                                                 string_character_types types,
                                                 rmm::mr::device_memory_resource* mr)
 {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
     return detail::all_characters_of_type(strings, types, mr);
 }
 
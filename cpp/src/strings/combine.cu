@@ -22,6 +22,7 @@
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/utilities/error.hpp>
 #include <cudf/detail/valid_if.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <strings/utilities.hpp>
 #include <strings/utilities.cuh>
 
@@ -133,6 +134,129 @@ std::unique_ptr<column> concatenate( table_view const& strings_columns,
                                null_count, std::move(null_mask), stream, mr);
 }
 
+//
+std::unique_ptr<column> concatenate_format( table_view const& strings_columns,
+                                            std::string const& format,
+                                            string_scalar const& narep = string_scalar("",false),
+                                            rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                                            cudaStream_t stream=0 )
+{
+    auto num_columns = strings_columns.num_columns();
+    CUDF_EXPECTS( num_columns > 0, "At least one column must be specified");
+    // check all columns are of type string
+    CUDF_EXPECTS( std::all_of( strings_columns.begin(), strings_columns.end(), [] (auto c) {return c.type().id()==STRING;}),
+                  "All columns must be of type string" );
+
+    // split the format into the literal pieces around each {} placeholder;
+    // there is one more piece than there are columns
+    std::vector<std::string> literals;
+    std::string literal;
+    for( size_t pos=0; pos < format.size(); )
+    {
+        if( format.compare(pos,2,"{}")==0 )
+        {
+            literals.push_back(literal);
+            literal.clear();
+            pos += 2;
+        }
+        else
+            literal += format[pos++];
+    }
+    literals.push_back(literal);
+    CUDF_EXPECTS( static_cast<size_type>(literals.size()) == num_columns+1,
+                  "Format must contain a {} placeholder for each column" );
+
+    auto strings_count = strings_columns.num_rows();
+    if( strings_count == 0 ) // empty begets empty
+        return detail::make_empty_strings_column(mr,stream);
+
+    string_view const d_narep = [&narep] {
+        if( !narep.is_valid() )
+            return string_view(nullptr,0);
+        return narep.size()==0 ? string_view("",0) : string_view(narep.data(),narep.size());
+    } ();
+
+    // copy the literal characters to the device once and build views into them
+    std::string h_literal_chars;
+    for( auto const& piece : literals )
+        h_literal_chars += piece;
+    rmm::device_vector<char> literal_chars(h_literal_chars.begin(),h_literal_chars.end());
+    auto d_literal_base = literal_chars.data().get();
+    std::vector<string_view> h_literals;
+    size_type literal_bytes = 0;
+    for( auto const& piece : literals )
+    {
+        h_literals.push_back(string_view(d_literal_base + literal_bytes, piece.size()));
+        literal_bytes += piece.size();
+    }
+    rmm::device_vector<string_view> literal_views(h_literals);
+    auto d_literals = literal_views.data().get();
+
+    // Create device views from the strings columns.
+    auto table = table_device_view::create(strings_columns,stream);
+    auto d_table = *table;
+
+    // create resulting null mask
+    auto valid_mask = cudf::experimental::detail::valid_if(
+        thrust::make_counting_iterator<size_type>(0),
+        thrust::make_counting_iterator<size_type>(strings_count),
+        [d_table, d_narep] __device__ (size_type idx) {
+            bool null_element = thrust::any_of( thrust::seq, d_table.begin(), d_table.end(),
+               [idx] (auto col) { return col.is_null(idx);});
+            return( !null_element || !d_narep.is_null() );
+        }, stream, mr );
+    rmm::device_buffer null_mask = valid_mask.first;
+    auto null_count = valid_mask.second;
+
+    // build offsets column by computing sizes of each string in the output;
+    // the literal pieces contribute the same fixed number of bytes to each row
+    auto offsets_transformer = [d_table, d_narep, literal_bytes] __device__ (size_type row_idx) {
+            bool null_element = thrust::any_of( thrust::seq, d_table.begin(), d_table.end(),
+                [row_idx] (auto const& d_column) { return d_column.is_null(row_idx);});
+            if( null_element && d_narep.is_null() )
+                return 0;
+            size_type bytes = literal_bytes;
+            bytes += thrust::transform_reduce( thrust::seq, d_table.begin(), d_table.end(),
+                [row_idx, d_narep] __device__ (column_device_view const& d_column) {
+                    return d_column.is_null(row_idx) ? d_narep.size_bytes()
+                                                     : d_column.element<string_view>(row_idx).size_bytes();
+                }, 0, thrust::plus<size_type>());
+            return bytes;
+        };
+    auto offsets_transformer_itr = thrust::make_transform_iterator( thrust::make_counting_iterator<size_type>(0), offsets_transformer );
+    auto offsets_column = detail::make_offsets_child_column(offsets_transformer_itr,
+                                                            offsets_transformer_itr+strings_count,
+                                                            mr, stream);
+    auto d_results_offsets = offsets_column->view().data<int32_t>();
+
+    // create the chars column
+    size_type bytes = thrust::device_pointer_cast(d_results_offsets)[strings_count];
+    auto chars_column = strings::detail::create_chars_child_column( strings_count, null_count, bytes, mr, stream );
+    // fill the chars column interleaving the literal pieces and column values
+    auto d_results_chars = chars_column->mutable_view().data<char>();
+    thrust::for_each_n(rmm::exec_policy(stream)->on(stream), thrust::make_counting_iterator<size_type>(0), strings_count,
+        [d_table, num_columns, d_literals, d_narep, d_results_offsets, d_results_chars] __device__(size_type idx){
+            bool null_element = thrust::any_of( thrust::seq, d_table.begin(), d_table.end(),
+                                                [idx] (column_device_view const& col) { return col.is_null(idx);});
+            if( null_element && d_narep.is_null() )
+                return; // do not write to buffer at all if any column element for this row is null
+            size_type offset = d_results_offsets[idx];
+            char* d_buffer = d_results_chars + offset;
+            // write out each column's entry for this row between the literal pieces
+            for( size_type col_idx=0; col_idx < num_columns; ++col_idx )
+            {
+                d_buffer = detail::copy_string(d_buffer, d_literals[col_idx]);
+                auto d_column = d_table.column(col_idx);
+                string_view d_str = d_column.is_null(idx) ? d_narep : d_column.element<string_view>(idx);
+                d_buffer = detail::copy_string(d_buffer, d_str);
+            }
+            d_buffer = detail::copy_string(d_buffer, d_literals[num_columns]);
+        });
+
+    return make_strings_column(strings_count, std::move(offsets_column), std::move(chars_column),
+                               null_count, std::move(null_mask), stream, mr);
+}
+
 //
 std::unique_ptr<column> join_strings( strings_column_view const& strings,
                                       string_scalar const& separator = string_scalar(""),
@@ -237,14 +361,25 @@ std::unique_ptr<column> concatenate( table_view const& strings_columns,
                                      string_scalar const& narep,
                                      rmm::mr::device_memory_resource* mr)
 {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
     return detail::concatenate(strings_columns, separator, narep, mr);
 }
 
+std::unique_ptr<column> concatenate_format( table_view const& strings_columns,
+                                            std::string const& format,
+                                            string_scalar const& narep,
+                                            rmm::mr::device_memory_resource* mr)
+{
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
+    return detail::concatenate_format(strings_columns, format, narep, mr);
+}
+
 std::unique_ptr<column> join_strings( strings_column_view const& strings,
                                       string_scalar const& separator,
                                       string_scalar const& narep,
                                       rmm::mr::device_memory_resource* mr )
 {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
     return detail::join_strings(strings, separator, narep, mr);
 }
 
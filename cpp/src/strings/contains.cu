@@ -22,20 +22,72 @@
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/char_types/char_types.hpp>
 #include <cudf/strings/contains.hpp>
+#include <cudf/utilities/error.hpp>
 #include <cudf/wrappers/bool.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <strings/utilities.hpp>
 #include <strings/regex/regex.cuh>
 
+#include <thrust/for_each.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+
 
 namespace cudf
 {
 namespace strings
 {
+
+/**
+ * @brief Holds the device regex program for the lifetime of the handle.
+ */
+struct compiled_regex::impl
+{
+    std::string pattern;
+    size_type strings_capacity;
+    std::unique_ptr<detail::reprog_device, std::function<void(detail::reprog_device*)>> prog;
+};
+
+compiled_regex::compiled_regex( std::string const& pattern, size_type strings_capacity )
+    : _impl(std::make_unique<impl>())
+{
+    _impl->pattern = pattern;
+    _impl->strings_capacity = strings_capacity;
+    _impl->prog = detail::reprog_device::create(pattern,
+        detail::get_character_flags_table(), strings_capacity, 0);
+}
+
+compiled_regex::~compiled_regex() = default;
+compiled_regex::compiled_regex( compiled_regex&& ) = default;
+compiled_regex& compiled_regex::operator=( compiled_regex&& ) = default;
+
+std::string const& compiled_regex::pattern() const { return _impl->pattern; }
+
+size_type compiled_regex::strings_capacity() const { return _impl->strings_capacity; }
+
+compiled_regex::impl* compiled_regex::get_impl() const { return _impl.get(); }
+
 namespace detail
 {
 namespace
 {
 
+/**
+ * @brief Returns the device program held by a compiled regex handle.
+ *
+ * Large patterns keep per-string state in global memory sized by the
+ * handle's strings capacity, so those reject strings columns with more rows.
+ */
+reprog_device get_reprog_device( compiled_regex const& prog, size_type strings_count )
+{
+    auto d_prog = *(prog.get_impl()->prog);
+    if( d_prog.insts_counts() > MAX_STACK_INSTS )
+        CUDF_EXPECTS( strings_count <= prog.strings_capacity(),
+            "strings column has more rows than the regex was compiled for" );
+    return d_prog;
+}
+
 /**
  * @brief This functor handles both contains_re and match_re to minimize the number
  * of regex calls to find() to be inlined greatly reducing compile time.
@@ -70,7 +122,7 @@ struct contains_fn
 
 //
 std::unique_ptr<column> contains_util( strings_column_view const& strings,
-                                       std::string const& pattern,
+                                       reprog_device d_prog,
                                        bool beginning_only = false,
                                        rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
                                        cudaStream_t stream = 0)
@@ -79,10 +131,6 @@ std::unique_ptr<column> contains_util( strings_column_view const& strings,
     auto strings_column = column_device_view::create(strings.parent(),stream);
     auto d_column = *strings_column;
 
-    // compile regex into device object
-    auto prog = reprog_device::create(pattern,get_character_flags_table(),strings_count,stream);
-    auto d_prog = *prog;
-
     // create the output column
     auto results = make_numeric_column( data_type{BOOL8}, strings_count,
         copy_bitmask( strings.parent(), stream, mr), strings.null_count(), stream, mr);
@@ -111,6 +159,56 @@ std::unique_ptr<column> contains_util( strings_column_view const& strings,
     return results;
 }
 
+//
+std::unique_ptr<column> contains_util( strings_column_view const& strings,
+                                       std::string const& pattern,
+                                       bool beginning_only = false,
+                                       rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                                       cudaStream_t stream = 0)
+{
+    // compile regex into device object
+    auto prog = reprog_device::create(pattern,get_character_flags_table(),strings.size(),stream);
+    return contains_util(strings, *prog, beginning_only, mr, stream);
+}
+
+/**
+ * @brief This evaluates all the regex patterns against a string in one pass.
+ *
+ * The string's characters are loaded once for all the patterns, so the
+ * character-load cost is paid once per string rather than once per pattern.
+ * The stack memory is sized for the largest stack-resident pattern and
+ * reused serially by each program; large patterns use their own global
+ * state memory as usual.
+ */
+template<size_t stack_size>
+struct multi_contains_fn
+{
+    reprog_device* d_progs;
+    size_type num_patterns;
+    column_device_view d_strings;
+    cudf::experimental::bool8** d_results;
+
+    __device__ void operator()(size_type idx)
+    {
+        u_char data1[stack_size], data2[stack_size];
+        bool const is_null = d_strings.is_null(idx);
+        string_view d_str = is_null ? string_view{} : d_strings.element<string_view>(idx);
+        for( size_type pidx=0; pidx < num_patterns; ++pidx )
+        {
+            if( is_null )
+            {
+                d_results[pidx][idx] = 0;
+                continue;
+            }
+            reprog_device prog = d_progs[pidx];
+            prog.set_stack_mem(data1,data2);
+            int32_t begin = 0;
+            int32_t end = d_str.length();
+            d_results[pidx][idx] = static_cast<experimental::bool8>(prog.find(idx,d_str,begin,end));
+        }
+    }
+};
+
 } // namespace
 
 std::unique_ptr<column> contains_re( strings_column_view const& strings,
@@ -121,6 +219,14 @@ std::unique_ptr<column> contains_re( strings_column_view const& strings,
     return contains_util(strings, pattern, false, mr, stream);
 }
 
+std::unique_ptr<column> contains_re( strings_column_view const& strings,
+                                     compiled_regex const& prog,
+                                     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                                     cudaStream_t stream = 0)
+{
+    return contains_util(strings, get_reprog_device(prog,strings.size()), false, mr, stream);
+}
+
 std::unique_ptr<column> matches_re( strings_column_view const& strings,
                                     std::string const& pattern,
                                     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
@@ -129,6 +235,73 @@ std::unique_ptr<column> matches_re( strings_column_view const& strings,
     return contains_util(strings, pattern, true, mr, stream);
 }
 
+std::unique_ptr<column> matches_re( strings_column_view const& strings,
+                                    compiled_regex const& prog,
+                                    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                                    cudaStream_t stream = 0)
+{
+    return contains_util(strings, get_reprog_device(prog,strings.size()), true, mr, stream);
+}
+
+std::vector<std::unique_ptr<column>> contains_re( strings_column_view const& strings,
+                                                  std::vector<std::string> const& patterns,
+                                                  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                                                  cudaStream_t stream = 0)
+{
+    CUDF_EXPECTS( !patterns.empty(), "Must include at least one pattern" );
+    auto strings_count = strings.size();
+    auto strings_column = column_device_view::create(strings.parent(),stream);
+    auto d_column = *strings_column;
+    auto num_patterns = static_cast<size_type>(patterns.size());
+
+    // compile each regex into a device object;
+    // the compiled programs are copied into one device array so a single
+    // kernel can walk all of them for each string
+    std::vector<std::unique_ptr<reprog_device,std::function<void(reprog_device*)>>> progs;
+    std::vector<reprog_device> h_progs;
+    int regex_insts = 0; // largest stack-resident pattern drives the stack size
+    for( auto const& pattern : patterns )
+    {
+        progs.push_back(reprog_device::create(pattern,get_character_flags_table(),strings_count,stream));
+        int insts = progs.back()->insts_counts();
+        if( insts <= MAX_STACK_INSTS )
+            regex_insts = std::max(regex_insts,insts);
+        h_progs.push_back(*progs.back());
+    }
+    rmm::device_vector<reprog_device> d_progs(h_progs);
+
+    // create one output column per pattern and gather their data pointers
+    // so the kernel can write all the results in the one pass
+    std::vector<std::unique_ptr<column>> results;
+    std::vector<cudf::experimental::bool8*> h_results;
+    for( size_type pidx=0; pidx < num_patterns; ++pidx )
+    {
+        results.push_back(make_numeric_column( data_type{BOOL8}, strings_count,
+            copy_bitmask( strings.parent(), stream, mr), strings.null_count(), stream, mr));
+        h_results.push_back(results.back()->mutable_view().data<cudf::experimental::bool8>());
+    }
+    rmm::device_vector<cudf::experimental::bool8*> d_results(h_results);
+
+    // fill the output columns
+    auto execpol = rmm::exec_policy(stream);
+    if( regex_insts <= RX_SMALL_INSTS )
+        thrust::for_each_n(execpol->on(stream),
+            thrust::make_counting_iterator<size_type>(0), strings_count,
+            multi_contains_fn<RX_STACK_SMALL>{d_progs.data().get(), num_patterns, d_column, d_results.data().get()} );
+    else if( regex_insts <= RX_MEDIUM_INSTS )
+        thrust::for_each_n(execpol->on(stream),
+            thrust::make_counting_iterator<size_type>(0), strings_count,
+            multi_contains_fn<RX_STACK_MEDIUM>{d_progs.data().get(), num_patterns, d_column, d_results.data().get()} );
+    else
+        thrust::for_each_n(execpol->on(stream),
+            thrust::make_counting_iterator<size_type>(0), strings_count,
+            multi_contains_fn<RX_STACK_LARGE>{d_progs.data().get(), num_patterns, d_column, d_results.data().get()} );
+
+    for( auto& result : results )
+        result->set_null_count(strings.null_count());
+    return results;
+}
+
 } // namespace detail
 
 // external APIs
@@ -140,6 +313,20 @@ std::unique_ptr<column> contains_re( strings_column_view const& strings,
     return detail::contains_re(strings, pattern, mr);
 }
 
+std::unique_ptr<column> contains_re( strings_column_view const& strings,
+                                     compiled_regex const& prog,
+                                     rmm::mr::device_memory_resource* mr)
+{
+    return detail::contains_re(strings, prog, mr);
+}
+
+std::vector<std::unique_ptr<column>> contains_re( strings_column_view const& strings,
+                                                  std::vector<std::string> const& patterns,
+                                                  rmm::mr::device_memory_resource* mr)
+{
+    return detail::contains_re(strings, patterns, mr);
+}
+
 std::unique_ptr<column> matches_re( strings_column_view const& strings,
                                      std::string const& pattern,
                                      rmm::mr::device_memory_resource* mr)
@@ -147,6 +334,13 @@ std::unique_ptr<column> matches_re( strings_column_view const& strings,
     return detail::matches_re(strings, pattern, mr);
 }
 
+std::unique_ptr<column> matches_re( strings_column_view const& strings,
+                                     compiled_regex const& prog,
+                                     rmm::mr::device_memory_resource* mr)
+{
+    return detail::matches_re(strings, prog, mr);
+}
+
 namespace detail
 {
 
@@ -185,21 +379,16 @@ struct count_fn
     }
 };
 
-}
-
-std::unique_ptr<column> count_re( strings_column_view const& strings,
-                                  std::string const& pattern,
-                                  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
-                                  cudaStream_t stream = 0)
+//
+std::unique_ptr<column> count_util( strings_column_view const& strings,
+                                    reprog_device d_prog,
+                                    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                                    cudaStream_t stream = 0)
 {
     auto strings_count = strings.size();
     auto strings_column = column_device_view::create(strings.parent(),stream);
     auto d_column = *strings_column;
 
-    // compile regex into device object
-    auto prog = reprog_device::create(pattern,get_character_flags_table(),strings_count,stream);
-    auto d_prog = *prog;
-
     // create the output column
     auto results = make_numeric_column( data_type{INT32}, strings_count,
         copy_bitmask( strings.parent(), stream, mr), strings.null_count(), stream, mr);
@@ -229,6 +418,26 @@ std::unique_ptr<column> count_re( strings_column_view const& strings,
 
 }
 
+} // namespace
+
+std::unique_ptr<column> count_re( strings_column_view const& strings,
+                                  std::string const& pattern,
+                                  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                                  cudaStream_t stream = 0)
+{
+    // compile regex into device object
+    auto prog = reprog_device::create(pattern,get_character_flags_table(),strings.size(),stream);
+    return count_util(strings, *prog, mr, stream);
+}
+
+std::unique_ptr<column> count_re( strings_column_view const& strings,
+                                  compiled_regex const& prog,
+                                  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                                  cudaStream_t stream = 0)
+{
+    return count_util(strings, get_reprog_device(prog,strings.size()), mr, stream);
+}
+
 } // namespace detail
 
 // external API
@@ -237,8 +446,17 @@ std::unique_ptr<column> count_re( strings_column_view const& strings,
                                   std::string const& pattern,
                                   rmm::mr::device_memory_resource* mr)
 {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
     return detail::count_re(strings, pattern, mr);
 }
 
+std::unique_ptr<column> count_re( strings_column_view const& strings,
+                                  compiled_regex const& prog,
+                                  rmm::mr::device_memory_resource* mr)
+{
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
+    return detail::count_re(strings, prog, mr);
+}
+
 } // namespace strings
 } // namespace cudf
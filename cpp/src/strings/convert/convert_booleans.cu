@@ -21,6 +21,7 @@
 #include <cudf/strings/string_view.cuh>
 #include <cudf/utilities/type_dispatcher.hpp>
 #include <cudf/utilities/traits.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include "../utilities.hpp"
 #include "../utilities.cuh"
 
@@ -149,6 +150,7 @@ std::unique_ptr<column> from_booleans( column_view const& booleans,
                                        string_scalar const& false_string,
                                        rmm::mr::device_memory_resource* mr)
 {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
     return detail::from_booleans(booleans,true_string,false_string,mr);
 }
 
@@ -23,6 +23,7 @@
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/utilities/error.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <strings/utilities.hpp>
 #include <strings/utilities.cuh>
 
@@ -797,6 +798,7 @@ std::unique_ptr<column> from_timestamps( column_view const& timestamps,
                                          std::string const& format,
                                          rmm::mr::device_memory_resource* mr)
 {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
     return detail::from_timestamps(timestamps, format, mr );
 }
 
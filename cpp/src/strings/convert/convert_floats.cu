@@ -16,11 +16,13 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/valid_if.cuh>
 #include <cudf/strings/convert/convert_floats.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/utilities/type_dispatcher.hpp>
 #include <cudf/utilities/traits.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include "../utilities.hpp"
 #include "../utilities.cuh"
 
@@ -40,6 +42,37 @@ namespace detail
 namespace
 {
 
+/**
+ * @brief Returns true if the eight bytes at the given pointer are all
+ * ASCII digits.
+ *
+ * Checks all eight bytes in one 64-bit comparison instead of eight
+ * byte comparisons.
+ */
+__device__ inline bool are_eight_digits( const char* in_ptr )
+{
+    uint64_t val;
+    memcpy(&val, in_ptr, 8);
+    return ((val & 0xF0F0F0F0F0F0F0F0UL) |
+            (((val + 0x0606060606060606UL) & 0xF0F0F0F0F0F0F0F0UL) >> 4)) == 0x3333333333333333UL;
+}
+
+/**
+ * @brief Converts eight ASCII digit bytes into their integer value.
+ *
+ * The multiply-and-shift steps combine adjacent digit pairs in parallel
+ * within the 64-bit word, evaluating all eight digits in three steps
+ * rather than eight dependent multiply-adds.
+ */
+__device__ inline unsigned long parse_eight_digits( const char* in_ptr )
+{
+    uint64_t val;
+    memcpy(&val, in_ptr, 8);
+    val = (val & 0x0F0F0F0F0F0F0F0FUL) * 2561UL >> 8;
+    val = (val & 0x00FF00FF00FF00FFUL) * 6553601UL >> 16;
+    return (val & 0x0000FFFF0000FFFFUL) * 42949672960001UL >> 32;
+}
+
 /**
  * @brief This function converts the given string into a
  * floating point double value.
@@ -48,20 +81,34 @@ namespace
  * to the appropriate float values.
  *
  * This function will also handle scientific notation format.
+ *
+ * The valid parameter is set to true only if the entire string was
+ * consumed as a well-formed float, allowing callers to compute the
+ * output validity in the same pass as the value.
  */
-__device__ inline double stod( string_view const& d_str )
+__device__ inline double stod( string_view const& d_str, bool& valid )
 {
     const char* in_ptr = d_str.data();
     const char* end = in_ptr + d_str.size_bytes();
+    valid = false;
     if( end==in_ptr )
         return 0.0;
     // special strings
     if( d_str.compare("NaN",3)==0 )
+    {
+        valid = true;
         return std::numeric_limits<double>::quiet_NaN();
+    }
     if( d_str.compare("Inf",3)==0 )
+    {
+        valid = true;
         return std::numeric_limits<double>::infinity();
+    }
     if( d_str.compare("-Inf",4)==0 )
+    {
+        valid = true;
         return -std::numeric_limits<double>::infinity();
+    }
     double sign = 1.0;
     if(*in_ptr == '-' || *in_ptr == '+')
     {
@@ -69,20 +116,36 @@ __device__ inline double stod( string_view const& d_str )
         ++in_ptr;
     }
     unsigned long max_mantissa = 0x0FFFFFFFFFFFFF;
+    // largest value that can take eight more digits without passing max_mantissa
+    unsigned long max_batch_mantissa = (max_mantissa - 99999999L)/100000000L;
     unsigned long digits = 0;
     int exp_off = 0;
     bool decimal = false;
+    bool has_digits = false;
+    bool malformed = false;
     while( in_ptr < end )
     {
+        // consume eight digits at a time while they cannot overflow the mantissa;
+        // this accumulates exactly like eight trips through the loop below
+        if( (in_ptr+8 <= end) && (digits <= max_batch_mantissa) && are_eight_digits(in_ptr) )
+        {
+            digits = (digits * 100000000L) + parse_eight_digits(in_ptr);
+            exp_off -= 8 * (int)decimal;
+            in_ptr += 8;
+            has_digits = true;
+            continue;
+        }
         char ch = *in_ptr;
         if(ch == '.')
         {
+            malformed = malformed || decimal; // second decimal point
             decimal = true;
             ++in_ptr;
             continue;
         }
         if(ch < '0' || ch > '9')
             break;
+        has_digits = true;
         if( digits > max_mantissa )
             exp_off += (int)!decimal;
         else
@@ -103,24 +166,30 @@ __device__ inline double stod( string_view const& d_str )
     int exp_sign = 1;
     if( in_ptr < end )
     {
-        char ch = *in_ptr++;
+        char ch = *in_ptr;
         if( ch=='e' || ch=='E' )
         {
-            if( in_ptr < end )
+            ++in_ptr;
+            if( in_ptr < end && (*in_ptr=='-' || *in_ptr=='+') )
             {
-                ch = *in_ptr++;
-                if( ch=='-' || ch=='+' )
-                    exp_sign = (ch=='-' ? -1 : 1);
-                while( in_ptr < end )
-                {
-                    ch = *in_ptr++;
-                    if(ch < '0' || ch > '9')
-                        break;
-                    exp10 = (exp10 * 10) + (int)(ch-'0');
-                }
+                exp_sign = (*in_ptr=='-' ? -1 : 1);
+                ++in_ptr;
             }
+            bool has_exp_digits = false;
+            while( in_ptr < end )
+            {
+                ch = *in_ptr;
+                if(ch < '0' || ch > '9')
+                    break;
+                exp10 = (exp10 * 10) + (int)(ch-'0');
+                has_exp_digits = true;
+                ++in_ptr;
+            }
+            malformed = malformed || !has_exp_digits;
         }
     }
+    // a valid float consumed the entire string and had at least one digit
+    valid = has_digits && (in_ptr==end) && !malformed;
     exp10 *= exp_sign;
     exp10 += exp_off;
     if( exp10 > 308 )
@@ -131,6 +200,12 @@ __device__ inline double stod( string_view const& d_str )
     return (value * sign);
 }
 
+__device__ inline double stod( string_view const& d_str )
+{
+    bool valid = false;
+    return stod(d_str, valid);
+}
+
 /**
  * @brief Converts strings column entries into floats.
  *
@@ -151,6 +226,33 @@ struct string_to_float_fn
     }
 };
 
+/**
+ * @brief Converts strings column entries into floats while recording
+ * which entries parsed successfully.
+ *
+ * This fuses the validity check with the conversion so invalid entries
+ * do not require re-parsing the strings in a second pass.
+ */
+template <typename FloatType>
+struct string_to_float_checked_fn
+{
+    const column_device_view strings_column; // strings to convert
+    bool* d_valids; // true for entries that parsed as a valid float
+
+    __device__ FloatType operator()(size_type idx)
+    {
+        if( strings_column.is_null(idx) )
+        {
+            d_valids[idx] = false;
+            return static_cast<FloatType>(0);
+        }
+        bool valid = false;
+        auto result = static_cast<FloatType>(stod(strings_column.element<string_view>(idx),valid));
+        d_valids[idx] = valid;
+        return result;
+    }
+};
+
 /**
  * @brief The dispatch functions for converting strings to floats.
  *
@@ -177,6 +279,33 @@ struct dispatch_to_floats_fn
     }
 };
 
+/**
+ * @brief The dispatch functions for the fused parse-and-validate conversion.
+ *
+ * The output_column is expected to be one of the float types only.
+ */
+struct dispatch_to_floats_checked_fn
+{
+    template <typename FloatType, std::enable_if_t<std::is_floating_point<FloatType>::value>* = nullptr>
+    void operator()( column_device_view const& strings_column,
+                     mutable_column_view& output_column,
+                     bool* d_valids,
+                     cudaStream_t stream ) const
+    {
+        auto d_results = output_column.data<FloatType>();
+        thrust::transform( rmm::exec_policy(stream)->on(stream),
+            thrust::make_counting_iterator<size_type>(0),
+            thrust::make_counting_iterator<size_type>(strings_column.size()),
+            d_results, string_to_float_checked_fn<FloatType>{strings_column, d_valids});
+    }
+    // non-integral types throw an exception
+    template <typename T, std::enable_if_t<not std::is_floating_point<T>::value>* = nullptr>
+    void operator()(column_device_view const&, mutable_column_view&, bool*, cudaStream_t) const
+    {
+        CUDF_FAIL("Output for to_floats_checked must be a float type.");
+    }
+};
+
 } // namespace
 
 
@@ -202,6 +331,36 @@ std::unique_ptr<column> to_floats( strings_column_view const& strings,
     return results;
 }
 
+// This will convert a strings column into any float column type,
+// producing null entries for strings that do not parse as valid floats.
+std::unique_ptr<column> to_floats_checked( strings_column_view const& strings,
+                                           data_type output_type,
+                                           rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                                           cudaStream_t stream = 0)
+{
+    size_type strings_count = strings.size();
+    if( strings_count == 0 )
+        return make_numeric_column( output_type, 0 );
+    auto strings_column = column_device_view::create(strings.parent(), stream);
+    auto d_strings = *strings_column;
+    // the output null mask is not known until the strings are parsed
+    auto results = make_numeric_column( output_type, strings_count, mask_state::UNALLOCATED, stream, mr);
+    auto results_view = results->mutable_view();
+    // fill output column with floats, recording which entries parsed successfully
+    rmm::device_vector<bool> valids(strings_count);
+    auto d_valids = valids.data().get();
+    experimental::type_dispatcher( output_type, dispatch_to_floats_checked_fn{},
+                                   d_strings, results_view, d_valids, stream );
+    // build the null mask from the per-entry parse results
+    auto valid_mask = experimental::detail::valid_if(
+        thrust::make_counting_iterator<size_type>(0),
+        thrust::make_counting_iterator<size_type>(strings_count),
+        [d_valids] __device__ (size_type idx) { return d_valids[idx]; },
+        stream, mr );
+    results->set_null_mask( std::move(valid_mask.first), valid_mask.second );
+    return results;
+}
+
 } // namespace detail
 
 // external API
@@ -213,6 +372,13 @@ std::unique_ptr<column> to_floats( strings_column_view const& strings,
     return detail::to_floats(strings, output_type, mr );
 }
 
+std::unique_ptr<column> to_floats_checked( strings_column_view const& strings,
+                                           data_type output_type,
+                                           rmm::mr::device_memory_resource* mr)
+{
+    return detail::to_floats_checked(strings, output_type, mr );
+}
+
 
 namespace detail
 {
@@ -572,6 +738,7 @@ std::unique_ptr<column> from_floats( column_view const& floats,
 std::unique_ptr<column> from_floats( column_view const& floats,
                                      rmm::mr::device_memory_resource* mr)
 {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
     return detail::from_floats(floats,mr);
 }
 
@@ -19,6 +19,7 @@
 #include <cudf/strings/convert/convert_ipv4.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/strings/string_view.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <strings/utilities.hpp>
 #include <strings/utilities.cuh>
 
@@ -221,6 +222,7 @@ std::unique_ptr<column> integers_to_ipv4( column_view const& integers,
 std::unique_ptr<column> integers_to_ipv4( column_view const& integers,
                                           rmm::mr::device_memory_resource* mr)
 {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
     return detail::integers_to_ipv4(integers,mr);
 }
 
@@ -19,6 +19,7 @@
 #include <cudf/strings/convert/convert_urls.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/strings/string_view.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <strings/utilities.hpp>
 #include <strings/utilities.cuh>
 
@@ -264,6 +265,7 @@ std::unique_ptr<column> url_decode( strings_column_view const& strings,
 std::unique_ptr<column> url_decode( strings_column_view const& strings,
                                     rmm::mr::device_memory_resource* mr)
 {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
     return detail::url_decode(strings,mr);
 }
 
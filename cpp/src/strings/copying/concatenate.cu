@@ -17,6 +17,7 @@
 #include <bitmask/legacy/valid_if.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/concatenate.hpp>
 #include <cudf/strings/detail/concatenate.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <strings/utilities.hpp>
@@ -24,6 +25,8 @@
 #include <thrust/for_each.h>
 #include <thrust/transform_reduce.h>
 
+#include <limits>
+
 namespace cudf
 {
 namespace strings
@@ -120,6 +123,55 @@ std::unique_ptr<column> concatenate( std::vector<strings_column_view> const& str
                                null_count, std::move(null_mask), stream, mr);
 }
 
+std::vector<std::unique_ptr<column>> concatenate_chunked(
+    std::vector<strings_column_view> const& strings_columns,
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream )
+{
+    constexpr size_t size_limit = std::numeric_limits<size_type>::max();
+
+    std::vector<std::unique_ptr<column>> results;
+    std::vector<strings_column_view> group;
+    size_t group_bytes = 0;
+    size_t group_rows = 0;
+
+    // concatenate the current group and fill in its validity mask
+    auto flush_group = [&] {
+        if( group.empty() )
+            return;
+        auto result = concatenate(group, mr, stream);
+        if( result->nullable() )
+        {
+            std::vector<column_view> views;
+            for( auto const& scv : group )
+                views.push_back(scv.parent());
+            result->set_null_mask(concatenate_masks(views, mr), result->null_count());
+        }
+        results.push_back(std::move(result));
+        group.clear();
+        group_bytes = 0;
+        group_rows = 0;
+    };
+
+    // pack the input columns greedily; splits occur only on input column
+    // boundaries since each input already fits under the limit on its own
+    for( auto const& scv : strings_columns )
+    {
+        // chars_size() counts the whole chars child even for a sliced view
+        // which can only over-estimate; the split stays valid
+        size_t const bytes = scv.size()==0 ? 0 : static_cast<size_t>(scv.chars_size());
+        size_t const rows = static_cast<size_t>(scv.size());
+        if( !group.empty() &&
+            ((group_bytes + bytes >= size_limit) || (group_rows + rows >= size_limit)) )
+            flush_group();
+        group.push_back(scv);
+        group_bytes += bytes;
+        group_rows += rows;
+    }
+    flush_group();
+    return results;
+}
+
 } // namespace detail
 } // namespace strings
 } // namespace cudf
@@ -18,11 +18,13 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/gather.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/strings/copying.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <strings/utilities.hpp>
 
 #include <thrust/sequence.h>
+#include <thrust/transform.h>
 
 namespace cudf
 {
@@ -46,6 +48,8 @@ std::unique_ptr<cudf::column> slice( strings_column_view const& strings,
     if( end < 0 || end > strings_count )
         end = strings_count;
     CUDF_EXPECTS( ((start >= 0) && (start < end)), "Invalid start parameter value.");
+    if( step == 1 ) // contiguous ranges do not need a gather
+        return copy_slice( strings, start, end, stream, mr );
     strings_count = cudf::util::round_up_safe<size_type>((end - start),step);
     //
     auto execpol = rmm::exec_policy(stream);
@@ -62,6 +66,57 @@ std::unique_ptr<cudf::column> slice( strings_column_view const& strings,
     return output_column;
 }
 
+// direct copy of a contiguous range of rows; no gather
+std::unique_ptr<cudf::column> copy_slice( strings_column_view const& strings,
+                                          size_type start, size_type end,
+                                          cudaStream_t stream,
+                                          rmm::mr::device_memory_resource* mr )
+{
+    size_type strings_count = end - start;
+    if( strings_count <= 0 )
+        return make_empty_strings_column(mr,stream);
+    CUDF_EXPECTS( ((start >= 0) && (end <= strings.size())), "Invalid start or end parameter value." );
+
+    auto execpol = rmm::exec_policy(stream);
+    // row positions within the base offsets/chars children
+    auto const base_start = strings.offset() + start;
+    const int32_t* d_offsets = strings.offsets().data<int32_t>() + base_start;
+
+    // the byte range of the chars child covered by these rows
+    int32_t first_byte=0, last_byte=0;
+    CUDA_TRY(cudaMemcpyAsync( &first_byte, d_offsets, sizeof(int32_t), cudaMemcpyDeviceToHost, stream));
+    CUDA_TRY(cudaMemcpyAsync( &last_byte, d_offsets + strings_count, sizeof(int32_t), cudaMemcpyDeviceToHost, stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+
+    // null mask and count for just this range
+    size_type null_count = 0;
+    rmm::device_buffer null_mask;
+    if( strings.parent().nullable() )
+    {
+        null_count = cudf::count_unset_bits( strings.null_mask(), base_start, base_start + strings_count );
+        if( null_count > 0 )
+            null_mask = cudf::copy_bitmask( strings.null_mask(), base_start, base_start + strings_count, stream, mr );
+    }
+
+    // re-base the offsets to zero
+    auto offsets_column = make_numeric_column( data_type{INT32}, strings_count + 1,
+                                               mask_state::UNALLOCATED, stream, mr );
+    auto offsets_view = offsets_column->mutable_view();
+    thrust::transform( execpol->on(stream), d_offsets, d_offsets + strings_count + 1,
+                       offsets_view.begin<int32_t>(),
+                       [first_byte] __device__ (int32_t offset) { return offset - first_byte; } );
+
+    // the chars are one contiguous copy
+    auto const bytes = last_byte - first_byte;
+    auto chars_column = create_chars_child_column( strings_count, null_count, bytes, mr, stream );
+    CUDA_TRY(cudaMemcpyAsync( chars_column->mutable_view().data<char>(),
+                              strings.chars().data<char>() + first_byte, bytes,
+                              cudaMemcpyDeviceToDevice, stream ));
+
+    return make_strings_column( strings_count, std::move(offsets_column), std::move(chars_column),
+                                null_count, std::move(null_mask), stream, mr );
+}
+
 } // namespace detail
 } // namespace strings
 } // namespace cudf
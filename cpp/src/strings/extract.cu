@@ -22,6 +22,7 @@
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/char_types/char_types.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <strings/utilities.hpp>
 #include <strings/regex/regex.cuh>
 
@@ -129,6 +130,7 @@ std::unique_ptr<experimental::table> extract( strings_column_view const& strings
                                               std::string const& pattern,
                                               rmm::mr::device_memory_resource* mr)
 {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
     return detail::extract(strings, pattern, mr);
 }
 
@@ -16,23 +16,252 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/strings/find.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/utilities/error.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include "./utilities.hpp"
 
+#include <rmm/thrust_rmm_allocator.h>
+#include <thrust/for_each.h>
 #include <thrust/transform.h>
 
 namespace cudf
 {
 namespace strings
 {
+namespace
+{
+
+/**
+ * @brief Returns the signature bit for a byte trigram.
+ *
+ * Must produce the same bit on host and device so a target mask built on
+ * the host matches the row signatures built on the device.
+ */
+__host__ __device__ inline unsigned long long trigram_bit( unsigned char c0, unsigned char c1, unsigned char c2 )
+{
+    unsigned int hash = static_cast<unsigned int>(c0);
+    hash = hash*31 + c1;
+    hash = hash*31 + c2;
+    return 1ull << (hash & 63u);
+}
+
+/**
+ * @brief Computes one trigram signature per row of the strings column.
+ */
+void build_trigram_signatures( strings_column_view const& strings,
+                               rmm::device_vector<unsigned long long>& signatures,
+                               cudaStream_t stream )
+{
+    auto strings_count = strings.size();
+    signatures.resize(strings_count);
+    if( strings_count==0 )
+        return;
+    auto strings_column = column_device_view::create(strings.parent(),stream);
+    auto d_strings = *strings_column;
+    auto d_signatures = signatures.data().get();
+    thrust::for_each_n( rmm::exec_policy(stream)->on(stream),
+        thrust::make_counting_iterator<size_type>(0), strings_count,
+        [d_strings, d_signatures] __device__ (size_type idx) {
+            unsigned long long sig = 0;
+            if( !d_strings.is_null(idx) )
+            {
+                auto const d_str = d_strings.element<string_view>(idx);
+                auto const d_chars = d_str.data();
+                for( size_type i=0; (i+2) < d_str.size_bytes(); ++i )
+                    sig |= trigram_bit(d_chars[i],d_chars[i+1],d_chars[i+2]);
+            }
+            d_signatures[idx] = sig;
+        });
+}
+
+/**
+ * @brief Builds the trigram mask for a search target from its host copy.
+ *
+ * Returns 0 for targets shorter than three bytes which cannot use the index.
+ */
+unsigned long long build_target_mask( std::string const& h_target )
+{
+    unsigned long long t_mask = 0;
+    for( size_t i=0; (i+2) < h_target.size(); ++i )
+        t_mask |= trigram_bit(h_target[i],h_target[i+1],h_target[i+2]);
+    return t_mask;
+}
+
+} // namespace
+
+/**
+ * @brief Holds the device signatures for the lifetime of the index.
+ */
+struct trigram_index::impl
+{
+    rmm::device_vector<unsigned long long> signatures;
+};
+
+trigram_index::trigram_index( strings_column_view const& strings )
+    : _impl(std::make_unique<impl>())
+{
+    build_trigram_signatures(strings, _impl->signatures, 0);
+}
+
+trigram_index::~trigram_index() = default;
+trigram_index::trigram_index( trigram_index&& ) = default;
+trigram_index& trigram_index::operator=( trigram_index&& ) = default;
+
+size_type trigram_index::size() const { return static_cast<size_type>(_impl->signatures.size()); }
+
+trigram_index::impl* trigram_index::get_impl() const { return _impl.get(); }
+
 namespace detail
 {
 namespace
 {
 
+// Average string byte length above which the warp-cooperative kernels are
+// used. A single thread serially walking a long string leaves the rest of
+// its warp idle; short rows do better with the simple thread-per-string path.
+constexpr size_type warp_parallel_avg_bytes = 64;
+constexpr int warp_parallel_block_size = 256;
+
+/**
+ * @brief Returns true if the strings are long enough on average to warrant
+ * a warp per string.
+ *
+ * The average comes from the offsets (chars size over row count) so choosing
+ * the path requires no device work.
+ */
+bool use_warp_parallel( strings_column_view const& strings )
+{
+    return (strings.size() > 0) &&
+           ((strings.chars_size() / strings.size()) > warp_parallel_avg_bytes);
+}
+
+/**
+ * @brief Kernel computes the position of a target within each string using
+ * a warp per string.
+ *
+ * The lanes of a warp check candidate byte positions of one string in a
+ * strided fashion. A byte-wise match of a valid UTF-8 target can only occur
+ * on a character boundary, so candidates need not be filtered first. The
+ * winning byte offset is converted to a character position by counting the
+ * lead bytes before it, also cooperatively.
+ *
+ * @tparam forward If true the first match position is returned, otherwise
+ * the last as required by rfind.
+ */
+template <bool forward>
+__global__ void find_warp_parallel_fn( column_device_view d_strings,
+                                       string_view d_target,
+                                       size_type start, size_type stop,
+                                       int32_t* d_results )
+{
+    constexpr auto warp_size = cudf::experimental::detail::warp_size;
+    using warp_reduce = cub::WarpReduce<size_type>;
+    __shared__ typename warp_reduce::TempStorage temp_storage[warp_parallel_block_size/warp_size];
+
+    size_type idx = static_cast<size_type>(threadIdx.x + blockIdx.x * blockDim.x);
+    if( idx >= (d_strings.size() * warp_size) )
+        return;
+    auto const str_idx = idx / warp_size;
+    auto const lane_idx = idx % warp_size;
+    auto& warp_storage = temp_storage[threadIdx.x / warp_size];
+    if( d_strings.is_null(str_idx) )
+    {
+        if( lane_idx == 0 )
+            d_results[str_idx] = -1;
+        return;
+    }
+    auto const d_str = d_strings.element<string_view>(str_idx);
+    auto const d_chars = d_str.data();
+    auto const tgt_bytes = d_target.size_bytes();
+
+    // lane 0 walks the character positions once to convert start/stop into a
+    // byte range and broadcasts it; the lanes then scan bytes, not characters
+    size_type begin_byte = 0;
+    size_type end_byte = 0;
+    if( lane_idx == 0 )
+    {
+        size_type length = d_str.length();
+        size_type end = (stop < 0) || (stop > length) ? length : stop;
+        begin_byte = start < length ? d_str.byte_offset(start) : d_str.size_bytes();
+        end_byte = d_str.byte_offset(end);
+    }
+    begin_byte = __shfl_sync(0xffffffff, begin_byte, 0);
+    end_byte = __shfl_sync(0xffffffff, end_byte, 0);
+
+    // each lane's strided scan is in ascending order so its first match is
+    // its best forward candidate and its last match its best backward one
+    size_type match_byte = forward ? d_str.size_bytes() + 1 : -1;
+    for( size_type i = begin_byte + lane_idx; (i + tgt_bytes) <= end_byte; i += warp_size )
+    {
+        if( d_target.compare(d_chars + i, tgt_bytes)==0 )
+        {
+            match_byte = i;
+            if( forward )
+                break;
+        }
+    }
+    size_type best = forward
+        ? warp_reduce(warp_storage).Reduce(match_byte, cub::Min())
+        : warp_reduce(warp_storage).Reduce(match_byte, cub::Max());
+    best = __shfl_sync(0xffffffff, best, 0); // reduce result is only valid on lane 0
+    if( (forward && (best > d_str.size_bytes())) || (!forward && (best < 0)) )
+    {
+        if( lane_idx == 0 )
+            d_results[str_idx] = -1;
+        return;
+    }
+    // count the UTF-8 lead bytes before the match to get its character position
+    size_type char_count = 0;
+    for( size_type i = lane_idx; i < best; i += warp_size )
+        char_count += static_cast<size_type>((d_chars[i] & 0xC0) != 0x80);
+    __syncwarp();
+    size_type position = warp_reduce(warp_storage).Sum(char_count);
+    if( lane_idx == 0 )
+        d_results[str_idx] = position;
+}
+
+/**
+ * @brief Returns the position of the target in each string using a warp
+ * per string for long average lengths.
+ *
+ * @param forward True returns the first match position, false the last.
+ */
+std::unique_ptr<column> find_warp_parallel( strings_column_view const& strings,
+                                            string_scalar const& target,
+                                            size_type start, size_type stop,
+                                            bool forward,
+                                            rmm::mr::device_memory_resource* mr,
+                                            cudaStream_t stream )
+{
+    CUDF_EXPECTS( target.is_valid() && target.size()>0, "Parameter target must not be empty.");
+    CUDF_EXPECTS( start >= 0, "Parameter start must be positive integer or zero.");
+    if( (stop) > 0 && (start >stop) )
+        CUDF_FAIL( "Parameter start must be less than stop.");
+    //
+    auto d_target = string_view(target.data(),target.size());
+    auto strings_column = column_device_view::create(strings.parent(),stream);
+    auto strings_count = strings.size();
+    // create output column
+    auto results = make_numeric_column( data_type{INT32}, strings_count,
+        copy_bitmask( strings.parent(), stream, mr ), strings.null_count(), stream, mr);
+    auto d_results = results->mutable_view().data<int32_t>();
+    // launch a warp per string
+    cudf::experimental::detail::grid_1d grid{
+        strings_count * cudf::experimental::detail::warp_size, warp_parallel_block_size};
+    if( forward )
+        find_warp_parallel_fn<true><<<grid.num_blocks,grid.num_threads_per_block,0,stream>>>(
+            *strings_column, d_target, start, stop, d_results );
+    else
+        find_warp_parallel_fn<false><<<grid.num_blocks,grid.num_threads_per_block,0,stream>>>(
+            *strings_column, d_target, start, stop, d_results );
+    results->set_null_count(strings.null_count());
+    return results;
+}
+
 /**
  * @brief Utility to return integer column indicating the postion of
  * target string within each string in a strings column.
@@ -94,6 +323,9 @@ std::unique_ptr<column> find( strings_column_view const& strings,
                               rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
                               cudaStream_t stream=0 )
 {
+    if( use_warp_parallel(strings) )
+        return find_warp_parallel( strings, target, start, stop, true, mr, stream );
+
     auto pfn = [] __device__ (string_view d_string, string_view d_target,
                               size_type start, size_type stop) {
         size_type length = d_string.length();
@@ -110,6 +342,9 @@ std::unique_ptr<column> rfind( strings_column_view const& strings,
                                rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
                                cudaStream_t stream=0 )
 {
+    if( use_warp_parallel(strings) )
+        return find_warp_parallel( strings, target, start, stop, false, mr, stream );
+
     auto pfn = [] __device__ (string_view d_string, string_view d_target,
                               size_type start, size_type stop) {
         size_type length = d_string.length();
@@ -145,6 +380,70 @@ namespace detail
 namespace
 {
 
+/**
+ * @brief Kernel checks for the target string within each string using a warp
+ * per string.
+ *
+ * Each lane checks a strided set of candidate byte positions, so the string's
+ * characters are streamed through the whole warp instead of walked serially
+ * by one thread. A byte-wise match of a valid UTF-8 target can only occur on
+ * a character boundary.
+ */
+__global__ void contains_warp_parallel_fn( column_device_view d_strings,
+                                           string_view d_target,
+                                           experimental::bool8* d_results )
+{
+    constexpr auto warp_size = cudf::experimental::detail::warp_size;
+    size_type idx = static_cast<size_type>(threadIdx.x + blockIdx.x * blockDim.x);
+    if( idx >= (d_strings.size() * warp_size) )
+        return;
+    auto const str_idx = idx / warp_size;
+    auto const lane_idx = idx % warp_size;
+    bool found = false;
+    if( !d_strings.is_null(str_idx) )
+    {
+        auto const d_str = d_strings.element<string_view>(str_idx);
+        auto const tgt_bytes = d_target.size_bytes();
+        for( size_type i = lane_idx; (i + tgt_bytes) <= d_str.size_bytes(); i += warp_size )
+        {
+            if( d_target.compare(d_str.data() + i, tgt_bytes)==0 )
+            {
+                found = true;
+                break;
+            }
+        }
+    }
+    bool const result = __any_sync(0xffffffff, found);
+    if( lane_idx == 0 )
+        d_results[str_idx] = static_cast<experimental::bool8>(result);
+}
+
+/**
+ * @brief Returns a bool column indicating the presence of the target string
+ * using a warp per string for long average lengths.
+ */
+std::unique_ptr<column> contains_warp_parallel( strings_column_view const& strings,
+                                                string_scalar const& target,
+                                                rmm::mr::device_memory_resource* mr,
+                                                cudaStream_t stream )
+{
+    CUDF_EXPECTS( target.is_valid() && target.size()>0, "Parameter target must not be empty.");
+    auto d_target = string_view( target.data(), target.size());
+    auto strings_column = column_device_view::create(strings.parent(),stream);
+    auto strings_count = strings.size();
+    // create output column
+    auto results = make_numeric_column( data_type{BOOL8}, strings_count,
+        copy_bitmask( strings.parent(), stream, mr ), strings.null_count(), stream, mr);
+    auto d_results = results->mutable_view().data<experimental::bool8>();
+    // launch a warp per string
+    cudf::experimental::detail::grid_1d grid{
+        strings_count * cudf::experimental::detail::warp_size, warp_parallel_block_size};
+    contains_warp_parallel_fn<<<grid.num_blocks,grid.num_threads_per_block,0,stream>>>(
+        *strings_column, d_target, d_results );
+    results->set_null_count(strings.null_count());
+    return results;
+}
+
 /**
  * @brief Utility to return a bool column indicating the presence of
  * a given target string in a strings column.
@@ -203,6 +502,9 @@ std::unique_ptr<column> contains( strings_column_view const& strings,
                                   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
                                   cudaStream_t stream=0 )
 {
+    if( use_warp_parallel(strings) )
+        return contains_warp_parallel( strings, target, mr, stream );
+
     auto pfn = [] __device__ (string_view d_string, string_view d_target) {
         return d_string.find( d_target )>=0;
     };
@@ -238,6 +540,93 @@ std::unique_ptr<column> ends_with( strings_column_view const& strings,
     return contains_fn( strings, target, pfn, mr, stream );
 }
 
+std::unique_ptr<column> contains( strings_column_view const& strings,
+                                  trigram_index const& index,
+                                  string_scalar const& target,
+                                  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                                  cudaStream_t stream=0 )
+{
+    CUDF_EXPECTS( index.size() == strings.size(), "Index row count does not match strings column.");
+    CUDF_EXPECTS( target.is_valid() && target.size()>0, "Parameter target must not be empty.");
+    auto strings_count = strings.size();
+    if( strings_count == 0 )
+        return make_numeric_column( data_type{BOOL8}, 0 );
+
+    // short targets have no trigram and cannot use the index
+    auto t_mask = build_target_mask(target.to_string(stream));
+    if( t_mask == 0 )
+        return contains( strings, target, mr, stream );
+
+    auto d_signatures = index.get_impl()->signatures.data().get();
+    auto d_target = string_view( target.data(), target.size());
+    auto strings_column = column_device_view::create(strings.parent(),stream);
+    auto d_strings = *strings_column;
+    // create output column
+    auto results = make_numeric_column( data_type{BOOL8}, strings_count,
+        copy_bitmask( strings.parent(), stream, mr ), strings.null_count(), stream, mr);
+    auto d_results = results->mutable_view().data<experimental::bool8>();
+    // rows missing any of the target's trigram bits skip the exact scan
+    thrust::transform( rmm::exec_policy(stream)->on(stream),
+        thrust::make_counting_iterator<size_type>(0),
+        thrust::make_counting_iterator<size_type>(strings_count),
+        d_results,
+        [d_strings, d_target, d_signatures, t_mask] __device__ (size_type idx) {
+            experimental::bool8 result = 0;
+            if( !d_strings.is_null(idx) &&
+                ((d_signatures[idx] & t_mask) == t_mask) )
+                result = static_cast<experimental::bool8>(d_strings.element<string_view>(idx).find(d_target)>=0);
+            return result;
+        });
+    results->set_null_count(strings.null_count());
+    return results;
+}
+
+std::unique_ptr<column> find( strings_column_view const& strings,
+                              trigram_index const& index,
+                              string_scalar const& target,
+                              size_type start=0, size_type stop=-1,
+                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                              cudaStream_t stream=0 )
+{
+    CUDF_EXPECTS( index.size() == strings.size(), "Index row count does not match strings column.");
+    CUDF_EXPECTS( target.is_valid() && target.size()>0, "Parameter target must not be empty.");
+    CUDF_EXPECTS( start >= 0, "Parameter start must be positive integer or zero.");
+    if( (stop) > 0 && (start >stop) )
+        CUDF_FAIL( "Parameter start must be less than stop.");
+
+    // short targets have no trigram and cannot use the index
+    auto t_mask = build_target_mask(target.to_string(stream));
+    if( t_mask == 0 )
+        return find( strings, target, start, stop, mr, stream );
+
+    auto d_signatures = index.get_impl()->signatures.data().get();
+    auto d_target = string_view( target.data(), target.size());
+    auto strings_column = column_device_view::create(strings.parent(),stream);
+    auto d_strings = *strings_column;
+    auto strings_count = strings.size();
+    // create output column
+    auto results = make_numeric_column( data_type{INT32}, strings_count,
+        copy_bitmask( strings.parent(), stream, mr ), strings.null_count(), stream, mr);
+    auto d_results = results->mutable_view().data<int32_t>();
+    // rows missing any of the target's trigram bits skip the exact scan
+    thrust::transform( rmm::exec_policy(stream)->on(stream),
+        thrust::make_counting_iterator<size_type>(0),
+        thrust::make_counting_iterator<size_type>(strings_count),
+        d_results,
+        [d_strings, d_target, d_signatures, t_mask, start, stop] __device__ (size_type idx) {
+            int32_t position = -1;
+            if( d_strings.is_null(idx) ||
+                ((d_signatures[idx] & t_mask) != t_mask) )
+                return position;
+            auto d_string = d_strings.element<string_view>(idx);
+            size_type length = d_string.length();
+            size_type end = (stop < 0) || (stop > length) ? length : stop;
+            return static_cast<int32_t>(d_string.find( d_target, start, end-start ));
+        });
+    results->set_null_count(strings.null_count());
+    return results;
+}
+
 } // namespace detail
 
 // external APIs
@@ -246,13 +635,34 @@ std::unique_ptr<column> contains( strings_column_view const& strings,
                                   string_scalar const& target,
                                   rmm::mr::device_memory_resource* mr )
 {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
     return detail::contains( strings, target, mr );
 }
 
+std::unique_ptr<column> contains( strings_column_view const& strings,
+                                  trigram_index const& index,
+                                  string_scalar const& target,
+                                  rmm::mr::device_memory_resource* mr )
+{
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
+    return detail::contains( strings, index, target, mr );
+}
+
+std::unique_ptr<column> find( strings_column_view const& strings,
+                              trigram_index const& index,
+                              string_scalar const& target,
+                              size_type start, size_type stop,
+                              rmm::mr::device_memory_resource* mr)
+{
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
+    return detail::find( strings, index, target, start, stop, mr );
+}
+
 std::unique_ptr<column> starts_with( strings_column_view const& strings,
                                      string_scalar const& target,
                                      rmm::mr::device_memory_resource* mr )
 {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
     return detail::starts_with( strings, target, mr );
 }
 
@@ -260,6 +670,7 @@ std::unique_ptr<column> ends_with( strings_column_view const& strings,
                                    string_scalar const& target,
                                    rmm::mr::device_memory_resource* mr )
 {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
     return detail::ends_with( strings, target, mr );
 }
 
@@ -20,6 +20,7 @@
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/utilities/error.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 
 #include <thrust/transform.h>
 
@@ -76,6 +77,7 @@ std::unique_ptr<column> find_multiple( strings_column_view const& strings,
                                        strings_column_view const& targets,
                                        rmm::mr::device_memory_resource* mr)
 {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
     return detail::find_multiple( strings, targets, mr );
 }
 
@@ -22,6 +22,7 @@
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/char_types/char_types.hpp>
 #include <cudf/strings/findall.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <strings/utilities.hpp>
 #include <strings/regex/regex.cuh>
 
@@ -198,6 +199,7 @@ std::unique_ptr<experimental::table> findall_re( strings_column_view const& stri
                                                  std::string const& pattern,
                                                  rmm::mr::device_memory_resource* mr)
 {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
     return detail::findall_re(strings, pattern, mr);
 }
 
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <utility>
 #include <utilities/legacy/column_utils.hpp>
 #include <cudf/utilities/legacy/nvcategory_util.hpp>
@@ -15,11 +16,41 @@
 namespace {
   NVCategory * combine_column_categories(const gdf_column* const input_columns[], int num_columns){
     std::vector<NVCategory *> cats;
-    std::transform(input_columns, input_columns + num_columns, std::back_inserter(cats), 
+    std::transform(input_columns, input_columns + num_columns, std::back_inserter(cats),
       [&](const gdf_column* c) {
         return const_cast<NVCategory *>(static_cast<const NVCategory *>(c->dtype_info.category));
       });
 
+    //fast path: appending small batches to a large accumulated column, where the
+    //first column's keyset already contains every later column's keys. merge_category
+    //preserves this instance's keyset positions and only remaps the other side's
+    //values, so folding left keeps the first (sorted) keyset intact and skips the
+    //full keyset rebuild done by create_from_categories. if any step appends a new
+    //key the keyset is no longer sorted (which category comparisons rely on), so
+    //we throw the attempt away and rebuild from scratch.
+    if(num_columns >= 2 &&
+       std::all_of(cats.begin() + 1, cats.end(), [&](NVCategory* c) {
+         return c->keys_size() <= cats[0]->keys_size();
+       })){
+      NVCategory * merged = cats[0];
+      for(int i = 1; i < num_columns; i++){
+        NVCategory * next = merged->merge_category(*cats[i]);
+        if(merged != cats[0]){
+          NVCategory::destroy(merged);
+        }
+        merged = next;
+        if(merged->keys_size() != cats[0]->keys_size()){
+          //a key was not subsumed; fall back to the full rebuild
+          NVCategory::destroy(merged);
+          merged = nullptr;
+          break;
+        }
+      }
+      if(merged != nullptr){
+        return merged;
+      }
+    }
+
     return NVCategory::create_from_categories(cats);
   }
 
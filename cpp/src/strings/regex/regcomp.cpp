@@ -131,6 +131,11 @@ int32_t reprog::starts_count() const
     return static_cast<int>(_startinst_ids.size());
 }
 
+const std::u32string& reprog::prefix() const
+{
+    return _prefix;
+}
+
 // Converts pattern into regex classes
 class regex_parser
 {
@@ -952,6 +957,7 @@ reprog reprog::create_from(const char32_t* pattern)
 {
     reprog rtn;
     regex_compiler compiler(pattern, ANY, rtn); // future feature: ANYNL
+    rtn.build_prefix();
     //rtn->print();
     return rtn;
 }
@@ -1052,6 +1058,23 @@ void reprog::optimize2()
     _startinst_ids.push_back(-1); // terminator mark
 }
 
+// extract the literal characters every match must start with, if any
+void reprog::build_prefix()
+{
+    _prefix.clear();
+    // a leading OR means there is more than one way to start a match
+    if( _startinst_ids.size() > 2 ) // list is -1 terminated
+        return;
+    // walk the CHAR chain from the start instruction; the first quantifier
+    // or class shows up as a non-CHAR instruction and ends the prefix
+    int id = _startinst_id;
+    while( _insts[id].type == CHAR )
+    {
+        _prefix.push_back(_insts[id].u1.c);
+        id = _insts[id].u2.next_id;
+    }
+}
+
 void reprog::print()
 {
     printf("Instructions:\n");
@@ -120,8 +120,15 @@ class reprog
     void set_start_inst(int32_t id);
     int32_t get_start_inst() const;
 
+    /**
+     * @brief Returns the literal characters every match must start with,
+     * or an empty string if no such prefix could be extracted.
+     */
+    const std::u32string& prefix() const;
+
     void optimize1();
     void optimize2();
+    void build_prefix();
     void print(); // for debugging
 
 private:
@@ -129,6 +136,7 @@ private:
     std::vector<reclass> _classes;
     int32_t _startinst_id;
     std::vector<int32_t> _startinst_ids; // short-cut to speed-up ORs
+    std::u32string _prefix; // literal prefix required by every match
     int32_t _num_capturing_groups;
 };
 
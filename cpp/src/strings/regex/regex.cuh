@@ -146,10 +146,24 @@ private:
     reinst* _insts{};            // array of regex instructions
     int32_t* _startinst_ids{};   // array of start instruction ids
     reclass_device* _classes{};  // array of regex classes
+    char32_t* _prefix{};         // literal prefix required by every match
+    int32_t _prefix_count{};     // number of characters in the prefix
     void* _relists_mem{};        // runtime relist memory for regexec
     u_char* _stack_mem1{};       // memory for relist object 1
     u_char* _stack_mem2{};       // memory for relist object 2
 
+    /**
+     * @brief Scans for the next occurrence of the compiled literal prefix.
+     *
+     * Candidate positions found this way are the only ones worth entering
+     * the NFA loop for, since every match must start with the prefix.
+     *
+     * @param d_str The string to scan.
+     * @param pos Character position to start the scan.
+     * @return The position of the next occurrence, or -1 if there is none.
+     */
+    __device__ inline int32_t find_prefix( string_view const& d_str, int32_t pos ) const;
+
     /**
      * @brief Executes the regex pattern on the given string.
      */
@@ -196,6 +196,34 @@ __device__ inline int32_t* reprog_device::startinst_ids() const
     return _startinst_ids;
 }
 
+__device__ inline int32_t reprog_device::find_prefix( string_view const& dstr, int32_t pos ) const
+{
+    auto const txtlen = dstr.length();
+    while( (pos + _prefix_count) <= txtlen )
+    {
+        // locate the next candidate by its first character
+        auto fidx = dstr.find(static_cast<char_utf8>(_prefix[0]),pos);
+        if( (fidx < 0) || ((fidx + _prefix_count) > txtlen) )
+            return -1;
+        pos = fidx;
+        // compare the remaining prefix characters at this candidate
+        bool matched = true;
+        string_view::const_iterator itr = string_view::const_iterator(dstr,pos+1);
+        for( int32_t i=1; i < _prefix_count; ++i, ++itr )
+        {
+            if( static_cast<char32_t>(*itr) != _prefix[i] )
+            {
+                matched = false;
+                break;
+            }
+        }
+        if( matched )
+            return pos;
+        ++pos;
+    }
+    return -1;
+}
+
 /**
  * @brief Evaluate a specific string against regex pattern compiled to this instance.
  *
@@ -228,7 +256,12 @@ __device__ inline int32_t reprog_device::regexec(string_view const& dstr, reljun
             {
                 case CHAR:
                 {
-                    auto fidx = dstr.find(static_cast<char_utf8>(jnk.startchar),pos);
+                    // scan for the whole literal prefix when one was
+                    // extracted; every skipped position avoids a full pass
+                    // through the NFA loop
+                    auto fidx = (_prefix_count > 1)
+                        ? find_prefix(dstr,pos)
+                        : dstr.find(static_cast<char_utf8>(jnk.startchar),pos);
                     if( fidx < 0 )
                         return match;
                     pos = fidx;
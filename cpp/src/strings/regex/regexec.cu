@@ -91,7 +91,9 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>>
     auto classes_size = classes_count * sizeof(_classes[0]);
     for( int32_t idx=0; idx < classes_count; ++idx )
         classes_size += static_cast<int32_t>((h_prog.class_at(idx).literals.size())*sizeof(char32_t));
-    size_t memsize = insts_size + startids_size + classes_size;
+    auto prefix_count = static_cast<int32_t>(h_prog.prefix().size());
+    auto prefix_size = prefix_count * sizeof(char32_t);
+    size_t memsize = insts_size + startids_size + classes_size + prefix_size;
     size_t rlm_size = 0;
     // check memory size needed for executing regex
     if( insts_count > MAX_STACK_INSTS )
@@ -151,6 +153,15 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>>
         h_end += h_class.literals.size()*sizeof(char32_t);
         d_end += h_class.literals.size()*sizeof(char32_t);
     }
+    // append the literal prefix characters after the class data
+    if( prefix_count > 0 )
+    {
+        d_prog->_prefix = reinterpret_cast<char32_t*>(d_end);
+        memcpy( h_end, h_prog.prefix().c_str(), prefix_size );
+        h_end += prefix_size;
+        d_end += prefix_size;
+    }
+    d_prog->_prefix_count = prefix_count;
     // initialize the rest of the elements
     d_prog->_insts_count = insts_count;
     d_prog->_starts_count = starts_count;
@@ -162,8 +173,11 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>>
         RMM_TRY(RMM_ALLOC(&(d_prog->_relists_mem),rlm_size,stream));
     }
 
-    // copy flat prog to device memory
-    CUDA_TRY(cudaMemcpy(d_buffer,h_buffer.data(),memsize,cudaMemcpyHostToDevice));
+    // copy flat prog to device memory; the copy must be ordered on the
+    // caller's stream so per-thread-default-stream builds don't race it
+    // against work enqueued on that stream
+    CUDA_TRY(cudaMemcpyAsync(d_buffer,h_buffer.data(),memsize,cudaMemcpyHostToDevice,stream));
+    CUDA_TRY(cudaStreamSynchronize(stream)); // h_buffer is freed on return
     //
     auto deleter = [](reprog_device*t) {t->destroy();};
     return std::unique_ptr<reprog_device, std::function<void(reprog_device*)>>(d_prog,deleter);
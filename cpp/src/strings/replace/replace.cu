@@ -19,6 +19,7 @@
 #include <cudf/strings/replace.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/strings/string_view.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include "../utilities.hpp"
 #include "../utilities.cuh"
 
@@ -380,6 +381,7 @@ std::unique_ptr<column> replace( strings_column_view const& strings,
                                  int32_t maxrepl,
                                  rmm::mr::device_memory_resource* mr)
 {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
     return detail::replace(strings, target, repl, maxrepl, mr );
 }
 
@@ -388,6 +390,7 @@ std::unique_ptr<column> replace_slice( strings_column_view const& strings,
                                        size_type start, size_type stop,
                                        rmm::mr::device_memory_resource* mr)
 {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
     return detail::replace_slice(strings, repl, start, stop, mr);
 }
 
@@ -396,6 +399,7 @@ std::unique_ptr<column> replace( strings_column_view const& strings,
                                  strings_column_view const& repls,
                                  rmm::mr::device_memory_resource* mr)
 {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
     return detail::replace(strings, targets, repls, mr);
 }
 
@@ -403,6 +407,7 @@ std::unique_ptr<column> replace_nulls( strings_column_view const& strings,
                                        string_scalar const& repl,
                                        rmm::mr::device_memory_resource* mr)
 {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
     return detail::replace_nulls(strings, repl, mr);
 }
 
@@ -21,6 +21,7 @@
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/utilities/error.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <strings/utilities.hpp>
 
 #include <vector>
@@ -234,6 +235,7 @@ std::unique_ptr<experimental::table> partition( strings_column_view const& strin
                                                 string_scalar const& delimiter,
                                                 rmm::mr::device_memory_resource* mr )
 {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
     return detail::partition( strings, delimiter, mr );
 }
 
@@ -241,6 +243,7 @@ std::unique_ptr<experimental::table> rpartition( strings_column_view const& stri
                                                  string_scalar const& delimiter,
                                                  rmm::mr::device_memory_resource* mr)
 {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
     return detail::rpartition( strings, delimiter, mr );
 }
 
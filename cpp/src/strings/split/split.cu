@@ -24,6 +24,7 @@
 #include <strings/utilities.hpp>
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
 
 #include <vector>
 #include <thrust/transform.h>
@@ -387,6 +388,106 @@ struct whitespace_rsplit_tokenizer_fn
     }
 };
 
+/**
+ * @brief Emits all tokens of the `idx'th` string back to back into the
+ * shared token array, for the list-layout split.
+ *
+ * The token count per string was already computed (and clamped to the
+ * max-split value) by the counter, so the last token keeps the remainder
+ * of the string.
+ */
+struct token_emitter_fn
+{
+    column_device_view const d_strings;  // strings to split
+    string_view const d_delimiter;       // delimiter for split
+
+    __device__ void operator()(size_type idx,
+                               size_type const* d_token_offsets,
+                               string_index_pair* d_indexes) const
+    {
+        if( d_strings.is_null(idx) )
+            return;
+        auto d_result = d_indexes + d_token_offsets[idx];
+        size_type token_count = d_token_offsets[idx+1] - d_token_offsets[idx];
+        string_view d_str = d_strings.element<string_view>(idx);
+        size_type spos = 0;
+        size_type nchars = d_str.length();
+        for( size_type t=0; t < token_count; ++t )
+        {
+            size_type epos = nchars;
+            if( (t+1) < token_count ) // last token keeps the remainder
+                epos = d_str.find(d_delimiter, spos);
+            auto sbyte = d_str.byte_offset(spos); // convert character pos
+            auto ebyte = d_str.byte_offset(epos); // to byte offset
+            d_result[t] = string_index_pair{ d_str.data() + sbyte, (ebyte-sbyte) };
+            spos = epos + d_delimiter.length();
+        }
+    }
+};
+
+/**
+ * @brief Whitespace-delimiter version of the list-layout token emitter.
+ *
+ * Like the whitespace tokenizers, runs of whitespace count as a single
+ * delimiter and leading/trailing whitespace is ignored.
+ */
+struct whitespace_token_emitter_fn
+{
+    column_device_view const d_strings;  // strings to split
+
+    __device__ void operator()(size_type idx,
+                               size_type const* d_token_offsets,
+                               string_index_pair* d_indexes) const
+    {
+        if( d_strings.is_null(idx) )
+            return;
+        auto d_result = d_indexes + d_token_offsets[idx];
+        size_type token_count = d_token_offsets[idx+1] - d_token_offsets[idx];
+        string_view d_str = d_strings.element<string_view>(idx);
+        size_type token_idx = 0;
+        size_type nchars = d_str.length();
+        size_type spos = 0;
+        bool spaces = true; // need to treat a run of whitespace as a single delimiter
+        for( size_type pos=0; pos < nchars && token_idx < token_count; ++pos )
+        {
+            char_utf8 ch = d_str[pos];
+            if( spaces != (ch <= ' ') )
+            {
+                if( spaces ) // start of a token
+                {
+                    spos = pos;
+                    if( (token_idx+1)==token_count ) // hit max tokens; keep the remainder
+                    {
+                        auto sbyte = d_str.byte_offset(spos);
+                        auto ebyte = d_str.byte_offset(nchars);
+                        d_result[token_idx++] = string_index_pair{ d_str.data() + sbyte, (ebyte-sbyte) };
+                        break;
+                    }
+                }
+                else // end of a token
+                {
+                    auto sbyte = d_str.byte_offset(spos);
+                    auto ebyte = d_str.byte_offset(pos);
+                    d_result[token_idx++] = string_index_pair{ d_str.data() + sbyte, (ebyte-sbyte) };
+                }
+                spaces = !spaces;
+            }
+        }
+        if( token_idx < token_count )
+        {
+            // the string either ended inside a token or held no token at all
+            string_index_pair result{nullptr,0}; // empty/whitespace-only string
+            if( !spaces )
+            {
+                auto sbyte = d_str.byte_offset(spos);
+                auto ebyte = d_str.byte_offset(nchars);
+                result = string_index_pair{ d_str.data() + sbyte, (ebyte-sbyte) };
+            }
+            d_result[token_idx] = result;
+        }
+    }
+};
+
 // align all column size allocations to this boundary so that all output column buffers
 // start at that alignment.
 static constexpr size_type split_align = 64;
@@ -852,6 +953,50 @@ std::unique_ptr<experimental::table> split_fn( size_type strings_count,
     return std::make_unique<experimental::table>(std::move(results));
 }
 
+// Generic list-layout split function used by split_list
+template<typename TokenCounter, typename TokenEmitter>
+split_list_result split_list_fn( size_type strings_count,
+                                 TokenCounter counter,
+                                 TokenEmitter emitter,
+                                 rmm::mr::device_memory_resource* mr,
+                                 cudaStream_t stream )
+{
+    auto execpol = rmm::exec_policy(stream);
+    // compute the number of tokens per string; the extra zero entry makes
+    // the exclusive scan produce the terminating total
+    rmm::device_vector<size_type> token_counts(strings_count+1, size_type{0});
+    auto d_token_counts = token_counts.data().get();
+    thrust::transform( execpol->on(stream),
+        thrust::make_counting_iterator<size_type>(0),
+        thrust::make_counting_iterator<size_type>(strings_count),
+        d_token_counts, counter );
+
+    // scan the counts into the offsets column
+    auto offsets_column = make_numeric_column( data_type{INT32}, strings_count+1,
+                                               mask_state::UNALLOCATED, stream, mr );
+    auto d_offsets = offsets_column->mutable_view().data<size_type>();
+    thrust::exclusive_scan( execpol->on(stream),
+                            token_counts.begin(), token_counts.end(), d_offsets );
+
+    size_type total_tokens = 0;
+    CUDA_TRY(cudaMemcpyAsync( &total_tokens, d_offsets + strings_count,
+                              sizeof(size_type), cudaMemcpyDeviceToHost, stream ));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+
+    // each string emits its tokens at its own offset; one pass over each
+    // string instead of one pass per token position
+    rmm::device_vector<string_index_pair> indexes(total_tokens);
+    string_index_pair* d_indexes = indexes.data().get();
+    thrust::for_each_n( execpol->on(stream),
+        thrust::make_counting_iterator<size_type>(0), strings_count,
+        [emitter, d_offsets, d_indexes] __device__ (size_type idx) {
+            emitter(idx, d_offsets, d_indexes);
+        });
+    auto values_column = make_strings_column(indexes,stream,mr);
+
+    return split_list_result{std::move(offsets_column), std::move(values_column)};
+}
+
 // Generic split function used by split_record and rsplit_record
 template<typename TokenReader, typename TokenCopier>
 contiguous_split_record_result contiguous_split_record_fn(
@@ -1007,6 +1152,34 @@ std::unique_ptr<experimental::table> rsplit( strings_column_view const& strings,
                      mr, stream);
 }
 
+split_list_result split_list( strings_column_view const& strings,
+                              string_scalar const& delimiter = string_scalar(""),
+                              size_type maxsplit=-1,
+                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                              cudaStream_t stream = 0 )
+{
+    CUDF_EXPECTS( delimiter.is_valid(), "Parameter delimiter must be valid");
+
+    size_type max_tokens = 0;
+    if( maxsplit > 0 )
+        max_tokens = maxsplit + 1; // makes consistent with Pandas
+
+    auto strings_column = column_device_view::create(strings.parent(),stream);
+    if( delimiter.size()==0 )
+    {
+        return split_list_fn( strings.size(),
+                              whitespace_token_counter_fn{*strings_column,max_tokens},
+                              whitespace_token_emitter_fn{*strings_column},
+                              mr, stream);
+    }
+
+    string_view d_delimiter( delimiter.data(), delimiter.size() );
+    return split_list_fn( strings.size(),
+                          token_counter_fn{*strings_column,d_delimiter,max_tokens},
+                          token_emitter_fn{*strings_column,d_delimiter},
+                          mr, stream);
+}
+
 template <Dir dir>
 contiguous_split_record_result contiguous_split_record(
     strings_column_view const& strings,
@@ -1051,6 +1224,7 @@ std::unique_ptr<experimental::table> split( strings_column_view const& strings,
                                             size_type maxsplit,
                                             rmm::mr::device_memory_resource* mr )
 {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
     return detail::split( strings, delimiter, maxsplit, mr );
 }
 
@@ -1059,14 +1233,25 @@ std::unique_ptr<experimental::table> rsplit( strings_column_view const& strings,
                                              size_type maxsplit,
                                              rmm::mr::device_memory_resource* mr)
 {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
     return detail::rsplit( strings, delimiter, maxsplit, mr );
 }
 
+split_list_result split_list( strings_column_view const& strings,
+                              string_scalar const& delimiter,
+                              size_type maxsplit,
+                              rmm::mr::device_memory_resource* mr )
+{
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
+    return detail::split_list( strings, delimiter, maxsplit, mr );
+}
+
 contiguous_split_record_result contiguous_split_record(
     strings_column_view const& strings,
     string_scalar const& delimiter,
     size_type maxsplit,
     rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
   return detail::contiguous_split_record<detail::Dir::FORWARD>(strings, delimiter, maxsplit, mr, 0);
 }
 
@@ -1075,6 +1260,7 @@ contiguous_split_record_result contiguous_rsplit_record(
     string_scalar const& delimiter,
     size_type maxsplit,
     rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
   return detail::contiguous_split_record<detail::Dir::BACKWARD>(strings, delimiter, maxsplit, mr, 0);
 }
 
@@ -16,15 +16,22 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
 #include <cudf/scalar/scalar_device_view.cuh>
+#include <cudf/wrappers/bool.hpp>
 #include <cudf/strings/substring.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/utilities/type_dispatcher.hpp>
 #include <cudf/utilities/traits.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <strings/utilities.hpp>
 #include <strings/utilities.cuh>
 
+#include <rmm/thrust_rmm_allocator.h>
+#include <thrust/for_each.h>
+#include <thrust/transform.h>
+
 namespace
 {
 
@@ -322,5 +329,165 @@ std::unique_ptr<column> slice_strings( strings_column_view const& strings,
     return detail::slice_strings( strings, starts_column, stops_column, mr );
 }
 
+namespace
+{
+
+/**
+ * @brief Computes the byte range of each substring within its parent string.
+ *
+ * This is the only pass over the strings data when building a substrings_view;
+ * no character data is copied.
+ */
+void build_substring_ranges( strings_column_view const& strings,
+                             size_type start, size_type stop,
+                             rmm::device_vector<size_type>& offsets,
+                             rmm::device_vector<size_type>& lengths,
+                             cudaStream_t stream )
+{
+    auto strings_column = column_device_view::create(strings.parent(),stream);
+    auto d_column = *strings_column;
+    auto d_byte_offsets = offsets.data().get();
+    auto d_byte_lengths = lengths.data().get();
+    thrust::for_each_n( rmm::exec_policy(stream)->on(stream),
+        thrust::make_counting_iterator<size_type>(0), strings.size(),
+        [d_column, start, stop, d_byte_offsets, d_byte_lengths] __device__ (size_type idx) {
+            d_byte_offsets[idx] = 0;
+            d_byte_lengths[idx] = 0;
+            if( d_column.is_null(idx) )
+                return;
+            string_view d_str = d_column.element<string_view>(idx);
+            auto const length = d_str.length();
+            if( start >= length )
+                return; // empty substring
+            size_type end = (((stop<0) || (stop>length)) ? length : stop);
+            size_type first_byte = d_str.byte_offset(start);
+            d_byte_offsets[idx] = first_byte;
+            d_byte_lengths[idx] = d_str.byte_offset(end) - first_byte;
+        });
+}
+
+} // namespace
+
+struct substrings_view::impl
+{
+    column_view parent;                          // strings data referenced by the byte ranges
+    rmm::device_vector<size_type> byte_offsets;  // byte offset of each substring within its string
+    rmm::device_vector<size_type> byte_lengths;  // byte length of each substring
+};
+
+substrings_view::substrings_view( strings_column_view const& strings,
+                                  size_type start, size_type stop )
+    : _impl(new impl{strings.parent(),
+                     rmm::device_vector<size_type>(strings.size()),
+                     rmm::device_vector<size_type>(strings.size())})
+{
+    CUDF_EXPECTS( start >= 0, "Parameter start must not be negative.");
+    build_substring_ranges( strings, start, stop, _impl->byte_offsets, _impl->byte_lengths, 0 );
+}
+
+substrings_view::~substrings_view() = default;
+substrings_view::substrings_view( substrings_view&& ) = default;
+substrings_view& substrings_view::operator=( substrings_view&& ) = default;
+
+size_type substrings_view::size() const
+{
+    return _impl->parent.size();
+}
+
+substrings_view::impl* substrings_view::get_impl() const
+{
+    return _impl.get();
+}
+
+namespace detail
+{
+
+//
+std::unique_ptr<column> contains( substrings_view const& substrings,
+                                  string_scalar const& target,
+                                  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                                  cudaStream_t stream = 0 )
+{
+    CUDF_EXPECTS( target.is_valid(), "Parameter target must be valid.");
+    auto impl = substrings.get_impl();
+    auto strings_count = impl->parent.size();
+    if( strings_count == 0 )
+        return make_numeric_column( data_type{BOOL8}, 0 );
+    string_view d_target( target.data(), target.size() );
+    auto strings_column = column_device_view::create(impl->parent,stream);
+    auto d_column = *strings_column;
+    auto d_byte_offsets = impl->byte_offsets.data().get();
+    auto d_byte_lengths = impl->byte_lengths.data().get();
+    // create output column copying the parent null mask
+    auto results = make_numeric_column( data_type{BOOL8}, strings_count,
+        copy_bitmask( impl->parent, stream, mr ), impl->parent.null_count(), stream, mr);
+    auto d_results = results->mutable_view().data<experimental::bool8>();
+    // search each substring in place within the parent chars data
+    thrust::transform( rmm::exec_policy(stream)->on(stream),
+        thrust::make_counting_iterator<size_type>(0),
+        thrust::make_counting_iterator<size_type>(strings_count),
+        d_results,
+        [d_column, d_byte_offsets, d_byte_lengths, d_target] __device__ (size_type idx) {
+            if( d_column.is_null(idx) )
+                return false;
+            string_view d_str = d_column.element<string_view>(idx);
+            string_view d_substr( d_str.data() + d_byte_offsets[idx], d_byte_lengths[idx] );
+            return d_substr.find(d_target) >= 0;
+        });
+    results->set_null_count(impl->parent.null_count());
+    return results;
+}
+
+//
+std::unique_ptr<column> hash( substrings_view const& substrings,
+                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                              cudaStream_t stream = 0 )
+{
+    auto impl = substrings.get_impl();
+    auto strings_count = impl->parent.size();
+    if( strings_count == 0 )
+        return make_numeric_column( data_type{INT32}, 0 );
+    auto strings_column = column_device_view::create(impl->parent,stream);
+    auto d_column = *strings_column;
+    auto d_byte_offsets = impl->byte_offsets.data().get();
+    auto d_byte_lengths = impl->byte_lengths.data().get();
+    // matches the output type used when hashing rows of a strings column
+    auto results = make_numeric_column( data_type{INT32}, strings_count,
+                                        mask_state::UNALLOCATED, stream, mr );
+    auto d_results = results->mutable_view().data<int32_t>();
+    // hash each substring in place within the parent chars data
+    thrust::transform( rmm::exec_policy(stream)->on(stream),
+        thrust::make_counting_iterator<size_type>(0),
+        thrust::make_counting_iterator<size_type>(strings_count),
+        d_results,
+        [d_column, d_byte_offsets, d_byte_lengths] __device__ (size_type idx) {
+            if( d_column.is_null(idx) )
+                return static_cast<int32_t>(0);
+            string_view d_str = d_column.element<string_view>(idx);
+            string_view d_substr( d_str.data() + d_byte_offsets[idx], d_byte_lengths[idx] );
+            return static_cast<int32_t>(MurmurHash3_32<string_view>{}(d_substr));
+        });
+    return results;
+}
+
+} // namespace detail
+
+// external API
+
+std::unique_ptr<column> contains( substrings_view const& substrings,
+                                  string_scalar const& target,
+                                  rmm::mr::device_memory_resource* mr )
+{
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
+    return detail::contains( substrings, target, mr );
+}
+
+std::unique_ptr<column> hash( substrings_view const& substrings,
+                              rmm::mr::device_memory_resource* mr )
+{
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
+    return detail::hash( substrings, mr );
+}
+
 } // namespace strings
 } // namespace cudf
@@ -20,6 +20,7 @@
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/translate.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <strings/utilities.hpp>
 #include <strings/utilities.cuh>
 
@@ -127,6 +128,7 @@ std::unique_ptr<column> translate( strings_column_view const& strings,
                                    std::vector<std::pair<uint32_t,uint32_t>> const& chars_table,
                                    rmm::mr::device_memory_resource* mr )
 {
+    CUDF_FUNC_RANGE_COLOR(cudf::range_color::strings);
     return detail::translate(strings,chars_table);
 }
 
@@ -21,6 +21,7 @@
 
 #include <rmm/device_buffer.hpp>
 
+#include <cstdint>
 #include <cstring>
 
 namespace cudf
@@ -88,6 +89,31 @@ auto make_strings_children( SizeAndExecuteFunction size_and_exec_fn, size_type s
     return std::make_pair(std::move(offsets_column),std::move(chars_column));
 }
 
+/**
+ * @brief Returns true if no byte has its high bit set -- the data contains
+ * no multi-byte UTF-8 characters.
+ *
+ * The bytes are checked a word at a time once the pointer is aligned, so
+ * mostly-ASCII data is classified at near copy speed. Callers use this to
+ * take byte-wise fast paths that skip UTF-8 decoding entirely.
+ *
+ * @param d_chars Character data to check.
+ * @param bytes Number of bytes to check.
+ * @return True if all the bytes are ASCII.
+ */
+__device__ inline bool is_all_ascii( const char* d_chars, size_type bytes )
+{
+    size_type idx = 0;
+    uint32_t result = 0;
+    while( (idx < bytes) && (reinterpret_cast<uintptr_t>(d_chars+idx) & 3) )
+        result |= static_cast<uint8_t>(d_chars[idx++]);
+    for( ; (idx+4) <= bytes; idx+=4 )
+        result |= *reinterpret_cast<const uint32_t*>(d_chars+idx);
+    while( idx < bytes )
+        result |= static_cast<uint8_t>(d_chars[idx++]);
+    return (result & 0x80808080u) == 0;
+}
+
 /**
  * @brief Converts a single UTF-8 character into a code-point value that
  * can be used for lookup in the character flags or the character case tables.
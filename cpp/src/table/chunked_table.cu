@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/table/chunked_table.hpp>
+#include <cudf/detail/concatenate.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+
+#include <algorithm>
+
+namespace cudf {
+namespace experimental {
+
+// Take ownership of a single chunk
+chunked_table::chunked_table(std::unique_ptr<table>&& chunk) {
+  append(std::move(chunk));
+}
+
+// O(1) append by ownership transfer
+void chunked_table::append(std::unique_ptr<table>&& chunk) {
+  CUDF_EXPECTS(chunk != nullptr, "Unexpected null chunk");
+  if (not _chunks.empty()) {
+    table_view const first = _chunks.front()->view();
+    table_view const incoming = chunk->view();
+    CUDF_EXPECTS(incoming.num_columns() == first.num_columns(),
+                 "Column count mismatch between chunks");
+    CUDF_EXPECTS(std::equal(first.begin(), first.end(), incoming.begin(),
+                            [](column_view const& lhs, column_view const& rhs) {
+                              return lhs.type() == rhs.type();
+                            }),
+                 "Column type mismatch between chunks");
+  }
+  _num_rows += chunk->num_rows();
+  _chunks.emplace_back(std::move(chunk));
+}
+
+// Non-owning views of every chunk in append order
+std::vector<table_view> chunked_table::chunk_views() const {
+  std::vector<table_view> views;
+  views.reserve(_chunks.size());
+  for (auto const& c : _chunks) {
+    views.push_back(c->view());
+  }
+  return views;
+}
+
+// Collapse all chunks into one; the only row-copying operation
+void chunked_table::compact(cudaStream_t stream,
+                            rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  if (_chunks.size() < 2) {
+    return;
+  }
+  auto compacted = detail::concatenate(chunk_views(), mr, stream);
+  _chunks.clear();
+  _chunks.emplace_back(std::move(compacted));
+}
+
+// Contiguous view of the contents, compacting on demand
+table_view chunked_table::view(cudaStream_t stream,
+                               rmm::mr::device_memory_resource* mr) {
+  if (_chunks.empty()) {
+    return table_view{};
+  }
+  compact(stream, mr);
+  return _chunks.front()->view();
+}
+
+// Release ownership of the contents as a single table
+std::unique_ptr<table> chunked_table::release(
+    cudaStream_t stream, rmm::mr::device_memory_resource* mr) {
+  if (_chunks.empty()) {
+    return std::make_unique<table>();
+  }
+  compact(stream, mr);
+  auto result = std::move(_chunks.front());
+  _chunks.clear();
+  _num_rows = 0;
+  return result;
+}
+
+}  // namespace experimental
+}  // namespace cudf
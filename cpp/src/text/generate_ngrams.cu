@@ -18,6 +18,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/copy_if.cuh>
+#include <cudf/detail/utilities/hash_functions.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/table/table_view.hpp>
@@ -26,6 +27,10 @@
 #include <strings/utilities.cuh>
 #include <nvtext/generate_ngrams.hpp>
 
+#include <thrust/scan.h>
+#include <thrust/tabulate.h>
+#include <thrust/transform.h>
+
 
 namespace nvtext
 {
@@ -78,6 +83,55 @@ struct ngram_generator_fn
     }
 };
 
+/**
+ * @brief Compute hash values of ngrams without materializing the ngram text.
+ *
+ * The hash of an ngram is built by combining the hashes of its member
+ * strings in order, so adjacent strings are never concatenated into a
+ * temporary buffer.
+ */
+struct ngram_hasher_fn
+{
+    cudf::column_device_view const d_strings;
+    cudf::size_type ngrams;
+
+    __device__ hash_value_type operator()(cudf::size_type idx)
+    {
+        MurmurHash3_32<cudf::string_view> hasher;
+        MurmurHash3_32<hash_value_type> combiner;
+        hash_value_type hash{0};
+        for( cudf::size_type n=0; n < ngrams; ++n )
+            hash = combiner.hash_combine(hash, hasher(d_strings.element<cudf::string_view>(n+idx)));
+        return hash;
+    }
+};
+
+/**
+ * @brief Compute hash values of the character ngrams within each string.
+ *
+ * Each ngram is a view into the input chars buffer so no intermediate
+ * ngram strings are created.
+ */
+struct character_ngram_hasher_fn
+{
+    cudf::column_device_view const d_strings;
+    cudf::size_type ngrams;
+    cudf::size_type const* d_offsets;
+    hash_value_type* d_hashes;
+
+    __device__ void operator()(cudf::size_type idx)
+    {
+        if( d_strings.is_null(idx) )
+            return;
+        auto const d_str = d_strings.element<cudf::string_view>(idx);
+        auto const ngrams_count = d_offsets[idx+1] - d_offsets[idx];
+        MurmurHash3_32<cudf::string_view> hasher;
+        auto d_output = d_hashes + d_offsets[idx];
+        for( cudf::size_type n=0; n < ngrams_count; ++n )
+            d_output[n] = hasher(d_str.substr(n,ngrams));
+    }
+};
+
 } // namespace
 
 std::unique_ptr<cudf::column> generate_ngrams( cudf::strings_column_view const& strings,
@@ -147,6 +201,98 @@ std::unique_ptr<cudf::column> generate_ngrams( cudf::strings_column_view const&
                                      0, rmm::device_buffer{}, stream, mr);
 }
 
+std::unique_ptr<cudf::column> hash_ngrams( cudf::strings_column_view const& strings,
+                                           cudf::size_type ngrams = 2,
+                                           rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                                           cudaStream_t stream = 0 )
+{
+    CUDF_EXPECTS( ngrams > 1, "Parameter ngrams should be an integer value of 2 or greater");
+
+    auto strings_count = strings.size();
+    if( strings_count==0 ) // if no strings, return an empty column
+        return cudf::make_empty_column(cudf::data_type{cudf::INT32});
+
+    auto strings_column = cudf::column_device_view::create(strings.parent(),stream);
+    auto d_strings = *strings_column;
+
+    // first create a new offsets vector removing nulls and empty strings from the input column
+    std::unique_ptr<cudf::column> non_empty_offsets_column = [&] {
+        cudf::column_view offsets_view( cudf::data_type{cudf::INT32}, strings_count+1,
+                                        strings.offsets().data<int32_t>() );
+        auto table_offsets = cudf::experimental::detail::copy_if( cudf::table_view({offsets_view}),
+                [d_strings, strings_count] __device__ (cudf::size_type idx) {
+                    if( idx==strings_count )
+                        return true;
+                    if( d_strings.is_null(idx) )
+                        return false;
+                    return !d_strings.element<cudf::string_view>(idx).empty();
+                }, mr, stream )->release();
+        strings_count = table_offsets.front()->size()-1;
+        return std::move(table_offsets.front());
+    } ();
+
+    CUDF_EXPECTS( strings_count >= ngrams , "Insufficient number of strings to generate ngrams");
+    // create a temporary column view from the non-empty offsets and chars column views
+    cudf::column_view strings_view(cudf::data_type{cudf::STRING}, strings_count,
+                                   nullptr, nullptr, 0, 0,
+                                   {non_empty_offsets_column->view(), strings.chars()});
+    strings_column = cudf::column_device_view::create(strings_view,stream);
+    d_strings = *strings_column;
+
+    // compute the number of ngrams and hash each one directly into the output column
+    auto const ngrams_count = strings_count - ngrams + 1;
+    auto hashes_column = cudf::make_numeric_column( cudf::data_type{cudf::INT32}, ngrams_count,
+                                                    cudf::mask_state::UNALLOCATED, stream, mr );
+    auto hashes_view = hashes_column->mutable_view();
+    thrust::tabulate( rmm::exec_policy(stream)->on(stream),
+                      hashes_view.begin<int32_t>(), hashes_view.end<int32_t>(),
+                      ngram_hasher_fn{d_strings,ngrams} );
+    hashes_column->set_null_count(0);
+    return hashes_column;
+}
+
+std::unique_ptr<cudf::column> hash_character_ngrams( cudf::strings_column_view const& strings,
+                                                     cudf::size_type ngrams = 5,
+                                                     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                                                     cudaStream_t stream = 0 )
+{
+    CUDF_EXPECTS( ngrams > 1, "Parameter ngrams should be an integer value of 2 or greater");
+
+    auto const strings_count = strings.size();
+    if( strings_count==0 ) // if no strings, return an empty column
+        return cudf::make_empty_column(cudf::data_type{cudf::INT32});
+
+    auto execpol = rmm::exec_policy(stream);
+    auto strings_column = cudf::column_device_view::create(strings.parent(),stream);
+    auto d_strings = *strings_column;
+
+    // count the ngrams produced by each string; strings shorter than
+    // ngrams characters (and null rows) produce none
+    rmm::device_vector<cudf::size_type> ngram_offsets(strings_count+1,cudf::size_type{0});
+    auto d_ngram_offsets = ngram_offsets.data().get();
+    thrust::transform( execpol->on(stream), thrust::make_counting_iterator<cudf::size_type>(0),
+        thrust::make_counting_iterator<cudf::size_type>(strings_count), d_ngram_offsets,
+        [d_strings, ngrams] __device__ (cudf::size_type idx) {
+            if( d_strings.is_null(idx) )
+                return 0;
+            auto const length = d_strings.element<cudf::string_view>(idx).length();
+            return length >= ngrams ? length - ngrams + 1 : 0;
+        } );
+    thrust::exclusive_scan( execpol->on(stream), ngram_offsets.begin(), ngram_offsets.end(),
+                            ngram_offsets.begin() );
+    cudf::size_type const total_ngrams = ngram_offsets[strings_count];
+    CUDF_EXPECTS( total_ngrams > 0, "Insufficient number of characters in each string to generate ngrams");
+
+    // hash each character ngram directly from the input chars buffer
+    auto hashes_column = cudf::make_numeric_column( cudf::data_type{cudf::INT32}, total_ngrams,
+                                                    cudf::mask_state::UNALLOCATED, stream, mr );
+    auto d_hashes = reinterpret_cast<hash_value_type*>(hashes_column->mutable_view().data<int32_t>());
+    thrust::for_each_n( execpol->on(stream), thrust::make_counting_iterator<cudf::size_type>(0), strings_count,
+        character_ngram_hasher_fn{d_strings,ngrams,d_ngram_offsets,d_hashes} );
+    hashes_column->set_null_count(0);
+    return hashes_column;
+}
+
 } // namespace detail
 
 std::unique_ptr<cudf::column> generate_ngrams( cudf::strings_column_view const& strings,
@@ -157,4 +303,18 @@ std::unique_ptr<cudf::column> generate_ngrams( cudf::strings_column_view const&
     return detail::generate_ngrams(strings, ngrams, separator, mr);
 }
 
+std::unique_ptr<cudf::column> hash_ngrams( cudf::strings_column_view const& strings,
+                                           cudf::size_type ngrams,
+                                           rmm::mr::device_memory_resource* mr)
+{
+    return detail::hash_ngrams(strings, ngrams, mr);
+}
+
+std::unique_ptr<cudf::column> hash_character_ngrams( cudf::strings_column_view const& strings,
+                                                     cudf::size_type ngrams,
+                                                     rmm::mr::device_memory_resource* mr)
+{
+    return detail::hash_character_ngrams(strings, ngrams, mr);
+}
+
 } // namespace nvtext
@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <strings/utilities.hpp>
+#include <strings/utilities.cuh>
+#include <nvtext/pipeline.hpp>
+#include <text/utilities/tokenize_ops.cuh>
+
+#include <thrust/transform_scan.h>
+
+namespace nvtext
+{
+namespace detail
+{
+namespace
+{
+
+/**
+ * @brief Copies token bytes folding ASCII upper-case characters to lower-case.
+ *
+ * Only the single-byte code-points [A-Z] are modified so the copy stays
+ * byte-for-byte valid UTF-8.
+ */
+__device__ char* copy_folded( char* dest, const char* src, cudf::size_type bytes )
+{
+    for( cudf::size_type i=0; i < bytes; ++i )
+    {
+        char ch = src[i];
+        if( ch >= 'A' && ch <= 'Z' )
+            ch += ('a' - 'A');
+        *dest++ = ch;
+    }
+    return dest;
+}
+
+/**
+ * @brief This records the byte positions of each token within each string.
+ *
+ * The positions are kept so tokens can be referenced multiple times when
+ * grouping them into ngrams without re-parsing the string.
+ */
+struct pipeline_token_positions_fn
+{
+    cudf::column_device_view const d_strings;  // strings to tokenize
+    cudf::string_view const d_delimiter;       // delimiter to tokenize around
+    int32_t const* d_token_offsets;   // offsets into the d_token_positions for each string
+    position_pair* d_token_positions; // token positions in each string
+
+    __device__ void operator()(cudf::size_type idx)
+    {
+        if( d_strings.is_null(idx) )
+            return;
+        cudf::string_view d_str = d_strings.element<cudf::string_view>(idx);
+        characters_tokenizer tokenizer( d_str, d_delimiter );
+        cudf::size_type token_index = 0;
+        auto token_positions = d_token_positions + d_token_offsets[idx];
+        while( tokenizer.next_token() )
+            token_positions[token_index++] = tokenizer.token_byte_positions();
+    }
+};
+
+/**
+ * @brief Builds the output tokens or ngrams for each string.
+ *
+ * This is the single pass over the character data: tokens are copied
+ * (optionally case folded) directly from the input chars buffer into the
+ * output chars buffer with separators placed between the tokens of each
+ * ngram. Whitespace normalization falls out of the tokenizer since only
+ * token bytes are copied.
+ *
+ * Like the other size-then-write functors, calling this without the output
+ * members set computes the number of bytes required per string.
+ */
+struct pipeline_builder_fn
+{
+    cudf::column_device_view const d_strings; // strings to build output from
+    cudf::string_view const d_separator;      // separator to place between ngram tokens
+    cudf::size_type ngrams;                   // number of tokens per output row
+    bool lowercase;                           // fold ASCII case while copying
+    int32_t const* d_token_offsets;           // offsets for token position for each string
+    position_pair const* d_token_positions;   // token positions for each string
+    int32_t const* d_chars_offsets{}; // offsets for each string's output
+    char* d_chars{};                  // write output strings to here
+    int32_t const* d_ngram_offsets{}; // offsets for sizes of each string's output rows
+    int32_t* d_ngram_sizes{};         // write output row sizes to here
+
+    __device__ cudf::size_type operator()(cudf::size_type idx)
+    {
+        if( d_strings.is_null(idx) )
+            return 0;
+        cudf::string_view d_str = d_strings.element<cudf::string_view>(idx);
+        auto token_positions = d_token_positions + d_token_offsets[idx];
+        auto token_count = d_token_offsets[idx+1] - d_token_offsets[idx];
+        cudf::size_type nbytes = 0; // total number of output bytes needed for this string
+        cudf::size_type ngram_index = 0;
+        char* out_ptr = d_chars ? d_chars + d_chars_offsets[idx] : nullptr;
+        int32_t* d_sizes = d_ngram_sizes ? d_ngram_sizes + d_ngram_offsets[idx] : nullptr;
+        for( cudf::size_type token_index = (ngrams-1); token_index < token_count; ++token_index )
+        {
+            cudf::size_type length = 0; // size of each output row in bytes
+            for( cudf::size_type n = (ngrams-1); n >= 0; --n ) // sliding window of tokens
+            {
+                position_pair item = token_positions[token_index-n];
+                length += item.second - item.first;
+                if( out_ptr )
+                {
+                    if( lowercase )
+                        out_ptr = copy_folded(out_ptr, d_str.data() + item.first,
+                                              item.second - item.first);
+                    else
+                        out_ptr = cudf::strings::detail::copy_and_increment(out_ptr, d_str.data() + item.first,
+                                                                            item.second - item.first);
+                }
+                if( n > 0 )
+                {   // include the separator (except for the last one)
+                    if( out_ptr )
+                        out_ptr = cudf::strings::detail::copy_string( out_ptr, d_separator );
+                    length += d_separator.size_bytes();
+                }
+            }
+            if( d_sizes )
+                d_sizes[ngram_index++] = length;
+            nbytes += length;
+        }
+        return nbytes;
+    }
+};
+
+} // namespace
+
+// detail APIs
+
+std::unique_ptr<cudf::column> pipeline_tokenize( cudf::strings_column_view const& strings,
+                                                 text_pipeline const& pipeline,
+                                                 rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                                                 cudaStream_t stream = 0 )
+{
+    CUDF_EXPECTS( pipeline.delimiter.is_valid(), "Pipeline delimiter must be valid");
+    cudf::string_view d_delimiter( pipeline.delimiter.data(), pipeline.delimiter.size() );
+    CUDF_EXPECTS( pipeline.separator.is_valid(), "Pipeline separator must be valid");
+    cudf::string_view d_separator( pipeline.separator.data(), pipeline.separator.size() );
+    auto const ngrams = pipeline.ngrams;
+    CUDF_EXPECTS( ngrams >= 1, "Pipeline ngrams should be an integer value of 1 or greater");
+
+    auto strings_count = strings.size();
+    if( strings_count==0 )
+        return cudf::make_empty_column(cudf::data_type{cudf::STRING});
+
+    auto execpol = rmm::exec_policy(stream);
+    auto strings_column = cudf::column_device_view::create(strings.parent(),stream);
+    auto d_strings = *strings_column;
+
+    // get the number of tokens per string to get the token-offsets
+    rmm::device_vector<int32_t> token_offsets(strings_count+1);
+    auto d_token_offsets = token_offsets.data().get();
+    thrust::transform_inclusive_scan( execpol->on(stream),
+        thrust::make_counting_iterator<cudf::size_type>(0),
+        thrust::make_counting_iterator<cudf::size_type>(strings_count),
+        d_token_offsets+1,
+        strings_tokenizer{d_strings,d_delimiter},
+        thrust::plus<int32_t>());
+    CUDA_TRY(cudaMemsetAsync( d_token_offsets, 0, sizeof(int32_t), stream ));
+    auto total_tokens = token_offsets[strings_count];
+
+    // record the token positions (in bytes) per string
+    rmm::device_vector<position_pair> token_positions(total_tokens);
+    auto d_token_positions = token_positions.data().get();
+    thrust::for_each_n( execpol->on(stream), thrust::make_counting_iterator<cudf::size_type>(0), strings_count,
+        pipeline_token_positions_fn{d_strings, d_delimiter, d_token_offsets, d_token_positions});
+
+    // compute the number of output rows per string (tokens or ngrams)
+    rmm::device_vector<int32_t> ngram_offsets(strings_count+1);
+    auto d_ngram_offsets = ngram_offsets.data().get();
+    thrust::transform_inclusive_scan( execpol->on(stream), thrust::make_counting_iterator<cudf::size_type>(0),
+        thrust::make_counting_iterator<cudf::size_type>(strings_count), d_ngram_offsets+1,
+        [d_token_offsets, ngrams] __device__ (cudf::size_type idx)
+        {
+            auto token_count = d_token_offsets[idx+1] - d_token_offsets[idx];
+            return (token_count >= ngrams) ? token_count - ngrams + 1 : 0;
+        }, thrust::plus<int32_t>());
+    CUDA_TRY(cudaMemsetAsync( d_ngram_offsets, 0, sizeof(int32_t), stream));
+    auto total_ngrams = ngram_offsets[strings_count];
+
+    // compute the total output size for each string so rows can be written adjacently
+    rmm::device_vector<int32_t> chars_offsets(strings_count+1);
+    auto d_chars_offsets = chars_offsets.data().get();
+    thrust::transform_inclusive_scan( execpol->on(stream), thrust::make_counting_iterator<cudf::size_type>(0),
+        thrust::make_counting_iterator<cudf::size_type>(strings_count), d_chars_offsets+1,
+        pipeline_builder_fn{d_strings, d_separator, ngrams, pipeline.lowercase,
+                            d_token_offsets, d_token_positions},
+        thrust::plus<int32_t>() );
+    CUDA_TRY(cudaMemsetAsync( d_chars_offsets, 0, sizeof(int32_t), stream));
+    auto output_chars_size = chars_offsets[strings_count];
+
+    rmm::device_vector<int32_t> ngram_sizes(total_ngrams); // size in bytes of each output row
+
+    // build chars column and write every output row in one pass over the input chars
+    auto chars_column = cudf::strings::detail::create_chars_child_column( strings_count, 0,
+                                                                          output_chars_size, mr, stream );
+    auto d_chars = chars_column->mutable_view().data<char>();
+    thrust::for_each_n( execpol->on(stream), thrust::make_counting_iterator<int32_t>(0), strings_count,
+        pipeline_builder_fn{d_strings, d_separator, ngrams, pipeline.lowercase,
+                            d_token_offsets, d_token_positions,
+                            d_chars_offsets, d_chars, d_ngram_offsets, ngram_sizes.data().get()});
+    // build the offsets column -- converting the output row sizes into offsets
+    auto offsets_column = cudf::strings::detail::make_offsets_child_column( ngram_sizes.begin(), ngram_sizes.end(),
+                                                                            mr, stream );
+    chars_column->set_null_count(0);
+    offsets_column->set_null_count(0);
+    return make_strings_column(total_ngrams, std::move(offsets_column), std::move(chars_column),
+                               0, rmm::device_buffer{}, stream, mr);
+}
+
+} // namespace detail
+
+// external APIs
+
+std::unique_ptr<cudf::column> pipeline_tokenize( cudf::strings_column_view const& strings,
+                                                 text_pipeline const& pipeline,
+                                                 rmm::mr::device_memory_resource* mr )
+{
+    return detail::pipeline_tokenize( strings, pipeline, mr );
+}
+
+} // namespace nvtext
@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <nvtext/tokenize.hpp>
+#include <nvtext/detail/tokenize.hpp>
+#include <text/utilities/tokenize_ops.cuh>
+#include <hash/concurrent_unordered_map.cuh>
+
+#include <rmm/thrust_rmm_allocator.h>
+#include <thrust/for_each.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+namespace nvtext
+{
+namespace
+{
+
+/**
+ * @brief Hasher for the vocabulary hash map.
+ *
+ * The map keys are row indices into the vocabulary column.
+ * The hash is computed from the string at that row so that probing
+ * with a raw token string produces a consistent hash value.
+ */
+struct vocabulary_hasher
+{
+    cudf::column_device_view const d_vocabulary;
+    __device__ hash_value_type operator()(cudf::size_type index) const
+    {
+        return MurmurHash3_32<cudf::string_view>{}(d_vocabulary.element<cudf::string_view>(index));
+    }
+};
+
+/**
+ * @brief Equality comparator for the vocabulary hash map.
+ *
+ * Compares the vocabulary strings at the two given row indices.
+ */
+struct vocabulary_equal
+{
+    cudf::column_device_view const d_vocabulary;
+    __device__ bool operator()(cudf::size_type lhs, cudf::size_type rhs) const
+    {
+        return d_vocabulary.element<cudf::string_view>(lhs) ==
+               d_vocabulary.element<cudf::string_view>(rhs);
+    }
+};
+
+using vocabulary_map_type = concurrent_unordered_map<cudf::size_type, cudf::size_type,
+                                                     vocabulary_hasher, vocabulary_equal>;
+
+/**
+ * @brief Inserts each vocabulary entry into the hash map keyed by its row index.
+ */
+struct vocabulary_insert_fn
+{
+    vocabulary_map_type d_map;
+    __device__ void operator()(cudf::size_type idx)
+    {
+        d_map.insert( thrust::make_pair(idx,idx) );
+    }
+};
+
+} // namespace
+
+struct tokenize_vocabulary::impl
+{
+    std::unique_ptr<cudf::column_device_view,
+                    std::function<void(cudf::column_device_view*)>> vocabulary_column;
+    std::unique_ptr<vocabulary_map_type,
+                    std::function<void(vocabulary_map_type*)>> map;
+    cudf::size_type vocabulary_size{};
+};
+
+tokenize_vocabulary::tokenize_vocabulary( cudf::strings_column_view const& vocabulary )
+    : _impl(new impl)
+{
+    CUDF_EXPECTS( vocabulary.size() > 0, "Parameter vocabulary must not be empty");
+    CUDF_EXPECTS( !vocabulary.has_nulls(), "Parameter vocabulary must not have nulls");
+    cudaStream_t stream = 0;
+    _impl->vocabulary_size = vocabulary.size();
+    _impl->vocabulary_column = cudf::column_device_view::create(vocabulary.parent(),stream);
+    auto d_vocabulary = *(_impl->vocabulary_column);
+    // build the hash map; -1 is usable as the empty sentinel since
+    // keys are non-negative row indices
+    _impl->map = vocabulary_map_type::create( compute_hash_table_size(vocabulary.size()),
+                                              cudf::size_type{-1}, cudf::size_type{-1},
+                                              vocabulary_hasher{d_vocabulary},
+                                              vocabulary_equal{d_vocabulary},
+                                              vocabulary_map_type::allocator_type{}, stream );
+    thrust::for_each_n( rmm::exec_policy(stream)->on(stream),
+        thrust::make_counting_iterator<cudf::size_type>(0), vocabulary.size(),
+        vocabulary_insert_fn{*(_impl->map)} );
+}
+
+tokenize_vocabulary::~tokenize_vocabulary() = default;
+tokenize_vocabulary::tokenize_vocabulary( tokenize_vocabulary&& ) = default;
+tokenize_vocabulary& tokenize_vocabulary::operator=( tokenize_vocabulary&& ) = default;
+
+cudf::size_type tokenize_vocabulary::size() const
+{
+    return _impl->vocabulary_size;
+}
+
+tokenize_vocabulary::impl* tokenize_vocabulary::get_impl() const
+{
+    return _impl.get();
+}
+
+namespace detail
+{
+namespace
+{
+
+/**
+ * @brief Tokenizes each string and looks up each token in the vocabulary
+ * map within the same kernel.
+ *
+ * The first pass only counts the tokens so the output size can be
+ * calculated. The second pass performs the map lookups and places the
+ * resolved ids into the d_results vector.
+ */
+struct vocabulary_tokenizer_fn
+{
+    cudf::column_device_view const d_strings;  // strings to tokenize
+    cudf::string_view const d_delimiter;       // delimiter characters to tokenize around
+    vocabulary_map_type d_map;                 // vocabulary strings to ids
+    cudf::column_device_view const d_vocabulary; // strings the map indices reference
+    cudf::size_type default_id;                // assigned to tokens not in the vocabulary
+    int32_t* d_offsets{};  // offsets into the d_results vector for each string
+    int32_t* d_results{};  // token ids in device memory
+
+    __device__ cudf::size_type operator()(cudf::size_type idx)
+    {
+        if( d_strings.is_null(idx) )
+            return 0;
+        auto d_str = d_strings.element<cudf::string_view>(idx);
+        // create tokenizer for this string
+        characters_tokenizer tokenizer( d_str, d_delimiter );
+        int32_t* d_str_ids = d_results ? d_results + d_offsets[idx] : nullptr;
+        cudf::size_type token_idx = 0;
+        while( tokenizer.next_token() )
+        {
+            if( d_str_ids )
+            {
+                auto token_pos = tokenizer.token_byte_positions();
+                cudf::string_view d_token( d_str.data() + token_pos.first,
+                                           token_pos.second - token_pos.first );
+                // probe the map with the raw token: the hasher hashes the
+                // token itself and the comparator checks it against the
+                // vocabulary string at the stored index
+                auto const token_hash = MurmurHash3_32<cudf::string_view>{}(d_token);
+                auto const d_vocab = d_vocabulary;
+                auto const found = d_map.find( cudf::size_type{-1},
+                    [token_hash] (cudf::size_type) { return token_hash; },
+                    [d_token, d_vocab] (cudf::size_type, cudf::size_type existing) {
+                        return d_token == d_vocab.element<cudf::string_view>(existing);
+                    });
+                d_str_ids[token_idx] = (found == d_map.end()) ? default_id
+                                                              : static_cast<int32_t>(found->second);
+            }
+            ++token_idx;
+        }
+        return token_idx; // number of tokens found
+    }
+};
+
+} // namespace
+
+// detail API
+
+std::unique_ptr<cudf::column> tokenize_with_vocabulary( cudf::strings_column_view const& strings,
+                                                        tokenize_vocabulary const& vocabulary,
+                                                        cudf::string_scalar const& delimiter,
+                                                        cudf::size_type default_id,
+                                                        rmm::mr::device_memory_resource* mr,
+                                                        cudaStream_t stream )
+{
+    CUDF_EXPECTS( delimiter.is_valid(), "Parameter delimiter must be valid");
+    auto strings_count = strings.size();
+    if( strings_count == 0 )
+        return cudf::make_numeric_column( cudf::data_type{cudf::INT32}, 0 );
+    auto execpol = rmm::exec_policy(stream);
+    cudf::string_view d_delimiter( delimiter.data(), delimiter.size() );
+    auto strings_column = cudf::column_device_view::create(strings.parent(),stream);
+    auto impl = vocabulary.get_impl();
+    vocabulary_tokenizer_fn tokenizer{*strings_column, d_delimiter,
+                                      *(impl->map), *(impl->vocabulary_column), default_id};
+    // get the number of tokens in each string
+    rmm::device_vector<int32_t> token_counts(strings_count);
+    thrust::transform( execpol->on(stream),
+        thrust::make_counting_iterator<cudf::size_type>(0),
+        thrust::make_counting_iterator<cudf::size_type>(strings_count),
+        token_counts.begin(), tokenizer );
+    // create token-id offsets from the counts
+    rmm::device_vector<int32_t> token_offsets(strings_count+1);
+    thrust::inclusive_scan( execpol->on(stream),
+                            token_counts.begin(), token_counts.end(),
+                            token_offsets.begin()+1 );
+    CUDA_TRY(cudaMemsetAsync( token_offsets.data().get(), 0, sizeof(int32_t), stream ));
+    auto const total_tokens = token_offsets.back();
+    // create output column and fill it with the resolved token ids
+    auto results = cudf::make_numeric_column( cudf::data_type{cudf::INT32}, total_tokens,
+                                              cudf::mask_state::UNALLOCATED, stream, mr);
+    tokenizer.d_offsets = token_offsets.data().get();
+    tokenizer.d_results = results->mutable_view().data<int32_t>();
+    thrust::for_each_n(execpol->on(stream),
+        thrust::make_counting_iterator<cudf::size_type>(0), strings_count, tokenizer );
+    return results;
+}
+
+} // namespace detail
+
+// external API
+
+std::unique_ptr<cudf::column> tokenize_with_vocabulary( cudf::strings_column_view const& strings,
+                                                        tokenize_vocabulary const& vocabulary,
+                                                        cudf::string_scalar const& delimiter,
+                                                        cudf::size_type default_id,
+                                                        rmm::mr::device_memory_resource* mr )
+{
+    return detail::tokenize_with_vocabulary( strings, vocabulary, delimiter, default_id, mr );
+}
+
+} // namespace nvtext
@@ -42,6 +42,28 @@ const char* kernel =
     }
 )***";
 
+const char* kernel_nary =
+    R"***(
+    #include <cudf/types.hpp>
+
+    template <typename TypeOut, typename... TypeIn>
+    __global__
+    void kernel_nary(cudf::size_type size,
+                    TypeOut* out_data, TypeIn const*... in_data) {
+        int tid = threadIdx.x;
+        int blkid = blockIdx.x;
+        int blksz = blockDim.x;
+        int gridsz = gridDim.x;
+
+        int start = tid + blkid * blksz;
+        int step = blksz * gridsz;
+
+        for (cudf::size_type i=start; i<size; i+=step) {
+          GENERIC_NARY_OP(&out_data[i], in_data[i]...);
+        }
+    }
+)***";
+
 }  // namespace code
 }  // namespace jit
 }  // namespace transformation
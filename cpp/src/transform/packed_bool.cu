@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/packed_bool.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace experimental {
+namespace detail {
+namespace {
+
+/**
+ * @brief Zeroes the bits past `size` in the last word of `words`.
+ *
+ * The logical word operations below process whole words, so a NOT would
+ * otherwise turn the padding bits on and break downstream bit counts.
+ */
+void clear_slack_bits(bitmask_type* words, size_type size, cudaStream_t stream) {
+    auto const slack_bits = size % cudf::detail::size_in_bits<bitmask_type>();
+    if (slack_bits == 0) { return; }
+    auto const last_word  = word_index(size - 1);
+    auto const slack_mask = (bitmask_type{1} << slack_bits) - 1;
+    thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     thrust::make_counting_iterator<size_type>(1),
+                     [words, last_word, slack_mask] __device__ (size_type) {
+                         words[last_word] &= slack_mask;
+                     });
+}
+
+}  // namespace
+
+packed_bool_column pack_bools(column_view const& input,
+                              rmm::mr::device_memory_resource* mr,
+                              cudaStream_t stream = 0) {
+    CUDF_EXPECTS(input.type().id() == BOOL8, "Input is not of type bool");
+
+    // bools_to_mask already folds nulls to false, which matches the
+    // predicate semantics of this representation
+    auto mask = detail::bools_to_mask(input, mr, stream);
+    if (input.size() > 0) {
+        clear_slack_bits(static_cast<bitmask_type*>(mask.first->data()),
+                         input.size(), stream);
+    }
+    return packed_bool_column{std::move(mask.first), input.size()};
+}
+
+std::unique_ptr<column> unpack_bools(packed_bool_column const& input,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream = 0) {
+    auto out = make_numeric_column(data_type{BOOL8}, input.size,
+                                   mask_state::UNALLOCATED, stream, mr);
+    if (input.size == 0) { return out; }
+
+    auto const words = input.mask();
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(input.size),
+                      out->mutable_view().begin<experimental::bool8>(),
+                      [words] __device__ (size_type i) {
+                          return bit_is_set(words, i) ? true_v : false_v;
+                      });
+    return out;
+}
+
+namespace {
+
+/**
+ * @brief Word-wise binary operation over two bit-packed boolean columns.
+ *
+ * Processes 32 rows per word, so the packed operands move an eighth of the
+ * bytes the equivalent `BOOL8` binaryop would.
+ */
+template <typename WordOp>
+packed_bool_column packed_binary_op(packed_bool_column const& lhs,
+                                    packed_bool_column const& rhs,
+                                    WordOp op,
+                                    rmm::mr::device_memory_resource* mr,
+                                    cudaStream_t stream) {
+    CUDF_EXPECTS(lhs.size == rhs.size, "Column size mismatch");
+    if (lhs.size == 0) {
+        return packed_bool_column{std::make_unique<rmm::device_buffer>(), 0};
+    }
+
+    auto out = std::make_unique<rmm::device_buffer>(
+        bitmask_allocation_size_bytes(lhs.size), stream, mr);
+    auto const num_words = num_bitmask_words(lhs.size);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      lhs.mask(), lhs.mask() + num_words, rhs.mask(),
+                      static_cast<bitmask_type*>(out->data()), op);
+    return packed_bool_column{std::move(out), lhs.size};
+}
+
+}  // namespace
+
+packed_bool_column packed_and(packed_bool_column const& lhs,
+                              packed_bool_column const& rhs,
+                              rmm::mr::device_memory_resource* mr,
+                              cudaStream_t stream = 0) {
+    return packed_binary_op(lhs, rhs,
+                            [] __device__ (bitmask_type l, bitmask_type r) {
+                                return l & r;
+                            }, mr, stream);
+}
+
+packed_bool_column packed_or(packed_bool_column const& lhs,
+                             packed_bool_column const& rhs,
+                             rmm::mr::device_memory_resource* mr,
+                             cudaStream_t stream = 0) {
+    return packed_binary_op(lhs, rhs,
+                            [] __device__ (bitmask_type l, bitmask_type r) {
+                                return l | r;
+                            }, mr, stream);
+}
+
+packed_bool_column packed_not(packed_bool_column const& input,
+                              rmm::mr::device_memory_resource* mr,
+                              cudaStream_t stream = 0) {
+    if (input.size == 0) {
+        return packed_bool_column{std::make_unique<rmm::device_buffer>(), 0};
+    }
+
+    auto out = std::make_unique<rmm::device_buffer>(
+        bitmask_allocation_size_bytes(input.size), stream, mr);
+    auto const num_words = num_bitmask_words(input.size);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      input.mask(), input.mask() + num_words,
+                      static_cast<bitmask_type*>(out->data()),
+                      [] __device__ (bitmask_type w) { return ~w; });
+    // complementing the last word turns the padding bits on
+    clear_slack_bits(static_cast<bitmask_type*>(out->data()), input.size, stream);
+    return packed_bool_column{std::move(out), input.size};
+}
+
+}  // namespace detail
+
+packed_bool_column pack_bools(column_view const& input,
+                              rmm::mr::device_memory_resource* mr) {
+    CUDF_FUNC_RANGE();
+    return detail::pack_bools(input, mr);
+}
+
+std::unique_ptr<column> unpack_bools(packed_bool_column const& input,
+                                     rmm::mr::device_memory_resource* mr) {
+    CUDF_FUNC_RANGE();
+    return detail::unpack_bools(input, mr);
+}
+
+packed_bool_column packed_and(packed_bool_column const& lhs,
+                              packed_bool_column const& rhs,
+                              rmm::mr::device_memory_resource* mr) {
+    CUDF_FUNC_RANGE();
+    return detail::packed_and(lhs, rhs, mr);
+}
+
+packed_bool_column packed_or(packed_bool_column const& lhs,
+                             packed_bool_column const& rhs,
+                             rmm::mr::device_memory_resource* mr) {
+    CUDF_FUNC_RANGE();
+    return detail::packed_or(lhs, rhs, mr);
+}
+
+packed_bool_column packed_not(packed_bool_column const& input,
+                              rmm::mr::device_memory_resource* mr) {
+    CUDF_FUNC_RANGE();
+    return detail::packed_not(input, mr);
+}
+
+}  // namespace experimental
+}  // namespace cudf
@@ -16,6 +16,7 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/null_mask.hpp>
@@ -78,6 +79,67 @@ void unary_operation(mutable_column_view output, column_view input,
 
 }
 
+void nary_operation(mutable_column_view output,
+                    std::vector<column_view> const& inputs,
+                    const std::string& udf, data_type output_type, bool is_ptx,
+                    cudaStream_t stream) {
+
+  std::string hash = "prog_transform_nary.experimental"
+    + std::to_string(std::hash<std::string>{}(udf));
+
+  std::string cuda_source;
+  if(is_ptx){
+    cuda_source = "\n#include <cudf/types.hpp>\n" +
+      cudf::jit::parse_single_function_ptx(
+          udf, "GENERIC_NARY_OP",
+          cudf::jit::get_type_name(output_type), {0}
+          ) + code::kernel_nary;
+  }else{
+    cuda_source =
+      cudf::jit::parse_single_function_cuda(
+          udf, "GENERIC_NARY_OP") + code::kernel_nary;
+  }
+
+  const std::vector<std::string> compiler_flags{
+    "-std=c++14",
+    // Have jitify prune unused global variables
+    "-remove-unused-globals",
+    // suppress all NVRTC warnings
+    "-w"
+  };
+
+  // one template argument per input column, in order
+  std::vector<std::string> template_types;
+  template_types.reserve(inputs.size() + 1);
+  template_types.push_back(cudf::jit::get_type_name(output.type()));
+  for (auto const& input : inputs) {
+    template_types.push_back(cudf::jit::get_type_name(input.type()));
+  }
+
+  // the argument count is only known at runtime, so the kernel arguments are
+  // passed as an array of pointers to each argument
+  cudf::size_type size = output.size();
+  const void* out_data = cudf::jit::get_data_ptr(output);
+  std::vector<const void*> in_data(inputs.size());
+  std::vector<void*> args;
+  args.reserve(inputs.size() + 2);
+  args.push_back(&size);
+  args.push_back(&out_data);
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    in_data[i] = cudf::jit::get_data_ptr(inputs[i]);
+    args.push_back(&in_data[i]);
+  }
+
+  // Launch the jitify kernel
+  cudf::jit::launcher(hash, cuda_source, { cudf_types_hpp },
+                      compiler_flags, nullptr, stream
+  ).set_kernel_inst(
+    "kernel_nary",
+    template_types
+  ).launch(args);
+
+}
+
 } // namespace jit
 } // namespace transformation
 
@@ -109,6 +171,37 @@ std::unique_ptr<column> transform(column_view const& input,
   return output;
 }
 
+std::unique_ptr<column> transform(std::vector<column_view> const& inputs,
+                                  std::string const& nary_udf,
+                                  data_type output_type, bool is_ptx,
+                                  rmm::mr::device_memory_resource *mr,
+                                  cudaStream_t stream)
+{
+  CUDF_EXPECTS(not inputs.empty(), "Transform requires at least one input column.");
+  auto const size = inputs.front().size();
+  for (auto const& input : inputs) {
+    CUDF_EXPECTS(is_numeric(input.type()), "Unexpected non-numeric type.");
+    CUDF_EXPECTS(input.size() == size, "Column sizes don't match.");
+  }
+
+  // null propagation: an output row is null if any input row is null
+  auto new_mask = bitmask_and(table_view{inputs}, mr, stream);
+  std::unique_ptr<column> output =
+    make_numeric_column(output_type, size, std::move(new_mask),
+                        cudf::UNKNOWN_NULL_COUNT, stream, mr);
+
+  if (size == 0) {
+    return output;
+  }
+
+  mutable_column_view output_view = *output;
+
+  transformation::jit::nary_operation(output_view, inputs, nary_udf,
+                                      output_type, is_ptx, stream);
+
+  return output;
+}
+
 } // namespace detail
 
 std::unique_ptr<column> transform(column_view const& input,
@@ -120,5 +213,14 @@ std::unique_ptr<column> transform(column_view const& input,
   return detail::transform(input, unary_udf, output_type, is_ptx, mr);
 }
 
+std::unique_ptr<column> transform(std::vector<column_view> const& inputs,
+                                  std::string const& nary_udf,
+                                  data_type output_type, bool is_ptx,
+                                  rmm::mr::device_memory_resource *mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::transform(inputs, nary_udf, output_type, is_ptx, mr);
+}
+
 } // namespace experimental
 } // namespace cudf
@@ -20,6 +20,7 @@
 #include <cudf/utilities/type_dispatcher.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/detail/copy.hpp>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 
@@ -29,10 +30,17 @@ namespace {
 
 using experimental::detail::warp_size;
 constexpr int MAX_GRID_SIZE = (1<<16)-1;
+constexpr int TILE_DIM = 32;
+constexpr int BLOCK_ROWS = 8;
 
 /**
- * @brief Transposes the values from ncols x nrows input to nrows x ncols output 
- * 
+ * @brief Transposes the values from ncols x nrows input to nrows x ncols output
+ *
+ * Stages TILE_DIM x TILE_DIM tiles through shared memory so that both the
+ * loads (along rows of an input column) and the stores (along rows of an
+ * output column) are coalesced. Must be launched with a
+ * (TILE_DIM, BLOCK_ROWS) block.
+ *
  * @tparam T  Datatype of values pointed to by the views
  * @param input[in]  Device view of input columns' data
  * @param output[out]  Mutable device view of pre-allocated output columns' data
@@ -41,15 +49,79 @@ template <typename T>
 __global__
 void gpu_transpose(table_device_view const input, mutable_table_device_view output)
 {
-  size_type x = blockIdx.x * blockDim.x + threadIdx.x;
-  size_type y = blockIdx.y * blockDim.y + threadIdx.y;
+  // pad the fast dimension to avoid shared memory bank conflicts
+  __shared__ T tile[TILE_DIM][TILE_DIM + 1];
 
-  size_type stride_x = blockDim.x * gridDim.x;
-  size_type stride_y = blockDim.y * gridDim.y;
+  for (size_type tile_x = blockIdx.x * TILE_DIM; tile_x < input.num_columns();
+       tile_x += gridDim.x * TILE_DIM) {
+    for (size_type tile_y = blockIdx.y * TILE_DIM; tile_y < input.num_rows();
+         tile_y += gridDim.y * TILE_DIM) {
+      // coalesced loads: threadIdx.x walks rows within one input column
+      for (int k = threadIdx.y; k < TILE_DIM; k += BLOCK_ROWS) {
+        size_type const col = tile_x + k;
+        size_type const row = tile_y + threadIdx.x;
+        if (col < input.num_columns() && row < input.num_rows()) {
+          tile[k][threadIdx.x] = input.column(col).element<T>(row);
+        }
+      }
+      __syncthreads();
 
-  for (size_type i = x; i < input.num_columns(); i += stride_x) {
-    for (size_type j = y; j < input.num_rows(); j += stride_y) {
-      output.column(j).element<T>(i) = input.column(i).element<T>(j);
+      // coalesced stores: threadIdx.x walks rows within one output column
+      for (int k = threadIdx.y; k < TILE_DIM; k += BLOCK_ROWS) {
+        size_type const out_col = tile_y + k;
+        size_type const out_row = tile_x + threadIdx.x;
+        if (out_col < input.num_rows() && out_row < input.num_columns()) {
+          output.column(out_col).element<T>(out_row) = tile[threadIdx.x][k];
+        }
+      }
+      __syncthreads();
+    }
+  }
+}
+
+/**
+ * @brief Transposes the ncols x nrows input directly into a dense row-major
+ * buffer, the layout `experimental::interleave_columns` produces
+ *
+ * Fusing the transpose with the interleave avoids materializing the
+ * intermediate transposed table; tiling through shared memory keeps both the
+ * per-column loads and the row-major stores coalesced. Must be launched with
+ * a (TILE_DIM, BLOCK_ROWS) block.
+ *
+ * @tparam T  Datatype of values pointed to by the views
+ * @param input[in]  Device view of input columns' data
+ * @param output[out]  Pre-allocated buffer of num_rows * num_columns elements
+ */
+template <typename T>
+__global__
+void gpu_transpose_interleaved(table_device_view const input, T* output)
+{
+  __shared__ T tile[TILE_DIM][TILE_DIM + 1];
+
+  auto const num_columns = input.num_columns();
+
+  for (size_type tile_x = blockIdx.x * TILE_DIM; tile_x < num_columns;
+       tile_x += gridDim.x * TILE_DIM) {
+    for (size_type tile_y = blockIdx.y * TILE_DIM; tile_y < input.num_rows();
+         tile_y += gridDim.y * TILE_DIM) {
+      for (int k = threadIdx.y; k < TILE_DIM; k += BLOCK_ROWS) {
+        size_type const col = tile_x + k;
+        size_type const row = tile_y + threadIdx.x;
+        if (col < num_columns && row < input.num_rows()) {
+          tile[k][threadIdx.x] = input.column(col).element<T>(row);
+        }
+      }
+      __syncthreads();
+
+      // consecutive threads write consecutive elements of an output row
+      for (int k = threadIdx.y; k < TILE_DIM; k += BLOCK_ROWS) {
+        size_type const row = tile_y + k;
+        size_type const col = tile_x + threadIdx.x;
+        if (row < input.num_rows() && col < num_columns) {
+          output[row * num_columns + col] = tile[threadIdx.x][k];
+        }
+      }
+      __syncthreads();
     }
   }
 }
@@ -123,13 +195,9 @@ struct launch_kernel {
     auto output_table = mutable_table_view(output_views);
     auto device_output = mutable_table_device_view::create(output_table, stream);
 
-    // TODO benchmark, because a smaller block size (e.g. 32x8) may perform
-    // better. It would also require transposing via shared memory, which may
-    // improve performance anyway because it would enable coalesced loads and
-    // stores rather than one or the other.
-    dim3 dimBlock(warp_size, warp_size);
-    dim3 dimGrid(std::min(util::div_rounding_up_safe(input.num_columns(), warp_size), MAX_GRID_SIZE),
-                 std::min(util::div_rounding_up_safe(input.num_rows(), warp_size), MAX_GRID_SIZE));
+    dim3 dimBlock(TILE_DIM, BLOCK_ROWS);
+    dim3 dimGrid(std::min(util::div_rounding_up_safe(input.num_columns(), TILE_DIM), MAX_GRID_SIZE),
+                 std::min(util::div_rounding_up_safe(input.num_rows(), TILE_DIM), MAX_GRID_SIZE));
 
     gpu_transpose<T><<<dimGrid, dimBlock, 0, stream>>>(*device_input, *device_output);
 
@@ -163,6 +231,36 @@ struct launch_kernel {
   }
 };
 
+struct launch_interleaved_kernel {
+  template <typename T, std::enable_if_t<is_fixed_width<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(table_view const& input,
+      rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+  {
+    auto const output_size = input.num_columns() * input.num_rows();
+    auto output = experimental::detail::allocate_like(input.column(0),
+      output_size, experimental::mask_allocation_policy::NEVER, mr, stream);
+
+    auto device_input = table_device_view::create(input, stream);
+    auto output_view = output->mutable_view();
+
+    dim3 dimBlock(TILE_DIM, BLOCK_ROWS);
+    dim3 dimGrid(std::min(util::div_rounding_up_safe(input.num_columns(), TILE_DIM), MAX_GRID_SIZE),
+                 std::min(util::div_rounding_up_safe(input.num_rows(), TILE_DIM), MAX_GRID_SIZE));
+
+    gpu_transpose_interleaved<T><<<dimGrid, dimBlock, 0, stream>>>(
+      *device_input, output_view.data<T>());
+
+    return output;
+  }
+
+  template <typename T, std::enable_if_t<not is_fixed_width<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(table_view const& input,
+      rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+  {
+    CUDF_FAIL("Invalid, non-fixed-width type");
+  }
+};
+
 }  // namespace
 
 namespace detail {
@@ -187,6 +285,22 @@ std::unique_ptr<experimental::table> transpose(table_view const& input,
 
   return output;
 }
+
+std::unique_ptr<column> transpose_interleaved(table_view const& input,
+  rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+{
+  if (input.num_columns() == 0 || input.num_rows() == 0) {
+    return make_empty_column(data_type{EMPTY});
+  }
+
+  auto const dtype = input.column(0).type();
+  CUDF_EXPECTS(std::all_of(input.begin(), input.end(), [dtype](auto const& col) {
+    return dtype == col.type(); }), "Column type mismatch");
+  CUDF_EXPECTS(not has_nulls(input), "Columns must not contain nulls");
+
+  return experimental::type_dispatcher(dtype, launch_interleaved_kernel{},
+    input, mr, stream);
+}
 }  // namespace detail
 
 std::unique_ptr<experimental::table> transpose(table_view const& input,
@@ -196,4 +310,11 @@ std::unique_ptr<experimental::table> transpose(table_view const& input,
   return detail::transpose(input, mr);
 }
 
+std::unique_ptr<column> transpose_interleaved(table_view const& input,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::transpose_interleaved(input, mr);
+}
+
 }  // namespace cudf
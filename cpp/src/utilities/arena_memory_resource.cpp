@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/utilities/arena_memory_resource.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+
+namespace cudf
+{
+namespace
+{
+
+// all allocations are padded to this boundary like the upstream rmm resources
+constexpr std::size_t allocation_alignment = 256;
+
+std::size_t align_up( std::size_t value )
+{
+    return (value + (allocation_alignment-1)) & ~(allocation_alignment-1);
+}
+
+} // namespace
+
+arena_memory_resource::arena_memory_resource( std::size_t block_size,
+                                              rmm::mr::device_memory_resource* upstream )
+    : _upstream(upstream), _block_size(align_up(block_size))
+{
+    CUDF_EXPECTS( upstream != nullptr, "Parameter upstream must not be null");
+    CUDF_EXPECTS( block_size > 0, "Parameter block_size must not be zero");
+}
+
+arena_memory_resource::~arena_memory_resource()
+{
+    for( auto& blk : _blocks )
+        _upstream->deallocate( blk.data, blk.size );
+}
+
+std::size_t arena_memory_resource::size() const
+{
+    std::lock_guard<std::mutex> guard(_mutex);
+    std::size_t total = 0;
+    for( auto const& blk : _blocks )
+        total += blk.size;
+    return total;
+}
+
+void arena_memory_resource::reset()
+{
+    std::lock_guard<std::mutex> guard(_mutex);
+    for( auto& blk : _blocks )
+    {
+        blk.offset = 0;
+        blk.outstanding = 0;
+    }
+}
+
+void arena_memory_resource::release()
+{
+    std::lock_guard<std::mutex> guard(_mutex);
+    for( auto& blk : _blocks )
+        _upstream->deallocate( blk.data, blk.size );
+    _blocks.clear();
+}
+
+void* arena_memory_resource::do_allocate( std::size_t bytes, cudaStream_t stream )
+{
+    if( bytes == 0 )
+        return nullptr;
+    bytes = align_up(bytes);
+    std::lock_guard<std::mutex> guard(_mutex);
+    // find a block with enough room remaining
+    auto itr = std::find_if( _blocks.begin(), _blocks.end(),
+        [bytes]( block const& blk ) { return (blk.size - blk.offset) >= bytes; });
+    if( itr == _blocks.end() )
+    {
+        // none available; get a new block from upstream
+        auto block_size = std::max(bytes, _block_size);
+        auto data = _upstream->allocate( block_size, stream );
+        _blocks.push_back( block{data, block_size, 0, 0} );
+        itr = _blocks.end()-1;
+    }
+    void* result = static_cast<char*>(itr->data) + itr->offset;
+    itr->offset += bytes;
+    itr->outstanding += 1;
+    return result;
+}
+
+void arena_memory_resource::do_deallocate( void* p, std::size_t, cudaStream_t )
+{
+    if( p == nullptr )
+        return;
+    std::lock_guard<std::mutex> guard(_mutex);
+    // find the block this pointer was carved from
+    auto itr = std::find_if( _blocks.begin(), _blocks.end(),
+        [p]( block const& blk ) {
+            return (p >= blk.data) &&
+                   (p < static_cast<void*>(static_cast<char*>(blk.data) + blk.size));
+        });
+    if( itr == _blocks.end() )
+        return; // allocation predates a reset()/release(); nothing to do
+    if( (itr->outstanding > 0) && (--itr->outstanding == 0) )
+        itr->offset = 0; // every allocation retired; rewind for reuse
+}
+
+std::pair<std::size_t,std::size_t> arena_memory_resource::do_get_mem_info( cudaStream_t stream ) const
+{
+    return _upstream->get_mem_info(stream);
+}
+
+} // namespace cudf
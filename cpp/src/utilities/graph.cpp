@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/utilities/graph.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <utility>
+
+namespace cudf {
+namespace experimental {
+
+pipeline_graph::~pipeline_graph() {
+  // destructor must not throw; launch errors surface on the next CUDA call
+  if (_graph_exec != nullptr) { cudaGraphExecDestroy(_graph_exec); }
+  if (_graph != nullptr) { cudaGraphDestroy(_graph); }
+}
+
+pipeline_graph::pipeline_graph(pipeline_graph&& other) noexcept
+    : _graph{other._graph}, _graph_exec{other._graph_exec} {
+  other._graph = nullptr;
+  other._graph_exec = nullptr;
+}
+
+pipeline_graph& pipeline_graph::operator=(pipeline_graph&& other) noexcept {
+  if (this != &other) {
+    if (_graph_exec != nullptr) { cudaGraphExecDestroy(_graph_exec); }
+    if (_graph != nullptr) { cudaGraphDestroy(_graph); }
+    _graph = std::exchange(other._graph, nullptr);
+    _graph_exec = std::exchange(other._graph_exec, nullptr);
+  }
+  return *this;
+}
+
+void pipeline_graph::begin_capture(cudaStream_t stream) {
+#if CUDART_VERSION >= 10010
+  // thread-local mode keeps unrelated threads' work out of the capture
+  CUDA_TRY(cudaStreamBeginCapture(stream, cudaStreamCaptureModeThreadLocal));
+#else
+  CUDA_TRY(cudaStreamBeginCapture(stream));
+#endif
+}
+
+void pipeline_graph::end_capture(cudaStream_t stream) {
+  cudaGraph_t captured = nullptr;
+  CUDA_TRY(cudaStreamEndCapture(stream, &captured));
+
+  if (_graph != nullptr) { cudaGraphDestroy(_graph); }
+  _graph = captured;
+
+#if CUDART_VERSION >= 10020
+  if (_graph_exec != nullptr) {
+    // when only node parameters changed (e.g. buffer pointers), updating the
+    // instantiated graph in place avoids the instantiation cost per batch
+    cudaGraphNode_t error_node = nullptr;
+    cudaGraphExecUpdateResult update_result;
+    auto status =
+        cudaGraphExecUpdate(_graph_exec, _graph, &error_node, &update_result);
+    if (status == cudaSuccess && update_result == cudaGraphExecUpdateSuccess) {
+      return;
+    }
+    cudaGetLastError();  // clear the failed update; fall through and rebuild
+    cudaGraphExecDestroy(_graph_exec);
+    _graph_exec = nullptr;
+  }
+#else
+  if (_graph_exec != nullptr) {
+    cudaGraphExecDestroy(_graph_exec);
+    _graph_exec = nullptr;
+  }
+#endif
+
+  CUDA_TRY(cudaGraphInstantiate(&_graph_exec, _graph, nullptr, nullptr, 0));
+}
+
+void pipeline_graph::launch(cudaStream_t stream) {
+  CUDF_EXPECTS(_graph_exec != nullptr,
+               "No captured pipeline to launch. Call begin_capture()/"
+               "end_capture() first.");
+  CUDA_TRY(cudaGraphLaunch(_graph_exec, stream));
+}
+
+}  // namespace experimental
+}  // namespace cudf
@@ -0,0 +1,365 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file pinned_host_pool.hpp
+ * @brief Process-wide pool of pinned host staging memory and chunked,
+ * pipelined device<->host copy helpers built on top of it
+ */
+
+#pragma once
+
+#include <cudf/utilities/error.hpp>
+
+#include <cuda_runtime.h>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Returns the NUMA node owning the active GPU, or -1 if unknown.
+ *
+ * On dual-socket nodes pinned memory allocated on the wrong socket halves
+ * host<->device bandwidth, so allocations staging transfers should be bound
+ * to the socket the GPU's PCIe root complex hangs off of. The node is read
+ * from sysfs via the device's PCI bus id and cached per device.
+ **/
+inline int current_gpu_numa_node() {
+#ifdef __linux__
+  int device = 0;
+  if (cudaGetDevice(&device) != cudaSuccess) {
+    return -1;
+  }
+  static std::mutex mutex;
+  static std::unordered_map<int, int> cache;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = cache.find(device);
+    if (it != cache.end()) {
+      return it->second;
+    }
+  }
+  int node = -1;
+  char bus_id[32] = {};
+  if (cudaDeviceGetPCIBusId(bus_id, sizeof(bus_id), device) == cudaSuccess) {
+    // sysfs paths use lowercase hex
+    std::string id(bus_id);
+    std::transform(id.begin(), id.end(), id.begin(),
+                   [](unsigned char c) { return std::tolower(c); });
+    std::ifstream sysfs("/sys/bus/pci/devices/" + id + "/numa_node");
+    if (!(sysfs >> node)) {
+      node = -1;
+    }
+  }
+  std::lock_guard<std::mutex> lock(mutex);
+  cache.emplace(device, node);
+  return node;
+#else
+  return -1;
+#endif
+}
+
+/**
+ * @brief Pins a host block, preferring pages on the given NUMA node.
+ *
+ * The calling thread's memory policy is pointed at the node for the duration
+ * of the cudaMallocHost call (which faults in and pins the pages) and then
+ * restored. MPOL_PREFERRED is used rather than a strict bind so a full node
+ * degrades to remote pages instead of failing the allocation. Falls back to
+ * an unbound allocation when the node is unknown or the policy syscall is
+ * unavailable.
+ **/
+inline void *numa_affine_pinned_alloc(size_t size, int numa_node) {
+#if defined(__linux__) && defined(SYS_set_mempolicy)
+  constexpr int mpol_default = 0;
+  constexpr int mpol_preferred = 1;
+  if (numa_node >= 0 && numa_node < 64) {
+    unsigned long node_mask = 1ul << numa_node;
+    if (syscall(SYS_set_mempolicy, mpol_preferred, &node_mask,
+                sizeof(node_mask) * 8) == 0) {
+      void *ptr = nullptr;
+      auto const err = cudaMallocHost(&ptr, size);
+      syscall(SYS_set_mempolicy, mpol_default, nullptr, 0);
+      CUDA_TRY(err);
+      return ptr;
+    }
+  }
+#endif
+  void *ptr = nullptr;
+  CUDA_TRY(cudaMallocHost(&ptr, size));
+  return ptr;
+}
+
+/**
+ * @brief Process-wide pool of page-locked (pinned) host memory blocks.
+ *
+ * Transfers to or from pageable host memory force the driver to stage through
+ * an internal bounce buffer, cutting PCIe throughput roughly in half, while a
+ * cudaMallocHost per transfer is far too slow to do inline. This pool pays
+ * the pin cost once: blocks are handed out rounded to power-of-two size
+ * classes and cached on release up to a fixed byte budget, so steady-state
+ * spill and result-fetch paths get pinned staging without touching the
+ * driver allocator.
+ *
+ * Blocks are bound to the NUMA node owning the thread's active GPU and
+ * cached per node, so a block pinned next to one socket's GPU is never
+ * handed to a thread driving a GPU on the other socket.
+ *
+ * A released block may be handed to another thread immediately; callers must
+ * ensure all transfers using a block have completed before releasing it.
+ **/
+class pinned_host_pool {
+ public:
+  /**
+   * @brief Returns the process-wide pool instance
+   **/
+  static pinned_host_pool &instance() {
+    static pinned_host_pool pool;
+    return pool;
+  }
+
+  /**
+   * @brief Borrows a pinned block of at least `size` bytes
+   *
+   * Reuses a cached block of the matching size class on the active GPU's
+   * NUMA node when available; otherwise pins a fresh block rounded up to
+   * the class capacity with pages preferred on that node.
+   *
+   * @param[in] size Minimum number of bytes required
+   *
+   * @return void* The borrowed pinned block
+   **/
+  void *acquire(size_t size) {
+    const auto class_size = size_class(size);
+    const auto numa_node = current_gpu_numa_node();
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto &free_blocks = free_blocks_[numa_node];
+      auto it = free_blocks.lower_bound(class_size);
+      if (it != free_blocks.end()) {
+        void *ptr = it->second;
+        cached_bytes_ -= it->first;
+        live_blocks_.emplace(ptr, block_info{it->first, numa_node});
+        free_blocks.erase(it);
+        return ptr;
+      }
+    }
+    void *ptr = numa_affine_pinned_alloc(class_size, numa_node);
+    std::lock_guard<std::mutex> lock(mutex_);
+    live_blocks_.emplace(ptr, block_info{class_size, numa_node});
+    return ptr;
+  }
+
+  /**
+   * @brief Returns a borrowed block to the pool for reuse
+   *
+   * Blocks beyond the pool's cached byte budget are unpinned instead of
+   * cached. Pointers that did not come from `acquire` are ignored.
+   *
+   * @param[in] ptr The block being returned
+   **/
+  void release(void *ptr) {
+    if (ptr == nullptr) return;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = live_blocks_.find(ptr);
+      if (it == live_blocks_.end()) return;
+      auto const block = it->second;
+      live_blocks_.erase(it);
+      if (cached_bytes_ + block.size <= max_cached_bytes) {
+        cached_bytes_ += block.size;
+        // return the block to the node it was allocated on, which need not
+        // be the releasing thread's current node
+        free_blocks_[block.numa_node].emplace(block.size, ptr);
+        return;
+      }
+    }
+    cudaFreeHost(ptr);
+  }
+
+  /**
+   * @brief Unpins all cached blocks
+   **/
+  void clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto &node_blocks : free_blocks_) {
+      for (auto &block : node_blocks.second) {
+        cudaFreeHost(block.second);
+      }
+    }
+    free_blocks_.clear();
+    cached_bytes_ = 0;
+  }
+
+ private:
+  pinned_host_pool() = default;
+
+  // power-of-two classes (min 1MB) so staging requests of similar
+  // size land on the same cached block
+  static size_t size_class(size_t size) {
+    size_t rounded = 1 << 20;
+    while (rounded < size) {
+      rounded <<= 1;
+    }
+    return rounded;
+  }
+
+  static constexpr size_t max_cached_bytes = 512 * 1024 * 1024;
+
+  struct block_info {
+    size_t size;
+    int numa_node;
+  };
+
+  std::mutex mutex_;
+  std::map<int, std::multimap<size_t, void *>> free_blocks_;  // keyed by NUMA node
+  std::unordered_map<void *, block_info> live_blocks_;
+  size_t cached_bytes_ = 0;
+};
+
+// staging chunk size for the pipelined copies below; large enough to reach
+// peak PCIe throughput, small enough that two chunks overlap usefully
+constexpr size_t pinned_staging_chunk_size = 4 * 1024 * 1024;
+
+/**
+ * @brief Copies device memory into a pageable host buffer through pooled
+ * pinned staging.
+ *
+ * The transfer is split into chunks double-buffered across two pinned
+ * blocks: while one chunk DMAs down on `stream`, the CPU copies the previous
+ * chunk out of its staging block, keeping the bus on the pinned fast path
+ * without pinning the destination. Synchronous with respect to the caller.
+ *
+ * @param[out] dst Pageable host destination
+ * @param[in] d_src Device source
+ * @param[in] size Number of bytes to copy
+ * @param[in] stream Stream on which to enqueue the device-side copies
+ **/
+inline void copy_to_host_staged(void *dst, void const *d_src, size_t size,
+                                cudaStream_t stream = 0) {
+  if (size == 0) return;
+
+  auto &pool = pinned_host_pool::instance();
+  void *staging[2] = {pool.acquire(std::min(size, pinned_staging_chunk_size)),
+                      nullptr};
+  cudaEvent_t events[2] = {};
+  CUDA_TRY(cudaEventCreateWithFlags(&events[0], cudaEventDisableTiming));
+  if (size > pinned_staging_chunk_size) {
+    staging[1] = pool.acquire(pinned_staging_chunk_size);
+    CUDA_TRY(cudaEventCreateWithFlags(&events[1], cudaEventDisableTiming));
+  }
+
+  size_t const num_chunks =
+      (size + pinned_staging_chunk_size - 1) / pinned_staging_chunk_size;
+  for (size_t i = 0; i < num_chunks; ++i) {
+    auto const offset = i * pinned_staging_chunk_size;
+    auto const bytes = std::min(pinned_staging_chunk_size, size - offset);
+    auto const buf = staging[1] != nullptr ? i % 2 : 0;
+    CUDA_TRY(cudaMemcpyAsync(staging[buf],
+                             static_cast<char const *>(d_src) + offset, bytes,
+                             cudaMemcpyDeviceToHost, stream));
+    CUDA_TRY(cudaEventRecord(events[buf], stream));
+    // drain the previous chunk while this one is in flight
+    if (i > 0) {
+      auto const prev = staging[1] != nullptr ? (i - 1) % 2 : 0;
+      auto const prev_offset = (i - 1) * pinned_staging_chunk_size;
+      CUDA_TRY(cudaEventSynchronize(events[prev]));
+      std::memcpy(static_cast<char *>(dst) + prev_offset, staging[prev],
+                  pinned_staging_chunk_size);
+    }
+  }
+  auto const last = staging[1] != nullptr ? (num_chunks - 1) % 2 : 0;
+  auto const last_offset = (num_chunks - 1) * pinned_staging_chunk_size;
+  CUDA_TRY(cudaEventSynchronize(events[last]));
+  std::memcpy(static_cast<char *>(dst) + last_offset, staging[last],
+              size - last_offset);
+
+  cudaEventDestroy(events[0]);
+  pool.release(staging[0]);
+  if (staging[1] != nullptr) {
+    cudaEventDestroy(events[1]);
+    pool.release(staging[1]);
+  }
+}
+
+/**
+ * @brief Copies a pageable host buffer into device memory through pooled
+ * pinned staging.
+ *
+ * Chunks are double-buffered: the CPU fills one pinned block while the
+ * previous block DMAs up on `stream`. Returns once every chunk's upload has
+ * completed, so the source may be freed immediately.
+ *
+ * @param[out] d_dst Device destination
+ * @param[in] src Pageable host source
+ * @param[in] size Number of bytes to copy
+ * @param[in] stream Stream on which to enqueue the device-side copies
+ **/
+inline void copy_to_device_staged(void *d_dst, void const *src, size_t size,
+                                  cudaStream_t stream = 0) {
+  if (size == 0) return;
+
+  auto &pool = pinned_host_pool::instance();
+  void *staging[2] = {pool.acquire(std::min(size, pinned_staging_chunk_size)),
+                      nullptr};
+  cudaEvent_t events[2] = {};
+  CUDA_TRY(cudaEventCreateWithFlags(&events[0], cudaEventDisableTiming));
+  if (size > pinned_staging_chunk_size) {
+    staging[1] = pool.acquire(pinned_staging_chunk_size);
+    CUDA_TRY(cudaEventCreateWithFlags(&events[1], cudaEventDisableTiming));
+  }
+
+  size_t const num_chunks =
+      (size + pinned_staging_chunk_size - 1) / pinned_staging_chunk_size;
+  for (size_t i = 0; i < num_chunks; ++i) {
+    auto const offset = i * pinned_staging_chunk_size;
+    auto const bytes = std::min(pinned_staging_chunk_size, size - offset);
+    auto const buf = staging[1] != nullptr ? i % 2 : 0;
+    // the block can't be refilled until its previous upload has been read
+    if (i >= 2 || (i == 1 && staging[1] == nullptr)) {
+      CUDA_TRY(cudaEventSynchronize(events[buf]));
+    }
+    std::memcpy(staging[buf], static_cast<char const *>(src) + offset, bytes);
+    CUDA_TRY(cudaMemcpyAsync(static_cast<char *>(d_dst) + offset, staging[buf],
+                             bytes, cudaMemcpyHostToDevice, stream));
+    CUDA_TRY(cudaEventRecord(events[buf], stream));
+  }
+  CUDA_TRY(cudaEventSynchronize(events[0]));
+  cudaEventDestroy(events[0]);
+  pool.release(staging[0]);
+  if (staging[1] != nullptr) {
+    CUDA_TRY(cudaEventSynchronize(events[1]));
+    cudaEventDestroy(events[1]);
+    pool.release(staging[1]);
+  }
+}
+
+}  // namespace detail
+}  // namespace cudf
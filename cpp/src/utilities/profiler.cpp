@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/utilities/profiler.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <deque>
+#include <map>
+#include <mutex>
+
+namespace cudf
+{
+namespace profiler
+{
+namespace
+{
+
+// power-of-two latency buckets; bucket 0 is <1us, bucket i covers
+// [2^(i-1), 2^i) us, the last bucket is open-ended (~2.3 minutes up)
+constexpr int num_buckets = 38;
+
+int bucket_of( double ms )
+{
+    double us = ms * 1000.0;
+    if( us < 1.0 )
+        return 0;
+    int bucket = static_cast<int>(std::log2(us)) + 1;
+    return std::min(bucket, num_buckets-1);
+}
+
+// upper bound of a bucket in milliseconds; used as the percentile estimate
+double bucket_upper_ms( int bucket )
+{
+    return std::ldexp(1.0, bucket) / 1000.0;
+}
+
+// running statistics for one launch site name
+struct site_stats
+{
+    std::size_t num_launches = 0;
+    double total_ms = 0;
+    double min_ms = 0;
+    double max_ms = 0;
+    std::size_t buckets[num_buckets] = {};
+
+    void add( double ms )
+    {
+        min_ms = (num_launches == 0) ? ms : std::min(min_ms, ms);
+        max_ms = std::max(max_ms, ms);
+        num_launches += 1;
+        total_ms += ms;
+        buckets[bucket_of(ms)] += 1;
+    }
+
+    double percentile( double pct ) const
+    {
+        if( num_launches == 0 )
+            return 0;
+        auto const rank = static_cast<std::size_t>(std::ceil(pct/100.0 * num_launches));
+        std::size_t seen = 0;
+        for( int bucket = 0; bucket < num_buckets; ++bucket )
+        {
+            seen += buckets[bucket];
+            if( seen >= rank )
+                return bucket_upper_ms(bucket);
+        }
+        return bucket_upper_ms(num_buckets-1);
+    }
+};
+
+// a start/stop event pair not yet waited on
+struct pending_launch
+{
+    std::string name;
+    cudaEvent_t start;
+    cudaEvent_t stop;
+};
+
+struct registry
+{
+    std::atomic<bool> enabled{false};
+    std::mutex mutex;
+    std::deque<pending_launch> pending;
+    std::map<std::string, site_stats> stats;
+    std::deque<cudaEvent_t> event_pool;
+
+    ~registry()
+    {
+        for( auto const& launch : pending )
+        {
+            cudaEventDestroy(launch.start);
+            cudaEventDestroy(launch.stop);
+        }
+        for( auto event : event_pool )
+            cudaEventDestroy(event);
+    }
+
+    cudaEvent_t acquire_event()
+    {
+        if( !event_pool.empty() )
+        {
+            auto event = event_pool.back();
+            event_pool.pop_back();
+            return event;
+        }
+        cudaEvent_t event;
+        CUDA_TRY(cudaEventCreate(&event));
+        return event;
+    }
+
+    // folds completed launches into the statistics; when wait is set, blocks
+    // until every pending launch has completed
+    void harvest( bool wait )
+    {
+        while( !pending.empty() )
+        {
+            auto& launch = pending.front();
+            if( !wait && (cudaEventQuery(launch.stop) == cudaErrorNotReady) )
+                break;
+            CUDA_TRY(cudaEventSynchronize(launch.stop));
+            float ms = 0;
+            CUDA_TRY(cudaEventElapsedTime(&ms, launch.start, launch.stop));
+            stats[launch.name].add(ms);
+            event_pool.push_back(launch.start);
+            event_pool.push_back(launch.stop);
+            pending.pop_front();
+        }
+    }
+};
+
+registry& get_registry()
+{
+    static registry instance;
+    return instance;
+}
+
+} // namespace
+
+void enable()  { get_registry().enabled.store(true); }
+void disable() { get_registry().enabled.store(false); }
+
+bool is_enabled() { return get_registry().enabled.load(std::memory_order_relaxed); }
+
+std::vector<kernel_stats> report()
+{
+    auto& reg = get_registry();
+    std::lock_guard<std::mutex> guard(reg.mutex);
+    reg.harvest(true);
+    std::vector<kernel_stats> result;
+    result.reserve(reg.stats.size());
+    for( auto const& entry : reg.stats )
+    {
+        auto const& site = entry.second;
+        result.push_back( kernel_stats{entry.first,
+                                       site.num_launches,
+                                       site.total_ms,
+                                       site.min_ms,
+                                       site.max_ms,
+                                       site.percentile(50.0),
+                                       site.percentile(95.0),
+                                       site.percentile(99.0)} );
+    }
+    return result;
+}
+
+double percentile( std::string const& name, double percentile )
+{
+    auto& reg = get_registry();
+    std::lock_guard<std::mutex> guard(reg.mutex);
+    reg.harvest(true);
+    auto itr = reg.stats.find(name);
+    return (itr == reg.stats.end()) ? 0 : itr->second.percentile(percentile);
+}
+
+void reset()
+{
+    auto& reg = get_registry();
+    std::lock_guard<std::mutex> guard(reg.mutex);
+    reg.harvest(true);
+    reg.stats.clear();
+}
+
+launch_timer::launch_timer( std::string name, cudaStream_t stream )
+    : _name(std::move(name)), _stream(stream), _active(is_enabled())
+{
+    if( !_active )
+        return;
+    auto& reg = get_registry();
+    std::lock_guard<std::mutex> guard(reg.mutex);
+    _start = reg.acquire_event();
+    _stop = reg.acquire_event();
+    CUDA_TRY(cudaEventRecord(_start, _stream));
+}
+
+launch_timer::~launch_timer()
+{
+    if( !_active )
+        return;
+    cudaEventRecord(_stop, _stream); // no-throw in a destructor
+    auto& reg = get_registry();
+    std::lock_guard<std::mutex> guard(reg.mutex);
+    reg.pending.push_back( pending_launch{std::move(_name), _start, _stop} );
+    reg.harvest(false); // opportunistically fold in completed launches
+}
+
+} // namespace profiler
+} // namespace cudf
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/utilities/tracking_memory_resource.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+
+namespace cudf
+{
+
+tracking_memory_resource::tracking_memory_resource( rmm::mr::device_memory_resource* upstream )
+    : _upstream(upstream)
+{
+    CUDF_EXPECTS( upstream != nullptr, "Parameter upstream must not be null");
+}
+
+void tracking_memory_resource::push_operator( std::string name )
+{
+    std::lock_guard<std::mutex> guard(_mutex);
+    _scopes.push_back(std::move(name));
+}
+
+void tracking_memory_resource::pop_operator()
+{
+    std::lock_guard<std::mutex> guard(_mutex);
+    CUDF_EXPECTS( !_scopes.empty(), "pop_operator() called with no active operator scope");
+    _scopes.pop_back();
+}
+
+std::size_t tracking_memory_resource::current_bytes() const
+{
+    std::lock_guard<std::mutex> guard(_mutex);
+    return _totals.current_bytes;
+}
+
+std::size_t tracking_memory_resource::peak_bytes() const
+{
+    std::lock_guard<std::mutex> guard(_mutex);
+    return _totals.peak_bytes;
+}
+
+std::vector<tracking_memory_resource::operator_stats> tracking_memory_resource::report() const
+{
+    std::lock_guard<std::mutex> guard(_mutex);
+    std::vector<operator_stats> result;
+    result.reserve(_stats.size());
+    for( auto const& entry : _stats )
+        result.push_back( operator_stats{entry.first,
+                                         entry.second.num_allocations,
+                                         entry.second.allocated_bytes,
+                                         entry.second.peak_bytes} );
+    return result;
+}
+
+void tracking_memory_resource::reset()
+{
+    std::lock_guard<std::mutex> guard(_mutex);
+    _stats.clear();
+    _totals = counters{};
+    // keep live allocations mapped so their deallocation is still recognized,
+    // but stop counting them against any operator
+    for( auto& entry : _outstanding )
+        entry.second = std::make_pair(std::size_t{0}, std::string{});
+}
+
+void* tracking_memory_resource::do_allocate( std::size_t bytes, cudaStream_t stream )
+{
+    void* p = _upstream->allocate(bytes, stream);
+    if( p == nullptr )
+        return p;
+    std::lock_guard<std::mutex> guard(_mutex);
+    auto const name = _scopes.empty() ? std::string{} : _scopes.back();
+    auto& stats = _stats[name];
+    stats.num_allocations += 1;
+    stats.allocated_bytes += bytes;
+    stats.current_bytes += bytes;
+    stats.peak_bytes = std::max(stats.peak_bytes, stats.current_bytes);
+    _totals.num_allocations += 1;
+    _totals.allocated_bytes += bytes;
+    _totals.current_bytes += bytes;
+    _totals.peak_bytes = std::max(_totals.peak_bytes, _totals.current_bytes);
+    _outstanding[p] = std::make_pair(bytes, name);
+    return p;
+}
+
+void tracking_memory_resource::do_deallocate( void* p, std::size_t bytes, cudaStream_t stream )
+{
+    _upstream->deallocate(p, bytes, stream);
+    if( p == nullptr )
+        return;
+    std::lock_guard<std::mutex> guard(_mutex);
+    auto itr = _outstanding.find(p);
+    if( itr == _outstanding.end() )
+        return; // not allocated through this resource
+    auto const counted = itr->second.first;
+    auto stats = _stats.find(itr->second.second);
+    if( stats != _stats.end() )
+        stats->second.current_bytes -= std::min(stats->second.current_bytes, counted);
+    _totals.current_bytes -= std::min(_totals.current_bytes, counted);
+    _outstanding.erase(itr);
+}
+
+std::pair<std::size_t,std::size_t> tracking_memory_resource::do_get_mem_info( cudaStream_t stream ) const
+{
+    return _upstream->get_mem_info(stream);
+}
+
+} // namespace cudf
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/binaryop.hpp>
+#include <cudf/copying.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <vector>
+
+namespace cudf {
+namespace test {
+namespace binop {
+
+// int8/int16 ADD/SUB and int8 compares take a packed sub-word SIMD path
+// when both inputs are 32-bit word aligned. These tests pin the packed
+// lanes to the promote-then-truncate semantics of the per-element path.
+struct BinaryOperationSubwordTest : public BaseFixture {};
+
+using bool8 = cudf::experimental::bool8;
+namespace exp = cudf::experimental;
+
+TEST_F(BinaryOperationSubwordTest, Int8AddWrapAround) {
+  // 5 rows: one full 4-lane word plus a trailing element
+  fixed_width_column_wrapper<int8_t> lhs{{127, -128, 100, -100, 1}};
+  fixed_width_column_wrapper<int8_t> rhs{{1, -1, 100, -100, 2}};
+  fixed_width_column_wrapper<int8_t> expected{{-128, 127, -56, 56, 3}};
+
+  auto out = exp::binary_operation(lhs, rhs, exp::binary_operator::ADD,
+                                   data_type{INT8});
+  expect_columns_equal(expected, out->view());
+}
+
+TEST_F(BinaryOperationSubwordTest, Int8SubWrapAround) {
+  fixed_width_column_wrapper<int8_t> lhs{{-128, 127, 0, -1}};
+  fixed_width_column_wrapper<int8_t> rhs{{1, -1, -128, 127}};
+  fixed_width_column_wrapper<int8_t> expected{{127, -128, -128, -128}};
+
+  auto out = exp::binary_operation(lhs, rhs, exp::binary_operator::SUB,
+                                   data_type{INT8});
+  expect_columns_equal(expected, out->view());
+}
+
+TEST_F(BinaryOperationSubwordTest, Int16AddSubWrapAround) {
+  // 3 rows: one full 2-lane word plus a trailing element
+  fixed_width_column_wrapper<int16_t> lhs{{32767, -32768, 5}};
+  fixed_width_column_wrapper<int16_t> rhs{{1, -1, -7}};
+
+  fixed_width_column_wrapper<int16_t> expected_add{{-32768, 32767, -2}};
+  auto add = exp::binary_operation(lhs, rhs, exp::binary_operator::ADD,
+                                   data_type{INT16});
+  expect_columns_equal(expected_add, add->view());
+
+  fixed_width_column_wrapper<int16_t> expected_sub{{32766, -32767, 12}};
+  auto sub = exp::binary_operation(lhs, rhs, exp::binary_operator::SUB,
+                                   data_type{INT16});
+  expect_columns_equal(expected_sub, sub->view());
+}
+
+TEST_F(BinaryOperationSubwordTest, Int8SignedCompares) {
+  // negative lanes: the packed compares must use signed intrinsics
+  fixed_width_column_wrapper<int8_t> lhs{{-1, -128, 5, 0, -5}};
+  fixed_width_column_wrapper<int8_t> rhs{{1, 127, 5, -1, -5}};
+
+  auto less = exp::binary_operation(lhs, rhs, exp::binary_operator::LESS,
+                                    data_type{BOOL8});
+  fixed_width_column_wrapper<bool8> expected_less{
+      {true, true, false, false, false}};
+  expect_columns_equal(expected_less, less->view());
+
+  auto greater = exp::binary_operation(lhs, rhs, exp::binary_operator::GREATER,
+                                       data_type{BOOL8});
+  fixed_width_column_wrapper<bool8> expected_greater{
+      {false, false, false, true, false}};
+  expect_columns_equal(expected_greater, greater->view());
+
+  auto ge = exp::binary_operation(lhs, rhs, exp::binary_operator::GREATER_EQUAL,
+                                  data_type{BOOL8});
+  fixed_width_column_wrapper<bool8> expected_ge{
+      {false, false, true, true, true}};
+  expect_columns_equal(expected_ge, ge->view());
+
+  auto eq = exp::binary_operation(lhs, rhs, exp::binary_operator::EQUAL,
+                                  data_type{BOOL8});
+  fixed_width_column_wrapper<bool8> expected_eq{
+      {false, false, true, false, true}};
+  expect_columns_equal(expected_eq, eq->view());
+
+  auto ne = exp::binary_operation(lhs, rhs, exp::binary_operator::NOT_EQUAL,
+                                  data_type{BOOL8});
+  fixed_width_column_wrapper<bool8> expected_ne{
+      {true, true, false, true, false}};
+  expect_columns_equal(expected_ne, ne->view());
+
+  auto le = exp::binary_operation(lhs, rhs, exp::binary_operator::LESS_EQUAL,
+                                  data_type{BOOL8});
+  fixed_width_column_wrapper<bool8> expected_le{
+      {true, true, true, false, true}};
+  expect_columns_equal(expected_le, le->view());
+}
+
+TEST_F(BinaryOperationSubwordTest, TrailingElements) {
+  // sizes that leave 1..3 trailing int8 (or 1 trailing int16) elements must
+  // be handled by the scalar tail of the packed kernel
+  for (size_type size : {1001, 1002, 1003}) {
+    std::vector<int8_t> h_lhs(size);
+    std::vector<int8_t> h_rhs(size);
+    std::vector<int8_t> h_expected(size);
+    for (size_type i = 0; i < size; i++) {
+      h_lhs[i] = static_cast<int8_t>(i * 37 + 11);
+      h_rhs[i] = static_cast<int8_t>(i * 59 + 101);
+      h_expected[i] = static_cast<int8_t>(h_lhs[i] + h_rhs[i]);
+    }
+    fixed_width_column_wrapper<int8_t> lhs(h_lhs.begin(), h_lhs.end());
+    fixed_width_column_wrapper<int8_t> rhs(h_rhs.begin(), h_rhs.end());
+    fixed_width_column_wrapper<int8_t> expected(h_expected.begin(),
+                                                h_expected.end());
+
+    auto out = exp::binary_operation(lhs, rhs, exp::binary_operator::ADD,
+                                     data_type{INT8});
+    expect_columns_equal(expected, out->view());
+  }
+
+  std::vector<int16_t> h_lhs{32767, -32768, 100, -100, 7};
+  std::vector<int16_t> h_rhs{1, -1, 200, -200, 8};
+  std::vector<int16_t> h_expected(h_lhs.size());
+  for (size_t i = 0; i < h_lhs.size(); i++) {
+    h_expected[i] = static_cast<int16_t>(h_lhs[i] + h_rhs[i]);
+  }
+  fixed_width_column_wrapper<int16_t> lhs(h_lhs.begin(), h_lhs.end());
+  fixed_width_column_wrapper<int16_t> rhs(h_rhs.begin(), h_rhs.end());
+  fixed_width_column_wrapper<int16_t> expected(h_expected.begin(),
+                                               h_expected.end());
+  auto out = exp::binary_operation(lhs, rhs, exp::binary_operator::ADD,
+                                   data_type{INT16});
+  expect_columns_equal(expected, out->view());
+}
+
+TEST_F(BinaryOperationSubwordTest, SlicedOffWordBoundary) {
+  // a slice at offset 1 leaves the int8 data off the 32-bit word boundary;
+  // the misaligned view must fall back to the per-element path and still
+  // produce correct results
+  std::vector<int8_t> h_data(21);
+  for (size_t i = 0; i < h_data.size(); i++) {
+    h_data[i] = static_cast<int8_t>(i * 13 - 50);
+  }
+  fixed_width_column_wrapper<int8_t> col(h_data.begin(), h_data.end());
+  auto lhs = exp::slice(col, {1, 18}).front();
+  auto rhs = exp::slice(col, {1, 18}).front();
+
+  std::vector<int8_t> h_expected(17);
+  for (size_t i = 0; i < h_expected.size(); i++) {
+    h_expected[i] = static_cast<int8_t>(h_data[i + 1] + h_data[i + 1]);
+  }
+  fixed_width_column_wrapper<int8_t> expected(h_expected.begin(),
+                                              h_expected.end());
+
+  auto out = exp::binary_operation(lhs, rhs, exp::binary_operator::ADD,
+                                   data_type{INT8});
+  expect_columns_equal(expected, out->view());
+}
+
+TEST_F(BinaryOperationSubwordTest, WithNulls) {
+  fixed_width_column_wrapper<int8_t> lhs{{127, -128, 10, 20, 30},
+                                         {1, 0, 1, 1, 0}};
+  fixed_width_column_wrapper<int8_t> rhs{{1, -1, 5, 6, 7},
+                                         {1, 1, 0, 1, 1}};
+
+  // null where either input is null; valid lanes still wrap
+  fixed_width_column_wrapper<int8_t> expected{{-128, 0, 0, 26, 0},
+                                              {1, 0, 0, 1, 0}};
+
+  auto out = exp::binary_operation(lhs, rhs, exp::binary_operator::ADD,
+                                   data_type{INT8});
+  expect_columns_equal(expected, out->view());
+}
+
+}  // namespace binop
+}  // namespace test
+}  // namespace cudf
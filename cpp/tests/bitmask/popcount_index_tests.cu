@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/null_mask.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/cudf_gtest.hpp>
+
+#include <gmock/gmock.h>
+
+#include <thrust/device_vector.h>
+
+#include <vector>
+
+struct PopcountIndexTest : public cudf::test::BaseFixture {};
+
+namespace {
+
+// a mask long enough to cross the 1024-word (32768-bit) block boundary of
+// the index, with an irregular bit pattern
+thrust::device_vector<cudf::bitmask_type> make_test_mask(
+    cudf::size_type num_bits) {
+  std::vector<cudf::bitmask_type> h_mask(cudf::num_bitmask_words(num_bits));
+  for (size_t i = 0; i < h_mask.size(); i++) {
+    h_mask[i] = static_cast<cudf::bitmask_type>(i * 2654435761u + 0x9e3779b9u);
+  }
+  return thrust::device_vector<cudf::bitmask_type>(h_mask);
+}
+
+}  // namespace
+
+TEST_F(PopcountIndexTest, MatchesCountSetBits) {
+  constexpr cudf::size_type num_bits = 70000;  // crosses two block boundaries
+  auto mask = make_test_mask(num_bits);
+  cudf::popcount_index index(mask.data().get(), num_bits);
+  EXPECT_EQ(num_bits, index.num_bits());
+
+  // ranges within one block, spanning block boundaries, and whole-mask
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> ranges{
+      {0, num_bits},   {0, 1},         {17, 143},      {32760, 32780},
+      {32768, 65536},  {65530, 70000}, {1000, 66000},  {69999, 70000},
+      {12345, 12345}};
+  for (auto const& range : ranges) {
+    EXPECT_EQ(
+        cudf::count_set_bits(mask.data().get(), range.first, range.second),
+        index.count_set_bits(range.first, range.second))
+        << "range [" << range.first << ", " << range.second << ")";
+    EXPECT_EQ(
+        cudf::count_unset_bits(mask.data().get(), range.first, range.second),
+        index.count_unset_bits(range.first, range.second))
+        << "range [" << range.first << ", " << range.second << ")";
+  }
+}
+
+TEST_F(PopcountIndexTest, SegmentedMatchesSegmentedCount) {
+  constexpr cudf::size_type num_bits = 70000;
+  auto mask = make_test_mask(num_bits);
+  cudf::popcount_index index(mask.data().get(), num_bits);
+
+  std::vector<cudf::size_type> indices = {0,     32,    7,     25,
+                                          32760, 32780, 1000,  66000,
+                                          0,     70000, 12345, 12345};
+  auto expected = cudf::segmented_count_set_bits(mask.data().get(), indices);
+  auto counts = index.segmented_count_set_bits(indices);
+  EXPECT_THAT(counts, testing::ContainerEq(expected));
+
+  auto expected_unset =
+      cudf::segmented_count_unset_bits(mask.data().get(), indices);
+  auto unset_counts = index.segmented_count_unset_bits(indices);
+  EXPECT_THAT(unset_counts, testing::ContainerEq(expected_unset));
+}
+
+TEST_F(PopcountIndexTest, AllSetAllUnset) {
+  constexpr cudf::size_type num_bits = 40000;
+  thrust::device_vector<cudf::bitmask_type> ones(
+      cudf::num_bitmask_words(num_bits), ~cudf::bitmask_type{0});
+  cudf::popcount_index ones_index(ones.data().get(), num_bits);
+  EXPECT_EQ(num_bits, ones_index.count_set_bits(0, num_bits));
+  EXPECT_EQ(0, ones_index.count_unset_bits(0, num_bits));
+
+  thrust::device_vector<cudf::bitmask_type> zeros(
+      cudf::num_bitmask_words(num_bits), 0);
+  cudf::popcount_index zeros_index(zeros.data().get(), num_bits);
+  EXPECT_EQ(0, zeros_index.count_set_bits(0, num_bits));
+  EXPECT_EQ(num_bits, zeros_index.count_unset_bits(0, num_bits));
+}
+
+TEST_F(PopcountIndexTest, InvalidInputs) {
+  auto mask = make_test_mask(1024);
+
+  EXPECT_THROW(cudf::popcount_index(nullptr, 1024), cudf::logic_error);
+  EXPECT_THROW(cudf::popcount_index(mask.data().get(), -1),
+               cudf::logic_error);
+
+  cudf::popcount_index index(mask.data().get(), 1024);
+  // invalid ranges
+  EXPECT_THROW(index.count_set_bits(-1, 32), cudf::logic_error);
+  EXPECT_THROW(index.count_set_bits(32, 31), cudf::logic_error);
+  // range past the indexed bits
+  EXPECT_THROW(index.count_set_bits(0, 1025), cudf::logic_error);
+
+  std::vector<cudf::size_type> odd_indices = {0, 32, 7};
+  EXPECT_THROW(index.segmented_count_set_bits(odd_indices),
+               cudf::logic_error);
+  std::vector<cudf::size_type> bad_range = {0, 32, 1000, 1025};
+  EXPECT_THROW(index.segmented_count_set_bits(bad_range), cudf::logic_error);
+}
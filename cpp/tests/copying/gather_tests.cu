@@ -414,3 +414,88 @@ TEST_F(GatherTestStr, GatherZeroSizeStringsColumn)
     auto results = cudf::experimental::detail::gather(cudf::table_view({zero_size_strings_column}), gather_map.begin(), gather_map.end(), true);
     cudf::test::expect_strings_empty(results->get_column(0).view());
 }
+
+// The bitmask gather early-outs when no source column contains a null; these
+// tests pin down the semantics of that skip and that PASSTHROUGH/NULLIFY
+// still take the mask path.
+class GatherBitmaskTest : public cudf::test::BaseFixture {};
+
+TEST_F(GatherBitmaskTest, NullableNullFreeBecomesNonNullable) {
+  constexpr cudf::size_type source_size{100};
+
+  // all-valid mask: the column is nullable but carries no nulls
+  auto data = cudf::test::make_counting_transform_iterator(0, [](auto i){return i;});
+  auto all_valid = cudf::test::make_counting_transform_iterator(0, [](auto i){return true;});
+  cudf::test::fixed_width_column_wrapper<int32_t> source_column{
+    data, data+source_size, all_valid};
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map{data, data+source_size};
+
+  cudf::table_view source_table ({source_column});
+  EXPECT_TRUE(source_table.column(0).nullable());
+  EXPECT_FALSE(source_table.column(0).has_nulls());
+
+  auto result = cudf::experimental::gather(source_table, gather_map);
+
+  // the gather of a null-free source must produce a null-free, non-nullable
+  // output instead of cloning the all-valid mask
+  EXPECT_FALSE(result->view().column(0).nullable());
+  EXPECT_EQ(0, result->view().column(0).null_count());
+  cudf::test::fixed_width_column_wrapper<int32_t> expect_column{data, data+source_size};
+  cudf::test::expect_columns_equal(expect_column, result->view().column(0));
+}
+
+TEST_F(GatherBitmaskTest, NullifyStillRunsOnNullFreeSource) {
+  constexpr cudf::size_type source_size{100};
+
+  auto data = cudf::test::make_counting_transform_iterator(0, [](auto i){return i;});
+  auto all_valid = cudf::test::make_counting_transform_iterator(0, [](auto i){return true;});
+  cudf::test::fixed_width_column_wrapper<int32_t> source_column{
+    data, data+source_size, all_valid};
+  auto map_data = cudf::test::make_counting_transform_iterator(
+    0, [](auto i){return (i%2)? -1:i;});
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map{
+    map_data, map_data+source_size};
+
+  cudf::table_view source_table ({source_column});
+
+  // out-of-bounds rows must still be nullified even though the source has no
+  // nulls, so the early-out must not swallow the NULLIFY op
+  auto result = cudf::experimental::detail::gather(source_table, gather_map,
+                                                   false, true);
+
+  auto expect_data = cudf::test::make_counting_transform_iterator(
+    0, [](auto i){return (i%2)? 0:i;});
+  auto expect_valid = cudf::test::make_counting_transform_iterator(
+    0, [](auto i){return (i%2)? 0:1;});
+  cudf::test::fixed_width_column_wrapper<int32_t> expect_column{
+    expect_data, expect_data+source_size, expect_valid};
+  cudf::test::expect_columns_equal(expect_column, result->view().column(0));
+}
+
+TEST_F(GatherBitmaskTest, PassthroughStillRunsOnNullFreeSource) {
+  constexpr cudf::size_type source_size{100};
+
+  auto data = cudf::test::make_counting_transform_iterator(0, [](auto i){return i;});
+  auto all_valid = cudf::test::make_counting_transform_iterator(0, [](auto i){return true;});
+  cudf::test::fixed_width_column_wrapper<int32_t> source_column{
+    data, data+source_size, all_valid};
+  cudf::table_view source_table ({source_column});
+
+  // target starts with every other bit cleared; PASSTHROUGH must overwrite
+  // those bits from the (all-valid) source rather than being skipped
+  auto half_valid = cudf::test::make_counting_transform_iterator(
+    0, [](auto i){return i%2;});
+  cudf::test::fixed_width_column_wrapper<int32_t> target_column{
+    data, data+source_size, half_valid};
+  std::vector<std::unique_ptr<cudf::column>> target;
+  target.push_back(std::make_unique<cudf::column>(target_column));
+
+  cudf::experimental::detail::gather_bitmask(
+    source_table, thrust::make_counting_iterator<cudf::size_type>(0), target,
+    cudf::experimental::detail::gather_bitmask_op::PASSTHROUGH,
+    rmm::mr::get_default_resource(), 0);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expect_column{
+    data, data+source_size, all_valid};
+  cudf::test::expect_columns_equal(expect_column, *target.front());
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <vector>
+
+namespace cudf {
+namespace test {
+
+struct PackUnpackTest : public BaseFixture {};
+
+TEST_F(PackUnpackTest, FixedWidthRoundTrip)
+{
+    fixed_width_column_wrapper<int32_t> col1{{1, 2, 3, 4, 5}, {1, 1, 0, 1, 1}};
+    fixed_width_column_wrapper<double>  col2{{0.5, 1.5, 2.5, 3.5, 4.5}};
+    table_view input{{col1, col2}};
+
+    auto packed = experimental::pack(input);
+    auto unpacked = experimental::unpack(packed);
+
+    expect_tables_equal(input, unpacked);
+}
+
+TEST_F(PackUnpackTest, StringsRoundTrip)
+{
+    strings_column_wrapper col({"four", "score", "and", "seven", "years"},
+                               {1, 1, 0, 1, 1});
+    table_view input{{col}};
+
+    auto packed = experimental::pack(input);
+    auto unpacked = experimental::unpack(packed);
+
+    expect_tables_equal(input, unpacked);
+}
+
+TEST_F(PackUnpackTest, SlicedInput)
+{
+    fixed_width_column_wrapper<int32_t> col{{0, 1, 2, 3, 4, 5, 6, 7},
+                                            {1, 0, 1, 1, 1, 0, 1, 1}};
+    auto sliced = experimental::slice(col, {2, 6}).front();
+    table_view input{{sliced}};
+
+    // pack deep-copies, so the unpacked view must equal the sliced input
+    // even though the packed block is compacted and re-based
+    auto packed = experimental::pack(input);
+    auto unpacked = experimental::unpack(packed);
+
+    expect_tables_equal(input, unpacked);
+}
+
+TEST_F(PackUnpackTest, RelocatedBuffer)
+{
+    fixed_width_column_wrapper<int32_t> col1{{1, 2, 3, 4, 5}, {1, 1, 0, 1, 1}};
+    strings_column_wrapper col2({"a", "bb", "ccc", "dddd", "eeeee"});
+    table_view input{{col1, col2}};
+
+    auto packed = experimental::pack(input);
+
+    // the metadata holds no absolute pointers: bounce the data block through
+    // the host into a fresh device allocation and unpack it there
+    std::vector<uint8_t> staged(packed.gpu_data->size());
+    CUDA_TRY(cudaMemcpy(staged.data(), packed.gpu_data->data(), staged.size(),
+                        cudaMemcpyDeviceToHost));
+    rmm::device_buffer relocated(staged.data(), staged.size());
+    packed.gpu_data.reset();
+
+    auto unpacked = experimental::unpack(
+        packed.metadata.data(), static_cast<uint8_t const*>(relocated.data()));
+    expect_tables_equal(input, unpacked);
+}
+
+TEST_F(PackUnpackTest, EmptyTable)
+{
+    fixed_width_column_wrapper<int32_t> col{};
+    table_view input{{col}};
+
+    auto packed = experimental::pack(input);
+    auto unpacked = experimental::unpack(packed);
+
+    EXPECT_EQ(input.num_columns(), unpacked.num_columns());
+    EXPECT_EQ(0, unpacked.num_rows());
+}
+
+TEST_F(PackUnpackTest, NullMetadataThrows)
+{
+    EXPECT_THROW(experimental::unpack(nullptr, nullptr), cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
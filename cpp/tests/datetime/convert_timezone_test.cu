@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/datetime.hpp>
+#include <cudf/types.hpp>
+#include <cudf/wrappers/timestamps.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+struct ConvertTimezoneTest : public cudf::test::BaseFixture {};
+
+// US/Pacific is UTC-8 in standard time and UTC-7 while daylight saving is
+// in effect. In 2020 DST started at 2020-03-08 10:00:00 UTC and ended at
+// 2020-11-01 09:00:00 UTC.
+
+TEST_F(ConvertTimezoneTest, DstSpringForwardBoundary) {
+  using namespace cudf::test;
+
+  // one second before and the first second after the transition
+  auto input = fixed_width_column_wrapper<cudf::timestamp_s>{
+      1583661599, 1583661600};
+  auto expected = fixed_width_column_wrapper<cudf::timestamp_s>{
+      1583661599 - 28800, 1583661600 - 25200};
+
+  auto result = cudf::datetime::convert_timezone(input, "US/Pacific");
+  expect_columns_equal(expected, result->view());
+}
+
+TEST_F(ConvertTimezoneTest, DstFallBackBoundary) {
+  using namespace cudf::test;
+
+  auto input = fixed_width_column_wrapper<cudf::timestamp_s>{
+      1604221199, 1604221200};
+  auto expected = fixed_width_column_wrapper<cudf::timestamp_s>{
+      1604221199 - 25200, 1604221200 - 28800};
+
+  auto result = cudf::datetime::convert_timezone(input, "US/Pacific");
+  expect_columns_equal(expected, result->view());
+}
+
+TEST_F(ConvertTimezoneTest, BeyondLastRecordedTransition) {
+  using namespace cudf::test;
+
+  // 2120-01-15 and 2120-07-15 00:00:00 UTC are far past the last transition
+  // in the timezone database; the repeating 400-year cycle must still apply
+  // standard time in January and daylight saving in July
+  auto input = fixed_width_column_wrapper<cudf::timestamp_s>{
+      4734720000L, 4750444800L};
+  auto expected = fixed_width_column_wrapper<cudf::timestamp_s>{
+      4734720000L - 28800, 4750444800L - 25200};
+
+  auto result = cudf::datetime::convert_timezone(input, "US/Pacific");
+  expect_columns_equal(expected, result->view());
+}
+
+TEST_F(ConvertTimezoneTest, SubSecondPartUnaffected) {
+  using namespace cudf::test;
+
+  auto input = fixed_width_column_wrapper<cudf::timestamp_ms>{
+      1583661599123L, 1583661600456L};
+  auto expected = fixed_width_column_wrapper<cudf::timestamp_ms>{
+      1583661599123L - 28800000L, 1583661600456L - 25200000L};
+
+  auto result = cudf::datetime::convert_timezone(input, "US/Pacific");
+  expect_columns_equal(expected, result->view());
+}
+
+TEST_F(ConvertTimezoneTest, DaysTruncateTowardZero) {
+  using namespace cudf::test;
+
+  // sub-day offsets truncate toward zero for TIMESTAMP_DAYS, so the -8h/-7h
+  // Pacific offsets leave day values unchanged
+  auto input = fixed_width_column_wrapper<cudf::timestamp_D>{
+      0, 18262, 18330};
+
+  auto result = cudf::datetime::convert_timezone(input, "US/Pacific");
+  expect_columns_equal(input, result->view());
+}
+
+TEST_F(ConvertTimezoneTest, UtcAndEmptyNameReturnCopy) {
+  using namespace cudf::test;
+
+  auto input = fixed_width_column_wrapper<cudf::timestamp_s>{
+      {1583661599, 1583661600, 1604221200}, {1, 0, 1}};
+
+  auto utc = cudf::datetime::convert_timezone(input, "UTC");
+  expect_columns_equal(input, utc->view());
+
+  auto empty_name = cudf::datetime::convert_timezone(input, "");
+  expect_columns_equal(input, empty_name->view());
+}
+
+TEST_F(ConvertTimezoneTest, NullsPreserved) {
+  using namespace cudf::test;
+
+  auto input = fixed_width_column_wrapper<cudf::timestamp_s>{
+      {1583661599, 1583661600, 1604221200}, {1, 0, 1}};
+  auto expected = fixed_width_column_wrapper<cudf::timestamp_s>{
+      {1583661599 - 28800, 0, 1604221200 - 28800}, {1, 0, 1}};
+
+  auto result = cudf::datetime::convert_timezone(input, "US/Pacific");
+  expect_columns_equal(expected, result->view());
+}
+
+TEST_F(ConvertTimezoneTest, InvalidInputsThrow) {
+  using namespace cudf::test;
+
+  auto timestamps = fixed_width_column_wrapper<cudf::timestamp_s>{0};
+  EXPECT_THROW(cudf::datetime::convert_timezone(timestamps, "Not/AZone"),
+               cudf::logic_error);
+
+  auto not_timestamps = fixed_width_column_wrapper<int64_t>{0};
+  EXPECT_THROW(cudf::datetime::convert_timezone(not_timestamps, "US/Pacific"),
+               cudf::logic_error);
+}
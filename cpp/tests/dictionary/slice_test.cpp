@@ -80,3 +80,23 @@ TEST_F(DictionarySliceTest, SplitColumn)
     auto output3 = cudf::dictionary::decode( cudf::dictionary_column_view(results[2]) );
     cudf::test::expect_column_properties_equal(expected3,output3->view());
 }
+
+TEST_F(DictionarySliceTest, CopySlicedColumn)
+{
+    cudf::test::strings_column_wrapper strings{ {"eee", "aaa", "ddd", "bbb", "ccc", "ccc", "ccc", "eee", "aaa"},
+                                                {   1,     1,     1,     1,     1,     0,     1,     1,     1} };
+    auto dictionary = cudf::dictionary::encode( strings );
+
+    std::vector<cudf::size_type> splits{ 1,6 };
+    auto sliced = cudf::experimental::slice( dictionary->view(), splits ).front();
+
+    // deep-copying the sliced view must carve the indices to the slice's rows
+    cudf::column copied( sliced );
+    EXPECT_EQ( sliced.size(), copied.size() );
+    cudf::dictionary_column_view copied_view( copied.view() );
+    EXPECT_EQ( sliced.size(), copied_view.indices().size() );
+
+    auto output = cudf::dictionary::decode( copied_view );
+    auto expected = cudf::dictionary::decode( cudf::dictionary_column_view(sliced) );
+    cudf::test::expect_columns_equal( expected->view(), output->view() );
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <cudf/detail/aggregation/aggregation.hpp>
+
+namespace cudf {
+namespace test {
+
+// The fused hash pass flattens each request's aggregations and drops
+// duplicate kinds (e.g. string MIN and an explicit ARGMIN both lower to
+// ARGMIN). These tests pin down that every requested aggregation still gets
+// its own dense result even when the sparse column behind it is shared.
+
+struct groupby_duplicate_agg_test : public cudf::test::BaseFixture {};
+
+namespace {
+
+// Runs one request carrying several aggregations and compares each dense
+// result, normalizing the hash path's arbitrary group order by key sort
+void test_multi_agg(column_view const& keys,
+                    column_view const& values,
+                    column_view const& expect_keys,
+                    std::vector<column_view> const& expect_vals,
+                    std::vector<std::unique_ptr<experimental::aggregation>>&& aggs)
+{
+    std::vector<experimental::groupby::aggregation_request> requests;
+    requests.emplace_back(experimental::groupby::aggregation_request());
+    requests[0].values = values;
+    requests[0].aggregations = std::move(aggs);
+
+    experimental::groupby::groupby gb_obj(table_view({keys}));
+    auto result = gb_obj.aggregate(requests);
+
+    ASSERT_EQ(requests[0].aggregations.size(), result.second[0].results.size());
+
+    auto const sort_order = experimental::sorted_order(result.first->view(),
+        {}, {null_order::AFTER});
+    auto const sorted_keys = experimental::gather(result.first->view(),
+        *sort_order);
+    expect_tables_equal(table_view({expect_keys}), *sorted_keys);
+
+    for (size_t i = 0; i < expect_vals.size(); i++) {
+        auto const sorted_vals = experimental::gather(
+            table_view({result.second[0].results[i]->view()}), *sort_order);
+        expect_columns_equal(expect_vals[i], sorted_vals->get_column(0), true);
+    }
+}
+
+}  // namespace
+
+TEST_F(groupby_duplicate_agg_test, string_min_and_argmin)
+{
+    using K = int32_t;
+
+    fixed_width_column_wrapper<K> keys { 1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+    strings_column_wrapper        vals { "olive", "quartz", "mango", "apple",
+                                         "banana", "pear", "kiwi", "cherry",
+                                         "fig", "date" };
+
+    fixed_width_column_wrapper<K> expect_keys { 1, 2, 3 };
+    strings_column_wrapper expect_mins { "apple", "banana", "cherry" };
+    fixed_width_column_wrapper<size_type> expect_argmins { 3, 4, 7 };
+
+    // string MIN lowers to ARGMIN internally; the explicit ARGMIN shares its
+    // sparse column but must still surface as a separate dense result
+    std::vector<std::unique_ptr<experimental::aggregation>> aggs;
+    aggs.push_back(experimental::make_min_aggregation());
+    aggs.push_back(experimental::make_argmin_aggregation());
+    test_multi_agg(keys, vals, expect_keys,
+                   {expect_mins, expect_argmins}, std::move(aggs));
+}
+
+TEST_F(groupby_duplicate_agg_test, repeated_same_aggregation)
+{
+    using K = int32_t;
+    using V = int32_t;
+    using R = experimental::detail::target_type_t<V, experimental::aggregation::SUM>;
+
+    fixed_width_column_wrapper<K> keys { 1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+    fixed_width_column_wrapper<V> vals { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    fixed_width_column_wrapper<K> expect_keys { 1, 2, 3 };
+    fixed_width_column_wrapper<R> expect_sums { 9, 19, 17 };
+
+    std::vector<std::unique_ptr<experimental::aggregation>> aggs;
+    aggs.push_back(experimental::make_sum_aggregation());
+    aggs.push_back(experimental::make_sum_aggregation());
+    test_multi_agg(keys, vals, expect_keys,
+                   {expect_sums, expect_sums}, std::move(aggs));
+}
+
+TEST_F(groupby_duplicate_agg_test, distinct_aggregations_unaffected)
+{
+    using K = int32_t;
+    using V = int32_t;
+    using RMIN = experimental::detail::target_type_t<V, experimental::aggregation::MIN>;
+    using RMAX = experimental::detail::target_type_t<V, experimental::aggregation::MAX>;
+
+    fixed_width_column_wrapper<K> keys { 1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+    fixed_width_column_wrapper<V> vals { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    fixed_width_column_wrapper<K>    expect_keys { 1, 2, 3 };
+    fixed_width_column_wrapper<RMIN> expect_mins { 0, 1, 2 };
+    fixed_width_column_wrapper<RMAX> expect_maxs { 6, 9, 8 };
+
+    std::vector<std::unique_ptr<experimental::aggregation>> aggs;
+    aggs.push_back(experimental::make_min_aggregation());
+    aggs.push_back(experimental::make_max_aggregation());
+    test_multi_agg(keys, vals, expect_keys,
+                   {expect_mins, expect_maxs}, std::move(aggs));
+}
+
+} // namespace test
+} // namespace cudf
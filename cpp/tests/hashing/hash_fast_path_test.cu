@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/hashing.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/type_lists.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <limits>
+#include <vector>
+
+using cudf::test::fixed_width_column_wrapper;
+using cudf::test::strings_column_wrapper;
+using cudf::test::expect_columns_equal;
+
+namespace {
+
+// Host mirror of the generic row_hasher: seed 0, element hash (or the null
+// sentinel) folded in with hash_combine, one column at a time. The unrolled
+// device fast path and the generic dispatch path must both reproduce this
+// exactly.
+template <template <typename> class hash_function, typename T>
+hash_value_type reference_row_hash(std::vector<T> const& row_values,
+                                   std::vector<bool> const& row_valids)
+{
+  hash_function<hash_value_type> combiner;
+  hash_function<T> hasher;
+  hash_value_type hash{0};
+  for (size_t c = 0; c < row_values.size(); ++c) {
+    auto const element_hash =
+        row_valids[c] ? hasher(row_values[c])
+                      : std::numeric_limits<hash_value_type>::max();
+    hash = combiner.hash_combine(hash, element_hash);
+  }
+  return hash;
+}
+
+}  // namespace
+
+template <typename T>
+class HashFastPathTest : public cudf::test::BaseFixture {};
+
+using FastPathTypes = cudf::test::Types<int8_t, int16_t, int32_t, int64_t>;
+TYPED_TEST_CASE(HashFastPathTest, FastPathTypes);
+
+// 1-4 same-type integer columns take the unrolled hasher; 5 columns fall
+// back to the generic row hasher. Both must match the host reference, so
+// both paths are bit-identical to each other.
+TYPED_TEST(HashFastPathTest, MatchesGenericFormula)
+{
+  using T = TypeParam;
+  constexpr cudf::size_type num_rows = 97;
+
+  for (int num_columns = 1; num_columns <= 5; ++num_columns) {
+    std::vector<std::vector<T>> values(num_columns,
+                                       std::vector<T>(num_rows));
+    for (int c = 0; c < num_columns; ++c) {
+      for (cudf::size_type r = 0; r < num_rows; ++r) {
+        values[c][r] = static_cast<T>((r * 7 + c * 13) % 100 - 50);
+      }
+    }
+
+    std::vector<fixed_width_column_wrapper<T>> columns;
+    std::vector<cudf::column_view> views;
+    for (int c = 0; c < num_columns; ++c) {
+      columns.emplace_back(values[c].begin(), values[c].end());
+    }
+    for (auto const& col : columns) { views.push_back(col); }
+
+    std::vector<int32_t> h_expected(num_rows);
+    for (cudf::size_type r = 0; r < num_rows; ++r) {
+      std::vector<T> row(num_columns);
+      for (int c = 0; c < num_columns; ++c) { row[c] = values[c][r]; }
+      h_expected[r] = static_cast<int32_t>(
+          reference_row_hash<MurmurHash3_32>(
+              row, std::vector<bool>(num_columns, true)));
+    }
+    fixed_width_column_wrapper<int32_t> expected(h_expected.begin(),
+                                                 h_expected.end());
+
+    auto const output = cudf::hash(cudf::table_view(views));
+    expect_columns_equal(expected, output->view());
+  }
+}
+
+TYPED_TEST(HashFastPathTest, MatchesGenericFormulaWithNulls)
+{
+  using T = TypeParam;
+  constexpr cudf::size_type num_rows = 97;
+
+  for (int num_columns = 1; num_columns <= 5; ++num_columns) {
+    std::vector<std::vector<T>> values(num_columns,
+                                       std::vector<T>(num_rows));
+    std::vector<std::vector<bool>> valids(num_columns,
+                                          std::vector<bool>(num_rows));
+    for (int c = 0; c < num_columns; ++c) {
+      for (cudf::size_type r = 0; r < num_rows; ++r) {
+        values[c][r] = static_cast<T>((r * 11 + c * 17) % 100 - 50);
+        valids[c][r] = ((r + c) % 3) != 0;
+      }
+    }
+
+    std::vector<fixed_width_column_wrapper<T>> columns;
+    std::vector<cudf::column_view> views;
+    for (int c = 0; c < num_columns; ++c) {
+      columns.emplace_back(values[c].begin(), values[c].end(),
+                           valids[c].begin());
+    }
+    for (auto const& col : columns) { views.push_back(col); }
+
+    std::vector<int32_t> h_expected(num_rows);
+    for (cudf::size_type r = 0; r < num_rows; ++r) {
+      std::vector<T> row(num_columns);
+      std::vector<bool> row_valids(num_columns);
+      for (int c = 0; c < num_columns; ++c) {
+        row[c] = values[c][r];
+        row_valids[c] = valids[c][r];
+      }
+      h_expected[r] = static_cast<int32_t>(
+          reference_row_hash<MurmurHash3_32>(row, row_valids));
+    }
+    fixed_width_column_wrapper<int32_t> expected(h_expected.begin(),
+                                                 h_expected.end());
+
+    auto const output = cudf::hash(cudf::table_view(views));
+    expect_columns_equal(expected, output->view());
+  }
+}
+
+class HashFastPathUntypedTest : public cudf::test::BaseFixture {};
+
+// mixed key types within the 1-4 column range must take the generic path
+// and still match the per-type reference
+TEST_F(HashFastPathUntypedTest, MixedTypesTakeGenericPath)
+{
+  std::vector<int32_t> v1{1, -2, 3, -4, 5};
+  std::vector<int64_t> v2{10, -20, 30, -40, 50};
+
+  fixed_width_column_wrapper<int32_t> col1(v1.begin(), v1.end());
+  fixed_width_column_wrapper<int64_t> col2(v2.begin(), v2.end());
+
+  std::vector<int32_t> h_expected(v1.size());
+  for (size_t r = 0; r < v1.size(); ++r) {
+    MurmurHash3_32<hash_value_type> combiner;
+    hash_value_type hash{0};
+    hash = combiner.hash_combine(hash, MurmurHash3_32<int32_t>{}(v1[r]));
+    hash = combiner.hash_combine(hash, MurmurHash3_32<int64_t>{}(v2[r]));
+    h_expected[r] = static_cast<int32_t>(hash);
+  }
+  fixed_width_column_wrapper<int32_t> expected(h_expected.begin(),
+                                               h_expected.end());
+
+  auto const output = cudf::hash(cudf::table_view({col1, col2}));
+  expect_columns_equal(expected, output->view());
+}
+
+TEST_F(HashFastPathUntypedTest, IdentityHashValues)
+{
+  std::vector<int32_t> v1{0, 1, -1, 100, -100};
+  std::vector<int32_t> v2{7, -7, 0, 42, -42};
+  fixed_width_column_wrapper<int32_t> col1(v1.begin(), v1.end());
+  fixed_width_column_wrapper<int32_t> col2(v2.begin(), v2.end());
+
+  std::vector<int32_t> h_expected(v1.size());
+  for (size_t r = 0; r < v1.size(); ++r) {
+    h_expected[r] = static_cast<int32_t>(
+        reference_row_hash<IdentityHash, int32_t>({v1[r], v2[r]},
+                                                  {true, true}));
+  }
+  fixed_width_column_wrapper<int32_t> expected(h_expected.begin(),
+                                               h_expected.end());
+
+  auto const output = cudf::identity_hash(cudf::table_view({col1, col2}));
+  expect_columns_equal(expected, output->view());
+}
+
+TEST_F(HashFastPathUntypedTest, IdentityHashWithNulls)
+{
+  std::vector<int64_t> v{5, 6, 7, 8};
+  std::vector<bool> valid{true, false, true, false};
+  fixed_width_column_wrapper<int64_t> col(v.begin(), v.end(), valid.begin());
+
+  std::vector<int32_t> h_expected(v.size());
+  for (size_t r = 0; r < v.size(); ++r) {
+    h_expected[r] = static_cast<int32_t>(
+        reference_row_hash<IdentityHash, int64_t>({v[r]}, {valid[r]}));
+  }
+  fixed_width_column_wrapper<int32_t> expected(h_expected.begin(),
+                                               h_expected.end());
+
+  auto const output = cudf::identity_hash(cudf::table_view({col}));
+  expect_columns_equal(expected, output->view());
+}
+
+TEST_F(HashFastPathUntypedTest, IdentityHashInvalidInputs)
+{
+  fixed_width_column_wrapper<int32_t> ints{1, 2, 3};
+  fixed_width_column_wrapper<double> doubles{1.0, 2.0, 3.0};
+  strings_column_wrapper strings({"a", "b", "c"});
+
+  // non-integral types are not supported
+  EXPECT_THROW(cudf::identity_hash(cudf::table_view({doubles})),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::identity_hash(cudf::table_view({strings})),
+               cudf::logic_error);
+  // mixed types are not supported
+  EXPECT_THROW(
+      cudf::identity_hash(cudf::table_view({ints, doubles})),
+      cudf::logic_error);
+  // more than four columns are not supported
+  EXPECT_THROW(cudf::identity_hash(
+                   cudf::table_view({ints, ints, ints, ints, ints})),
+               cudf::logic_error);
+}
@@ -21,6 +21,10 @@
 
 #include <rmm/device_buffer.hpp>
 
+#ifdef CUDF_ZSTD
+#include <zstd.h>
+#endif
+
 /**
  * @brief Base test fixture for decompression
  *
@@ -107,6 +111,15 @@ struct BrotliDecompressTest : public DecompressTest<BrotliDecompressTest> {
   }
 };
 
+#ifdef CUDF_ZSTD
+/**
+ * @brief Derived fixture for ZSTD decompression
+ **/
+struct ZstdDecompressTest : public DecompressTest<ZstdDecompressTest> {
+  cudaError_t dispatch() { return cudf::io::gpu_unzstd(d_inf_args, d_inf_stat, 1, 0); }
+};
+#endif
+
 TEST_F(GzipDecompressTest, HelloWorld) {
   constexpr char uncompressed[] = "hello world";
   constexpr uint8_t compressed[] = {
@@ -148,3 +161,70 @@ TEST_F(BrotliDecompressTest, HelloWorld) {
   Decompress(&output, compressed, sizeof(compressed));
   EXPECT_STREQ(reinterpret_cast<char*>(output.data()), uncompressed);
 }
+
+#ifdef CUDF_ZSTD
+TEST_F(ZstdDecompressTest, RoundTrip) {
+  constexpr char uncompressed[] = "hello world";
+  std::vector<uint8_t> compressed(ZSTD_compressBound(sizeof(uncompressed)));
+  auto const compressed_size =
+      ZSTD_compress(compressed.data(), compressed.size(), uncompressed,
+                    sizeof(uncompressed), 1);
+  ASSERT_FALSE(ZSTD_isError(compressed_size));
+
+  std::vector<uint8_t> output(sizeof(uncompressed));
+  Decompress(&output, compressed.data(), compressed_size);
+  EXPECT_EQ(inf_stat->status, 0);
+  EXPECT_STREQ(reinterpret_cast<char*>(output.data()), uncompressed);
+}
+
+// Exercises the batched staging path: several independent chunks through one
+// gpu_unzstd call, as the Parquet reader submits them per-page
+TEST_F(GdfTest, ZstdBatchedRoundTrip) {
+  std::vector<std::vector<uint8_t>> sources;
+  for (int i = 0; i < 4; i++) {
+    sources.emplace_back(1000 + 100 * i);
+    for (size_t j = 0; j < sources.back().size(); j++) {
+      sources.back()[j] = static_cast<uint8_t>((i * 7 + j) % 251);
+    }
+  }
+
+  auto const count = static_cast<int>(sources.size());
+  std::vector<rmm::device_buffer> d_src;
+  std::vector<rmm::device_buffer> d_dst;
+  std::vector<cudf::io::gpu_inflate_input_s> h_args(count);
+  for (int i = 0; i < count; i++) {
+    std::vector<uint8_t> compressed(ZSTD_compressBound(sources[i].size()));
+    auto const compressed_size =
+        ZSTD_compress(compressed.data(), compressed.size(), sources[i].data(),
+                      sources[i].size(), 1);
+    ASSERT_FALSE(ZSTD_isError(compressed_size));
+    d_src.emplace_back(compressed.data(), compressed_size);
+    d_dst.emplace_back(sources[i].size());
+    h_args[i].srcDevice = static_cast<const uint8_t*>(d_src[i].data());
+    h_args[i].srcSize = compressed_size;
+    h_args[i].dstDevice = static_cast<uint8_t*>(d_dst[i].data());
+    h_args[i].dstSize = sources[i].size();
+  }
+
+  rmm::device_buffer d_args(h_args.data(),
+                            count * sizeof(cudf::io::gpu_inflate_input_s));
+  rmm::device_buffer d_stat(count * sizeof(cudf::io::gpu_inflate_status_s));
+  ASSERT_CUDA_SUCCEEDED(cudf::io::gpu_unzstd(
+      static_cast<cudf::io::gpu_inflate_input_s*>(d_args.data()),
+      static_cast<cudf::io::gpu_inflate_status_s*>(d_stat.data()), count, 0));
+
+  std::vector<cudf::io::gpu_inflate_status_s> h_stat(count);
+  ASSERT_CUDA_SUCCEEDED(
+      cudaMemcpy(h_stat.data(), d_stat.data(),
+                 count * sizeof(cudf::io::gpu_inflate_status_s),
+                 cudaMemcpyDeviceToHost));
+  for (int i = 0; i < count; i++) {
+    EXPECT_EQ(h_stat[i].status, 0);
+    EXPECT_EQ(h_stat[i].bytes_written, sources[i].size());
+    std::vector<uint8_t> output(sources[i].size());
+    ASSERT_CUDA_SUCCEEDED(cudaMemcpy(output.data(), d_dst[i].data(),
+                                     output.size(), cudaMemcpyDeviceToHost));
+    EXPECT_EQ(output, sources[i]);
+  }
+}
+#endif  // CUDF_ZSTD
@@ -944,3 +944,125 @@ TEST_F(ParquetWriterStressTest, DeviceWriteLargeTableWithValids)
   auto custom_tbl = cudf_io::read_parquet(custom_args);
   expect_tables_equal(custom_tbl.tbl->view(), expected->view()); 
 }
+
+// Base test fixture for chunked reader tests
+struct ParquetChunkedReaderTest : public cudf::test::BaseFixture {};
+
+namespace {
+
+// Reads a file chunk-by-chunk and returns the reassembled table
+std::unique_ptr<table> read_all_chunks(std::string const& filepath,
+                                       cudf::size_type chunk_rows) {
+  cudf_io::read_parquet_chunked_args args{cudf_io::source_info{filepath}};
+  args.chunk_rows = chunk_rows;
+  auto state = cudf_io::read_parquet_chunked_begin(args);
+  std::vector<std::unique_ptr<table>> chunks;
+  std::vector<table_view> chunk_views;
+  while (cudf_io::read_parquet_chunked_has_next(state)) {
+    auto chunk = cudf_io::read_parquet_chunked(state);
+    EXPECT_LE(chunk.tbl->num_rows(), chunk_rows);
+    if (chunk.tbl->num_rows() > 0) {
+      chunk_views.push_back(chunk.tbl->view());
+      chunks.push_back(std::move(chunk.tbl));
+    }
+  }
+  cudf_io::read_parquet_chunked_end(state);
+  EXPECT_EQ(state, nullptr);
+  return cudf::experimental::concatenate(chunk_views);
+}
+
+}  // namespace
+
+TEST_F(ParquetChunkedReaderTest, SingleChunk)
+{
+  srand(31337);
+  auto expected = create_random_fixed_table<int>(5, 100, true);
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedReadSingle.parquet");
+  cudf_io::write_parquet_args args{cudf_io::sink_info{filepath}, *expected};
+  cudf_io::write_parquet(args);
+
+  // budget larger than the file: everything arrives in the first chunk
+  auto result = read_all_chunks(filepath, 1000);
+  expect_tables_equal(*result, *expected);
+}
+
+TEST_F(ParquetChunkedReaderTest, UnevenChunks)
+{
+  srand(31337);
+  auto expected = create_random_fixed_table<int>(5, 100, true);
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedReadUneven.parquet");
+  cudf_io::write_parquet_args args{cudf_io::sink_info{filepath}, *expected};
+  cudf_io::write_parquet(args);
+
+  // 100 rows in chunks of 30: the final chunk carries the 10-row remainder
+  auto result = read_all_chunks(filepath, 30);
+  expect_tables_equal(*result, *expected);
+}
+
+TEST_F(ParquetChunkedReaderTest, ExactMultiple)
+{
+  srand(31337);
+  auto expected = create_random_fixed_table<int>(5, 100, true);
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedReadExact.parquet");
+  cudf_io::write_parquet_args args{cudf_io::sink_info{filepath}, *expected};
+  cudf_io::write_parquet(args);
+
+  // budget divides the row count evenly; no short chunk marks the end
+  auto result = read_all_chunks(filepath, 25);
+  expect_tables_equal(*result, *expected);
+}
+
+TEST_F(ParquetChunkedReaderTest, CrossesRowGroups)
+{
+  srand(31337);
+  auto table1 = create_random_fixed_table<int>(4, 4096, true);
+  auto table2 = create_random_fixed_table<int>(4, 8192, true);
+
+  auto full_table = cudf::experimental::concatenate({*table1, *table2});
+
+  // two chunked writes produce two row groups; chunk boundaries land inside
+  // and across them
+  auto filepath = temp_env->get_temp_filepath("ChunkedReadRowGroups.parquet");
+  cudf_io::write_parquet_chunked_args args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_parquet_chunked_begin(args);
+  cudf_io::write_parquet_chunked(*table1, state);
+  cudf_io::write_parquet_chunked(*table2, state);
+  cudf_io::write_parquet_chunked_end(state);
+
+  auto result = read_all_chunks(filepath, 5000);
+  expect_tables_equal(*result, *full_table);
+}
+
+TEST_F(ParquetChunkedReaderTest, Strings)
+{
+  std::vector<std::unique_ptr<cudf::column>> cols;
+  bool mask[] = { 1, 1, 0, 1, 1, 1, 1 };
+  std::vector<const char*> h_strings { "four", "score", "and", "seven", "years", "ago", "abcdefgh" };
+  cudf::test::strings_column_wrapper strings( h_strings.begin(), h_strings.end(), mask );
+  cols.push_back(strings.release());
+  cudf::experimental::table expected(std::move(cols));
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedReadStrings.parquet");
+  cudf_io::write_parquet_args args{cudf_io::sink_info{filepath}, expected};
+  cudf_io::write_parquet(args);
+
+  auto result = read_all_chunks(filepath, 3);
+  expect_tables_equal(*result, expected);
+}
+
+TEST_F(ParquetChunkedReaderTest, InvalidChunkRows)
+{
+  srand(31337);
+  auto expected = create_random_fixed_table<int>(1, 10, false);
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedReadInvalid.parquet");
+  cudf_io::write_parquet_args args{cudf_io::sink_info{filepath}, *expected};
+  cudf_io::write_parquet(args);
+
+  cudf_io::read_parquet_chunked_args read_args{cudf_io::source_info{filepath}};
+  read_args.chunk_rows = 0;
+  EXPECT_THROW(cudf_io::read_parquet_chunked_begin(read_args), cudf::logic_error);
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/io/spill.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace cudf {
+namespace test {
+
+namespace exp_io = cudf::experimental::io;
+
+struct SpillTest : public BaseFixture {};
+
+TEST_F(SpillTest, FixedWidthRoundTrip)
+{
+  fixed_width_column_wrapper<int32_t> col1{{1, 2, 3, 4, 5}, {1, 1, 0, 1, 1}};
+  fixed_width_column_wrapper<double> col2{{0.5, 1.5, 2.5, 3.5, 4.5}};
+  table_view input{{col1, col2}};
+
+  auto blob = exp_io::spill(input);
+  EXPECT_GT(blob.uncompressed_size, 0u);
+  EXPECT_EQ(blob.chunk_sizes.size(), blob.chunk_is_raw.size());
+
+  auto restored = exp_io::restore(blob);
+  expect_tables_equal(input, restored.table);
+}
+
+TEST_F(SpillTest, StringsRoundTrip)
+{
+  strings_column_wrapper col({"four", "score", "and", "seven", "years"},
+                             {1, 1, 0, 1, 1});
+  table_view input{{col}};
+
+  auto blob = exp_io::spill(input);
+  auto restored = exp_io::restore(blob);
+  expect_tables_equal(input, restored.table);
+}
+
+TEST_F(SpillTest, SlicedInputRoundTrip)
+{
+  fixed_width_column_wrapper<int32_t> col{{0, 1, 2, 3, 4, 5, 6, 7},
+                                          {1, 0, 1, 1, 1, 0, 1, 1}};
+  auto sliced = cudf::experimental::slice(col, {2, 6}).front();
+  table_view input{{sliced}};
+
+  auto blob = exp_io::spill(input);
+  auto restored = exp_io::restore(blob);
+  expect_tables_equal(input, restored.table);
+}
+
+TEST_F(SpillTest, CompressibleMultiChunkRoundTrip)
+{
+  // > 256KB of repetitive data spans multiple chunks that Snappy shrinks
+  constexpr size_type num_rows = 300000;  // 1.2MB of int32
+  std::vector<int32_t> h_values(num_rows);
+  for (size_type i = 0; i < num_rows; i++) { h_values[i] = i % 4; }
+  fixed_width_column_wrapper<int32_t> col(h_values.begin(), h_values.end());
+  table_view input{{col}};
+
+  auto blob = exp_io::spill(input);
+  EXPECT_GT(blob.chunk_sizes.size(), 1u);
+  EXPECT_TRUE(std::any_of(blob.chunk_is_raw.begin(), blob.chunk_is_raw.end(),
+                          [](uint8_t raw) { return raw == 0; }));
+  // the compressed payload is smaller than the packed table
+  EXPECT_LT(blob.size_bytes(), blob.uncompressed_size);
+
+  auto restored = exp_io::restore(blob);
+  expect_tables_equal(input, restored.table);
+}
+
+TEST_F(SpillTest, IncompressibleRoundTrip)
+{
+  // pseudorandom data defeats compression, exercising the raw-chunk path
+  constexpr size_type num_rows = 100000;
+  std::vector<int32_t> h_values(num_rows);
+  uint32_t state = 123456789;
+  for (size_type i = 0; i < num_rows; i++) {
+    state = state * 1103515245 + 12345;
+    h_values[i] = static_cast<int32_t>(state);
+  }
+  fixed_width_column_wrapper<int32_t> col(h_values.begin(), h_values.end());
+  table_view input{{col}};
+
+  auto blob = exp_io::spill(input);
+  auto restored = exp_io::restore(blob);
+  expect_tables_equal(input, restored.table);
+}
+
+TEST_F(SpillTest, EmptyTable)
+{
+  fixed_width_column_wrapper<int32_t> col{};
+  table_view input{{col}};
+
+  auto blob = exp_io::spill(input);
+  auto restored = exp_io::restore(blob);
+  EXPECT_EQ(input.num_columns(), restored.table.num_columns());
+  EXPECT_EQ(0, restored.table.num_rows());
+}
+
+TEST_F(SpillTest, CorruptPayloadThrows)
+{
+  constexpr size_type num_rows = 300000;
+  std::vector<int32_t> h_values(num_rows, 7);
+  fixed_width_column_wrapper<int32_t> col(h_values.begin(), h_values.end());
+  table_view input{{col}};
+
+  auto blob = exp_io::spill(input);
+  ASSERT_FALSE(blob.chunk_is_raw.empty());
+  ASSERT_EQ(0, blob.chunk_is_raw.front());  // constant data must compress
+
+  // invert the first compressed chunk so decompression fails
+  for (size_t i = 0; i < blob.chunk_sizes.front(); i++) {
+    blob.host_data.data()[i] = ~blob.host_data.data()[i];
+  }
+  EXPECT_THROW(exp_io::restore(blob), cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
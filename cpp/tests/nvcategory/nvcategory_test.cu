@@ -379,6 +379,59 @@ TEST_F(NVCategoryConcatTest, concat_test){
 	}
 }
 
+TEST_F(NVCategoryConcatTest, concat_subsumed_keys_test){
+
+	// every key of the second column already exists in the first, so the
+	// concat takes the merge_category fast path and the combined keyset
+	// must stay identical to the first column's
+	const char * first_strings[] = {"aa","bb","cc","dd","bb","aa"};
+	const char * second_strings[] = {"bb","cc","cc","bb"};
+
+	concat_columns.resize(2);
+	concat_columns[0] = cudf::test::create_nv_category_column_strings(first_strings, 6);
+	concat_columns[1] = cudf::test::create_nv_category_column_strings(second_strings, 4);
+
+	std::vector<std::string> reference_result(first_strings, first_strings + 6);
+	reference_result.insert(reference_result.end(), second_strings, second_strings + 4);
+
+	std::vector<std::string> gdf_result = this->compute_gdf_result();
+
+	ASSERT_EQ(reference_result.size(), gdf_result.size());
+	for(size_t i = 0; i < reference_result.size(); ++i){
+		EXPECT_EQ(reference_result[i], gdf_result[i]);
+	}
+
+	NVCategory * first_category = static_cast<NVCategory *>(concat_columns[0]->dtype_info.category);
+	NVCategory * out_category = static_cast<NVCategory *>(concat_out->dtype_info.category);
+	EXPECT_EQ(first_category->keys_size(), out_category->keys_size());
+}
+
+TEST_F(NVCategoryConcatTest, concat_new_keys_fallback_test){
+
+	// the second column's keyset is smaller than the first's but brings a
+	// new key, so the merge attempt must be discarded and the rebuilt
+	// keyset contains the union
+	const char * first_strings[] = {"aa","bb","cc","aa"};
+	const char * second_strings[] = {"zz","aa"};
+
+	concat_columns.resize(2);
+	concat_columns[0] = cudf::test::create_nv_category_column_strings(first_strings, 4);
+	concat_columns[1] = cudf::test::create_nv_category_column_strings(second_strings, 2);
+
+	std::vector<std::string> reference_result(first_strings, first_strings + 4);
+	reference_result.insert(reference_result.end(), second_strings, second_strings + 2);
+
+	std::vector<std::string> gdf_result = this->compute_gdf_result();
+
+	ASSERT_EQ(reference_result.size(), gdf_result.size());
+	for(size_t i = 0; i < reference_result.size(); ++i){
+		EXPECT_EQ(reference_result[i], gdf_result[i]);
+	}
+
+	NVCategory * out_category = static_cast<NVCategory *>(concat_out->dtype_info.category);
+	EXPECT_EQ(4, out_category->keys_size()); // aa, bb, cc, zz
+}
+
 // Selects the kind of join operation that is performed
 enum struct join_op
 {
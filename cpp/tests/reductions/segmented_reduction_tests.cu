@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/types.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <vector>
+
+namespace cudf {
+namespace test {
+
+template <typename T>
+struct SegmentedReduction : public BaseFixture {};
+
+using SegmentedReductionTypes =
+    cudf::test::Types<int8_t, int16_t, int32_t, int64_t, float, double>;
+TYPED_TEST_CASE(SegmentedReduction, SegmentedReductionTypes);
+
+TYPED_TEST(SegmentedReduction, Sum)
+{
+    using T = TypeParam;
+
+    fixed_width_column_wrapper<T> values{{1, 2, 3, 4, 5, 6, 7, 8, 9}};
+    fixed_width_column_wrapper<int32_t> offsets{{0, 3, 5, 9}};
+
+    fixed_width_column_wrapper<int64_t> expected{{6, 9, 30}};
+
+    auto result = experimental::segmented_reduce(
+        values, offsets, experimental::make_sum_aggregation(),
+        data_type{INT64});
+    expect_columns_equal(expected, result->view());
+}
+
+TYPED_TEST(SegmentedReduction, Min)
+{
+    using T = TypeParam;
+
+    fixed_width_column_wrapper<T> values{{9, 7, 8, 2, 1, 5, 3, 4}};
+    fixed_width_column_wrapper<int32_t> offsets{{0, 3, 5, 8}};
+
+    fixed_width_column_wrapper<T> expected{{7, 1, 3}};
+
+    auto result = experimental::segmented_reduce(
+        values, offsets, experimental::make_min_aggregation(),
+        data_type{experimental::type_to_id<T>()});
+    expect_columns_equal(expected, result->view());
+}
+
+TYPED_TEST(SegmentedReduction, Max)
+{
+    using T = TypeParam;
+
+    fixed_width_column_wrapper<T> values{{9, 7, 8, 2, 1, 5, 3, 4}};
+    fixed_width_column_wrapper<int32_t> offsets{{0, 3, 5, 8}};
+
+    fixed_width_column_wrapper<T> expected{{9, 2, 5}};
+
+    auto result = experimental::segmented_reduce(
+        values, offsets, experimental::make_max_aggregation(),
+        data_type{experimental::type_to_id<T>()});
+    expect_columns_equal(expected, result->view());
+}
+
+TYPED_TEST(SegmentedReduction, Product)
+{
+    using T = TypeParam;
+
+    fixed_width_column_wrapper<T> values{{1, 2, 3, 4, 5}};
+    fixed_width_column_wrapper<int32_t> offsets{{0, 3, 5}};
+
+    fixed_width_column_wrapper<double> expected{{6.0, 20.0}};
+
+    auto result = experimental::segmented_reduce(
+        values, offsets, experimental::make_product_aggregation(),
+        data_type{FLOAT64});
+    expect_columns_equal(expected, result->view());
+}
+
+TYPED_TEST(SegmentedReduction, SumOfSquares)
+{
+    using T = TypeParam;
+
+    fixed_width_column_wrapper<T> values{{1, 2, 3, 4}};
+    fixed_width_column_wrapper<int32_t> offsets{{0, 2, 4}};
+
+    fixed_width_column_wrapper<int64_t> expected{{5, 25}};
+
+    auto result = experimental::segmented_reduce(
+        values, offsets, experimental::make_sum_of_squares_aggregation(),
+        data_type{INT64});
+    expect_columns_equal(expected, result->view());
+}
+
+struct SegmentedReductionUntyped : public BaseFixture {};
+
+TEST_F(SegmentedReductionUntyped, EmptySegmentIsNull)
+{
+    fixed_width_column_wrapper<int32_t> values{{1, 2, 3, 4, 5}};
+    fixed_width_column_wrapper<int32_t> offsets{{0, 3, 3, 5}};
+
+    // the middle segment covers no rows, so its result row is null
+    fixed_width_column_wrapper<int64_t> expected{{6, 0, 9}, {1, 0, 1}};
+
+    auto result = experimental::segmented_reduce(
+        values, offsets, experimental::make_sum_aggregation(),
+        data_type{INT64});
+    expect_columns_equal(expected, result->view());
+}
+
+TEST_F(SegmentedReductionUntyped, NullsSkipped)
+{
+    fixed_width_column_wrapper<int32_t> values{{1, 2, 3, 4, 5, 6},
+                                               {1, 0, 1, 0, 0, 1}};
+    fixed_width_column_wrapper<int32_t> offsets{{0, 3, 5, 6}};
+
+    // nulls are skipped; a segment of only nulls produces a null row
+    fixed_width_column_wrapper<int64_t> expected{{4, 0, 6}, {1, 0, 1}};
+
+    auto result = experimental::segmented_reduce(
+        values, offsets, experimental::make_sum_aggregation(),
+        data_type{INT64});
+    expect_columns_equal(expected, result->view());
+}
+
+TEST_F(SegmentedReductionUntyped, SingleSegmentMatchesReduce)
+{
+    fixed_width_column_wrapper<int32_t> values{{5, 1, 4, 2, 3}};
+    fixed_width_column_wrapper<int32_t> offsets{{0, 5}};
+
+    fixed_width_column_wrapper<int64_t> expected{{15}};
+
+    auto result = experimental::segmented_reduce(
+        values, offsets, experimental::make_sum_aggregation(),
+        data_type{INT64});
+    expect_columns_equal(expected, result->view());
+}
+
+TEST_F(SegmentedReductionUntyped, InvalidOffsetsThrow)
+{
+    fixed_width_column_wrapper<int32_t> values{{1, 2, 3}};
+
+    fixed_width_column_wrapper<double> float_offsets{{0.0, 3.0}};
+    EXPECT_THROW(experimental::segmented_reduce(
+                     values, float_offsets,
+                     experimental::make_sum_aggregation(), data_type{INT64}),
+                 cudf::logic_error);
+
+    fixed_width_column_wrapper<int32_t> empty_offsets{};
+    EXPECT_THROW(experimental::segmented_reduce(
+                     values, empty_offsets,
+                     experimental::make_sum_aggregation(), data_type{INT64}),
+                 cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
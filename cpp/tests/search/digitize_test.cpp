@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include "cudf/search.hpp"
+#include "cudf/unary.hpp"
+
+struct DigitizeTest : public cudf::test::BaseFixture {};
+
+using cudf::test::fixed_width_column_wrapper;
+using cudf::test::expect_columns_equal;
+
+TEST_F(DigitizeTest, basic_buckets)
+{
+  fixed_width_column_wrapper<int32_t>  input     {  3, 15, 20, 31, 50 };
+  fixed_width_column_wrapper<int32_t>  bin_edges { 10, 20, 30 };
+  fixed_width_column_wrapper<int16_t>  expect    {  0,  1,  2,  3,  3 };
+
+  auto result = cudf::experimental::digitize(input, bin_edges);
+
+  expect_columns_equal(expect, result->view());
+}
+
+TEST_F(DigitizeTest, matches_upper_bound)
+{
+  fixed_width_column_wrapper<double>  input     { -5.0, 0.0, 0.5, 1.0, 2.5, 9.9, 10.0 };
+  fixed_width_column_wrapper<double>  bin_edges {  0.0, 1.0, 2.0, 10.0 };
+
+  auto labels = cudf::experimental::digitize(input, bin_edges);
+
+  auto bounds = cudf::experimental::upper_bound(
+      {cudf::table_view{{bin_edges}}},
+      {cudf::table_view{{input}}},
+      {cudf::order::ASCENDING},
+      {cudf::null_order::BEFORE});
+
+  auto casted = cudf::experimental::cast(bounds->view(),
+                                         cudf::data_type{cudf::INT16});
+  expect_columns_equal(casted->view(), labels->view());
+}
+
+TEST_F(DigitizeTest, null_in_null_out)
+{
+  fixed_width_column_wrapper<int32_t>  input     {{ 3, 15, 20, 31 }, { 1, 0, 1, 0 }};
+  fixed_width_column_wrapper<int32_t>  bin_edges { 10, 20, 30 };
+  fixed_width_column_wrapper<int16_t>  expect    {{ 0,  0,  2,  0 }, { 1, 0, 1, 0 }};
+
+  auto result = cudf::experimental::digitize(input, bin_edges);
+
+  expect_columns_equal(expect, result->view());
+}
+
+TEST_F(DigitizeTest, empty_input)
+{
+  fixed_width_column_wrapper<int32_t>  input     {};
+  fixed_width_column_wrapper<int32_t>  bin_edges { 10, 20, 30 };
+  fixed_width_column_wrapper<int16_t>  expect    {};
+
+  auto result = cudf::experimental::digitize(input, bin_edges);
+
+  expect_columns_equal(expect, result->view());
+}
+
+TEST_F(DigitizeTest, invalid_inputs_throw)
+{
+  fixed_width_column_wrapper<int32_t>  input       { 1, 2, 3 };
+  fixed_width_column_wrapper<double>   wrong_type  { 1.0, 2.0 };
+  EXPECT_THROW(cudf::experimental::digitize(input, wrong_type),
+               cudf::logic_error);
+
+  fixed_width_column_wrapper<int32_t>  null_edges  {{ 1, 2 }, { 1, 0 }};
+  EXPECT_THROW(cudf::experimental::digitize(input, null_edges),
+               cudf::logic_error);
+}
+
+TEST_F(DigitizeTest, batched_matches_single)
+{
+  fixed_width_column_wrapper<int32_t>  input1     {  3, 15, 20, 31, 50 };
+  fixed_width_column_wrapper<int32_t>  edges1     { 10, 20, 30 };
+  fixed_width_column_wrapper<double>   input2     { -1.0, 0.5, 7.0 };
+  fixed_width_column_wrapper<double>   edges2     {  0.0, 5.0 };
+
+  auto batched = cudf::experimental::batched_digitize({input1, input2},
+                                                      {edges1, edges2});
+  ASSERT_EQ(2u, batched.size());
+
+  auto single1 = cudf::experimental::digitize(input1, edges1);
+  auto single2 = cudf::experimental::digitize(input2, edges2);
+
+  expect_columns_equal(single1->view(), batched[0]->view());
+  expect_columns_equal(single2->view(), batched[1]->view());
+}
+
+TEST_F(DigitizeTest, batched_size_mismatch_throws)
+{
+  fixed_width_column_wrapper<int32_t>  input { 1, 2, 3 };
+  fixed_width_column_wrapper<int32_t>  edges { 2 };
+
+  EXPECT_THROW(
+      cudf::experimental::batched_digitize({input, input}, {edges}),
+      cudf::logic_error);
+}
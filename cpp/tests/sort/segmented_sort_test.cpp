@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <vector>
+
+namespace cudf {
+namespace test {
+
+template <typename T>
+struct SegmentedSort : public BaseFixture {};
+
+TYPED_TEST_CASE(SegmentedSort, NumericTypes);
+
+TYPED_TEST(SegmentedSort, Basic)
+{
+    using T = TypeParam;
+
+    // rows stay inside their segment: a global sort would interleave them
+    fixed_width_column_wrapper<T> col{{9, 7, 8, 2, 1, 5, 3, 4}};
+    fixed_width_column_wrapper<int32_t> offsets{{0, 3, 5, 8}};
+
+    fixed_width_column_wrapper<T> expected{{7, 8, 9, 1, 2, 3, 4, 5}};
+
+    auto result = experimental::segmented_sort(table_view{{col}}, offsets);
+    expect_tables_equal(table_view{{expected}}, result->view());
+}
+
+TYPED_TEST(SegmentedSort, SortedOrderMatchesSort)
+{
+    using T = TypeParam;
+
+    fixed_width_column_wrapper<T> col{{9, 7, 8, 2, 1, 5, 3, 4}};
+    fixed_width_column_wrapper<int32_t> offsets{{0, 3, 5, 8}};
+
+    auto order = experimental::segmented_sorted_order(table_view{{col}}, offsets);
+    auto gathered = experimental::gather(table_view{{col}}, order->view());
+    auto sorted = experimental::segmented_sort(table_view{{col}}, offsets);
+    expect_tables_equal(sorted->view(), gathered->view());
+}
+
+TYPED_TEST(SegmentedSort, Descending)
+{
+    using T = TypeParam;
+
+    fixed_width_column_wrapper<T> col{{7, 9, 8, 1, 2, 4, 3, 5}};
+    fixed_width_column_wrapper<int32_t> offsets{{0, 3, 5, 8}};
+
+    fixed_width_column_wrapper<T> expected{{9, 8, 7, 2, 1, 5, 4, 3}};
+
+    auto result = experimental::segmented_sort(table_view{{col}}, offsets,
+                                               {order::DESCENDING});
+    expect_tables_equal(table_view{{expected}}, result->view());
+}
+
+TYPED_TEST(SegmentedSort, SingleSegmentMatchesFullSort)
+{
+    using T = TypeParam;
+
+    fixed_width_column_wrapper<T> col{{5, 1, 4, 2, 3}};
+    fixed_width_column_wrapper<int32_t> offsets{{0, 5}};
+
+    auto segmented = experimental::segmented_sort(table_view{{col}}, offsets);
+    auto full = experimental::sort(table_view{{col}});
+    expect_tables_equal(full->view(), segmented->view());
+}
+
+struct SegmentedSortUntyped : public BaseFixture {};
+
+TEST_F(SegmentedSortUntyped, SortByKey)
+{
+    fixed_width_column_wrapper<int32_t> keys{{3, 1, 2, 5, 4}};
+    fixed_width_column_wrapper<int32_t> vals{{30, 10, 20, 50, 40}};
+    fixed_width_column_wrapper<int32_t> offsets{{0, 3, 5}};
+
+    fixed_width_column_wrapper<int32_t> expected{{10, 20, 30, 40, 50}};
+
+    auto result = experimental::segmented_sort_by_key(
+        table_view{{vals}}, table_view{{keys}}, offsets);
+    expect_tables_equal(table_view{{expected}}, result->view());
+}
+
+TEST_F(SegmentedSortUntyped, WithNulls)
+{
+    fixed_width_column_wrapper<int32_t> col{{9, 7, 8, 2, 1, 5},
+                                            {1, 0, 1, 1, 0, 1}};
+    fixed_width_column_wrapper<int32_t> offsets{{0, 3, 6}};
+
+    // default null precedence sorts nulls before other elements
+    fixed_width_column_wrapper<int32_t> expected{{7, 8, 9, 1, 2, 5},
+                                                 {0, 1, 1, 0, 1, 1}};
+
+    auto result = experimental::segmented_sort(table_view{{col}}, offsets);
+    expect_tables_equal(table_view{{expected}}, result->view());
+}
+
+TEST_F(SegmentedSortUntyped, InvalidOffsetType)
+{
+    fixed_width_column_wrapper<int32_t> col{{3, 1, 2}};
+    fixed_width_column_wrapper<double> offsets{{0.0, 3.0}};
+
+    EXPECT_THROW(experimental::segmented_sort(table_view{{col}}, offsets),
+                 cudf::logic_error);
+}
+
+TEST_F(SegmentedSortUntyped, EmptyInput)
+{
+    fixed_width_column_wrapper<int32_t> col{};
+    fixed_width_column_wrapper<int32_t> offsets{};
+
+    auto order = experimental::segmented_sorted_order(table_view{{col}}, offsets);
+    EXPECT_EQ(0, order->size());
+}
+
+}  // namespace test
+}  // namespace cudf
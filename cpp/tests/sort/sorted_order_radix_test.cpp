@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <cmath>
+#include <vector>
+
+namespace cudf {
+namespace test {
+
+// A single non-nullable primitive key column takes the thrust radix fast
+// path in sorted_order. These tests assert the permutation it produces is
+// identical to the generic row-comparator path, which is forced by
+// appending a constant tie column so the table is no longer single-column.
+namespace {
+
+std::unique_ptr<column> generic_stable_sorted_order(column_view const& keys,
+                                                    order ord) {
+  std::vector<int32_t> zeros(keys.size(), 0);
+  fixed_width_column_wrapper<int32_t> ties(zeros.begin(), zeros.end());
+  return experimental::stable_sorted_order(table_view{{keys, ties}},
+                                           {ord, order::ASCENDING});
+}
+
+}  // namespace
+
+template <typename T>
+struct SortedOrderRadix : public BaseFixture {};
+
+TYPED_TEST_CASE(SortedOrderRadix, NumericTypes);
+
+TYPED_TEST(SortedOrderRadix, StableWithDuplicates)
+{
+    using T = TypeParam;
+
+    // duplicates force ties; stability requires original order within them
+    fixed_width_column_wrapper<T> keys{{5, 1, 4, 1, 5, 0, 4, 5, 1, 0}};
+
+    auto fast = experimental::stable_sorted_order(table_view{{keys}},
+                                                  {order::ASCENDING});
+    auto generic = generic_stable_sorted_order(keys, order::ASCENDING);
+    expect_columns_equal(generic->view(), fast->view());
+}
+
+TYPED_TEST(SortedOrderRadix, StableDescending)
+{
+    using T = TypeParam;
+
+    fixed_width_column_wrapper<T> keys{{5, 1, 4, 1, 5, 0, 4, 5, 1, 0}};
+
+    auto fast = experimental::stable_sorted_order(table_view{{keys}},
+                                                  {order::DESCENDING});
+    auto generic = generic_stable_sorted_order(keys, order::DESCENDING);
+    expect_columns_equal(generic->view(), fast->view());
+}
+
+TYPED_TEST(SortedOrderRadix, EmptyColumnOrder)
+{
+    using T = TypeParam;
+
+    fixed_width_column_wrapper<T> keys{{3, 1, 2, 1, 3}};
+
+    // no column_order means ascending; must match the explicit form
+    auto defaulted = experimental::stable_sorted_order(table_view{{keys}}, {});
+    auto explicit_asc = experimental::stable_sorted_order(table_view{{keys}},
+                                                          {order::ASCENDING});
+    expect_columns_equal(explicit_asc->view(), defaulted->view());
+}
+
+TYPED_TEST(SortedOrderRadix, UnstableSortsValues)
+{
+    using T = TypeParam;
+
+    fixed_width_column_wrapper<T> keys{{5, 1, 4, 1, 5, 0, 4, 5, 1, 0}};
+
+    // unstable permutations may differ within ties, but the gathered keys
+    // must agree with the generic path's
+    auto fast = experimental::sort(table_view{{keys}}, {order::ASCENDING});
+    auto generic = experimental::gather(
+        table_view{{keys}},
+        generic_stable_sorted_order(keys, order::ASCENDING)->view());
+    expect_tables_equal(generic->view(), fast->view());
+}
+
+template <typename T>
+struct SortedOrderRadixFloat : public BaseFixture {};
+
+TYPED_TEST_CASE(SortedOrderRadixFloat, FloatingPointTypes);
+
+TYPED_TEST(SortedOrderRadixFloat, NaNOrdering)
+{
+    using T = TypeParam;
+    auto const nan = std::numeric_limits<T>::quiet_NaN();
+    auto const inf = std::numeric_limits<T>::infinity();
+
+    // the comparator path orders [-inf, -1, 0, 1, inf, nan, nan]; the radix
+    // path must agree for both directions, including tie-broken NaN slots
+    fixed_width_column_wrapper<T> keys{
+        {nan, T(1), -inf, nan, T(-1), inf, T(0)}};
+
+    auto fast_asc = experimental::stable_sorted_order(table_view{{keys}},
+                                                      {order::ASCENDING});
+    auto generic_asc = generic_stable_sorted_order(keys, order::ASCENDING);
+    expect_columns_equal(generic_asc->view(), fast_asc->view());
+
+    auto fast_desc = experimental::stable_sorted_order(table_view{{keys}},
+                                                       {order::DESCENDING});
+    auto generic_desc = generic_stable_sorted_order(keys, order::DESCENDING);
+    expect_columns_equal(generic_desc->view(), fast_desc->view());
+}
+
+}  // namespace test
+}  // namespace cudf
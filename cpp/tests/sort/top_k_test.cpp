@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace cudf {
+namespace test {
+
+namespace {
+
+// top_k must equal a full sort truncated to k rows; keys are kept distinct
+// in these tests since the order of equal rows is unspecified
+void expect_top_k(table_view const& input, size_type k,
+                  std::vector<order> const& column_order = {},
+                  std::vector<null_order> const& null_precedence = {}) {
+  auto result = experimental::top_k(input, k, column_order, null_precedence);
+  auto sorted = experimental::sort(input, column_order, null_precedence);
+  auto expected = experimental::slice(
+      sorted->view(), {0, std::min(k, input.num_rows())}).front();
+  expect_tables_equal(expected, result->view());
+}
+
+}  // namespace
+
+template <typename T>
+struct TopK : public BaseFixture {};
+
+using TopKTypes = cudf::test::Types<int8_t, int32_t, int64_t, float, double>;
+TYPED_TEST_CASE(TopK, TopKTypes);
+
+TYPED_TEST(TopK, SmallestK)
+{
+    using T = TypeParam;
+
+    fixed_width_column_wrapper<T> col{{9, 2, 7, 0, 4, 8, 1, 6, 3, 5}};
+
+    expect_top_k(table_view{{col}}, 4);
+}
+
+TYPED_TEST(TopK, LargestK)
+{
+    using T = TypeParam;
+
+    fixed_width_column_wrapper<T> col{{9, 2, 7, 0, 4, 8, 1, 6, 3, 5}};
+
+    expect_top_k(table_view{{col}}, 3, {order::DESCENDING});
+}
+
+TYPED_TEST(TopK, KExceedsRows)
+{
+    using T = TypeParam;
+
+    fixed_width_column_wrapper<T> col{{3, 1, 2}};
+
+    // oversize k returns the whole table fully sorted
+    auto result = experimental::top_k(table_view{{col}}, 10);
+    auto expected = experimental::sort(table_view{{col}});
+    expect_tables_equal(expected->view(), result->view());
+}
+
+struct TopKUntyped : public BaseFixture {};
+
+TEST_F(TopKUntyped, MultiColumn)
+{
+    fixed_width_column_wrapper<int32_t> col1{{2, 1, 2, 1, 2}};
+    strings_column_wrapper col2{"e", "b", "d", "a", "c"};
+
+    expect_top_k(table_view{{col1, col2}}, 3,
+                 {order::ASCENDING, order::ASCENDING});
+}
+
+TEST_F(TopKUntyped, WithNulls)
+{
+    fixed_width_column_wrapper<int32_t> col{{9, 2, 7, 0, 4}, {1, 0, 1, 1, 0}};
+
+    expect_top_k(table_view{{col}}, 3, {}, {null_order::AFTER});
+}
+
+TEST_F(TopKUntyped, ZeroK)
+{
+    fixed_width_column_wrapper<int32_t> col{{3, 1, 2}};
+
+    auto result = experimental::top_k(table_view{{col}}, 0);
+    EXPECT_EQ(0, result->num_rows());
+    EXPECT_EQ(1, result->num_columns());
+}
+
+TEST_F(TopKUntyped, NegativeKThrows)
+{
+    fixed_width_column_wrapper<int32_t> col{{3, 1, 2}};
+
+    EXPECT_THROW(experimental::top_k(table_view{{col}}, -1), cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
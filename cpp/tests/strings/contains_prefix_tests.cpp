@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/strings/contains.hpp>
+#include <strings/regex/regcomp.h>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/column_utilities.hpp>
+
+#include <vector>
+
+
+// tests for the literal-prefix prescan used by the regex fast-start path
+struct StringsContainsPrefixTests : public cudf::test::BaseFixture {};
+
+TEST_F(StringsContainsPrefixTests, PrefixExtraction)
+{
+    using cudf::strings::detail::reprog;
+
+    // the quantifier makes the third character optional
+    EXPECT_EQ(std::u32string(U"ab"), reprog::create_from(U"abc*").prefix());
+    // fully literal pattern
+    EXPECT_EQ(std::u32string(U"aab"), reprog::create_from(U"aab").prefix());
+    // a leading alternation has no single required prefix
+    EXPECT_TRUE(reprog::create_from(U"ab|cd").prefix().empty());
+    // an anchor is not a literal character
+    EXPECT_TRUE(reprog::create_from(U"^abc").prefix().empty());
+    // classes end the prefix
+    EXPECT_EQ(std::u32string(U"ab"), reprog::create_from(U"ab[cd]").prefix());
+    // multi-byte UTF-8 characters are single prefix entries
+    EXPECT_EQ(std::u32string(U"éé"), reprog::create_from(U"ééx*").prefix());
+}
+
+TEST_F(StringsContainsPrefixTests, OptionalTrailingCharacter)
+{
+    // abc* must match "ab" even though scanning stops after the "ab" prefix
+    cudf::test::strings_column_wrapper strings({"ab", "abc", "abcc", "a", "xxabyy", "aB"});
+    auto strings_view = cudf::strings_column_view(strings);
+
+    auto results = cudf::strings::contains_re(strings_view, "abc*");
+    cudf::test::fixed_width_column_wrapper<cudf::experimental::bool8> expected(
+        {true, true, true, false, true, false});
+    cudf::test::expect_columns_equal(*results, expected);
+}
+
+TEST_F(StringsContainsPrefixTests, OverlappingCandidates)
+{
+    // the first candidate position for "aab" in "aaab" fails one character
+    // in; the scan must resume one character later, not after the candidate
+    cudf::test::strings_column_wrapper strings({"aaab", "aab", "aaaab", "aaba", "abab"});
+    auto strings_view = cudf::strings_column_view(strings);
+
+    auto results = cudf::strings::contains_re(strings_view, "aab");
+    cudf::test::fixed_width_column_wrapper<cudf::experimental::bool8> expected(
+        {true, true, true, true, false});
+    cudf::test::expect_columns_equal(*results, expected);
+}
+
+TEST_F(StringsContainsPrefixTests, AnchoredPattern)
+{
+    // ^abc takes the non-prefix start path and must stay anchored
+    cudf::test::strings_column_wrapper strings({"abc", "abcd", "xabc", "ab", ""});
+    auto strings_view = cudf::strings_column_view(strings);
+
+    auto results = cudf::strings::contains_re(strings_view, "^abc");
+    cudf::test::fixed_width_column_wrapper<cudf::experimental::bool8> expected(
+        {true, true, false, false, false});
+    cudf::test::expect_columns_equal(*results, expected);
+}
+
+TEST_F(StringsContainsPrefixTests, AlternationPattern)
+{
+    // ab|cd has no required prefix and must still match either branch
+    cudf::test::strings_column_wrapper strings({"ab", "cd", "xxcdyy", "ac", "bd"});
+    auto strings_view = cudf::strings_column_view(strings);
+
+    auto results = cudf::strings::contains_re(strings_view, "ab|cd");
+    cudf::test::fixed_width_column_wrapper<cudf::experimental::bool8> expected(
+        {true, true, true, false, false});
+    cudf::test::expect_columns_equal(*results, expected);
+}
+
+TEST_F(StringsContainsPrefixTests, MultiBytePrefix)
+{
+    // é is two UTF-8 bytes; the prefix compare walks characters, not bytes
+    cudf::test::strings_column_wrapper strings({"résumé", "resume", "xxrés", "ré", "r"});
+    auto strings_view = cudf::strings_column_view(strings);
+
+    auto results = cudf::strings::contains_re(strings_view, "rés");
+    cudf::test::fixed_width_column_wrapper<cudf::experimental::bool8> expected(
+        {true, false, true, false, false});
+    cudf::test::expect_columns_equal(*results, expected);
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/strings/copying.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/strings/utilities.h>
+
+#include <vector>
+
+
+struct StringsCopySliceTest : public cudf::test::BaseFixture {};
+
+TEST_F(StringsCopySliceTest, CopySlice)
+{
+    cudf::test::strings_column_wrapper strings({ "eee", "bb", "", "aa", "bbb", "ééé", "f" });
+    auto strings_view = cudf::strings_column_view(strings);
+
+    auto results = cudf::strings::detail::copy_slice(strings_view, 1, 5);
+
+    cudf::test::strings_column_wrapper expected({ "bb", "", "aa", "bbb" });
+    cudf::test::expect_columns_equal(*results, expected);
+}
+
+TEST_F(StringsCopySliceTest, SliceOfSlice)
+{
+    cudf::test::strings_column_wrapper strings({ "a", "bb", "ccc", "dddd", "eeeee", "ffffff", "g", "hh" });
+
+    // a copy of a slice of a sliced view must re-base offsets twice
+    auto first = cudf::experimental::slice(strings, {2, 7}).front();
+    auto first_view = cudf::strings_column_view(first);
+
+    auto results = cudf::strings::detail::copy_slice(first_view, 1, 4);
+
+    cudf::test::strings_column_wrapper expected({ "dddd", "eeeee", "ffffff" });
+    cudf::test::expect_columns_equal(*results, expected);
+}
+
+TEST_F(StringsCopySliceTest, NullRunBoundaries)
+{
+    // the copied range starts and ends inside runs of nulls
+    cudf::test::strings_column_wrapper strings(
+        { "aa", "bb", "cc", "dd", "ee", "ff", "gg", "hh" },
+        {    1,    0,    0,    1,    1,    0,    0,    1 });
+    auto strings_view = cudf::strings_column_view(strings);
+
+    auto results = cudf::strings::detail::copy_slice(strings_view, 2, 7);
+
+    cudf::test::strings_column_wrapper expected(
+        { "cc", "dd", "ee", "ff", "gg" },
+        {    0,    1,    1,    0,    0 });
+    cudf::test::expect_columns_equal(*results, expected);
+    EXPECT_EQ(3, results->null_count());
+}
+
+TEST_F(StringsCopySliceTest, EmptyStringsAtBoundaries)
+{
+    // valid empty strings at both ends of the range must stay empty (and
+    // valid) after the offsets are re-based
+    cudf::test::strings_column_wrapper strings(
+        { "xx", "", "middle", "", "yy" },
+        {    1,  1,        1,  1,    1 });
+    auto strings_view = cudf::strings_column_view(strings);
+
+    auto results = cudf::strings::detail::copy_slice(strings_view, 1, 4);
+
+    cudf::test::strings_column_wrapper expected({ "", "middle", "" });
+    cudf::test::expect_columns_equal(*results, expected);
+}
+
+TEST_F(StringsCopySliceTest, CopyThroughColumnConstructor)
+{
+    // deep-copying a sliced view is how copy_slice is normally reached
+    cudf::test::strings_column_wrapper strings(
+        { "eee", "bb", "", "aa", "bbb", "ééé" },
+        {     1,    1,  0,    1,     1,     1 });
+
+    auto sliced = cudf::experimental::slice(strings, {1, 5}).front();
+    cudf::column copied(sliced);
+
+    cudf::test::strings_column_wrapper expected({ "bb", "", "aa", "bbb" },
+                                                {    1,  0,    1,     1 });
+    cudf::test::expect_columns_equal(copied.view(), expected);
+}
+
+TEST_F(StringsCopySliceTest, EmptyRange)
+{
+    cudf::test::strings_column_wrapper strings({ "aa", "bb", "cc" });
+    auto strings_view = cudf::strings_column_view(strings);
+
+    auto results = cudf::strings::detail::copy_slice(strings_view, 2, 2);
+    cudf::test::expect_strings_empty(results->view());
+}
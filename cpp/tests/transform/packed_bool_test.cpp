@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/packed_bool.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <vector>
+
+namespace cudf {
+namespace test {
+
+using bool8 = cudf::experimental::bool8;
+namespace exp = cudf::experimental;
+
+struct PackedBoolTest : public BaseFixture {};
+
+TEST_F(PackedBoolTest, PackUnpackRoundTrip)
+{
+    // 40 rows crosses a 32-bit word boundary
+    std::vector<bool> h_bools(40);
+    for (size_t i = 0; i < h_bools.size(); i++) {
+        h_bools[i] = (i % 3) == 0;
+    }
+    fixed_width_column_wrapper<bool8> input(h_bools.begin(), h_bools.end());
+
+    auto packed = exp::pack_bools(input);
+    EXPECT_EQ(static_cast<size_type>(h_bools.size()), packed.size);
+
+    auto unpacked = exp::unpack_bools(packed);
+    EXPECT_FALSE(unpacked->view().nullable());
+    expect_columns_equal(input, unpacked->view());
+}
+
+TEST_F(PackedBoolTest, NullsFoldToFalse)
+{
+    fixed_width_column_wrapper<bool8> input{{1, 0, 1, 1, 0, 1},
+                                            {1, 1, 0, 1, 0, 0}};
+    // the unpacked column is non-nullable with nulls read back as false
+    fixed_width_column_wrapper<bool8> expected{{1, 0, 0, 1, 0, 0}};
+
+    auto unpacked = exp::unpack_bools(exp::pack_bools(input));
+    expect_columns_equal(expected, unpacked->view());
+}
+
+TEST_F(PackedBoolTest, AndOrNot)
+{
+    std::vector<bool> h_lhs(70);
+    std::vector<bool> h_rhs(70);
+    for (size_t i = 0; i < h_lhs.size(); i++) {
+        h_lhs[i] = (i % 2) == 0;
+        h_rhs[i] = (i % 3) == 0;
+    }
+    fixed_width_column_wrapper<bool8> lhs(h_lhs.begin(), h_lhs.end());
+    fixed_width_column_wrapper<bool8> rhs(h_rhs.begin(), h_rhs.end());
+
+    auto packed_lhs = exp::pack_bools(lhs);
+    auto packed_rhs = exp::pack_bools(rhs);
+
+    std::vector<bool> h_and(h_lhs.size());
+    std::vector<bool> h_or(h_lhs.size());
+    std::vector<bool> h_not(h_lhs.size());
+    for (size_t i = 0; i < h_lhs.size(); i++) {
+        h_and[i] = h_lhs[i] && h_rhs[i];
+        h_or[i] = h_lhs[i] || h_rhs[i];
+        h_not[i] = !h_lhs[i];
+    }
+
+    fixed_width_column_wrapper<bool8> expected_and(h_and.begin(), h_and.end());
+    expect_columns_equal(
+        expected_and,
+        exp::unpack_bools(exp::packed_and(packed_lhs, packed_rhs))->view());
+
+    fixed_width_column_wrapper<bool8> expected_or(h_or.begin(), h_or.end());
+    expect_columns_equal(
+        expected_or,
+        exp::unpack_bools(exp::packed_or(packed_lhs, packed_rhs))->view());
+
+    fixed_width_column_wrapper<bool8> expected_not(h_not.begin(), h_not.end());
+    expect_columns_equal(
+        expected_not,
+        exp::unpack_bools(exp::packed_not(packed_lhs))->view());
+}
+
+TEST_F(PackedBoolTest, NotClearsPaddingBits)
+{
+    // 5 rows leave 27 padding bits in the word; NOT must keep them zero so
+    // round-tripping through NOT twice reproduces the input
+    fixed_width_column_wrapper<bool8> input{{1, 0, 1, 0, 0}};
+
+    auto packed = exp::pack_bools(input);
+    auto double_not = exp::packed_not(exp::packed_not(packed));
+    expect_columns_equal(input, exp::unpack_bools(double_not)->view());
+
+    fixed_width_column_wrapper<bool8> expected_not{{0, 1, 0, 1, 1}};
+    expect_columns_equal(expected_not,
+                         exp::unpack_bools(exp::packed_not(packed))->view());
+}
+
+TEST_F(PackedBoolTest, ApplyBooleanMaskMatchesBool8)
+{
+    fixed_width_column_wrapper<int32_t> values{{0, 1, 2, 3, 4, 5, 6, 7}};
+    fixed_width_column_wrapper<bool8> mask{{1, 0, 1, 1, 0, 1, 0, 0},
+                                           {1, 1, 1, 0, 1, 1, 1, 1}};
+    table_view input{{values}};
+
+    auto expected = exp::apply_boolean_mask(input, mask);
+    auto result = exp::apply_boolean_mask(input, exp::pack_bools(mask));
+
+    expect_tables_equal(expected->view(), result->view());
+}
+
+TEST_F(PackedBoolTest, InvalidInputsThrow)
+{
+    fixed_width_column_wrapper<int32_t> not_bools{{1, 2, 3}};
+    EXPECT_THROW(exp::pack_bools(not_bools), cudf::logic_error);
+
+    fixed_width_column_wrapper<bool8> small{{1, 0}};
+    fixed_width_column_wrapper<bool8> large{{1, 0, 1}};
+    auto packed_small = exp::pack_bools(small);
+    auto packed_large = exp::pack_bools(large);
+    EXPECT_THROW(exp::packed_and(packed_small, packed_large),
+                 cudf::logic_error);
+    EXPECT_THROW(exp::packed_or(packed_small, packed_large),
+                 cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
@@ -46,6 +46,57 @@ public class Cuda {
     }
   }
 
+  /** A class representing a CUDA event, used to track async copy completion */
+  public static final class Event implements AutoCloseable {
+    final long event;
+
+    /**
+     * Create a new CUDA event with timing disabled, the cheapest kind for
+     * tracking completion.
+     */
+    public Event() {
+      this(false);
+    }
+
+    /**
+     * Create a new CUDA event
+     * @param enableTiming whether the event records a timestamp; timing events
+     *                     are more expensive to record
+     */
+    public Event(boolean enableTiming) {
+      this.event = createEvent(enableTiming);
+    }
+
+    /**
+     * Record this event into a stream. The event completes once all work
+     * enqueued on the stream before this call has finished.
+     * @param stream the stream to record into
+     */
+    public void record(Stream stream) {
+      eventRecord(event, stream.stream);
+    }
+
+    /**
+     * Check whether the event has completed without blocking.
+     * @return true if all work recorded into the event has finished
+     */
+    public boolean hasCompleted() {
+      return eventQuery(event);
+    }
+
+    /**
+     * Block the calling thread until the event has completed.
+     */
+    public void sync() {
+      eventSynchronize(event);
+    }
+
+    @Override
+    public void close() {
+      destroyEvent(event);
+    }
+  }
+
   /**
    * Mapping: cudaMemGetInfo(size_t *free, size_t *total)
    */
@@ -152,6 +203,35 @@ public class Cuda {
   private static native void memcpyOnStream(long dst, long src, long count, int kind,
       long stream) throws CudaException;
 
+  /**
+   * Copies bytes between buffers without waiting for the copy to complete.
+   * The copy is only enqueued on the stream; use an {@link Event} recorded
+   * after it to find out when the data is ready. Host memory involved in the
+   * copy should be pinned or the copy degrades to synchronous.
+   * Specifying pointers that do not match the copy direction results in undefined behavior.
+   * @param dst destination memory address
+   * @param src source memory address
+   * @param count size in bytes to copy
+   * @param kind direction of transfer. {@link CudaMemcpyKind}
+   * @param stream CUDA stream to use for the copy
+   */
+  static void asyncMemcpy(long dst, long src, long count, CudaMemcpyKind kind, Stream stream) {
+    asyncMemcpyOnStream(dst, src, count, kind.getValue(), stream.stream);
+  }
+
+  private static native void asyncMemcpyOnStream(long dst, long src, long count, int kind,
+      long stream) throws CudaException;
+
+  private static native long createEvent(boolean enableTiming) throws CudaException;
+
+  private static native void destroyEvent(long event) throws CudaException;
+
+  private static native void eventRecord(long event, long stream) throws CudaException;
+
+  private static native boolean eventQuery(long event) throws CudaException;
+
+  private static native void eventSynchronize(long event) throws CudaException;
+
   /**
    * This should only be used for tests, to enable or disable tests if the current environment
    * is not compatible with this version of the library.  Currently it only does some very
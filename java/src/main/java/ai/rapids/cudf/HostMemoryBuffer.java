@@ -543,6 +543,26 @@ public class HostMemoryBuffer extends MemoryBuffer {
         CudaMemcpyKind.DEVICE_TO_HOST, stream);
   }
 
+  /**
+   * Asynchronously copy from a DeviceMemoryBuffer to a HostMemoryBuffer.
+   * The copy is only enqueued when this returns; the given event is recorded
+   * after it so the caller can overlap the transfer with other work and poll
+   * {@link Cuda.Event#hasCompleted} (or sync) before touching the data. This
+   * buffer should be pinned (see {@link #allocate(long, boolean)}) or the
+   * copy degrades to synchronous and nothing overlaps.
+   * @param deviceMemoryBuffer buffer to copy data from
+   * @param stream CUDA stream to use
+   * @param event event recorded after the copy completes
+   */
+  public final void copyFromDeviceBufferAsync(BaseDeviceMemoryBuffer deviceMemoryBuffer,
+      Cuda.Stream stream, Cuda.Event event) {
+    addressOutOfBoundsCheck(address, deviceMemoryBuffer.length, "copy range dest");
+    assert !deviceMemoryBuffer.closed;
+    Cuda.asyncMemcpy(address, deviceMemoryBuffer.address, deviceMemoryBuffer.length,
+        CudaMemcpyKind.DEVICE_TO_HOST, stream);
+    event.record(stream);
+  }
+
   /**
    * Slice off a part of the host buffer.
    * @param offset where to start the slice at.
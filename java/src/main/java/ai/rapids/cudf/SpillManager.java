@@ -0,0 +1,149 @@
+/*
+ *
+ *  Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+package ai.rapids.cudf;
+
+import org.slf4j.Logger;
+import org.slf4j.LoggerFactory;
+
+import java.util.LinkedHashSet;
+
+/**
+ * Tracks registered {@link SpillableTable}s and evicts the least recently
+ * used ones to pinned host memory when device memory is under pressure.
+ *
+ * A device byte budget is set with {@link #initialize}. Whenever a spillable
+ * table needs device memory (at registration or when faulting a spilled table
+ * back in), the manager spills resident tables in least-recently-used order
+ * until the budget is respected. Tables spill to pinned host memory when
+ * available so the copies are fast and can overlap other work.
+ *
+ * All state transitions happen under the manager's lock, so spilling and
+ * faulting are safe to drive from multiple task threads.
+ */
+public final class SpillManager {
+  private static final Logger log = LoggerFactory.getLogger(SpillManager.class);
+
+  private static volatile SpillManager instance = null;
+
+  private final long deviceBytesLimit;
+  private long residentBytes = 0;
+  // Insertion ordered; entries are re-inserted on access so the head is the LRU
+  private final LinkedHashSet<SpillableTable> resident = new LinkedHashSet<>();
+
+  private SpillManager(long deviceBytesLimit) {
+    this.deviceBytesLimit = deviceBytesLimit;
+  }
+
+  /**
+   * Set up the spill manager with a device memory budget for spillable tables.
+   * @param deviceBytesLimit total bytes spillable tables may hold resident
+   */
+  public static synchronized void initialize(long deviceBytesLimit) {
+    if (instance != null) {
+      throw new IllegalStateException("SpillManager is already initialized");
+    }
+    instance = new SpillManager(deviceBytesLimit);
+  }
+
+  /**
+   * @return true if the manager has been initialized
+   */
+  public static boolean isInitialized() {
+    return instance != null;
+  }
+
+  /**
+   * Get the initialized spill manager.
+   */
+  public static SpillManager getInstance() {
+    SpillManager ret = instance;
+    if (ret == null) {
+      throw new IllegalStateException("SpillManager is not initialized");
+    }
+    return ret;
+  }
+
+  /**
+   * @return bytes of spillable tables currently resident in device memory.
+   */
+  public synchronized long getResidentBytes() {
+    return residentBytes;
+  }
+
+  /**
+   * Spill resident tables in LRU order until at least `bytes` of the budget
+   * is free. Useful ahead of a large non-spillable allocation.
+   * @param bytes how many bytes of the budget to free up
+   */
+  public synchronized void freeUpTo(long bytes) {
+    makeRoom(Math.min(bytes, deviceBytesLimit), null);
+  }
+
+  synchronized void register(SpillableTable table) {
+    makeRoom(table.getSizeInBytes(), table);
+    resident.add(table);
+    residentBytes += table.getSizeInBytes();
+  }
+
+  synchronized void unregister(SpillableTable table) {
+    if (resident.remove(table)) {
+      residentBytes -= table.getSizeInBytes();
+    }
+  }
+
+  /**
+   * Note an access to a resident table, making it the most recently used.
+   */
+  synchronized void noteAccess(SpillableTable table) {
+    if (resident.remove(table)) {
+      resident.add(table);
+    }
+  }
+
+  /**
+   * Fault a spilled table back into device memory, evicting others as needed.
+   * Called by {@link SpillableTable#getTable()}; the manager's lock covers the
+   * whole transition.
+   */
+  synchronized void unspill(SpillableTable table) {
+    makeRoom(table.getSizeInBytes(), table);
+    table.unspillUnderLock();
+    resident.add(table);
+    residentBytes += table.getSizeInBytes();
+  }
+
+  private void makeRoom(long bytes, SpillableTable requester) {
+    while (residentBytes + bytes > deviceBytesLimit && !resident.isEmpty()) {
+      SpillableTable victim = null;
+      for (SpillableTable candidate : resident) {
+        if (candidate != requester) {
+          victim = candidate;
+          break;
+        }
+      }
+      if (victim == null) {
+        break;
+      }
+      log.debug("Spilling {} bytes to host memory", victim.getSizeInBytes());
+      victim.spillUnderLock();
+      resident.remove(victim);
+      residentBytes -= victim.getSizeInBytes();
+    }
+  }
+}
@@ -0,0 +1,195 @@
+/*
+ *
+ *  Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+package ai.rapids.cudf;
+
+/**
+ * A device table that can be transparently evicted to pinned host memory and
+ * faulted back on access.
+ *
+ * The table must be backed by a single contiguous device buffer (the layout
+ * {@link Table#contiguousSplit} produces), so a spill is one D2H copy and a
+ * fault is one H2D copy plus rebuilding the column views against the new base
+ * address; the rebuilding metadata is captured natively at construction.
+ *
+ * Construction takes ownership of the {@link ContiguousTable} and registers
+ * with the {@link SpillManager}, which evicts least-recently-used tables when
+ * the device budget is exceeded. Access the data only through
+ * {@link #getTable()} and do not hold the returned table across other
+ * spillable accesses, as a spill invalidates it.
+ */
+public final class SpillableTable implements AutoCloseable {
+  static {
+    NativeDepsLoader.loadNativeDeps();
+  }
+
+  private final SpillManager manager;
+  private final long sizeInBytes;
+  private long metadata;
+
+  // Resident state; null while spilled
+  private ContiguousTable contiguous;
+  private Table table;
+  private DeviceMemoryBuffer deviceBuffer;
+
+  // Spilled state; null while resident
+  private HostMemoryBuffer hostBuffer;
+
+  /**
+   * Make a contiguous table spillable, taking ownership of it.
+   * @param contiguous the table to manage; do not close or use it directly
+   *                   afterwards
+   */
+  public SpillableTable(ContiguousTable contiguous) {
+    this.manager = SpillManager.getInstance();
+    this.contiguous = contiguous;
+    this.table = contiguous.getTable();
+    this.deviceBuffer = contiguous.getBuffer();
+    this.sizeInBytes = deviceBuffer.getLength();
+
+    long[] views = new long[table.getNumberOfColumns()];
+    for (int i = 0; i < views.length; i++) {
+      views[i] = table.getColumn(i).getNativeView();
+    }
+    this.metadata = createSpillMetadata(views, deviceBuffer.getAddress());
+    manager.register(this);
+  }
+
+  /**
+   * @return the size of the backing device buffer in bytes.
+   */
+  public long getSizeInBytes() {
+    return sizeInBytes;
+  }
+
+  /**
+   * @return true if the table currently lives in host memory.
+   */
+  public boolean isSpilled() {
+    synchronized (manager) {
+      return hostBuffer != null;
+    }
+  }
+
+  /**
+   * Get the table, faulting it back into device memory if it was spilled.
+   * The returned table is valid until this spillable table is next evicted
+   * or closed.
+   */
+  public Table getTable() {
+    synchronized (manager) {
+      if (metadata == 0) {
+        throw new IllegalStateException("SpillableTable is closed");
+      }
+      if (hostBuffer != null) {
+        manager.unspill(this);
+      } else {
+        manager.noteAccess(this);
+      }
+      return table;
+    }
+  }
+
+  /**
+   * Copy the device buffer to pinned host memory and drop the device copies.
+   * Called by the manager with its lock held.
+   */
+  void spillUnderLock() {
+    hostBuffer = HostMemoryBuffer.allocate(sizeInBytes, true);
+    Cuda.memcpy(hostBuffer.getAddress(), deviceBuffer.getAddress(), sizeInBytes,
+        CudaMemcpyKind.DEVICE_TO_HOST);
+    closeResident();
+  }
+
+  /**
+   * Copy the host buffer back to a fresh device buffer and rebuild the table
+   * over it. Called by the manager with its lock held.
+   */
+  void unspillUnderLock() {
+    DeviceMemoryBuffer newBuffer = DeviceMemoryBuffer.allocate(sizeInBytes);
+    try {
+      Cuda.memcpy(newBuffer.getAddress(), hostBuffer.getAddress(), sizeInBytes,
+          CudaMemcpyKind.HOST_TO_DEVICE);
+
+      long[] views = restoreSpilledColumnViews(metadata, newBuffer.getAddress());
+      ColumnVector[] vectors = new ColumnVector[views.length];
+      try {
+        for (int i = 0; i < vectors.length; i++) {
+          vectors[i] = ColumnVector.fromViewWithContiguousAllocation(views[i], newBuffer);
+        }
+        table = new Table(vectors);
+      } finally {
+        for (ColumnVector vector : vectors) {
+          if (vector != null) {
+            vector.close();
+          }
+        }
+      }
+
+      deviceBuffer = newBuffer;
+      newBuffer = null;
+      hostBuffer.close();
+      hostBuffer = null;
+    } finally {
+      if (newBuffer != null) {
+        newBuffer.close();
+      }
+    }
+  }
+
+  private void closeResident() {
+    if (contiguous != null) {
+      // the contiguous table owns both the table and the buffer
+      contiguous.close();
+      contiguous = null;
+      table = null;
+      deviceBuffer = null;
+    } else {
+      if (table != null) {
+        table.close();
+        table = null;
+      }
+      if (deviceBuffer != null) {
+        deviceBuffer.close();
+        deviceBuffer = null;
+      }
+    }
+  }
+
+  @Override
+  public void close() {
+    synchronized (manager) {
+      manager.unregister(this);
+      closeResident();
+      if (hostBuffer != null) {
+        hostBuffer.close();
+        hostBuffer = null;
+      }
+      if (metadata != 0) {
+        freeSpillMetadata(metadata);
+        metadata = 0;
+      }
+    }
+  }
+
+  private static native long createSpillMetadata(long[] columnViewHandles, long baseAddress);
+
+  private static native long[] restoreSpilledColumnViews(long metadataHandle, long baseAddress);
+
+  private static native void freeSpillMetadata(long metadataHandle);
+}
@@ -273,6 +273,8 @@ public final class Table implements AutoCloseable {
 
   private static native long[] filter(long input, long mask);
 
+  private static native long[] executeBatch(long inputTable, int[] opCodes, long[] opArgs);
+
   //XXX until we have split a ColumnVector into a host column and a device column
   // caching the table_view is a bug, as we could drop the device data which would
   // invalidate everything that the table_view is pointing at on the device.
@@ -864,6 +866,86 @@ public final class Table implements AutoCloseable {
     }
   }
 
+  /**
+   * Start building a batch of operations to run in a single native call.
+   * @see TableBatch
+   */
+  public TableBatch startBatch() {
+    return new TableBatch(this);
+  }
+
+  /**
+   * A list of operations executed in one JNI crossing on one stream.
+   *
+   * Every individual table operation pays a JNI transition plus argument
+   * marshalling, which for pipelines of small operations can exceed the
+   * kernel time. A batch submits the whole pipeline at once: each step
+   * consumes the previous step's output, intermediate tables are retained
+   * and freed natively without their handles ever surfacing in the JVM, and
+   * only the final result comes back as Java-visible columns.
+   *
+   * The columns and tables referenced by the steps must stay valid until
+   * {@link #execute} returns. The batch object may be executed only once.
+   */
+  public static final class TableBatch {
+    // These numbers come from TableJni.cpp and must stay in sync
+    private static final int OP_FILTER = 0;
+    private static final int OP_GATHER = 1;
+    private static final int OP_CONCATENATE = 2;
+
+    private final Table input;
+    private final List<Integer> opCodes = new ArrayList<>();
+    private final List<Long> opArgs = new ArrayList<>();
+
+    TableBatch(Table input) {
+      this.input = input;
+    }
+
+    /**
+     * Filter the current table with a boolean mask, as {@link Table#filter}.
+     */
+    public TableBatch filter(ColumnVector mask) {
+      assert mask.getType() == DType.BOOL8 : "Mask column must be of type BOOL8";
+      opCodes.add(OP_FILTER);
+      opArgs.add(mask.getNativeView());
+      return this;
+    }
+
+    /**
+     * Gather the rows of the current table with a gather map column.
+     */
+    public TableBatch gather(ColumnVector gatherMap) {
+      opCodes.add(OP_GATHER);
+      opArgs.add(gatherMap.getNativeView());
+      return this;
+    }
+
+    /**
+     * Concatenate another table below the current table.
+     */
+    public TableBatch concatenate(Table other) {
+      opCodes.add(OP_CONCATENATE);
+      opArgs.add(other.nativeHandle);
+      return this;
+    }
+
+    /**
+     * Run all queued operations in one native call and return the final table.
+     */
+    public Table execute() {
+      int[] codes = new int[opCodes.size()];
+      long[] args = new long[opArgs.size()];
+      for (int i = 0; i < codes.length; i++) {
+        codes[i] = opCodes.get(i);
+        args[i] = opArgs.get(i);
+      }
+      try (DevicePrediction prediction =
+               new DevicePrediction(input.getDeviceMemorySize(), "executeBatch")) {
+        return new Table(executeBatch(input.nativeHandle, codes, args));
+      }
+    }
+  }
+
   /**
    * Split a table at given boundaries, but the result of each split has memory that is laid out
    * in a contiguous range of memory.  This allows for us to optimize copying the data in a single
@@ -116,4 +116,58 @@ JNIEXPORT void JNICALL Java_ai_rapids_cudf_Cuda_memcpyOnStream(JNIEnv* env, jcla
   JNI_CUDA_TRY(env, , cudaStreamSynchronize(stream));
 }
 
+JNIEXPORT void JNICALL Java_ai_rapids_cudf_Cuda_asyncMemcpyOnStream(JNIEnv* env, jclass,
+    jlong jdst, jlong jsrc, jlong count, jint jkind, jlong jstream) {
+  if (count == 0) {
+    return;
+  }
+  JNI_ARG_CHECK(env, jdst != 0, "dst memory pointer is null", );
+  JNI_ARG_CHECK(env, jsrc != 0, "src memory pointer is null", );
+  auto dst = reinterpret_cast<void*>(jdst);
+  auto src = reinterpret_cast<void*>(jsrc);
+  auto kind = static_cast<cudaMemcpyKind>(jkind);
+  auto stream = reinterpret_cast<cudaStream_t>(jstream);
+  JNI_CUDA_TRY(env, , cudaMemcpyAsync(dst, src, count, kind, stream));
+}
+
+JNIEXPORT jlong JNICALL Java_ai_rapids_cudf_Cuda_createEvent(JNIEnv* env, jclass,
+    jboolean enableTiming) {
+  cudaEvent_t event;
+  unsigned int flags = enableTiming ? cudaEventDefault : cudaEventDisableTiming;
+  JNI_CUDA_TRY(env, 0, cudaEventCreateWithFlags(&event, flags));
+  return reinterpret_cast<jlong>(event);
+}
+
+JNIEXPORT void JNICALL Java_ai_rapids_cudf_Cuda_destroyEvent(JNIEnv* env, jclass,
+    jlong jevent) {
+  auto event = reinterpret_cast<cudaEvent_t>(jevent);
+  JNI_CUDA_TRY(env, , cudaEventDestroy(event));
+}
+
+JNIEXPORT void JNICALL Java_ai_rapids_cudf_Cuda_eventRecord(JNIEnv* env, jclass,
+    jlong jevent, jlong jstream) {
+  auto event = reinterpret_cast<cudaEvent_t>(jevent);
+  auto stream = reinterpret_cast<cudaStream_t>(jstream);
+  JNI_CUDA_TRY(env, , cudaEventRecord(event, stream));
+}
+
+JNIEXPORT jboolean JNICALL Java_ai_rapids_cudf_Cuda_eventQuery(JNIEnv* env, jclass,
+    jlong jevent) {
+  auto event = reinterpret_cast<cudaEvent_t>(jevent);
+  cudaError_t status = cudaEventQuery(event);
+  if (status == cudaErrorNotReady) {
+    // Clear the error so it does not propagate to unrelated calls
+    cudaGetLastError();
+    return JNI_FALSE;
+  }
+  JNI_CUDA_TRY(env, JNI_FALSE, status);
+  return JNI_TRUE;
+}
+
+JNIEXPORT void JNICALL Java_ai_rapids_cudf_Cuda_eventSynchronize(JNIEnv* env, jclass,
+    jlong jevent) {
+  auto event = reinterpret_cast<cudaEvent_t>(jevent);
+  JNI_CUDA_TRY(env, , cudaEventSynchronize(event));
+}
+
 } // extern "C"
@@ -15,6 +15,7 @@
  */
 
 #include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/groupby.hpp>
 #include <cudf/hashing.hpp>
 #include <cudf/io/functions.hpp>
@@ -92,6 +93,56 @@ std::unique_ptr<cudf::experimental::aggregation> map_jni_aggregation(jint op) {
   }
 }
 
+/**
+ * Relative description of a column inside a contiguous buffer, enough to
+ * rebuild its view at a different base address after a spill round trip
+ * through host memory.
+ */
+struct spill_column_meta {
+  cudf::data_type type{cudf::EMPTY};
+  cudf::size_type size{0};
+  cudf::size_type null_count{0};
+  cudf::size_type offset{0};
+  bool has_data{false};
+  std::ptrdiff_t data_offset{0};
+  bool has_mask{false};
+  std::ptrdiff_t mask_offset{0};
+  std::vector<spill_column_meta> children;
+};
+
+static spill_column_meta make_spill_meta(cudf::column_view const &view, char const *base) {
+  spill_column_meta meta;
+  meta.type = view.type();
+  meta.size = view.size();
+  meta.null_count = view.null_count();
+  meta.offset = view.offset();
+  if (view.head() != nullptr) {
+    meta.has_data = true;
+    meta.data_offset = reinterpret_cast<char const *>(view.head()) - base;
+  }
+  if (view.null_mask() != nullptr) {
+    meta.has_mask = true;
+    meta.mask_offset = reinterpret_cast<char const *>(view.null_mask()) - base;
+  }
+  for (cudf::size_type i = 0; i < view.num_children(); i++) {
+    meta.children.push_back(make_spill_meta(view.child(i), base));
+  }
+  return meta;
+}
+
+static cudf::column_view rebuild_spilled_view(spill_column_meta const &meta, char const *base) {
+  std::vector<cudf::column_view> children;
+  children.reserve(meta.children.size());
+  for (auto const &child : meta.children) {
+    children.push_back(rebuild_spilled_view(child, base));
+  }
+  return cudf::column_view(
+      meta.type, meta.size, meta.has_data ? base + meta.data_offset : nullptr,
+      meta.has_mask ? reinterpret_cast<cudf::bitmask_type const *>(base + meta.mask_offset)
+                    : nullptr,
+      meta.null_count, meta.offset, children);
+}
+
 } // namespace jni
 } // namespace cudf
 
@@ -699,6 +750,62 @@ JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_Table_filter(JNIEnv *env, jclas
   CATCH_STD(env, 0);
 }
 
+JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_Table_executeBatch(JNIEnv *env, jclass,
+                                                                    jlong input_jtable,
+                                                                    jintArray j_op_codes,
+                                                                    jlongArray j_op_args) {
+  JNI_NULL_CHECK(env, input_jtable, "input table is null", 0);
+  JNI_NULL_CHECK(env, j_op_codes, "op codes are null", 0);
+  JNI_NULL_CHECK(env, j_op_args, "op args are null", 0);
+  try {
+    cudf::table_view *input = reinterpret_cast<cudf::table_view *>(input_jtable);
+    cudf::jni::native_jintArray op_codes(env, j_op_codes);
+    cudf::jni::native_jlongArray op_args(env, j_op_args);
+    JNI_ARG_CHECK(env, op_codes.size() == op_args.size(),
+                  "op codes and op args differ in length", 0);
+
+    // Each step reads the previous step's output and the superseded
+    // intermediate is freed right away, so only the final result's handles
+    // cross back into the JVM.
+    std::unique_ptr<cudf::experimental::table> current;
+    cudf::table_view current_view = *input;
+    for (int i = 0; i < op_codes.size(); i++) {
+      JNI_NULL_CHECK(env, op_args[i], "op arg is null", 0);
+      std::unique_ptr<cudf::experimental::table> next;
+      // These numbers come from Table.TableBatch and must stay in sync
+      switch (op_codes[i]) {
+        case 0: { // FILTER
+          auto mask = reinterpret_cast<cudf::column_view *>(op_args[i]);
+          next = cudf::experimental::apply_boolean_mask(current_view, *mask);
+          break;
+        }
+        case 1: { // GATHER
+          auto gather_map = reinterpret_cast<cudf::column_view *>(op_args[i]);
+          next = cudf::experimental::gather(current_view, *gather_map);
+          break;
+        }
+        case 2: { // CONCATENATE
+          auto other = reinterpret_cast<cudf::table_view *>(op_args[i]);
+          std::vector<cudf::table_view> to_concat{current_view, *other};
+          next = cudf::experimental::concatenate(to_concat);
+          break;
+        }
+        default:
+          throw std::logic_error("Unsupported batch operation");
+      }
+      current = std::move(next);
+      current_view = current->view();
+    }
+
+    if (current == nullptr) {
+      // Empty batch: return a copy of the input
+      current = std::make_unique<cudf::experimental::table>(current_view);
+    }
+    return cudf::jni::convert_table_for_return(env, current);
+  }
+  CATCH_STD(env, 0);
+}
+
 JNIEXPORT jlong JNICALL Java_ai_rapids_cudf_Table_bound(JNIEnv *env, jclass,
     jlong input_jtable, jlong values_jtable, jbooleanArray desc_flags, jbooleanArray are_nulls_smallest,
     jboolean is_upper_bound) {
@@ -733,6 +840,52 @@ JNIEXPORT jlong JNICALL Java_ai_rapids_cudf_Table_bound(JNIEnv *env, jclass,
   CATCH_STD(env, 0);
 }
 
+JNIEXPORT jlong JNICALL Java_ai_rapids_cudf_SpillableTable_createSpillMetadata(
+    JNIEnv *env, jclass, jlongArray j_column_views, jlong base_address) {
+  JNI_NULL_CHECK(env, j_column_views, "column views are null", 0);
+  JNI_NULL_CHECK(env, base_address, "base address is null", 0);
+  try {
+    cudf::jni::native_jpointerArray<cudf::column_view> views(env, j_column_views);
+    char const *base = reinterpret_cast<char const *>(base_address);
+
+    auto metadata = std::make_unique<std::vector<cudf::jni::spill_column_meta>>();
+    metadata->reserve(views.size());
+    for (int i = 0; i < views.size(); i++) {
+      JNI_NULL_CHECK(env, views[i], "column view included a null", 0);
+      metadata->push_back(cudf::jni::make_spill_meta(*views[i], base));
+    }
+    return reinterpret_cast<jlong>(metadata.release());
+  }
+  CATCH_STD(env, 0);
+}
+
+JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_SpillableTable_restoreSpilledColumnViews(
+    JNIEnv *env, jclass, jlong metadata_handle, jlong base_address) {
+  JNI_NULL_CHECK(env, metadata_handle, "metadata handle is null", 0);
+  JNI_NULL_CHECK(env, base_address, "base address is null", 0);
+  try {
+    auto metadata =
+        reinterpret_cast<std::vector<cudf::jni::spill_column_meta> *>(metadata_handle);
+    char const *base = reinterpret_cast<char const *>(base_address);
+
+    cudf::jni::native_jlongArray view_handles(env, metadata->size());
+    for (size_t i = 0; i < metadata->size(); i++) {
+      view_handles[i] = reinterpret_cast<jlong>(
+          new cudf::column_view(cudf::jni::rebuild_spilled_view((*metadata)[i], base)));
+    }
+    return view_handles.get_jArray();
+  }
+  CATCH_STD(env, 0);
+}
+
+JNIEXPORT void JNICALL Java_ai_rapids_cudf_SpillableTable_freeSpillMetadata(
+    JNIEnv *env, jclass, jlong metadata_handle) {
+  try {
+    delete reinterpret_cast<std::vector<cudf::jni::spill_column_meta> *>(metadata_handle);
+  }
+  CATCH_STD(env, );
+}
+
 JNIEXPORT jobjectArray JNICALL Java_ai_rapids_cudf_Table_contiguousSplit(JNIEnv *env, jclass clazz,
                                                              jlong input_table,
                                                              jintArray split_indices) {